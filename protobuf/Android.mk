@@ -25,13 +25,18 @@ CC_LITE_SRC_FILES := \
     src/google/protobuf/stubs/hash.h                                 \
     src/google/protobuf/stubs/map-util.h                             \
     src/google/protobuf/stubs/stl_util-inl.h                         \
+    src/google/protobuf/arena.cc                                     \
     src/google/protobuf/extension_set.cc                             \
     src/google/protobuf/generated_message_util.cc                    \
+    src/google/protobuf/generated_message_table_driven_lite.cc       \
+    src/google/protobuf/lazy_field.cc                                \
     src/google/protobuf/message_lite.cc                              \
     src/google/protobuf/repeated_field.cc                            \
+    src/google/protobuf/string_piece_field.cc                        \
     src/google/protobuf/wire_format_lite.cc                          \
     src/google/protobuf/io/coded_stream.cc                           \
     src/google/protobuf/io/coded_stream_inl.h                        \
+    src/google/protobuf/io/delimited_message_stream.cc               \
     src/google/protobuf/io/zero_copy_stream.cc                       \
     src/google/protobuf/io/zero_copy_stream_impl_lite.cc
 
@@ -50,6 +55,7 @@ JAVA_LITE_SRC_FILES := \
     java/src/main/java/com/google/protobuf/GeneratedMessageLite.java
 
 COMPILER_SRC_FILES :=  \
+    src/google/protobuf/arena.cc \
     src/google/protobuf/descriptor.cc \
     src/google/protobuf/descriptor.pb.cc \
     src/google/protobuf/descriptor_database.cc \
@@ -57,12 +63,15 @@ COMPILER_SRC_FILES :=  \
     src/google/protobuf/extension_set.cc \
     src/google/protobuf/extension_set_heavy.cc \
     src/google/protobuf/generated_message_reflection.cc \
+    src/google/protobuf/generated_message_table_driven_lite.cc \
     src/google/protobuf/generated_message_util.cc \
+    src/google/protobuf/lazy_field.cc \
     src/google/protobuf/message.cc \
     src/google/protobuf/message_lite.cc \
     src/google/protobuf/reflection_ops.cc \
     src/google/protobuf/repeated_field.cc \
     src/google/protobuf/service.cc \
+    src/google/protobuf/string_piece_field.cc \
     src/google/protobuf/text_format.cc \
     src/google/protobuf/unknown_field_set.cc \
     src/google/protobuf/wire_format.cc \
@@ -88,6 +97,7 @@ COMPILER_SRC_FILES :=  \
     src/google/protobuf/compiler/cpp/cpp_primitive_field.cc \
     src/google/protobuf/compiler/cpp/cpp_service.cc \
     src/google/protobuf/compiler/cpp/cpp_string_field.cc \
+    src/google/protobuf/compiler/cpp/cpp_string_piece_field.cc \
     src/google/protobuf/compiler/java/java_enum.cc \
     src/google/protobuf/compiler/java/java_enum_field.cc \
     src/google/protobuf/compiler/java/java_extension.cc \
@@ -120,6 +130,8 @@ COMPILER_SRC_FILES :=  \
     src/google/protobuf/compiler/javanano/javanano_primitive_field.cc \
     src/google/protobuf/compiler/python/python_generator.cc \
     src/google/protobuf/io/coded_stream.cc \
+    src/google/protobuf/io/compressed_stream.cc \
+    src/google/protobuf/io/delimited_message_stream.cc \
     src/google/protobuf/io/gzip_stream.cc \
     src/google/protobuf/io/printer.cc \
     src/google/protobuf/io/tokenizer.cc \
@@ -130,6 +142,7 @@ COMPILER_SRC_FILES :=  \
     src/google/protobuf/stubs/hash.cc \
     src/google/protobuf/stubs/once.cc \
     src/google/protobuf/stubs/structurally_valid.cc \
+    src/google/protobuf/stubs/float_conversion.cc \
     src/google/protobuf/stubs/strutil.cc \
     src/google/protobuf/stubs/substitute.cc
 
@@ -246,15 +259,19 @@ include $(BUILD_STATIC_LIBRARY)
 # =======================================================
 protobuf_cc_full_src_files := \
     $(CC_LITE_SRC_FILES)                                             \
+    src/google/protobuf/stubs/float_conversion.cc                    \
+    src/google/protobuf/stubs/float_conversion.h                     \
     src/google/protobuf/stubs/strutil.cc                             \
     src/google/protobuf/stubs/strutil.h                              \
     src/google/protobuf/stubs/substitute.cc                          \
     src/google/protobuf/stubs/substitute.h                           \
     src/google/protobuf/stubs/structurally_valid.cc                  \
+    src/google/protobuf/stubs/structurally_valid.h                   \
     src/google/protobuf/descriptor.cc                                \
     src/google/protobuf/descriptor.pb.cc                             \
     src/google/protobuf/descriptor_database.cc                       \
     src/google/protobuf/dynamic_message.cc                           \
+    src/google/protobuf/generated_message_table_driven.cc            \
     src/google/protobuf/extension_set_heavy.cc                       \
     src/google/protobuf/generated_message_reflection.cc              \
     src/google/protobuf/message.cc                                   \
@@ -263,6 +280,7 @@ protobuf_cc_full_src_files := \
     src/google/protobuf/text_format.cc                               \
     src/google/protobuf/unknown_field_set.cc                         \
     src/google/protobuf/wire_format.cc                               \
+    src/google/protobuf/io/compressed_stream.cc                      \
     src/google/protobuf/io/gzip_stream.cc                            \
     src/google/protobuf/io/printer.cc                                \
     src/google/protobuf/io/tokenizer.cc                              \
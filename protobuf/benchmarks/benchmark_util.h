@@ -0,0 +1,120 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// http://code.google.com/p/protobuf/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Timing shared by the benchmarks in this directory.
+//
+// Every benchmark reports the median of several timed runs, so that a run
+// disturbed by another process doesn't skew its result, and reads a
+// monotonic clock, so that clock adjustments don't either.  Operations
+// which take well under a second use MeasureMedian(), which repeats them
+// until each run is long enough to time; passes over large inputs, which
+// are long enough already, use MeasureMedianOfPasses().
+
+#ifndef PROTOBUF_BENCHMARKS_BENCHMARK_UTIL_H__
+#define PROTOBUF_BENCHMARKS_BENCHMARK_UTIL_H__
+
+#include <sys/time.h>
+#include <time.h>
+#include <algorithm>
+#include <vector>
+
+namespace protobuf_benchmarks {
+
+// How long MeasureMedian() makes each run, at least, and how many runs it
+// takes the median of by default.
+const double kMinSeconds = 0.05;
+const int kRuns = 5;
+
+// Returns the time in seconds since some fixed point, from a monotonic clock
+// where the system has one.
+inline double Now() {
+#ifdef CLOCK_MONOTONIC
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+#else
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return tv.tv_sec + tv.tv_usec / 1e6;
+#endif
+}
+
+// Returns the median of times, which must not be empty.
+inline double Median(std::vector<double> times) {
+  std::sort(times.begin(), times.end());
+  return times[times.size() / 2];
+}
+
+// Calls function(state) iterations times and returns the seconds taken.
+template <typename State>
+double TimeIterations(void (*function)(State*), State* state,
+                      int iterations) {
+  double start = Now();
+  for (int i = 0; i < iterations; i++) {
+    function(state);
+  }
+  return Now() - start;
+}
+
+// Calls function(state) once to warm up, finds an iteration count which
+// takes at least min_seconds, then times runs runs of that many iterations.
+// Returns the median time of one call, in seconds.
+template <typename State>
+double MeasureMedian(void (*function)(State*), State* state,
+                     double min_seconds = kMinSeconds, int runs = kRuns) {
+  function(state);
+  int iterations = 1;
+  while (TimeIterations(function, state, iterations) < min_seconds) {
+    iterations *= 2;
+  }
+
+  std::vector<double> times;
+  for (int run = 0; run < runs; run++) {
+    times.push_back(TimeIterations(function, state, iterations) / iterations);
+  }
+  return Median(times);
+}
+
+// Times runs calls of function(state), each of which makes a whole pass over
+// the benchmark's input, and returns the median, in seconds.  There is no
+// warm-up call; function should leave state ready for the next pass.
+template <typename State>
+double MeasureMedianOfPasses(void (*function)(State*), State* state,
+                             int runs = kRuns) {
+  std::vector<double> times;
+  for (int run = 0; run < runs; run++) {
+    times.push_back(TimeIterations(function, state, 1));
+  }
+  return Median(times);
+}
+
+}  // namespace protobuf_benchmarks
+
+#endif  // PROTOBUF_BENCHMARKS_BENCHMARK_UTIL_H__
@@ -0,0 +1,175 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// http://code.google.com/p/protobuf/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Compresses and uncompresses serialized Records with CompressedOutputStream
+// and CompressedInputStream, using each built-in codec.
+//
+// Usage:  compressed_stream_benchmark [megabytes [block_size]]
+//
+// Defaults to 256MB and the streams' default block size.  Each direction is
+// timed kRuns times and the median reported.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/io/compressed_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+#include "benchmark_messages.pb.h"
+#include "benchmark_util.h"
+
+namespace protobuf_benchmarks {
+namespace {
+
+using std::min;
+using std::string;
+using google::protobuf::int64;
+namespace io = google::protobuf::io;
+
+// How many different records make up the input.
+const int kRecordCount = 1024;
+
+// Serialized records which vary enough to compress realistically.
+string MakeInput() {
+  string input;
+  for (int i = 0; i < kRecordCount; i++) {
+    Record record;
+    record.set_id(GOOGLE_LONGLONG(1234567890123) + i * 7919);
+    record.set_name("record number " + string(1 + i % 13, 'a' + i % 26));
+    record.set_count(i);
+    record.set_score(i / 7.0);
+    record.set_timestamp(GOOGLE_ULONGLONG(1300000000000000) + i * 1013);
+    for (int j = 0; j < 20; j++) {
+      record.add_values(i * j * 37 % 10007);
+    }
+    record.AppendToString(&input);
+  }
+  return input;
+}
+
+// Writes size bytes of input, over and over, to output.
+void Write(io::ZeroCopyOutputStream* output, const string& input, int64 size) {
+  int64 position = 0;
+  void* data;
+  int data_size = 0;
+  while (size > 0) {
+    if (data_size == 0) GOOGLE_CHECK(output->Next(&data, &data_size));
+    int n = min<int64>(min<int64>(data_size, input.size() - position), size);
+    memcpy(data, input.data() + position, n);
+    data = static_cast<char*>(data) + n;
+    data_size -= n;
+    size -= n;
+    position = (position + n) % input.size();
+  }
+  output->BackUp(data_size);
+}
+
+struct State {
+  io::CompressionType type;
+  const string* input;
+  int64 size;
+  int block_size;
+  // Sized for the worst case by Run(); the first compressed_size bytes hold
+  // the output of the last Compress().
+  string compressed;
+  int64 compressed_size;
+};
+
+void Compress(State* state) {
+  io::ArrayOutputStream array_output(&state->compressed[0],
+                                     state->compressed.size());
+  io::CompressedOutputStream output(&array_output, state->type,
+                                    state->block_size);
+  Write(&output, *state->input, state->size);
+  GOOGLE_CHECK(output.Close());
+  state->compressed_size = array_output.ByteCount();
+}
+
+void Uncompress(State* state) {
+  int64 uncompressed = 0;
+  io::ArrayInputStream array_input(state->compressed.data(),
+                                   state->compressed_size);
+  io::CompressedInputStream input_stream(&array_input);
+  const void* data;
+  int data_size;
+  while (input_stream.Next(&data, &data_size)) {
+    uncompressed += data_size;
+  }
+  GOOGLE_CHECK(!input_stream.HadError());
+  GOOGLE_CHECK_EQ(uncompressed, state->size);
+}
+
+void Run(const char* name, io::CompressionType type, const string& input,
+         int64 size, int block_size) {
+  if (io::GetCodec(type) == NULL) {
+    printf("%-8s (not available)\n", name);
+    return;
+  }
+
+  State state;
+  state.type = type;
+  state.input = &input;
+  state.size = size;
+  state.block_size = block_size;
+  // Blocks which don't compress are stored as-is, so the output is at most
+  // the input plus the framing: a few bytes per block.
+  int blocks = size / (block_size > 0 ? block_size : 65536) + 1;
+  state.compressed.resize(size + blocks * 16 + 16);
+
+  double compress_seconds = MeasureMedianOfPasses(&Compress, &state);
+  double uncompress_seconds = MeasureMedianOfPasses(&Uncompress, &state);
+
+  printf("%-8s %12.1f %12.1f %8.1f%%\n", name,
+         size / compress_seconds / (1 << 20),
+         size / uncompress_seconds / (1 << 20),
+         state.compressed_size * 100.0 / size);
+}
+
+}  // namespace
+}  // namespace protobuf_benchmarks
+
+int main(int argc, char* argv[]) {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+  using namespace protobuf_benchmarks;
+
+  int64 size = static_cast<int64>((argc > 1) ? atoi(argv[1]) : 256) << 20;
+  int block_size = (argc > 2) ? atoi(argv[2]) : -1;
+  string input = MakeInput();
+
+  printf("%-8s %12s %12s %9s\n", "", "compress", "uncompress", "ratio");
+  printf("%-8s %12s %12s\n", "", "MB/s", "MB/s");
+  Run("none", io::NO_COMPRESSION, input, size, block_size);
+  Run("fast", io::FAST_COMPRESSION, input, size, block_size);
+  Run("zlib", io::ZLIB_COMPRESSION, input, size, block_size);
+  return 0;
+}
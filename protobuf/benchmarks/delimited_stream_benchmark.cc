@@ -0,0 +1,301 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// http://code.google.com/p/protobuf/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Writes and reads a file of size-delimited messages, comparing
+// DelimitedMessageWriter and DelimitedMessageReader with the usual
+// hand-written framing, which builds a CodedOutputStream or CodedInputStream
+// for each message so as to stay within CodedInputStream's total bytes
+// limit.  Reading is also timed through MmapInputStream rather than
+// FileInputStream.
+//
+// Usage:  delimited_stream_benchmark [megabytes [file]]
+//
+// Each variant writes or reads the whole file kPasses times, and the median
+// pass is reported.  The file defaults to 2048MB in /tmp; make it bigger than
+// memory to include the disk.
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <string>
+#include <vector>
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/delimited_message_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl.h>
+#include "benchmark_messages.pb.h"
+#include "benchmark_util.h"
+
+#ifndef O_BINARY
+#define O_BINARY 0
+#endif
+
+namespace protobuf_benchmarks {
+namespace {
+
+using std::string;
+using std::vector;
+using google::protobuf::int64;
+using google::protobuf::uint32;
+using google::protobuf::MessageLite;
+namespace io = google::protobuf::io;
+
+// How many different records are written, over and over.
+const int kRecordCount = 64;
+
+// How many passes over the file each variant makes.  Fewer than the usual
+// kRuns, since each pass takes seconds.
+const int kPasses = 3;
+
+// Keeps results from being optimized away.
+int sink = 0;
+
+void FillRecord(int i, Record* record) {
+  record->set_id(GOOGLE_LONGLONG(1234567890123) + i);
+  record->set_name("a record with a reasonably long name");
+  record->set_count(i);
+  record->set_score(0.75);
+  record->set_active(i % 2 == 0);
+  record->set_kind(Record::KIND_B);
+  record->set_timestamp(GOOGLE_ULONGLONG(1300000000000000) + i * 1000);
+  for (int j = 0; j < 5; j++) {
+    record->add_tags("tag");
+  }
+  for (int j = 0; j < 20; j++) {
+    record->add_values(i * j * 37);
+  }
+  record->mutable_child()->set_id(7);
+  record->mutable_child()->set_label("child");
+  for (int j = 0; j < 3; j++) {
+    RecordChild* child = record->add_children();
+    child->set_id(j);
+    child->set_label("grandchild");
+    child->set_delta(-j * 1000);
+  }
+  record->set_payload(string(64 + i, 'p'));
+}
+
+struct State {
+  const char* filename;
+  int64 message_count;            // How many messages to write.
+  vector<const MessageLite*> records;
+  int64 bytes;                    // Set by the last operation.
+};
+
+int OpenForWriting(const char* filename) {
+  int fd;
+  do {
+    fd = open(filename, O_WRONLY | O_CREAT | O_TRUNC | O_BINARY, 0666);
+  } while (fd < 0 && errno == EINTR);
+  if (fd < 0) {
+    fprintf(stderr, "%s: %s\n", filename, strerror(errno));
+    exit(1);
+  }
+  return fd;
+}
+
+int OpenForReading(const char* filename) {
+  int fd;
+  do {
+    fd = open(filename, O_RDONLY | O_BINARY);
+  } while (fd < 0 && errno == EINTR);
+  if (fd < 0) {
+    fprintf(stderr, "%s: %s\n", filename, strerror(errno));
+    exit(1);
+  }
+  return fd;
+}
+
+void CloseOrDie(io::FileOutputStream* output) {
+  if (!output->Close()) {
+    fprintf(stderr, "close: %s\n", strerror(output->GetErrno()));
+    exit(1);
+  }
+}
+
+void WriteByHand(State* state) {
+  io::FileOutputStream output(OpenForWriting(state->filename));
+  for (int64 i = 0; i < state->message_count; i++) {
+    const MessageLite& record = *state->records[i % kRecordCount];
+    io::CodedOutputStream coded_output(&output);
+    coded_output.WriteVarint32(record.ByteSize());
+    record.SerializeWithCachedSizes(&coded_output);
+  }
+  state->bytes = output.ByteCount();
+  CloseOrDie(&output);
+}
+
+void WriteDelimited(State* state) {
+  io::FileOutputStream output(OpenForWriting(state->filename));
+  {
+    io::DelimitedMessageWriter writer(&output);
+    for (int64 i = 0; i < state->message_count; i++) {
+      writer.Write(*state->records[i % kRecordCount]);
+    }
+    GOOGLE_CHECK(writer.Flush());
+  }
+  state->bytes = output.ByteCount();
+  CloseOrDie(&output);
+}
+
+void WriteDelimitedBatches(State* state) {
+  io::FileOutputStream output(OpenForWriting(state->filename));
+  {
+    io::DelimitedMessageWriter writer(&output);
+    for (int64 i = 0; i < state->message_count; i += kRecordCount) {
+      writer.WriteBatch(&state->records[0],
+                        std::min<int64>(kRecordCount,
+                                        state->message_count - i));
+    }
+    GOOGLE_CHECK(writer.Flush());
+  }
+  state->bytes = output.ByteCount();
+  CloseOrDie(&output);
+}
+
+void ReadByHand(State* state) {
+  io::FileInputStream input(OpenForReading(state->filename));
+  Record record;
+  while (true) {
+    io::CodedInputStream coded_input(&input);
+    uint32 size;
+    if (!coded_input.ReadVarint32(&size)) break;
+    io::CodedInputStream::Limit limit = coded_input.PushLimit(size);
+    sink += record.ParseFromCodedStream(&coded_input);
+    coded_input.PopLimit(limit);
+  }
+  state->bytes = input.ByteCount();
+  input.Close();
+}
+
+void ReadDelimited(State* state) {
+  io::FileInputStream input(OpenForReading(state->filename));
+  {
+    io::DelimitedMessageReader reader(&input);
+    Record record;
+    while (reader.ParseNext(&record)) {
+      sink += record.count();
+    }
+    GOOGLE_CHECK(reader.AtEnd());
+    state->bytes = reader.ByteCount();
+  }
+  input.Close();
+}
+
+void SkipDelimited(State* state) {
+  io::FileInputStream input(OpenForReading(state->filename));
+  {
+    io::DelimitedMessageReader reader(&input);
+    while (reader.SkipNext()) {}
+    GOOGLE_CHECK(reader.AtEnd());
+    state->bytes = reader.ByteCount();
+  }
+  input.Close();
+}
+
+void ReadDelimitedMapped(State* state) {
+  io::MmapInputStream input(OpenForReading(state->filename));
+  {
+    io::DelimitedMessageReader reader(&input);
+    Record record;
+    while (reader.ParseNext(&record)) {
+      sink += record.count();
+    }
+    GOOGLE_CHECK(reader.AtEnd());
+    state->bytes = reader.ByteCount();
+  }
+  input.Close();
+}
+
+void SkipDelimitedMapped(State* state) {
+  io::MmapInputStream input(OpenForReading(state->filename));
+  {
+    io::DelimitedMessageReader reader(&input);
+    while (reader.SkipNext()) {}
+    GOOGLE_CHECK(reader.AtEnd());
+    state->bytes = reader.ByteCount();
+  }
+  input.Close();
+}
+
+void Run(const char* name, const char* variant, void (*function)(State*),
+         State* state) {
+  double seconds = MeasureMedianOfPasses(function, state, kPasses);
+  printf("%-8s %-26s %12.1f %10.1f\n", name, variant,
+         seconds * 1e9 / state->message_count,
+         state->bytes / seconds / (1 << 20));
+}
+
+}  // namespace
+}  // namespace protobuf_benchmarks
+
+int main(int argc, char* argv[]) {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+  using namespace protobuf_benchmarks;
+
+  int megabytes = (argc > 1) ? atoi(argv[1]) : 2048;
+  State state;
+  state.filename = (argc > 2) ? argv[2] : "/tmp/delimited_stream_benchmark";
+
+  vector<Record*> records;
+  int64 record_bytes = 0;
+  for (int i = 0; i < kRecordCount; i++) {
+    records.push_back(new Record);
+    FillRecord(i, records.back());
+    state.records.push_back(records.back());
+    record_bytes += records.back()->ByteSize() + 2;
+  }
+  state.message_count =
+      static_cast<int64>(megabytes) * (1 << 20) * kRecordCount / record_bytes;
+
+  printf("%lld messages of about %lld bytes.\n",
+         static_cast<long long>(state.message_count),
+         static_cast<long long>(record_bytes / kRecordCount));
+  printf("%-8s %-26s %12s %10s\n", "", "", "ns/message", "MB/s");
+  Run("write", "by hand", &WriteByHand, &state);
+  Run("write", "DelimitedMessageWriter", &WriteDelimited, &state);
+  Run("write", "  in batches", &WriteDelimitedBatches, &state);
+  Run("read", "by hand", &ReadByHand, &state);
+  Run("read", "DelimitedMessageReader", &ReadDelimited, &state);
+  Run("read", "  from MmapInputStream", &ReadDelimitedMapped, &state);
+  Run("skip", "DelimitedMessageReader", &SkipDelimited, &state);
+  Run("skip", "  from MmapInputStream", &SkipDelimitedMapped, &state);
+
+  unlink(state.filename);
+  for (int i = 0; i < records.size(); i++) {
+    delete records[i];
+  }
+  if (sink == 0) printf("\n");
+  return 0;
+}
@@ -0,0 +1,211 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// http://code.google.com/p/protobuf/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Compares a DynamicMessage with the generated class for the same type, and
+// with the Reflection-based code DynamicMessage used to rely on for
+// parsing, serialization, ByteSize() and Clear().  Each time is the median
+// of several runs (see benchmark_util.h).
+//
+// Usage:  dynamic_message_benchmark
+
+#include <stdio.h>
+#include <string>
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/descriptor.pb.h>
+#include <google/protobuf/dynamic_message.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+#include "benchmark_messages.pb.h"
+#include "benchmark_util.h"
+
+namespace protobuf_benchmarks {
+namespace {
+
+using std::string;
+using google::protobuf::Message;
+using google::protobuf::internal::ReflectionOps;
+using google::protobuf::internal::WireFormat;
+namespace io = google::protobuf::io;
+
+// Keeps results from being optimized away.
+int sink = 0;
+
+void FillRecord(Record* record) {
+  record->set_id(GOOGLE_LONGLONG(1234567890123));
+  record->set_name("a record with a reasonably long name");
+  record->set_count(42);
+  record->set_score(0.75);
+  record->set_active(true);
+  record->set_kind(Record::KIND_B);
+  record->set_timestamp(GOOGLE_ULONGLONG(1300000000000000));
+  for (int i = 0; i < 5; i++) {
+    record->add_tags("tag");
+  }
+  for (int i = 0; i < 20; i++) {
+    record->add_values(i * 37);
+  }
+  record->mutable_child()->set_id(7);
+  record->mutable_child()->set_label("child");
+  for (int i = 0; i < 3; i++) {
+    RecordChild* child = record->add_children();
+    child->set_id(i);
+    child->set_label("grandchild");
+    child->set_delta(-i * 1000);
+  }
+  record->set_payload(string(64, 'p'));
+}
+
+// How the operations below reach the message.
+enum Mode {
+  // The message's own virtual methods:  generated code for the generated
+  // class, the DynamicMessage's programs for the dynamic one.
+  DIRECT,
+  // The Reflection-based implementations in WireFormat and ReflectionOps.
+  REFLECTION
+};
+
+struct State {
+  Message* message;
+  Mode mode;
+  string serialized;
+};
+
+void Parse(State* state) {
+  if (state->mode == DIRECT) {
+    sink += state->message->ParseFromString(state->serialized);
+  } else {
+    state->message->Clear();
+    io::ArrayInputStream raw_input(state->serialized.data(),
+                                   state->serialized.size());
+    io::CodedInputStream input(&raw_input);
+    sink += WireFormat::ParseAndMergePartial(&input, state->message);
+  }
+}
+
+void Serialize(State* state) {
+  string output;
+  if (state->mode == DIRECT) {
+    state->message->SerializeToString(&output);
+  } else {
+    // WireFormat::ByteSize() caches the sizes of sub-messages, which is all
+    // SerializeWithCachedSizes() needs.
+    int size = WireFormat::ByteSize(*state->message);
+    io::StringOutputStream raw_output(&output);
+    io::CodedOutputStream coded_output(&raw_output);
+    WireFormat::SerializeWithCachedSizes(*state->message, size, &coded_output);
+  }
+  sink += output.size();
+}
+
+void ByteSize(State* state) {
+  if (state->mode == DIRECT) {
+    sink += state->message->ByteSize();
+  } else {
+    sink += WireFormat::ByteSize(*state->message);
+  }
+}
+
+void ParseAndClear(State* state) {
+  state->message->ParseFromString(state->serialized);
+  if (state->mode == DIRECT) {
+    state->message->Clear();
+  } else {
+    ReflectionOps::Clear(state->message);
+  }
+}
+
+void Run(const char* name, const char* variant, void (*function)(State*),
+         const Message& prototype, Mode mode) {
+  Record record;
+  FillRecord(&record);
+
+  State state;
+  state.message = prototype.New();
+  state.mode = mode;
+  record.SerializeToString(&state.serialized);
+  state.message->ParseFromString(state.serialized);
+
+  double ns = MeasureMedian(function, &state) * 1e9;
+  printf("%-18s %-22s %12.1f %10.1f\n", name, variant, ns,
+         state.serialized.size() * 1e3 / ns);
+  delete state.message;
+}
+
+}  // namespace
+}  // namespace protobuf_benchmarks
+
+int main(int argc, char* argv[]) {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+  using namespace protobuf_benchmarks;
+  using google::protobuf::DescriptorPool;
+  using google::protobuf::DynamicMessageFactory;
+  using google::protobuf::FileDescriptorProto;
+
+  // Build the types again in a pool of their own, so that the factory
+  // cannot hand out the generated classes.
+  FileDescriptorProto file;
+  Record::descriptor()->file()->CopyTo(&file);
+  DescriptorPool pool;
+  GOOGLE_CHECK(pool.BuildFile(file) != NULL);
+  DynamicMessageFactory factory(&pool);
+  const Message& dynamic = *factory.GetPrototype(
+      pool.FindMessageTypeByName(Record::descriptor()->full_name()));
+
+  struct {
+    const char* name;
+    void (*function)(State*);
+  } operations[] = {
+    { "parse"          , &Parse         },
+    { "serialize"      , &Serialize     },
+    { "byte size"      , &ByteSize      },
+    { "parse and clear", &ParseAndClear },
+  };
+
+  Record record;
+  FillRecord(&record);
+  printf("%d bytes per message.\n", record.ByteSize());
+  printf("%-18s %-22s %12s %10s\n", "operation", "message", "ns/message",
+         "MB/s");
+  for (int i = 0; i < GOOGLE_ARRAYSIZE(operations); i++) {
+    Run(operations[i].name, "generated", operations[i].function,
+        Record::default_instance(), DIRECT);
+    Run(operations[i].name, "dynamic", operations[i].function,
+        dynamic, DIRECT);
+    Run(operations[i].name, "dynamic (reflection)", operations[i].function,
+        dynamic, REFLECTION);
+  }
+
+  if (sink == 0) printf("\n");
+  return 0;
+}
@@ -0,0 +1,203 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// http://code.google.com/p/protobuf/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Measures the cost of extension accessors, parsing and serialization on a
+// message carrying many extensions, like an options message with many custom
+// options.  Reports the median time per operation on the whole message of
+// several runs (see benchmark_util.h).
+//
+// Usage:  extension_set_benchmark
+
+#include <stdio.h>
+#include <string>
+
+#include <google/protobuf/stubs/common.h>
+#include "benchmark_messages.pb.h"
+#include "benchmark_util.h"
+
+namespace protobuf_benchmarks {
+namespace {
+
+using std::string;
+
+const int kExtensionCount = 16;
+
+// Keeps results from being optimized away.
+int sink = 0;
+
+void SetAscending(ExtensionHeavyMessage* message) {
+  message->SetExtension(ext_int32_a, 1);
+  message->SetExtension(ext_int32_b, 2);
+  message->SetExtension(ext_int64, GOOGLE_LONGLONG(3000000000));
+  message->SetExtension(ext_uint32, 4);
+  message->SetExtension(ext_bool_a, true);
+  message->SetExtension(ext_bool_b, false);
+  message->SetExtension(ext_double, 7.5);
+  message->SetExtension(ext_float, 8.5);
+  message->SetExtension(ext_string_a, "string a");
+  message->SetExtension(ext_string_b, "string b");
+  message->SetExtension(ext_bytes, "bytes");
+  message->SetExtension(ext_enum, EXTENSION_BAR);
+  message->MutableExtension(ext_message)->set_id(13);
+  message->AddExtension(ext_repeated_int32, 14);
+  message->AddExtension(ext_repeated_string, "fifteen");
+  message->SetExtension(ext_sint64, -16);
+}
+
+void SetDescending(ExtensionHeavyMessage* message) {
+  message->SetExtension(ext_sint64, -16);
+  message->AddExtension(ext_repeated_string, "fifteen");
+  message->AddExtension(ext_repeated_int32, 14);
+  message->MutableExtension(ext_message)->set_id(13);
+  message->SetExtension(ext_enum, EXTENSION_BAR);
+  message->SetExtension(ext_bytes, "bytes");
+  message->SetExtension(ext_string_b, "string b");
+  message->SetExtension(ext_string_a, "string a");
+  message->SetExtension(ext_float, 8.5);
+  message->SetExtension(ext_double, 7.5);
+  message->SetExtension(ext_bool_b, false);
+  message->SetExtension(ext_bool_a, true);
+  message->SetExtension(ext_uint32, 4);
+  message->SetExtension(ext_int64, GOOGLE_LONGLONG(3000000000));
+  message->SetExtension(ext_int32_b, 2);
+  message->SetExtension(ext_int32_a, 1);
+}
+
+// Each benchmark performs one operation on the whole message.
+struct State {
+  ExtensionHeavyMessage message;
+  string serialized;
+};
+
+void SetNewAscending(State* state) {
+  ExtensionHeavyMessage message;
+  SetAscending(&message);
+}
+
+void SetNewDescending(State* state) {
+  ExtensionHeavyMessage message;
+  SetDescending(&message);
+}
+
+void SetExisting(State* state) {
+  state->message.Clear();
+  SetAscending(&state->message);
+}
+
+void Get(State* state) {
+  const ExtensionHeavyMessage& message = state->message;
+  sink += message.GetExtension(ext_int32_a);
+  sink += message.GetExtension(ext_int32_b);
+  sink += message.GetExtension(ext_int64);
+  sink += message.GetExtension(ext_uint32);
+  sink += message.GetExtension(ext_bool_a);
+  sink += message.GetExtension(ext_bool_b);
+  sink += message.GetExtension(ext_double);
+  sink += message.GetExtension(ext_float);
+  sink += message.GetExtension(ext_string_a).size();
+  sink += message.GetExtension(ext_string_b).size();
+  sink += message.GetExtension(ext_bytes).size();
+  sink += message.GetExtension(ext_enum);
+  sink += message.GetExtension(ext_message).id();
+  sink += message.GetExtension(ext_repeated_int32, 0);
+  sink += message.GetExtension(ext_repeated_string, 0).size();
+  sink += message.GetExtension(ext_sint64);
+}
+
+void Has(State* state) {
+  const ExtensionHeavyMessage& message = state->message;
+  sink += message.HasExtension(ext_int32_a);
+  sink += message.HasExtension(ext_int32_b);
+  sink += message.HasExtension(ext_int64);
+  sink += message.HasExtension(ext_uint32);
+  sink += message.HasExtension(ext_bool_a);
+  sink += message.HasExtension(ext_bool_b);
+  sink += message.HasExtension(ext_double);
+  sink += message.HasExtension(ext_float);
+  sink += message.HasExtension(ext_string_a);
+  sink += message.HasExtension(ext_string_b);
+  sink += message.HasExtension(ext_bytes);
+  sink += message.HasExtension(ext_enum);
+  sink += message.HasExtension(ext_message);
+  sink += message.ExtensionSize(ext_repeated_int32);
+  sink += message.ExtensionSize(ext_repeated_string);
+  sink += message.HasExtension(ext_sint64);
+}
+
+void ParseNew(State* state) {
+  ExtensionHeavyMessage message;
+  sink += message.ParseFromString(state->serialized);
+}
+
+void ParseExisting(State* state) {
+  sink += state->message.ParseFromString(state->serialized);
+}
+
+void ByteSize(State* state) {
+  sink += state->message.ByteSize();
+}
+
+void Serialize(State* state) {
+  string output;
+  state->message.SerializeToString(&output);
+  sink += output.size();
+}
+
+void Run(const char* name, void (*function)(State*)) {
+  State state;
+  SetAscending(&state.message);
+  state.message.SerializeToString(&state.serialized);
+
+  double ns = MeasureMedian(function, &state) * 1e9;
+  printf("%-24s %12.1f %14.2f\n", name, ns, ns / kExtensionCount);
+}
+
+}  // namespace
+}  // namespace protobuf_benchmarks
+
+int main(int argc, char* argv[]) {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+  using namespace protobuf_benchmarks;
+
+  printf("%d extensions per message.\n", kExtensionCount);
+  printf("%-24s %12s %14s\n", "operation", "ns/message", "ns/extension");
+  Run("set (new message)", &SetNewAscending);
+  Run("set reversed (new)", &SetNewDescending);
+  Run("set (cleared message)", &SetExisting);
+  Run("get", &Get);
+  Run("has", &Has);
+  Run("parse (new message)", &ParseNew);
+  Run("parse (reused message)", &ParseExisting);
+  Run("byte size", &ByteSize);
+  Run("serialize", &Serialize);
+
+  if (sink == 0) printf("\n");
+  return 0;
+}
@@ -0,0 +1,181 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// http://code.google.com/p/protobuf/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// Writes responses assembled from pre-serialized chunks to a file, once
+// through FileOutputStream, which copies every chunk into its buffer, and
+// once through GatherOutputStream, which aliases the chunks and hands them
+// to writev().
+//
+// Usage:  gather_output_benchmark [chunks_per_response [file]]
+//
+// Each response is flushed as soon as it is complete, as a server would.
+// The file defaults to /tmp/gather_output_benchmark, and is removed
+// between runs.  Each variant runs kPasses times and the median is reported.
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <string>
+#include <vector>
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl.h>
+#include "benchmark_messages.pb.h"
+#include "benchmark_util.h"
+
+#ifndef O_BINARY
+#define O_BINARY 0
+#endif
+
+namespace protobuf_benchmarks {
+namespace {
+
+using std::string;
+using std::vector;
+using google::protobuf::int64;
+namespace io = google::protobuf::io;
+
+// How many different chunks there are to choose from.
+const int kChunkCount = 64;
+// How many bytes are written per run.
+const int64 kBytesPerRun = GOOGLE_LONGLONG(1) << 30;
+// How many runs each variant makes.  Fewer than the usual kRuns, since each
+// run takes seconds.
+const int kPasses = 3;
+
+// Serialized Records, as a server might keep cached.  Every eighth one
+// carries a large payload.
+void MakeChunks(vector<string>* chunks) {
+  for (int i = 0; i < kChunkCount; i++) {
+    Record record;
+    record.set_id(i);
+    record.set_name("a cached record");
+    record.set_count(i);
+    for (int j = 0; j < 20; j++) {
+      record.add_values(i * j * 37);
+    }
+    record.set_payload(string(i % 8 == 0 ? 16384 : 64 + i, 'p'));
+    chunks->push_back(record.SerializeAsString());
+  }
+}
+
+struct State {
+  const char* filename;
+  int chunks_per_response;
+  vector<string> chunks;
+  int64 response_count;           // Set by the last operation.
+};
+
+int OpenForWriting(const char* filename) {
+  int fd;
+  do {
+    fd = open(filename, O_WRONLY | O_CREAT | O_TRUNC | O_BINARY, 0666);
+  } while (fd < 0 && errno == EINTR);
+  if (fd < 0) {
+    fprintf(stderr, "%s: %s\n", filename, strerror(errno));
+    exit(1);
+  }
+  return fd;
+}
+
+void WriteCopied(State* state) {
+  io::FileOutputStream output(OpenForWriting(state->filename));
+  int next = 0;
+  state->response_count = 0;
+  while (output.ByteCount() < kBytesPerRun) {
+    {
+      io::CodedOutputStream coded_output(&output);
+      for (int i = 0; i < state->chunks_per_response; i++) {
+        const string& chunk = state->chunks[next++ % kChunkCount];
+        coded_output.WriteVarint32(chunk.size());
+        coded_output.WriteString(chunk);
+      }
+    }
+    GOOGLE_CHECK(output.Flush());
+    ++state->response_count;
+  }
+  GOOGLE_CHECK(output.Close());
+}
+
+void WriteGathered(State* state) {
+  io::GatherOutputStream output(OpenForWriting(state->filename));
+  int next = 0;
+  state->response_count = 0;
+  while (output.ByteCount() < kBytesPerRun) {
+    for (int i = 0; i < state->chunks_per_response; i++) {
+      const string& chunk = state->chunks[next++ % kChunkCount];
+      {
+        io::CodedOutputStream coded_output(&output);
+        coded_output.WriteVarint32(chunk.size());
+      }
+      output.AppendAliased(chunk);
+    }
+    GOOGLE_CHECK(output.Flush());
+    ++state->response_count;
+  }
+  GOOGLE_CHECK(output.Close());
+}
+
+void Run(const char* variant, void (*function)(State*), State* state) {
+  vector<double> times;
+  for (int pass = 0; pass < kPasses; pass++) {
+    // Get rid of the previous run's file now, rather than timing it.
+    unlink(state->filename);
+    times.push_back(TimeIterations(function, state, 1));
+  }
+  double seconds = Median(times);
+  printf("%-20s %12.1f %10.1f\n", variant,
+         seconds * 1e9 / state->response_count,
+         kBytesPerRun / seconds / (1 << 20));
+}
+
+}  // namespace
+}  // namespace protobuf_benchmarks
+
+int main(int argc, char* argv[]) {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+  using namespace protobuf_benchmarks;
+
+  State state;
+  state.chunks_per_response = (argc > 1) ? atoi(argv[1]) : 32;
+  state.filename = (argc > 2) ? argv[2] : "/tmp/gather_output_benchmark";
+  MakeChunks(&state.chunks);
+
+  printf("%d chunks per response.\n", state.chunks_per_response);
+  printf("%-20s %12s %10s\n", "", "ns/response", "MB/s");
+  Run("FileOutputStream", &WriteCopied, &state);
+  Run("GatherOutputStream", &WriteGathered, &state);
+
+  unlink(state.filename);
+  return 0;
+}
@@ -0,0 +1,201 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// http://code.google.com/p/protobuf/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Measures how GeneratedMessageFactory::GetPrototype() scales with the
+// number of threads calling it concurrently.  The same lookups are also run
+// against a Mutex-guarded hash_map, which is how the factory used to be
+// implemented, so that the two can be compared on the same machine.
+//
+// Each thread count runs kRuns times and the median is reported.
+//
+// Usage:  generated_message_factory_benchmark [max_threads]
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <vector>
+
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/descriptor.pb.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/stubs/hash.h>
+#include "benchmark_util.h"
+
+namespace google {
+namespace protobuf {
+namespace {
+
+using protobuf_benchmarks::MeasureMedianOfPasses;
+
+const int kLookupsPerThread = 2000000;
+
+// The old implementation of the factory:  every lookup takes a lock.
+class LockedRegistry {
+ public:
+  void Insert(const Descriptor* type, const Message* prototype) {
+    MutexLock lock(&mutex_);
+    map_[type] = prototype;
+  }
+
+  const Message* Find(const Descriptor* type) {
+    MutexLock lock(&mutex_);
+    hash_map<const Descriptor*, const Message*>::const_iterator iter =
+      map_.find(type);
+    return iter == map_.end() ? NULL : iter->second;
+  }
+
+ private:
+  Mutex mutex_;
+  hash_map<const Descriptor*, const Message*> map_;
+};
+
+LockedRegistry* locked_registry = NULL;
+std::vector<const Descriptor*>* all_types = NULL;
+
+void CollectTypes(const Descriptor* type,
+                  std::vector<const Descriptor*>* output) {
+  output->push_back(type);
+  for (int i = 0; i < type->nested_type_count(); i++) {
+    CollectTypes(type->nested_type(i), output);
+  }
+}
+
+struct ThreadArgs {
+  bool use_locked_registry;
+  int seed;
+  const Message* result;  // Keeps the lookups from being optimized away.
+};
+
+void* LookupThread(void* arg) {
+  ThreadArgs* args = reinterpret_cast<ThreadArgs*>(arg);
+  MessageFactory* factory = MessageFactory::generated_factory();
+  const std::vector<const Descriptor*>& types = *all_types;
+  int index = args->seed % types.size();
+  const Message* result = NULL;
+
+  for (int i = 0; i < kLookupsPerThread; i++) {
+    const Message* found = args->use_locked_registry ?
+      locked_registry->Find(types[index]) :
+      factory->GetPrototype(types[index]);
+    if (found != NULL) result = found;
+    if (++index == types.size()) index = 0;
+  }
+
+  args->result = result;
+  return NULL;
+}
+
+struct RunArgs {
+  int thread_count;
+  bool use_locked_registry;
+};
+
+void RunThreads(RunArgs* run) {
+  int thread_count = run->thread_count;
+  std::vector<pthread_t> threads(thread_count);
+  std::vector<ThreadArgs> args(thread_count);
+
+  for (int i = 0; i < thread_count; i++) {
+    args[i].use_locked_registry = run->use_locked_registry;
+    args[i].seed = i * 7;
+    args[i].result = NULL;
+    pthread_create(&threads[i], NULL, &LookupThread, &args[i]);
+  }
+  for (int i = 0; i < thread_count; i++) {
+    pthread_join(threads[i], NULL);
+  }
+}
+
+// Returns the median wall time of kRuns runs, in seconds.
+double MeasureThreads(int thread_count, bool use_locked_registry) {
+  RunArgs run = { thread_count, use_locked_registry };
+  return MeasureMedianOfPasses(&RunThreads, &run);
+}
+
+void Report(const char* name, int thread_count, double seconds) {
+  double lookups = static_cast<double>(kLookupsPerThread) * thread_count;
+  printf("%-14s %7d %12.2f %14.2f\n", name, thread_count,
+         seconds * 1e9 / kLookupsPerThread, lookups / seconds / 1e6);
+}
+
+int Run(int max_threads) {
+  std::vector<const Descriptor*> types;
+  const FileDescriptor* file = FileDescriptorProto::descriptor()->file();
+  for (int i = 0; i < file->message_type_count(); i++) {
+    CollectTypes(file->message_type(i), &types);
+  }
+  all_types = &types;
+
+  LockedRegistry registry;
+  locked_registry = &registry;
+  for (int i = 0; i < types.size(); i++) {
+    registry.Insert(types[i],
+                    MessageFactory::generated_factory()->GetPrototype(types[i]));
+  }
+
+  printf("%d message types, %d lookups per thread.\n",
+         static_cast<int>(types.size()), kLookupsPerThread);
+  printf("%-14s %7s %12s %14s\n",
+         "registry", "threads", "ns/lookup", "M lookups/s");
+
+  for (int threads = 1; ; threads *= 2) {
+    if (threads > max_threads) threads = max_threads;
+    Report("locked", threads, MeasureThreads(threads, true));
+    Report("factory", threads, MeasureThreads(threads, false));
+    if (threads == max_threads) break;
+  }
+
+  locked_registry = NULL;
+  all_types = NULL;
+  return 0;
+}
+
+}  // namespace
+}  // namespace protobuf
+}  // namespace google
+
+int main(int argc, char* argv[]) {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  int max_threads = 0;
+  if (argc > 1) {
+    max_threads = atoi(argv[1]);
+  } else {
+    max_threads = static_cast<int>(sysconf(_SC_NPROCESSORS_ONLN));
+  }
+  if (max_threads < 1) {
+    fprintf(stderr, "usage: %s [max_threads]\n", argv[0]);
+    return 1;
+  }
+
+  return google::protobuf::Run(max_threads);
+}
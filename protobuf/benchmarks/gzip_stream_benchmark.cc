@@ -0,0 +1,209 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// http://code.google.com/p/protobuf/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// Compresses serialized Records with GzipOutputStream, on one thread and in
+// parallel blocks on several, and compares compressing many small streams
+// with a fresh GzipOutputStream each against reusing one with Reset().
+//
+// Usage:  gzip_stream_benchmark [megabytes [max_threads]]
+//
+// Defaults to 256MB and 8 threads.  The compressed data is discarded.  Each
+// variant runs kRuns times and the median is reported.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/io/gzip_stream.h>
+#include <google/protobuf/io/zero_copy_stream.h>
+#include "benchmark_messages.pb.h"
+#include "benchmark_util.h"
+
+namespace protobuf_benchmarks {
+namespace {
+
+using std::min;
+using std::string;
+using google::protobuf::int64;
+namespace io = google::protobuf::io;
+
+// How many different records make up the input.
+const int kRecordCount = 1024;
+// The size of each of the small streams.
+const int kSmallStreamSize = 4096;
+
+// Throws away everything written to it.
+class NullOutputStream : public io::ZeroCopyOutputStream {
+ public:
+  NullOutputStream() : byte_count_(0) {}
+
+  bool Next(void** data, int* size) {
+    *data = buffer_;
+    *size = sizeof(buffer_);
+    byte_count_ += sizeof(buffer_);
+    return true;
+  }
+  void BackUp(int count) { byte_count_ -= count; }
+  int64 ByteCount() const { return byte_count_; }
+
+ private:
+  char buffer_[65536];
+  int64 byte_count_;
+};
+
+// Serialized records which vary enough to compress realistically.
+string MakeInput() {
+  string input;
+  for (int i = 0; i < kRecordCount; i++) {
+    Record record;
+    record.set_id(GOOGLE_LONGLONG(1234567890123) + i * 7919);
+    record.set_name("record number " + string(1 + i % 13, 'a' + i % 26));
+    record.set_count(i);
+    record.set_score(i / 7.0);
+    record.set_timestamp(GOOGLE_ULONGLONG(1300000000000000) + i * 1013);
+    for (int j = 0; j < 20; j++) {
+      record.add_values(i * j * 37 % 10007);
+    }
+    record.AppendToString(&input);
+  }
+  return input;
+}
+
+// Writes size bytes of input, over and over, to output.
+void Write(io::ZeroCopyOutputStream* output, const string& input, int64 size) {
+  int64 position = 0;
+  void* data;
+  int data_size = 0;
+  while (size > 0) {
+    if (data_size == 0) GOOGLE_CHECK(output->Next(&data, &data_size));
+    int n = min<int64>(min<int64>(data_size, input.size() - position), size);
+    memcpy(data, input.data() + position, n);
+    data = static_cast<char*>(data) + n;
+    data_size -= n;
+    size -= n;
+    position = (position + n) % input.size();
+  }
+  output->BackUp(data_size);
+}
+
+void Report(const char* variant, double seconds, int64 bytes, int64 out) {
+  printf("%-28s %10.1f %8.1f%%\n", variant, bytes / seconds / (1 << 20),
+         out * 100.0 / bytes);
+}
+
+struct State {
+  const string* input;
+  int64 size;
+  int threads;                    // For CompressLarge().
+  bool reset;                     // For CompressSmall().
+  int64 compressed_size;          // Set by the last pass.
+};
+
+void CompressLarge(State* state) {
+  io::GzipOutputStream::Options options;
+  options.threads = state->threads;
+  if (state->threads > 1) options.buffer_size = 128 << 10;
+
+  NullOutputStream output;
+  {
+    io::GzipOutputStream gzout(&output, options);
+    Write(&gzout, *state->input, state->size);
+    GOOGLE_CHECK(gzout.Close());
+  }
+  state->compressed_size = output.ByteCount();
+}
+
+void CompressSmall(State* state) {
+  int count = state->size / kSmallStreamSize;
+  NullOutputStream output;
+  if (state->reset) {
+    io::GzipOutputStream gzout(&output);
+    for (int i = 0; i < count; i++) {
+      gzout.Reset(&output);
+      Write(&gzout, *state->input, kSmallStreamSize);
+      GOOGLE_CHECK(gzout.Close());
+    }
+  } else {
+    for (int i = 0; i < count; i++) {
+      io::GzipOutputStream gzout(&output);
+      Write(&gzout, *state->input, kSmallStreamSize);
+      GOOGLE_CHECK(gzout.Close());
+    }
+  }
+  state->compressed_size = output.ByteCount();
+}
+
+void RunLarge(const string& input, int64 size, int threads) {
+  State state;
+  state.input = &input;
+  state.size = size;
+  state.threads = threads;
+  double seconds = MeasureMedianOfPasses(&CompressLarge, &state);
+
+  char variant[32];
+  snprintf(variant, sizeof(variant), "%d thread%s", threads,
+           threads == 1 ? "" : "s");
+  Report(variant, seconds, size, state.compressed_size);
+}
+
+void RunSmall(const string& input, int64 size, bool reset) {
+  State state;
+  state.input = &input;
+  state.size = size;
+  state.reset = reset;
+  double seconds = MeasureMedianOfPasses(&CompressSmall, &state);
+  Report(reset ? "reused with Reset()" : "new GzipOutputStream each",
+         seconds, size / kSmallStreamSize * kSmallStreamSize,
+         state.compressed_size);
+}
+
+}  // namespace
+}  // namespace protobuf_benchmarks
+
+int main(int argc, char* argv[]) {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+  using namespace protobuf_benchmarks;
+
+  int64 size = static_cast<int64>((argc > 1) ? atoi(argv[1]) : 256) << 20;
+  int max_threads = (argc > 2) ? atoi(argv[2]) : 8;
+  string input = MakeInput();
+
+  printf("%-28s %10s %9s\n", "", "MB/s", "ratio");
+  for (int threads = 1; threads <= max_threads; threads *= 2) {
+    RunLarge(input, size, threads);
+  }
+
+  printf("\n%d byte streams:\n", kSmallStreamSize);
+  RunSmall(input, size / 4, false);
+  RunSmall(input, size / 4, true);
+  return 0;
+}
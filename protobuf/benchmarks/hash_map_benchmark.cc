@@ -0,0 +1,200 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// http://code.google.com/p/protobuf/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Compares internal::FlatHashMap with the hash_map from stubs/hash.h on the
+// kinds of keys the descriptor tables use:  full names (const char*) and
+// (parent pointer, field number) pairs.  Reports the time per successful
+// and per failed lookup, in random order, and the heap memory and number of
+// allocations per entry.  The memory counted is what the maps request;
+// malloc's own per-block overhead, which only makes node-based maps look
+// worse, is not included.  Lookup times are the median of several runs (see
+// benchmark_util.h).
+//
+// Usage:  hash_map_benchmark
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <new>
+#include <string>
+#include <vector>
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/stubs/flat_hash_map.h>
+#include <google/protobuf/stubs/hash.h>
+#include <google/protobuf/stubs/strutil.h>
+#include "benchmark_util.h"
+
+// Count the bytes allocated by the maps by replacing the global allocator.
+// Each block is prefixed with its size so that operator delete can
+// subtract it again.
+namespace {
+size_t live_bytes = 0;
+int allocations = 0;
+const size_t kHeaderSize = 16;  // Keeps the returned blocks aligned.
+}  // namespace
+
+void* operator new(size_t size) {
+  char* block = static_cast<char*>(malloc(size + kHeaderSize));
+  if (block == NULL) throw std::bad_alloc();
+  *reinterpret_cast<size_t*>(block) = size;
+  live_bytes += size;
+  ++allocations;
+  return block + kHeaderSize;
+}
+
+void operator delete(void* pointer) throw() {
+  if (pointer == NULL) return;
+  char* block = static_cast<char*>(pointer) - kHeaderSize;
+  live_bytes -= *reinterpret_cast<size_t*>(block);
+  free(block);
+}
+
+namespace google {
+namespace protobuf {
+namespace {
+
+using internal::FlatHashMap;
+using protobuf_benchmarks::MeasureMedian;
+
+void Report(const char* map_name, const char* key_name, int entries,
+            double hit_ns, double miss_ns, size_t bytes, int allocs) {
+  printf("%-6s %-6s %8d %10.2f %10.2f %12.1f %12.2f\n",
+         map_name, key_name, entries, hit_ns, miss_ns,
+         static_cast<double>(bytes) / entries,
+         static_cast<double>(allocs) / entries);
+}
+
+// Shuffles keys with a fixed seed, so that lookups do not walk the tables
+// in insertion order and every run looks up the same sequence.
+template <typename Key>
+vector<Key> Shuffled(const vector<Key>& keys) {
+  vector<Key> result(keys);
+  uint32 state = 12345;
+  for (int i = result.size() - 1; i > 0; i--) {
+    state = state * 1103515245 + 12345;
+    swap(result[i], result[(state >> 8) % (i + 1)]);
+  }
+  return result;
+}
+
+template <typename Map, typename Key>
+struct LookupState {
+  const Map* map;
+  const vector<Key>* keys;
+  int found;  // Keeps the lookups from being optimized away.
+};
+
+// Looks up each of the keys once.
+template <typename Map, typename Key>
+void LookUpAll(LookupState<Map, Key>* state) {
+  const Map& map = *state->map;
+  const vector<Key>& keys = *state->keys;
+  for (int i = 0; i < keys.size(); i++) {
+    if (map.find(keys[i]) != map.end()) ++state->found;
+  }
+}
+
+// Returns the median nanoseconds per lookup of each of keys.  found counts
+// the hits.
+template <typename Map, typename Key>
+double TimeLookups(const Map& map, const vector<Key>& keys, int* found) {
+  LookupState<Map, Key> state = { &map, &keys, 0 };
+  double seconds = MeasureMedian(&LookUpAll<Map, Key>, &state);
+  *found += state.found;
+  return seconds * 1e9 / keys.size();
+}
+
+template <typename Map, typename Key>
+void Run(const char* map_name, const char* key_name,
+         const vector<Key>& present, const vector<Key>& absent) {
+  size_t bytes_before = live_bytes;
+  int allocations_before = allocations;
+  Map* map = new Map;
+  for (int i = 0; i < present.size(); i++) {
+    (*map)[present[i]] = i;
+  }
+  size_t bytes = live_bytes - bytes_before;
+  int allocs = allocations - allocations_before;
+
+  int found = 0;
+  double hit_ns = TimeLookups(*map, Shuffled(present), &found);
+  double miss_ns = TimeLookups(*map, Shuffled(absent), &found);
+  if (found == 0) printf("(no entries found)\n");
+
+  Report(map_name, key_name, present.size(), hit_ns, miss_ns, bytes, allocs);
+  delete map;
+}
+
+void RunNameKeys(int entries) {
+  // Names shaped like the full names of fields, all distinct.
+  vector<string> names;
+  for (int i = 0; i < entries * 2; i++) {
+    names.push_back("google.protobuf.TestMessage" + SimpleItoa(i / 16) +
+                    ".optional_field_" + SimpleItoa(i));
+  }
+  vector<const char*> present, absent;
+  for (int i = 0; i < names.size(); i++) {
+    (i % 2 == 0 ? present : absent).push_back(names[i].c_str());
+  }
+
+  Run<hash_map<const char*, int, hash<const char*>, streq> >(
+      "hash", "name", present, absent);
+  Run<FlatHashMap<const char*, int, hash<const char*>, streq> >(
+      "flat", "name", present, absent);
+}
+
+void RunNumberKeys(int entries) {
+  // (parent, number) pairs, with 16 numbers per parent.
+  vector<int> parents(entries / 16 + 1);
+  vector<pair<const int*, int> > present, absent;
+  for (int i = 0; i < entries; i++) {
+    present.push_back(make_pair(&parents[i / 16], i % 16 + 1));
+    absent.push_back(make_pair(&parents[i / 16], i % 16 + 100));
+  }
+
+  Run<hash_map<pair<const int*, int>, int> >(
+      "hash", "number", present, absent);
+  Run<FlatHashMap<pair<const int*, int>, int> >(
+      "flat", "number", present, absent);
+}
+
+}  // namespace
+}  // namespace protobuf
+}  // namespace google
+
+int main(int argc, char* argv[]) {
+  printf("%-6s %-6s %8s %10s %10s %12s %12s\n", "map", "key", "entries",
+         "hit ns", "miss ns", "bytes/entry", "allocs/entry");
+  for (int entries = 100; entries <= 100000; entries *= 10) {
+    google::protobuf::RunNameKeys(entries);
+    google::protobuf::RunNumberKeys(entries);
+  }
+  return 0;
+}
@@ -0,0 +1,64 @@
+#!/bin/sh
+#
+# Writes the .proto files linked into startup_benchmark to the directory
+# given as the first argument:  startup_benchmark_00.proto through
+# startup_benchmark_15.proto, each defining 32 messages which nest the one
+# before them.  startup_benchmark_00.proto also defines Base, which all the
+# other files import and extend.
+
+if test $# -ne 1; then
+  echo "Usage: $0 output_dir" >&2
+  exit 1
+fi
+
+out=$1
+files="00 01 02 03 04 05 06 07 08 09 10 11 12 13 14 15"
+messages="00 01 02 03 04 05 06 07 08 09 10 11 12 13 14 15
+          16 17 18 19 20 21 22 23 24 25 26 27 28 29 30 31"
+
+for f in $files; do
+  {
+    echo "// Written by make_startup_benchmark_protos.sh.  Do not edit."
+    echo
+    echo "package startup_benchmark.f$f;"
+    echo
+    if test $f = 00; then
+      echo "message Base {"
+      echo "  optional int32 id = 1;"
+      echo "  extensions 100 to max;"
+      echo "}"
+    else
+      echo "import \"startup_benchmark_00.proto\";"
+      echo
+      echo "extend startup_benchmark.f00.Base {"
+      echo "  optional Message31 message_$f = 1$f;"
+      echo "  optional int32 count_$f = 2$f;"
+      echo "}"
+    fi
+    echo
+    echo "enum Kind {"
+    echo "  KIND_NONE = 0;"
+    echo "  KIND_SOME = 1;"
+    echo "  KIND_ALL = 2;"
+    echo "}"
+    previous=
+    for m in $messages; do
+      echo
+      echo "message Message$m {"
+      echo "  optional int32 id = 1;"
+      echo "  optional int64 timestamp = 2;"
+      echo "  optional string name = 3 [default = \"unnamed\"];"
+      echo "  optional bool enabled = 4;"
+      echo "  optional Kind kind = 5 [default = KIND_SOME];"
+      echo "  repeated int32 values = 6 [packed = true];"
+      if test -n "$previous"; then
+        echo "  optional Message$previous child = 7;"
+      fi
+      if test $f != 00; then
+        echo "  optional startup_benchmark.f00.Message$m base = 8;"
+      fi
+      echo "}"
+      previous=$m
+    done
+  } > "$out/startup_benchmark_$f.proto"
+done
@@ -0,0 +1,439 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// http://code.google.com/p/protobuf/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Measures the basic operations on messages -- parsing, serialization,
+// ByteSize(), copying, merging, text format and reflection -- on several
+// datasets (see serialization_benchmark.proto), each as several variants of
+// the same message types:
+//
+//   generated     generated classes, parsing with the switch-based code
+//   table-driven  generated classes parsing with a ParseTable
+//   lite          LITE_RUNTIME generated classes
+//   dynamic       DynamicMessages
+//
+// Lite messages have neither text format nor reflection, so those are
+// skipped for them.
+//
+// Every measurement is taken with MeasureMedian() (see benchmark_util.h),
+// and reported in ns per operation and MB/s.
+// Throughput is relative to the size of the binary encoding, or of the
+// text format for the text operations.
+//
+// Usage:  serialization_benchmark [filter]
+//
+// Only the measurements whose "dataset/variant/operation" contains filter
+// are run; e.g. "/parse" compares parsing on every dataset and variant.
+
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/descriptor.pb.h>
+#include <google/protobuf/dynamic_message.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/text_format.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+#include "serialization_benchmark.pb.h"
+#include "serialization_benchmark_lite.pb.h"
+#include "serialization_benchmark_table_driven.pb.h"
+#include "benchmark_util.h"
+
+namespace protobuf_benchmarks {
+namespace {
+
+using std::string;
+using std::vector;
+using google::protobuf::int64;
+using google::protobuf::uint8;
+using google::protobuf::Descriptor;
+using google::protobuf::FieldDescriptor;
+using google::protobuf::Message;
+using google::protobuf::MessageLite;
+using google::protobuf::Reflection;
+using google::protobuf::TextFormat;
+using google::protobuf::io::StringOutputStream;
+
+// The sizes of the datasets.
+const int kHeaderCount = 3;
+const int kDepth = 40;
+const int kArraySize = 10000;
+
+// Keeps results from being optimized away.
+int sink = 0;
+
+// -------------------------------------------------------------------
+// The datasets, built with the generated classes.
+
+void FillSmallRequest(SmallRequest* request) {
+  request->set_request_id(GOOGLE_LONGLONG(8123456789));
+  request->set_method("/ExampleService/GetUserProfile");
+  request->set_priority(3);
+  request->set_idempotent(true);
+  request->set_user("someone@example.com");
+  request->set_deadline(GOOGLE_ULONGLONG(1300000000000000));
+  for (int i = 0; i < kHeaderCount; i++) {
+    Header* header = request->add_headers();
+    header->set_key("x-header-" + string(1, 'a' + i));
+    header->set_value("value");
+  }
+}
+
+// Sets every field, through reflection since there are so many.
+void FillWideMessage(WideMessage* message) {
+  const Descriptor* descriptor = message->GetDescriptor();
+  const Reflection* reflection = message->GetReflection();
+  for (int i = 0; i < descriptor->field_count(); i++) {
+    const FieldDescriptor* field = descriptor->field(i);
+    int value = (i + 1) * 1237;
+    switch (field->cpp_type()) {
+      case FieldDescriptor::CPPTYPE_INT32:
+        reflection->SetInt32(message, field, -value);
+        break;
+      case FieldDescriptor::CPPTYPE_INT64:
+        reflection->SetInt64(message, field, -value * GOOGLE_LONGLONG(1000));
+        break;
+      case FieldDescriptor::CPPTYPE_UINT32:
+        reflection->SetUInt32(message, field, value);
+        break;
+      case FieldDescriptor::CPPTYPE_UINT64:
+        reflection->SetUInt64(message, field, value * GOOGLE_ULONGLONG(1000));
+        break;
+      case FieldDescriptor::CPPTYPE_DOUBLE:
+        reflection->SetDouble(message, field, value / 7.0);
+        break;
+      case FieldDescriptor::CPPTYPE_FLOAT:
+        reflection->SetFloat(message, field, value / 7.0f);
+        break;
+      case FieldDescriptor::CPPTYPE_BOOL:
+        reflection->SetBool(message, field, true);
+        break;
+      case FieldDescriptor::CPPTYPE_STRING:
+        reflection->SetString(message, field, "value of " + field->name());
+        break;
+      default:
+        GOOGLE_LOG(FATAL) << "Unexpected field type.";
+    }
+  }
+}
+
+void FillDeepMessage(DeepMessage* message) {
+  for (int depth = 0; depth < kDepth; depth++) {
+    message->set_depth(depth);
+    message->set_label("level");
+    if (depth + 1 < kDepth) message = message->mutable_child();
+  }
+}
+
+void FillPackedArrays(PackedArrays* arrays) {
+  for (int i = 0; i < kArraySize; i++) {
+    arrays->add_int32s(i * 37);
+    arrays->add_sint64s((i - kArraySize / 2) * GOOGLE_LONGLONG(1000));
+    arrays->add_fixed32s(i * 2654435761u);
+    arrays->add_doubles(i / 3.0);
+    arrays->add_bools(i % 3 == 0);
+  }
+}
+
+// -------------------------------------------------------------------
+// The operations.
+
+struct State {
+  MessageLite* message;  // Holds the dataset.
+  MessageLite* scratch;  // The target of parsing and copying.
+  // The same as message and scratch, or NULL for lite messages.
+  Message* full_message;
+  Message* full_scratch;
+
+  string serialized;
+  string text;
+  string output;
+};
+
+void Parse(State* state) {
+  sink += state->scratch->ParseFromArray(state->serialized.data(),
+                                         state->serialized.size());
+}
+
+// Sizes are cached before the measurements start.
+void Serialize(State* state) {
+  uint8* start = reinterpret_cast<uint8*>(&state->output[0]);
+  sink += state->message->SerializeWithCachedSizesToArray(start) - start;
+}
+
+void ByteSize(State* state) {
+  sink += state->message->ByteSize();
+}
+
+// Into a message which is reused, so has its memory allocated already.
+void Copy(State* state) {
+  state->scratch->Clear();
+  state->scratch->CheckTypeAndMergeFrom(*state->message);
+}
+
+// Into a new message, so everything is allocated.
+void MergeIntoNew(State* state) {
+  MessageLite* message = state->message->New();
+  message->CheckTypeAndMergeFrom(*state->message);
+  delete message;
+}
+
+// PrintToString() writes straight into the string, while Print() goes
+// through a ZeroCopyOutputStream.
+void PrintText(State* state) {
+  TextFormat::PrintToString(*state->full_message, &state->output);
+  sink += state->output.size();
+}
+
+void PrintTextToStream(State* state) {
+  state->output.clear();
+  StringOutputStream stream(&state->output);
+  sink += TextFormat::Print(*state->full_message, &stream);
+}
+
+void ShortDebugString(State* state) {
+  sink += state->full_message->ShortDebugString().size();
+}
+
+void ParseText(State* state) {
+  sink += TextFormat::ParseFromString(state->text, state->full_scratch);
+}
+
+// Reads every field which is set.
+int Walk(const Message& message) {
+  const Reflection* reflection = message.GetReflection();
+  vector<const FieldDescriptor*> fields;
+  reflection->ListFields(message, &fields);
+
+  int total = 0;
+  string scratch;
+  for (int i = 0; i < fields.size(); i++) {
+    const FieldDescriptor* field = fields[i];
+    bool repeated = field->is_repeated();
+    int count = repeated ? reflection->FieldSize(message, field) : 1;
+    for (int j = 0; j < count; j++) {
+      switch (field->cpp_type()) {
+#define HANDLE_TYPE(CPPTYPE, METHOD)                                   \
+        case FieldDescriptor::CPPTYPE_##CPPTYPE:                       \
+          total += static_cast<int>(repeated ?                         \
+              reflection->GetRepeated##METHOD(message, field, j) :     \
+              reflection->Get##METHOD(message, field));                \
+          break;
+
+        HANDLE_TYPE(INT32 , Int32 )
+        HANDLE_TYPE(INT64 , Int64 )
+        HANDLE_TYPE(UINT32, UInt32)
+        HANDLE_TYPE(UINT64, UInt64)
+        HANDLE_TYPE(DOUBLE, Double)
+        HANDLE_TYPE(FLOAT , Float )
+        HANDLE_TYPE(BOOL  , Bool  )
+#undef HANDLE_TYPE
+
+        case FieldDescriptor::CPPTYPE_ENUM:
+          total += (repeated ?
+              reflection->GetRepeatedEnum(message, field, j) :
+              reflection->GetEnum(message, field))->number();
+          break;
+        case FieldDescriptor::CPPTYPE_STRING:
+          total += (repeated ?
+              reflection->GetRepeatedStringReference(message, field, j,
+                                                     &scratch) :
+              reflection->GetStringReference(message, field,
+                                             &scratch)).size();
+          break;
+        case FieldDescriptor::CPPTYPE_MESSAGE:
+          total += Walk(repeated ?
+              reflection->GetRepeatedMessage(message, field, j) :
+              reflection->GetMessage(message, field));
+          break;
+      }
+    }
+  }
+  return total;
+}
+
+void ReadByReflection(State* state) {
+  sink += Walk(*state->full_message);
+}
+
+struct Operation {
+  const char* name;
+  void (*function)(State*);
+  bool needs_reflection;
+  bool text;
+};
+
+const Operation kOperations[] = {
+  { "parse"      , &Parse            , false, false },
+  { "serialize"  , &Serialize        , false, false },
+  { "byte size"  , &ByteSize         , false, false },
+  { "copy"       , &Copy             , false, false },
+  { "merge new"  , &MergeIntoNew     , false, false },
+  { "text print" , &PrintText        , true , true  },
+  { "text stream", &PrintTextToStream, true , true  },
+  { "short debug", &ShortDebugString , true , true  },
+  { "text parse" , &ParseText        , true , true  },
+  { "reflection" , &ReadByReflection , true , false },
+};
+
+// -------------------------------------------------------------------
+
+struct Variant {
+  const char* name;
+  const MessageLite* prototype;
+  const Message* full_prototype;  // NULL for lite messages.
+};
+
+void RunVariants(const char* dataset, const Message& generated,
+                 const vector<Variant>& variants, const char* filter) {
+  string serialized = generated.SerializeAsString();
+  string text;
+  TextFormat::PrintToString(generated, &text);
+
+  for (int i = 0; i < GOOGLE_ARRAYSIZE(kOperations); i++) {
+    const Operation& operation = kOperations[i];
+    for (int j = 0; j < variants.size(); j++) {
+      const Variant& variant = variants[j];
+      if (operation.needs_reflection && variant.full_prototype == NULL) {
+        continue;
+      }
+      string name = string(dataset) + "/" + variant.name + "/" +
+                    operation.name;
+      if (name.find(filter) == string::npos) continue;
+
+      State state;
+      if (variant.full_prototype != NULL) {
+        state.full_message = variant.full_prototype->New();
+        state.full_scratch = variant.full_prototype->New();
+        state.message = state.full_message;
+        state.scratch = state.full_scratch;
+      } else {
+        state.full_message = NULL;
+        state.full_scratch = NULL;
+        state.message = variant.prototype->New();
+        state.scratch = variant.prototype->New();
+      }
+      state.serialized = serialized;
+      state.text = text;
+      GOOGLE_CHECK(state.message->ParseFromString(serialized));
+      GOOGLE_CHECK_EQ(state.message->ByteSize(), serialized.size());
+      state.output.resize(serialized.size());
+
+      double seconds = MeasureMedian(operation.function, &state);
+      int bytes = operation.text ? text.size() : serialized.size();
+      printf("%-40s %12.1f %10.1f\n", name.c_str(), seconds * 1e9,
+             bytes / seconds / (1 << 20));
+
+      delete state.message;
+      delete state.scratch;
+    }
+  }
+}
+
+}  // namespace
+}  // namespace protobuf_benchmarks
+
+int main(int argc, char* argv[]) {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+  using namespace protobuf_benchmarks;
+  using google::protobuf::DescriptorPool;
+  using google::protobuf::DynamicMessageFactory;
+  using google::protobuf::FileDescriptorProto;
+
+  const char* filter = (argc > 1) ? argv[1] : "";
+
+  // Build the types again in a pool of their own, so that the factory
+  // cannot hand out the generated classes.
+  FileDescriptorProto file;
+  SmallRequest::descriptor()->file()->CopyTo(&file);
+  DescriptorPool pool;
+  GOOGLE_CHECK(pool.BuildFile(file) != NULL);
+  DynamicMessageFactory factory(&pool);
+
+  SmallRequest small;
+  FillSmallRequest(&small);
+  WideMessage wide;
+  FillWideMessage(&wide);
+  DeepMessage deep;
+  FillDeepMessage(&deep);
+  PackedArrays packed;
+  FillPackedArrays(&packed);
+
+  struct {
+    const char* name;
+    const Message* generated;
+    const Message* table_driven;
+    const MessageLite* lite;
+  } datasets[] = {
+    { "small", &small,
+      &table_driven::SmallRequest::default_instance(),
+      &lite::SmallRequest::default_instance() },
+    { "wide", &wide,
+      &table_driven::WideMessage::default_instance(),
+      &lite::WideMessage::default_instance() },
+    { "deep", &deep,
+      &table_driven::DeepMessage::default_instance(),
+      &lite::DeepMessage::default_instance() },
+    { "packed", &packed,
+      &table_driven::PackedArrays::default_instance(),
+      &lite::PackedArrays::default_instance() },
+  };
+
+  for (int i = 0; i < GOOGLE_ARRAYSIZE(datasets); i++) {
+    printf("%-8s %8d bytes, %8d bytes of text\n", datasets[i].name,
+           datasets[i].generated->ByteSize(),
+           static_cast<int>(datasets[i].generated->DebugString().size()));
+  }
+  printf("\n%-40s %12s %10s\n", "", "ns/op", "MB/s");
+
+  for (int i = 0; i < GOOGLE_ARRAYSIZE(datasets); i++) {
+    const Message& generated = *datasets[i].generated;
+    const Message* dynamic = factory.GetPrototype(
+        pool.FindMessageTypeByName(generated.GetDescriptor()->full_name()));
+
+    vector<Variant> variants;
+    Variant generated_variant = { "generated", &generated, &generated };
+    Variant table_driven_variant = { "table-driven", datasets[i].table_driven,
+                                     datasets[i].table_driven };
+    Variant lite_variant = { "lite", datasets[i].lite, NULL };
+    Variant dynamic_variant = { "dynamic", dynamic, dynamic };
+    variants.push_back(generated_variant);
+    variants.push_back(table_driven_variant);
+    variants.push_back(lite_variant);
+    variants.push_back(dynamic_variant);
+
+    RunVariants(datasets[i].name, generated, variants, filter);
+  }
+
+  if (sink == 0) printf("\n");
+  return 0;
+}
@@ -0,0 +1,190 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// http://code.google.com/p/protobuf/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// Measures what generated code costs a binary at startup:  the static
+// initializers which run before main(), and the work they leave for the
+// first time each kind of thing is used.  The binary links 16 generated
+// files of 32 messages each (see make_startup_benchmark_protos.sh), and
+// measures, in microseconds:
+//
+//   static init       the static initializers of those 16 files
+//   default instance  the first default_instance() of a type in file 08
+//   descriptor        the first descriptor() of a type in file 09
+//   find by name      the first lookup of a type in file 10 by name in
+//                     DescriptorPool::generated_pool()
+//   extension parse   the first parse of a Base carrying an extension
+//                     defined in file 11
+//
+// Each of these happens once per process, so the benchmark runs itself
+// kRuns times with --once and reports the median of each measurement.  The
+// static initializers of libprotobuf itself are not included, and static
+// init is only measured when compiled with GCC or Clang.
+//
+// Usage:  startup_benchmark
+
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+#include <google/protobuf/stubs/common.h>
+#include "startup_benchmark_00.pb.h"
+#include "startup_benchmark_08.pb.h"
+#include "startup_benchmark_09.pb.h"
+#include "startup_benchmark_11.pb.h"
+#include "benchmark_util.h"
+
+namespace google {
+namespace protobuf {
+namespace {
+
+using protobuf_benchmarks::Median;
+using protobuf_benchmarks::Now;
+
+// Runs of a whole process are noisier than the usual ones, so take more.
+const int kRuns = 11;
+const int kFiles = 16;
+
+const char* const kMeasurementNames[] = {
+  "static init", "default instance", "descriptor", "find by name",
+  "extension parse",
+};
+const int kMeasurementCount = GOOGLE_ARRAYSIZE(kMeasurementNames);
+
+#if defined(__GNUC__)
+// Static initializers of a lower priority run before all the ones of the
+// default priority, among them those of the generated files.
+double init_start = 0;
+struct InitStartRecorder {
+  InitStartRecorder() { init_start = Now(); }
+} init_start_recorder __attribute__((init_priority(101)));
+#else
+double init_start = -1;
+#endif
+
+// Prints the measurements of this process, in microseconds, on one line.
+int RunOnce() {
+  double times[kMeasurementCount];
+  double start = Now();
+  times[0] = init_start < 0 ? -1 : (start - init_start) * 1e6;
+
+  start = Now();
+  const Message& message08 =
+      startup_benchmark::f08::Message31::default_instance();
+  times[1] = (Now() - start) * 1e6;
+
+  start = Now();
+  const Descriptor* descriptor09 =
+      startup_benchmark::f09::Message31::descriptor();
+  times[2] = (Now() - start) * 1e6;
+
+  start = Now();
+  const Descriptor* descriptor10 = DescriptorPool::generated_pool()->
+      FindMessageTypeByName("startup_benchmark.f10.Message31");
+  times[3] = (Now() - start) * 1e6;
+
+  string data;
+  {
+    io::StringOutputStream raw_output(&data);
+    io::CodedOutputStream output(&raw_output);
+    output.WriteTag(internal::WireFormatLite::MakeTag(
+        startup_benchmark::f11::kCount11FieldNumber,
+        internal::WireFormatLite::WIRETYPE_VARINT));
+    output.WriteVarint32(42);
+  }
+  startup_benchmark::f00::Base base;
+  start = Now();
+  bool parsed = base.ParseFromString(data);
+  times[4] = (Now() - start) * 1e6;
+
+  if (message08.ByteSize() != 0 || descriptor09 == NULL ||
+      descriptor10 == NULL || !parsed ||
+      base.GetExtension(startup_benchmark::f11::count_11) != 42) {
+    fprintf(stderr, "Unexpected results.\n");
+    return 1;
+  }
+
+  for (int i = 0; i < kMeasurementCount; i++) {
+    printf("%f ", times[i]);
+  }
+  printf("\n");
+  return 0;
+}
+
+int Run(const char* self) {
+  string command = string(self) + " --once";
+  vector<vector<double> > times(kMeasurementCount);
+  for (int run = 0; run < kRuns; run++) {
+    FILE* child = popen(command.c_str(), "r");
+    if (child == NULL) {
+      perror(command.c_str());
+      return 1;
+    }
+    for (int i = 0; i < kMeasurementCount; i++) {
+      double time;
+      if (fscanf(child, "%lf", &time) != 1) {
+        fprintf(stderr, "%s failed.\n", command.c_str());
+        pclose(child);
+        return 1;
+      }
+      times[i].push_back(time);
+    }
+    pclose(child);
+  }
+
+  printf("%-18s %10s\n", "measurement", "us");
+  vector<double> medians(kMeasurementCount);
+  for (int i = 0; i < kMeasurementCount; i++) {
+    double median = medians[i] = Median(times[i]);
+    if (median < 0) {
+      printf("%-18s %10s\n", kMeasurementNames[i], "n/a");
+    } else {
+      printf("%-18s %10.1f\n", kMeasurementNames[i], median);
+    }
+  }
+  if (medians[0] >= 0) {
+    printf("%-18s %10.2f\n", "static init/file", medians[0] / kFiles);
+  }
+  return 0;
+}
+
+}  // namespace
+}  // namespace protobuf
+}  // namespace google
+
+int main(int argc, char* argv[]) {
+  if (argc > 1 && strcmp(argv[1], "--once") == 0) {
+    return google::protobuf::RunOnce();
+  }
+  return google::protobuf::Run(argv[0]);
+}
@@ -0,0 +1,149 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// http://code.google.com/p/protobuf/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Measures a message which passes unknown fields through: parsed, then
+// serialized again without being looked at.  Compares UnknownFieldSet's
+// default storage, one UnknownField per field, with raw storage, which keeps
+// the bytes as they were read.  Each time is the median of several runs (see
+// benchmark_util.h).
+//
+// Usage:  unknown_fields_benchmark
+
+#include <stdio.h>
+#include <string>
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/unknown_field_set.h>
+#include "benchmark_messages.pb.h"
+#include "benchmark_util.h"
+
+namespace protobuf_benchmarks {
+namespace {
+
+using std::string;
+
+const int kRepeatedCount = 20;
+
+// Keeps results from being optimized away.
+int sink = 0;
+
+string MakeInput() {
+  ExtensionHeavyMessage message;
+  message.SetExtension(ext_int32_a, 1);
+  message.SetExtension(ext_int32_b, 2);
+  message.SetExtension(ext_int64, GOOGLE_LONGLONG(3000000000));
+  message.SetExtension(ext_uint32, 4);
+  message.SetExtension(ext_bool_a, true);
+  message.SetExtension(ext_double, 7.5);
+  message.SetExtension(ext_float, 8.5);
+  message.SetExtension(ext_string_a, "a somewhat longer string field value");
+  message.SetExtension(ext_bytes, string(200, 'x'));
+  message.SetExtension(ext_enum, EXTENSION_BAR);
+  message.MutableExtension(ext_message)->set_id(13);
+  message.MutableExtension(ext_message)->set_name("payload");
+  for (int i = 0; i < kRepeatedCount; i++) {
+    message.AddExtension(ext_repeated_int32, i * 1000);
+    message.AddExtension(ext_repeated_string, "element");
+  }
+  message.SetExtension(ext_sint64, -16);
+  return message.SerializeAsString();
+}
+
+struct State {
+  PassThroughMessage message;
+  string input;
+};
+
+void ParseAndSerialize(State* state) {
+  string output;
+  state->message.ParseFromString(state->input);
+  state->message.SerializeToString(&output);
+  sink += output.size();
+}
+
+void Parse(State* state) {
+  sink += state->message.ParseFromString(state->input);
+}
+
+void ByteSize(State* state) {
+  sink += state->message.ByteSize();
+}
+
+void Serialize(State* state) {
+  string output;
+  state->message.SerializeToString(&output);
+  sink += output.size();
+}
+
+void Copy(State* state) {
+  PassThroughMessage copy;
+  copy.CopyFrom(state->message);
+  sink += copy.id();
+}
+
+void Run(const char* name, void (*function)(State*), bool raw_storage) {
+  State state;
+  state.input = MakeInput();
+  // Clear() keeps the storage mode, so this holds for every parse below.
+  state.message.mutable_unknown_fields()->set_raw_storage(raw_storage);
+  state.message.ParseFromString(state.input);
+
+  double ns = MeasureMedian(function, &state) * 1e9;
+  printf("%-22s %-8s %12.1f %10.1f %10d\n", name,
+         raw_storage ? "raw" : "fields", ns,
+         state.input.size() * 1e3 / ns,
+         state.message.SpaceUsed());
+}
+
+void RunBoth(const char* name, void (*function)(State*)) {
+  Run(name, function, false);
+  Run(name, function, true);
+}
+
+}  // namespace
+}  // namespace protobuf_benchmarks
+
+int main(int argc, char* argv[]) {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+  using namespace protobuf_benchmarks;
+
+  printf("%d bytes per message, all but one field unknown.\n",
+         static_cast<int>(MakeInput().size()));
+  printf("%-22s %-8s %12s %10s %10s\n",
+         "operation", "storage", "ns/message", "MB/s", "SpaceUsed");
+  RunBoth("parse and serialize", &ParseAndSerialize);
+  RunBoth("parse", &Parse);
+  RunBoth("byte size", &ByteSize);
+  RunBoth("serialize", &Serialize);
+  RunBoth("copy", &Copy);
+
+  if (sink == 0) printf("\n");
+  return 0;
+}
@@ -0,0 +1,129 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// http://code.google.com/p/protobuf/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Compares the UTF-8 validators behind IsStructurallyValidUTF8() (see
+// stubs/structurally_valid.h) on text of several lengths:
+//
+//   ascii   English prose with an accented letter every hundred bytes or so
+//   cjk     Chinese, three bytes a character, with ASCII punctuation
+//
+// Validators which are not compiled in, or which the processor cannot run,
+// are skipped; IsStructurallyValidUTF8() uses the last one listed.
+//
+// Every measurement is taken with MeasureMedian() (see benchmark_util.h),
+// and reported in ns per string and MB/s.
+//
+// Usage:  utf8_validation_benchmark
+
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/stubs/structurally_valid.h>
+#include "benchmark_util.h"
+
+namespace google {
+namespace protobuf {
+namespace {
+
+using internal::GetUTF8Validator;
+using internal::UTF8ValidatorFunction;
+using internal::UTF8ValidatorType;
+using protobuf_benchmarks::MeasureMedian;
+
+const char* const kValidatorNames[] = { "table", "sse2", "avx2" };
+
+// Repeats sample until it is at least size bytes, then cuts it back to the
+// last whole character which fits.
+string MakeText(const string& sample, int size) {
+  string text;
+  while (text.size() < size) text += sample;
+  int end = size;
+  while (end > 0 && (text[end] & 0xC0) == 0x80) --end;
+  return text.substr(0, end);
+}
+
+struct State {
+  UTF8ValidatorFunction* validator;
+  const string* text;
+  int valid;  // Keeps the validations from being optimized away.
+};
+
+void Validate(State* state) {
+  if (state->validator(state->text->data(), state->text->size())) {
+    ++state->valid;
+  }
+}
+
+// Returns the median time of one validation, in seconds.
+double Measure(UTF8ValidatorFunction* validator, const string& text) {
+  State state = { validator, &text, 0 };
+  double seconds = MeasureMedian(&Validate, &state);
+  if (state.valid == 0) printf("(text was rejected)\n");
+  return seconds;
+}
+
+void Run(const char* text_name, const string& sample) {
+  const int kSizes[] = { 16, 128, 1024, 65536 };
+  for (int i = 0; i < GOOGLE_ARRAYSIZE(kSizes); i++) {
+    string text = MakeText(sample, kSizes[i]);
+    for (int type = 0; type < internal::UTF8_VALIDATOR_TYPE_COUNT; type++) {
+      UTF8ValidatorFunction* validator =
+        GetUTF8Validator(static_cast<UTF8ValidatorType>(type));
+      if (validator == NULL) continue;
+      double seconds = Measure(validator, text);
+      printf("%-6s %8d %-6s %12.1f %10.1f\n", text_name,
+             static_cast<int>(text.size()), kValidatorNames[type],
+             seconds * 1e9, text.size() / seconds / (1 << 20));
+    }
+  }
+}
+
+}  // namespace
+}  // namespace protobuf
+}  // namespace google
+
+int main(int argc, char* argv[]) {
+  printf("%-6s %8s %-6s %12s %10s\n", "text", "bytes", "impl", "ns/string",
+         "MB/s");
+  google::protobuf::Run("ascii",
+      "Protocol buffers are a flexible, efficient, automated mechanism for "
+      "serializing structured data -- think XML, but smaller, faster, and "
+      "simpler. Caf\303\251 na\303\257ve r\303\251sum\303\251. ");
+  google::protobuf::Run("cjk",
+      "\345\215\217\350\256\256\347\274\223\345\206\262\345\214\272\346\230"
+      "\257\344\270\200\347\247\215\347\201\265\346\264\273\343\200\201\351"
+      "\253\230\346\225\210\347\232\204\347\273\223\346\236\204\345\214\226"
+      "\346\225\260\346\215\256\345\272\217\345\210\227\345\214\226\346\234"
+      "\272\345\210\266 (protobuf), \346\257\224 XML \346\233\264\345\260\217"
+      "\343\200\201\346\233\264\345\277\253\343\200\202");
+  return 0;
+}
@@ -0,0 +1,144 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// http://code.google.com/p/protobuf/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <google/protobuf/arena.h>
+#include <google/protobuf/stubs/common.h>
+
+namespace google {
+namespace protobuf {
+
+const size_t Arena::kHeaderSize;
+
+ArenaOptions::ArenaOptions()
+  : start_block_size(256),
+    max_block_size(8192),
+    initial_block(NULL),
+    initial_block_size(0) {
+}
+
+Arena::Arena() {
+  Init();
+}
+
+Arena::Arena(const ArenaOptions& options)
+  : options_(options) {
+  Init();
+}
+
+Arena::~Arena() {
+  RunCleanups();
+  FreeBlocks();
+}
+
+void Arena::Init() {
+  blocks_ = NULL;
+  cleanup_list_ = NULL;
+  space_allocated_ = 0;
+
+  if (options_.initial_block != NULL &&
+      options_.initial_block_size > kHeaderSize) {
+    GOOGLE_DCHECK_EQ(reinterpret_cast<uintptr_t>(options_.initial_block) & 7, 0)
+        << "ArenaOptions::initial_block must be 8-byte aligned.";
+    blocks_ = reinterpret_cast<Block*>(options_.initial_block);
+    blocks_->next = NULL;
+    blocks_->size = options_.initial_block_size;
+    blocks_->pos = kHeaderSize;
+    space_allocated_ = options_.initial_block_size;
+  }
+}
+
+void* Arena::AllocateFromNewBlock(size_t size) {
+  size_t block_size;
+  if (blocks_ == NULL) {
+    block_size = options_.start_block_size;
+  } else {
+    block_size = min(blocks_->size * 2, options_.max_block_size);
+  }
+  if (block_size < kHeaderSize + size) {
+    block_size = kHeaderSize + size;
+  }
+
+  Block* block = reinterpret_cast<Block*>(new char[block_size]);
+  block->next = blocks_;
+  block->size = block_size;
+  block->pos = kHeaderSize + size;
+  blocks_ = block;
+  space_allocated_ += block_size;
+
+  return reinterpret_cast<char*>(block) + kHeaderSize;
+}
+
+void Arena::AddCleanup(void* object, void (*cleanup)(void*)) {
+  CleanupNode* node = reinterpret_cast<CleanupNode*>(
+      AllocateAligned(sizeof(CleanupNode)));
+  node->object = object;
+  node->cleanup = cleanup;
+  node->next = cleanup_list_;
+  cleanup_list_ = node;
+}
+
+void Arena::RunCleanups() {
+  while (cleanup_list_ != NULL) {
+    CleanupNode* node = cleanup_list_;
+    cleanup_list_ = node->next;
+    node->cleanup(node->object);
+  }
+}
+
+void Arena::FreeBlocks() {
+  Block* block = blocks_;
+  while (block != NULL) {
+    Block* next = block->next;
+    if (reinterpret_cast<char*>(block) != options_.initial_block) {
+      delete [] reinterpret_cast<char*>(block);
+    }
+    block = next;
+  }
+  blocks_ = NULL;
+}
+
+uint64 Arena::Reset() {
+  uint64 space_allocated = space_allocated_;
+  RunCleanups();
+  FreeBlocks();
+  Init();
+  return space_allocated;
+}
+
+uint64 Arena::SpaceUsed() const {
+  uint64 space_used = 0;
+  for (Block* block = blocks_; block != NULL; block = block->next) {
+    space_used += block->pos - kHeaderSize;
+  }
+  return space_used;
+}
+
+}  // namespace protobuf
+}  // namespace google
@@ -0,0 +1,239 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// http://code.google.com/p/protobuf/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Arena is a block allocator for protocol messages.  Objects created on an
+// Arena are carved out of large blocks and are all released together when
+// the Arena is reset or destroyed, so that building up and throwing away a
+// large message tree costs a handful of block allocations rather than one
+// malloc() and one free() per field.
+//
+// Generated classes support arenas when the .proto file contains:
+//
+//   option cc_enable_arenas = true;
+//
+// Such classes get a constructor taking an Arena*, and every string,
+// sub-message and repeated field reached through them (by accessors,
+// parsing, merging or reflection) is placed on that same arena:
+//
+//   Arena arena;
+//   MyRequest* request = Arena::CreateMessage<MyRequest>(&arena);
+//   request->ParseFromString(data);
+//   ...
+//   // No delete; everything goes away with the arena.
+//
+// Objects on an arena must never be deleted directly.  Swapping an arena
+// message with a message on the heap (or on a different arena) is allowed,
+// but falls back to copying the contents.  An Arena is not thread-safe; use
+// one arena per request or per thread.
+
+#ifndef GOOGLE_PROTOBUF_ARENA_H__
+#define GOOGLE_PROTOBUF_ARENA_H__
+
+#include <new>
+#include <google/protobuf/stubs/common.h>
+
+namespace google {
+namespace protobuf {
+
+class Arena;
+
+namespace internal {
+
+// Cleanup functions registered by Arena::Create() and Arena::Own().
+template <typename T>
+void arena_destruct_object(void* object) {
+  reinterpret_cast<T*>(object)->~T();
+}
+template <typename T>
+void arena_delete_object(void* object) {
+  delete reinterpret_cast<T*>(object);
+}
+
+// Detects generated message classes that have a constructor taking an
+// Arena*.  Such classes advertise it with a public typedef named
+// InternalArenaConstructable_.
+template <typename T>
+class is_arena_constructable {
+  template <typename U>
+  static char Test(const typename U::InternalArenaConstructable_*);
+  template <typename U>
+  static double Test(...);
+
+ public:
+  static const bool value = sizeof(Test<T>(NULL)) == sizeof(char);
+};
+
+template <typename T, bool kArenaConstructable>
+struct ArenaConstructor {
+  static T* Construct(void* memory, Arena* arena) {
+    return new (memory) T(arena);
+  }
+};
+template <typename T>
+struct ArenaConstructor<T, false> {
+  static T* Construct(void* memory, Arena* arena) {
+    return new (memory) T();
+  }
+};
+
+}  // namespace internal
+
+// Tuning knobs for an Arena.
+struct LIBPROTOBUF_EXPORT ArenaOptions {
+  // Size of the first block allocated from the heap.  Each following block
+  // is twice the size of the previous one, up to max_block_size.  Requests
+  // larger than that get a block of their own.
+  size_t start_block_size;
+  size_t max_block_size;
+
+  // An optional caller-owned buffer (for example a stack array) used as the
+  // first block.  The arena never frees it, so an arena whose contents fit
+  // entirely in initial_block never touches the heap.  Must be aligned to
+  // 8 bytes.
+  char* initial_block;
+  size_t initial_block_size;
+
+  ArenaOptions();
+};
+
+class LIBPROTOBUF_EXPORT Arena {
+ public:
+  Arena();
+  explicit Arena(const ArenaOptions& options);
+
+  // Runs all registered cleanups and frees all blocks.
+  ~Arena();
+
+  // Creates a message of type T.  If T is a generated class with arena
+  // support, it is constructed with this arena so that its fields are
+  // allocated here too; otherwise it is default-constructed in arena memory
+  // and only destroyed when the arena is.  If |arena| is NULL this is just
+  // "new T".
+  template <typename T>
+  static T* CreateMessage(Arena* arena) {
+    if (arena == NULL) return new T;
+    T* result = internal::ArenaConstructor<
+        T, internal::is_arena_constructable<T>::value>::Construct(
+            arena->AllocateAligned(sizeof(T)), arena);
+    arena->AddCleanup(result, &internal::arena_destruct_object<T>);
+    return result;
+  }
+
+  // Creates a default-constructed object of any type on the arena.  Its
+  // destructor runs when the arena is reset or destroyed.  If |arena| is
+  // NULL this is just "new T".
+  template <typename T>
+  static T* Create(Arena* arena) {
+    if (arena == NULL) return new T;
+    T* result = new (arena->AllocateAligned(sizeof(T))) T;
+    arena->AddCleanup(result, &internal::arena_destruct_object<T>);
+    return result;
+  }
+
+  // Allocates an array of a primitive type on the arena.  No constructors
+  // or destructors are run.  If |arena| is NULL this is "new T[n]", which
+  // must be freed with delete[].
+  template <typename T>
+  static T* CreateArray(Arena* arena, size_t num_elements) {
+    if (arena == NULL) return new T[num_elements];
+    return reinterpret_cast<T*>(
+        arena->AllocateAligned(sizeof(T) * num_elements));
+  }
+
+  // Transfers ownership of a heap-allocated object to the arena, which will
+  // delete it when it is reset or destroyed.
+  template <typename T>
+  void Own(T* object) {
+    if (object != NULL) {
+      AddCleanup(object, &internal::arena_delete_object<T>);
+    }
+  }
+
+  // Returns |size| bytes of uninitialized memory, aligned to 8 bytes.
+  inline void* AllocateAligned(size_t size);
+
+  // Registers a function to be called with |object| when the arena is reset
+  // or destroyed.  Cleanups run in reverse order of registration.
+  void AddCleanup(void* object, void (*cleanup)(void*));
+
+  // Runs all registered cleanups and frees every block except the caller's
+  // initial block, leaving the arena empty and ready for reuse.  Returns
+  // the total number of bytes the arena had allocated.
+  uint64 Reset();
+
+  // Total bytes obtained for blocks, including the initial block.
+  uint64 SpaceAllocated() const { return space_allocated_; }
+  // Bytes actually handed out by AllocateAligned() (including cleanup
+  // bookkeeping).
+  uint64 SpaceUsed() const;
+
+ private:
+  struct Block {
+    Block* next;
+    size_t size;  // Including the header.
+    size_t pos;   // Offset of the first free byte from the block start.
+  };
+
+  struct CleanupNode {
+    void* object;
+    void (*cleanup)(void*);
+    CleanupNode* next;
+  };
+
+  static const size_t kHeaderSize = (sizeof(Block) + 7) & ~size_t(7);
+
+  void Init();
+  void* AllocateFromNewBlock(size_t size);
+  void RunCleanups();
+  void FreeBlocks();
+
+  ArenaOptions options_;
+  Block* blocks_;               // Most recently allocated block first.
+  CleanupNode* cleanup_list_;   // Most recently registered first.
+  uint64 space_allocated_;
+
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(Arena);
+};
+
+inline void* Arena::AllocateAligned(size_t size) {
+  size = (size + 7) & ~size_t(7);
+  Block* block = blocks_;
+  if (block != NULL && block->size - block->pos >= size) {
+    void* result = reinterpret_cast<char*>(block) + block->pos;
+    block->pos += size;
+    return result;
+  }
+  return AllocateFromNewBlock(size);
+}
+
+}  // namespace protobuf
+
+}  // namespace google
+#endif  // GOOGLE_PROTOBUF_ARENA_H__
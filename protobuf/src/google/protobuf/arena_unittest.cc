@@ -0,0 +1,419 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// http://code.google.com/p/protobuf/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <string>
+#include <vector>
+
+#include <google/protobuf/arena.h>
+#include <google/protobuf/repeated_field.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/unittest.pb.h>
+#include <google/protobuf/unittest_arena.pb.h>
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/testing/googletest.h>
+#include <gtest/gtest.h>
+
+namespace google {
+using protobuf_unittest::ForeignMessage;
+using protobuf_unittest::TestAllTypes;
+using protobuf_unittest::TestArenaMessage;
+
+namespace protobuf {
+namespace {
+
+// Records the order in which cleanups run.
+vector<int>* cleanup_order = NULL;
+void RecordCleanup(void* object) {
+  cleanup_order->push_back(*reinterpret_cast<int*>(object));
+}
+
+class DestructorCounter {
+ public:
+  DestructorCounter() : counter_(NULL) {}
+  ~DestructorCounter() { if (counter_ != NULL) ++*counter_; }
+  void set_counter(int* counter) { counter_ = counter; }
+
+ private:
+  int* counter_;
+};
+
+void FillMessage(TestArenaMessage* message) {
+  message->set_optional_int32(101);
+  message->set_optional_string("a string that does not fit in SSO buffers");
+  message->mutable_optional_child()->set_optional_int32(102);
+  message->mutable_optional_child()->add_repeated_string("child");
+  message->mutable_optional_foreign_message()->set_c(103);
+  message->mutable_optionalgroup()->set_a(104);
+  message->add_repeated_int64(105);
+  message->add_repeated_int64(106);
+  message->add_repeated_string("foo");
+  message->add_repeated_string("bar");
+  message->add_repeated_child()->set_optional_string("baz");
+  message->add_repeated_foreign_message()->set_c(107);
+  message->add_packed_fixed32(108);
+  message->SetExtension(protobuf_unittest::arena_int32_extension, 109);
+  message->SetExtension(protobuf_unittest::arena_string_extension, "qux");
+}
+
+void ExpectMessageFilled(const TestArenaMessage& message) {
+  EXPECT_EQ(101, message.optional_int32());
+  EXPECT_EQ("a string that does not fit in SSO buffers",
+            message.optional_string());
+  EXPECT_EQ("arena", message.default_bytes());
+  EXPECT_EQ(102, message.optional_child().optional_int32());
+  ASSERT_EQ(1, message.optional_child().repeated_string_size());
+  EXPECT_EQ("child", message.optional_child().repeated_string(0));
+  EXPECT_EQ(103, message.optional_foreign_message().c());
+  EXPECT_EQ(104, message.optionalgroup().a());
+  ASSERT_EQ(2, message.repeated_int64_size());
+  EXPECT_EQ(105, message.repeated_int64(0));
+  EXPECT_EQ(106, message.repeated_int64(1));
+  ASSERT_EQ(2, message.repeated_string_size());
+  EXPECT_EQ("foo", message.repeated_string(0));
+  EXPECT_EQ("bar", message.repeated_string(1));
+  ASSERT_EQ(1, message.repeated_child_size());
+  EXPECT_EQ("baz", message.repeated_child(0).optional_string());
+  ASSERT_EQ(1, message.repeated_foreign_message_size());
+  EXPECT_EQ(107, message.repeated_foreign_message(0).c());
+  ASSERT_EQ(1, message.packed_fixed32_size());
+  EXPECT_EQ(108, message.packed_fixed32(0));
+  EXPECT_EQ(109, message.GetExtension(protobuf_unittest::arena_int32_extension));
+  EXPECT_EQ("qux", message.GetExtension(
+      protobuf_unittest::arena_string_extension));
+}
+
+TEST(ArenaTest, AllocateAligned) {
+  Arena arena;
+  for (int i = 1; i < 100; i++) {
+    void* p = arena.AllocateAligned(i);
+    EXPECT_EQ(0, reinterpret_cast<uintptr_t>(p) & 7);
+  }
+  EXPECT_GE(arena.SpaceUsed(), 99 * 8);
+  EXPECT_GE(arena.SpaceAllocated(), arena.SpaceUsed());
+}
+
+TEST(ArenaTest, BlockGrowth) {
+  ArenaOptions options;
+  options.start_block_size = 128;
+  options.max_block_size = 1024;
+  Arena arena(options);
+  EXPECT_EQ(0, arena.SpaceAllocated());
+
+  arena.AllocateAligned(8);
+  EXPECT_EQ(128, arena.SpaceAllocated());
+
+  // Fill the first block; the next one is twice as big.
+  while (arena.SpaceAllocated() == 128) arena.AllocateAligned(8);
+  EXPECT_EQ(128 + 256, arena.SpaceAllocated());
+
+  // Requests bigger than max_block_size get a block of their own.
+  uint64 before = arena.SpaceAllocated();
+  char* big = reinterpret_cast<char*>(arena.AllocateAligned(4096));
+  memset(big, 0xff, 4096);
+  EXPECT_GT(arena.SpaceAllocated(), before + 4096);
+}
+
+TEST(ArenaTest, InitialBlock) {
+  uint64 buffer[64];
+  ArenaOptions options;
+  options.initial_block = reinterpret_cast<char*>(buffer);
+  options.initial_block_size = sizeof(buffer);
+  Arena arena(options);
+  EXPECT_EQ(sizeof(buffer), arena.SpaceAllocated());
+
+  char* p = reinterpret_cast<char*>(arena.AllocateAligned(16));
+  EXPECT_GE(p, reinterpret_cast<char*>(buffer));
+  EXPECT_LT(p, reinterpret_cast<char*>(buffer) + sizeof(buffer));
+  EXPECT_EQ(sizeof(buffer), arena.SpaceAllocated());
+
+  // Overflowing the initial block goes to the heap; Reset() goes back to the
+  // initial block without freeing it.
+  arena.AllocateAligned(sizeof(buffer));
+  EXPECT_GT(arena.SpaceAllocated(), sizeof(buffer));
+  arena.Reset();
+  EXPECT_EQ(sizeof(buffer), arena.SpaceAllocated());
+  EXPECT_EQ(0, arena.SpaceUsed());
+}
+
+TEST(ArenaTest, CleanupOrderAndReset) {
+  vector<int> order;
+  cleanup_order = &order;
+  int values[3] = { 1, 2, 3 };
+
+  Arena arena;
+  for (int i = 0; i < 3; i++) {
+    arena.AddCleanup(&values[i], &RecordCleanup);
+  }
+  EXPECT_GT(arena.Reset(), 0);
+  ASSERT_EQ(3, order.size());
+  EXPECT_EQ(3, order[0]);
+  EXPECT_EQ(2, order[1]);
+  EXPECT_EQ(1, order[2]);
+  EXPECT_EQ(0, arena.SpaceAllocated());
+
+  // The arena is usable again after Reset().
+  arena.AddCleanup(&values[0], &RecordCleanup);
+  order.clear();
+  arena.Reset();
+  ASSERT_EQ(1, order.size());
+  EXPECT_EQ(1, order[0]);
+  cleanup_order = NULL;
+}
+
+TEST(ArenaTest, CreateAndOwn) {
+  int destroyed = 0;
+  {
+    Arena arena;
+    Arena::Create<DestructorCounter>(&arena)->set_counter(&destroyed);
+    DestructorCounter* owned = new DestructorCounter;
+    owned->set_counter(&destroyed);
+    arena.Own(owned);
+    arena.Own(static_cast<DestructorCounter*>(NULL));
+    EXPECT_EQ(0, destroyed);
+  }
+  EXPECT_EQ(2, destroyed);
+
+  // Without an arena, Create() is plain new.
+  DestructorCounter* heap = Arena::Create<DestructorCounter>(NULL);
+  heap->set_counter(&destroyed);
+  delete heap;
+  EXPECT_EQ(3, destroyed);
+}
+
+TEST(ArenaTest, CreateArray) {
+  Arena arena;
+  int32* array = Arena::CreateArray<int32>(&arena, 10);
+  for (int i = 0; i < 10; i++) array[i] = i;
+  EXPECT_EQ(9, array[9]);
+  EXPECT_GE(arena.SpaceUsed(), 10 * sizeof(int32));
+}
+
+TEST(ArenaTest, MessageOnArena) {
+  Arena arena;
+  TestArenaMessage* message = Arena::CreateMessage<TestArenaMessage>(&arena);
+  EXPECT_EQ(&arena, message->GetArena());
+  FillMessage(message);
+  ExpectMessageFilled(*message);
+
+  // Everything the message reached was allocated on the arena.
+  EXPECT_GT(arena.SpaceUsed(), sizeof(TestArenaMessage));
+  EXPECT_EQ(&arena, message->optional_child().GetArena());
+  EXPECT_EQ(&arena, message->repeated_child(0).GetArena());
+
+  message->Clear();
+  EXPECT_FALSE(message->has_optional_child());
+  EXPECT_EQ(0, message->repeated_string_size());
+  FillMessage(message);
+  ExpectMessageFilled(*message);
+}
+
+TEST(ArenaTest, HeapMessageHasNoArena) {
+  TestArenaMessage message;
+  EXPECT_TRUE(message.GetArena() == NULL);
+  FillMessage(&message);
+  ExpectMessageFilled(message);
+  EXPECT_TRUE(message.optional_child().GetArena() == NULL);
+
+  // Non-arena classes report no arena either.
+  TestAllTypes plain;
+  EXPECT_TRUE(plain.GetArena() == NULL);
+
+  TestArenaMessage* created = Arena::CreateMessage<TestArenaMessage>(NULL);
+  EXPECT_TRUE(created->GetArena() == NULL);
+  delete created;
+}
+
+TEST(ArenaTest, NonArenaMessageOnArena) {
+  Arena arena;
+  TestAllTypes* message = Arena::CreateMessage<TestAllTypes>(&arena);
+  message->set_optional_string("hello");
+  message->add_repeated_nested_message()->set_bb(1);
+  EXPECT_TRUE(message->GetArena() == NULL);
+  EXPECT_EQ("hello", message->optional_string());
+  // The destructor runs when |arena| goes away.
+}
+
+TEST(ArenaTest, ParseAndSerialize) {
+  TestArenaMessage original;
+  FillMessage(&original);
+  string data;
+  ASSERT_TRUE(original.SerializeToString(&data));
+
+  Arena arena;
+  TestArenaMessage* message = Arena::CreateMessage<TestArenaMessage>(&arena);
+  ASSERT_TRUE(message->ParseFromString(data));
+  ExpectMessageFilled(*message);
+
+  string reserialized;
+  ASSERT_TRUE(message->SerializeToString(&reserialized));
+  EXPECT_EQ(data, reserialized);
+
+  // Parsing again into the same message reuses it.
+  ASSERT_TRUE(message->ParseFromString(data));
+  ExpectMessageFilled(*message);
+}
+
+TEST(ArenaTest, CopyAndMerge) {
+  Arena arena;
+  TestArenaMessage* message = Arena::CreateMessage<TestArenaMessage>(&arena);
+  FillMessage(message);
+
+  TestArenaMessage heap_copy(*message);
+  EXPECT_TRUE(heap_copy.GetArena() == NULL);
+  ExpectMessageFilled(heap_copy);
+
+  TestArenaMessage* arena_copy =
+      Arena::CreateMessage<TestArenaMessage>(&arena);
+  arena_copy->CopyFrom(heap_copy);
+  ExpectMessageFilled(*arena_copy);
+}
+
+TEST(ArenaTest, SwapAcrossArenas) {
+  Arena arena1;
+  Arena arena2;
+  TestArenaMessage* message1 = Arena::CreateMessage<TestArenaMessage>(&arena1);
+  TestArenaMessage* message2 = Arena::CreateMessage<TestArenaMessage>(&arena2);
+  TestArenaMessage heap_message;
+  FillMessage(message1);
+  message2->set_optional_int32(1);
+
+  message1->Swap(message2);
+  ExpectMessageFilled(*message2);
+  EXPECT_EQ(1, message1->optional_int32());
+  EXPECT_EQ(&arena1, message1->GetArena());
+  EXPECT_EQ(&arena2, message2->GetArena());
+
+  heap_message.Swap(message2);
+  ExpectMessageFilled(heap_message);
+  EXPECT_FALSE(message2->has_optional_int32());
+  EXPECT_TRUE(heap_message.GetArena() == NULL);
+
+  // Swapping on the same arena just exchanges pointers.
+  TestArenaMessage* message3 = Arena::CreateMessage<TestArenaMessage>(&arena1);
+  message3->CopyFrom(heap_message);
+  message3->Swap(message1);
+  ExpectMessageFilled(*message1);
+  EXPECT_EQ(1, message3->optional_int32());
+}
+
+TEST(ArenaTest, ReflectionOnArena) {
+  Arena arena;
+  TestArenaMessage* message = Arena::CreateMessage<TestArenaMessage>(&arena);
+  const Reflection* reflection = message->GetReflection();
+  const Descriptor* descriptor = message->GetDescriptor();
+
+  reflection->SetString(message, descriptor->FindFieldByName("optional_string"),
+                        "reflected");
+  EXPECT_EQ("reflected", message->optional_string());
+
+  Message* child = reflection->MutableMessage(
+      message, descriptor->FindFieldByName("optional_child"));
+  child->GetReflection()->SetInt32(
+      child, child->GetDescriptor()->FindFieldByName("optional_int32"), 5);
+  EXPECT_EQ(5, message->optional_child().optional_int32());
+
+  Message* element = reflection->AddMessage(
+      message, descriptor->FindFieldByName("repeated_foreign_message"));
+  element->GetReflection()->SetInt32(
+      element, element->GetDescriptor()->FindFieldByName("c"), 6);
+  ASSERT_EQ(1, message->repeated_foreign_message_size());
+  EXPECT_EQ(6, message->repeated_foreign_message(0).c());
+
+  reflection->AddString(message, descriptor->FindFieldByName("repeated_string"),
+                        "element");
+  ASSERT_EQ(1, message->repeated_string_size());
+  EXPECT_EQ("element", message->repeated_string(0));
+
+  TestArenaMessage heap_message;
+  heap_message.set_optional_int32(7);
+  reflection->Swap(message, &heap_message);
+  EXPECT_EQ(7, message->optional_int32());
+  EXPECT_EQ("reflected", heap_message.optional_string());
+  EXPECT_EQ(5, heap_message.optional_child().optional_int32());
+}
+
+TEST(ArenaTest, RepeatedFieldOnArena) {
+  Arena arena;
+  RepeatedField<int>* field = Arena::Create<RepeatedField<int> >(&arena);
+  RepeatedField<int> arena_field(&arena);
+  EXPECT_EQ(&arena, arena_field.GetArena());
+  for (int i = 0; i < 100; i++) arena_field.Add(i);
+  EXPECT_EQ(100, arena_field.size());
+  EXPECT_EQ(99, arena_field.Get(99));
+
+  RepeatedField<int> heap_field;
+  heap_field.Add(-1);
+  heap_field.Swap(&arena_field);
+  EXPECT_EQ(100, heap_field.size());
+  EXPECT_EQ(1, arena_field.size());
+  EXPECT_EQ(-1, arena_field.Get(0));
+  EXPECT_TRUE(heap_field.GetArena() == NULL);
+  EXPECT_EQ(&arena, arena_field.GetArena());
+
+  field->Add(1);
+  EXPECT_EQ(1, field->size());
+}
+
+TEST(ArenaTest, RepeatedPtrFieldOnArena) {
+  Arena arena;
+  RepeatedPtrField<string> strings(&arena);
+  for (int i = 0; i < 20; i++) strings.Add()->assign("string");
+  EXPECT_EQ(20, strings.size());
+
+  // Objects added with AddAllocated() become owned by the arena.
+  strings.AddAllocated(new string("allocated"));
+  EXPECT_EQ("allocated", strings.Get(20));
+
+  // Released objects are always heap copies the caller may delete.
+  string* released = strings.ReleaseLast();
+  EXPECT_EQ("allocated", *released);
+  delete released;
+
+  RepeatedPtrField<ForeignMessage> messages(&arena);
+  messages.Add()->set_c(1);
+  RepeatedPtrField<ForeignMessage> heap_messages;
+  heap_messages.Add()->set_c(2);
+  heap_messages.Add()->set_c(3);
+  messages.Swap(&heap_messages);
+  ASSERT_EQ(2, messages.size());
+  EXPECT_EQ(3, messages.Get(1).c());
+  ASSERT_EQ(1, heap_messages.size());
+  EXPECT_EQ(1, heap_messages.Get(0).c());
+
+  messages.Clear();
+  ForeignMessage* cleared = messages.ReleaseCleared();
+  delete cleared;
+}
+
+}  // namespace
+}  // namespace protobuf
+}  // namespace google
@@ -160,10 +160,18 @@ void ExtensionGenerator::GenerateDefinition(io::Printer* printer) {
       "#endif\n");
   }
 
+  // Message extensions look up their default instance when it is needed, so
+  // that defining them does not construct it.
+  if (descriptor_->cpp_type() == FieldDescriptor::CPPTYPE_MESSAGE) {
+    vars["arguments"] = vars["constant_name"];
+  } else {
+    vars["arguments"] = vars["constant_name"] + ", " + vars["default"];
+  }
+
   printer->Print(vars,
     "::google::protobuf::internal::ExtensionIdentifier< $extendee$,\n"
     "    ::google::protobuf::internal::$type_traits$, $field_type$, $packed$ >\n"
-    "  $name$($constant_name$, $default$);\n");
+    "  $name$($arguments$);\n");
 }
 
 void ExtensionGenerator::GenerateRegistration(io::Printer* printer) {
@@ -180,7 +188,7 @@ void ExtensionGenerator::GenerateRegistration(io::Printer* printer) {
     case FieldDescriptor::CPPTYPE_ENUM:
       printer->Print(vars,
         "::google::protobuf::internal::ExtensionSet::RegisterEnumExtension(\n"
-        "  &$extendee$::default_instance(),\n"
+        "  $extendee$::internal_default_instance(),\n"
         "  $number$, $field_type$, $is_repeated$, $is_packed$,\n");
       printer->Print(
         "  &$type$_IsValid);\n",
@@ -189,16 +197,16 @@ void ExtensionGenerator::GenerateRegistration(io::Printer* printer) {
     case FieldDescriptor::CPPTYPE_MESSAGE:
       printer->Print(vars,
         "::google::protobuf::internal::ExtensionSet::RegisterMessageExtension(\n"
-        "  &$extendee$::default_instance(),\n"
+        "  $extendee$::internal_default_instance(),\n"
         "  $number$, $field_type$, $is_repeated$, $is_packed$,\n");
       printer->Print(
-        "  &$type$::default_instance());\n",
+        "  $type$::internal_default_instance());\n",
         "type", ClassName(descriptor_->message_type(), true));
       break;
     default:
       printer->Print(vars,
         "::google::protobuf::internal::ExtensionSet::RegisterExtension(\n"
-        "  &$extendee$::default_instance(),\n"
+        "  $extendee$::internal_default_instance(),\n"
         "  $number$, $field_type$, $is_repeated$, $is_packed$);\n");
       break;
   }
@@ -36,6 +36,7 @@
 #include <google/protobuf/compiler/cpp/cpp_helpers.h>
 #include <google/protobuf/compiler/cpp/cpp_primitive_field.h>
 #include <google/protobuf/compiler/cpp/cpp_string_field.h>
+#include <google/protobuf/compiler/cpp/cpp_string_piece_field.h>
 #include <google/protobuf/compiler/cpp/cpp_enum_field.h>
 #include <google/protobuf/compiler/cpp/cpp_message_field.h>
 #include <google/protobuf/descriptor.pb.h>
@@ -100,6 +101,8 @@ FieldGenerator* FieldGeneratorMap::MakeGenerator(const FieldDescriptor* field) {
           default:  // RepeatedStringFieldGenerator handles unknown ctypes.
           case FieldOptions::STRING:
             return new RepeatedStringFieldGenerator(field);
+          case FieldOptions::STRING_PIECE:
+            return new RepeatedStringPieceFieldGenerator(field);
         }
       case FieldDescriptor::CPPTYPE_ENUM:
         return new RepeatedEnumFieldGenerator(field);
@@ -109,12 +112,15 @@ FieldGenerator* FieldGeneratorMap::MakeGenerator(const FieldDescriptor* field) {
   } else {
     switch (field->cpp_type()) {
       case FieldDescriptor::CPPTYPE_MESSAGE:
+        if (IsLazy(field)) return new LazyMessageFieldGenerator(field);
         return new MessageFieldGenerator(field);
       case FieldDescriptor::CPPTYPE_STRING:
         switch (field->options().ctype()) {
           default:  // StringFieldGenerator handles unknown ctypes.
           case FieldOptions::STRING:
             return new StringFieldGenerator(field);
+          case FieldOptions::STRING_PIECE:
+            return new StringPieceFieldGenerator(field);
         }
       case FieldDescriptor::CPPTYPE_ENUM:
         return new EnumFieldGenerator(field);
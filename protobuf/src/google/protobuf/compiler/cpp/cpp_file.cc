@@ -142,6 +142,21 @@ void FileGenerator::GenerateHeader(io::Printer* printer) {
       "#include <google/protobuf/service.h>\n");
   }
 
+  if (SupportsArenas(file_)) {
+    printer->Print(
+      "#include <google/protobuf/arena.h>\n");
+  }
+
+  if (HasStringPieceFields(file_)) {
+    printer->Print(
+      "#include <google/protobuf/string_piece_field.h>\n");
+  }
+
+  if (HasLazyFields(file_)) {
+    printer->Print(
+      "#include <google/protobuf/lazy_field.h>\n");
+  }
+
 
   for (int i = 0; i < file_->dependency_count(); i++) {
     printer->Print(
@@ -155,21 +170,26 @@ void FileGenerator::GenerateHeader(io::Printer* printer) {
   // Open namespace.
   GenerateNamespaceOpeners(printer);
 
-  // Forward-declare the AddDescriptors, AssignDescriptors, and ShutdownFile
-  // functions, so that we can declare them to be friends of each class.
+  // Forward-declare the AddDescriptors, InitDefaults, AssignDescriptors, and
+  // ShutdownFile functions, so that we can declare them to be friends of each
+  // class.
   printer->Print(
     "\n"
     "// Internal implementation detail -- do not call these.\n"
-    "void $dllexport_decl$ $adddescriptorsname$();\n",
+    "void $dllexport_decl$ $adddescriptorsname$();\n"
+    "void $dllexport_decl$ $initdefaultsname$();\n",
     "adddescriptorsname", GlobalAddDescriptorsName(file_->name()),
+    "initdefaultsname", GlobalInitDefaultsName(file_->name()),
     "dllexport_decl", dllexport_decl_);
 
   printer->Print(
     // Note that we don't put dllexport_decl on these because they are only
     // called by the .pb.cc file in which they are defined.
+    "void $initdefaultsname$_impl();\n"
     "void $assigndescriptorsname$();\n"
     "void $shutdownfilename$();\n"
     "\n",
+    "initdefaultsname", GlobalInitDefaultsName(file_->name()),
     "assigndescriptorsname", GlobalAssignDescriptorsName(file_->name()),
     "shutdownfilename", GlobalShutdownFileName(file_->name()));
 
@@ -300,6 +320,11 @@ void FileGenerator::GenerateSource(io::Printer* printer) {
       "#include <google/protobuf/wire_format.h>\n");
   }
 
+  if (UseTableDrivenParsing(file_)) {
+    printer->Print(
+      "#include <google/protobuf/generated_message_table_driven.h>\n");
+  }
+
   printer->Print(
     "// @@protoc_insertion_point(includes)\n");
 
@@ -333,6 +358,20 @@ void FileGenerator::GenerateSource(io::Printer* printer) {
       "\n");
   }
 
+  if (UseTableDrivenParsing(file_)) {
+    printer->Print(
+      "\n"
+      "namespace {\n"
+      "\n");
+    for (int i = 0; i < file_->message_type_count(); i++) {
+      message_generators_[i]->GenerateParseTableDeclarations(printer);
+    }
+    printer->Print(
+      "\n"
+      "}  // namespace\n"
+      "\n");
+  }
+
   // Define our externally-visible BuildDescriptors() function.  (For the lite
   // library, all this does is initialize default instances.)
   GenerateBuildDescriptors(printer);
@@ -381,8 +420,16 @@ void FileGenerator::GenerateBuildDescriptors(io::Printer* printer) {
   // FileDescriptorProto for this .proto file to the global DescriptorPool
   // for generated files (DescriptorPool::generated_pool()).  It always runs
   // at static initialization time, so all files will be registered before
-  // main() starts.  This procedure also constructs default instances and
-  // registers extensions.
+  // main() starts.  Since every file linked into a binary pays for it before
+  // main(), it does no more than hand over pointers:  the pool does not even
+  // parse the bytes until it is asked for something they define.
+  //
+  // InitDefaults() constructs the default instances, builds the parse tables
+  // and registers the extensions.  It is called the first time anyone calls
+  // default_instance() on one of the types defined in the file, or parses
+  // one of them.  A file which defines extensions also hands InitDefaults()
+  // to ExtensionSet from AddDescriptors(), so that the extensions are
+  // registered before a parser needs them.
   //
   // Its sibling, AssignDescriptors(), actually pulls the compiled
   // FileDescriptor from the DescriptorPool and uses it to populate all of
@@ -392,7 +439,7 @@ void FileGenerator::GenerateBuildDescriptors(io::Printer* printer) {
   // in the file.
 
   // In optimize_for = LITE_RUNTIME mode, we don't generate AssignDescriptors()
-  // and we only use AddDescriptors() to allocate default instances.
+  // and AddDescriptors() only checks the version and hands over extensions.
   if (HasDescriptorMethods(file_)) {
     printer->Print(
       "\n"
@@ -408,6 +455,11 @@ void FileGenerator::GenerateBuildDescriptors(io::Printer* printer) {
       "$adddescriptorsname$();\n",
       "adddescriptorsname", GlobalAddDescriptorsName(file_->name()));
 
+    // The reflection objects point at the default instances.
+    printer->Print(
+      "$initdefaultsname$();\n",
+      "initdefaultsname", GlobalInitDefaultsName(file_->name()));
+
     // Get the file's descriptor from the pool.
     printer->Print(
       "const ::google::protobuf::FileDescriptor* file =\n"
@@ -490,6 +542,72 @@ void FileGenerator::GenerateBuildDescriptors(io::Printer* printer) {
 
   // -----------------------------------------------------------------
 
+  // Now generate the InitDefaults() function.  Its body goes in a separate
+  // _impl() function, which the message classes befriend, and which runs
+  // only once.
+  printer->Print(
+    "\n"
+    "void $initdefaultsname$_impl() {\n",
+    "initdefaultsname", GlobalInitDefaultsName(file_->name()));
+  printer->Indent();
+
+  // Our default instances may point at those of our dependencies, and our
+  // extensions at their types.
+  for (int i = 0; i < file_->dependency_count(); i++) {
+    PrintDependencyFunctionCall(printer, file_->dependency(i),
+                                GlobalInitDefaultsName);
+  }
+
+  // Allocate and initialize default instances.  Speaking of which, we also
+  // register extensions at this time.
+  for (int i = 0; i < file_->message_type_count(); i++) {
+    message_generators_[i]->GenerateDefaultInstanceAllocator(printer);
+  }
+  for (int i = 0; i < file_->extension_count(); i++) {
+    extension_generators_[i]->GenerateRegistration(printer);
+  }
+  for (int i = 0; i < file_->message_type_count(); i++) {
+    message_generators_[i]->GenerateDefaultInstanceInitializer(printer);
+  }
+
+  // Parse tables point at default instances, so they come last.
+  if (UseTableDrivenParsing(file_)) {
+    for (int i = 0; i < file_->message_type_count(); i++) {
+      message_generators_[i]->GenerateParseTableInitializer(printer);
+    }
+  }
+
+  printer->Print(
+    "::google::protobuf::internal::OnShutdown(&$shutdownfilename$);\n",
+    "shutdownfilename", GlobalShutdownFileName(file_->name()));
+
+  printer->Outdent();
+  printer->Print(
+    "}\n"
+    "\n"
+    "namespace {\n"
+    "\n"
+    "GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_InitDefaults_once_);\n"
+    "// Set once the defaults are built, so that default_instance() and the\n"
+    "// other callers on hot paths can skip the once.\n"
+    "::google::protobuf::internal::Atomic32 protobuf_InitDefaults_done_ = 0;\n"
+    "\n"
+    "}  // namespace\n"
+    "\n"
+    "void $initdefaultsname$() {\n"
+    "  if (::google::protobuf::internal::Acquire_Load(\n"
+    "          &protobuf_InitDefaults_done_) != 0) {\n"
+    "    return;\n"
+    "  }\n"
+    "  ::google::protobuf::GoogleOnceInit(&protobuf_InitDefaults_once_,\n"
+    "                 &$initdefaultsname$_impl);\n"
+    "  ::google::protobuf::internal::Release_Store(\n"
+    "      &protobuf_InitDefaults_done_, 1);\n"
+    "}\n",
+    "initdefaultsname", GlobalInitDefaultsName(file_->name()));
+
+  // -----------------------------------------------------------------
+
   // Now generate the AddDescriptors() function.
   printer->Print(
     "\n"
@@ -507,25 +625,14 @@ void FileGenerator::GenerateBuildDescriptors(io::Printer* printer) {
   // Call the AddDescriptors() methods for all of our dependencies, to make
   // sure they get added first.
   for (int i = 0; i < file_->dependency_count(); i++) {
-    const FileDescriptor* dependency = file_->dependency(i);
-    // Print the namespace prefix for the dependency.
-    vector<string> dependency_package_parts;
-    SplitStringUsing(dependency->package(), ".", &dependency_package_parts);
-    printer->Print("::");
-    for (int i = 0; i < dependency_package_parts.size(); i++) {
-      printer->Print("$name$::",
-                     "name", dependency_package_parts[i]);
-    }
-    // Call its AddDescriptors function.
-    printer->Print(
-      "$name$();\n",
-      "name", GlobalAddDescriptorsName(dependency->name()));
+    PrintDependencyFunctionCall(printer, file_->dependency(i),
+                                GlobalAddDescriptorsName);
   }
 
   if (HasDescriptorMethods(file_)) {
     // Embed the descriptor.  We simply serialize the entire FileDescriptorProto
     // and embed it as a string literal, which is parsed and built into real
-    // descriptors at initialization time.
+    // descriptors when they are first needed.
     FileDescriptorProto file_proto;
     file_->CopyTo(&file_proto);
     string file_data;
@@ -551,23 +658,15 @@ void FileGenerator::GenerateBuildDescriptors(io::Printer* printer) {
       "filename", file_->name());
   }
 
-  // Allocate and initialize default instances.  This can't be done lazily
-  // since default instances are returned by simple accessors and are used with
-  // extensions.  Speaking of which, we also register extensions at this time.
-  for (int i = 0; i < file_->message_type_count(); i++) {
-    message_generators_[i]->GenerateDefaultInstanceAllocator(printer);
-  }
-  for (int i = 0; i < file_->extension_count(); i++) {
-    extension_generators_[i]->GenerateRegistration(printer);
-  }
-  for (int i = 0; i < file_->message_type_count(); i++) {
-    message_generators_[i]->GenerateDefaultInstanceInitializer(printer);
+  // Parsing an extendee looks its extensions up by number, so they must be
+  // registered by then even if nothing in this file has been used yet.
+  if (HasExtensions(file_)) {
+    printer->Print(
+      "::google::protobuf::internal::ExtensionSet::RegisterDeferredExtensions(\n"
+      "  &$initdefaultsname$);\n",
+      "initdefaultsname", GlobalInitDefaultsName(file_->name()));
   }
 
-  printer->Print(
-    "::google::protobuf::internal::OnShutdown(&$shutdownfilename$);\n",
-    "shutdownfilename", GlobalShutdownFileName(file_->name()));
-
   printer->Outdent();
 
   printer->Print(
@@ -584,6 +683,22 @@ void FileGenerator::GenerateBuildDescriptors(io::Printer* printer) {
     "filename", FilenameIdentifier(file_->name()));
 }
 
+void FileGenerator::PrintDependencyFunctionCall(
+    io::Printer* printer, const FileDescriptor* dependency,
+    string (*function_name)(const string& filename)) {
+  // Print the namespace prefix for the dependency.
+  vector<string> dependency_package_parts;
+  SplitStringUsing(dependency->package(), ".", &dependency_package_parts);
+  printer->Print("::");
+  for (int i = 0; i < dependency_package_parts.size(); i++) {
+    printer->Print("$name$::",
+                   "name", dependency_package_parts[i]);
+  }
+  printer->Print(
+    "$name$();\n",
+    "name", function_name(dependency->name()));
+}
+
 void FileGenerator::GenerateNamespaceOpeners(io::Printer* printer) {
   if (package_parts_.size() > 0) printer->Print("\n");
 
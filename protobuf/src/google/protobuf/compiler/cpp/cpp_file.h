@@ -72,6 +72,12 @@ class FileGenerator {
   // for types defined in the file.
   void GenerateBuildDescriptors(io::Printer* printer);
 
+  // Prints a call to one of the per-file functions (e.g. AddDescriptors())
+  // of the given dependency, qualified with its namespace.
+  void PrintDependencyFunctionCall(
+      io::Printer* printer, const FileDescriptor* dependency,
+      string (*function_name)(const string& filename));
+
   void GenerateNamespaceOpeners(io::Printer* printer);
   void GenerateNamespaceClosers(io::Printer* printer);
 
@@ -330,11 +330,68 @@ string GlobalAssignDescriptorsName(const string& filename) {
   return "protobuf_AssignDesc_" + FilenameIdentifier(filename);
 }
 
+// Return the name of the InitDefaults() function for a given file.
+string GlobalInitDefaultsName(const string& filename) {
+  return "protobuf_InitDefaults_" + FilenameIdentifier(filename);
+}
+
 // Return the name of the ShutdownFile() function for a given file.
 string GlobalShutdownFileName(const string& filename) {
   return "protobuf_ShutdownFile_" + FilenameIdentifier(filename);
 }
 
+namespace {
+
+bool HasExtensions(const Descriptor* descriptor) {
+  if (descriptor->extension_count() > 0) return true;
+  for (int i = 0; i < descriptor->nested_type_count(); i++) {
+    if (HasExtensions(descriptor->nested_type(i))) return true;
+  }
+  return false;
+}
+
+bool IsStringPiece(const FieldDescriptor* field) {
+  return field->cpp_type() == FieldDescriptor::CPPTYPE_STRING &&
+         field->options().ctype() == FieldOptions::STRING_PIECE;
+}
+
+bool HasFieldMatching(const Descriptor* descriptor,
+                      bool (*predicate)(const FieldDescriptor*)) {
+  for (int i = 0; i < descriptor->field_count(); i++) {
+    if (predicate(descriptor->field(i))) return true;
+  }
+  for (int i = 0; i < descriptor->nested_type_count(); i++) {
+    if (HasFieldMatching(descriptor->nested_type(i), predicate)) return true;
+  }
+  return false;
+}
+
+bool HasFieldMatching(const FileDescriptor* file,
+                      bool (*predicate)(const FieldDescriptor*)) {
+  for (int i = 0; i < file->message_type_count(); i++) {
+    if (HasFieldMatching(file->message_type(i), predicate)) return true;
+  }
+  return false;
+}
+
+}  // namespace
+
+bool HasStringPieceFields(const FileDescriptor* file) {
+  return HasFieldMatching(file, &IsStringPiece);
+}
+
+bool HasLazyFields(const FileDescriptor* file) {
+  return HasFieldMatching(file, &IsLazy);
+}
+
+bool HasExtensions(const FileDescriptor* file) {
+  if (file->extension_count() > 0) return true;
+  for (int i = 0; i < file->message_type_count(); i++) {
+    if (HasExtensions(file->message_type(i))) return true;
+  }
+  return false;
+}
+
 }  // namespace cpp
 }  // namespace compiler
 }  // namespace protobuf
@@ -109,9 +109,30 @@ string GlobalAddDescriptorsName(const string& filename);
 // Return the name of the AssignDescriptors() function for a given file.
 string GlobalAssignDescriptorsName(const string& filename);
 
+// Return the name of the InitDefaults() function for a given file.
+string GlobalInitDefaultsName(const string& filename);
+
 // Return the name of the ShutdownFile() function for a given file.
 string GlobalShutdownFileName(const string& filename);
 
+// Does any message in this file have a [ctype=STRING_PIECE] field?
+// (Extensions don't count; they are always stored as strings.)
+bool HasStringPieceFields(const FileDescriptor* file);
+
+// Is this field stored as a LazyField?  The lazy option is only honored for
+// singular, non-extension fields of message (not group) type.
+inline bool IsLazy(const FieldDescriptor* field) {
+  return field->options().lazy() &&
+         field->type() == FieldDescriptor::TYPE_MESSAGE &&
+         !field->is_repeated() && !field->is_extension();
+}
+
+// Does any message in this file have a lazy field?
+bool HasLazyFields(const FileDescriptor* file);
+
+// Does this file define any extensions, at file scope or nested in messages?
+bool HasExtensions(const FileDescriptor* file);
+
 // Do message classes in this file keep track of unknown fields?
 inline bool HasUnknownFields(const FileDescriptor *file) {
   return file->options().optimize_for() != FileOptions::LITE_RUNTIME;
@@ -147,6 +168,26 @@ inline bool HasFastArraySerialization(const FileDescriptor* file) {
   return file->options().optimize_for() == FileOptions::SPEED;
 }
 
+// Can message classes in this file be allocated on an Arena, taking their
+// strings, sub-messages and repeated fields along with them?
+inline bool SupportsArenas(const FileDescriptor* file) {
+  return file->options().cc_enable_arenas();
+}
+
+// Should message classes in this file parse using a ParseTable rather than
+// with generated MergePartialFromCodedStream() code?
+inline bool UseTableDrivenParsing(const FileDescriptor* file) {
+  return HasGeneratedMethods(file) &&
+         file->options().cc_table_driven_parsing();
+}
+
+// Should message classes in this file keep the unknown fields they parse in
+// serialized form?
+inline bool UseRawUnknownFields(const FileDescriptor* file) {
+  return HasDescriptorMethods(file) &&
+         file->options().cc_raw_unknown_fields();
+}
+
 
 }  // namespace cpp
 }  // namespace compiler
@@ -81,6 +81,30 @@ const char* kWireTypeNames[] = {
   "FIXED32",
 };
 
+// Names of the WireFormatLite::FieldType constants, indexed by
+// FieldDescriptor::Type (the two enums use the same numbers).
+const char* kFieldTypeNames[] = {
+  NULL,
+  "DOUBLE",
+  "FLOAT",
+  "INT64",
+  "UINT64",
+  "INT32",
+  "FIXED64",
+  "FIXED32",
+  "BOOL",
+  "STRING",
+  "GROUP",
+  "MESSAGE",
+  "BYTES",
+  "UINT32",
+  "ENUM",
+  "SFIXED32",
+  "SFIXED64",
+  "SINT32",
+  "SINT64",
+};
+
 // Sort the fields of the given Descriptor by number into a new[]'d array
 // and return it.
 const FieldDescriptor** SortFieldsByNumber(const Descriptor* descriptor) {
@@ -327,6 +351,16 @@ GenerateClassDefinition(io::Printer* printer) {
     "}\n"
     "\n");
 
+  if (SupportsArenas(descriptor_->file())) {
+    printer->Print(vars,
+      "explicit $classname$(::google::protobuf::Arena* arena);\n"
+      "inline ::google::protobuf::Arena* GetArena() const { return _arena_; }\n"
+      "$classname$* NewOnArena(::google::protobuf::Arena* arena) const;\n"
+      "// Tells Arena::CreateMessage() to use the constructor above.\n"
+      "typedef void InternalArenaConstructable_;\n"
+      "\n");
+  }
+
   if (HasUnknownFields(descriptor_->file())) {
     printer->Print(
       "inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {\n"
@@ -348,6 +382,12 @@ GenerateClassDefinition(io::Printer* printer) {
 
   printer->Print(vars,
     "static const $classname$& default_instance();\n"
+    "\n"
+    "// Like default_instance(), but does not make sure that the default\n"
+    "// instance has been constructed.  Only for generated code which has.\n"
+    "static inline const $classname$* internal_default_instance() {\n"
+    "  return default_instance_;\n"
+    "}\n"
     "\n");
 
 
@@ -386,7 +426,9 @@ GenerateClassDefinition(io::Printer* printer) {
   }
 
   printer->Print(vars,
-    "int GetCachedSize() const { return _cached_size_; }\n"
+    "int GetCachedSize() const {\n"
+    "  return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);\n"
+    "}\n"
     "private:\n"
     "void SharedCtor();\n"
     "void SharedDtor();\n"
@@ -449,6 +491,13 @@ GenerateClassDefinition(io::Printer* printer) {
   printer->Print(" private:\n");
   printer->Indent();
 
+  // _arena_ must be declared before the repeated fields, which are
+  // constructed with it.
+  if (SupportsArenas(descriptor_->file())) {
+    printer->Print(
+      "::google::protobuf::Arena* _arena_;\n");
+  }
+
   if (descriptor_->extension_range_count() > 0) {
     printer->Print(
       "::google::protobuf::internal::ExtensionSet _extensions_;\n");
@@ -459,29 +508,27 @@ GenerateClassDefinition(io::Printer* printer) {
       "::google::protobuf::UnknownFieldSet _unknown_fields_;\n");
   }
 
-  // TODO(kenton):  Make _cached_size_ an atomic<int> when C++ supports it.
+  // _cached_size_ is written by const methods, so it is only accessed
+  // atomically.  See SetCachedSize().
   printer->Print(
-    "mutable int _cached_size_;\n"
+    "mutable ::google::protobuf::internal::Atomic32 _cached_size_;\n"
     "\n");
   for (int i = 0; i < descriptor_->field_count(); i++) {
     field_generators_.get(descriptor_->field(i))
                      .GeneratePrivateMembers(printer);
   }
 
-  // Declare AddDescriptors(), BuildDescriptors(), and ShutdownFile() as
+  // Declare InitDefaults(), AssignDescriptors(), and ShutdownFile() as
   // friends so that they can access private static variables like
   // default_instance_ and reflection_.
   printer->Print(
-    "friend void $dllexport_decl$ $adddescriptorsname$();\n",
-    "dllexport_decl", dllexport_decl_,
-    "adddescriptorsname",
-      GlobalAddDescriptorsName(descriptor_->file()->name()));
-  printer->Print(
+    "friend void $initdefaultsname$_impl();\n"
     "friend void $assigndescriptorsname$();\n"
     "friend void $shutdownfilename$();\n"
     "\n",
     "assigndescriptorsname",
       GlobalAssignDescriptorsName(descriptor_->file()->name()),
+    "initdefaultsname", GlobalInitDefaultsName(descriptor_->file()->name()),
     "shutdownfilename", GlobalShutdownFileName(descriptor_->file()->name()));
 
   // Generate offsets and _has_bits_ boilerplate.
@@ -669,6 +716,144 @@ GenerateShutdownCode(io::Printer* printer) {
   }
 }
 
+void MessageGenerator::
+GenerateParseTableDeclarations(io::Printer* printer) {
+  // MessageSets are parsed by ExtensionSet::ParseMessageSet() instead.
+  if (!descriptor_->options().message_set_wire_format()) {
+    printer->Print(
+      "const ::google::protobuf::internal::ParseTable* $classname$_parse_table_ = NULL;\n",
+      "classname", classname_);
+  }
+
+  for (int i = 0; i < descriptor_->nested_type_count(); i++) {
+    nested_generators_[i]->GenerateParseTableDeclarations(printer);
+  }
+}
+
+void MessageGenerator::
+GenerateParseTableInitializer(io::Printer* printer) {
+  if (!descriptor_->options().message_set_wire_format()) {
+    map<string, string> vars;
+    vars["classname"] = classname_;
+    vars["field_count"] = SimpleItoa(descriptor_->field_count());
+    vars["range_count"] = SimpleItoa(descriptor_->extension_range_count());
+
+    // The interpreter relies on the fields being sorted by number.
+    if (descriptor_->field_count() > 0) {
+      printer->Print(vars,
+        "static const ::google::protobuf::internal::ParseTableField\n"
+        "    $classname$_parse_table_fields_[] = {\n");
+      printer->Indent();
+
+      scoped_array<const FieldDescriptor*> ordered_fields(
+        SortFieldsByNumber(descriptor_));
+
+      for (int i = 0; i < descriptor_->field_count(); i++) {
+        const FieldDescriptor* field = ordered_fields[i];
+
+        vars["tag"] = SimpleItoa(WireFormat::MakeTag(field));
+        vars["name"] = FieldName(field);
+        vars["has_bit"] =
+          field->is_repeated() ? "-1" : SimpleItoa(field->index());
+        vars["type"] = kFieldTypeNames[field->type()];
+        vars["repeated"] = field->is_repeated() ? "true" : "false";
+        vars["packed"] = field->options().packed() ? "true" : "false";
+        vars["verify_utf8"] =
+          HasUtf8Verification(descriptor_->file()) &&
+          field->type() == FieldDescriptor::TYPE_STRING ? "true" : "false";
+        bool string_piece =
+          field->cpp_type() == FieldDescriptor::CPPTYPE_STRING &&
+          field->options().ctype() == FieldOptions::STRING_PIECE;
+        vars["string_piece"] = string_piece ? "true" : "false";
+        vars["lazy"] = IsLazy(field) ? "true" : "false";
+
+        vars["default_string"] = "NULL";
+        vars["prototype"] = "NULL";
+        vars["enum_is_valid"] = "NULL";
+        switch (field->cpp_type()) {
+          case FieldDescriptor::CPPTYPE_STRING:
+            if (!field->is_repeated() && !string_piece) {
+              vars["default_string"] = "&" + classname_ + "::_default_" +
+                                       FieldName(field) + "_";
+            }
+            break;
+          case FieldDescriptor::CPPTYPE_MESSAGE:
+            vars["prototype"] =
+              ClassName(field->message_type(), true) +
+              "::internal_default_instance()";
+            break;
+          case FieldDescriptor::CPPTYPE_ENUM:
+            vars["enum_is_valid"] =
+              "&" + ClassName(field->enum_type(), true) + "_IsValid";
+            break;
+          default:
+            break;
+        }
+
+        printer->Print(vars,
+          "{ $tag$u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET("
+            "$classname$, $name$_),\n"
+          "  $has_bit$, ::google::protobuf::internal::WireFormatLite::TYPE_$type$,\n"
+          "  $repeated$, $packed$, $verify_utf8$, $string_piece$, $lazy$,\n"
+          "  $default_string$, $prototype$, $enum_is_valid$,\n"
+          "  NULL, NULL },\n");
+      }
+
+      printer->Outdent();
+      printer->Print("};\n");
+      vars["fields"] = classname_ + "_parse_table_fields_";
+    } else {
+      vars["fields"] = "NULL";
+    }
+
+    if (descriptor_->extension_range_count() > 0) {
+      printer->Print(vars,
+        "static const int $classname$_parse_table_extension_ranges_[] = {\n");
+      for (int i = 0; i < descriptor_->extension_range_count(); i++) {
+        const Descriptor::ExtensionRange* range =
+          descriptor_->extension_range(i);
+        printer->Print(
+          "  $start$, $end$,\n",
+          "start", SimpleItoa(range->start),
+          "end", SimpleItoa(range->end));
+      }
+      printer->Print("};\n");
+      vars["ranges"] = classname_ + "_parse_table_extension_ranges_";
+      vars["extensions"] =
+        "GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(" + classname_ +
+        ", _extensions_)";
+    } else {
+      vars["ranges"] = "NULL";
+      vars["extensions"] = "-1";
+    }
+
+    if (HasUnknownFields(descriptor_->file())) {
+      vars["unknown_fields"] =
+        "GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(" + classname_ +
+        ", _unknown_fields_)";
+    } else {
+      vars["unknown_fields"] = "-1";
+    }
+
+    printer->Print(vars,
+      "static const ::google::protobuf::internal::ParseTable "
+        "$classname$_parse_table = {\n"
+      "  $fields$, $field_count$,\n"
+      "  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET("
+        "$classname$, _has_bits_[0]),\n"
+      "  $unknown_fields$,\n"
+      "  $extensions$,\n"
+      "  $ranges$, $range_count$,\n"
+      "  $classname$::default_instance_,\n"
+      "};\n"
+      "$classname$_parse_table_ = &$classname$_parse_table;\n");
+  }
+
+  for (int i = 0; i < descriptor_->nested_type_count(); i++) {
+    nested_generators_[i]->GenerateParseTableInitializer(printer);
+  }
+}
+
 void MessageGenerator::
 GenerateClassMethods(io::Printer* printer) {
   for (int i = 0; i < descriptor_->enum_type_count(); i++) {
@@ -801,6 +986,11 @@ GenerateSharedConstructorCode(io::Printer* printer) {
   printer->Print(
     "::memset(_has_bits_, 0, sizeof(_has_bits_));\n");
 
+  if (UseRawUnknownFields(descriptor_->file())) {
+    printer->Print(
+      "_unknown_fields_.set_raw_storage(true);\n");
+  }
+
   printer->Outdent();
   printer->Print("}\n\n");
 }
@@ -811,6 +1001,11 @@ GenerateSharedDestructorCode(io::Printer* printer) {
     "void $classname$::SharedDtor() {\n",
     "classname", classname_);
   printer->Indent();
+  if (SupportsArenas(descriptor_->file())) {
+    // Strings and sub-messages of an arena message belong to the arena.
+    printer->Print(
+      "if (_arena_ != NULL) return;\n");
+  }
   // Write the destructors for each field.
   for (int i = 0; i < descriptor_->field_count(); i++) {
     field_generators_.get(descriptor_->field(i))
@@ -828,7 +1023,8 @@ GenerateSharedDestructorCode(io::Printer* printer) {
     const FieldDescriptor* field = descriptor_->field(i);
 
     if (!field->is_repeated() &&
-        field->cpp_type() == FieldDescriptor::CPPTYPE_MESSAGE) {
+        field->cpp_type() == FieldDescriptor::CPPTYPE_MESSAGE &&
+        !IsLazy(field)) {
       printer->Print("  delete $name$_;\n",
                      "name", FieldName(field));
     }
@@ -848,11 +1044,38 @@ GenerateStructors(io::Printer* printer) {
   // Generate the default constructor.
   printer->Print(
     "$classname$::$classname$()\n"
-    "  : $superclass$() {\n"
+    "  : $superclass$()$arena_initializer$ {\n"
     "  SharedCtor();\n"
     "}\n",
     "classname", classname_,
-    "superclass", superclass);
+    "superclass", superclass,
+    "arena_initializer", SupportsArenas(descriptor_->file()) ?
+                         ",\n    _arena_(NULL)" : "");
+
+  if (SupportsArenas(descriptor_->file())) {
+    // Generate the arena constructor.  Repeated fields need to know the
+    // arena before anything is added to them, so they are constructed with
+    // it here rather than in SharedCtor().
+    printer->Print(
+      "\n"
+      "$classname$::$classname$(::google::protobuf::Arena* arena)\n"
+      "  : $superclass$(),\n"
+      "    _arena_(arena)",
+      "classname", classname_,
+      "superclass", superclass);
+    for (int i = 0; i < descriptor_->field_count(); i++) {
+      const FieldDescriptor* field = descriptor_->field(i);
+      if (field->is_repeated()) {
+        printer->Print(",\n"
+                       "    $name$_(arena)",
+                       "name", FieldName(field));
+      }
+    }
+    printer->Print(
+      " {\n"
+      "  SharedCtor();\n"
+      "}\n");
+  }
 
   printer->Print(
     "\n"
@@ -869,9 +1092,11 @@ GenerateStructors(io::Printer* printer) {
     const FieldDescriptor* field = descriptor_->field(i);
 
     if (!field->is_repeated() &&
-        field->cpp_type() == FieldDescriptor::CPPTYPE_MESSAGE) {
+        field->cpp_type() == FieldDescriptor::CPPTYPE_MESSAGE &&
+        !IsLazy(field)) {
       printer->Print(
-          "  $name$_ = const_cast< $type$*>(&$type$::default_instance());\n",
+          "  $name$_ = const_cast< $type$*>(\n"
+          "      $type$::internal_default_instance());\n",
           "name", FieldName(field),
           "type", FieldMessageTypeName(field));
     }
@@ -883,13 +1108,15 @@ GenerateStructors(io::Printer* printer) {
   // Generate the copy constructor.
   printer->Print(
     "$classname$::$classname$(const $classname$& from)\n"
-    "  : $superclass$() {\n"
+    "  : $superclass$()$arena_initializer$ {\n"
     "  SharedCtor();\n"
     "  MergeFrom(from);\n"
     "}\n"
     "\n",
     "classname", classname_,
-    "superclass", superclass);
+    "superclass", superclass,
+    "arena_initializer", SupportsArenas(descriptor_->file()) ?
+                         ",\n    _arena_(NULL)" : "");
 
   // Generate the shared constructor code.
   GenerateSharedConstructorCode(printer);
@@ -908,9 +1135,7 @@ GenerateStructors(io::Printer* printer) {
   // Generate SetCachedSize.
   printer->Print(
     "void $classname$::SetCachedSize(int size) const {\n"
-    "  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();\n"
-    "  _cached_size_ = size;\n"
-    "  GOOGLE_SAFE_CONCURRENT_WRITES_END();\n"
+    "  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);\n"
     "}\n",
     "classname", classname_);
 
@@ -923,14 +1148,15 @@ GenerateStructors(io::Printer* printer) {
       "  return $classname$_descriptor_;\n"
       "}\n"
       "\n",
-      "classname", classname_,
-      "adddescriptorsname",
-      GlobalAddDescriptorsName(descriptor_->file()->name()));
+      "classname", classname_);
   }
 
   printer->Print(
     "const $classname$& $classname$::default_instance() {\n"
-    "  if (default_instance_ == NULL) $adddescriptorsname$();"
+    "  if (::google::protobuf::internal::Acquire_Load(\n"
+    "          &protobuf_InitDefaults_done_) == 0) {\n"
+    "    $initdefaultsname$();\n"
+    "  }\n"
     "  return *default_instance_;\n"
     "}\n"
     "\n"
@@ -940,9 +1166,17 @@ GenerateStructors(io::Printer* printer) {
     "  return new $classname$;\n"
     "}\n",
     "classname", classname_,
-    "adddescriptorsname",
-    GlobalAddDescriptorsName(descriptor_->file()->name()));
+    "initdefaultsname", GlobalInitDefaultsName(descriptor_->file()->name()));
 
+  if (SupportsArenas(descriptor_->file())) {
+    printer->Print(
+      "\n"
+      "$classname$* $classname$::NewOnArena(\n"
+      "    ::google::protobuf::Arena* arena) const {\n"
+      "  return ::google::protobuf::Arena::CreateMessage<$classname$>(arena);\n"
+      "}\n",
+      "classname", classname_);
+  }
 }
 
 void MessageGenerator::
@@ -1039,6 +1273,20 @@ GenerateSwap(io::Printer* printer) {
   printer->Indent();
 
   if (HasGeneratedMethods(descriptor_->file())) {
+    if (SupportsArenas(descriptor_->file())) {
+      // Pointers can only be exchanged between messages that share an
+      // arena; otherwise, swap by copying.
+      printer->Print(
+        "if (GetArena() != other->GetArena()) {\n"
+        "  $classname$ temp;\n"
+        "  temp.MergeFrom(*this);\n"
+        "  CopyFrom(*other);\n"
+        "  other->CopyFrom(temp);\n"
+        "  return;\n"
+        "}\n",
+        "classname", classname_);
+    }
+
     for (int i = 0; i < descriptor_->field_count(); i++) {
       const FieldDescriptor* field = descriptor_->field(i);
       field_generators_.get(field).GenerateSwappingCode(printer);
@@ -1215,13 +1463,32 @@ GenerateMergeFromCodedStream(io::Printer* printer) {
     printer->Print(
       "bool $classname$::MergePartialFromCodedStream(\n"
       "    ::google::protobuf::io::CodedInputStream* input) {\n"
-      "  return _extensions_.ParseMessageSet(input, default_instance_,\n"
+      "  return _extensions_.ParseMessageSet(input, &default_instance(),\n"
       "                                      mutable_unknown_fields());\n"
       "}\n",
       "classname", classname_);
     return;
   }
 
+  if (UseTableDrivenParsing(descriptor_->file())) {
+    // Everything is described by the table built in InitDefaults().
+    printer->Print(
+      "bool $classname$::MergePartialFromCodedStream(\n"
+      "    ::google::protobuf::io::CodedInputStream* input) {\n"
+      "  if (::google::protobuf::internal::Acquire_Load(\n"
+      "          &protobuf_InitDefaults_done_) == 0) {\n"
+      "    $initdefaultsname$();\n"
+      "  }\n"
+      "  return ::google::protobuf::internal::$function$(\n"
+      "      this, *$classname$_parse_table_, input);\n"
+      "}\n",
+      "classname", classname_,
+      "initdefaultsname", GlobalInitDefaultsName(descriptor_->file()->name()),
+      "function", HasUnknownFields(descriptor_->file()) ?
+        "MergePartialFromCodedStream" : "MergePartialFromCodedStreamLite");
+    return;
+  }
+
   printer->Print(
     "bool $classname$::MergePartialFromCodedStream(\n"
     "    ::google::protobuf::io::CodedInputStream* input) {\n"
@@ -1379,11 +1646,11 @@ GenerateMergeFromCodedStream(io::Printer* printer) {
     printer->Print(") {\n");
     if (HasUnknownFields(descriptor_->file())) {
       printer->Print(
-        "  DO_(_extensions_.ParseField(tag, input, default_instance_,\n"
+        "  DO_(_extensions_.ParseField(tag, input, &default_instance(),\n"
         "                              mutable_unknown_fields()));\n");
     } else {
       printer->Print(
-        "  DO_(_extensions_.ParseField(tag, input, default_instance_));\n");
+        "  DO_(_extensions_.ParseField(tag, input, &default_instance()));\n");
     }
     printer->Print(
       "  continue;\n"
@@ -1595,9 +1862,8 @@ GenerateByteSize(io::Printer* printer) {
         "      ComputeUnknownMessageSetItemsSize(unknown_fields());\n");
     }
     printer->Print(
-      "  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();\n"
-      "  _cached_size_ = total_size;\n"
-      "  GOOGLE_SAFE_CONCURRENT_WRITES_END();\n"
+      "  ::google::protobuf::internal::NoBarrier_Store(\n"
+      "      &_cached_size_, total_size);\n"
       "  return total_size;\n"
       "}\n");
     return;
@@ -1683,15 +1949,14 @@ GenerateByteSize(io::Printer* printer) {
     printer->Print("}\n");
   }
 
-  // We update _cached_size_ even though this is a const method.  In theory,
-  // this is not thread-compatible, because concurrent writes have undefined
-  // results.  In practice, since any concurrent writes will be writing the
-  // exact same value, it works on all common processors.  In a future version
-  // of C++, _cached_size_ should be made into an atomic<int>.
+  // We update _cached_size_ even though this is a const method, so that
+  // several threads may serialize the same message at once.  The store is
+  // atomic but unordered:  concurrent writers all store the exact same value,
+  // and each thread reads back the sizes it computed itself (or identical
+  // ones), so no ordering with other memory is needed.
   printer->Print(
-    "GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();\n"
-    "_cached_size_ = total_size;\n"
-    "GOOGLE_SAFE_CONCURRENT_WRITES_END();\n"
+    "::google::protobuf::internal::NoBarrier_Store(\n"
+    "    &_cached_size_, total_size);\n"
     "return total_size;\n");
 
   printer->Outdent();
@@ -1741,6 +2006,13 @@ GenerateIsInitialized(io::Printer* printer) {
           "  if (!this->$name$(i).IsInitialized()) return false;\n"
           "}\n",
           "name", FieldName(field));
+      } else if (IsLazy(field)) {
+        // Asking the LazyField itself avoids parsing its retained bytes.
+        printer->Print(
+          "if (has_$name$()) {\n"
+          "  if (!$name$_.IsInitialized()) return false;\n"
+          "}\n",
+          "name", FieldName(field));
       } else {
         printer->Print(
           "if (has_$name$()) {\n"
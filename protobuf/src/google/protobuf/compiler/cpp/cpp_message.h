@@ -102,6 +102,15 @@ class MessageGenerator {
   // allocated before any can be initialized.
   void GenerateDefaultInstanceInitializer(io::Printer* printer);
 
+  // Generate code which declares the global pointers to the parse tables of
+  // this message and its nested types.  Only used if UseTableDrivenParsing().
+  void GenerateParseTableDeclarations(io::Printer* printer);
+
+  // Generates code that builds the parse tables of this message and its
+  // nested types.  Must run after all default instances are initialized,
+  // since the tables point at the default instances of sub-message types.
+  void GenerateParseTableInitializer(io::Printer* printer);
+
   // Generates code that should be run when ShutdownProtobufLibrary() is called,
   // to delete all dynamically-allocated objects.
   void GenerateShutdownCode(io::Printer* printer);
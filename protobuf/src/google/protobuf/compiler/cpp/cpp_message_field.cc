@@ -52,6 +52,10 @@ void SetMessageVariables(const FieldDescriptor* descriptor,
       (HasFastArraySerialization(descriptor->message_type()->file()) ?
        "MaybeToArray" :
        "");
+  (*variables)["new_message"] = SupportsArenas(descriptor->file()) ?
+      "::google::protobuf::Arena::CreateMessage< " +
+          (*variables)["type"] + " >(_arena_)" :
+      "new " + (*variables)["type"];
 }
 
 }  // namespace
@@ -82,11 +86,11 @@ void MessageFieldGenerator::
 GenerateInlineAccessorDefinitions(io::Printer* printer) const {
   printer->Print(variables_,
     "inline const $type$& $classname$::$name$() const {\n"
-    "  return $name$_ != NULL ? *$name$_ : *default_instance_->$name$_;\n"
+    "  return $name$_ != NULL ? *$name$_ : $type$::default_instance();\n"
     "}\n"
     "inline $type$* $classname$::mutable_$name$() {\n"
     "  _set_bit($index$);\n"
-    "  if ($name$_ == NULL) $name$_ = new $type$;\n"
+    "  if ($name$_ == NULL) $name$_ = $new_message$;\n"
     "  return $name$_;\n"
     "}\n");
 }
@@ -151,6 +155,102 @@ GenerateByteSize(io::Printer* printer) const {
 
 // ===================================================================
 
+LazyMessageFieldGenerator::
+LazyMessageFieldGenerator(const FieldDescriptor* descriptor)
+  : descriptor_(descriptor) {
+  SetMessageVariables(descriptor, &variables_);
+}
+
+LazyMessageFieldGenerator::~LazyMessageFieldGenerator() {}
+
+void LazyMessageFieldGenerator::
+GeneratePrivateMembers(io::Printer* printer) const {
+  printer->Print(variables_,
+    "::google::protobuf::internal::LazyField $name$_;\n");
+}
+
+void LazyMessageFieldGenerator::
+GenerateAccessorDeclarations(io::Printer* printer) const {
+  printer->Print(variables_,
+    "inline const $type$& $name$() const$deprecation$;\n"
+    "inline $type$* mutable_$name$()$deprecation$;\n");
+}
+
+void LazyMessageFieldGenerator::
+GenerateInlineAccessorDefinitions(io::Printer* printer) const {
+  printer->Print(variables_,
+    "inline const $type$& $classname$::$name$() const {\n"
+    "  return static_cast<const $type$&>(\n"
+    "      $name$_.Get($type$::default_instance()));\n"
+    "}\n"
+    "inline $type$* $classname$::mutable_$name$() {\n"
+    "  _set_bit($index$);\n"
+    "  return static_cast< $type$*>(\n"
+    "      $name$_.Mutable($type$::default_instance()));\n"
+    "}\n");
+}
+
+void LazyMessageFieldGenerator::
+GenerateClearingCode(io::Printer* printer) const {
+  printer->Print(variables_, "$name$_.Clear();\n");
+}
+
+void LazyMessageFieldGenerator::
+GenerateMergingCode(io::Printer* printer) const {
+  printer->Print(variables_,
+    "_set_bit($index$);\n"
+    "$name$_.MergeFrom(from.$name$_, $type$::default_instance());\n");
+}
+
+void LazyMessageFieldGenerator::
+GenerateSwappingCode(io::Printer* printer) const {
+  printer->Print(variables_, "$name$_.Swap(&other->$name$_);\n");
+}
+
+void LazyMessageFieldGenerator::
+GenerateConstructorCode(io::Printer* printer) const {
+  // LazyField's constructor leaves it empty.
+}
+
+void LazyMessageFieldGenerator::
+GenerateMergeFromCodedStream(io::Printer* printer) const {
+  printer->Print(variables_,
+    "_set_bit($index$);\n"
+    "DO_($name$_.MergeFromCodedStream(input));\n");
+}
+
+void LazyMessageFieldGenerator::
+GenerateSerializeWithCachedSizes(io::Printer* printer) const {
+  printer->Print(variables_,
+    "::google::protobuf::internal::WireFormatLite::WriteTag(\n"
+    "  $number$,\n"
+    "  ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,\n"
+    "  output);\n"
+    "$name$_.SerializeWithCachedSizes(output);\n");
+}
+
+void LazyMessageFieldGenerator::
+GenerateSerializeWithCachedSizesToArray(io::Printer* printer) const {
+  printer->Print(variables_,
+    "target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(\n"
+    "  $number$,\n"
+    "  ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,\n"
+    "  target);\n"
+    "target = $name$_.SerializeWithCachedSizesToArray(target);\n");
+}
+
+void LazyMessageFieldGenerator::
+GenerateByteSize(io::Printer* printer) const {
+  printer->Print(variables_,
+    "{\n"
+    "  int size = $name$_.ByteSize();\n"
+    "  total_size += $tag_size$ +\n"
+    "    ::google::protobuf::io::CodedOutputStream::VarintSize32(size) + size;\n"
+    "}\n");
+}
+
+// ===================================================================
+
 RepeatedMessageFieldGenerator::
 RepeatedMessageFieldGenerator(const FieldDescriptor* descriptor)
   : descriptor_(descriptor) {
@@ -210,8 +210,10 @@ GeneratePrivateMembers(io::Printer* printer) const {
   printer->Print(variables_,
     "::google::protobuf::RepeatedField< $type$ > $name$_;\n");
   if (descriptor_->options().packed() && HasGeneratedMethods(descriptor_->file())) {
+    // Like _cached_size_, this is written by the const ByteSize(), so it is
+    // only accessed atomically.
     printer->Print(variables_,
-      "mutable int _$name$_cached_byte_size_;\n");
+      "mutable ::google::protobuf::internal::Atomic32 _$name$_cached_byte_size_;\n");
   }
 }
 
@@ -297,7 +299,8 @@ GenerateSerializeWithCachedSizes(io::Printer* printer) const {
           "$number$, "
           "::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, "
           "output);\n"
-      "  output->WriteVarint32(_$name$_cached_byte_size_);\n"
+      "  output->WriteVarint32(\n"
+      "      ::google::protobuf::internal::NoBarrier_Load(&_$name$_cached_byte_size_));\n"
       "}\n");
   }
   printer->Print(variables_,
@@ -325,7 +328,8 @@ GenerateSerializeWithCachedSizesToArray(io::Printer* printer) const {
       "    ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,\n"
       "    target);\n"
       "  target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(\n"
-      "    _$name$_cached_byte_size_, target);\n"
+      "    ::google::protobuf::internal::NoBarrier_Load(&_$name$_cached_byte_size_),\n"
+      "    target);\n"
       "}\n");
   }
   printer->Print(variables_,
@@ -366,7 +370,8 @@ GenerateByteSize(io::Printer* printer) const {
       "  total_size += $tag_size$ +\n"
       "    ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);\n"
       "}\n"
-      "_$name$_cached_byte_size_ = data_size;\n"
+      "::google::protobuf::internal::NoBarrier_Store(\n"
+      "    &_$name$_cached_byte_size_, data_size);\n"
       "total_size += data_size;\n");
   } else {
     printer->Print(variables_,
@@ -52,6 +52,9 @@ void SetStringVariables(const FieldDescriptor* descriptor,
     "\"" + CEscape(descriptor->default_value_string()) + "\"";
   (*variables)["pointer_type"] =
       descriptor->type() == FieldDescriptor::TYPE_BYTES ? "void" : "char";
+  (*variables)["new_string"] = SupportsArenas(descriptor->file()) ?
+      "::google::protobuf::Arena::Create< ::std::string>(_arena_)" :
+      "new ::std::string";
 }
 
 }  // namespace
@@ -77,12 +80,9 @@ void StringFieldGenerator::
 GenerateAccessorDeclarations(io::Printer* printer) const {
   // If we're using StringFieldGenerator for a field with a ctype, it's
   // because that ctype isn't actually implemented.  In particular, this is
-  // true of ctype=CORD and ctype=STRING_PIECE in the open source release.
-  // We aren't releasing Cord because it has too many Google-specific
-  // dependencies and we aren't releasing StringPiece because it's hardly
-  // useful outside of Google and because it would get confusing to have
-  // multiple instances of the StringPiece class in different libraries (PCRE
-  // already includes it for their C++ bindings, which came from Google).
+  // true of ctype=CORD in the open source release, since Cord has too many
+  // Google-specific dependencies.  (ctype=STRING_PIECE is handled by
+  // StringPieceFieldGenerator.)
   //
   // In any case, we make all the accessors private while still actually
   // using a string to represent the field internally.  This way, we can
@@ -123,14 +123,14 @@ GenerateInlineAccessorDefinitions(io::Printer* printer) const {
     "inline void $classname$::set_$name$(const ::std::string& value) {\n"
     "  _set_bit($index$);\n"
     "  if ($name$_ == &_default_$name$_) {\n"
-    "    $name$_ = new ::std::string;\n"
+    "    $name$_ = $new_string$;\n"
     "  }\n"
     "  $name$_->assign(value);\n"
     "}\n"
     "inline void $classname$::set_$name$(const char* value) {\n"
     "  _set_bit($index$);\n"
     "  if ($name$_ == &_default_$name$_) {\n"
-    "    $name$_ = new ::std::string;\n"
+    "    $name$_ = $new_string$;\n"
     "  }\n"
     "  $name$_->assign(value);\n"
     "}\n"
@@ -138,7 +138,7 @@ GenerateInlineAccessorDefinitions(io::Printer* printer) const {
     "void $classname$::set_$name$(const $pointer_type$* value, size_t size) {\n"
     "  _set_bit($index$);\n"
     "  if ($name$_ == &_default_$name$_) {\n"
-    "    $name$_ = new ::std::string;\n"
+    "    $name$_ = $new_string$;\n"
     "  }\n"
     "  $name$_->assign(reinterpret_cast<const char*>(value), size);\n"
     "}\n"
@@ -147,7 +147,11 @@ GenerateInlineAccessorDefinitions(io::Printer* printer) const {
     "  if ($name$_ == &_default_$name$_) {\n");
   if (descriptor_->default_value_string().empty()) {
     printer->Print(variables_,
-      "    $name$_ = new ::std::string;\n");
+      "    $name$_ = $new_string$;\n");
+  } else if (SupportsArenas(descriptor_->file())) {
+    printer->Print(variables_,
+      "    $name$_ = $new_string$;\n"
+      "    $name$_->assign(_default_$name$_);\n");
   } else {
     printer->Print(variables_,
       "    $name$_ = new ::std::string(_default_$name$_);\n");
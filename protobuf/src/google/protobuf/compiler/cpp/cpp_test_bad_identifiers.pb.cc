@@ -61,6 +61,7 @@ const ::google::protobuf::ServiceDescriptor* TestConflictingMethodNames_descript
 
 void protobuf_AssignDesc_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto() {
   protobuf_AddDesc_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
+  protobuf_InitDefaults_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
   const ::google::protobuf::FileDescriptor* file =
     ::google::protobuf::DescriptorPool::generated_pool()->FindFileByName(
       "google/protobuf/compiler/cpp/cpp_test_bad_identifiers.proto");
@@ -358,6 +359,56 @@ void protobuf_ShutdownFile_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad
   delete DummyMessage_reflection_;
 }
 
+void protobuf_InitDefaults_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto_impl() {
+  TestConflictingSymbolNames::default_instance_ = new TestConflictingSymbolNames();
+  TestConflictingSymbolNames_BuildDescriptors::default_instance_ = new TestConflictingSymbolNames_BuildDescriptors();
+  TestConflictingSymbolNames_TypeTraits::default_instance_ = new TestConflictingSymbolNames_TypeTraits();
+  TestConflictingSymbolNames_Data1::default_instance_ = new TestConflictingSymbolNames_Data1();
+  TestConflictingSymbolNames_Data2::default_instance_ = new TestConflictingSymbolNames_Data2();
+  TestConflictingSymbolNames_Data3::default_instance_ = new TestConflictingSymbolNames_Data3();
+  TestConflictingSymbolNames_Data4::default_instance_ = new TestConflictingSymbolNames_Data4();
+  TestConflictingSymbolNames_Data5::default_instance_ = new TestConflictingSymbolNames_Data5();
+  TestConflictingSymbolNames_Data6::default_instance_ = new TestConflictingSymbolNames_Data6();
+  TestConflictingSymbolNames_Cord::default_instance_ = new TestConflictingSymbolNames_Cord();
+  TestConflictingSymbolNames_StringPiece::default_instance_ = new TestConflictingSymbolNames_StringPiece();
+  TestConflictingSymbolNames_DO::default_instance_ = new TestConflictingSymbolNames_DO();
+  DummyMessage::default_instance_ = new DummyMessage();
+  TestConflictingSymbolNames::default_instance_->InitAsDefaultInstance();
+  TestConflictingSymbolNames_BuildDescriptors::default_instance_->InitAsDefaultInstance();
+  TestConflictingSymbolNames_TypeTraits::default_instance_->InitAsDefaultInstance();
+  TestConflictingSymbolNames_Data1::default_instance_->InitAsDefaultInstance();
+  TestConflictingSymbolNames_Data2::default_instance_->InitAsDefaultInstance();
+  TestConflictingSymbolNames_Data3::default_instance_->InitAsDefaultInstance();
+  TestConflictingSymbolNames_Data4::default_instance_->InitAsDefaultInstance();
+  TestConflictingSymbolNames_Data5::default_instance_->InitAsDefaultInstance();
+  TestConflictingSymbolNames_Data6::default_instance_->InitAsDefaultInstance();
+  TestConflictingSymbolNames_Cord::default_instance_->InitAsDefaultInstance();
+  TestConflictingSymbolNames_StringPiece::default_instance_->InitAsDefaultInstance();
+  TestConflictingSymbolNames_DO::default_instance_->InitAsDefaultInstance();
+  DummyMessage::default_instance_->InitAsDefaultInstance();
+  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto);
+}
+
+namespace {
+
+GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_InitDefaults_once_);
+// Set once the defaults are built, so that default_instance() and the
+// other callers on hot paths can skip the once.
+::google::protobuf::internal::Atomic32 protobuf_InitDefaults_done_ = 0;
+
+}  // namespace
+
+void protobuf_InitDefaults_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto() {
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) != 0) {
+    return;
+  }
+  ::google::protobuf::GoogleOnceInit(&protobuf_InitDefaults_once_,
+                 &protobuf_InitDefaults_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto_impl);
+  ::google::protobuf::internal::Release_Store(
+      &protobuf_InitDefaults_done_, 1);
+}
+
 void protobuf_AddDesc_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto() {
   static bool already_here = false;
   if (already_here) return;
@@ -397,33 +448,6 @@ void protobuf_AddDesc_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fid
     "protobuf_unittest.DummyMessage", 1190);
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
     "google/protobuf/compiler/cpp/cpp_test_bad_identifiers.proto", &protobuf_RegisterTypes);
-  TestConflictingSymbolNames::default_instance_ = new TestConflictingSymbolNames();
-  TestConflictingSymbolNames_BuildDescriptors::default_instance_ = new TestConflictingSymbolNames_BuildDescriptors();
-  TestConflictingSymbolNames_TypeTraits::default_instance_ = new TestConflictingSymbolNames_TypeTraits();
-  TestConflictingSymbolNames_Data1::default_instance_ = new TestConflictingSymbolNames_Data1();
-  TestConflictingSymbolNames_Data2::default_instance_ = new TestConflictingSymbolNames_Data2();
-  TestConflictingSymbolNames_Data3::default_instance_ = new TestConflictingSymbolNames_Data3();
-  TestConflictingSymbolNames_Data4::default_instance_ = new TestConflictingSymbolNames_Data4();
-  TestConflictingSymbolNames_Data5::default_instance_ = new TestConflictingSymbolNames_Data5();
-  TestConflictingSymbolNames_Data6::default_instance_ = new TestConflictingSymbolNames_Data6();
-  TestConflictingSymbolNames_Cord::default_instance_ = new TestConflictingSymbolNames_Cord();
-  TestConflictingSymbolNames_StringPiece::default_instance_ = new TestConflictingSymbolNames_StringPiece();
-  TestConflictingSymbolNames_DO::default_instance_ = new TestConflictingSymbolNames_DO();
-  DummyMessage::default_instance_ = new DummyMessage();
-  TestConflictingSymbolNames::default_instance_->InitAsDefaultInstance();
-  TestConflictingSymbolNames_BuildDescriptors::default_instance_->InitAsDefaultInstance();
-  TestConflictingSymbolNames_TypeTraits::default_instance_->InitAsDefaultInstance();
-  TestConflictingSymbolNames_Data1::default_instance_->InitAsDefaultInstance();
-  TestConflictingSymbolNames_Data2::default_instance_->InitAsDefaultInstance();
-  TestConflictingSymbolNames_Data3::default_instance_->InitAsDefaultInstance();
-  TestConflictingSymbolNames_Data4::default_instance_->InitAsDefaultInstance();
-  TestConflictingSymbolNames_Data5::default_instance_->InitAsDefaultInstance();
-  TestConflictingSymbolNames_Data6::default_instance_->InitAsDefaultInstance();
-  TestConflictingSymbolNames_Cord::default_instance_->InitAsDefaultInstance();
-  TestConflictingSymbolNames_StringPiece::default_instance_->InitAsDefaultInstance();
-  TestConflictingSymbolNames_DO::default_instance_->InitAsDefaultInstance();
-  DummyMessage::default_instance_->InitAsDefaultInstance();
-  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto);
 }
 
 // Force AddDescriptors() to be called at static initialization time.
@@ -487,9 +511,7 @@ void TestConflictingSymbolNames_BuildDescriptors::SharedDtor() {
 }
 
 void TestConflictingSymbolNames_BuildDescriptors::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* TestConflictingSymbolNames_BuildDescriptors::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -497,7 +519,11 @@ const ::google::protobuf::Descriptor* TestConflictingSymbolNames_BuildDescriptor
 }
 
 const TestConflictingSymbolNames_BuildDescriptors& TestConflictingSymbolNames_BuildDescriptors::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestConflictingSymbolNames_BuildDescriptors* TestConflictingSymbolNames_BuildDescriptors::default_instance_ = NULL;
@@ -552,9 +578,8 @@ int TestConflictingSymbolNames_BuildDescriptors::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -642,9 +667,7 @@ void TestConflictingSymbolNames_TypeTraits::SharedDtor() {
 }
 
 void TestConflictingSymbolNames_TypeTraits::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* TestConflictingSymbolNames_TypeTraits::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -652,7 +675,11 @@ const ::google::protobuf::Descriptor* TestConflictingSymbolNames_TypeTraits::des
 }
 
 const TestConflictingSymbolNames_TypeTraits& TestConflictingSymbolNames_TypeTraits::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestConflictingSymbolNames_TypeTraits* TestConflictingSymbolNames_TypeTraits::default_instance_ = NULL;
@@ -707,9 +734,8 @@ int TestConflictingSymbolNames_TypeTraits::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -798,9 +824,7 @@ void TestConflictingSymbolNames_Data1::SharedDtor() {
 }
 
 void TestConflictingSymbolNames_Data1::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* TestConflictingSymbolNames_Data1::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -808,7 +832,11 @@ const ::google::protobuf::Descriptor* TestConflictingSymbolNames_Data1::descript
 }
 
 const TestConflictingSymbolNames_Data1& TestConflictingSymbolNames_Data1::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestConflictingSymbolNames_Data1* TestConflictingSymbolNames_Data1::default_instance_ = NULL;
@@ -914,9 +942,8 @@ int TestConflictingSymbolNames_Data1::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -1008,9 +1035,7 @@ void TestConflictingSymbolNames_Data2::SharedDtor() {
 }
 
 void TestConflictingSymbolNames_Data2::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* TestConflictingSymbolNames_Data2::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -1018,7 +1043,11 @@ const ::google::protobuf::Descriptor* TestConflictingSymbolNames_Data2::descript
 }
 
 const TestConflictingSymbolNames_Data2& TestConflictingSymbolNames_Data2::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestConflictingSymbolNames_Data2* TestConflictingSymbolNames_Data2::default_instance_ = NULL;
@@ -1131,9 +1160,8 @@ int TestConflictingSymbolNames_Data2::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -1225,9 +1253,7 @@ void TestConflictingSymbolNames_Data3::SharedDtor() {
 }
 
 void TestConflictingSymbolNames_Data3::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* TestConflictingSymbolNames_Data3::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -1235,7 +1261,11 @@ const ::google::protobuf::Descriptor* TestConflictingSymbolNames_Data3::descript
 }
 
 const TestConflictingSymbolNames_Data3& TestConflictingSymbolNames_Data3::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestConflictingSymbolNames_Data3* TestConflictingSymbolNames_Data3::default_instance_ = NULL;
@@ -1340,9 +1370,8 @@ int TestConflictingSymbolNames_Data3::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -1434,9 +1463,7 @@ void TestConflictingSymbolNames_Data4::SharedDtor() {
 }
 
 void TestConflictingSymbolNames_Data4::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* TestConflictingSymbolNames_Data4::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -1444,7 +1471,11 @@ const ::google::protobuf::Descriptor* TestConflictingSymbolNames_Data4::descript
 }
 
 const TestConflictingSymbolNames_Data4& TestConflictingSymbolNames_Data4::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestConflictingSymbolNames_Data4* TestConflictingSymbolNames_Data4::default_instance_ = NULL;
@@ -1542,9 +1573,8 @@ int TestConflictingSymbolNames_Data4::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -1636,9 +1666,7 @@ void TestConflictingSymbolNames_Data5::SharedDtor() {
 }
 
 void TestConflictingSymbolNames_Data5::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* TestConflictingSymbolNames_Data5::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -1646,7 +1674,11 @@ const ::google::protobuf::Descriptor* TestConflictingSymbolNames_Data5::descript
 }
 
 const TestConflictingSymbolNames_Data5& TestConflictingSymbolNames_Data5::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestConflictingSymbolNames_Data5* TestConflictingSymbolNames_Data5::default_instance_ = NULL;
@@ -1672,10 +1704,11 @@ bool TestConflictingSymbolNames_Data5::MergePartialFromCodedStream(
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
             ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
          parse_data:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->add_data()));
+          DO_(::google::protobuf::internal::WireFormatLite::ReadStringPiece(
+                input, data_.Add()));
           ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->data(0).data(), this->data(0).length(),
+            this->data(this->data_size() - 1).data(),
+            this->data(this->data_size() - 1).size(),
             ::google::protobuf::internal::WireFormat::PARSE);
         } else {
           goto handle_uninterpreted;
@@ -1705,10 +1738,10 @@ void TestConflictingSymbolNames_Data5::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
   // repeated string data = 1 [ctype = STRING_PIECE];
   for (int i = 0; i < this->data_size(); i++) {
-  ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-    this->data(i).data(), this->data(i).length(),
-    ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->data(i).data(), this->data(i).size(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    ::google::protobuf::internal::WireFormatLite::WriteStringPiece(
       1, this->data(i), output);
   }
   
@@ -1723,10 +1756,10 @@ void TestConflictingSymbolNames_Data5::SerializeWithCachedSizes(
   // repeated string data = 1 [ctype = STRING_PIECE];
   for (int i = 0; i < this->data_size(); i++) {
     ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->data(i).data(), this->data(i).length(),
+      this->data(i).data(), this->data(i).size(),
       ::google::protobuf::internal::WireFormat::SERIALIZE);
     target = ::google::protobuf::internal::WireFormatLite::
-      WriteStringToArray(1, this->data(i), target);
+      WriteStringPieceToArray(1, this->data(i), target);
   }
   
   if (!unknown_fields().empty()) {
@@ -1742,7 +1775,7 @@ int TestConflictingSymbolNames_Data5::ByteSize() const {
   // repeated string data = 1 [ctype = STRING_PIECE];
   total_size += 1 * this->data_size();
   for (int i = 0; i < this->data_size(); i++) {
-    total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
+    total_size += ::google::protobuf::internal::WireFormatLite::StringPieceSize(
       this->data(i));
   }
   
@@ -1751,9 +1784,8 @@ int TestConflictingSymbolNames_Data5::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -1845,9 +1877,7 @@ void TestConflictingSymbolNames_Data6::SharedDtor() {
 }
 
 void TestConflictingSymbolNames_Data6::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* TestConflictingSymbolNames_Data6::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -1855,7 +1885,11 @@ const ::google::protobuf::Descriptor* TestConflictingSymbolNames_Data6::descript
 }
 
 const TestConflictingSymbolNames_Data6& TestConflictingSymbolNames_Data6::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestConflictingSymbolNames_Data6* TestConflictingSymbolNames_Data6::default_instance_ = NULL;
@@ -1960,9 +1994,8 @@ int TestConflictingSymbolNames_Data6::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -2053,9 +2086,7 @@ void TestConflictingSymbolNames_Cord::SharedDtor() {
 }
 
 void TestConflictingSymbolNames_Cord::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* TestConflictingSymbolNames_Cord::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -2063,7 +2094,11 @@ const ::google::protobuf::Descriptor* TestConflictingSymbolNames_Cord::descripto
 }
 
 const TestConflictingSymbolNames_Cord& TestConflictingSymbolNames_Cord::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestConflictingSymbolNames_Cord* TestConflictingSymbolNames_Cord::default_instance_ = NULL;
@@ -2118,9 +2153,8 @@ int TestConflictingSymbolNames_Cord::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -2208,9 +2242,7 @@ void TestConflictingSymbolNames_StringPiece::SharedDtor() {
 }
 
 void TestConflictingSymbolNames_StringPiece::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* TestConflictingSymbolNames_StringPiece::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -2218,7 +2250,11 @@ const ::google::protobuf::Descriptor* TestConflictingSymbolNames_StringPiece::de
 }
 
 const TestConflictingSymbolNames_StringPiece& TestConflictingSymbolNames_StringPiece::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestConflictingSymbolNames_StringPiece* TestConflictingSymbolNames_StringPiece::default_instance_ = NULL;
@@ -2273,9 +2309,8 @@ int TestConflictingSymbolNames_StringPiece::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -2363,9 +2398,7 @@ void TestConflictingSymbolNames_DO::SharedDtor() {
 }
 
 void TestConflictingSymbolNames_DO::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* TestConflictingSymbolNames_DO::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -2373,7 +2406,11 @@ const ::google::protobuf::Descriptor* TestConflictingSymbolNames_DO::descriptor(
 }
 
 const TestConflictingSymbolNames_DO& TestConflictingSymbolNames_DO::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestConflictingSymbolNames_DO* TestConflictingSymbolNames_DO::default_instance_ = NULL;
@@ -2428,9 +2465,8 @@ int TestConflictingSymbolNames_DO::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -2489,7 +2525,6 @@ void TestConflictingSymbolNames_DO::Swap(TestConflictingSymbolNames_DO* other) {
 const ::std::string TestConflictingSymbolNames::_default_length_;
 const ::std::string TestConflictingSymbolNames::_default_string_;
 const ::std::string TestConflictingSymbolNames::_default_some_cord_;
-const ::std::string TestConflictingSymbolNames::_default_some_string_piece_;
 #ifndef _MSC_VER
 const int TestConflictingSymbolNames::kInputFieldNumber;
 const int TestConflictingSymbolNames::kOutputFieldNumber;
@@ -2531,7 +2566,8 @@ TestConflictingSymbolNames::TestConflictingSymbolNames()
 }
 
 void TestConflictingSymbolNames::InitAsDefaultInstance() {
-  do__ = const_cast< ::protobuf_unittest::TestConflictingSymbolNames_DO*>(&::protobuf_unittest::TestConflictingSymbolNames_DO::default_instance());
+  do__ = const_cast< ::protobuf_unittest::TestConflictingSymbolNames_DO*>(
+      ::protobuf_unittest::TestConflictingSymbolNames_DO::internal_default_instance());
 }
 
 TestConflictingSymbolNames::TestConflictingSymbolNames(const TestConflictingSymbolNames& from)
@@ -2567,7 +2603,6 @@ void TestConflictingSymbolNames::SharedCtor() {
   offsets_ = 0u;
   reflection_ = 0u;
   some_cord_ = const_cast< ::std::string*>(&_default_some_cord_);
-  some_string_piece_ = const_cast< ::std::string*>(&_default_some_string_piece_);
   int__ = 0u;
   friend__ = 0u;
   do__ = NULL;
@@ -2588,18 +2623,13 @@ void TestConflictingSymbolNames::SharedDtor() {
   if (some_cord_ != &_default_some_cord_) {
     delete some_cord_;
   }
-  if (some_string_piece_ != &_default_some_string_piece_) {
-    delete some_string_piece_;
-  }
   if (this != default_instance_) {
     delete do__;
   }
 }
 
 void TestConflictingSymbolNames::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* TestConflictingSymbolNames::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -2607,7 +2637,11 @@ const ::google::protobuf::Descriptor* TestConflictingSymbolNames::descriptor() {
 }
 
 const TestConflictingSymbolNames& TestConflictingSymbolNames::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestConflictingSymbolNames* TestConflictingSymbolNames::default_instance_ = NULL;
@@ -2663,9 +2697,7 @@ void TestConflictingSymbolNames::Clear() {
       }
     }
     if (_has_bit(28)) {
-      if (some_string_piece_ != &_default_some_string_piece_) {
-        some_string_piece_->clear();
-      }
+      some_string_piece_.Clear();
     }
     int__ = 0u;
     friend__ = 0u;
@@ -2761,10 +2793,11 @@ bool TestConflictingSymbolNames::MergePartialFromCodedStream(
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
             ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
          parse_new_element:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->add_new_element()));
+          DO_(::google::protobuf::internal::WireFormatLite::ReadStringPiece(
+                input, new_element_.Add()));
           ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->new_element(0).data(), this->new_element(0).length(),
+            this->new_element(this->new_element_size() - 1).data(),
+            this->new_element(this->new_element_size() - 1).size(),
             ::google::protobuf::internal::WireFormat::PARSE);
         } else {
           goto handle_uninterpreted;
@@ -3155,10 +3188,11 @@ bool TestConflictingSymbolNames::MergePartialFromCodedStream(
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
             ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
          parse_some_string_piece:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_some_string_piece()));
+          _set_bit(28);
+          DO_(::google::protobuf::internal::WireFormatLite::ReadStringPiece(
+                input, &some_string_piece_));
           ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->some_string_piece().data(), this->some_string_piece().length(),
+            this->some_string_piece().data(), this->some_string_piece().size(),
             ::google::protobuf::internal::WireFormat::PARSE);
         } else {
           goto handle_uninterpreted;
@@ -3220,7 +3254,7 @@ bool TestConflictingSymbolNames::MergePartialFromCodedStream(
           return true;
         }
         if ((8000u <= tag)) {
-          DO_(_extensions_.ParseField(tag, input, default_instance_,
+          DO_(_extensions_.ParseField(tag, input, &default_instance(),
                                       mutable_unknown_fields()));
           continue;
         }
@@ -3263,10 +3297,10 @@ void TestConflictingSymbolNames::SerializeWithCachedSizes(
   
   // repeated string new_element = 5 [ctype = STRING_PIECE];
   for (int i = 0; i < this->new_element_size(); i++) {
-  ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-    this->new_element(i).data(), this->new_element(i).length(),
-    ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->new_element(i).data(), this->new_element(i).size(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    ::google::protobuf::internal::WireFormatLite::WriteStringPiece(
       5, this->new_element(i), output);
   }
   
@@ -3397,9 +3431,9 @@ void TestConflictingSymbolNames::SerializeWithCachedSizes(
   // optional string some_string_piece = 29 [ctype = STRING_PIECE];
   if (_has_bit(28)) {
     ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->some_string_piece().data(), this->some_string_piece().length(),
+      this->some_string_piece().data(), this->some_string_piece().size(),
       ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
+    ::google::protobuf::internal::WireFormatLite::WriteStringPiece(
       29, this->some_string_piece(), output);
   }
   
@@ -3460,10 +3494,10 @@ void TestConflictingSymbolNames::SerializeWithCachedSizes(
   // repeated string new_element = 5 [ctype = STRING_PIECE];
   for (int i = 0; i < this->new_element_size(); i++) {
     ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->new_element(i).data(), this->new_element(i).length(),
+      this->new_element(i).data(), this->new_element(i).size(),
       ::google::protobuf::internal::WireFormat::SERIALIZE);
     target = ::google::protobuf::internal::WireFormatLite::
-      WriteStringToArray(5, this->new_element(i), target);
+      WriteStringPieceToArray(5, this->new_element(i), target);
   }
   
   // optional int32 total_size = 6;
@@ -3595,10 +3629,10 @@ void TestConflictingSymbolNames::SerializeWithCachedSizes(
   // optional string some_string_piece = 29 [ctype = STRING_PIECE];
   if (_has_bit(28)) {
     ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->some_string_piece().data(), this->some_string_piece().length(),
+      this->some_string_piece().data(), this->some_string_piece().size(),
       ::google::protobuf::internal::WireFormat::SERIALIZE);
     target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+      ::google::protobuf::internal::WireFormatLite::WriteStringPieceToArray(
         29, this->some_string_piece(), target);
   }
   
@@ -3818,7 +3852,7 @@ int TestConflictingSymbolNames::ByteSize() const {
     // optional string some_string_piece = 29 [ctype = STRING_PIECE];
     if (has_some_string_piece()) {
       total_size += 2 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
+        ::google::protobuf::internal::WireFormatLite::StringPieceSize(
           this->some_string_piece());
     }
     
@@ -3857,7 +3891,7 @@ int TestConflictingSymbolNames::ByteSize() const {
   // repeated string new_element = 5 [ctype = STRING_PIECE];
   total_size += 1 * this->new_element_size();
   for (int i = 0; i < this->new_element_size(); i++) {
-    total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
+    total_size += ::google::protobuf::internal::WireFormatLite::StringPieceSize(
       this->new_element(i));
   }
   
@@ -3878,9 +3912,8 @@ int TestConflictingSymbolNames::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -3984,7 +4017,7 @@ void TestConflictingSymbolNames::MergeFrom(const TestConflictingSymbolNames& fro
       set_some_cord(from.some_cord());
     }
     if (from._has_bit(28)) {
-      set_some_string_piece(from.some_string_piece());
+      set_some_string_piece(from.some_string_piece().data(), from.some_string_piece().size());
     }
     if (from._has_bit(29)) {
       set_int_(from.int_());
@@ -4048,7 +4081,7 @@ void TestConflictingSymbolNames::Swap(TestConflictingSymbolNames* other) {
     std::swap(offsets_, other->offsets_);
     std::swap(reflection_, other->reflection_);
     std::swap(some_cord_, other->some_cord_);
-    std::swap(some_string_piece_, other->some_string_piece_);
+    some_string_piece_.Swap(&other->some_string_piece_);
     std::swap(int__, other->int__);
     std::swap(friend__, other->friend__);
     std::swap(do__, other->do__);
@@ -4102,9 +4135,7 @@ void DummyMessage::SharedDtor() {
 }
 
 void DummyMessage::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* DummyMessage::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -4112,7 +4143,11 @@ const ::google::protobuf::Descriptor* DummyMessage::descriptor() {
 }
 
 const DummyMessage& DummyMessage::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
+  }
+  return *default_instance_;
 }
 
 DummyMessage* DummyMessage::default_instance_ = NULL;
@@ -4167,9 +4202,8 @@ int DummyMessage::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
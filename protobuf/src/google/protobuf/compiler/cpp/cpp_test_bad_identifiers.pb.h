@@ -24,12 +24,15 @@
 #include <google/protobuf/extension_set.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/service.h>
+#include <google/protobuf/string_piece_field.h>
 // @@protoc_insertion_point(includes)
 
 namespace protobuf_unittest {
 
 // Internal implementation detail -- do not call these.
 void  protobuf_AddDesc_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
+void  protobuf_InitDefaults_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
+void protobuf_InitDefaults_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto_impl();
 void protobuf_AssignDesc_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
 void protobuf_ShutdownFile_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
 
@@ -90,6 +93,12 @@ class TestConflictingSymbolNames_BuildDescriptors : public ::google::protobuf::M
   static const ::google::protobuf::Descriptor* descriptor();
   static const TestConflictingSymbolNames_BuildDescriptors& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestConflictingSymbolNames_BuildDescriptors* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestConflictingSymbolNames_BuildDescriptors* other);
   
   // implements Message ----------------------------------------------
@@ -108,7 +117,9 @@ class TestConflictingSymbolNames_BuildDescriptors : public ::google::protobuf::M
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -124,9 +135,9 @@ class TestConflictingSymbolNames_BuildDescriptors : public ::google::protobuf::M
   // @@protoc_insertion_point(class_scope:protobuf_unittest.TestConflictingSymbolNames.BuildDescriptors)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
-  friend void  protobuf_AddDesc_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
   
@@ -171,6 +182,12 @@ class TestConflictingSymbolNames_TypeTraits : public ::google::protobuf::Message
   static const ::google::protobuf::Descriptor* descriptor();
   static const TestConflictingSymbolNames_TypeTraits& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestConflictingSymbolNames_TypeTraits* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestConflictingSymbolNames_TypeTraits* other);
   
   // implements Message ----------------------------------------------
@@ -189,7 +206,9 @@ class TestConflictingSymbolNames_TypeTraits : public ::google::protobuf::Message
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -205,9 +224,9 @@ class TestConflictingSymbolNames_TypeTraits : public ::google::protobuf::Message
   // @@protoc_insertion_point(class_scope:protobuf_unittest.TestConflictingSymbolNames.TypeTraits)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
-  friend void  protobuf_AddDesc_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
   
@@ -252,6 +271,12 @@ class TestConflictingSymbolNames_Data1 : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const TestConflictingSymbolNames_Data1& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestConflictingSymbolNames_Data1* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestConflictingSymbolNames_Data1* other);
   
   // implements Message ----------------------------------------------
@@ -270,7 +295,9 @@ class TestConflictingSymbolNames_Data1 : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -298,10 +325,10 @@ class TestConflictingSymbolNames_Data1 : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.TestConflictingSymbolNames.Data1)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::google::protobuf::RepeatedField< ::google::protobuf::int32 > data_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
   
@@ -346,6 +373,12 @@ class TestConflictingSymbolNames_Data2 : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const TestConflictingSymbolNames_Data2& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestConflictingSymbolNames_Data2* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestConflictingSymbolNames_Data2* other);
   
   // implements Message ----------------------------------------------
@@ -364,7 +397,9 @@ class TestConflictingSymbolNames_Data2 : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -390,10 +425,10 @@ class TestConflictingSymbolNames_Data2 : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.TestConflictingSymbolNames.Data2)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::google::protobuf::RepeatedField<int> data_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
   
@@ -438,6 +473,12 @@ class TestConflictingSymbolNames_Data3 : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const TestConflictingSymbolNames_Data3& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestConflictingSymbolNames_Data3* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestConflictingSymbolNames_Data3* other);
   
   // implements Message ----------------------------------------------
@@ -456,7 +497,9 @@ class TestConflictingSymbolNames_Data3 : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -488,10 +531,10 @@ class TestConflictingSymbolNames_Data3 : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.TestConflictingSymbolNames.Data3)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::google::protobuf::RepeatedPtrField< ::std::string> data_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
   
@@ -536,6 +579,12 @@ class TestConflictingSymbolNames_Data4 : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const TestConflictingSymbolNames_Data4& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestConflictingSymbolNames_Data4* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestConflictingSymbolNames_Data4* other);
   
   // implements Message ----------------------------------------------
@@ -554,7 +603,9 @@ class TestConflictingSymbolNames_Data4 : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -582,10 +633,10 @@ class TestConflictingSymbolNames_Data4 : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.TestConflictingSymbolNames.Data4)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestConflictingSymbolNames_Data4 > data_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
   
@@ -630,6 +681,12 @@ class TestConflictingSymbolNames_Data5 : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const TestConflictingSymbolNames_Data5& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestConflictingSymbolNames_Data5* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestConflictingSymbolNames_Data5* other);
   
   // implements Message ----------------------------------------------
@@ -648,7 +705,9 @@ class TestConflictingSymbolNames_Data5 : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -665,9 +724,7 @@ class TestConflictingSymbolNames_Data5 : public ::google::protobuf::Message {
   inline int data_size() const;
   inline void clear_data();
   static const int kDataFieldNumber = 1;
- private:
-  // Hidden due to unknown ctype option.
-  inline const ::std::string& data(int index) const;
+  inline const ::google::protobuf::internal::StringPieceField& data(int index) const;
   inline ::std::string* mutable_data(int index);
   inline void set_data(int index, const ::std::string& value);
   inline void set_data(int index, const char* value);
@@ -676,17 +733,16 @@ class TestConflictingSymbolNames_Data5 : public ::google::protobuf::Message {
   inline void add_data(const ::std::string& value);
   inline void add_data(const char* value);
   inline void add_data(const char* value, size_t size);
-  inline const ::google::protobuf::RepeatedPtrField< ::std::string>& data() const;
-  inline ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_data();
- public:
+  inline const ::google::protobuf::RepeatedPtrField< ::google::protobuf::internal::StringPieceField>& data() const;
+  inline ::google::protobuf::RepeatedPtrField< ::google::protobuf::internal::StringPieceField>* mutable_data();
   
   // @@protoc_insertion_point(class_scope:protobuf_unittest.TestConflictingSymbolNames.Data5)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
-  ::google::protobuf::RepeatedPtrField< ::std::string> data_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
+  ::google::protobuf::RepeatedPtrField< ::google::protobuf::internal::StringPieceField> data_;
+  friend void protobuf_InitDefaults_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
   
@@ -731,6 +787,12 @@ class TestConflictingSymbolNames_Data6 : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const TestConflictingSymbolNames_Data6& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestConflictingSymbolNames_Data6* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestConflictingSymbolNames_Data6* other);
   
   // implements Message ----------------------------------------------
@@ -749,7 +811,9 @@ class TestConflictingSymbolNames_Data6 : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -784,10 +848,10 @@ class TestConflictingSymbolNames_Data6 : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.TestConflictingSymbolNames.Data6)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::google::protobuf::RepeatedPtrField< ::std::string> data_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
   
@@ -832,6 +896,12 @@ class TestConflictingSymbolNames_Cord : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const TestConflictingSymbolNames_Cord& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestConflictingSymbolNames_Cord* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestConflictingSymbolNames_Cord* other);
   
   // implements Message ----------------------------------------------
@@ -850,7 +920,9 @@ class TestConflictingSymbolNames_Cord : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -866,9 +938,9 @@ class TestConflictingSymbolNames_Cord : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.TestConflictingSymbolNames.Cord)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
-  friend void  protobuf_AddDesc_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
   
@@ -913,6 +985,12 @@ class TestConflictingSymbolNames_StringPiece : public ::google::protobuf::Messag
   static const ::google::protobuf::Descriptor* descriptor();
   static const TestConflictingSymbolNames_StringPiece& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestConflictingSymbolNames_StringPiece* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestConflictingSymbolNames_StringPiece* other);
   
   // implements Message ----------------------------------------------
@@ -931,7 +1009,9 @@ class TestConflictingSymbolNames_StringPiece : public ::google::protobuf::Messag
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -947,9 +1027,9 @@ class TestConflictingSymbolNames_StringPiece : public ::google::protobuf::Messag
   // @@protoc_insertion_point(class_scope:protobuf_unittest.TestConflictingSymbolNames.StringPiece)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
-  friend void  protobuf_AddDesc_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
   
@@ -994,6 +1074,12 @@ class TestConflictingSymbolNames_DO : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const TestConflictingSymbolNames_DO& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestConflictingSymbolNames_DO* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestConflictingSymbolNames_DO* other);
   
   // implements Message ----------------------------------------------
@@ -1012,7 +1098,9 @@ class TestConflictingSymbolNames_DO : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -1028,9 +1116,9 @@ class TestConflictingSymbolNames_DO : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.TestConflictingSymbolNames.DO)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
-  friend void  protobuf_AddDesc_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
   
@@ -1075,6 +1163,12 @@ class TestConflictingSymbolNames : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const TestConflictingSymbolNames& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestConflictingSymbolNames* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestConflictingSymbolNames* other);
   
   // implements Message ----------------------------------------------
@@ -1093,7 +1187,9 @@ class TestConflictingSymbolNames : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -1181,9 +1277,7 @@ class TestConflictingSymbolNames : public ::google::protobuf::Message {
   inline int new_element_size() const;
   inline void clear_new_element();
   static const int kNewElementFieldNumber = 5;
- private:
-  // Hidden due to unknown ctype option.
-  inline const ::std::string& new_element(int index) const;
+  inline const ::google::protobuf::internal::StringPieceField& new_element(int index) const;
   inline ::std::string* mutable_new_element(int index);
   inline void set_new_element(int index, const ::std::string& value);
   inline void set_new_element(int index, const char* value);
@@ -1192,9 +1286,8 @@ class TestConflictingSymbolNames : public ::google::protobuf::Message {
   inline void add_new_element(const ::std::string& value);
   inline void add_new_element(const char* value);
   inline void add_new_element(const char* value, size_t size);
-  inline const ::google::protobuf::RepeatedPtrField< ::std::string>& new_element() const;
-  inline ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_new_element();
- public:
+  inline const ::google::protobuf::RepeatedPtrField< ::google::protobuf::internal::StringPieceField>& new_element() const;
+  inline ::google::protobuf::RepeatedPtrField< ::google::protobuf::internal::StringPieceField>* mutable_new_element();
   
   // optional int32 total_size = 6;
   inline bool has_total_size() const;
@@ -1375,14 +1468,11 @@ class TestConflictingSymbolNames : public ::google::protobuf::Message {
   inline bool has_some_string_piece() const;
   inline void clear_some_string_piece();
   static const int kSomeStringPieceFieldNumber = 29;
- private:
-  // Hidden due to unknown ctype option.
-  inline const ::std::string& some_string_piece() const;
+  inline const ::google::protobuf::internal::StringPieceField& some_string_piece() const;
   inline void set_some_string_piece(const ::std::string& value);
   inline void set_some_string_piece(const char* value);
   inline void set_some_string_piece(const char* value, size_t size);
   inline ::std::string* mutable_some_string_piece();
- public:
   
   // optional uint32 int = 30;
   inline bool has_int_() const;
@@ -1410,14 +1500,14 @@ class TestConflictingSymbolNames : public ::google::protobuf::Message {
  private:
   ::google::protobuf::internal::ExtensionSet _extensions_;
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::google::protobuf::int32 input_;
   ::google::protobuf::int32 output_;
   ::std::string* length_;
   static const ::std::string _default_length_;
   ::google::protobuf::RepeatedField< ::google::protobuf::int32 > i_;
-  ::google::protobuf::RepeatedPtrField< ::std::string> new_element_;
+  ::google::protobuf::RepeatedPtrField< ::google::protobuf::internal::StringPieceField> new_element_;
   ::google::protobuf::int32 total_size_;
   ::google::protobuf::int32 tag_;
   ::google::protobuf::int32 source_;
@@ -1443,12 +1533,11 @@ class TestConflictingSymbolNames : public ::google::protobuf::Message {
   ::google::protobuf::uint32 reflection_;
   ::std::string* some_cord_;
   static const ::std::string _default_some_cord_;
-  ::std::string* some_string_piece_;
-  static const ::std::string _default_some_string_piece_;
+  ::google::protobuf::internal::StringPieceField some_string_piece_;
   ::google::protobuf::uint32 int__;
   ::google::protobuf::uint32 friend__;
   ::protobuf_unittest::TestConflictingSymbolNames_DO* do__;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
   
@@ -1493,6 +1582,12 @@ class DummyMessage : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const DummyMessage& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const DummyMessage* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(DummyMessage* other);
   
   // implements Message ----------------------------------------------
@@ -1511,7 +1606,9 @@ class DummyMessage : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -1527,9 +1624,9 @@ class DummyMessage : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.DummyMessage)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
-  friend void  protobuf_AddDesc_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2fcompiler_2fcpp_2fcpp_5ftest_5fbad_5fidentifiers_2eproto();
   
@@ -1767,39 +1864,39 @@ inline int TestConflictingSymbolNames_Data5::data_size() const {
 inline void TestConflictingSymbolNames_Data5::clear_data() {
   data_.Clear();
 }
-inline const ::std::string& TestConflictingSymbolNames_Data5::data(int index) const {
+inline const ::google::protobuf::internal::StringPieceField& TestConflictingSymbolNames_Data5::data(int index) const {
   return data_.Get(index);
 }
 inline ::std::string* TestConflictingSymbolNames_Data5::mutable_data(int index) {
-  return data_.Mutable(index);
+  return data_.Mutable(index)->Mutable();
 }
 inline void TestConflictingSymbolNames_Data5::set_data(int index, const ::std::string& value) {
-  data_.Mutable(index)->assign(value);
+  data_.Mutable(index)->CopyFrom(value.data(), value.size());
 }
 inline void TestConflictingSymbolNames_Data5::set_data(int index, const char* value) {
-  data_.Mutable(index)->assign(value);
+  data_.Mutable(index)->CopyFrom(value, strlen(value));
 }
 inline void TestConflictingSymbolNames_Data5::set_data(int index, const char* value, size_t size) {
-  data_.Mutable(index)->assign(
+  data_.Mutable(index)->CopyFrom(
     reinterpret_cast<const char*>(value), size);
 }
 inline ::std::string* TestConflictingSymbolNames_Data5::add_data() {
-  return data_.Add();
+  return data_.Add()->Mutable();
 }
 inline void TestConflictingSymbolNames_Data5::add_data(const ::std::string& value) {
-  data_.Add()->assign(value);
+  data_.Add()->CopyFrom(value.data(), value.size());
 }
 inline void TestConflictingSymbolNames_Data5::add_data(const char* value) {
-  data_.Add()->assign(value);
+  data_.Add()->CopyFrom(value, strlen(value));
 }
 inline void TestConflictingSymbolNames_Data5::add_data(const char* value, size_t size) {
-  data_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  data_.Add()->CopyFrom(reinterpret_cast<const char*>(value), size);
 }
-inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+inline const ::google::protobuf::RepeatedPtrField< ::google::protobuf::internal::StringPieceField>&
 TestConflictingSymbolNames_Data5::data() const {
   return data_;
 }
-inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+inline ::google::protobuf::RepeatedPtrField< ::google::protobuf::internal::StringPieceField>*
 TestConflictingSymbolNames_Data5::mutable_data() {
   return &data_;
 }
@@ -1974,39 +2071,39 @@ inline int TestConflictingSymbolNames::new_element_size() const {
 inline void TestConflictingSymbolNames::clear_new_element() {
   new_element_.Clear();
 }
-inline const ::std::string& TestConflictingSymbolNames::new_element(int index) const {
+inline const ::google::protobuf::internal::StringPieceField& TestConflictingSymbolNames::new_element(int index) const {
   return new_element_.Get(index);
 }
 inline ::std::string* TestConflictingSymbolNames::mutable_new_element(int index) {
-  return new_element_.Mutable(index);
+  return new_element_.Mutable(index)->Mutable();
 }
 inline void TestConflictingSymbolNames::set_new_element(int index, const ::std::string& value) {
-  new_element_.Mutable(index)->assign(value);
+  new_element_.Mutable(index)->CopyFrom(value.data(), value.size());
 }
 inline void TestConflictingSymbolNames::set_new_element(int index, const char* value) {
-  new_element_.Mutable(index)->assign(value);
+  new_element_.Mutable(index)->CopyFrom(value, strlen(value));
 }
 inline void TestConflictingSymbolNames::set_new_element(int index, const char* value, size_t size) {
-  new_element_.Mutable(index)->assign(
+  new_element_.Mutable(index)->CopyFrom(
     reinterpret_cast<const char*>(value), size);
 }
 inline ::std::string* TestConflictingSymbolNames::add_new_element() {
-  return new_element_.Add();
+  return new_element_.Add()->Mutable();
 }
 inline void TestConflictingSymbolNames::add_new_element(const ::std::string& value) {
-  new_element_.Add()->assign(value);
+  new_element_.Add()->CopyFrom(value.data(), value.size());
 }
 inline void TestConflictingSymbolNames::add_new_element(const char* value) {
-  new_element_.Add()->assign(value);
+  new_element_.Add()->CopyFrom(value, strlen(value));
 }
 inline void TestConflictingSymbolNames::add_new_element(const char* value, size_t size) {
-  new_element_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  new_element_.Add()->CopyFrom(reinterpret_cast<const char*>(value), size);
 }
-inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+inline const ::google::protobuf::RepeatedPtrField< ::google::protobuf::internal::StringPieceField>&
 TestConflictingSymbolNames::new_element() const {
   return new_element_;
 }
-inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+inline ::google::protobuf::RepeatedPtrField< ::google::protobuf::internal::StringPieceField>*
 TestConflictingSymbolNames::mutable_new_element() {
   return &new_element_;
 }
@@ -2445,41 +2542,27 @@ inline bool TestConflictingSymbolNames::has_some_string_piece() const {
   return _has_bit(28);
 }
 inline void TestConflictingSymbolNames::clear_some_string_piece() {
-  if (some_string_piece_ != &_default_some_string_piece_) {
-    some_string_piece_->clear();
-  }
+  some_string_piece_.Clear();
   _clear_bit(28);
 }
-inline const ::std::string& TestConflictingSymbolNames::some_string_piece() const {
-  return *some_string_piece_;
+inline const ::google::protobuf::internal::StringPieceField& TestConflictingSymbolNames::some_string_piece() const {
+  return some_string_piece_;
 }
 inline void TestConflictingSymbolNames::set_some_string_piece(const ::std::string& value) {
   _set_bit(28);
-  if (some_string_piece_ == &_default_some_string_piece_) {
-    some_string_piece_ = new ::std::string;
-  }
-  some_string_piece_->assign(value);
+  some_string_piece_.CopyFrom(value.data(), value.size());
 }
 inline void TestConflictingSymbolNames::set_some_string_piece(const char* value) {
   _set_bit(28);
-  if (some_string_piece_ == &_default_some_string_piece_) {
-    some_string_piece_ = new ::std::string;
-  }
-  some_string_piece_->assign(value);
+  some_string_piece_.CopyFrom(value, strlen(value));
 }
 inline void TestConflictingSymbolNames::set_some_string_piece(const char* value, size_t size) {
   _set_bit(28);
-  if (some_string_piece_ == &_default_some_string_piece_) {
-    some_string_piece_ = new ::std::string;
-  }
-  some_string_piece_->assign(reinterpret_cast<const char*>(value), size);
+  some_string_piece_.CopyFrom(reinterpret_cast<const char*>(value), size);
 }
 inline ::std::string* TestConflictingSymbolNames::mutable_some_string_piece() {
   _set_bit(28);
-  if (some_string_piece_ == &_default_some_string_piece_) {
-    some_string_piece_ = new ::std::string;
-  }
-  return some_string_piece_;
+  return some_string_piece_.Mutable();
 }
 
 // optional uint32 int = 30;
@@ -2523,7 +2606,7 @@ inline void TestConflictingSymbolNames::clear_do_() {
   _clear_bit(31);
 }
 inline const ::protobuf_unittest::TestConflictingSymbolNames_DO& TestConflictingSymbolNames::do_() const {
-  return do__ != NULL ? *do__ : *default_instance_->do__;
+  return do__ != NULL ? *do__ : ::protobuf_unittest::TestConflictingSymbolNames_DO::default_instance();
 }
 inline ::protobuf_unittest::TestConflictingSymbolNames_DO* TestConflictingSymbolNames::mutable_do_() {
   _set_bit(31);
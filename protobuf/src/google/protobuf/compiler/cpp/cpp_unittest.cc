@@ -195,6 +195,105 @@ TEST(GeneratedMessageTest, MutableStringDefault) {
   EXPECT_EQ("hello", *message.mutable_default_string());
 }
 
+TEST(GeneratedMessageTest, StringPieceAccessors) {
+  unittest::TestAllTypes message;
+
+  EXPECT_FALSE(message.has_optional_string_piece());
+  EXPECT_EQ("", message.optional_string_piece().ToString());
+  EXPECT_EQ("abc", message.default_string_piece().ToString());
+
+  message.set_optional_string_piece("foo");
+  EXPECT_TRUE(message.has_optional_string_piece());
+  EXPECT_EQ("foo", message.optional_string_piece().ToString());
+  message.mutable_optional_string_piece()->append("bar");
+  EXPECT_EQ("foobar", message.optional_string_piece().ToString());
+
+  message.set_default_string_piece(string("x\0y", 3));
+  EXPECT_EQ(3, message.default_string_piece().size());
+
+  message.add_repeated_string_piece("a");
+  message.add_repeated_string_piece("b", 1);
+  message.add_repeated_string_piece()->assign("c");
+  message.set_repeated_string_piece(0, "d");
+  ASSERT_EQ(3, message.repeated_string_piece_size());
+  EXPECT_EQ("d", message.repeated_string_piece(0).ToString());
+  EXPECT_EQ("b", message.repeated_string_piece(1).ToString());
+  EXPECT_EQ("c", message.repeated_string_piece(2).ToString());
+
+  message.Clear();
+  EXPECT_FALSE(message.has_optional_string_piece());
+  EXPECT_EQ("", message.optional_string_piece().ToString());
+  EXPECT_EQ("abc", message.default_string_piece().ToString());
+  EXPECT_EQ(0, message.repeated_string_piece_size());
+}
+
+TEST(GeneratedMessageTest, StringPieceAliasing) {
+  unittest::TestAllTypes message;
+  message.set_optional_string_piece("hello");
+  message.add_repeated_string_piece("world");
+  string data = message.SerializeAsString();
+  const char* begin = data.data();
+  const char* end = data.data() + data.size();
+
+  // With aliasing enabled, parsing from a flat array points the fields at
+  // the array.
+  {
+    io::CodedInputStream input(reinterpret_cast<const uint8*>(data.data()),
+                               data.size());
+    input.EnableAliasing(true);
+    unittest::TestAllTypes parsed;
+    ASSERT_TRUE(parsed.MergeFromCodedStream(&input));
+    EXPECT_EQ("hello", parsed.optional_string_piece().ToString());
+    EXPECT_EQ("world", parsed.repeated_string_piece(0).ToString());
+    EXPECT_TRUE(parsed.optional_string_piece().data() >= begin &&
+                parsed.optional_string_piece().data() < end);
+    EXPECT_TRUE(parsed.repeated_string_piece(0).data() >= begin &&
+                parsed.repeated_string_piece(0).data() < end);
+
+    // Copies never alias.
+    unittest::TestAllTypes copy(parsed);
+    EXPECT_EQ("hello", copy.optional_string_piece().ToString());
+    EXPECT_FALSE(copy.optional_string_piece().data() >= begin &&
+                 copy.optional_string_piece().data() < end);
+  }
+
+  // Without it, the data is copied.
+  {
+    unittest::TestAllTypes parsed;
+    ASSERT_TRUE(parsed.ParseFromString(data));
+    EXPECT_EQ("hello", parsed.optional_string_piece().ToString());
+    EXPECT_FALSE(parsed.optional_string_piece().data() >= begin &&
+                 parsed.optional_string_piece().data() < end);
+  }
+
+  // Aliasing is ignored when reading from a ZeroCopyInputStream, since its
+  // buffers may not outlive the next Next().
+  {
+    io::ArrayInputStream raw_input(data.data(), data.size());
+    io::CodedInputStream input(&raw_input);
+    input.EnableAliasing(true);
+    EXPECT_FALSE(input.AliasingEnabled());
+    unittest::TestAllTypes parsed;
+    ASSERT_TRUE(parsed.MergeFromCodedStream(&input));
+    EXPECT_EQ("hello", parsed.optional_string_piece().ToString());
+    EXPECT_FALSE(parsed.optional_string_piece().data() >= begin &&
+                 parsed.optional_string_piece().data() < end);
+  }
+}
+
+TEST(GeneratedMessageTest, StringPieceTruncated) {
+  unittest::TestAllTypes message;
+  message.set_optional_string_piece("hello");
+  string data = message.SerializeAsString();
+  data.resize(data.size() - 1);
+
+  io::CodedInputStream input(reinterpret_cast<const uint8*>(data.data()),
+                             data.size());
+  input.EnableAliasing(true);
+  unittest::TestAllTypes parsed;
+  EXPECT_FALSE(parsed.MergeFromCodedStream(&input));
+}
+
 TEST(GeneratedMessageTest, Clear) {
   // Set every field to a unique value, clear the message, then check that
   // it is cleared.
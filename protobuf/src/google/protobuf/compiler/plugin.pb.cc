@@ -31,6 +31,7 @@ const ::google::protobuf::internal::GeneratedMessageReflection*
 
 void protobuf_AssignDesc_google_2fprotobuf_2fcompiler_2fplugin_2eproto() {
   protobuf_AddDesc_google_2fprotobuf_2fcompiler_2fplugin_2eproto();
+  protobuf_InitDefaults_google_2fprotobuf_2fcompiler_2fplugin_2eproto();
   const ::google::protobuf::FileDescriptor* file =
     ::google::protobuf::DescriptorPool::generated_pool()->FindFileByName(
       "google/protobuf/compiler/plugin.proto");
@@ -116,6 +117,37 @@ void protobuf_ShutdownFile_google_2fprotobuf_2fcompiler_2fplugin_2eproto() {
   delete CodeGeneratorResponse_File_reflection_;
 }
 
+void protobuf_InitDefaults_google_2fprotobuf_2fcompiler_2fplugin_2eproto_impl() {
+  ::google::protobuf::protobuf_InitDefaults_google_2fprotobuf_2fdescriptor_2eproto();
+  CodeGeneratorRequest::default_instance_ = new CodeGeneratorRequest();
+  CodeGeneratorResponse::default_instance_ = new CodeGeneratorResponse();
+  CodeGeneratorResponse_File::default_instance_ = new CodeGeneratorResponse_File();
+  CodeGeneratorRequest::default_instance_->InitAsDefaultInstance();
+  CodeGeneratorResponse::default_instance_->InitAsDefaultInstance();
+  CodeGeneratorResponse_File::default_instance_->InitAsDefaultInstance();
+  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_google_2fprotobuf_2fcompiler_2fplugin_2eproto);
+}
+
+namespace {
+
+GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_InitDefaults_once_);
+// Set once the defaults are built, so that default_instance() and the
+// other callers on hot paths can skip the once.
+::google::protobuf::internal::Atomic32 protobuf_InitDefaults_done_ = 0;
+
+}  // namespace
+
+void protobuf_InitDefaults_google_2fprotobuf_2fcompiler_2fplugin_2eproto() {
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) != 0) {
+    return;
+  }
+  ::google::protobuf::GoogleOnceInit(&protobuf_InitDefaults_once_,
+                 &protobuf_InitDefaults_google_2fprotobuf_2fcompiler_2fplugin_2eproto_impl);
+  ::google::protobuf::internal::Release_Store(
+      &protobuf_InitDefaults_done_, 1);
+}
+
 void protobuf_AddDesc_google_2fprotobuf_2fcompiler_2fplugin_2eproto() {
   static bool already_here = false;
   if (already_here) return;
@@ -136,13 +168,6 @@ void protobuf_AddDesc_google_2fprotobuf_2fcompiler_2fplugin_2eproto() {
     "\017insertion_point\030\002 \001(\t\022\017\n\007content\030\017 \001(\t", 399);
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
     "google/protobuf/compiler/plugin.proto", &protobuf_RegisterTypes);
-  CodeGeneratorRequest::default_instance_ = new CodeGeneratorRequest();
-  CodeGeneratorResponse::default_instance_ = new CodeGeneratorResponse();
-  CodeGeneratorResponse_File::default_instance_ = new CodeGeneratorResponse_File();
-  CodeGeneratorRequest::default_instance_->InitAsDefaultInstance();
-  CodeGeneratorResponse::default_instance_->InitAsDefaultInstance();
-  CodeGeneratorResponse_File::default_instance_->InitAsDefaultInstance();
-  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_google_2fprotobuf_2fcompiler_2fplugin_2eproto);
 }
 
 // Force AddDescriptors() to be called at static initialization time.
@@ -195,9 +220,7 @@ void CodeGeneratorRequest::SharedDtor() {
 }
 
 void CodeGeneratorRequest::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* CodeGeneratorRequest::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -205,7 +228,11 @@ const ::google::protobuf::Descriptor* CodeGeneratorRequest::descriptor() {
 }
 
 const CodeGeneratorRequest& CodeGeneratorRequest::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2fcompiler_2fplugin_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2fcompiler_2fplugin_2eproto();
+  }
+  return *default_instance_;
 }
 
 CodeGeneratorRequest* CodeGeneratorRequest::default_instance_ = NULL;
@@ -399,9 +426,8 @@ int CodeGeneratorRequest::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -521,9 +547,7 @@ void CodeGeneratorResponse_File::SharedDtor() {
 }
 
 void CodeGeneratorResponse_File::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* CodeGeneratorResponse_File::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -531,7 +555,11 @@ const ::google::protobuf::Descriptor* CodeGeneratorResponse_File::descriptor() {
 }
 
 const CodeGeneratorResponse_File& CodeGeneratorResponse_File::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2fcompiler_2fplugin_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2fcompiler_2fplugin_2eproto();
+  }
+  return *default_instance_;
 }
 
 CodeGeneratorResponse_File* CodeGeneratorResponse_File::default_instance_ = NULL;
@@ -739,9 +767,8 @@ int CodeGeneratorResponse_File::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -851,9 +878,7 @@ void CodeGeneratorResponse::SharedDtor() {
 }
 
 void CodeGeneratorResponse::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* CodeGeneratorResponse::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -861,7 +886,11 @@ const ::google::protobuf::Descriptor* CodeGeneratorResponse::descriptor() {
 }
 
 const CodeGeneratorResponse& CodeGeneratorResponse::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2fcompiler_2fplugin_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2fcompiler_2fplugin_2eproto();
+  }
+  return *default_instance_;
 }
 
 CodeGeneratorResponse* CodeGeneratorResponse::default_instance_ = NULL;
@@ -1010,9 +1039,8 @@ int CodeGeneratorResponse::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -32,6 +32,8 @@ namespace compiler {
 
 // Internal implementation detail -- do not call these.
 void LIBPROTOC_EXPORT protobuf_AddDesc_google_2fprotobuf_2fcompiler_2fplugin_2eproto();
+void LIBPROTOC_EXPORT protobuf_InitDefaults_google_2fprotobuf_2fcompiler_2fplugin_2eproto();
+void protobuf_InitDefaults_google_2fprotobuf_2fcompiler_2fplugin_2eproto_impl();
 void protobuf_AssignDesc_google_2fprotobuf_2fcompiler_2fplugin_2eproto();
 void protobuf_ShutdownFile_google_2fprotobuf_2fcompiler_2fplugin_2eproto();
 
@@ -64,6 +66,12 @@ class LIBPROTOC_EXPORT CodeGeneratorRequest : public ::google::protobuf::Message
   static const ::google::protobuf::Descriptor* descriptor();
   static const CodeGeneratorRequest& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const CodeGeneratorRequest* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(CodeGeneratorRequest* other);
   
   // implements Message ----------------------------------------------
@@ -82,7 +90,9 @@ class LIBPROTOC_EXPORT CodeGeneratorRequest : public ::google::protobuf::Message
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -136,13 +146,13 @@ class LIBPROTOC_EXPORT CodeGeneratorRequest : public ::google::protobuf::Message
   // @@protoc_insertion_point(class_scope:google.protobuf.compiler.CodeGeneratorRequest)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::google::protobuf::RepeatedPtrField< ::std::string> file_to_generate_;
   ::std::string* parameter_;
   static const ::std::string _default_parameter_;
   ::google::protobuf::RepeatedPtrField< ::google::protobuf::FileDescriptorProto > proto_file_;
-  friend void LIBPROTOC_EXPORT protobuf_AddDesc_google_2fprotobuf_2fcompiler_2fplugin_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2fcompiler_2fplugin_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2fcompiler_2fplugin_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2fcompiler_2fplugin_2eproto();
   
@@ -187,6 +197,12 @@ class LIBPROTOC_EXPORT CodeGeneratorResponse_File : public ::google::protobuf::M
   static const ::google::protobuf::Descriptor* descriptor();
   static const CodeGeneratorResponse_File& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const CodeGeneratorResponse_File* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(CodeGeneratorResponse_File* other);
   
   // implements Message ----------------------------------------------
@@ -205,7 +221,9 @@ class LIBPROTOC_EXPORT CodeGeneratorResponse_File : public ::google::protobuf::M
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -251,7 +269,7 @@ class LIBPROTOC_EXPORT CodeGeneratorResponse_File : public ::google::protobuf::M
   // @@protoc_insertion_point(class_scope:google.protobuf.compiler.CodeGeneratorResponse.File)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::std::string* name_;
   static const ::std::string _default_name_;
@@ -259,7 +277,7 @@ class LIBPROTOC_EXPORT CodeGeneratorResponse_File : public ::google::protobuf::M
   static const ::std::string _default_insertion_point_;
   ::std::string* content_;
   static const ::std::string _default_content_;
-  friend void LIBPROTOC_EXPORT protobuf_AddDesc_google_2fprotobuf_2fcompiler_2fplugin_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2fcompiler_2fplugin_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2fcompiler_2fplugin_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2fcompiler_2fplugin_2eproto();
   
@@ -304,6 +322,12 @@ class LIBPROTOC_EXPORT CodeGeneratorResponse : public ::google::protobuf::Messag
   static const ::google::protobuf::Descriptor* descriptor();
   static const CodeGeneratorResponse& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const CodeGeneratorResponse* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(CodeGeneratorResponse* other);
   
   // implements Message ----------------------------------------------
@@ -322,7 +346,9 @@ class LIBPROTOC_EXPORT CodeGeneratorResponse : public ::google::protobuf::Messag
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -362,12 +388,12 @@ class LIBPROTOC_EXPORT CodeGeneratorResponse : public ::google::protobuf::Messag
   // @@protoc_insertion_point(class_scope:google.protobuf.compiler.CodeGeneratorResponse)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::std::string* error_;
   static const ::std::string _default_error_;
   ::google::protobuf::RepeatedPtrField< ::google::protobuf::compiler::CodeGeneratorResponse_File > file_;
-  friend void LIBPROTOC_EXPORT protobuf_AddDesc_google_2fprotobuf_2fcompiler_2fplugin_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2fcompiler_2fplugin_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2fcompiler_2fplugin_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2fcompiler_2fplugin_2eproto();
   
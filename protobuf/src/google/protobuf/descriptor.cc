@@ -48,6 +48,8 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/io/zero_copy_stream_impl.h>
 #include <google/protobuf/stubs/common.h>
+#include <google/protobuf/stubs/flat_hash_map.h>
+#include <google/protobuf/stubs/lockfree_hash_map.h>
 #include <google/protobuf/stubs/once.h>
 #include <google/protobuf/stubs/strutil.h>
 #include <google/protobuf/stubs/substitute.h>
@@ -59,6 +61,9 @@
 namespace google {
 namespace protobuf {
 
+using internal::FlatHashMap;
+using internal::LockFreeHashMap;
+
 const FieldDescriptor::CppType
 FieldDescriptor::kTypeToCppTypeMap[MAX_TYPE + 1] = {
   static_cast<CppType>(0),  // 0 is reserved for errors
@@ -163,6 +168,10 @@ string ToCamelCase(const string& input) {
 // pairs.  Unfortunately STL doesn't provide hash functions for pair<>,
 // so we must invent our own.
 //
+// The tables are FlatHashMaps rather than hash_maps:  a pool holds one
+// entry per symbol, and keeping each table in a single array saves a node
+// allocation per entry and a pointer chase per lookup.
+//
 // TODO(kenton):  Use StringPiece rather than const char* in keys?  It would
 //   be a lot cleaner but we'd just have to convert it back to const char*
 //   for the open source release.
@@ -274,23 +283,23 @@ struct Symbol {
 
 const Symbol kNullSymbol;
 
-typedef hash_map<const char*, Symbol,
-                 hash<const char*>, streq>
+typedef FlatHashMap<const char*, Symbol,
+                    hash<const char*>, streq>
   SymbolsByNameMap;
-typedef hash_map<PointerStringPair, Symbol,
-                 PointerStringPairHash, PointerStringPairEqual>
+typedef FlatHashMap<PointerStringPair, Symbol,
+                    PointerStringPairHash, PointerStringPairEqual>
   SymbolsByParentMap;
-typedef hash_map<const char*, const FileDescriptor*,
-                 hash<const char*>, streq>
+typedef FlatHashMap<const char*, const FileDescriptor*,
+                    hash<const char*>, streq>
   FilesByNameMap;
-typedef hash_map<PointerStringPair, const FieldDescriptor*,
-                 PointerStringPairHash, PointerStringPairEqual>
+typedef FlatHashMap<PointerStringPair, const FieldDescriptor*,
+                    PointerStringPairHash, PointerStringPairEqual>
   FieldsByNameMap;
-typedef hash_map<DescriptorIntPair, const FieldDescriptor*,
-                 PointerIntegerPairHash<DescriptorIntPair> >
+typedef FlatHashMap<DescriptorIntPair, const FieldDescriptor*,
+                    PointerIntegerPairHash<DescriptorIntPair> >
   FieldsByNumberMap;
-typedef hash_map<EnumIntPair, const EnumValueDescriptor*,
-                 PointerIntegerPairHash<EnumIntPair> >
+typedef FlatHashMap<EnumIntPair, const EnumValueDescriptor*,
+                    PointerIntegerPairHash<EnumIntPair> >
   EnumValuesByNumberMap;
 // This is a map rather than a hash_map, since we use it to iterate
 // through all the extensions that extend a given Descriptor, and an
@@ -321,6 +330,12 @@ class DescriptorPool::Tables {
   // everything that was added after that point.
   void Rollback();
 
+  // Makes every symbol and file which survives a Checkpoint() findable with
+  // FindPublishedSymbol() and FindPublishedFile().  Used by pools which have
+  // a mutex, so that lookups of descriptors which have already been built do
+  // not need to lock it.
+  void EnableLockFreeLookups() { lock_free_lookups_ = true; }
+
   // The stack of files which are currently being built.  Used to detect
   // cyclic dependencies when loading files from a DescriptorDatabase.  Not
   // used when fallback_database_ == NULL.
@@ -342,6 +357,12 @@ class DescriptorPool::Tables {
   // if not found.
   inline Symbol FindSymbol(const string& key) const;
 
+  // Like FindSymbol() and FindFile(), but only find things which were
+  // published by Checkpoint(), and may be called without holding the pool's
+  // mutex.  Always return null unless EnableLockFreeLookups() was called.
+  inline Symbol FindPublishedSymbol(const string& key) const;
+  inline const FileDescriptor* FindPublishedFile(const string& key) const;
+
   // This implements the body of DescriptorPool::Find*ByName().  It should
   // really be a private method of DescriptorPool, but that would require
   // declaring Symbol in descriptor.h, which would drag all kinds of other
@@ -403,6 +424,14 @@ class DescriptorPool::Tables {
   FilesByNameMap        files_by_name_;
   ExtensionsGroupedByDescriptorMap extensions_;
 
+  // Copies of symbols_by_name_ and files_by_name_, minus anything added since
+  // the last Checkpoint().  Only maintained if lock_free_lookups_.
+  bool lock_free_lookups_;
+  LockFreeHashMap<const char*, Symbol, hash<const char*>, streq>
+    published_symbols_;
+  LockFreeHashMap<const char*, const FileDescriptor*, hash<const char*>, streq>
+    published_files_;
+
   int strings_before_checkpoint_;
   int messages_before_checkpoint_;
   int file_tables_before_checkpoint_;
@@ -479,7 +508,8 @@ class FileDescriptorTables {
 };
 
 DescriptorPool::Tables::Tables()
-  : strings_before_checkpoint_(0),
+  : lock_free_lookups_(false),
+    strings_before_checkpoint_(0),
     messages_before_checkpoint_(0),
     allocations_before_checkpoint_(0) {}
 
@@ -500,6 +530,19 @@ FileDescriptorTables::~FileDescriptorTables() {}
 const FileDescriptorTables FileDescriptorTables::kEmpty;
 
 void DescriptorPool::Tables::Checkpoint() {
+  // Everything added since the last checkpoint is now permanent, so it can
+  // be published.
+  if (lock_free_lookups_) {
+    for (int i = 0; i < symbols_after_checkpoint_.size(); i++) {
+      const char* name = symbols_after_checkpoint_[i];
+      published_symbols_.Insert(name, *FindOrNull(symbols_by_name_, name));
+    }
+    for (int i = 0; i < files_after_checkpoint_.size(); i++) {
+      const char* name = files_after_checkpoint_[i];
+      published_files_.Insert(name, FindPtrOrNull(files_by_name_, name));
+    }
+  }
+
   strings_before_checkpoint_ = strings_.size();
   messages_before_checkpoint_ = messages_.size();
   file_tables_before_checkpoint_ = file_tables_.size();
@@ -552,6 +595,16 @@ inline Symbol DescriptorPool::Tables::FindSymbol(const string& key) const {
   }
 }
 
+inline Symbol DescriptorPool::Tables::FindPublishedSymbol(
+    const string& key) const {
+  return published_symbols_.Find(key.c_str());
+}
+
+inline const FileDescriptor* DescriptorPool::Tables::FindPublishedFile(
+    const string& key) const {
+  return published_files_.Find(key.c_str());
+}
+
 inline Symbol FileDescriptorTables::FindNestedSymbol(
     const void* parent, const string& name) const {
   const Symbol* result =
@@ -572,8 +625,13 @@ inline Symbol FileDescriptorTables::FindNestedSymbolOfType(
 
 Symbol DescriptorPool::Tables::FindByNameHelper(
     const DescriptorPool* pool, const string& name) const {
-  MutexLockMaybe lock(pool->mutex_);
-  Symbol result = FindSymbol(name);
+  Symbol result = FindPublishedSymbol(name);
+  if (!result.IsNull()) return result;
+
+  {
+    ReaderMutexLockMaybe lock(pool->mutex_);
+    result = FindSymbol(name);
+  }
 
   if (result.IsNull() && pool->underlay_ != NULL) {
     // Symbol not found; check the underlay.
@@ -581,9 +639,13 @@ Symbol DescriptorPool::Tables::FindByNameHelper(
       pool->underlay_->tables_->FindByNameHelper(pool->underlay_, name);
   }
 
-  if (result.IsNull()) {
-    // Symbol still not found, so check fallback database.
-    if (pool->TryFindSymbolInFallbackDatabase(name)) {
+  if (result.IsNull() && pool->fallback_database_ != NULL) {
+    // Symbol still not found, so check fallback database.  Another thread
+    // may have loaded it since we looked, so look again once we hold the
+    // mutex exclusively.
+    MutexLock lock(pool->mutex_);
+    result = FindSymbol(name);
+    if (result.IsNull() && pool->TryFindSymbolInFallbackDatabase(name)) {
       result = FindSymbol(name);
     }
   }
@@ -766,6 +828,7 @@ DescriptorPool::DescriptorPool(DescriptorDatabase* fallback_database,
     tables_(new Tables),
     enforce_dependencies_(true),
     allow_unknown_(false) {
+  tables_->EnableLockFreeLookups();
 }
 
 DescriptorPool::DescriptorPool(const DescriptorPool* underlay)
@@ -789,7 +852,7 @@ void DescriptorPool::InternalDontEnforceDependencies() {
 }
 
 bool DescriptorPool::InternalIsFileLoaded(const string& filename) const {
-  MutexLockMaybe lock(mutex_);
+  ReaderMutexLockMaybe lock(mutex_);
   return tables_->FindFile(filename) != NULL;
 }
 
@@ -852,12 +915,21 @@ void DescriptorPool::InternalAddGeneratedFile(
   // FileDescriptorProto and generates a FileDescriptor (and all its children)
   // based on it.
   //
+  // We do not even parse the bytes to index the symbols they define until
+  // someone searches the pool for a symbol rather than a file (see
+  // EncodedDescriptorDatabase::AddLazily()), so that process startup does not
+  // pay for every file linked into the binary.
+  //
   // Note that FileDescriptorProto is itself a generated protocol message.
   // Therefore, when we parse one, we have to be very careful to avoid using
   // any descriptor-based operations, since this might cause infinite recursion
   // or deadlock.
+  //
+  // The pool only searches generated_database_ with its mutex held, which
+  // also covers files registered by shared libraries loaded later on.
   InitGeneratedPoolOnce();
-  GOOGLE_CHECK(generated_database_->Add(encoded_file_descriptor, size));
+  MutexLock lock(generated_pool_->mutex_);
+  generated_database_->AddLazily(encoded_file_descriptor, size);
 }
 
 
@@ -867,34 +939,59 @@ void DescriptorPool::InternalAddGeneratedFile(
 //   there's any good way to factor it out.  Think about this some time when
 //   there's nothing more important to do (read: never).
 
+// The Find*() methods below first look for descriptors which have already
+// been built, which they can do without locking (see FindPublishedSymbol()) or
+// with mutex_ held in shared mode.  Only if that fails and there is a
+// fallback_database_ do they lock mutex_ exclusively, so that they can build
+// files, and then they must look again in case another thread built the file
+// in the meantime.
+
 const FileDescriptor* DescriptorPool::FindFileByName(const string& name) const {
-  MutexLockMaybe lock(mutex_);
-  const FileDescriptor* result = tables_->FindFile(name);
+  const FileDescriptor* result = tables_->FindPublishedFile(name);
   if (result != NULL) return result;
+  {
+    ReaderMutexLockMaybe lock(mutex_);
+    result = tables_->FindFile(name);
+    if (result != NULL) return result;
+  }
   if (underlay_ != NULL) {
     const FileDescriptor* result = underlay_->FindFileByName(name);
     if (result != NULL) return result;
   }
-  if (TryFindFileInFallbackDatabase(name)) {
-    const FileDescriptor* result = tables_->FindFile(name);
+  if (fallback_database_ != NULL) {
+    MutexLock lock(mutex_);
+    result = tables_->FindFile(name);
     if (result != NULL) return result;
+    if (TryFindFileInFallbackDatabase(name)) {
+      const FileDescriptor* result = tables_->FindFile(name);
+      if (result != NULL) return result;
+    }
   }
   return NULL;
 }
 
 const FileDescriptor* DescriptorPool::FindFileContainingSymbol(
     const string& symbol_name) const {
-  MutexLockMaybe lock(mutex_);
-  Symbol result = tables_->FindSymbol(symbol_name);
+  Symbol result = tables_->FindPublishedSymbol(symbol_name);
   if (!result.IsNull()) return result.GetFile();
+  {
+    ReaderMutexLockMaybe lock(mutex_);
+    result = tables_->FindSymbol(symbol_name);
+    if (!result.IsNull()) return result.GetFile();
+  }
   if (underlay_ != NULL) {
     const FileDescriptor* result =
       underlay_->FindFileContainingSymbol(symbol_name);
     if (result != NULL) return result;
   }
-  if (TryFindSymbolInFallbackDatabase(symbol_name)) {
-    Symbol result = tables_->FindSymbol(symbol_name);
+  if (fallback_database_ != NULL) {
+    MutexLock lock(mutex_);
+    result = tables_->FindSymbol(symbol_name);
     if (!result.IsNull()) return result.GetFile();
+    if (TryFindSymbolInFallbackDatabase(symbol_name)) {
+      Symbol result = tables_->FindSymbol(symbol_name);
+      if (!result.IsNull()) return result.GetFile();
+    }
   }
   return NULL;
 }
@@ -954,33 +1051,46 @@ const MethodDescriptor* DescriptorPool::FindMethodByName(
 
 const FieldDescriptor* DescriptorPool::FindExtensionByNumber(
     const Descriptor* extendee, int number) const {
-  MutexLockMaybe lock(mutex_);
-  const FieldDescriptor* result = tables_->FindExtension(extendee, number);
-  if (result != NULL) {
-    return result;
+  {
+    ReaderMutexLockMaybe lock(mutex_);
+    const FieldDescriptor* result = tables_->FindExtension(extendee, number);
+    if (result != NULL) {
+      return result;
+    }
   }
   if (underlay_ != NULL) {
     const FieldDescriptor* result =
       underlay_->FindExtensionByNumber(extendee, number);
     if (result != NULL) return result;
   }
-  if (TryFindExtensionInFallbackDatabase(extendee, number)) {
+  if (fallback_database_ != NULL) {
+    MutexLock lock(mutex_);
     const FieldDescriptor* result = tables_->FindExtension(extendee, number);
     if (result != NULL) {
       return result;
     }
+    if (TryFindExtensionInFallbackDatabase(extendee, number)) {
+      const FieldDescriptor* result = tables_->FindExtension(extendee, number);
+      if (result != NULL) {
+        return result;
+      }
+    }
   }
   return NULL;
 }
 
 void DescriptorPool::FindAllExtensions(
     const Descriptor* extendee, vector<const FieldDescriptor*>* out) const {
-  MutexLockMaybe lock(mutex_);
+  bool loaded_from_db = true;
+  if (fallback_database_ != NULL) {
+    ReaderMutexLock lock(mutex_);
+    loaded_from_db = tables_->extensions_loaded_from_db_.count(extendee) > 0;
+  }
 
   // Initialize tables_->extensions_ from the fallback database first
   // (but do this only once per descriptor).
-  if (fallback_database_ != NULL &&
-      tables_->extensions_loaded_from_db_.count(extendee) == 0) {
+  if (!loaded_from_db) {
+    MutexLock lock(mutex_);
     vector<int> numbers;
     if (fallback_database_->FindAllExtensionNumbers(extendee->full_name(),
                                                     &numbers)) {
@@ -994,7 +1104,10 @@ void DescriptorPool::FindAllExtensions(
     }
   }
 
-  tables_->FindAllExtensions(extendee, out);
+  {
+    ReaderMutexLockMaybe lock(mutex_);
+    tables_->FindAllExtensions(extendee, out);
+  }
   if (underlay_ != NULL) {
     underlay_->FindAllExtensions(extendee, out);
   }
@@ -2263,7 +2376,7 @@ Symbol DescriptorBuilder::FindSymbolNotEnforcingDeps(const string& name) {
   while (true) {
     // If we are looking at an underlay, we must lock its mutex_, since we are
     // accessing the underlay's tables_ dircetly.
-    MutexLockMaybe lock((pool == pool_) ? NULL : pool->mutex_);
+    ReaderMutexLockMaybe lock((pool == pool_) ? NULL : pool->mutex_);
 
     // Note that we don't have to check fallback_database_ here because the
     // symbol has to be in one of its file's direct dependencies, and we have
@@ -944,10 +944,10 @@ class LIBPROTOBUF_EXPORT DescriptorPool {
   // - The Find*By*() methods may block the calling thread if the
   //   DescriptorDatabase blocks.  This in turn means that parsing messages
   //   may block if they need to look up extensions.
-  // - The Find*By*() methods will use mutexes for thread-safety, thus making
-  //   them slower even when they don't have to fall back to the database.
-  //   In fact, even the Find*By*() methods of descriptor objects owned by
-  //   this pool will be slower, since they will have to obtain locks too.
+  // - The Find*By*() methods are thread-safe.  Looking up a file or symbol
+  //   by name which has already been loaded takes no lock at all; other
+  //   lookups take a reader lock, and only a lookup which has to fall back
+  //   to the database locks the pool exclusively.
   // - An ErrorCollector may optionally be given to collect validation errors
   //   in files loaded from the database.  If not given, errors will be printed
   //   to GOOGLE_LOG(ERROR).  Remember that files are built on-demand, so this
@@ -1148,7 +1148,8 @@ class LIBPROTOBUF_EXPORT DescriptorPool {
     const FileDescriptorProto& proto) const;
 
   // If fallback_database_ is NULL, this is NULL.  Otherwise, this is a mutex
-  // which must be locked while accessing tables_.
+  // which must be held (in shared mode, for lookups) while accessing tables_,
+  // except through its lock-free lookup methods.
   Mutex* mutex_;
 
   // See constructor.
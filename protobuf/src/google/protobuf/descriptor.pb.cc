@@ -79,6 +79,7 @@ const ::google::protobuf::internal::GeneratedMessageReflection*
 
 void protobuf_AssignDesc_google_2fprotobuf_2fdescriptor_2eproto() {
   protobuf_AddDesc_google_2fprotobuf_2fdescriptor_2eproto();
+  protobuf_InitDefaults_google_2fprotobuf_2fdescriptor_2eproto();
   const ::google::protobuf::FileDescriptor* file =
     ::google::protobuf::DescriptorPool::generated_pool()->FindFileByName(
       "google/protobuf/descriptor.proto");
@@ -251,7 +252,7 @@ void protobuf_AssignDesc_google_2fprotobuf_2fdescriptor_2eproto() {
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(MethodDescriptorProto));
   FileOptions_descriptor_ = file->message_type(8);
-  static const int FileOptions_offsets_[8] = {
+  static const int FileOptions_offsets_[11] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FileOptions, java_package_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FileOptions, java_outer_classname_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FileOptions, java_multiple_files_),
@@ -259,6 +260,9 @@ void protobuf_AssignDesc_google_2fprotobuf_2fdescriptor_2eproto() {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FileOptions, cc_generic_services_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FileOptions, java_generic_services_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FileOptions, py_generic_services_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FileOptions, cc_enable_arenas_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FileOptions, cc_table_driven_parsing_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FileOptions, cc_raw_unknown_fields_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FileOptions, uninterpreted_option_),
   };
   FileOptions_reflection_ =
@@ -291,9 +295,10 @@ void protobuf_AssignDesc_google_2fprotobuf_2fdescriptor_2eproto() {
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(MessageOptions));
   FieldOptions_descriptor_ = file->message_type(10);
-  static const int FieldOptions_offsets_[5] = {
+  static const int FieldOptions_offsets_[6] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FieldOptions, ctype_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FieldOptions, packed_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FieldOptions, lazy_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FieldOptions, deprecated_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FieldOptions, experimental_map_key_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FieldOptions, uninterpreted_option_),
@@ -497,6 +502,66 @@ void protobuf_ShutdownFile_google_2fprotobuf_2fdescriptor_2eproto() {
   delete UninterpretedOption_NamePart_reflection_;
 }
 
+void protobuf_InitDefaults_google_2fprotobuf_2fdescriptor_2eproto_impl() {
+  FileDescriptorSet::default_instance_ = new FileDescriptorSet();
+  FileDescriptorProto::default_instance_ = new FileDescriptorProto();
+  DescriptorProto::default_instance_ = new DescriptorProto();
+  DescriptorProto_ExtensionRange::default_instance_ = new DescriptorProto_ExtensionRange();
+  FieldDescriptorProto::default_instance_ = new FieldDescriptorProto();
+  EnumDescriptorProto::default_instance_ = new EnumDescriptorProto();
+  EnumValueDescriptorProto::default_instance_ = new EnumValueDescriptorProto();
+  ServiceDescriptorProto::default_instance_ = new ServiceDescriptorProto();
+  MethodDescriptorProto::default_instance_ = new MethodDescriptorProto();
+  FileOptions::default_instance_ = new FileOptions();
+  MessageOptions::default_instance_ = new MessageOptions();
+  FieldOptions::default_instance_ = new FieldOptions();
+  EnumOptions::default_instance_ = new EnumOptions();
+  EnumValueOptions::default_instance_ = new EnumValueOptions();
+  ServiceOptions::default_instance_ = new ServiceOptions();
+  MethodOptions::default_instance_ = new MethodOptions();
+  UninterpretedOption::default_instance_ = new UninterpretedOption();
+  UninterpretedOption_NamePart::default_instance_ = new UninterpretedOption_NamePart();
+  FileDescriptorSet::default_instance_->InitAsDefaultInstance();
+  FileDescriptorProto::default_instance_->InitAsDefaultInstance();
+  DescriptorProto::default_instance_->InitAsDefaultInstance();
+  DescriptorProto_ExtensionRange::default_instance_->InitAsDefaultInstance();
+  FieldDescriptorProto::default_instance_->InitAsDefaultInstance();
+  EnumDescriptorProto::default_instance_->InitAsDefaultInstance();
+  EnumValueDescriptorProto::default_instance_->InitAsDefaultInstance();
+  ServiceDescriptorProto::default_instance_->InitAsDefaultInstance();
+  MethodDescriptorProto::default_instance_->InitAsDefaultInstance();
+  FileOptions::default_instance_->InitAsDefaultInstance();
+  MessageOptions::default_instance_->InitAsDefaultInstance();
+  FieldOptions::default_instance_->InitAsDefaultInstance();
+  EnumOptions::default_instance_->InitAsDefaultInstance();
+  EnumValueOptions::default_instance_->InitAsDefaultInstance();
+  ServiceOptions::default_instance_->InitAsDefaultInstance();
+  MethodOptions::default_instance_->InitAsDefaultInstance();
+  UninterpretedOption::default_instance_->InitAsDefaultInstance();
+  UninterpretedOption_NamePart::default_instance_->InitAsDefaultInstance();
+  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_google_2fprotobuf_2fdescriptor_2eproto);
+}
+
+namespace {
+
+GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_InitDefaults_once_);
+// Set once the defaults are built, so that default_instance() and the
+// other callers on hot paths can skip the once.
+::google::protobuf::internal::Atomic32 protobuf_InitDefaults_done_ = 0;
+
+}  // namespace
+
+void protobuf_InitDefaults_google_2fprotobuf_2fdescriptor_2eproto() {
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) != 0) {
+    return;
+  }
+  ::google::protobuf::GoogleOnceInit(&protobuf_InitDefaults_once_,
+                 &protobuf_InitDefaults_google_2fprotobuf_2fdescriptor_2eproto_impl);
+  ::google::protobuf::internal::Release_Store(
+      &protobuf_InitDefaults_done_, 1);
+}
+
 void protobuf_AddDesc_google_2fprotobuf_2fdescriptor_2eproto() {
   static bool already_here = false;
   if (already_here) return;
@@ -556,86 +621,52 @@ void protobuf_AddDesc_google_2fprotobuf_2fdescriptor_2eproto() {
     "ptions\"\177\n\025MethodDescriptorProto\022\014\n\004name\030"
     "\001 \001(\t\022\022\n\ninput_type\030\002 \001(\t\022\023\n\013output_type"
     "\030\003 \001(\t\022/\n\007options\030\004 \001(\0132\036.google.protobu"
-    "f.MethodOptions\"\244\003\n\013FileOptions\022\024\n\014java_"
+    "f.MethodOptions\"\223\004\n\013FileOptions\022\024\n\014java_"
     "package\030\001 \001(\t\022\034\n\024java_outer_classname\030\010 "
     "\001(\t\022\"\n\023java_multiple_files\030\n \001(\010:\005false\022"
     "F\n\014optimize_for\030\t \001(\0162).google.protobuf."
     "FileOptions.OptimizeMode:\005SPEED\022!\n\023cc_ge"
     "neric_services\030\020 \001(\010:\004true\022#\n\025java_gener"
     "ic_services\030\021 \001(\010:\004true\022!\n\023py_generic_se"
-    "rvices\030\022 \001(\010:\004true\022C\n\024uninterpreted_opti"
-    "on\030\347\007 \003(\0132$.google.protobuf.Uninterprete"
-    "dOption\":\n\014OptimizeMode\022\t\n\005SPEED\020\001\022\r\n\tCO"
-    "DE_SIZE\020\002\022\020\n\014LITE_RUNTIME\020\003*\t\010\350\007\020\200\200\200\200\002\"\270"
-    "\001\n\016MessageOptions\022&\n\027message_set_wire_fo"
-    "rmat\030\001 \001(\010:\005false\022.\n\037no_standard_descrip"
-    "tor_accessor\030\002 \001(\010:\005false\022C\n\024uninterpret"
-    "ed_option\030\347\007 \003(\0132$.google.protobuf.Unint"
-    "erpretedOption*\t\010\350\007\020\200\200\200\200\002\"\224\002\n\014FieldOptio"
-    "ns\022:\n\005ctype\030\001 \001(\0162#.google.protobuf.Fiel"
-    "dOptions.CType:\006STRING\022\016\n\006packed\030\002 \001(\010\022\031"
-    "\n\ndeprecated\030\003 \001(\010:\005false\022\034\n\024experimenta"
-    "l_map_key\030\t \001(\t\022C\n\024uninterpreted_option\030"
-    "\347\007 \003(\0132$.google.protobuf.UninterpretedOp"
-    "tion\"/\n\005CType\022\n\n\006STRING\020\000\022\010\n\004CORD\020\001\022\020\n\014S"
-    "TRING_PIECE\020\002*\t\010\350\007\020\200\200\200\200\002\"]\n\013EnumOptions\022"
-    "C\n\024uninterpreted_option\030\347\007 \003(\0132$.google."
-    "protobuf.UninterpretedOption*\t\010\350\007\020\200\200\200\200\002\""
-    "b\n\020EnumValueOptions\022C\n\024uninterpreted_opt"
-    "ion\030\347\007 \003(\0132$.google.protobuf.Uninterpret"
-    "edOption*\t\010\350\007\020\200\200\200\200\002\"`\n\016ServiceOptions\022C\n"
-    "\024uninterpreted_option\030\347\007 \003(\0132$.google.pr"
-    "otobuf.UninterpretedOption*\t\010\350\007\020\200\200\200\200\002\"_\n"
-    "\rMethodOptions\022C\n\024uninterpreted_option\030\347"
-    "\007 \003(\0132$.google.protobuf.UninterpretedOpt"
-    "ion*\t\010\350\007\020\200\200\200\200\002\"\205\002\n\023UninterpretedOption\022;"
-    "\n\004name\030\002 \003(\0132-.google.protobuf.Uninterpr"
-    "etedOption.NamePart\022\030\n\020identifier_value\030"
-    "\003 \001(\t\022\032\n\022positive_int_value\030\004 \001(\004\022\032\n\022neg"
-    "ative_int_value\030\005 \001(\003\022\024\n\014double_value\030\006 "
-    "\001(\001\022\024\n\014string_value\030\007 \001(\014\0323\n\010NamePart\022\021\n"
-    "\tname_part\030\001 \002(\t\022\024\n\014is_extension\030\002 \002(\010B)"
-    "\n\023com.google.protobufB\020DescriptorProtosH"
-    "\001", 3681);
+    "rvices\030\022 \001(\010:\004true\022\037\n\020cc_enable_arenas\030\037"
+    " \001(\010:\005false\022&\n\027cc_table_driven_parsing\030 "
+    " \001(\010:\005false\022$\n\025cc_raw_unknown_fields\030! \001"
+    "(\010:\005false\022C\n\024uninterpreted_option\030\347\007 \003(\013"
+    "2$.google.protobuf.UninterpretedOption\":"
+    "\n\014OptimizeMode\022\t\n\005SPEED\020\001\022\r\n\tCODE_SIZE\020\002"
+    "\022\020\n\014LITE_RUNTIME\020\003*\t\010\350\007\020\200\200\200\200\002\"\270\001\n\016Messag"
+    "eOptions\022&\n\027message_set_wire_format\030\001 \001("
+    "\010:\005false\022.\n\037no_standard_descriptor_acces"
+    "sor\030\002 \001(\010:\005false\022C\n\024uninterpreted_option"
+    "\030\347\007 \003(\0132$.google.protobuf.UninterpretedO"
+    "ption*\t\010\350\007\020\200\200\200\200\002\"\251\002\n\014FieldOptions\022:\n\005cty"
+    "pe\030\001 \001(\0162#.google.protobuf.FieldOptions."
+    "CType:\006STRING\022\016\n\006packed\030\002 \001(\010\022\023\n\004lazy\030\005 "
+    "\001(\010:\005false\022\031\n\ndeprecated\030\003 \001(\010:\005false\022\034\n"
+    "\024experimental_map_key\030\t \001(\t\022C\n\024uninterpr"
+    "eted_option\030\347\007 \003(\0132$.google.protobuf.Uni"
+    "nterpretedOption\"/\n\005CType\022\n\n\006STRING\020\000\022\010\n"
+    "\004CORD\020\001\022\020\n\014STRING_PIECE\020\002*\t\010\350\007\020\200\200\200\200\002\"]\n\013"
+    "EnumOptions\022C\n\024uninterpreted_option\030\347\007 \003"
+    "(\0132$.google.protobuf.UninterpretedOption"
+    "*\t\010\350\007\020\200\200\200\200\002\"b\n\020EnumValueOptions\022C\n\024unint"
+    "erpreted_option\030\347\007 \003(\0132$.google.protobuf"
+    ".UninterpretedOption*\t\010\350\007\020\200\200\200\200\002\"`\n\016Servi"
+    "ceOptions\022C\n\024uninterpreted_option\030\347\007 \003(\013"
+    "2$.google.protobuf.UninterpretedOption*\t"
+    "\010\350\007\020\200\200\200\200\002\"_\n\rMethodOptions\022C\n\024uninterpre"
+    "ted_option\030\347\007 \003(\0132$.google.protobuf.Unin"
+    "terpretedOption*\t\010\350\007\020\200\200\200\200\002\"\205\002\n\023Uninterpr"
+    "etedOption\022;\n\004name\030\002 \003(\0132-.google.protob"
+    "uf.UninterpretedOption.NamePart\022\030\n\020ident"
+    "ifier_value\030\003 \001(\t\022\032\n\022positive_int_value\030"
+    "\004 \001(\004\022\032\n\022negative_int_value\030\005 \001(\003\022\024\n\014dou"
+    "ble_value\030\006 \001(\001\022\024\n\014string_value\030\007 \001(\014\0323\n"
+    "\010NamePart\022\021\n\tname_part\030\001 \002(\t\022\024\n\014is_exten"
+    "sion\030\002 \002(\010B)\n\023com.google.protobufB\020Descr"
+    "iptorProtosH\001", 3813);
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
     "google/protobuf/descriptor.proto", &protobuf_RegisterTypes);
-  FileDescriptorSet::default_instance_ = new FileDescriptorSet();
-  FileDescriptorProto::default_instance_ = new FileDescriptorProto();
-  DescriptorProto::default_instance_ = new DescriptorProto();
-  DescriptorProto_ExtensionRange::default_instance_ = new DescriptorProto_ExtensionRange();
-  FieldDescriptorProto::default_instance_ = new FieldDescriptorProto();
-  EnumDescriptorProto::default_instance_ = new EnumDescriptorProto();
-  EnumValueDescriptorProto::default_instance_ = new EnumValueDescriptorProto();
-  ServiceDescriptorProto::default_instance_ = new ServiceDescriptorProto();
-  MethodDescriptorProto::default_instance_ = new MethodDescriptorProto();
-  FileOptions::default_instance_ = new FileOptions();
-  MessageOptions::default_instance_ = new MessageOptions();
-  FieldOptions::default_instance_ = new FieldOptions();
-  EnumOptions::default_instance_ = new EnumOptions();
-  EnumValueOptions::default_instance_ = new EnumValueOptions();
-  ServiceOptions::default_instance_ = new ServiceOptions();
-  MethodOptions::default_instance_ = new MethodOptions();
-  UninterpretedOption::default_instance_ = new UninterpretedOption();
-  UninterpretedOption_NamePart::default_instance_ = new UninterpretedOption_NamePart();
-  FileDescriptorSet::default_instance_->InitAsDefaultInstance();
-  FileDescriptorProto::default_instance_->InitAsDefaultInstance();
-  DescriptorProto::default_instance_->InitAsDefaultInstance();
-  DescriptorProto_ExtensionRange::default_instance_->InitAsDefaultInstance();
-  FieldDescriptorProto::default_instance_->InitAsDefaultInstance();
-  EnumDescriptorProto::default_instance_->InitAsDefaultInstance();
-  EnumValueDescriptorProto::default_instance_->InitAsDefaultInstance();
-  ServiceDescriptorProto::default_instance_->InitAsDefaultInstance();
-  MethodDescriptorProto::default_instance_->InitAsDefaultInstance();
-  FileOptions::default_instance_->InitAsDefaultInstance();
-  MessageOptions::default_instance_->InitAsDefaultInstance();
-  FieldOptions::default_instance_->InitAsDefaultInstance();
-  EnumOptions::default_instance_->InitAsDefaultInstance();
-  EnumValueOptions::default_instance_->InitAsDefaultInstance();
-  ServiceOptions::default_instance_->InitAsDefaultInstance();
-  MethodOptions::default_instance_->InitAsDefaultInstance();
-  UninterpretedOption::default_instance_->InitAsDefaultInstance();
-  UninterpretedOption_NamePart::default_instance_->InitAsDefaultInstance();
-  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_google_2fprotobuf_2fdescriptor_2eproto);
 }
 
 // Force AddDescriptors() to be called at static initialization time.
@@ -681,9 +712,7 @@ void FileDescriptorSet::SharedDtor() {
 }
 
 void FileDescriptorSet::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* FileDescriptorSet::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -691,7 +720,11 @@ const ::google::protobuf::Descriptor* FileDescriptorSet::descriptor() {
 }
 
 const FileDescriptorSet& FileDescriptorSet::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2fdescriptor_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2fdescriptor_2eproto();
+  }
+  return *default_instance_;
 }
 
 FileDescriptorSet* FileDescriptorSet::default_instance_ = NULL;
@@ -789,9 +822,8 @@ int FileDescriptorSet::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -872,7 +904,8 @@ FileDescriptorProto::FileDescriptorProto()
 }
 
 void FileDescriptorProto::InitAsDefaultInstance() {
-  options_ = const_cast< ::google::protobuf::FileOptions*>(&::google::protobuf::FileOptions::default_instance());
+  options_ = const_cast< ::google::protobuf::FileOptions*>(
+      ::google::protobuf::FileOptions::internal_default_instance());
 }
 
 FileDescriptorProto::FileDescriptorProto(const FileDescriptorProto& from)
@@ -906,9 +939,7 @@ void FileDescriptorProto::SharedDtor() {
 }
 
 void FileDescriptorProto::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* FileDescriptorProto::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -916,7 +947,11 @@ const ::google::protobuf::Descriptor* FileDescriptorProto::descriptor() {
 }
 
 const FileDescriptorProto& FileDescriptorProto::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2fdescriptor_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2fdescriptor_2eproto();
+  }
+  return *default_instance_;
 }
 
 FileDescriptorProto* FileDescriptorProto::default_instance_ = NULL;
@@ -1305,9 +1340,8 @@ int FileDescriptorProto::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -1439,9 +1473,7 @@ void DescriptorProto_ExtensionRange::SharedDtor() {
 }
 
 void DescriptorProto_ExtensionRange::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* DescriptorProto_ExtensionRange::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -1449,7 +1481,11 @@ const ::google::protobuf::Descriptor* DescriptorProto_ExtensionRange::descriptor
 }
 
 const DescriptorProto_ExtensionRange& DescriptorProto_ExtensionRange::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2fdescriptor_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2fdescriptor_2eproto();
+  }
+  return *default_instance_;
 }
 
 DescriptorProto_ExtensionRange* DescriptorProto_ExtensionRange::default_instance_ = NULL;
@@ -1581,9 +1617,8 @@ int DescriptorProto_ExtensionRange::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -1667,7 +1702,8 @@ DescriptorProto::DescriptorProto()
 }
 
 void DescriptorProto::InitAsDefaultInstance() {
-  options_ = const_cast< ::google::protobuf::MessageOptions*>(&::google::protobuf::MessageOptions::default_instance());
+  options_ = const_cast< ::google::protobuf::MessageOptions*>(
+      ::google::protobuf::MessageOptions::internal_default_instance());
 }
 
 DescriptorProto::DescriptorProto(const DescriptorProto& from)
@@ -1697,9 +1733,7 @@ void DescriptorProto::SharedDtor() {
 }
 
 void DescriptorProto::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* DescriptorProto::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -1707,7 +1741,11 @@ const ::google::protobuf::Descriptor* DescriptorProto::descriptor() {
 }
 
 const DescriptorProto& DescriptorProto::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2fdescriptor_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2fdescriptor_2eproto();
+  }
+  return *default_instance_;
 }
 
 DescriptorProto* DescriptorProto::default_instance_ = NULL;
@@ -2041,9 +2079,8 @@ int DescriptorProto::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -2232,7 +2269,8 @@ FieldDescriptorProto::FieldDescriptorProto()
 }
 
 void FieldDescriptorProto::InitAsDefaultInstance() {
-  options_ = const_cast< ::google::protobuf::FieldOptions*>(&::google::protobuf::FieldOptions::default_instance());
+  options_ = const_cast< ::google::protobuf::FieldOptions*>(
+      ::google::protobuf::FieldOptions::internal_default_instance());
 }
 
 FieldDescriptorProto::FieldDescriptorProto(const FieldDescriptorProto& from)
@@ -2277,9 +2315,7 @@ void FieldDescriptorProto::SharedDtor() {
 }
 
 void FieldDescriptorProto::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* FieldDescriptorProto::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -2287,7 +2323,11 @@ const ::google::protobuf::Descriptor* FieldDescriptorProto::descriptor() {
 }
 
 const FieldDescriptorProto& FieldDescriptorProto::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2fdescriptor_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2fdescriptor_2eproto();
+  }
+  return *default_instance_;
 }
 
 FieldDescriptorProto* FieldDescriptorProto::default_instance_ = NULL;
@@ -2694,9 +2734,8 @@ int FieldDescriptorProto::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -2803,7 +2842,8 @@ EnumDescriptorProto::EnumDescriptorProto()
 }
 
 void EnumDescriptorProto::InitAsDefaultInstance() {
-  options_ = const_cast< ::google::protobuf::EnumOptions*>(&::google::protobuf::EnumOptions::default_instance());
+  options_ = const_cast< ::google::protobuf::EnumOptions*>(
+      ::google::protobuf::EnumOptions::internal_default_instance());
 }
 
 EnumDescriptorProto::EnumDescriptorProto(const EnumDescriptorProto& from)
@@ -2833,9 +2873,7 @@ void EnumDescriptorProto::SharedDtor() {
 }
 
 void EnumDescriptorProto::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* EnumDescriptorProto::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -2843,7 +2881,11 @@ const ::google::protobuf::Descriptor* EnumDescriptorProto::descriptor() {
 }
 
 const EnumDescriptorProto& EnumDescriptorProto::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2fdescriptor_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2fdescriptor_2eproto();
+  }
+  return *default_instance_;
 }
 
 EnumDescriptorProto* EnumDescriptorProto::default_instance_ = NULL;
@@ -3029,9 +3071,8 @@ int EnumDescriptorProto::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -3119,7 +3160,8 @@ EnumValueDescriptorProto::EnumValueDescriptorProto()
 }
 
 void EnumValueDescriptorProto::InitAsDefaultInstance() {
-  options_ = const_cast< ::google::protobuf::EnumValueOptions*>(&::google::protobuf::EnumValueOptions::default_instance());
+  options_ = const_cast< ::google::protobuf::EnumValueOptions*>(
+      ::google::protobuf::EnumValueOptions::internal_default_instance());
 }
 
 EnumValueDescriptorProto::EnumValueDescriptorProto(const EnumValueDescriptorProto& from)
@@ -3150,9 +3192,7 @@ void EnumValueDescriptorProto::SharedDtor() {
 }
 
 void EnumValueDescriptorProto::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* EnumValueDescriptorProto::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -3160,7 +3200,11 @@ const ::google::protobuf::Descriptor* EnumValueDescriptorProto::descriptor() {
 }
 
 const EnumValueDescriptorProto& EnumValueDescriptorProto::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2fdescriptor_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2fdescriptor_2eproto();
+  }
+  return *default_instance_;
 }
 
 EnumValueDescriptorProto* EnumValueDescriptorProto::default_instance_ = NULL;
@@ -3343,9 +3387,8 @@ int EnumValueDescriptorProto::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -3432,7 +3475,8 @@ ServiceDescriptorProto::ServiceDescriptorProto()
 }
 
 void ServiceDescriptorProto::InitAsDefaultInstance() {
-  options_ = const_cast< ::google::protobuf::ServiceOptions*>(&::google::protobuf::ServiceOptions::default_instance());
+  options_ = const_cast< ::google::protobuf::ServiceOptions*>(
+      ::google::protobuf::ServiceOptions::internal_default_instance());
 }
 
 ServiceDescriptorProto::ServiceDescriptorProto(const ServiceDescriptorProto& from)
@@ -3462,9 +3506,7 @@ void ServiceDescriptorProto::SharedDtor() {
 }
 
 void ServiceDescriptorProto::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* ServiceDescriptorProto::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -3472,7 +3514,11 @@ const ::google::protobuf::Descriptor* ServiceDescriptorProto::descriptor() {
 }
 
 const ServiceDescriptorProto& ServiceDescriptorProto::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2fdescriptor_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2fdescriptor_2eproto();
+  }
+  return *default_instance_;
 }
 
 ServiceDescriptorProto* ServiceDescriptorProto::default_instance_ = NULL;
@@ -3658,9 +3704,8 @@ int ServiceDescriptorProto::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -3751,7 +3796,8 @@ MethodDescriptorProto::MethodDescriptorProto()
 }
 
 void MethodDescriptorProto::InitAsDefaultInstance() {
-  options_ = const_cast< ::google::protobuf::MethodOptions*>(&::google::protobuf::MethodOptions::default_instance());
+  options_ = const_cast< ::google::protobuf::MethodOptions*>(
+      ::google::protobuf::MethodOptions::internal_default_instance());
 }
 
 MethodDescriptorProto::MethodDescriptorProto(const MethodDescriptorProto& from)
@@ -3789,9 +3835,7 @@ void MethodDescriptorProto::SharedDtor() {
 }
 
 void MethodDescriptorProto::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* MethodDescriptorProto::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -3799,7 +3843,11 @@ const ::google::protobuf::Descriptor* MethodDescriptorProto::descriptor() {
 }
 
 const MethodDescriptorProto& MethodDescriptorProto::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2fdescriptor_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2fdescriptor_2eproto();
+  }
+  return *default_instance_;
 }
 
 MethodDescriptorProto* MethodDescriptorProto::default_instance_ = NULL;
@@ -4044,9 +4092,8 @@ int MethodDescriptorProto::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -4157,6 +4204,9 @@ const int FileOptions::kOptimizeForFieldNumber;
 const int FileOptions::kCcGenericServicesFieldNumber;
 const int FileOptions::kJavaGenericServicesFieldNumber;
 const int FileOptions::kPyGenericServicesFieldNumber;
+const int FileOptions::kCcEnableArenasFieldNumber;
+const int FileOptions::kCcTableDrivenParsingFieldNumber;
+const int FileOptions::kCcRawUnknownFieldsFieldNumber;
 const int FileOptions::kUninterpretedOptionFieldNumber;
 #endif  // !_MSC_VER
 
@@ -4183,6 +4233,9 @@ void FileOptions::SharedCtor() {
   cc_generic_services_ = true;
   java_generic_services_ = true;
   py_generic_services_ = true;
+  cc_enable_arenas_ = false;
+  cc_table_driven_parsing_ = false;
+  cc_raw_unknown_fields_ = false;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
@@ -4202,9 +4255,7 @@ void FileOptions::SharedDtor() {
 }
 
 void FileOptions::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* FileOptions::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -4212,7 +4263,11 @@ const ::google::protobuf::Descriptor* FileOptions::descriptor() {
 }
 
 const FileOptions& FileOptions::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2fdescriptor_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2fdescriptor_2eproto();
+  }
+  return *default_instance_;
 }
 
 FileOptions* FileOptions::default_instance_ = NULL;
@@ -4239,6 +4294,11 @@ void FileOptions::Clear() {
     cc_generic_services_ = true;
     java_generic_services_ = true;
     py_generic_services_ = true;
+    cc_enable_arenas_ = false;
+  }
+  if (_has_bits_[8 / 32] & (0xffu << (8 % 32))) {
+    cc_table_driven_parsing_ = false;
+    cc_raw_unknown_fields_ = false;
   }
   uninterpreted_option_.Clear();
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
@@ -4365,6 +4425,54 @@ bool FileOptions::MergePartialFromCodedStream(
         } else {
           goto handle_uninterpreted;
         }
+        if (input->ExpectTag(248)) goto parse_cc_enable_arenas;
+        break;
+      }
+      
+      // optional bool cc_enable_arenas = 31 [default = false];
+      case 31: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_cc_enable_arenas:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &cc_enable_arenas_)));
+          _set_bit(7);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(256)) goto parse_cc_table_driven_parsing;
+        break;
+      }
+      
+      // optional bool cc_table_driven_parsing = 32 [default = false];
+      case 32: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_cc_table_driven_parsing:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &cc_table_driven_parsing_)));
+          _set_bit(8);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(264)) goto parse_cc_raw_unknown_fields;
+        break;
+      }
+      
+      // optional bool cc_raw_unknown_fields = 33 [default = false];
+      case 33: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_cc_raw_unknown_fields:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &cc_raw_unknown_fields_)));
+          _set_bit(9);
+        } else {
+          goto handle_uninterpreted;
+        }
         if (input->ExpectTag(7994)) goto parse_uninterpreted_option;
         break;
       }
@@ -4391,7 +4499,7 @@ bool FileOptions::MergePartialFromCodedStream(
           return true;
         }
         if ((8000u <= tag)) {
-          DO_(_extensions_.ParseField(tag, input, default_instance_,
+          DO_(_extensions_.ParseField(tag, input, &default_instance(),
                                       mutable_unknown_fields()));
           continue;
         }
@@ -4451,6 +4559,21 @@ void FileOptions::SerializeWithCachedSizes(
     ::google::protobuf::internal::WireFormatLite::WriteBool(18, this->py_generic_services(), output);
   }
   
+  // optional bool cc_enable_arenas = 31 [default = false];
+  if (_has_bit(7)) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(31, this->cc_enable_arenas(), output);
+  }
+  
+  // optional bool cc_table_driven_parsing = 32 [default = false];
+  if (_has_bit(8)) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(32, this->cc_table_driven_parsing(), output);
+  }
+  
+  // optional bool cc_raw_unknown_fields = 33 [default = false];
+  if (_has_bit(9)) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(33, this->cc_raw_unknown_fields(), output);
+  }
+  
   // repeated .google.protobuf.UninterpretedOption uninterpreted_option = 999;
   for (int i = 0; i < this->uninterpreted_option_size(); i++) {
     ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
@@ -4515,6 +4638,21 @@ void FileOptions::SerializeWithCachedSizes(
     target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(18, this->py_generic_services(), target);
   }
   
+  // optional bool cc_enable_arenas = 31 [default = false];
+  if (_has_bit(7)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(31, this->cc_enable_arenas(), target);
+  }
+  
+  // optional bool cc_table_driven_parsing = 32 [default = false];
+  if (_has_bit(8)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(32, this->cc_table_driven_parsing(), target);
+  }
+  
+  // optional bool cc_raw_unknown_fields = 33 [default = false];
+  if (_has_bit(9)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(33, this->cc_raw_unknown_fields(), target);
+  }
+  
   // repeated .google.protobuf.UninterpretedOption uninterpreted_option = 999;
   for (int i = 0; i < this->uninterpreted_option_size(); i++) {
     target = ::google::protobuf::internal::WireFormatLite::
@@ -4577,6 +4715,23 @@ int FileOptions::ByteSize() const {
       total_size += 2 + 1;
     }
     
+    // optional bool cc_enable_arenas = 31 [default = false];
+    if (has_cc_enable_arenas()) {
+      total_size += 2 + 1;
+    }
+    
+  }
+  if (_has_bits_[8 / 32] & (0xffu << (8 % 32))) {
+    // optional bool cc_table_driven_parsing = 32 [default = false];
+    if (has_cc_table_driven_parsing()) {
+      total_size += 2 + 1;
+    }
+    
+    // optional bool cc_raw_unknown_fields = 33 [default = false];
+    if (has_cc_raw_unknown_fields()) {
+      total_size += 2 + 1;
+    }
+    
   }
   // repeated .google.protobuf.UninterpretedOption uninterpreted_option = 999;
   total_size += 2 * this->uninterpreted_option_size();
@@ -4593,9 +4748,8 @@ int FileOptions::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -4636,6 +4790,17 @@ void FileOptions::MergeFrom(const FileOptions& from) {
     if (from._has_bit(6)) {
       set_py_generic_services(from.py_generic_services());
     }
+    if (from._has_bit(7)) {
+      set_cc_enable_arenas(from.cc_enable_arenas());
+    }
+  }
+  if (from._has_bits_[8 / 32] & (0xffu << (8 % 32))) {
+    if (from._has_bit(8)) {
+      set_cc_table_driven_parsing(from.cc_table_driven_parsing());
+    }
+    if (from._has_bit(9)) {
+      set_cc_raw_unknown_fields(from.cc_raw_unknown_fields());
+    }
   }
   _extensions_.MergeFrom(from._extensions_);
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
@@ -4671,6 +4836,9 @@ void FileOptions::Swap(FileOptions* other) {
     std::swap(cc_generic_services_, other->cc_generic_services_);
     std::swap(java_generic_services_, other->java_generic_services_);
     std::swap(py_generic_services_, other->py_generic_services_);
+    std::swap(cc_enable_arenas_, other->cc_enable_arenas_);
+    std::swap(cc_table_driven_parsing_, other->cc_table_driven_parsing_);
+    std::swap(cc_raw_unknown_fields_, other->cc_raw_unknown_fields_);
     uninterpreted_option_.Swap(&other->uninterpreted_option_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
@@ -4727,9 +4895,7 @@ void MessageOptions::SharedDtor() {
 }
 
 void MessageOptions::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* MessageOptions::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -4737,7 +4903,11 @@ const ::google::protobuf::Descriptor* MessageOptions::descriptor() {
 }
 
 const MessageOptions& MessageOptions::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2fdescriptor_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2fdescriptor_2eproto();
+  }
+  return *default_instance_;
 }
 
 MessageOptions* MessageOptions::default_instance_ = NULL;
@@ -4816,7 +4986,7 @@ bool MessageOptions::MergePartialFromCodedStream(
           return true;
         }
         if ((8000u <= tag)) {
-          DO_(_extensions_.ParseField(tag, input, default_instance_,
+          DO_(_extensions_.ParseField(tag, input, &default_instance(),
                                       mutable_unknown_fields()));
           continue;
         }
@@ -4918,9 +5088,8 @@ int MessageOptions::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -5022,6 +5191,7 @@ const ::std::string FieldOptions::_default_experimental_map_key_;
 #ifndef _MSC_VER
 const int FieldOptions::kCtypeFieldNumber;
 const int FieldOptions::kPackedFieldNumber;
+const int FieldOptions::kLazyFieldNumber;
 const int FieldOptions::kDeprecatedFieldNumber;
 const int FieldOptions::kExperimentalMapKeyFieldNumber;
 const int FieldOptions::kUninterpretedOptionFieldNumber;
@@ -5045,6 +5215,7 @@ void FieldOptions::SharedCtor() {
   _cached_size_ = 0;
   ctype_ = 0;
   packed_ = false;
+  lazy_ = false;
   deprecated_ = false;
   experimental_map_key_ = const_cast< ::std::string*>(&_default_experimental_map_key_);
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
@@ -5063,9 +5234,7 @@ void FieldOptions::SharedDtor() {
 }
 
 void FieldOptions::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* FieldOptions::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -5073,7 +5242,11 @@ const ::google::protobuf::Descriptor* FieldOptions::descriptor() {
 }
 
 const FieldOptions& FieldOptions::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2fdescriptor_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2fdescriptor_2eproto();
+  }
+  return *default_instance_;
 }
 
 FieldOptions* FieldOptions::default_instance_ = NULL;
@@ -5087,8 +5260,9 @@ void FieldOptions::Clear() {
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
     ctype_ = 0;
     packed_ = false;
+    lazy_ = false;
     deprecated_ = false;
-    if (_has_bit(3)) {
+    if (_has_bit(4)) {
       if (experimental_map_key_ != &_default_experimental_map_key_) {
         experimental_map_key_->clear();
       }
@@ -5149,6 +5323,22 @@ bool FieldOptions::MergePartialFromCodedStream(
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
                    bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
                  input, &deprecated_)));
+          _set_bit(3);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(40)) goto parse_lazy;
+        break;
+      }
+      
+      // optional bool lazy = 5 [default = false];
+      case 5: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_lazy:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &lazy_)));
           _set_bit(2);
         } else {
           goto handle_uninterpreted;
@@ -5196,7 +5386,7 @@ bool FieldOptions::MergePartialFromCodedStream(
           return true;
         }
         if ((8000u <= tag)) {
-          DO_(_extensions_.ParseField(tag, input, default_instance_,
+          DO_(_extensions_.ParseField(tag, input, &default_instance(),
                                       mutable_unknown_fields()));
           continue;
         }
@@ -5224,12 +5414,17 @@ void FieldOptions::SerializeWithCachedSizes(
   }
   
   // optional bool deprecated = 3 [default = false];
-  if (_has_bit(2)) {
+  if (_has_bit(3)) {
     ::google::protobuf::internal::WireFormatLite::WriteBool(3, this->deprecated(), output);
   }
   
+  // optional bool lazy = 5 [default = false];
+  if (_has_bit(2)) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(5, this->lazy(), output);
+  }
+  
   // optional string experimental_map_key = 9;
-  if (_has_bit(3)) {
+  if (_has_bit(4)) {
     ::google::protobuf::internal::WireFormat::VerifyUTF8String(
       this->experimental_map_key().data(), this->experimental_map_key().length(),
       ::google::protobuf::internal::WireFormat::SERIALIZE);
@@ -5267,12 +5462,17 @@ void FieldOptions::SerializeWithCachedSizes(
   }
   
   // optional bool deprecated = 3 [default = false];
-  if (_has_bit(2)) {
+  if (_has_bit(3)) {
     target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(3, this->deprecated(), target);
   }
   
+  // optional bool lazy = 5 [default = false];
+  if (_has_bit(2)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(5, this->lazy(), target);
+  }
+  
   // optional string experimental_map_key = 9;
-  if (_has_bit(3)) {
+  if (_has_bit(4)) {
     ::google::protobuf::internal::WireFormat::VerifyUTF8String(
       this->experimental_map_key().data(), this->experimental_map_key().length(),
       ::google::protobuf::internal::WireFormat::SERIALIZE);
@@ -5314,6 +5514,11 @@ int FieldOptions::ByteSize() const {
       total_size += 1 + 1;
     }
     
+    // optional bool lazy = 5 [default = false];
+    if (has_lazy()) {
+      total_size += 1 + 1;
+    }
+    
     // optional bool deprecated = 3 [default = false];
     if (has_deprecated()) {
       total_size += 1 + 1;
@@ -5342,9 +5547,8 @@ int FieldOptions::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -5371,9 +5575,12 @@ void FieldOptions::MergeFrom(const FieldOptions& from) {
       set_packed(from.packed());
     }
     if (from._has_bit(2)) {
-      set_deprecated(from.deprecated());
+      set_lazy(from.lazy());
     }
     if (from._has_bit(3)) {
+      set_deprecated(from.deprecated());
+    }
+    if (from._has_bit(4)) {
       set_experimental_map_key(from.experimental_map_key());
     }
   }
@@ -5406,6 +5613,7 @@ void FieldOptions::Swap(FieldOptions* other) {
   if (other != this) {
     std::swap(ctype_, other->ctype_);
     std::swap(packed_, other->packed_);
+    std::swap(lazy_, other->lazy_);
     std::swap(deprecated_, other->deprecated_);
     std::swap(experimental_map_key_, other->experimental_map_key_);
     uninterpreted_option_.Swap(&other->uninterpreted_option_);
@@ -5460,9 +5668,7 @@ void EnumOptions::SharedDtor() {
 }
 
 void EnumOptions::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* EnumOptions::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -5470,7 +5676,11 @@ const ::google::protobuf::Descriptor* EnumOptions::descriptor() {
 }
 
 const EnumOptions& EnumOptions::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2fdescriptor_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2fdescriptor_2eproto();
+  }
+  return *default_instance_;
 }
 
 EnumOptions* EnumOptions::default_instance_ = NULL;
@@ -5514,7 +5724,7 @@ bool EnumOptions::MergePartialFromCodedStream(
           return true;
         }
         if ((8000u <= tag)) {
-          DO_(_extensions_.ParseField(tag, input, default_instance_,
+          DO_(_extensions_.ParseField(tag, input, &default_instance(),
                                       mutable_unknown_fields()));
           continue;
         }
@@ -5584,9 +5794,8 @@ int EnumOptions::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -5684,9 +5893,7 @@ void EnumValueOptions::SharedDtor() {
 }
 
 void EnumValueOptions::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* EnumValueOptions::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -5694,7 +5901,11 @@ const ::google::protobuf::Descriptor* EnumValueOptions::descriptor() {
 }
 
 const EnumValueOptions& EnumValueOptions::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2fdescriptor_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2fdescriptor_2eproto();
+  }
+  return *default_instance_;
 }
 
 EnumValueOptions* EnumValueOptions::default_instance_ = NULL;
@@ -5738,7 +5949,7 @@ bool EnumValueOptions::MergePartialFromCodedStream(
           return true;
         }
         if ((8000u <= tag)) {
-          DO_(_extensions_.ParseField(tag, input, default_instance_,
+          DO_(_extensions_.ParseField(tag, input, &default_instance(),
                                       mutable_unknown_fields()));
           continue;
         }
@@ -5808,9 +6019,8 @@ int EnumValueOptions::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -5908,9 +6118,7 @@ void ServiceOptions::SharedDtor() {
 }
 
 void ServiceOptions::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* ServiceOptions::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -5918,7 +6126,11 @@ const ::google::protobuf::Descriptor* ServiceOptions::descriptor() {
 }
 
 const ServiceOptions& ServiceOptions::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2fdescriptor_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2fdescriptor_2eproto();
+  }
+  return *default_instance_;
 }
 
 ServiceOptions* ServiceOptions::default_instance_ = NULL;
@@ -5962,7 +6174,7 @@ bool ServiceOptions::MergePartialFromCodedStream(
           return true;
         }
         if ((8000u <= tag)) {
-          DO_(_extensions_.ParseField(tag, input, default_instance_,
+          DO_(_extensions_.ParseField(tag, input, &default_instance(),
                                       mutable_unknown_fields()));
           continue;
         }
@@ -6032,9 +6244,8 @@ int ServiceOptions::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -6132,9 +6343,7 @@ void MethodOptions::SharedDtor() {
 }
 
 void MethodOptions::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* MethodOptions::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -6142,7 +6351,11 @@ const ::google::protobuf::Descriptor* MethodOptions::descriptor() {
 }
 
 const MethodOptions& MethodOptions::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2fdescriptor_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2fdescriptor_2eproto();
+  }
+  return *default_instance_;
 }
 
 MethodOptions* MethodOptions::default_instance_ = NULL;
@@ -6186,7 +6399,7 @@ bool MethodOptions::MergePartialFromCodedStream(
           return true;
         }
         if ((8000u <= tag)) {
-          DO_(_extensions_.ParseField(tag, input, default_instance_,
+          DO_(_extensions_.ParseField(tag, input, &default_instance(),
                                       mutable_unknown_fields()));
           continue;
         }
@@ -6256,9 +6469,8 @@ int MethodOptions::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -6363,9 +6575,7 @@ void UninterpretedOption_NamePart::SharedDtor() {
 }
 
 void UninterpretedOption_NamePart::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* UninterpretedOption_NamePart::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -6373,7 +6583,11 @@ const ::google::protobuf::Descriptor* UninterpretedOption_NamePart::descriptor()
 }
 
 const UninterpretedOption_NamePart& UninterpretedOption_NamePart::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2fdescriptor_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2fdescriptor_2eproto();
+  }
+  return *default_instance_;
 }
 
 UninterpretedOption_NamePart* UninterpretedOption_NamePart::default_instance_ = NULL;
@@ -6517,9 +6731,8 @@ int UninterpretedOption_NamePart::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -6638,9 +6851,7 @@ void UninterpretedOption::SharedDtor() {
 }
 
 void UninterpretedOption::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* UninterpretedOption::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -6648,7 +6859,11 @@ const ::google::protobuf::Descriptor* UninterpretedOption::descriptor() {
 }
 
 const UninterpretedOption& UninterpretedOption::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2fdescriptor_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2fdescriptor_2eproto();
+  }
+  return *default_instance_;
 }
 
 UninterpretedOption* UninterpretedOption::default_instance_ = NULL;
@@ -6937,9 +7152,8 @@ int UninterpretedOption::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -30,6 +30,8 @@ namespace protobuf {
 
 // Internal implementation detail -- do not call these.
 void LIBPROTOBUF_EXPORT protobuf_AddDesc_google_2fprotobuf_2fdescriptor_2eproto();
+void LIBPROTOBUF_EXPORT protobuf_InitDefaults_google_2fprotobuf_2fdescriptor_2eproto();
+void protobuf_InitDefaults_google_2fprotobuf_2fdescriptor_2eproto_impl();
 void protobuf_AssignDesc_google_2fprotobuf_2fdescriptor_2eproto();
 void protobuf_ShutdownFile_google_2fprotobuf_2fdescriptor_2eproto();
 
@@ -172,6 +174,12 @@ class LIBPROTOBUF_EXPORT FileDescriptorSet : public ::google::protobuf::Message
   static const ::google::protobuf::Descriptor* descriptor();
   static const FileDescriptorSet& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const FileDescriptorSet* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(FileDescriptorSet* other);
   
   // implements Message ----------------------------------------------
@@ -190,7 +198,9 @@ class LIBPROTOBUF_EXPORT FileDescriptorSet : public ::google::protobuf::Message
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -218,10 +228,10 @@ class LIBPROTOBUF_EXPORT FileDescriptorSet : public ::google::protobuf::Message
   // @@protoc_insertion_point(class_scope:google.protobuf.FileDescriptorSet)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::google::protobuf::RepeatedPtrField< ::google::protobuf::FileDescriptorProto > file_;
-  friend void LIBPROTOBUF_EXPORT protobuf_AddDesc_google_2fprotobuf_2fdescriptor_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2fdescriptor_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2fdescriptor_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2fdescriptor_2eproto();
   
@@ -266,6 +276,12 @@ class LIBPROTOBUF_EXPORT FileDescriptorProto : public ::google::protobuf::Messag
   static const ::google::protobuf::Descriptor* descriptor();
   static const FileDescriptorProto& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const FileDescriptorProto* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(FileDescriptorProto* other);
   
   // implements Message ----------------------------------------------
@@ -284,7 +300,9 @@ class LIBPROTOBUF_EXPORT FileDescriptorProto : public ::google::protobuf::Messag
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -391,7 +409,7 @@ class LIBPROTOBUF_EXPORT FileDescriptorProto : public ::google::protobuf::Messag
   // @@protoc_insertion_point(class_scope:google.protobuf.FileDescriptorProto)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::std::string* name_;
   static const ::std::string _default_name_;
@@ -403,7 +421,7 @@ class LIBPROTOBUF_EXPORT FileDescriptorProto : public ::google::protobuf::Messag
   ::google::protobuf::RepeatedPtrField< ::google::protobuf::ServiceDescriptorProto > service_;
   ::google::protobuf::RepeatedPtrField< ::google::protobuf::FieldDescriptorProto > extension_;
   ::google::protobuf::FileOptions* options_;
-  friend void LIBPROTOBUF_EXPORT protobuf_AddDesc_google_2fprotobuf_2fdescriptor_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2fdescriptor_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2fdescriptor_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2fdescriptor_2eproto();
   
@@ -448,6 +466,12 @@ class LIBPROTOBUF_EXPORT DescriptorProto_ExtensionRange : public ::google::proto
   static const ::google::protobuf::Descriptor* descriptor();
   static const DescriptorProto_ExtensionRange& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const DescriptorProto_ExtensionRange* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(DescriptorProto_ExtensionRange* other);
   
   // implements Message ----------------------------------------------
@@ -466,7 +490,9 @@ class LIBPROTOBUF_EXPORT DescriptorProto_ExtensionRange : public ::google::proto
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -496,11 +522,11 @@ class LIBPROTOBUF_EXPORT DescriptorProto_ExtensionRange : public ::google::proto
   // @@protoc_insertion_point(class_scope:google.protobuf.DescriptorProto.ExtensionRange)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::google::protobuf::int32 start_;
   ::google::protobuf::int32 end_;
-  friend void LIBPROTOBUF_EXPORT protobuf_AddDesc_google_2fprotobuf_2fdescriptor_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2fdescriptor_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2fdescriptor_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2fdescriptor_2eproto();
   
@@ -545,6 +571,12 @@ class LIBPROTOBUF_EXPORT DescriptorProto : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const DescriptorProto& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const DescriptorProto* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(DescriptorProto* other);
   
   // implements Message ----------------------------------------------
@@ -563,7 +595,9 @@ class LIBPROTOBUF_EXPORT DescriptorProto : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -658,7 +692,7 @@ class LIBPROTOBUF_EXPORT DescriptorProto : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:google.protobuf.DescriptorProto)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::std::string* name_;
   static const ::std::string _default_name_;
@@ -668,7 +702,7 @@ class LIBPROTOBUF_EXPORT DescriptorProto : public ::google::protobuf::Message {
   ::google::protobuf::RepeatedPtrField< ::google::protobuf::EnumDescriptorProto > enum_type_;
   ::google::protobuf::RepeatedPtrField< ::google::protobuf::DescriptorProto_ExtensionRange > extension_range_;
   ::google::protobuf::MessageOptions* options_;
-  friend void LIBPROTOBUF_EXPORT protobuf_AddDesc_google_2fprotobuf_2fdescriptor_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2fdescriptor_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2fdescriptor_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2fdescriptor_2eproto();
   
@@ -713,6 +747,12 @@ class LIBPROTOBUF_EXPORT FieldDescriptorProto : public ::google::protobuf::Messa
   static const ::google::protobuf::Descriptor* descriptor();
   static const FieldDescriptorProto& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const FieldDescriptorProto* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(FieldDescriptorProto* other);
   
   // implements Message ----------------------------------------------
@@ -731,7 +771,9 @@ class LIBPROTOBUF_EXPORT FieldDescriptorProto : public ::google::protobuf::Messa
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -880,7 +922,7 @@ class LIBPROTOBUF_EXPORT FieldDescriptorProto : public ::google::protobuf::Messa
   // @@protoc_insertion_point(class_scope:google.protobuf.FieldDescriptorProto)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::std::string* name_;
   static const ::std::string _default_name_;
@@ -894,7 +936,7 @@ class LIBPROTOBUF_EXPORT FieldDescriptorProto : public ::google::protobuf::Messa
   ::std::string* default_value_;
   static const ::std::string _default_default_value_;
   ::google::protobuf::FieldOptions* options_;
-  friend void LIBPROTOBUF_EXPORT protobuf_AddDesc_google_2fprotobuf_2fdescriptor_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2fdescriptor_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2fdescriptor_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2fdescriptor_2eproto();
   
@@ -939,6 +981,12 @@ class LIBPROTOBUF_EXPORT EnumDescriptorProto : public ::google::protobuf::Messag
   static const ::google::protobuf::Descriptor* descriptor();
   static const EnumDescriptorProto& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const EnumDescriptorProto* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(EnumDescriptorProto* other);
   
   // implements Message ----------------------------------------------
@@ -957,7 +1005,9 @@ class LIBPROTOBUF_EXPORT EnumDescriptorProto : public ::google::protobuf::Messag
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -1002,13 +1052,13 @@ class LIBPROTOBUF_EXPORT EnumDescriptorProto : public ::google::protobuf::Messag
   // @@protoc_insertion_point(class_scope:google.protobuf.EnumDescriptorProto)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::std::string* name_;
   static const ::std::string _default_name_;
   ::google::protobuf::RepeatedPtrField< ::google::protobuf::EnumValueDescriptorProto > value_;
   ::google::protobuf::EnumOptions* options_;
-  friend void LIBPROTOBUF_EXPORT protobuf_AddDesc_google_2fprotobuf_2fdescriptor_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2fdescriptor_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2fdescriptor_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2fdescriptor_2eproto();
   
@@ -1053,6 +1103,12 @@ class LIBPROTOBUF_EXPORT EnumValueDescriptorProto : public ::google::protobuf::M
   static const ::google::protobuf::Descriptor* descriptor();
   static const EnumValueDescriptorProto& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const EnumValueDescriptorProto* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(EnumValueDescriptorProto* other);
   
   // implements Message ----------------------------------------------
@@ -1071,7 +1127,9 @@ class LIBPROTOBUF_EXPORT EnumValueDescriptorProto : public ::google::protobuf::M
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -1111,13 +1169,13 @@ class LIBPROTOBUF_EXPORT EnumValueDescriptorProto : public ::google::protobuf::M
   // @@protoc_insertion_point(class_scope:google.protobuf.EnumValueDescriptorProto)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::std::string* name_;
   static const ::std::string _default_name_;
   ::google::protobuf::int32 number_;
   ::google::protobuf::EnumValueOptions* options_;
-  friend void LIBPROTOBUF_EXPORT protobuf_AddDesc_google_2fprotobuf_2fdescriptor_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2fdescriptor_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2fdescriptor_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2fdescriptor_2eproto();
   
@@ -1162,6 +1220,12 @@ class LIBPROTOBUF_EXPORT ServiceDescriptorProto : public ::google::protobuf::Mes
   static const ::google::protobuf::Descriptor* descriptor();
   static const ServiceDescriptorProto& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const ServiceDescriptorProto* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(ServiceDescriptorProto* other);
   
   // implements Message ----------------------------------------------
@@ -1180,7 +1244,9 @@ class LIBPROTOBUF_EXPORT ServiceDescriptorProto : public ::google::protobuf::Mes
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -1225,13 +1291,13 @@ class LIBPROTOBUF_EXPORT ServiceDescriptorProto : public ::google::protobuf::Mes
   // @@protoc_insertion_point(class_scope:google.protobuf.ServiceDescriptorProto)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::std::string* name_;
   static const ::std::string _default_name_;
   ::google::protobuf::RepeatedPtrField< ::google::protobuf::MethodDescriptorProto > method_;
   ::google::protobuf::ServiceOptions* options_;
-  friend void LIBPROTOBUF_EXPORT protobuf_AddDesc_google_2fprotobuf_2fdescriptor_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2fdescriptor_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2fdescriptor_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2fdescriptor_2eproto();
   
@@ -1276,6 +1342,12 @@ class LIBPROTOBUF_EXPORT MethodDescriptorProto : public ::google::protobuf::Mess
   static const ::google::protobuf::Descriptor* descriptor();
   static const MethodDescriptorProto& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const MethodDescriptorProto* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(MethodDescriptorProto* other);
   
   // implements Message ----------------------------------------------
@@ -1294,7 +1366,9 @@ class LIBPROTOBUF_EXPORT MethodDescriptorProto : public ::google::protobuf::Mess
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -1347,7 +1421,7 @@ class LIBPROTOBUF_EXPORT MethodDescriptorProto : public ::google::protobuf::Mess
   // @@protoc_insertion_point(class_scope:google.protobuf.MethodDescriptorProto)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::std::string* name_;
   static const ::std::string _default_name_;
@@ -1356,7 +1430,7 @@ class LIBPROTOBUF_EXPORT MethodDescriptorProto : public ::google::protobuf::Mess
   ::std::string* output_type_;
   static const ::std::string _default_output_type_;
   ::google::protobuf::MethodOptions* options_;
-  friend void LIBPROTOBUF_EXPORT protobuf_AddDesc_google_2fprotobuf_2fdescriptor_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2fdescriptor_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2fdescriptor_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2fdescriptor_2eproto();
   
@@ -1401,6 +1475,12 @@ class LIBPROTOBUF_EXPORT FileOptions : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const FileOptions& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const FileOptions* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(FileOptions* other);
   
   // implements Message ----------------------------------------------
@@ -1419,7 +1499,9 @@ class LIBPROTOBUF_EXPORT FileOptions : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -1512,6 +1594,27 @@ class LIBPROTOBUF_EXPORT FileOptions : public ::google::protobuf::Message {
   inline bool py_generic_services() const;
   inline void set_py_generic_services(bool value);
   
+  // optional bool cc_enable_arenas = 31 [default = false];
+  inline bool has_cc_enable_arenas() const;
+  inline void clear_cc_enable_arenas();
+  static const int kCcEnableArenasFieldNumber = 31;
+  inline bool cc_enable_arenas() const;
+  inline void set_cc_enable_arenas(bool value);
+  
+  // optional bool cc_table_driven_parsing = 32 [default = false];
+  inline bool has_cc_table_driven_parsing() const;
+  inline void clear_cc_table_driven_parsing();
+  static const int kCcTableDrivenParsingFieldNumber = 32;
+  inline bool cc_table_driven_parsing() const;
+  inline void set_cc_table_driven_parsing(bool value);
+  
+  // optional bool cc_raw_unknown_fields = 33 [default = false];
+  inline bool has_cc_raw_unknown_fields() const;
+  inline void clear_cc_raw_unknown_fields();
+  static const int kCcRawUnknownFieldsFieldNumber = 33;
+  inline bool cc_raw_unknown_fields() const;
+  inline void set_cc_raw_unknown_fields(bool value);
+  
   // repeated .google.protobuf.UninterpretedOption uninterpreted_option = 999;
   inline int uninterpreted_option_size() const;
   inline void clear_uninterpreted_option();
@@ -1529,7 +1632,7 @@ class LIBPROTOBUF_EXPORT FileOptions : public ::google::protobuf::Message {
  private:
   ::google::protobuf::internal::ExtensionSet _extensions_;
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::std::string* java_package_;
   static const ::std::string _default_java_package_;
@@ -1540,12 +1643,15 @@ class LIBPROTOBUF_EXPORT FileOptions : public ::google::protobuf::Message {
   bool cc_generic_services_;
   bool java_generic_services_;
   bool py_generic_services_;
+  bool cc_enable_arenas_;
+  bool cc_table_driven_parsing_;
+  bool cc_raw_unknown_fields_;
   ::google::protobuf::RepeatedPtrField< ::google::protobuf::UninterpretedOption > uninterpreted_option_;
-  friend void LIBPROTOBUF_EXPORT protobuf_AddDesc_google_2fprotobuf_2fdescriptor_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2fdescriptor_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2fdescriptor_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2fdescriptor_2eproto();
   
-  ::google::protobuf::uint32 _has_bits_[(8 + 31) / 32];
+  ::google::protobuf::uint32 _has_bits_[(11 + 31) / 32];
   
   // WHY DOES & HAVE LOWER PRECEDENCE THAN != !?
   inline bool _has_bit(int index) const {
@@ -1586,6 +1692,12 @@ class LIBPROTOBUF_EXPORT MessageOptions : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const MessageOptions& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const MessageOptions* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(MessageOptions* other);
   
   // implements Message ----------------------------------------------
@@ -1604,7 +1716,9 @@ class LIBPROTOBUF_EXPORT MessageOptions : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -1648,12 +1762,12 @@ class LIBPROTOBUF_EXPORT MessageOptions : public ::google::protobuf::Message {
  private:
   ::google::protobuf::internal::ExtensionSet _extensions_;
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   bool message_set_wire_format_;
   bool no_standard_descriptor_accessor_;
   ::google::protobuf::RepeatedPtrField< ::google::protobuf::UninterpretedOption > uninterpreted_option_;
-  friend void LIBPROTOBUF_EXPORT protobuf_AddDesc_google_2fprotobuf_2fdescriptor_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2fdescriptor_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2fdescriptor_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2fdescriptor_2eproto();
   
@@ -1698,6 +1812,12 @@ class LIBPROTOBUF_EXPORT FieldOptions : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const FieldOptions& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const FieldOptions* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(FieldOptions* other);
   
   // implements Message ----------------------------------------------
@@ -1716,7 +1836,9 @@ class LIBPROTOBUF_EXPORT FieldOptions : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -1768,6 +1890,13 @@ class LIBPROTOBUF_EXPORT FieldOptions : public ::google::protobuf::Message {
   inline bool packed() const;
   inline void set_packed(bool value);
   
+  // optional bool lazy = 5 [default = false];
+  inline bool has_lazy() const;
+  inline void clear_lazy();
+  static const int kLazyFieldNumber = 5;
+  inline bool lazy() const;
+  inline void set_lazy(bool value);
+  
   // optional bool deprecated = 3 [default = false];
   inline bool has_deprecated() const;
   inline void clear_deprecated();
@@ -1802,19 +1931,20 @@ class LIBPROTOBUF_EXPORT FieldOptions : public ::google::protobuf::Message {
  private:
   ::google::protobuf::internal::ExtensionSet _extensions_;
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   int ctype_;
   bool packed_;
+  bool lazy_;
   bool deprecated_;
   ::std::string* experimental_map_key_;
   static const ::std::string _default_experimental_map_key_;
   ::google::protobuf::RepeatedPtrField< ::google::protobuf::UninterpretedOption > uninterpreted_option_;
-  friend void LIBPROTOBUF_EXPORT protobuf_AddDesc_google_2fprotobuf_2fdescriptor_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2fdescriptor_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2fdescriptor_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2fdescriptor_2eproto();
   
-  ::google::protobuf::uint32 _has_bits_[(5 + 31) / 32];
+  ::google::protobuf::uint32 _has_bits_[(6 + 31) / 32];
   
   // WHY DOES & HAVE LOWER PRECEDENCE THAN != !?
   inline bool _has_bit(int index) const {
@@ -1855,6 +1985,12 @@ class LIBPROTOBUF_EXPORT EnumOptions : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const EnumOptions& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const EnumOptions* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(EnumOptions* other);
   
   // implements Message ----------------------------------------------
@@ -1873,7 +2009,9 @@ class LIBPROTOBUF_EXPORT EnumOptions : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -1903,10 +2041,10 @@ class LIBPROTOBUF_EXPORT EnumOptions : public ::google::protobuf::Message {
  private:
   ::google::protobuf::internal::ExtensionSet _extensions_;
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::google::protobuf::RepeatedPtrField< ::google::protobuf::UninterpretedOption > uninterpreted_option_;
-  friend void LIBPROTOBUF_EXPORT protobuf_AddDesc_google_2fprotobuf_2fdescriptor_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2fdescriptor_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2fdescriptor_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2fdescriptor_2eproto();
   
@@ -1951,6 +2089,12 @@ class LIBPROTOBUF_EXPORT EnumValueOptions : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const EnumValueOptions& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const EnumValueOptions* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(EnumValueOptions* other);
   
   // implements Message ----------------------------------------------
@@ -1969,7 +2113,9 @@ class LIBPROTOBUF_EXPORT EnumValueOptions : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -1999,10 +2145,10 @@ class LIBPROTOBUF_EXPORT EnumValueOptions : public ::google::protobuf::Message {
  private:
   ::google::protobuf::internal::ExtensionSet _extensions_;
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::google::protobuf::RepeatedPtrField< ::google::protobuf::UninterpretedOption > uninterpreted_option_;
-  friend void LIBPROTOBUF_EXPORT protobuf_AddDesc_google_2fprotobuf_2fdescriptor_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2fdescriptor_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2fdescriptor_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2fdescriptor_2eproto();
   
@@ -2047,6 +2193,12 @@ class LIBPROTOBUF_EXPORT ServiceOptions : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const ServiceOptions& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const ServiceOptions* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(ServiceOptions* other);
   
   // implements Message ----------------------------------------------
@@ -2065,7 +2217,9 @@ class LIBPROTOBUF_EXPORT ServiceOptions : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -2095,10 +2249,10 @@ class LIBPROTOBUF_EXPORT ServiceOptions : public ::google::protobuf::Message {
  private:
   ::google::protobuf::internal::ExtensionSet _extensions_;
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::google::protobuf::RepeatedPtrField< ::google::protobuf::UninterpretedOption > uninterpreted_option_;
-  friend void LIBPROTOBUF_EXPORT protobuf_AddDesc_google_2fprotobuf_2fdescriptor_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2fdescriptor_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2fdescriptor_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2fdescriptor_2eproto();
   
@@ -2143,6 +2297,12 @@ class LIBPROTOBUF_EXPORT MethodOptions : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const MethodOptions& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const MethodOptions* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(MethodOptions* other);
   
   // implements Message ----------------------------------------------
@@ -2161,7 +2321,9 @@ class LIBPROTOBUF_EXPORT MethodOptions : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -2191,10 +2353,10 @@ class LIBPROTOBUF_EXPORT MethodOptions : public ::google::protobuf::Message {
  private:
   ::google::protobuf::internal::ExtensionSet _extensions_;
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::google::protobuf::RepeatedPtrField< ::google::protobuf::UninterpretedOption > uninterpreted_option_;
-  friend void LIBPROTOBUF_EXPORT protobuf_AddDesc_google_2fprotobuf_2fdescriptor_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2fdescriptor_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2fdescriptor_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2fdescriptor_2eproto();
   
@@ -2239,6 +2401,12 @@ class LIBPROTOBUF_EXPORT UninterpretedOption_NamePart : public ::google::protobu
   static const ::google::protobuf::Descriptor* descriptor();
   static const UninterpretedOption_NamePart& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const UninterpretedOption_NamePart* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(UninterpretedOption_NamePart* other);
   
   // implements Message ----------------------------------------------
@@ -2257,7 +2425,9 @@ class LIBPROTOBUF_EXPORT UninterpretedOption_NamePart : public ::google::protobu
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -2290,12 +2460,12 @@ class LIBPROTOBUF_EXPORT UninterpretedOption_NamePart : public ::google::protobu
   // @@protoc_insertion_point(class_scope:google.protobuf.UninterpretedOption.NamePart)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::std::string* name_part_;
   static const ::std::string _default_name_part_;
   bool is_extension_;
-  friend void LIBPROTOBUF_EXPORT protobuf_AddDesc_google_2fprotobuf_2fdescriptor_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2fdescriptor_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2fdescriptor_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2fdescriptor_2eproto();
   
@@ -2340,6 +2510,12 @@ class LIBPROTOBUF_EXPORT UninterpretedOption : public ::google::protobuf::Messag
   static const ::google::protobuf::Descriptor* descriptor();
   static const UninterpretedOption& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const UninterpretedOption* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(UninterpretedOption* other);
   
   // implements Message ----------------------------------------------
@@ -2358,7 +2534,9 @@ class LIBPROTOBUF_EXPORT UninterpretedOption : public ::google::protobuf::Messag
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -2429,7 +2607,7 @@ class LIBPROTOBUF_EXPORT UninterpretedOption : public ::google::protobuf::Messag
   // @@protoc_insertion_point(class_scope:google.protobuf.UninterpretedOption)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::google::protobuf::RepeatedPtrField< ::google::protobuf::UninterpretedOption_NamePart > name_;
   ::std::string* identifier_value_;
@@ -2439,7 +2617,7 @@ class LIBPROTOBUF_EXPORT UninterpretedOption : public ::google::protobuf::Messag
   double double_value_;
   ::std::string* string_value_;
   static const ::std::string _default_string_value_;
-  friend void LIBPROTOBUF_EXPORT protobuf_AddDesc_google_2fprotobuf_2fdescriptor_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2fdescriptor_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2fdescriptor_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2fdescriptor_2eproto();
   
@@ -2732,7 +2910,7 @@ inline void FileDescriptorProto::clear_options() {
   _clear_bit(7);
 }
 inline const ::google::protobuf::FileOptions& FileDescriptorProto::options() const {
-  return options_ != NULL ? *options_ : *default_instance_->options_;
+  return options_ != NULL ? *options_ : ::google::protobuf::FileOptions::default_instance();
 }
 inline ::google::protobuf::FileOptions* FileDescriptorProto::mutable_options() {
   _set_bit(7);
@@ -2956,7 +3134,7 @@ inline void DescriptorProto::clear_options() {
   _clear_bit(6);
 }
 inline const ::google::protobuf::MessageOptions& DescriptorProto::options() const {
-  return options_ != NULL ? *options_ : *default_instance_->options_;
+  return options_ != NULL ? *options_ : ::google::protobuf::MessageOptions::default_instance();
 }
 inline ::google::protobuf::MessageOptions* DescriptorProto::mutable_options() {
   _set_bit(6);
@@ -3195,7 +3373,7 @@ inline void FieldDescriptorProto::clear_options() {
   _clear_bit(7);
 }
 inline const ::google::protobuf::FieldOptions& FieldDescriptorProto::options() const {
-  return options_ != NULL ? *options_ : *default_instance_->options_;
+  return options_ != NULL ? *options_ : ::google::protobuf::FieldOptions::default_instance();
 }
 inline ::google::protobuf::FieldOptions* FieldDescriptorProto::mutable_options() {
   _set_bit(7);
@@ -3283,7 +3461,7 @@ inline void EnumDescriptorProto::clear_options() {
   _clear_bit(2);
 }
 inline const ::google::protobuf::EnumOptions& EnumDescriptorProto::options() const {
-  return options_ != NULL ? *options_ : *default_instance_->options_;
+  return options_ != NULL ? *options_ : ::google::protobuf::EnumOptions::default_instance();
 }
 inline ::google::protobuf::EnumOptions* EnumDescriptorProto::mutable_options() {
   _set_bit(2);
@@ -3362,7 +3540,7 @@ inline void EnumValueDescriptorProto::clear_options() {
   _clear_bit(2);
 }
 inline const ::google::protobuf::EnumValueOptions& EnumValueDescriptorProto::options() const {
-  return options_ != NULL ? *options_ : *default_instance_->options_;
+  return options_ != NULL ? *options_ : ::google::protobuf::EnumValueOptions::default_instance();
 }
 inline ::google::protobuf::EnumValueOptions* EnumValueDescriptorProto::mutable_options() {
   _set_bit(2);
@@ -3450,7 +3628,7 @@ inline void ServiceDescriptorProto::clear_options() {
   _clear_bit(2);
 }
 inline const ::google::protobuf::ServiceOptions& ServiceDescriptorProto::options() const {
-  return options_ != NULL ? *options_ : *default_instance_->options_;
+  return options_ != NULL ? *options_ : ::google::protobuf::ServiceOptions::default_instance();
 }
 inline ::google::protobuf::ServiceOptions* ServiceDescriptorProto::mutable_options() {
   _set_bit(2);
@@ -3597,7 +3775,7 @@ inline void MethodDescriptorProto::clear_options() {
   _clear_bit(3);
 }
 inline const ::google::protobuf::MethodOptions& MethodDescriptorProto::options() const {
-  return options_ != NULL ? *options_ : *default_instance_->options_;
+  return options_ != NULL ? *options_ : ::google::protobuf::MethodOptions::default_instance();
 }
 inline ::google::protobuf::MethodOptions* MethodDescriptorProto::mutable_options() {
   _set_bit(3);
@@ -3774,6 +3952,54 @@ inline void FileOptions::set_py_generic_services(bool value) {
   py_generic_services_ = value;
 }
 
+// optional bool cc_enable_arenas = 31 [default = false];
+inline bool FileOptions::has_cc_enable_arenas() const {
+  return _has_bit(7);
+}
+inline void FileOptions::clear_cc_enable_arenas() {
+  cc_enable_arenas_ = false;
+  _clear_bit(7);
+}
+inline bool FileOptions::cc_enable_arenas() const {
+  return cc_enable_arenas_;
+}
+inline void FileOptions::set_cc_enable_arenas(bool value) {
+  _set_bit(7);
+  cc_enable_arenas_ = value;
+}
+
+// optional bool cc_table_driven_parsing = 32 [default = false];
+inline bool FileOptions::has_cc_table_driven_parsing() const {
+  return _has_bit(8);
+}
+inline void FileOptions::clear_cc_table_driven_parsing() {
+  cc_table_driven_parsing_ = false;
+  _clear_bit(8);
+}
+inline bool FileOptions::cc_table_driven_parsing() const {
+  return cc_table_driven_parsing_;
+}
+inline void FileOptions::set_cc_table_driven_parsing(bool value) {
+  _set_bit(8);
+  cc_table_driven_parsing_ = value;
+}
+
+// optional bool cc_raw_unknown_fields = 33 [default = false];
+inline bool FileOptions::has_cc_raw_unknown_fields() const {
+  return _has_bit(9);
+}
+inline void FileOptions::clear_cc_raw_unknown_fields() {
+  cc_raw_unknown_fields_ = false;
+  _clear_bit(9);
+}
+inline bool FileOptions::cc_raw_unknown_fields() const {
+  return cc_raw_unknown_fields_;
+}
+inline void FileOptions::set_cc_raw_unknown_fields(bool value) {
+  _set_bit(9);
+  cc_raw_unknown_fields_ = value;
+}
+
 // repeated .google.protobuf.UninterpretedOption uninterpreted_option = 999;
 inline int FileOptions::uninterpreted_option_size() const {
   return uninterpreted_option_.size();
@@ -3897,58 +4123,74 @@ inline void FieldOptions::set_packed(bool value) {
   packed_ = value;
 }
 
+// optional bool lazy = 5 [default = false];
+inline bool FieldOptions::has_lazy() const {
+  return _has_bit(2);
+}
+inline void FieldOptions::clear_lazy() {
+  lazy_ = false;
+  _clear_bit(2);
+}
+inline bool FieldOptions::lazy() const {
+  return lazy_;
+}
+inline void FieldOptions::set_lazy(bool value) {
+  _set_bit(2);
+  lazy_ = value;
+}
+
 // optional bool deprecated = 3 [default = false];
 inline bool FieldOptions::has_deprecated() const {
-  return _has_bit(2);
+  return _has_bit(3);
 }
 inline void FieldOptions::clear_deprecated() {
   deprecated_ = false;
-  _clear_bit(2);
+  _clear_bit(3);
 }
 inline bool FieldOptions::deprecated() const {
   return deprecated_;
 }
 inline void FieldOptions::set_deprecated(bool value) {
-  _set_bit(2);
+  _set_bit(3);
   deprecated_ = value;
 }
 
 // optional string experimental_map_key = 9;
 inline bool FieldOptions::has_experimental_map_key() const {
-  return _has_bit(3);
+  return _has_bit(4);
 }
 inline void FieldOptions::clear_experimental_map_key() {
   if (experimental_map_key_ != &_default_experimental_map_key_) {
     experimental_map_key_->clear();
   }
-  _clear_bit(3);
+  _clear_bit(4);
 }
 inline const ::std::string& FieldOptions::experimental_map_key() const {
   return *experimental_map_key_;
 }
 inline void FieldOptions::set_experimental_map_key(const ::std::string& value) {
-  _set_bit(3);
+  _set_bit(4);
   if (experimental_map_key_ == &_default_experimental_map_key_) {
     experimental_map_key_ = new ::std::string;
   }
   experimental_map_key_->assign(value);
 }
 inline void FieldOptions::set_experimental_map_key(const char* value) {
-  _set_bit(3);
+  _set_bit(4);
   if (experimental_map_key_ == &_default_experimental_map_key_) {
     experimental_map_key_ = new ::std::string;
   }
   experimental_map_key_->assign(value);
 }
 inline void FieldOptions::set_experimental_map_key(const char* value, size_t size) {
-  _set_bit(3);
+  _set_bit(4);
   if (experimental_map_key_ == &_default_experimental_map_key_) {
     experimental_map_key_ = new ::std::string;
   }
   experimental_map_key_->assign(reinterpret_cast<const char*>(value), size);
 }
 inline ::std::string* FieldOptions::mutable_experimental_map_key() {
-  _set_bit(3);
+  _set_bit(4);
   if (experimental_map_key_ == &_default_experimental_map_key_) {
     experimental_map_key_ = new ::std::string;
   }
@@ -298,7 +298,37 @@ bool SimpleDescriptorDatabase::MaybeCopy(const FileDescriptorProto* file,
 
 // -------------------------------------------------------------------
 
-EncodedDescriptorDatabase::EncodedDescriptorDatabase() {}
+namespace {
+
+// Reads the name of an encoded FileDescriptorProto.
+bool ReadFileName(pair<const void*, int> encoded_file, string* output) {
+  // Optimization:  The name should be the first field in the encoded message.
+  //   Try to just read it directly.
+  io::CodedInputStream input(reinterpret_cast<const uint8*>(encoded_file.first),
+                             encoded_file.second);
+
+  const uint32 kNameTag = internal::WireFormatLite::MakeTag(
+      FileDescriptorProto::kNameFieldNumber,
+      internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED);
+
+  if (input.ReadTag() == kNameTag) {
+    // Success!
+    return internal::WireFormatLite::ReadString(&input, output);
+  } else {
+    // Slow path.  Parse whole message.
+    FileDescriptorProto file_proto;
+    if (!file_proto.ParseFromArray(encoded_file.first, encoded_file.second)) {
+      return false;
+    }
+    *output = file_proto.name();
+    return true;
+  }
+}
+
+}  // namespace
+
+EncodedDescriptorDatabase::EncodedDescriptorDatabase()
+  : unindexed_names_read_(0) {}
 EncodedDescriptorDatabase::~EncodedDescriptorDatabase() {
   for (int i = 0; i < files_to_delete_.size(); i++) {
     operator delete(files_to_delete_[i]);
@@ -325,51 +355,70 @@ bool EncodedDescriptorDatabase::AddCopy(
   return Add(copy, size);
 }
 
+void EncodedDescriptorDatabase::AddLazily(
+    const void* encoded_file_descriptor, int size) {
+  unindexed_files_.push_back(make_pair(encoded_file_descriptor, size));
+}
+
+pair<const void*, int> EncodedDescriptorDatabase::FindUnindexedFile(
+    const string& filename) {
+  for (; unindexed_names_read_ < unindexed_files_.size();
+       ++unindexed_names_read_) {
+    pair<const void*, int> encoded_file =
+        unindexed_files_[unindexed_names_read_];
+    string name;
+    if (ReadFileName(encoded_file, &name)) {
+      // Conflicts are reported when the file is indexed.
+      InsertIfNotPresent(&unindexed_files_by_name_, name, encoded_file);
+    }
+  }
+  return FindWithDefault(unindexed_files_by_name_, filename,
+                         make_pair(static_cast<const void*>(NULL), 0));
+}
+
+void EncodedDescriptorDatabase::IndexUnindexedFiles() {
+  // Once everything is indexed, callers which only read may call this from
+  // several threads at once, so it must not write anything then.
+  if (unindexed_files_.empty()) return;
+  for (int i = 0; i < unindexed_files_.size(); i++) {
+    Add(unindexed_files_[i].first, unindexed_files_[i].second);
+  }
+  unindexed_files_.clear();
+  unindexed_files_by_name_.clear();
+  unindexed_names_read_ = 0;
+}
+
 bool EncodedDescriptorDatabase::FindFileByName(
     const string& filename,
     FileDescriptorProto* output) {
-  return MaybeParse(index_.FindFile(filename), output);
+  pair<const void*, int> encoded_file = index_.FindFile(filename);
+  if (encoded_file.first == NULL && !unindexed_files_.empty()) {
+    encoded_file = FindUnindexedFile(filename);
+  }
+  return MaybeParse(encoded_file, output);
 }
 
 bool EncodedDescriptorDatabase::FindFileContainingSymbol(
     const string& symbol_name,
     FileDescriptorProto* output) {
+  IndexUnindexedFiles();
   return MaybeParse(index_.FindSymbol(symbol_name), output);
 }
 
 bool EncodedDescriptorDatabase::FindNameOfFileContainingSymbol(
     const string& symbol_name,
     string* output) {
+  IndexUnindexedFiles();
   pair<const void*, int> encoded_file = index_.FindSymbol(symbol_name);
   if (encoded_file.first == NULL) return false;
-
-  // Optimization:  The name should be the first field in the encoded message.
-  //   Try to just read it directly.
-  io::CodedInputStream input(reinterpret_cast<const uint8*>(encoded_file.first),
-                             encoded_file.second);
-
-  const uint32 kNameTag = internal::WireFormatLite::MakeTag(
-      FileDescriptorProto::kNameFieldNumber,
-      internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED);
-
-  if (input.ReadTag() == kNameTag) {
-    // Success!
-    return internal::WireFormatLite::ReadString(&input, output);
-  } else {
-    // Slow path.  Parse whole message.
-    FileDescriptorProto file_proto;
-    if (!file_proto.ParseFromArray(encoded_file.first, encoded_file.second)) {
-      return false;
-    }
-    *output = file_proto.name();
-    return true;
-  }
+  return ReadFileName(encoded_file, output);
 }
 
 bool EncodedDescriptorDatabase::FindFileContainingExtension(
     const string& containing_type,
     int field_number,
     FileDescriptorProto* output) {
+  IndexUnindexedFiles();
   return MaybeParse(index_.FindExtension(containing_type, field_number),
                     output);
 }
@@ -377,6 +426,7 @@ bool EncodedDescriptorDatabase::FindFileContainingExtension(
 bool EncodedDescriptorDatabase::FindAllExtensionNumbers(
     const string& extendee_type,
     vector<int>* output) {
+  IndexUnindexedFiles();
   return index_.FindAllExtensionNumbers(extendee_type, output);
 }
 
@@ -280,6 +280,13 @@ class LIBPROTOBUF_EXPORT EncodedDescriptorDatabase : public DescriptorDatabase {
   // need to keep it around.
   bool AddCopy(const void* encoded_file_descriptor, int size);
 
+  // Like Add(), but only remembers where the bytes are.  Nothing is parsed
+  // until the database is searched:  FindFileByName() only reads the names
+  // of such files, and the other searches index them fully the first time
+  // they are called.  Errors are logged then rather than returned.  Used for
+  // the descriptors of generated files, most of which are never looked at.
+  void AddLazily(const void* encoded_file_descriptor, int size);
+
   // Like FindFileContainingSymbol but returns only the name of the file.
   bool FindNameOfFileContainingSymbol(const string& symbol_name,
                                       string* output);
@@ -299,11 +306,24 @@ class LIBPROTOBUF_EXPORT EncodedDescriptorDatabase : public DescriptorDatabase {
   SimpleDescriptorDatabase::DescriptorIndex<pair<const void*, int> > index_;
   vector<void*> files_to_delete_;
 
+  // Files passed to AddLazily() which are not in index_ yet, and the ones
+  // among them whose names have been read, by name.
+  vector<pair<const void*, int> > unindexed_files_;
+  map<string, pair<const void*, int> > unindexed_files_by_name_;
+  int unindexed_names_read_;
+
   // If encoded_file.first is non-NULL, parse the data into *output and return
   // true, otherwise return false.
   bool MaybeParse(pair<const void*, int> encoded_file,
                   FileDescriptorProto* output);
 
+  // Finds a file in unindexed_files_ without indexing it.
+  pair<const void*, int> FindUnindexedFile(const string& filename);
+
+  // Moves everything in unindexed_files_ to index_.  Does not modify
+  // anything if unindexed_files_ is already empty.
+  void IndexUnindexedFiles();
+
   GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(EncodedDescriptorDatabase);
 };
 
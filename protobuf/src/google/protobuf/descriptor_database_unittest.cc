@@ -514,6 +514,66 @@ TEST(EncodedDescriptorDatabaseExtraTest, FindNameOfFileContainingSymbol) {
   EXPECT_FALSE(db.FindNameOfFileContainingSymbol("baz.Baz", &filename));
 }
 
+TEST(EncodedDescriptorDatabaseExtraTest, AddLazily) {
+  FileDescriptorProto file1, file2a, file2b, file3;
+  file1.set_name("foo.proto");
+  file1.set_package("foo");
+  file1.add_message_type()->set_name("Foo");
+  file1.mutable_message_type(0)->add_extension_range()->set_start(1);
+  file1.mutable_message_type(0)->mutable_extension_range(0)->set_end(100);
+  file2a.set_name("bar.proto");
+  file2b.set_package("bar");
+  file2b.add_message_type()->set_name("Bar");
+  FieldDescriptorProto* extension = file2b.add_extension();
+  extension->set_name("bar");
+  extension->set_number(5);
+  extension->set_label(FieldDescriptorProto::LABEL_OPTIONAL);
+  extension->set_type(FieldDescriptorProto::TYPE_INT32);
+  extension->set_extendee(".foo.Foo");
+  file3.set_name("baz.proto");
+  file3.set_package("baz");
+  file3.add_message_type()->set_name("Baz");
+
+  // The name of bar.proto is not its first field, so it can't be read
+  // without parsing the whole file.
+  string data1 = file1.SerializeAsString();
+  string data2 = file2b.SerializeAsString() + file2a.SerializeAsString();
+  string data3 = file3.SerializeAsString();
+
+  EncodedDescriptorDatabase db;
+  db.AddLazily(data1.data(), data1.size());
+  db.AddLazily(data2.data(), data2.size());
+
+  // Files can be found by name before they are indexed.
+  FileDescriptorProto file;
+  EXPECT_TRUE(db.FindFileByName("bar.proto", &file));
+  EXPECT_EQ("bar.proto", file.name());
+  EXPECT_EQ("bar", file.package());
+  EXPECT_TRUE(db.FindFileByName("foo.proto", &file));
+  EXPECT_EQ("foo.proto", file.name());
+  EXPECT_FALSE(db.FindFileByName("baz.proto", &file));
+
+  // Other searches index them.
+  EXPECT_TRUE(db.FindFileContainingSymbol("bar.Bar", &file));
+  EXPECT_EQ("bar.proto", file.name());
+  EXPECT_TRUE(db.FindFileContainingExtension("foo.Foo", 5, &file));
+  EXPECT_EQ("bar.proto", file.name());
+  vector<int> numbers;
+  EXPECT_TRUE(db.FindAllExtensionNumbers("foo.Foo", &numbers));
+  ASSERT_EQ(1, numbers.size());
+  EXPECT_EQ(5, numbers[0]);
+  EXPECT_TRUE(db.FindFileByName("foo.proto", &file));
+  EXPECT_EQ("foo.proto", file.name());
+
+  // Files can still be added afterwards.
+  db.AddLazily(data3.data(), data3.size());
+  string filename;
+  EXPECT_TRUE(db.FindNameOfFileContainingSymbol("baz.Baz", &filename));
+  EXPECT_EQ("baz.proto", filename);
+  EXPECT_TRUE(db.FindFileByName("baz.proto", &file));
+  EXPECT_EQ("baz.proto", file.name());
+}
+
 // ===================================================================
 
 class MergedDescriptorDatabaseTest : public testing::Test {
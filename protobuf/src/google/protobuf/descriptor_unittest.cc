@@ -35,6 +35,11 @@
 // This file makes extensive use of RFC 3092.  :)
 
 #include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
 
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/descriptor_database.h>
@@ -3948,6 +3953,102 @@ TEST_F(DatabaseBackedPoolTest, DoesntFallbackOnWrongType) {
   EXPECT_EQ(0, call_counter.call_count_);
 }
 
+TEST_F(DatabaseBackedPoolTest, FailedFileIsNotFound) {
+  // A file's symbols are added to the pool before all errors are detected.
+  // If the file fails to build, they must not be found afterwards, even by
+  // lookups which do not lock the pool.
+  SimpleDescriptorDatabase database;
+  AddToDatabase(&database,
+    "name: \"bad.proto\" "
+    "message_type { name:\"Bad\" "
+    "  field { name:\"baz\" number:1 label:LABEL_OPTIONAL "
+    "          type_name:\"NoSuchType\" } } ");
+  MockErrorCollector error_collector;
+  DescriptorPool pool(&database, &error_collector);
+
+  EXPECT_TRUE(pool.FindFileByName("bad.proto") == NULL);
+  EXPECT_NE("", error_collector.text_);
+  EXPECT_TRUE(pool.FindMessageTypeByName("Bad") == NULL);
+  EXPECT_TRUE(pool.FindFieldByName("Bad.baz") == NULL);
+  EXPECT_TRUE(pool.FindFileContainingSymbol("Bad") == NULL);
+}
+
+// Looks up every message type of a file in a pool, over and over, from a
+// separate thread.
+class LookupThread {
+ public:
+  LookupThread(const DescriptorPool* pool, const FileDescriptor* file)
+      : pool_(pool), file_(file), all_found_(true) {
+#ifdef _WIN32
+    thread_ = CreateThread(NULL, 0, &Start, this, 0, NULL);
+#else
+    pthread_create(&thread_, NULL, &Start, this);
+#endif
+  }
+
+  void Join() {
+#ifdef _WIN32
+    WaitForSingleObject(thread_, INFINITE);
+    CloseHandle(thread_);
+#else
+    pthread_join(thread_, NULL);
+#endif
+  }
+
+  bool all_found() const { return all_found_; }
+
+ private:
+#ifdef _WIN32
+  HANDLE thread_;
+
+  static DWORD WINAPI Start(LPVOID arg) {
+#else
+  pthread_t thread_;
+
+  static void* Start(void* arg) {
+#endif
+    reinterpret_cast<LookupThread*>(arg)->Run();
+    return 0;
+  }
+
+  void Run() {
+    for (int i = 0; i < 100; i++) {
+      for (int j = 0; j < file_->message_type_count(); j++) {
+        const string& name = file_->message_type(j)->full_name();
+        const Descriptor* type = pool_->FindMessageTypeByName(name);
+        if (type == NULL || type->full_name() != name ||
+            type->file() != pool_->FindFileByName(file_->name())) {
+          all_found_ = false;
+        }
+      }
+    }
+  }
+
+  const DescriptorPool* pool_;
+  const FileDescriptor* file_;
+  bool all_found_;
+};
+
+TEST_F(DatabaseBackedPoolTest, ConcurrentLookups) {
+  // Several threads race to load unittest.proto and then look up its types,
+  // mostly without locking.
+  const FileDescriptor* original_file =
+    protobuf_unittest::TestAllTypes::descriptor()->file();
+  DescriptorPoolDatabase database(*DescriptorPool::generated_pool());
+  DescriptorPool pool(&database);
+
+  const int kThreadCount = 4;
+  LookupThread* threads[kThreadCount];
+  for (int i = 0; i < kThreadCount; i++) {
+    threads[i] = new LookupThread(&pool, original_file);
+  }
+  for (int i = 0; i < kThreadCount; i++) {
+    threads[i]->Join();
+    EXPECT_TRUE(threads[i]->all_found());
+    delete threads[i];
+  }
+}
+
 // ===================================================================
 
 
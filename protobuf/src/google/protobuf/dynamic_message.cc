@@ -61,28 +61,53 @@
 // a pointer that is not aligned correctly for general use.  I believe
 // Item 8 of "More Effective C++" discusses this in more detail, though
 // I don't have the book on me right now so I'm not sure.
+//
+// Parsing, serializing, sizing and clearing a message through Reflection
+// costs a descriptor lookup and a few virtual calls for every field.  So
+// DynamicMessage overrides those operations, and IsInitialized(), which
+// parsing and serialization check, with "programs" which
+// DynamicMessageFactory works out along with the prototype:  the type's
+// fields in field number order, with their offsets, has-bits and tags.
+// Parsing runs a ParseTable through the interpreter which generated code
+// uses with option cc_table_driven_parsing.  Types the programs do not
+// cover (MessageSets) still go through Reflection.
 
 #include <algorithm>
+#include <vector>
 #include <google/protobuf/stubs/hash.h>
 
 #include <google/protobuf/stubs/common.h>
+#include <google/protobuf/stubs/atomicops.h>
 
 #include <google/protobuf/dynamic_message.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/descriptor.pb.h>
 #include <google/protobuf/generated_message_util.h>
 #include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/generated_message_table_driven.h>
+#include <google/protobuf/generated_message_table_driven_inl.h>
 #include <google/protobuf/reflection_ops.h>
 #include <google/protobuf/repeated_field.h>
 #include <google/protobuf/extension_set.h>
+#include <google/protobuf/lazy_field.h>
+#include <google/protobuf/string_piece_field.h>
 #include <google/protobuf/wire_format.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/io/coded_stream.h>
 
 namespace google {
 namespace protobuf {
 
 using internal::WireFormat;
+using internal::WireFormatLite;
 using internal::ExtensionSet;
 using internal::GeneratedMessageReflection;
+using internal::IsLazyField;
+using internal::LazyField;
+using internal::ParseTable;
+using internal::ParseTableField;
+using internal::StringPieceField;
 
 
 // ===================================================================
@@ -110,6 +135,8 @@ int FieldSpaceUsed(const FieldDescriptor* field) {
           default:  // TODO(kenton):  Support other string reps.
           case FieldOptions::STRING:
             return sizeof(RepeatedPtrField<string>);
+          case FieldOptions::STRING_PIECE:
+            return sizeof(RepeatedPtrField<StringPieceField>);
         }
         break;
     }
@@ -123,13 +150,16 @@ int FieldSpaceUsed(const FieldDescriptor* field) {
       case FD::CPPTYPE_FLOAT  : return sizeof(float   );
       case FD::CPPTYPE_BOOL   : return sizeof(bool    );
       case FD::CPPTYPE_ENUM   : return sizeof(int     );
-      case FD::CPPTYPE_MESSAGE: return sizeof(Message*);
+      case FD::CPPTYPE_MESSAGE:
+        return IsLazyField(field) ? sizeof(LazyField) : sizeof(Message*);
 
       case FD::CPPTYPE_STRING:
         switch (field->options().ctype()) {
           default:  // TODO(kenton):  Support other string reps.
           case FieldOptions::STRING:
             return sizeof(string*);
+          case FieldOptions::STRING_PIECE:
+            return sizeof(StringPieceField);
         }
         break;
     }
@@ -157,6 +187,376 @@ inline int AlignOffset(int offset) {
 
 #define bitsizeof(T) (sizeof(T) * 8)
 
+// -------------------------------------------------------------------
+// Programs
+
+// One step of a Program:  a field, or a range of extensions.
+struct FieldInstruction {
+  enum Kind {
+    PRIMITIVE,     // Numbers, bools and enums.
+    STRING,        // string*, or RepeatedPtrField<string>.
+    STRING_PIECE,  // StringPieceField, or RepeatedPtrField<StringPieceField>.
+    MESSAGE,       // Message*, or RepeatedPtrField<Message>.  Also groups.
+    LAZY,          // LazyField.
+    EXTENSIONS     // The extensions numbered from number to end_number - 1.
+  };
+
+  Kind kind;
+  WireFormatLite::FieldType type;
+  bool repeated;
+  bool packed;
+  int number;
+  int end_number;
+
+  int offset;
+  int has_bit_index;         // -1 for repeated fields.
+  uint32 tag;                // As returned by WireFormat::MakeTag().
+  int tag_size;
+
+  // For singular primitive fields, the size of the value.  Clear() copies
+  // that many bytes from the prototype.
+  int primitive_size;
+
+  // For MESSAGE and LAZY fields:  whether IsInitialized() has to look at
+  // the sub-messages, and the prototype of their type.
+  bool check_initialized;
+  const Message* prototype;
+
+  const FieldDescriptor* field;  // NULL for EXTENSIONS.
+};
+
+struct Program {
+  // Fields and extension ranges in the order they are serialized.
+  vector<FieldInstruction> instructions;
+  int has_bits_size;         // In bytes.
+
+  // The has-bits of the required fields, one word per word of has-bits.
+  vector<uint32> required_mask;
+
+  // For parsing.  parse_table points into the vectors.
+  vector<ParseTableField> parse_fields;
+  vector<int> extension_ranges;
+  ParseTable parse_table;
+};
+
+bool ValidateEnumUsingDescriptor(const void* arg, int number) {
+  return reinterpret_cast<const EnumDescriptor*>(arg)
+      ->FindValueByNumber(number) != NULL;
+}
+
+bool CompareFieldNumbers(const FieldDescriptor* a, const FieldDescriptor* b) {
+  return a->number() < b->number();
+}
+
+// Same as the function of that name in the C++ code generator:  can a
+// message of this type be missing required fields, itself or in a
+// sub-message?
+bool HasRequiredFields(const Descriptor* type,
+                       hash_set<const Descriptor*>* already_seen) {
+  if (already_seen->count(type) > 0) return false;
+  already_seen->insert(type);
+
+  // An extension with message type could contain required fields.
+  if (type->extension_range_count() > 0) return true;
+
+  for (int i = 0; i < type->field_count(); i++) {
+    const FieldDescriptor* field = type->field(i);
+    if (field->is_required()) return true;
+    if (field->cpp_type() == FieldDescriptor::CPPTYPE_MESSAGE &&
+        HasRequiredFields(field->message_type(), already_seen)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool HasRequiredFields(const Descriptor* type) {
+  hash_set<const Descriptor*> already_seen;
+  return HasRequiredFields(type, &already_seen);
+}
+
+// Sizes and writes one primitive type, so that singular, repeated and
+// packed fields need only be handled once below.
+#define VARINT_TRAITS(NAME, CPPTYPE)                                          \
+  struct NAME##Traits {                                                       \
+    typedef CPPTYPE Type;                                                     \
+    static const int kFixedSize = 0;                                          \
+    static inline int Size(Type value) {                                      \
+      return WireFormatLite::NAME##Size(value);                               \
+    }                                                                         \
+    static inline void Write(Type value, io::CodedOutputStream* output) {     \
+      WireFormatLite::Write##NAME##NoTag(value, output);                      \
+    }                                                                         \
+    static inline uint8* Write(Type value, uint8* target) {                   \
+      return WireFormatLite::Write##NAME##NoTagToArray(value, target);        \
+    }                                                                         \
+  }
+#define FIXED_TRAITS(NAME, CPPTYPE)                                           \
+  struct NAME##Traits {                                                       \
+    typedef CPPTYPE Type;                                                     \
+    static const int kFixedSize = WireFormatLite::k##NAME##Size;              \
+    static inline int Size(Type value) {                                      \
+      return kFixedSize;                                                      \
+    }                                                                         \
+    static inline void Write(Type value, io::CodedOutputStream* output) {     \
+      WireFormatLite::Write##NAME##NoTag(value, output);                      \
+    }                                                                         \
+    static inline uint8* Write(Type value, uint8* target) {                   \
+      return WireFormatLite::Write##NAME##NoTagToArray(value, target);        \
+    }                                                                         \
+  }
+
+VARINT_TRAITS(Int32   , int32 );
+VARINT_TRAITS(Int64   , int64 );
+VARINT_TRAITS(UInt32  , uint32);
+VARINT_TRAITS(UInt64  , uint64);
+VARINT_TRAITS(SInt32  , int32 );
+VARINT_TRAITS(SInt64  , int64 );
+VARINT_TRAITS(Enum    , int   );
+FIXED_TRAITS (Fixed32 , uint32);
+FIXED_TRAITS (Fixed64 , uint64);
+FIXED_TRAITS (SFixed32, int32 );
+FIXED_TRAITS (SFixed64, int64 );
+FIXED_TRAITS (Float   , float );
+FIXED_TRAITS (Double  , double);
+FIXED_TRAITS (Bool    , bool  );
+
+#undef VARINT_TRAITS
+#undef FIXED_TRAITS
+
+// Calls FUNCTION<Traits>(ARGS) for the primitive type of INSTRUCTION.
+#define DISPATCH_PRIMITIVE(INSTRUCTION, FUNCTION, ARGS)                       \
+  switch ((INSTRUCTION).type) {                                               \
+    case WireFormatLite::TYPE_INT32   : return FUNCTION<Int32Traits   > ARGS; \
+    case WireFormatLite::TYPE_INT64   : return FUNCTION<Int64Traits   > ARGS; \
+    case WireFormatLite::TYPE_UINT32  : return FUNCTION<UInt32Traits  > ARGS; \
+    case WireFormatLite::TYPE_UINT64  : return FUNCTION<UInt64Traits  > ARGS; \
+    case WireFormatLite::TYPE_SINT32  : return FUNCTION<SInt32Traits  > ARGS; \
+    case WireFormatLite::TYPE_SINT64  : return FUNCTION<SInt64Traits  > ARGS; \
+    case WireFormatLite::TYPE_ENUM    : return FUNCTION<EnumTraits    > ARGS; \
+    case WireFormatLite::TYPE_FIXED32 : return FUNCTION<Fixed32Traits > ARGS; \
+    case WireFormatLite::TYPE_FIXED64 : return FUNCTION<Fixed64Traits > ARGS; \
+    case WireFormatLite::TYPE_SFIXED32: return FUNCTION<SFixed32Traits> ARGS; \
+    case WireFormatLite::TYPE_SFIXED64: return FUNCTION<SFixed64Traits> ARGS; \
+    case WireFormatLite::TYPE_FLOAT   : return FUNCTION<FloatTraits   > ARGS; \
+    case WireFormatLite::TYPE_DOUBLE  : return FUNCTION<DoubleTraits  > ARGS; \
+    case WireFormatLite::TYPE_BOOL    : return FUNCTION<BoolTraits    > ARGS; \
+    default:                                                                  \
+      GOOGLE_LOG(FATAL) << "Can't get here.";                                 \
+  }
+
+template <typename Traits>
+int RepeatedDataSize(const RepeatedField<typename Traits::Type>& values) {
+  if (Traits::kFixedSize != 0) return Traits::kFixedSize * values.size();
+  int size = 0;
+  for (int i = 0; i < values.size(); i++) {
+    size += Traits::Size(values.Get(i));
+  }
+  return size;
+}
+
+template <typename Traits>
+int PrimitiveByteSize(const FieldInstruction& instruction,
+                      const void* field_ptr) {
+  typedef typename Traits::Type Type;
+  if (!instruction.repeated) {
+    return instruction.tag_size +
+           Traits::Size(*reinterpret_cast<const Type*>(field_ptr));
+  }
+
+  const RepeatedField<Type>& values =
+      *reinterpret_cast<const RepeatedField<Type>*>(field_ptr);
+  if (values.size() == 0) return 0;
+  int data_size = RepeatedDataSize<Traits>(values);
+  if (instruction.packed) {
+    return instruction.tag_size +
+           io::CodedOutputStream::VarintSize32(data_size) + data_size;
+  }
+  return instruction.tag_size * values.size() + data_size;
+}
+
+// Where DynamicMessage::SerializeFields() writes to:  a CodedOutputStream,
+// or a flat array for SerializeWithCachedSizesToArray().
+class StreamWriter {
+ public:
+  explicit StreamWriter(io::CodedOutputStream* output) : output_(output) {}
+
+  void WriteTag(uint32 tag) { output_->WriteTag(tag); }
+  void WriteVarint32(uint32 value) { output_->WriteVarint32(value); }
+  void WriteString(const string& value) { output_->WriteString(value); }
+
+  template <typename Traits>
+  void WritePrimitive(typename Traits::Type value) {
+    Traits::Write(value, output_);
+  }
+
+  void WriteStringPiece(int number, const StringPieceField& value) {
+    WireFormatLite::WriteStringPiece(number, value, output_);
+  }
+  void WriteGroup(int number, const Message& value) {
+    WireFormatLite::WriteGroupMaybeToArray(number, value, output_);
+  }
+  void WriteMessage(int number, const Message& value) {
+    WireFormatLite::WriteMessageMaybeToArray(number, value, output_);
+  }
+  void WriteLazyField(const LazyField& value) {
+    value.SerializeWithCachedSizes(output_);
+  }
+  void WriteExtensions(const ExtensionSet& extensions, int start, int end) {
+    extensions.SerializeWithCachedSizes(start, end, output_);
+  }
+  void WriteUnknownFields(const UnknownFieldSet& unknown_fields) {
+    WireFormat::SerializeUnknownFields(unknown_fields, output_);
+  }
+
+ private:
+  io::CodedOutputStream* output_;
+};
+
+class ArrayWriter {
+ public:
+  explicit ArrayWriter(uint8* target) : target_(target) {}
+
+  uint8* target() const { return target_; }
+
+  void WriteTag(uint32 tag) {
+    target_ = io::CodedOutputStream::WriteTagToArray(tag, target_);
+  }
+  void WriteVarint32(uint32 value) {
+    target_ = io::CodedOutputStream::WriteVarint32ToArray(value, target_);
+  }
+  void WriteString(const string& value) {
+    target_ = io::CodedOutputStream::WriteStringToArray(value, target_);
+  }
+
+  template <typename Traits>
+  void WritePrimitive(typename Traits::Type value) {
+    target_ = Traits::Write(value, target_);
+  }
+
+  void WriteStringPiece(int number, const StringPieceField& value) {
+    target_ = WireFormatLite::WriteStringPieceToArray(number, value, target_);
+  }
+  void WriteGroup(int number, const Message& value) {
+    target_ = WireFormatLite::WriteGroupToArray(number, value, target_);
+  }
+  void WriteMessage(int number, const Message& value) {
+    target_ = WireFormatLite::WriteMessageToArray(number, value, target_);
+  }
+  void WriteLazyField(const LazyField& value) {
+    target_ = value.SerializeWithCachedSizesToArray(target_);
+  }
+  void WriteExtensions(const ExtensionSet& extensions, int start, int end) {
+    target_ = extensions.SerializeWithCachedSizesToArray(start, end, target_);
+  }
+  void WriteUnknownFields(const UnknownFieldSet& unknown_fields) {
+    target_ = WireFormat::SerializeUnknownFieldsToArray(unknown_fields,
+                                                        target_);
+  }
+
+ private:
+  uint8* target_;
+};
+
+template <typename Traits, typename Writer>
+void SerializePrimitive(const FieldInstruction& instruction,
+                        const void* field_ptr, Writer* writer) {
+  typedef typename Traits::Type Type;
+  if (!instruction.repeated) {
+    writer->WriteTag(instruction.tag);
+    writer->template WritePrimitive<Traits>(
+        *reinterpret_cast<const Type*>(field_ptr));
+    return;
+  }
+
+  const RepeatedField<Type>& values =
+      *reinterpret_cast<const RepeatedField<Type>*>(field_ptr);
+  if (values.size() == 0) return;
+  if (instruction.packed) {
+    // Like WireFormat, work the length out again rather than caching it.
+    writer->WriteTag(instruction.tag);
+    writer->WriteVarint32(RepeatedDataSize<Traits>(values));
+    for (int i = 0; i < values.size(); i++) {
+      writer->template WritePrimitive<Traits>(values.Get(i));
+    }
+  } else {
+    for (int i = 0; i < values.size(); i++) {
+      writer->WriteTag(instruction.tag);
+      writer->template WritePrimitive<Traits>(values.Get(i));
+    }
+  }
+}
+
+template <typename Traits>
+void ClearRepeatedPrimitive(void* field_ptr) {
+  reinterpret_cast<RepeatedField<typename Traits::Type>*>(field_ptr)->Clear();
+}
+
+int PrimitiveFieldByteSize(const FieldInstruction& instruction,
+                           const void* field_ptr) {
+  DISPATCH_PRIMITIVE(instruction, PrimitiveByteSize,
+                     (instruction, field_ptr));
+  return 0;
+}
+
+template <typename Writer>
+void SerializePrimitiveField(const FieldInstruction& instruction,
+                             const void* field_ptr, Writer* writer) {
+  DISPATCH_PRIMITIVE(instruction, SerializePrimitive,
+                     (instruction, field_ptr, writer));
+}
+
+void ClearRepeatedPrimitiveField(const FieldInstruction& instruction,
+                                 void* field_ptr) {
+  DISPATCH_PRIMITIVE(instruction, ClearRepeatedPrimitive, (field_ptr));
+}
+
+#undef DISPATCH_PRIMITIVE
+
+inline const string& StringValue(const void* field_ptr) {
+  return **reinterpret_cast<const string* const*>(field_ptr);
+}
+
+inline const Message& MessageValue(const void* field_ptr) {
+  return **reinterpret_cast<const Message* const*>(field_ptr);
+}
+
+// DynamicMessages keep unknown fields and bad enum values like generated
+// messages do, but find their extensions as WireFormat::ParseAndMergePartial()
+// does:  in the message's own pool unless the stream names one.
+struct DynamicUnknownFieldHandler {
+  static bool ParseUnknownField(MessageLite* message, const ParseTable& table,
+                                uint32 tag, io::CodedInputStream* input) {
+    int field_number = WireFormatLite::GetTagFieldNumber(tag);
+    if (table.extensions_offset >= 0 &&
+        internal::InParseTableExtensionRange(table, field_number)) {
+      Message* full_message = down_cast<Message*>(message);
+      const FieldDescriptor* field;
+      if (input->GetExtensionPool() == NULL) {
+        field = full_message->GetReflection()
+                    ->FindKnownExtensionByNumber(field_number);
+      } else {
+        field = input->GetExtensionPool()->FindExtensionByNumber(
+            full_message->GetDescriptor(), field_number);
+      }
+      return WireFormat::ParseAndMergeField(tag, field, full_message, input);
+    }
+    return WireFormat::SkipField(
+        input, tag, internal::ParseTableRaw<UnknownFieldSet>(
+                        message, table.unknown_fields_offset));
+  }
+
+  static void AddUnknownEnum(MessageLite* message, const ParseTable& table,
+                             int field_number, int value) {
+    internal::ParseTableRaw<UnknownFieldSet>(
+        message, table.unknown_fields_offset)->AddVarint(field_number, value);
+  }
+
+  static void VerifyUTF8(const char* data, int size) {
+    WireFormat::VerifyUTF8String(data, size, WireFormat::PARSE);
+  }
+};
+
 }  // namespace
 
 // ===================================================================
@@ -178,6 +578,8 @@ class DynamicMessage : public Message {
     //   important (the prototype must be deleted *before* the offsets).
     scoped_array<int> offsets;
     scoped_ptr<const GeneratedMessageReflection> reflection;
+    // NULL if the type is not covered by a Program; see the top of the file.
+    scoped_ptr<const Program> program;
     scoped_ptr<const DynamicMessage> prototype;
   };
 
@@ -187,10 +589,21 @@ class DynamicMessage : public Message {
   // Called on the prototype after construction to initialize message fields.
   void CrossLinkPrototypes();
 
+  // Called on the prototype after CrossLinkPrototypes() to build the
+  // type's Program.  Returns NULL if the type needs Reflection.
+  const Program* NewProgram() const;
+
   // implements Message ----------------------------------------------
 
   Message* New() const;
 
+  void Clear();
+  bool IsInitialized() const;
+  bool MergePartialFromCodedStream(io::CodedInputStream* input);
+  int ByteSize() const;
+  void SerializeWithCachedSizes(io::CodedOutputStream* output) const;
+  uint8* SerializeWithCachedSizesToArray(uint8* target) const;
+
   int GetCachedSize() const;
   void SetCachedSize(int size) const;
 
@@ -213,10 +626,21 @@ class DynamicMessage : public Message {
     return reinterpret_cast<const uint8*>(this) + offset;
   }
 
+  inline bool HasBit(int index) const {
+    return (reinterpret_cast<const uint32*>(
+                OffsetToPointer(type_info_->has_bits_offset))[index / 32] &
+            (1u << (index % 32))) != 0;
+  }
+
+  // Runs the serialization part of the program, writing to a StreamWriter
+  // or an ArrayWriter.
+  template <typename Writer>
+  void SerializeFields(const Program& program, Writer* writer) const;
+
   const TypeInfo* type_info_;
 
   // TODO(kenton):  Make this an atomic<int> when C++ supports it.
-  mutable int cached_byte_size_;
+  mutable internal::Atomic32 cached_byte_size_;
 };
 
 DynamicMessage::DynamicMessage(const TypeInfo* type_info)
@@ -287,11 +711,23 @@ DynamicMessage::DynamicMessage(const TypeInfo* type_info)
               new(field_ptr) RepeatedPtrField<string>();
             }
             break;
+          case FieldOptions::STRING_PIECE:
+            if (!field->is_repeated()) {
+              const string& default_value = field->default_value_string();
+              new(field_ptr) StringPieceField();
+              reinterpret_cast<StringPieceField*>(field_ptr)->SetAliased(
+                  default_value.data(), default_value.size());
+            } else {
+              new(field_ptr) RepeatedPtrField<StringPieceField>();
+            }
+            break;
         }
         break;
 
       case FieldDescriptor::CPPTYPE_MESSAGE: {
-        if (!field->is_repeated()) {
+        if (IsLazyField(field)) {
+          new(field_ptr) LazyField();
+        } else if (!field->is_repeated()) {
           new(field_ptr) Message*(NULL);
         } else {
           new(field_ptr) RepeatedPtrField<Message>();
@@ -348,6 +784,10 @@ DynamicMessage::~DynamicMessage() {
               reinterpret_cast<RepeatedPtrField<string>*>(field_ptr)
                   ->~RepeatedPtrField<string>();
               break;
+            case FieldOptions::STRING_PIECE:
+              reinterpret_cast<RepeatedPtrField<StringPieceField>*>(field_ptr)
+                  ->~RepeatedPtrField<StringPieceField>();
+              break;
           }
           break;
 
@@ -367,7 +807,12 @@ DynamicMessage::~DynamicMessage() {
           }
           break;
         }
+        case FieldOptions::STRING_PIECE:
+          reinterpret_cast<StringPieceField*>(field_ptr)->~StringPieceField();
+          break;
       }
+    } else if (IsLazyField(field)) {
+      reinterpret_cast<LazyField*>(field_ptr)->~LazyField();
     } else if ((field->cpp_type() == FieldDescriptor::CPPTYPE_MESSAGE) &&
                !is_prototype()) {
       Message* message = *reinterpret_cast<Message**>(field_ptr);
@@ -391,7 +836,7 @@ void DynamicMessage::CrossLinkPrototypes() {
     void* field_ptr = OffsetToPointer(type_info_->offsets[i]);
 
     if (field->cpp_type() == FieldDescriptor::CPPTYPE_MESSAGE &&
-        !field->is_repeated()) {
+        !field->is_repeated() && !IsLazyField(field)) {
       // For fields with message types, we need to cross-link with the
       // prototype for the field's type.
       // For singular fields, the field is just a pointer which should
@@ -402,6 +847,137 @@ void DynamicMessage::CrossLinkPrototypes() {
   }
 }
 
+const Program* DynamicMessage::NewProgram() const {
+  // This should only be called on the prototype message.
+  GOOGLE_CHECK(is_prototype());
+
+  const Descriptor* descriptor = type_info_->type;
+  if (descriptor->options().message_set_wire_format()) return NULL;
+
+  DynamicMessageFactory* factory = type_info_->factory;
+  Program* program = new Program;
+  program->has_bits_size = DivideRoundingUp(descriptor->field_count(),
+                                            bitsizeof(uint32)) *
+                           sizeof(uint32);
+  program->required_mask.resize(program->has_bits_size / sizeof(uint32));
+
+  vector<const FieldDescriptor*> fields;
+  for (int i = 0; i < descriptor->field_count(); i++) {
+    fields.push_back(descriptor->field(i));
+  }
+  sort(fields.begin(), fields.end(), CompareFieldNumbers);
+
+  vector<const Descriptor::ExtensionRange*> ranges;
+  for (int i = 0; i < descriptor->extension_range_count(); i++) {
+    ranges.push_back(descriptor->extension_range(i));
+    program->extension_ranges.push_back(ranges.back()->start);
+    program->extension_ranges.push_back(ranges.back()->end);
+  }
+  // Descriptors keep extension ranges sorted by start already.
+
+  // Merge the fields and the extension ranges, as generated code does.
+  int next_range = 0;
+  for (int i = 0; i <= fields.size(); i++) {
+    while (next_range < ranges.size() &&
+           (i == fields.size() ||
+            ranges[next_range]->start < fields[i]->number())) {
+      FieldInstruction instruction;
+      memset(&instruction, 0, sizeof(instruction));
+      instruction.kind = FieldInstruction::EXTENSIONS;
+      instruction.number = ranges[next_range]->start;
+      instruction.end_number = ranges[next_range]->end;
+      instruction.has_bit_index = -1;
+      program->instructions.push_back(instruction);
+      ++next_range;
+    }
+    if (i == fields.size()) break;
+
+    const FieldDescriptor* field = fields[i];
+    int offset = type_info_->offsets[field->index()];
+
+    FieldInstruction instruction;
+    memset(&instruction, 0, sizeof(instruction));
+    instruction.type = static_cast<WireFormatLite::FieldType>(field->type());
+    instruction.repeated = field->is_repeated();
+    instruction.packed = field->options().packed();
+    instruction.number = field->number();
+    instruction.offset = offset;
+    instruction.has_bit_index = field->is_repeated() ? -1 : field->index();
+    instruction.tag = WireFormat::MakeTag(field);
+    instruction.tag_size = io::CodedOutputStream::VarintSize32(instruction.tag);
+    instruction.field = field;
+    if (field->is_required()) {
+      program->required_mask[field->index() / 32] |=
+        1u << (field->index() % 32);
+    }
+
+    ParseTableField parse_field;
+    memset(&parse_field, 0, sizeof(parse_field));
+    parse_field.tag = instruction.tag;
+    parse_field.offset = offset;
+    parse_field.has_bit_index = instruction.has_bit_index;
+    parse_field.type = instruction.type;
+    parse_field.repeated = instruction.repeated;
+    parse_field.packed = instruction.packed;
+    // WireFormat checks every string field, whatever the file's options.
+    parse_field.verify_utf8 = field->type() == FieldDescriptor::TYPE_STRING;
+
+    switch (field->cpp_type()) {
+      case FieldDescriptor::CPPTYPE_STRING:
+        if (field->options().ctype() == FieldOptions::STRING_PIECE) {
+          instruction.kind = FieldInstruction::STRING_PIECE;
+          parse_field.string_piece = true;
+        } else {
+          instruction.kind = FieldInstruction::STRING;
+          if (!field->is_repeated()) {
+            parse_field.default_string = &field->default_value_string();
+          }
+        }
+        break;
+      case FieldDescriptor::CPPTYPE_MESSAGE:
+        if (IsLazyField(field)) {
+          instruction.kind = FieldInstruction::LAZY;
+          parse_field.lazy = true;
+        } else {
+          instruction.kind = FieldInstruction::MESSAGE;
+        }
+        instruction.check_initialized =
+          HasRequiredFields(field->message_type());
+        instruction.prototype =
+          factory->GetPrototypeNoLock(field->message_type());
+        parse_field.prototype = instruction.prototype;
+        break;
+      case FieldDescriptor::CPPTYPE_ENUM:
+        parse_field.enum_is_valid_with_arg = &ValidateEnumUsingDescriptor;
+        parse_field.enum_is_valid_arg = field->enum_type();
+        // Fall through.
+      default:
+        instruction.kind = FieldInstruction::PRIMITIVE;
+        if (!field->is_repeated()) {
+          instruction.primitive_size = FieldSpaceUsed(field);
+        }
+        break;
+    }
+
+    program->instructions.push_back(instruction);
+    program->parse_fields.push_back(parse_field);
+  }
+
+  ParseTable* table = &program->parse_table;
+  table->fields =
+    program->parse_fields.empty() ? NULL : &program->parse_fields[0];
+  table->num_fields = program->parse_fields.size();
+  table->has_bits_offset = type_info_->has_bits_offset;
+  table->unknown_fields_offset = type_info_->unknown_fields_offset;
+  table->extensions_offset = type_info_->extensions_offset;
+  table->extension_ranges =
+    program->extension_ranges.empty() ? NULL : &program->extension_ranges[0];
+  table->num_extension_ranges = ranges.size();
+  table->default_instance = this;
+
+  return program;
+}
+
 Message* DynamicMessage::New() const {
   void* new_base = reinterpret_cast<uint8*>(operator new(type_info_->size));
   memset(new_base, 0, type_info_->size);
@@ -409,14 +985,358 @@ Message* DynamicMessage::New() const {
 }
 
 int DynamicMessage::GetCachedSize() const {
-  return cached_byte_size_;
+  return internal::NoBarrier_Load(&cached_byte_size_);
 }
 
 void DynamicMessage::SetCachedSize(int size) const {
-  // This is theoretically not thread-compatible, but in practice it works
-  // because if multiple threads write this simultaneously, they will be
-  // writing the exact same value.
-  cached_byte_size_ = size;
+  // Concurrent serializations of the same message all write the exact same
+  // value here, so a relaxed atomic store is sufficient.
+  internal::NoBarrier_Store(&cached_byte_size_, size);
+}
+
+void DynamicMessage::Clear() {
+  const Program* program = type_info_->program.get();
+  if (program == NULL) return Message::Clear();
+
+  for (int i = 0; i < program->instructions.size(); i++) {
+    const FieldInstruction& instruction = program->instructions[i];
+    void* field_ptr = OffsetToPointer(instruction.offset);
+
+    if (instruction.repeated) {
+      switch (instruction.kind) {
+        case FieldInstruction::PRIMITIVE:
+          ClearRepeatedPrimitiveField(instruction, field_ptr);
+          break;
+        case FieldInstruction::STRING:
+          reinterpret_cast<RepeatedPtrField<string>*>(field_ptr)->Clear();
+          break;
+        case FieldInstruction::STRING_PIECE:
+          reinterpret_cast<RepeatedPtrField<StringPieceField>*>(field_ptr)
+              ->Clear();
+          break;
+        case FieldInstruction::MESSAGE:
+          reinterpret_cast<RepeatedPtrField<Message>*>(field_ptr)->Clear();
+          break;
+        default:
+          break;
+      }
+      continue;
+    }
+
+    if (instruction.kind == FieldInstruction::EXTENSIONS ||
+        !HasBit(instruction.has_bit_index)) {
+      continue;
+    }
+
+    // Reset the field the way GeneratedMessageReflection::ClearField() does.
+    const FieldDescriptor* field = instruction.field;
+    switch (instruction.kind) {
+      case FieldInstruction::PRIMITIVE:
+        memcpy(field_ptr,
+               type_info_->prototype->OffsetToPointer(instruction.offset),
+               instruction.primitive_size);
+        break;
+      case FieldInstruction::STRING: {
+        string* value = *reinterpret_cast<string**>(field_ptr);
+        if (value != &field->default_value_string()) {
+          if (field->has_default_value()) {
+            value->assign(field->default_value_string());
+          } else {
+            value->clear();
+          }
+        }
+        break;
+      }
+      case FieldInstruction::STRING_PIECE: {
+        const string& default_value = field->default_value_string();
+        reinterpret_cast<StringPieceField*>(field_ptr)->SetAliased(
+            default_value.data(), default_value.size());
+        break;
+      }
+      case FieldInstruction::MESSAGE:
+        (*reinterpret_cast<Message**>(field_ptr))->Clear();
+        break;
+      case FieldInstruction::LAZY:
+        reinterpret_cast<LazyField*>(field_ptr)->Clear();
+        break;
+      default:
+        break;
+    }
+  }
+
+  memset(OffsetToPointer(type_info_->has_bits_offset), 0,
+         program->has_bits_size);
+  if (type_info_->extensions_offset != -1) {
+    reinterpret_cast<ExtensionSet*>(
+        OffsetToPointer(type_info_->extensions_offset))->Clear();
+  }
+  reinterpret_cast<UnknownFieldSet*>(
+      OffsetToPointer(type_info_->unknown_fields_offset))->Clear();
+}
+
+bool DynamicMessage::IsInitialized() const {
+  const Program* program = type_info_->program.get();
+  if (program == NULL) return Message::IsInitialized();
+
+  const uint32* has_bits = reinterpret_cast<const uint32*>(
+      OffsetToPointer(type_info_->has_bits_offset));
+  for (int i = 0; i < program->required_mask.size(); i++) {
+    uint32 mask = program->required_mask[i];
+    if ((has_bits[i] & mask) != mask) return false;
+  }
+
+  for (int i = 0; i < program->instructions.size(); i++) {
+    const FieldInstruction& instruction = program->instructions[i];
+    if (!instruction.check_initialized) continue;
+    const void* field_ptr = OffsetToPointer(instruction.offset);
+
+    if (instruction.repeated) {
+      const RepeatedPtrField<Message>& values =
+          *reinterpret_cast<const RepeatedPtrField<Message>*>(field_ptr);
+      for (int j = 0; j < values.size(); j++) {
+        if (!values.Get(j).IsInitialized()) return false;
+      }
+    } else if (HasBit(instruction.has_bit_index)) {
+      if (instruction.kind == FieldInstruction::LAZY) {
+        if (!reinterpret_cast<const LazyField*>(field_ptr)
+                 ->IsInitialized()) {
+          return false;
+        }
+      } else if (!MessageValue(field_ptr).IsInitialized()) {
+        return false;
+      }
+    }
+  }
+
+  if (type_info_->extensions_offset != -1 &&
+      !reinterpret_cast<const ExtensionSet*>(
+          OffsetToPointer(type_info_->extensions_offset))->IsInitialized()) {
+    return false;
+  }
+  return true;
+}
+
+bool DynamicMessage::MergePartialFromCodedStream(
+    io::CodedInputStream* input) {
+  const Program* program = type_info_->program.get();
+  if (program == NULL) return Message::MergePartialFromCodedStream(input);
+  return internal::MergePartialFromCodedStreamImpl<
+      DynamicUnknownFieldHandler>(this, program->parse_table, input);
+}
+
+int DynamicMessage::ByteSize() const {
+  const Program* program = type_info_->program.get();
+  if (program == NULL) return Message::ByteSize();
+
+  int total_size = 0;
+  for (int i = 0; i < program->instructions.size(); i++) {
+    const FieldInstruction& instruction = program->instructions[i];
+    if (instruction.kind == FieldInstruction::EXTENSIONS ||
+        (!instruction.repeated && !HasBit(instruction.has_bit_index))) {
+      continue;
+    }
+    const void* field_ptr = OffsetToPointer(instruction.offset);
+
+    switch (instruction.kind) {
+      case FieldInstruction::PRIMITIVE:
+        total_size += PrimitiveFieldByteSize(instruction, field_ptr);
+        break;
+
+      case FieldInstruction::STRING:
+        if (!instruction.repeated) {
+          total_size += instruction.tag_size +
+                        WireFormatLite::StringSize(StringValue(field_ptr));
+        } else {
+          const RepeatedPtrField<string>& values =
+              *reinterpret_cast<const RepeatedPtrField<string>*>(field_ptr);
+          total_size += instruction.tag_size * values.size();
+          for (int j = 0; j < values.size(); j++) {
+            total_size += WireFormatLite::StringSize(values.Get(j));
+          }
+        }
+        break;
+
+      case FieldInstruction::STRING_PIECE:
+        if (!instruction.repeated) {
+          total_size += instruction.tag_size +
+                        WireFormatLite::StringPieceSize(
+                            *reinterpret_cast<const StringPieceField*>(
+                                field_ptr));
+        } else {
+          const RepeatedPtrField<StringPieceField>& values =
+              *reinterpret_cast<const RepeatedPtrField<StringPieceField>*>(
+                  field_ptr);
+          total_size += instruction.tag_size * values.size();
+          for (int j = 0; j < values.size(); j++) {
+            total_size += WireFormatLite::StringPieceSize(values.Get(j));
+          }
+        }
+        break;
+
+      case FieldInstruction::MESSAGE: {
+        bool group = instruction.type == WireFormatLite::TYPE_GROUP;
+        // Groups have an end tag where messages have a length.
+        int tag_size = group ? 2 * instruction.tag_size : instruction.tag_size;
+        if (!instruction.repeated) {
+          const Message& value = MessageValue(field_ptr);
+          total_size += tag_size + (group ? WireFormatLite::GroupSize(value)
+                                          : WireFormatLite::MessageSize(value));
+        } else {
+          const RepeatedPtrField<Message>& values =
+              *reinterpret_cast<const RepeatedPtrField<Message>*>(field_ptr);
+          total_size += tag_size * values.size();
+          for (int j = 0; j < values.size(); j++) {
+            total_size += group ? WireFormatLite::GroupSize(values.Get(j))
+                                : WireFormatLite::MessageSize(values.Get(j));
+          }
+        }
+        break;
+      }
+
+      case FieldInstruction::LAZY: {
+        int size = reinterpret_cast<const LazyField*>(field_ptr)->ByteSize();
+        total_size += instruction.tag_size +
+                      io::CodedOutputStream::VarintSize32(size) + size;
+        break;
+      }
+
+      default:
+        break;
+    }
+  }
+
+  if (type_info_->extensions_offset != -1) {
+    total_size += reinterpret_cast<const ExtensionSet*>(
+        OffsetToPointer(type_info_->extensions_offset))->ByteSize();
+  }
+  total_size += WireFormat::ComputeUnknownFieldsSize(
+      *reinterpret_cast<const UnknownFieldSet*>(
+          OffsetToPointer(type_info_->unknown_fields_offset)));
+
+  SetCachedSize(total_size);
+  return total_size;
+}
+
+void DynamicMessage::SerializeWithCachedSizes(
+    io::CodedOutputStream* output) const {
+  const Program* program = type_info_->program.get();
+  if (program == NULL) return Message::SerializeWithCachedSizes(output);
+  StreamWriter writer(output);
+  SerializeFields(*program, &writer);
+}
+
+uint8* DynamicMessage::SerializeWithCachedSizesToArray(uint8* target) const {
+  const Program* program = type_info_->program.get();
+  if (program == NULL) return Message::SerializeWithCachedSizesToArray(target);
+  ArrayWriter writer(target);
+  SerializeFields(*program, &writer);
+  return writer.target();
+}
+
+template <typename Writer>
+void DynamicMessage::SerializeFields(const Program& program,
+                                     Writer* writer) const {
+  for (int i = 0; i < program.instructions.size(); i++) {
+    const FieldInstruction& instruction = program.instructions[i];
+    if (instruction.kind == FieldInstruction::EXTENSIONS) {
+      writer->WriteExtensions(
+          *reinterpret_cast<const ExtensionSet*>(
+              OffsetToPointer(type_info_->extensions_offset)),
+          instruction.number, instruction.end_number);
+      continue;
+    }
+    if (!instruction.repeated && !HasBit(instruction.has_bit_index)) {
+      continue;
+    }
+    const void* field_ptr = OffsetToPointer(instruction.offset);
+    bool verify_utf8 = instruction.type == WireFormatLite::TYPE_STRING;
+
+    switch (instruction.kind) {
+      case FieldInstruction::PRIMITIVE:
+        SerializePrimitiveField(instruction, field_ptr, writer);
+        break;
+
+      case FieldInstruction::STRING: {
+        const string* value = NULL;
+        const RepeatedPtrField<string>* values = NULL;
+        int count = 1;
+        if (instruction.repeated) {
+          values =
+              reinterpret_cast<const RepeatedPtrField<string>*>(field_ptr);
+          count = values->size();
+        } else {
+          value = &StringValue(field_ptr);
+        }
+        for (int j = 0; j < count; j++) {
+          if (values != NULL) value = &values->Get(j);
+          if (verify_utf8) {
+            WireFormat::VerifyUTF8String(value->data(), value->size(),
+                                         WireFormat::SERIALIZE);
+          }
+          writer->WriteTag(instruction.tag);
+          writer->WriteVarint32(value->size());
+          writer->WriteString(*value);
+        }
+        break;
+      }
+
+      case FieldInstruction::STRING_PIECE: {
+        const StringPieceField* value =
+            reinterpret_cast<const StringPieceField*>(field_ptr);
+        const RepeatedPtrField<StringPieceField>* values = NULL;
+        int count = 1;
+        if (instruction.repeated) {
+          values = reinterpret_cast<const RepeatedPtrField<StringPieceField>*>(
+              field_ptr);
+          count = values->size();
+        }
+        for (int j = 0; j < count; j++) {
+          if (values != NULL) value = &values->Get(j);
+          if (verify_utf8) {
+            WireFormat::VerifyUTF8String(value->data(), value->size(),
+                                         WireFormat::SERIALIZE);
+          }
+          writer->WriteStringPiece(instruction.number, *value);
+        }
+        break;
+      }
+
+      case FieldInstruction::MESSAGE: {
+        bool group = instruction.type == WireFormatLite::TYPE_GROUP;
+        const Message* value = NULL;
+        const RepeatedPtrField<Message>* values = NULL;
+        int count = 1;
+        if (instruction.repeated) {
+          values =
+              reinterpret_cast<const RepeatedPtrField<Message>*>(field_ptr);
+          count = values->size();
+        } else {
+          value = &MessageValue(field_ptr);
+        }
+        for (int j = 0; j < count; j++) {
+          if (values != NULL) value = &values->Get(j);
+          if (group) {
+            writer->WriteGroup(instruction.number, *value);
+          } else {
+            writer->WriteMessage(instruction.number, *value);
+          }
+        }
+        break;
+      }
+
+      case FieldInstruction::LAZY:
+        writer->WriteTag(instruction.tag);
+        writer->WriteLazyField(*reinterpret_cast<const LazyField*>(field_ptr));
+        break;
+
+      default:
+        break;
+    }
+  }
+
+  writer->WriteUnknownFields(
+      *reinterpret_cast<const UnknownFieldSet*>(
+          OffsetToPointer(type_info_->unknown_fields_offset)));
 }
 
 Metadata DynamicMessage::GetMetadata() const {
@@ -551,6 +1471,8 @@ const Message* DynamicMessageFactory::GetPrototypeNoLock(
   // Cross link prototypes.
   prototype->CrossLinkPrototypes();
 
+  type_info->program.reset(prototype->NewProgram());
+
   return prototype;
 }
 
@@ -46,6 +46,7 @@
 #include <google/protobuf/descriptor.pb.h>
 #include <google/protobuf/test_util.h>
 #include <google/protobuf/unittest.pb.h>
+#include <google/protobuf/io/coded_stream.h>
 
 #include <google/protobuf/testing/googletest.h>
 #include <gtest/gtest.h>
@@ -158,5 +159,144 @@ TEST_F(DynamicMessageTest, SpaceUsed) {
   EXPECT_LT(initial_space_used, message->SpaceUsed());
 }
 
+TEST_F(DynamicMessageTest, ParseAndSerialize) {
+  // DynamicMessage parses and serializes without Reflection; check that it
+  // agrees with the generated code byte for byte.
+  unittest::TestAllTypes generated;
+  TestUtil::SetAllFields(&generated);
+  string data = generated.SerializeAsString();
+
+  scoped_ptr<Message> message(prototype_->New());
+  ASSERT_TRUE(message->ParseFromString(data));
+  TestUtil::ReflectionTester reflection_tester(descriptor_);
+  reflection_tester.ExpectAllFieldsSetViaReflection(*message);
+
+  EXPECT_EQ(data.size(), message->ByteSize());
+  EXPECT_EQ(data, message->SerializeAsString());
+
+  // Parsing into a message which already has fields merges them.
+  io::CodedInputStream input(reinterpret_cast<const uint8*>(data.data()),
+                             data.size());
+  ASSERT_TRUE(message->MergeFromCodedStream(&input));
+  unittest::TestAllTypes merged(generated);
+  merged.MergeFrom(generated);
+  EXPECT_EQ(merged.SerializeAsString(), message->SerializeAsString());
+}
+
+TEST_F(DynamicMessageTest, ParseAndSerializeExtensions) {
+  // The extensions are looked up in the message's own pool.
+  unittest::TestAllExtensions generated;
+  TestUtil::SetAllExtensions(&generated);
+  string data = generated.SerializeAsString();
+
+  scoped_ptr<Message> message(extensions_prototype_->New());
+  ASSERT_TRUE(message->ParseFromString(data));
+  TestUtil::ReflectionTester reflection_tester(extensions_descriptor_);
+  reflection_tester.ExpectAllFieldsSetViaReflection(*message);
+  EXPECT_TRUE(message->GetReflection()->GetUnknownFields(*message).empty());
+
+  EXPECT_EQ(data.size(), message->ByteSize());
+  EXPECT_EQ(data, message->SerializeAsString());
+}
+
+TEST_F(DynamicMessageTest, ParseAndSerializePackedFields) {
+  unittest::TestPackedTypes generated;
+  TestUtil::SetPackedFields(&generated);
+  string data = generated.SerializeAsString();
+
+  scoped_ptr<Message> message(packed_prototype_->New());
+  ASSERT_TRUE(message->ParseFromString(data));
+  TestUtil::ReflectionTester reflection_tester(packed_descriptor_);
+  reflection_tester.ExpectPackedFieldsSetViaReflection(*message);
+
+  EXPECT_EQ(data.size(), message->ByteSize());
+  EXPECT_EQ(data, message->SerializeAsString());
+
+  // Packed fields also accept the unpacked encoding.
+  unittest::TestUnpackedTypes unpacked;
+  TestUtil::SetUnpackedFields(&unpacked);
+  ASSERT_TRUE(message->ParseFromString(unpacked.SerializeAsString()));
+  reflection_tester.ExpectPackedFieldsSetViaReflection(*message);
+}
+
+TEST_F(DynamicMessageTest, UnknownFields) {
+  // Unknown fields, fields of the wrong wire type and unknown enum values
+  // all end up in the UnknownFieldSet and are serialized again.
+  unittest::TestAllTypes generated;
+  TestUtil::SetAllFields(&generated);
+  UnknownFieldSet* unknown_fields = generated.mutable_unknown_fields();
+  unknown_fields->AddVarint(123456, 1);
+  unknown_fields->AddFixed32(unittest::TestAllTypes::kOptionalInt32FieldNumber,
+                             2);
+  unknown_fields->AddVarint(
+      unittest::TestAllTypes::kOptionalNestedEnumFieldNumber, 12345);
+  string data = generated.SerializeAsString();
+
+  scoped_ptr<Message> message(prototype_->New());
+  ASSERT_TRUE(message->ParseFromString(data));
+  EXPECT_EQ(3, message->GetReflection()->GetUnknownFields(*message)
+                   .field_count());
+  EXPECT_EQ(data.size(), message->ByteSize());
+
+  // The generated code does the same, so it serializes the same way.
+  unittest::TestAllTypes reparsed;
+  ASSERT_TRUE(reparsed.ParseFromString(data));
+  EXPECT_EQ(reparsed.SerializeAsString(), message->SerializeAsString());
+}
+
+TEST_F(DynamicMessageTest, Clear) {
+  scoped_ptr<Message> message(prototype_->New());
+  TestUtil::ReflectionTester reflection_tester(descriptor_);
+
+  reflection_tester.SetAllFieldsViaReflection(message.get());
+  message->GetReflection()->MutableUnknownFields(message.get())
+      ->AddVarint(123456, 1);
+  message->Clear();
+  reflection_tester.ExpectClearViaReflection(*message);
+  EXPECT_EQ(0, message->ByteSize());
+  EXPECT_TRUE(message->GetReflection()->GetUnknownFields(*message).empty());
+
+  // Cleared strings and sub-messages are reused.
+  reflection_tester.SetAllFieldsViaReflection(message.get());
+  reflection_tester.ExpectAllFieldsSetViaReflection(*message);
+
+  scoped_ptr<Message> extensions(extensions_prototype_->New());
+  TestUtil::ReflectionTester extensions_tester(extensions_descriptor_);
+  extensions_tester.SetAllFieldsViaReflection(extensions.get());
+  extensions->Clear();
+  extensions_tester.ExpectClearViaReflection(*extensions);
+}
+
+TEST_F(DynamicMessageTest, IsInitialized) {
+  const Descriptor* descriptor =
+    pool_.FindMessageTypeByName("protobuf_unittest.TestRequiredForeign");
+  ASSERT_TRUE(descriptor != NULL);
+  scoped_ptr<Message> message(factory_.GetPrototype(descriptor)->New());
+  const Reflection* reflection = message->GetReflection();
+  EXPECT_TRUE(message->IsInitialized());
+
+  Message* sub_message = reflection->MutableMessage(
+      message.get(), descriptor->FindFieldByName("optional_message"));
+  EXPECT_FALSE(message->IsInitialized());
+  const Descriptor* sub_descriptor = sub_message->GetDescriptor();
+  const Reflection* sub_reflection = sub_message->GetReflection();
+  sub_reflection->SetInt32(sub_message, sub_descriptor->FindFieldByName("a"),
+                           1);
+  sub_reflection->SetInt32(sub_message, sub_descriptor->FindFieldByName("b"),
+                           2);
+  EXPECT_FALSE(message->IsInitialized());
+  sub_reflection->SetInt32(sub_message, sub_descriptor->FindFieldByName("c"),
+                           3);
+  EXPECT_TRUE(message->IsInitialized());
+
+  reflection->AddMessage(message.get(),
+                         descriptor->FindFieldByName("repeated_message"));
+  EXPECT_FALSE(message->IsInitialized());
+  string data;
+  EXPECT_TRUE(message->SerializePartialToString(&data));
+  EXPECT_FALSE(message->ParseFromString(data));
+  EXPECT_TRUE(message->ParsePartialFromString(data));
+}
+
 }  // namespace protobuf
 }  // namespace google
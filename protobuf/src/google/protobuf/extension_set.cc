@@ -32,16 +32,19 @@
 //  Based on original Protocol Buffers design by
 //  Sanjay Ghemawat, Jeff Dean, and others.
 
+#include <algorithm>
 #include <google/protobuf/stubs/hash.h>
 #include <google/protobuf/stubs/common.h>
+#include <google/protobuf/stubs/atomicops.h>
+#include <google/protobuf/stubs/lockfree_hash_map.h>
 #include <google/protobuf/stubs/once.h>
+#include <google/protobuf/stubs/stl_util-inl.h>
 #include <google/protobuf/extension_set.h>
 #include <google/protobuf/message_lite.h>
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/io/zero_copy_stream_impl.h>
 #include <google/protobuf/wire_format_lite_inl.h>
 #include <google/protobuf/repeated_field.h>
-#include <google/protobuf/stubs/map-util.h>
 
 namespace google {
 namespace protobuf {
@@ -58,40 +61,90 @@ inline WireFormatLite::CppType cpp_type(FieldType type) {
   return WireFormatLite::FieldTypeToCppType(real_type(type));
 }
 
-// Registry stuff.
-typedef hash_map<pair<const MessageLite*, int>,
-                 ExtensionInfo> ExtensionRegistry;
+// Registry stuff.  Generated files hand us their extensions lazily (see
+// RegisterDeferredExtensions()), so registrations may race with lookups.
+typedef LockFreeHashMap<pair<const MessageLite*, int>,
+                        const ExtensionInfo*> ExtensionRegistry;
 ExtensionRegistry* registry_ = NULL;
+vector<const ExtensionInfo*>* registry_infos_ = NULL;
+Mutex* registry_mutex_ = NULL;
+
+// Registration functions which have not been run yet.  deferred_mutex_ is
+// held while they run, so that nobody concludes an extension is unknown
+// while it is still being registered.
+vector<void (*)()>* deferred_registrations_ = NULL;
+volatile Atomic32 has_deferred_registrations_ = 0;
+Mutex* deferred_mutex_ = NULL;
+
 GOOGLE_PROTOBUF_DECLARE_ONCE(registry_init_);
 
 void DeleteRegistry() {
   delete registry_;
   registry_ = NULL;
+  STLDeleteElements(registry_infos_);
+  delete registry_infos_;
+  registry_infos_ = NULL;
+  delete registry_mutex_;
+  registry_mutex_ = NULL;
+  delete deferred_registrations_;
+  deferred_registrations_ = NULL;
+  delete deferred_mutex_;
+  deferred_mutex_ = NULL;
 }
 
 void InitRegistry() {
   registry_ = new ExtensionRegistry;
+  registry_infos_ = new vector<const ExtensionInfo*>;
+  registry_mutex_ = new Mutex;
+  deferred_registrations_ = new vector<void (*)()>;
+  deferred_mutex_ = new Mutex;
   internal::OnShutdown(&DeleteRegistry);
 }
 
-// This function is only called at startup, so there is no need for thread-
-// safety.
 void Register(const MessageLite* containing_type,
               int number, ExtensionInfo info) {
   ::google::protobuf::GoogleOnceInit(&registry_init_, &InitRegistry);
 
-  if (!InsertIfNotPresent(registry_, make_pair(containing_type, number),
-                          info)) {
+  MutexLock lock(registry_mutex_);
+  pair<const MessageLite*, int> key(containing_type, number);
+  if (registry_->Find(key) != NULL) {
     GOOGLE_LOG(FATAL) << "Multiple extension registrations for type \""
                << containing_type->GetTypeName()
                << "\", field number " << number << ".";
   }
+  const ExtensionInfo* copy = new ExtensionInfo(info);
+  registry_infos_->push_back(copy);
+  registry_->Insert(key, copy);
+}
+
+// Runs all registration functions handed to RegisterDeferredExtensions() so
+// far.  They are cheap to call again, so there is no harm if one has
+// already run on its own.
+void RunDeferredRegistrations() {
+  MutexLock lock(deferred_mutex_);
+  for (int i = 0; i < deferred_registrations_->size(); i++) {
+    (*deferred_registrations_)[i]();
+  }
+  deferred_registrations_->clear();
+  Release_Store(&has_deferred_registrations_, 0);
 }
 
 const ExtensionInfo* FindRegisteredExtension(
     const MessageLite* containing_type, int number) {
-  return (registry_ == NULL) ? NULL :
-         FindOrNull(*registry_, make_pair(containing_type, number));
+  ::google::protobuf::GoogleOnceInit(&registry_init_, &InitRegistry);
+
+  // Check for deferred registrations before looking:  if there are none,
+  // every registration which ran has been published, so a miss is final.
+  // Checking after a miss would let another thread register the extension
+  // and clear the flag in between, and we would wrongly report it unknown.
+  bool deferred = Acquire_Load(&has_deferred_registrations_) != 0;
+  pair<const MessageLite*, int> key(containing_type, number);
+  const ExtensionInfo* result = registry_->Find(key);
+  if (result == NULL && deferred) {
+    RunDeferredRegistrations();
+    result = registry_->Find(key);
+  }
+  return result;
 }
 
 }  // namespace
@@ -109,6 +162,14 @@ bool GeneratedExtensionFinder::Find(int number, ExtensionInfo* output) {
   }
 }
 
+void ExtensionSet::RegisterDeferredExtensions(void (*register_func)()) {
+  ::google::protobuf::GoogleOnceInit(&registry_init_, &InitRegistry);
+
+  MutexLock lock(deferred_mutex_);
+  deferred_registrations_->push_back(register_func);
+  Release_Store(&has_deferred_registrations_, 1);
+}
+
 void ExtensionSet::RegisterExtension(const MessageLite* containing_type,
                                      int number, FieldType type,
                                      bool is_repeated, bool is_packed) {
@@ -162,7 +223,7 @@ void ExtensionSet::RegisterMessageExtension(const MessageLite* containing_type,
 ExtensionSet::ExtensionSet() {}
 
 ExtensionSet::~ExtensionSet() {
-  for (map<int, Extension>::iterator iter = extensions_.begin();
+  for (ExtensionMap::iterator iter = extensions_.begin();
        iter != extensions_.end(); ++iter) {
     iter->second.Free();
   }
@@ -174,20 +235,20 @@ ExtensionSet::~ExtensionSet() {
 //                                 vector<const FieldDescriptor*>* output) const
 
 bool ExtensionSet::Has(int number) const {
-  map<int, Extension>::const_iterator iter = extensions_.find(number);
+  ExtensionMap::const_iterator iter = extensions_.find(number);
   if (iter == extensions_.end()) return false;
   GOOGLE_DCHECK(!iter->second.is_repeated);
   return !iter->second.is_cleared;
 }
 
 int ExtensionSet::ExtensionSize(int number) const {
-  map<int, Extension>::const_iterator iter = extensions_.find(number);
+  ExtensionMap::const_iterator iter = extensions_.find(number);
   if (iter == extensions_.end()) return false;
   return iter->second.GetSize();
 }
 
 void ExtensionSet::ClearExtension(int number) {
-  map<int, Extension>::iterator iter = extensions_.find(number);
+  ExtensionMap::iterator iter = extensions_.find(number);
   if (iter == extensions_.end()) return;
   iter->second.Clear();
 }
@@ -215,7 +276,7 @@ enum Cardinality {
                                                                                \
 LOWERCASE ExtensionSet::Get##CAMELCASE(int number,                             \
                                        LOWERCASE default_value) const {        \
-  map<int, Extension>::const_iterator iter = extensions_.find(number);         \
+  ExtensionMap::const_iterator iter = extensions_.find(number);                \
   if (iter == extensions_.end() || iter->second.is_cleared) {                  \
     return default_value;                                                      \
   } else {                                                                     \
@@ -240,7 +301,7 @@ void ExtensionSet::Set##CAMELCASE(int number, FieldType type,                  \
 }                                                                              \
                                                                                \
 LOWERCASE ExtensionSet::GetRepeated##CAMELCASE(int number, int index) const {  \
-  map<int, Extension>::const_iterator iter = extensions_.find(number);         \
+  ExtensionMap::const_iterator iter = extensions_.find(number);                \
   GOOGLE_CHECK(iter != extensions_.end()) << "Index out-of-bounds (field is empty)."; \
   GOOGLE_DCHECK_TYPE(iter->second, REPEATED, UPPERCASE);                              \
   return iter->second.repeated_##LOWERCASE##_value->Get(index);                \
@@ -248,7 +309,7 @@ LOWERCASE ExtensionSet::GetRepeated##CAMELCASE(int number, int index) const {  \
                                                                                \
 void ExtensionSet::SetRepeated##CAMELCASE(                                     \
     int number, int index, LOWERCASE value) {                                  \
-  map<int, Extension>::iterator iter = extensions_.find(number);               \
+  ExtensionMap::iterator iter = extensions_.find(number);                      \
   GOOGLE_CHECK(iter != extensions_.end()) << "Index out-of-bounds (field is empty)."; \
   GOOGLE_DCHECK_TYPE(iter->second, REPEATED, UPPERCASE);                              \
   iter->second.repeated_##LOWERCASE##_value->Set(index, value);                \
@@ -285,7 +346,7 @@ PRIMITIVE_ACCESSORS(  BOOL,   bool,   Bool)
 // Enums
 
 int ExtensionSet::GetEnum(int number, int default_value) const {
-  map<int, Extension>::const_iterator iter = extensions_.find(number);
+  ExtensionMap::const_iterator iter = extensions_.find(number);
   if (iter == extensions_.end() || iter->second.is_cleared) {
     // Not present.  Return the default value.
     return default_value;
@@ -310,14 +371,14 @@ void ExtensionSet::SetEnum(int number, FieldType type, int value,
 }
 
 int ExtensionSet::GetRepeatedEnum(int number, int index) const {
-  map<int, Extension>::const_iterator iter = extensions_.find(number);
+  ExtensionMap::const_iterator iter = extensions_.find(number);
   GOOGLE_CHECK(iter != extensions_.end()) << "Index out-of-bounds (field is empty).";
   GOOGLE_DCHECK_TYPE(iter->second, REPEATED, ENUM);
   return iter->second.repeated_enum_value->Get(index);
 }
 
 void ExtensionSet::SetRepeatedEnum(int number, int index, int value) {
-  map<int, Extension>::iterator iter = extensions_.find(number);
+  ExtensionMap::iterator iter = extensions_.find(number);
   GOOGLE_CHECK(iter != extensions_.end()) << "Index out-of-bounds (field is empty).";
   GOOGLE_DCHECK_TYPE(iter->second, REPEATED, ENUM);
   iter->second.repeated_enum_value->Set(index, value);
@@ -345,7 +406,7 @@ void ExtensionSet::AddEnum(int number, FieldType type,
 
 const string& ExtensionSet::GetString(int number,
                                       const string& default_value) const {
-  map<int, Extension>::const_iterator iter = extensions_.find(number);
+  ExtensionMap::const_iterator iter = extensions_.find(number);
   if (iter == extensions_.end() || iter->second.is_cleared) {
     // Not present.  Return the default value.
     return default_value;
@@ -371,14 +432,14 @@ string* ExtensionSet::MutableString(int number, FieldType type,
 }
 
 const string& ExtensionSet::GetRepeatedString(int number, int index) const {
-  map<int, Extension>::const_iterator iter = extensions_.find(number);
+  ExtensionMap::const_iterator iter = extensions_.find(number);
   GOOGLE_CHECK(iter != extensions_.end()) << "Index out-of-bounds (field is empty).";
   GOOGLE_DCHECK_TYPE(iter->second, REPEATED, STRING);
   return iter->second.repeated_string_value->Get(index);
 }
 
 string* ExtensionSet::MutableRepeatedString(int number, int index) {
-  map<int, Extension>::iterator iter = extensions_.find(number);
+  ExtensionMap::iterator iter = extensions_.find(number);
   GOOGLE_CHECK(iter != extensions_.end()) << "Index out-of-bounds (field is empty).";
   GOOGLE_DCHECK_TYPE(iter->second, REPEATED, STRING);
   return iter->second.repeated_string_value->Mutable(index);
@@ -404,7 +465,7 @@ string* ExtensionSet::AddString(int number, FieldType type,
 
 const MessageLite& ExtensionSet::GetMessage(
     int number, const MessageLite& default_value) const {
-  map<int, Extension>::const_iterator iter = extensions_.find(number);
+  ExtensionMap::const_iterator iter = extensions_.find(number);
   if (iter == extensions_.end()) {
     // Not present.  Return the default value.
     return default_value;
@@ -442,14 +503,14 @@ MessageLite* ExtensionSet::MutableMessage(int number, FieldType type,
 
 const MessageLite& ExtensionSet::GetRepeatedMessage(
     int number, int index) const {
-  map<int, Extension>::const_iterator iter = extensions_.find(number);
+  ExtensionMap::const_iterator iter = extensions_.find(number);
   GOOGLE_CHECK(iter != extensions_.end()) << "Index out-of-bounds (field is empty).";
   GOOGLE_DCHECK_TYPE(iter->second, REPEATED, MESSAGE);
   return iter->second.repeated_message_value->Get(index);
 }
 
 MessageLite* ExtensionSet::MutableRepeatedMessage(int number, int index) {
-  map<int, Extension>::iterator iter = extensions_.find(number);
+  ExtensionMap::iterator iter = extensions_.find(number);
   GOOGLE_CHECK(iter != extensions_.end()) << "Index out-of-bounds (field is empty).";
   GOOGLE_DCHECK_TYPE(iter->second, REPEATED, MESSAGE);
   return iter->second.repeated_message_value->Mutable(index);
@@ -488,7 +549,7 @@ MessageLite* ExtensionSet::AddMessage(int number, FieldType type,
 #undef GOOGLE_DCHECK_TYPE
 
 void ExtensionSet::RemoveLast(int number) {
-  map<int, Extension>::iterator iter = extensions_.find(number);
+  ExtensionMap::iterator iter = extensions_.find(number);
   GOOGLE_CHECK(iter != extensions_.end()) << "Index out-of-bounds (field is empty).";
 
   Extension* extension = &iter->second;
@@ -529,7 +590,7 @@ void ExtensionSet::RemoveLast(int number) {
 }
 
 void ExtensionSet::SwapElements(int number, int index1, int index2) {
-  map<int, Extension>::iterator iter = extensions_.find(number);
+  ExtensionMap::iterator iter = extensions_.find(number);
   GOOGLE_CHECK(iter != extensions_.end()) << "Index out-of-bounds (field is empty).";
 
   Extension* extension = &iter->second;
@@ -572,14 +633,14 @@ void ExtensionSet::SwapElements(int number, int index1, int index2) {
 // ===================================================================
 
 void ExtensionSet::Clear() {
-  for (map<int, Extension>::iterator iter = extensions_.begin();
+  for (ExtensionMap::iterator iter = extensions_.begin();
        iter != extensions_.end(); ++iter) {
     iter->second.Clear();
   }
 }
 
 void ExtensionSet::MergeFrom(const ExtensionSet& other) {
-  for (map<int, Extension>::const_iterator iter = other.extensions_.begin();
+  for (ExtensionMap::const_iterator iter = other.extensions_.begin();
        iter != other.extensions_.end(); ++iter) {
     const Extension& other_extension = iter->second;
 
@@ -682,7 +743,7 @@ void ExtensionSet::Swap(ExtensionSet* x) {
 bool ExtensionSet::IsInitialized() const {
   // Extensions are never required.  However, we need to check that all
   // embedded messages are initialized.
-  for (map<int, Extension>::const_iterator iter = extensions_.begin();
+  for (ExtensionMap::const_iterator iter = extensions_.begin();
        iter != extensions_.end(); ++iter) {
     const Extension& extension = iter->second;
     if (cpp_type(extension.type) == WireFormatLite::CPPTYPE_MESSAGE) {
@@ -1001,7 +1062,7 @@ bool ExtensionSet::ParseMessageSetItem(io::CodedInputStream* input,
 void ExtensionSet::SerializeWithCachedSizes(
     int start_field_number, int end_field_number,
     io::CodedOutputStream* output) const {
-  map<int, Extension>::const_iterator iter;
+  ExtensionMap::const_iterator iter;
   for (iter = extensions_.lower_bound(start_field_number);
        iter != extensions_.end() && iter->first < end_field_number;
        ++iter) {
@@ -1011,7 +1072,7 @@ void ExtensionSet::SerializeWithCachedSizes(
 
 void ExtensionSet::SerializeMessageSetWithCachedSizes(
     io::CodedOutputStream* output) const {
-  map<int, Extension>::const_iterator iter;
+  ExtensionMap::const_iterator iter;
   for (iter = extensions_.begin(); iter != extensions_.end(); ++iter) {
     iter->second.SerializeMessageSetItemWithCachedSizes(iter->first, output);
   }
@@ -1020,7 +1081,7 @@ void ExtensionSet::SerializeMessageSetWithCachedSizes(
 int ExtensionSet::ByteSize() const {
   int total_size = 0;
 
-  for (map<int, Extension>::const_iterator iter = extensions_.begin();
+  for (ExtensionMap::const_iterator iter = extensions_.begin();
        iter != extensions_.end(); ++iter) {
     total_size += iter->second.ByteSize(iter->first);
   }
@@ -1031,7 +1092,7 @@ int ExtensionSet::ByteSize() const {
 int ExtensionSet::MessageSetByteSize() const {
   int total_size = 0;
 
-  for (map<int, Extension>::const_iterator iter = extensions_.begin();
+  for (ExtensionMap::const_iterator iter = extensions_.begin();
        iter != extensions_.end(); ++iter) {
     total_size += iter->second.MessageSetItemByteSize(iter->first);
   }
@@ -1045,13 +1106,42 @@ int ExtensionSet::MessageSetByteSize() const {
 bool ExtensionSet::MaybeNewExtension(int number,
                                      const FieldDescriptor* descriptor,
                                      Extension** result) {
-  pair<map<int, Extension>::iterator, bool> insert_result =
+  pair<ExtensionMap::iterator, bool> insert_result =
       extensions_.insert(make_pair(number, Extension()));
   *result = &insert_result.first->second;
   (*result)->descriptor = descriptor;
   return insert_result.second;
 }
 
+// ===================================================================
+// Methods of ExtensionSet::ExtensionMap
+
+pair<ExtensionSet::ExtensionMap::iterator, bool>
+ExtensionSet::ExtensionMap::insert(const value_type& value) {
+  // Fast path:  appending in field number order, as when parsing.
+  int index = size_;
+  if (size_ > 0 && entries_[size_ - 1].first >= value.first) {
+    index = lower_bound(value.first) - entries_;
+    if (entries_[index].first == value.first) {
+      return make_pair(entries_ + index, false);
+    }
+  }
+
+  if (size_ == capacity_) {
+    value_type* old_entries = entries_;
+    capacity_ = (capacity_ == 0) ? kInitialCapacity : capacity_ * 2;
+    entries_ = new value_type[capacity_];
+    std::copy(old_entries, old_entries + size_, entries_);
+    delete [] old_entries;
+  }
+
+  std::copy_backward(entries_ + index, entries_ + size_,
+                     entries_ + size_ + 1);
+  entries_[index] = value;
+  ++size_;
+  return make_pair(entries_ + index, true);
+}
+
 // ===================================================================
 // Methods of ExtensionSet::Extension
 
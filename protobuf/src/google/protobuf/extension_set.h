@@ -38,6 +38,7 @@
 #ifndef GOOGLE_PROTOBUF_EXTENSION_SET_H__
 #define GOOGLE_PROTOBUF_EXTENSION_SET_H__
 
+#include <algorithm>
 #include <vector>
 #include <stack>
 #include <map>
@@ -157,11 +158,10 @@ class LIBPROTOBUF_EXPORT ExtensionSet {
   ExtensionSet();
   ~ExtensionSet();
 
-  // These are called at startup by protocol-compiler-generated code to
-  // register known extensions.  The registrations are used by ParseField()
-  // to look up extensions for parsed field numbers.  Note that dynamic parsing
-  // does not use ParseField(); only protocol-compiler-generated parsing
-  // methods do.
+  // These are called by protocol-compiler-generated code to register known
+  // extensions.  The registrations are used by ParseField() to look up
+  // extensions for parsed field numbers.  Note that dynamic parsing does not
+  // use ParseField(); only protocol-compiler-generated parsing methods do.
   static void RegisterExtension(const MessageLite* containing_type,
                                 int number, FieldType type,
                                 bool is_repeated, bool is_packed);
@@ -174,6 +174,13 @@ class LIBPROTOBUF_EXPORT ExtensionSet {
                                        bool is_repeated, bool is_packed,
                                        const MessageLite* prototype);
 
+  // Called at startup by protocol-compiler-generated code, instead of
+  // registering a file's extensions right away.  register_func is run the
+  // first time a lookup does not find an extension, and must register the
+  // extensions using the functions above.  It may already have run by then,
+  // and so must do nothing when called again.
+  static void RegisterDeferredExtensions(void (*register_func)());
+
   // =================================================================
 
   // Add all fields which are currently present to the given vector.  This
@@ -473,13 +480,92 @@ class LIBPROTOBUF_EXPORT ExtensionSet {
   static inline int RepeatedMessage_SpaceUsedExcludingSelf(
       RepeatedPtrFieldBase* field);
 
-  // The Extension struct is small enough to be passed by value, so we use it
-  // directly as the value type in the map rather than use pointers.  We use
-  // a map rather than hash_map here because we expect most ExtensionSets will
-  // only contain a small number of extensions whereas hash_map is optimized
-  // for 100 elements or more.  Also, we want AppendToList() to order fields
-  // by field number.
-  map<int, Extension> extensions_;
+  // A map from field number to Extension, kept as a heap array sorted by
+  // field number.  We expect most ExtensionSets to contain only a few
+  // extensions, for which a binary search of a short array is faster than
+  // walking a tree, and holding them all in one array which grows by
+  // doubling saves allocating a node per extension.  Extensions are usually
+  // added in increasing field number order, as when parsing, in which case
+  // insert() appends without moving anything.  An empty ExtensionMap
+  // allocates nothing, so messages which merely allow extensions stay small.
+  //
+  // The interface is the subset of map<int, Extension>'s that ExtensionSet
+  // uses.  Iteration is in field number order, which AppendToList() and
+  // serialization rely on.  Any insert() invalidates iterators and pointers
+  // to entries; the Extension struct is small and holds its data by
+  // pointer, so moving entries is cheap.
+  class ExtensionMap {
+   public:
+    typedef pair<int, Extension> value_type;
+    typedef value_type* iterator;
+    typedef const value_type* const_iterator;
+
+    ExtensionMap() : entries_(NULL), size_(0), capacity_(0) {}
+    ~ExtensionMap() { delete [] entries_; }
+
+    iterator begin() { return entries_; }
+    iterator end() { return entries_ + size_; }
+    const_iterator begin() const { return entries_; }
+    const_iterator end() const { return entries_ + size_; }
+    int size() const { return size_; }
+
+    // Returns the first entry whose field number is not less than number.
+    iterator lower_bound(int number) {
+      // A linear scan is faster than a binary search for short arrays, since
+      // its branches are predictable.
+      if (size_ <= kMaxLinearSearchSize) {
+        iterator iter = entries_;
+        while (iter != entries_ + size_ && iter->first < number) ++iter;
+        return iter;
+      }
+
+      int low = 0, high = size_;
+      while (low < high) {
+        int middle = (low + high) / 2;
+        if (entries_[middle].first < number) {
+          low = middle + 1;
+        } else {
+          high = middle;
+        }
+      }
+      return entries_ + low;
+    }
+    const_iterator lower_bound(int number) const {
+      return const_cast<ExtensionMap*>(this)->lower_bound(number);
+    }
+
+    iterator find(int number) {
+      iterator iter = lower_bound(number);
+      return (iter != end() && iter->first == number) ? iter : end();
+    }
+    const_iterator find(int number) const {
+      return const_cast<ExtensionMap*>(this)->find(number);
+    }
+
+    pair<iterator, bool> insert(const value_type& value);
+
+    void swap(ExtensionMap& other) {
+      std::swap(entries_, other.entries_);
+      std::swap(size_, other.size_);
+      std::swap(capacity_, other.capacity_);
+    }
+
+    int SpaceUsedExcludingSelf() const {
+      return capacity_ * sizeof(value_type);
+    }
+
+   private:
+    static const int kInitialCapacity = 4;
+    static const int kMaxLinearSearchSize = 8;
+
+    value_type* entries_;  // NULL until the first insert().
+    int size_;
+    int capacity_;
+
+    GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(ExtensionMap);
+  };
+
+  ExtensionMap extensions_;
 
   GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(ExtensionSet);
 };
@@ -754,7 +840,7 @@ class RepeatedMessageTypeTraits {
 // of reference to any simple defined in the extension's .pb.o file.  Some
 // linkers will actually drop object files that are not explicitly referenced,
 // but that would be bad because it would cause this extension to not be
-// registered at static initialization, and therefore using it would crash.
+// registered, and therefore using it would crash.
 
 template <typename ExtendeeType, typename TypeTraitsType,
           FieldType field_type, bool is_packed>
@@ -775,6 +861,41 @@ class ExtensionIdentifier {
   typename TypeTraits::ConstType default_value_;
 };
 
+// Message extensions do not hold on to their default value, since taking a
+// reference to Type::default_instance() at static initialization would
+// construct it there.
+template <typename ExtendeeType, typename Type,
+          FieldType field_type, bool is_packed>
+class ExtensionIdentifier<ExtendeeType, MessageTypeTraits<Type>,
+                          field_type, is_packed> {
+ public:
+  typedef MessageTypeTraits<Type> TypeTraits;
+  typedef ExtendeeType Extendee;
+
+  explicit ExtensionIdentifier(int number) : number_(number) {}
+  inline int number() const { return number_; }
+  const Type& default_value() const { return Type::default_instance(); }
+
+ private:
+  const int number_;
+};
+
+template <typename ExtendeeType, typename Type,
+          FieldType field_type, bool is_packed>
+class ExtensionIdentifier<ExtendeeType, RepeatedMessageTypeTraits<Type>,
+                          field_type, is_packed> {
+ public:
+  typedef RepeatedMessageTypeTraits<Type> TypeTraits;
+  typedef ExtendeeType Extendee;
+
+  explicit ExtensionIdentifier(int number) : number_(number) {}
+  inline int number() const { return number_; }
+  const Type& default_value() const { return Type::default_instance(); }
+
+ private:
+  const int number_;
+};
+
 // -------------------------------------------------------------------
 // Generated accessors
 
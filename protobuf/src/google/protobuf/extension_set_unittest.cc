@@ -48,6 +48,12 @@
 #include <gtest/gtest.h>
 #include <google/protobuf/stubs/stl_util-inl.h>
 
+#include "config.h"
+
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#endif
+
 namespace google {
 namespace protobuf {
 namespace internal {
@@ -179,6 +185,46 @@ TEST(ExtensionSetTest, SwapWithSelf) {
   TestUtil::ExpectAllExtensionsSet(message);
 }
 
+TEST(ExtensionSetTest, SetInAnyOrder) {
+  // Extensions are kept sorted by field number however they are added, so
+  // the order in which they are set does not affect lookups or the
+  // serialized output.
+  unittest::TestAllExtensions ascending, descending, mixed;
+
+  ascending.SetExtension(unittest::optional_int32_extension, 1);
+  ascending.SetExtension(unittest::optional_string_extension, "foo");
+  ascending.MutableExtension(unittest::optional_nested_message_extension)
+           ->set_bb(2);
+  ascending.AddExtension(unittest::repeated_int64_extension, 3);
+  ascending.SetExtension(unittest::default_bool_extension, false);
+
+  descending.SetExtension(unittest::default_bool_extension, false);
+  descending.AddExtension(unittest::repeated_int64_extension, 3);
+  descending.MutableExtension(unittest::optional_nested_message_extension)
+            ->set_bb(2);
+  descending.SetExtension(unittest::optional_string_extension, "foo");
+  descending.SetExtension(unittest::optional_int32_extension, 1);
+
+  mixed.AddExtension(unittest::repeated_int64_extension, 3);
+  mixed.SetExtension(unittest::optional_int32_extension, 1);
+  mixed.SetExtension(unittest::default_bool_extension, false);
+  mixed.SetExtension(unittest::optional_string_extension, "foo");
+  mixed.MutableExtension(unittest::optional_nested_message_extension)
+       ->set_bb(2);
+
+  string expected = ascending.SerializeAsString();
+  EXPECT_EQ(expected, descending.SerializeAsString());
+  EXPECT_EQ(expected, mixed.SerializeAsString());
+
+  EXPECT_EQ(1, mixed.GetExtension(unittest::optional_int32_extension));
+  EXPECT_EQ("foo", mixed.GetExtension(unittest::optional_string_extension));
+  EXPECT_EQ(2, mixed.GetExtension(
+      unittest::optional_nested_message_extension).bb());
+  EXPECT_EQ(3, mixed.GetExtension(unittest::repeated_int64_extension, 0));
+  EXPECT_FALSE(mixed.GetExtension(unittest::default_bool_extension));
+  EXPECT_FALSE(mixed.HasExtension(unittest::optional_int64_extension));
+}
+
 TEST(ExtensionSetTest, SerializationToArray) {
   // Serialize as TestAllExtensions and parse as TestAllTypes to insure wire
   // compatibility of extensions.
@@ -470,6 +516,87 @@ TEST(ExtensionSetTest, SpaceUsedExcludingSelf) {
   }
 }
 
+const int kDeferredExtensionNumber = 536870000;
+int deferred_registration_calls = 0;
+
+void RegisterDeferredExtension() {
+  // Like generated code, must do nothing when called again.
+  if (deferred_registration_calls++ > 0) return;
+  ExtensionSet::RegisterExtension(
+      &unittest::TestAllExtensions::default_instance(),
+      kDeferredExtensionNumber, WireFormatLite::TYPE_INT32, false, false);
+}
+
+TEST(ExtensionSetTest, DeferredRegistration) {
+  ExtensionSet::RegisterDeferredExtensions(&RegisterDeferredExtension);
+  EXPECT_EQ(0, deferred_registration_calls);
+
+  string data;
+  {
+    io::StringOutputStream raw_output(&data);
+    io::CodedOutputStream output(&raw_output);
+    output.WriteVarint32(123);
+  }
+
+  // Parsing a number nobody has registered yet runs the registration.
+  io::ArrayInputStream raw_input(data.data(), data.size());
+  io::CodedInputStream input(&raw_input);
+  ExtensionSet set;
+  uint32 tag = WireFormatLite::MakeTag(kDeferredExtensionNumber,
+                                       WireFormatLite::WIRETYPE_VARINT);
+  const MessageLite* containing_type =
+      &unittest::TestAllExtensions::default_instance();
+  EXPECT_TRUE(set.ParseField(tag, &input, containing_type));
+  EXPECT_EQ(1, deferred_registration_calls);
+  ASSERT_TRUE(set.Has(kDeferredExtensionNumber));
+  EXPECT_EQ(123, set.GetInt32(kDeferredExtensionNumber, 0));
+}
+
+#ifdef HAVE_PTHREAD
+
+const int kRacingExtensionBase = 536871000;
+const int kRacingRounds = 200;
+int racing_extension_number = 0;
+
+void RegisterRacingExtension() {
+  ExtensionSet::RegisterExtension(
+      &unittest::TestAllExtensions::default_instance(),
+      racing_extension_number, WireFormatLite::TYPE_INT32, false, false);
+}
+
+void* FindRacingExtension(void* arg) {
+  GeneratedExtensionFinder finder(
+      &unittest::TestAllExtensions::default_instance());
+  ExtensionInfo info;
+  *reinterpret_cast<bool*>(arg) = finder.Find(racing_extension_number, &info);
+  return NULL;
+}
+
+TEST(ExtensionSetTest, DeferredRegistrationFromTwoThreads) {
+  // Two threads look up an extension whose registration is still deferred.
+  // Whichever one does not run the registration must still find it, even
+  // if the other finishes the registration between its lookup and its check
+  // for deferred registrations.  Each round registers a new number.
+  for (int round = 0; round < kRacingRounds; round++) {
+    racing_extension_number = kRacingExtensionBase + round;
+    ExtensionSet::RegisterDeferredExtensions(&RegisterRacingExtension);
+
+    bool found[2] = { false, false };
+    pthread_t threads[2];
+    for (int i = 0; i < 2; i++) {
+      ASSERT_EQ(0, pthread_create(&threads[i], NULL, &FindRacingExtension,
+                                  &found[i]));
+    }
+    for (int i = 0; i < 2; i++) {
+      pthread_join(threads[i], NULL);
+    }
+    EXPECT_TRUE(found[0]) << "round " << round;
+    EXPECT_TRUE(found[1]) << "round " << round;
+  }
+}
+
+#endif  // HAVE_PTHREAD
+
 #ifdef GTEST_HAS_DEATH_TEST
 
 TEST(ExtensionSetTest, InvalidEnumDeath) {
@@ -36,9 +36,13 @@
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/descriptor.pb.h>
+#include <google/protobuf/arena.h>
 #include <google/protobuf/repeated_field.h>
 #include <google/protobuf/extension_set.h>
+#include <google/protobuf/lazy_field.h>
+#include <google/protobuf/string_piece_field.h>
 #include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/wire_format.h>
 #include <google/protobuf/stubs/common.h>
 
 namespace google {
@@ -74,6 +78,12 @@ const string& NameOfEnum(const EnumDescriptor* descriptor, int value) {
   return (d == NULL ? kEmptyString : d->name());
 }
 
+bool IsLazyField(const FieldDescriptor* field) {
+  return field->options().lazy() &&
+         field->type() == FieldDescriptor::TYPE_MESSAGE &&
+         !field->is_repeated() && !field->is_extension();
+}
+
 // ===================================================================
 // Helpers for reporting usage errors (e.g. trying to use GetInt32() on
 // a string field).
@@ -188,10 +198,13 @@ GeneratedMessageReflection::GeneratedMessageReflection(
     descriptor_pool_  ((descriptor_pool == NULL) ?
                          DescriptorPool::generated_pool() :
                          descriptor_pool),
-    message_factory_  (factory) {
+    message_factory_  (factory),
+    wire_format_plan_ (NULL) {
 }
 
-GeneratedMessageReflection::~GeneratedMessageReflection() {}
+GeneratedMessageReflection::~GeneratedMessageReflection() {
+  WireFormat::DeletePlan(wire_format_plan_);
+}
 
 const UnknownFieldSet& GeneratedMessageReflection::GetUnknownFields(
     const Message& message) const {
@@ -245,6 +258,11 @@ int GeneratedMessageReflection::SpaceUsed(const Message& message) const {
               total_size += GetRaw<RepeatedPtrField<string> >(message, field)
                               .SpaceUsedExcludingSelf();
               break;
+            case FieldOptions::STRING_PIECE:
+              total_size +=
+                  GetRaw<RepeatedPtrField<StringPieceField> >(message, field)
+                    .SpaceUsedExcludingSelf();
+              break;
           }
           break;
 
@@ -287,12 +305,25 @@ int GeneratedMessageReflection::SpaceUsed(const Message& message) const {
               }
               break;
             }
+            case FieldOptions::STRING_PIECE:
+              // The StringPieceField itself is inline, so only its owned
+              // copy, if any, is extra.
+              total_size += GetRaw<StringPieceField>(message, field)
+                              .SpaceUsedExcludingSelf();
+              break;
           }
           break;
         }
 
         case FieldDescriptor::CPPTYPE_MESSAGE:
-          if (&message == default_instance_) {
+          if (IsLazyField(field)) {
+            const LazyField& lazy = GetRaw<LazyField>(message, field);
+            total_size += lazy.SpaceUsedExcludingSelf();
+            if (lazy.allocated_message() != NULL) {
+              total_size += static_cast<const Message*>(
+                  lazy.allocated_message())->SpaceUsed();
+            }
+          } else if (&message == default_instance_) {
             // For singular fields, the prototype just stores a pointer to the
             // external type's prototype, so there is no extra memory usage.
           } else {
@@ -330,6 +361,16 @@ void GeneratedMessageReflection::Swap(
     << "\").  Note that the exact same class is required; not just the same "
        "descriptor.";
 
+  if (message1->GetArena() != message2->GetArena()) {
+    // Objects owned by one arena can't be handed to a message on another
+    // arena (or on the heap), so swap by copying instead.
+    scoped_ptr<Message> temp(message1->New());
+    temp->MergeFrom(*message1);
+    message1->CopyFrom(*message2);
+    message2->CopyFrom(*temp);
+    return;
+  }
+
   uint32* has_bits1 = MutableHasBits(message1);
   uint32* has_bits2 = MutableHasBits(message2);
   int has_bits_size = (descriptor_->field_count() + 31) / 32;
@@ -383,9 +424,18 @@ void GeneratedMessageReflection::Swap(
           SWAP_VALUES(DOUBLE, double);
           SWAP_VALUES(BOOL  , bool  );
           SWAP_VALUES(ENUM  , int   );
-          SWAP_VALUES(MESSAGE, Message*);
 #undef SWAP_VALUES
 
+        case FieldDescriptor::CPPTYPE_MESSAGE:
+          if (IsLazyField(field)) {
+            MutableRaw<LazyField>(message1, field)->Swap(
+                MutableRaw<LazyField>(message2, field));
+          } else {
+            std::swap(*MutableRaw<Message*>(message1, field),
+                      *MutableRaw<Message*>(message2, field));
+          }
+          break;
+
         case FieldDescriptor::CPPTYPE_STRING:
           switch (field->options().ctype()) {
             default:  // TODO(kenton):  Support other string reps.
@@ -393,6 +443,10 @@ void GeneratedMessageReflection::Swap(
               std::swap(*MutableRaw<string*>(message1, field),
                         *MutableRaw<string*>(message2, field));
               break;
+            case FieldOptions::STRING_PIECE:
+              MutableRaw<StringPieceField>(message1, field)->Swap(
+                  MutableRaw<StringPieceField>(message2, field));
+              break;
           }
           break;
 
@@ -491,7 +545,7 @@ void GeneratedMessageReflection::ClearField(
         case FieldDescriptor::CPPTYPE_STRING: {
           switch (field->options().ctype()) {
             default:  // TODO(kenton):  Support other string reps.
-            case FieldOptions::STRING:
+            case FieldOptions::STRING: {
               const string* default_ptr = DefaultRaw<const string*>(field);
               string** value = MutableRaw<string*>(message, field);
               if (*value != default_ptr) {
@@ -502,12 +556,25 @@ void GeneratedMessageReflection::ClearField(
                 }
               }
               break;
+            }
+            case FieldOptions::STRING_PIECE: {
+              // The descriptor's default outlives the message, so it can be
+              // aliased just like the generated code aliases its literal.
+              const string& default_value = field->default_value_string();
+              MutableRaw<StringPieceField>(message, field)->SetAliased(
+                  default_value.data(), default_value.size());
+              break;
+            }
           }
           break;
         }
 
         case FieldDescriptor::CPPTYPE_MESSAGE:
-          (*MutableRaw<Message*>(message, field))->Clear();
+          if (IsLazyField(field)) {
+            MutableRaw<LazyField>(message, field)->Clear();
+          } else {
+            (*MutableRaw<Message*>(message, field))->Clear();
+          }
           break;
       }
     }
@@ -534,6 +601,10 @@ void GeneratedMessageReflection::ClearField(
           case FieldOptions::STRING:
             MutableRaw<RepeatedPtrField<string> >(message, field)->Clear();
             break;
+          case FieldOptions::STRING_PIECE:
+            MutableRaw<RepeatedPtrField<StringPieceField> >(message, field)
+                ->Clear();
+            break;
         }
         break;
       }
@@ -580,6 +651,10 @@ void GeneratedMessageReflection::RemoveLast(
           case FieldOptions::STRING:
             MutableRaw<RepeatedPtrField<string> >(message, field)->RemoveLast();
             break;
+          case FieldOptions::STRING_PIECE:
+            MutableRaw<RepeatedPtrField<StringPieceField> >(message, field)
+                ->RemoveLast();
+            break;
         }
         break;
 
@@ -754,6 +829,8 @@ string GeneratedMessageReflection::GetString(
       default:  // TODO(kenton):  Support other string reps.
       case FieldOptions::STRING:
         return *GetField<const string*>(message, field);
+      case FieldOptions::STRING_PIECE:
+        return GetField<StringPieceField>(message, field).ToString();
     }
 
     GOOGLE_LOG(FATAL) << "Can't get here.";
@@ -773,6 +850,9 @@ const string& GeneratedMessageReflection::GetStringReference(
       default:  // TODO(kenton):  Support other string reps.
       case FieldOptions::STRING:
         return *GetField<const string*>(message, field);
+      case FieldOptions::STRING_PIECE:
+        *scratch = GetField<StringPieceField>(message, field).ToString();
+        return *scratch;
     }
 
     GOOGLE_LOG(FATAL) << "Can't get here.";
@@ -794,12 +874,15 @@ void GeneratedMessageReflection::SetString(
       case FieldOptions::STRING: {
         string** ptr = MutableField<string*>(message, field);
         if (*ptr == DefaultRaw<const string*>(field)) {
-          *ptr = new string(value);
-        } else {
-          (*ptr)->assign(value);
+          *ptr = Arena::Create<string>(message->GetArena());
         }
+        (*ptr)->assign(value);
         break;
       }
+      case FieldOptions::STRING_PIECE:
+        MutableField<StringPieceField>(message, field)->CopyFrom(
+            value.data(), value.size());
+        break;
     }
   }
 }
@@ -815,6 +898,9 @@ string GeneratedMessageReflection::GetRepeatedString(
       default:  // TODO(kenton):  Support other string reps.
       case FieldOptions::STRING:
         return GetRepeatedPtrField<string>(message, field, index);
+      case FieldOptions::STRING_PIECE:
+        return GetRepeatedPtrField<StringPieceField>(message, field, index)
+            .ToString();
     }
 
     GOOGLE_LOG(FATAL) << "Can't get here.";
@@ -833,6 +919,10 @@ const string& GeneratedMessageReflection::GetRepeatedStringReference(
       default:  // TODO(kenton):  Support other string reps.
       case FieldOptions::STRING:
         return GetRepeatedPtrField<string>(message, field, index);
+      case FieldOptions::STRING_PIECE:
+        *scratch = GetRepeatedPtrField<StringPieceField>(message, field, index)
+                     .ToString();
+        return *scratch;
     }
 
     GOOGLE_LOG(FATAL) << "Can't get here.";
@@ -854,6 +944,10 @@ void GeneratedMessageReflection::SetRepeatedString(
       case FieldOptions::STRING:
         *MutableRepeatedField<string>(message, field, index) = value;
         break;
+      case FieldOptions::STRING_PIECE:
+        MutableRepeatedField<StringPieceField>(message, field, index)
+            ->CopyFrom(value.data(), value.size());
+        break;
     }
   }
 }
@@ -872,6 +966,10 @@ void GeneratedMessageReflection::AddString(
       case FieldOptions::STRING:
         *AddField<string>(message, field) = value;
         break;
+      case FieldOptions::STRING_PIECE:
+        AddField<StringPieceField>(message, field)->CopyFrom(
+            value.data(), value.size());
+        break;
     }
   }
 }
@@ -968,6 +1066,11 @@ const Message& GeneratedMessageReflection::GetMessage(
         GetExtensionSet(message).GetMessage(
           field->number(), field->message_type(),
           factory == NULL ? message_factory_ : factory));
+  } else if (IsLazyField(field)) {
+    if (factory == NULL) factory = message_factory_;
+    return static_cast<const Message&>(
+        GetRaw<LazyField>(message, field).Get(
+          *factory->GetPrototype(field->message_type())));
   } else {
     const Message* result = GetRaw<const Message*>(message, field);
     if (result == NULL) {
@@ -986,11 +1089,19 @@ Message* GeneratedMessageReflection::MutableMessage(
     return static_cast<Message*>(
         MutableExtensionSet(message)->MutableMessage(field,
           factory == NULL ? message_factory_ : factory));
+  } else if (IsLazyField(field)) {
+    if (factory == NULL) factory = message_factory_;
+    return static_cast<Message*>(
+        MutableField<LazyField>(message, field)->Mutable(
+          *factory->GetPrototype(field->message_type())));
   } else {
     Message** result = MutableField<Message*>(message, field);
     if (*result == NULL) {
       const Message* default_message = DefaultRaw<const Message*>(field);
-      *result = default_message->New();
+      // An arena message never deletes its sub-messages, so they go on the
+      // arena too.
+      *result = static_cast<Message*>(
+          default_message->NewOnArena(message->GetArena()));
     }
     return *result;
   }
@@ -1092,6 +1203,18 @@ const FieldDescriptor* GeneratedMessageReflection::FindKnownExtensionByNumber(
   return descriptor_pool_->FindExtensionByNumber(descriptor_, number);
 }
 
+// -------------------------------------------------------------------
+
+const ExtensionSet* GeneratedMessageReflection::GetExtensionSetForWireFormat(
+    const Message& message) const {
+  if (extensions_offset_ == -1) return NULL;
+  return &GetExtensionSet(message);
+}
+
+const WireFormatPlan* GeneratedMessageReflection::GetWireFormatPlan() const {
+  return WireFormat::GetPlan(descriptor_, &wire_format_plan_);
+}
+
 // ===================================================================
 // Some private helpers.
 
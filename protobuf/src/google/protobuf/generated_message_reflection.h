@@ -42,6 +42,7 @@
 #include <vector>
 #include <google/protobuf/message.h>
 #include <google/protobuf/unknown_field_set.h>
+#include <google/protobuf/generated_message_util.h>
 
 
 namespace google {
@@ -273,6 +274,11 @@ class LIBPROTOBUF_EXPORT GeneratedMessageReflection : public Reflection {
  private:
   friend class GeneratedMessage;
 
+  // implements Reflection's hooks for WireFormat.
+  const ExtensionSet* GetExtensionSetForWireFormat(
+      const Message& message) const;
+  const WireFormatPlan* GetWireFormatPlan() const;
+
   const Descriptor* descriptor_;
   const Message* default_instance_;
   const int* offsets_;
@@ -285,6 +291,9 @@ class LIBPROTOBUF_EXPORT GeneratedMessageReflection : public Reflection {
   const DescriptorPool* descriptor_pool_;
   MessageFactory* message_factory_;
 
+  // Built by WireFormat::GetPlan() on first use.
+  mutable const WireFormatPlan* volatile wire_format_plan_;
+
   template <typename Type>
   inline const Type& GetRaw(const Message& message,
                             const FieldDescriptor* field) const;
@@ -344,25 +353,6 @@ class LIBPROTOBUF_EXPORT GeneratedMessageReflection : public Reflection {
   GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(GeneratedMessageReflection);
 };
 
-// Returns the offset of the given field within the given aggregate type.
-// This is equivalent to the ANSI C offsetof() macro.  However, according
-// to the C++ standard, offsetof() only works on POD types, and GCC
-// enforces this requirement with a warning.  In practice, this rule is
-// unnecessarily strict; there is probably no compiler or platform on
-// which the offsets of the direct fields of a class are non-constant.
-// Fields inherited from superclasses *can* have non-constant offsets,
-// but that's not what this macro will be used for.
-//
-// Note that we calculate relative to the pointer value 16 here since if we
-// just use zero, GCC complains about dereferencing a NULL pointer.  We
-// choose 16 rather than some other number just in case the compiler would
-// be confused by an unaligned pointer.
-#define GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TYPE, FIELD)    \
-  static_cast<int>(                                           \
-    reinterpret_cast<const char*>(                            \
-      &reinterpret_cast<const TYPE*>(16)->FIELD) -            \
-    reinterpret_cast<const char*>(16))
-
 // There are some places in proto2 where dynamic_cast would be useful as an
 // optimization.  For example, take Message::MergeFrom(const Message& other).
 // For a given generated message FooMessage, we generate these two methods:
@@ -417,6 +407,11 @@ bool ParseNamedEnum(const EnumDescriptor* descriptor,
 // descriptor.h.
 LIBPROTOBUF_EXPORT const string& NameOfEnum(const EnumDescriptor* descriptor, int value);
 
+// Returns true if the field is stored as a LazyField rather than a Message*
+// (see lazy_field.h).  This is the case for singular, non-extension fields
+// of message type which have the lazy option set.
+LIBPROTOBUF_EXPORT bool IsLazyField(const FieldDescriptor* field);
+
 }  // namespace internal
 }  // namespace protobuf
 
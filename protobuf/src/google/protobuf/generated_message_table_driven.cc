@@ -0,0 +1,89 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// http://code.google.com/p/protobuf/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <google/protobuf/generated_message_table_driven.h>
+#include <google/protobuf/generated_message_table_driven_inl.h>
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/unknown_field_set.h>
+#include <google/protobuf/wire_format.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/io/coded_stream.h>
+
+namespace google {
+namespace protobuf {
+namespace internal {
+
+namespace {
+
+// Full messages keep unknown fields and invalid enum values in their
+// UnknownFieldSet.
+struct UnknownFieldHandler {
+  static bool ParseUnknownField(MessageLite* message, const ParseTable& table,
+                                uint32 tag, io::CodedInputStream* input) {
+    UnknownFieldSet* unknown_fields =
+        ParseTableRaw<UnknownFieldSet>(message, table.unknown_fields_offset);
+    if (table.extensions_offset >= 0 &&
+        InParseTableExtensionRange(
+            table, WireFormatLite::GetTagFieldNumber(tag))) {
+      return ParseTableRaw<ExtensionSet>(message, table.extensions_offset)
+          ->ParseField(tag, input,
+                       down_cast<const Message*>(table.default_instance),
+                       unknown_fields);
+    }
+    return WireFormat::SkipField(input, tag, unknown_fields);
+  }
+
+  static void AddUnknownEnum(MessageLite* message, const ParseTable& table,
+                             int field_number, int value) {
+    ParseTableRaw<UnknownFieldSet>(message, table.unknown_fields_offset)
+        ->AddVarint(field_number, value);
+  }
+
+  static void VerifyUTF8(const char* data, int size) {
+    WireFormat::VerifyUTF8String(data, size, WireFormat::PARSE);
+  }
+};
+
+}  // namespace
+
+bool MergePartialFromCodedStream(MessageLite* message,
+                                 const ParseTable& table,
+                                 io::CodedInputStream* input) {
+  GOOGLE_DCHECK_GE(table.unknown_fields_offset, 0);
+  return MergePartialFromCodedStreamImpl<UnknownFieldHandler>(
+      message, table, input);
+}
+
+}  // namespace internal
+}  // namespace protobuf
+}  // namespace google
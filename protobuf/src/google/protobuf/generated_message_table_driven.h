@@ -0,0 +1,164 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// http://code.google.com/p/protobuf/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// This header is logically internal, but is made public because it is used
+// from protocol-compiler-generated code, which may reside in other components.
+//
+// Table-driven parsing.  By default, protoc generates a dedicated
+// MergePartialFromCodedStream() for every message: a switch() over the field
+// numbers with a hand-unrolled case for every field.  That code is fast, but
+// for a program that links hundreds of message types it adds up to a lot of
+// machine code, most of which is cold at any given time.
+//
+// Files declaring:
+//
+//   option cc_table_driven_parsing = true;
+//
+// instead describe each message with a small ParseTable and forward
+// MergePartialFromCodedStream() to a single shared interpreter defined
+// here.  Everything else about the generated classes stays the same.
+
+#ifndef GOOGLE_PROTOBUF_GENERATED_MESSAGE_TABLE_DRIVEN_H__
+#define GOOGLE_PROTOBUF_GENERATED_MESSAGE_TABLE_DRIVEN_H__
+
+#include <string>
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/generated_message_util.h>
+
+namespace google {
+namespace protobuf {
+  class MessageLite;                    // message_lite.h
+  namespace io {
+    class CodedInputStream;             // coded_stream.h
+  }
+}
+
+namespace protobuf {
+namespace internal {
+
+class RepeatedPtrFieldBase;             // repeated_field.h
+
+// Describes how to parse one field of a generated message.  Entries of a
+// ParseTable are sorted by field number.
+struct ParseTableField {
+  // The tag this field is normally encoded with:  its number plus the
+  // wire type of its declared type, or WIRETYPE_LENGTH_DELIMITED if packed.
+  uint32 tag;
+
+  // Byte offset of the field's member within the message object, as
+  // computed by GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET().
+  int offset;
+
+  // Index of the field's bit in _has_bits_, or -1 for repeated fields.
+  int has_bit_index;
+
+  // The field's WireFormatLite::FieldType.
+  uint8 type;
+
+  bool repeated;
+  bool packed;
+
+  // For string fields in files that check UTF-8 when parsing.
+  bool verify_utf8;
+
+  // For string and bytes fields declared with [ctype=STRING_PIECE]:  the
+  // member is an internal::StringPieceField (or a RepeatedPtrField of them)
+  // rather than a string*.
+  bool string_piece;
+
+  // For message fields declared with [lazy=true]:  the member is an
+  // internal::LazyField, which keeps the encoded bytes without parsing them.
+  bool lazy;
+
+  // For singular string and bytes fields:  the default value which the member
+  // points at until the field is first set.  NULL for STRING_PIECE fields.
+  const string* default_string;
+
+  // For message and group fields:  the default instance of the field's type.
+  // New sub-messages are created with prototype->New().
+  const MessageLite* prototype;
+
+  // For enum fields:  the generated $Enum$_IsValid() function.
+  bool (*enum_is_valid)(int);
+
+  // For enum fields of types which have no generated code, i.e.
+  // DynamicMessages:  a check which takes an argument, like
+  // ExtensionInfo::enum_validity_check.  Used when enum_is_valid is NULL.
+  bool (*enum_is_valid_with_arg)(const void* arg, int number);
+  const void* enum_is_valid_arg;
+};
+
+// Describes how to parse a whole generated message.
+struct ParseTable {
+  const ParseTableField* fields;
+  int num_fields;
+
+  // Byte offsets of _has_bits_[0], of _unknown_fields_ (or -1 if the
+  // message does not keep unknown fields) and of _extensions_ (or -1 if the
+  // message has no extension ranges).
+  int has_bits_offset;
+  int unknown_fields_offset;
+  int extensions_offset;
+
+  // The message's extension ranges, as consecutive [start, end) pairs of
+  // field numbers.
+  const int* extension_ranges;
+  int num_extension_ranges;
+
+  const MessageLite* default_instance;
+};
+
+// Parses fields from |input| into |message| as described by |table|.
+// Same semantics as MessageLite::MergePartialFromCodedStream().  The Lite
+// version is used by optimize_for = LITE_RUNTIME files, which discard
+// unknown fields; the other one keeps unknown fields in an UnknownFieldSet
+// and is only available in the full library.
+LIBPROTOBUF_EXPORT bool MergePartialFromCodedStreamLite(
+    MessageLite* message, const ParseTable& table,
+    io::CodedInputStream* input);
+LIBPROTOBUF_EXPORT bool MergePartialFromCodedStream(
+    MessageLite* message, const ParseTable& table,
+    io::CodedInputStream* input);
+
+// Helpers for the interpreter which need access to protected parts of
+// RepeatedPtrFieldBase.
+class LIBPROTOBUF_EXPORT ParseTableHelper {
+ public:
+  // Appends a new element to |field|, a RepeatedPtrField of messages of
+  // the same type as |prototype|, reusing a cleared element if possible.
+  static MessageLite* AddMessage(RepeatedPtrFieldBase* field,
+                                 const MessageLite& prototype);
+};
+
+}  // namespace internal
+}  // namespace protobuf
+
+}  // namespace google
+#endif  // GOOGLE_PROTOBUF_GENERATED_MESSAGE_TABLE_DRIVEN_H__
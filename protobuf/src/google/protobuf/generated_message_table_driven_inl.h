@@ -0,0 +1,343 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// http://code.google.com/p/protobuf/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// The table-driven parsing loop, shared by the lite and the full library.
+// It is a template over a policy class which decides what happens to
+// unknown fields, extensions and UTF-8 checks; see
+// generated_message_table_driven_lite.cc and generated_message_table_driven.cc.
+// Besides those, only dynamic_message.cc, which parses DynamicMessages with
+// a ParseTable of its own, should include this file.
+
+#ifndef GOOGLE_PROTOBUF_GENERATED_MESSAGE_TABLE_DRIVEN_INL_H__
+#define GOOGLE_PROTOBUF_GENERATED_MESSAGE_TABLE_DRIVEN_INL_H__
+
+#include <google/protobuf/generated_message_table_driven.h>
+
+#include <google/protobuf/arena.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/lazy_field.h>
+#include <google/protobuf/message_lite.h>
+#include <google/protobuf/repeated_field.h>
+#include <google/protobuf/string_piece_field.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/io/coded_stream.h>
+
+namespace google {
+namespace protobuf {
+namespace internal {
+
+template <typename Type>
+inline Type* ParseTableRaw(MessageLite* message, int offset) {
+  return reinterpret_cast<Type*>(reinterpret_cast<uint8*>(message) + offset);
+}
+
+inline void ParseTableSetBit(uint32* has_bits, int index) {
+  has_bits[index / 32] |= (1u << (index % 32));
+}
+
+// Binary search for the field with the given number.
+inline const ParseTableField* FindParseTableField(
+    const ParseTableField* begin, const ParseTableField* end,
+    int field_number) {
+  while (begin < end) {
+    const ParseTableField* middle = begin + (end - begin) / 2;
+    int middle_number = WireFormatLite::GetTagFieldNumber(middle->tag);
+    if (middle_number == field_number) {
+      return middle;
+    } else if (middle_number < field_number) {
+      begin = middle + 1;
+    } else {
+      end = middle;
+    }
+  }
+  return NULL;
+}
+
+inline bool InParseTableExtensionRange(const ParseTable& table,
+                                       int field_number) {
+  for (int i = 0; i < table.num_extension_ranges; i++) {
+    if (table.extension_ranges[2 * i] <= field_number &&
+        field_number < table.extension_ranges[2 * i + 1]) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Can |tag| be parsed into |field|?  Besides the expected tag, repeated
+// fields of primitive type accept both the packed and the unpacked encoding.
+inline bool ParseTableTagMatches(const ParseTableField& field, uint32 tag) {
+  if (tag == field.tag) return true;
+  if (!field.repeated) return false;
+
+  WireFormatLite::FieldType type =
+      static_cast<WireFormatLite::FieldType>(field.type);
+  if (type == WireFormatLite::TYPE_STRING ||
+      type == WireFormatLite::TYPE_BYTES ||
+      type == WireFormatLite::TYPE_MESSAGE ||
+      type == WireFormatLite::TYPE_GROUP) {
+    return false;
+  }
+  WireFormatLite::WireType wire_type = WireFormatLite::GetTagWireType(tag);
+  return wire_type == WireFormatLite::WIRETYPE_LENGTH_DELIMITED ||
+         wire_type == WireFormatLite::WireTypeForFieldType(type);
+}
+
+inline bool ParseTableEnumIsValid(const ParseTableField& field, int value) {
+  if (field.enum_is_valid != NULL) return field.enum_is_valid(value);
+  return field.enum_is_valid_with_arg(field.enum_is_valid_arg, value);
+}
+
+// UnknownFieldHandler must provide:
+//
+//   // Parses a field which is not in the table:  an extension, or an
+//   // unknown field to be skipped or saved.
+//   static bool ParseUnknownField(MessageLite* message,
+//                                 const ParseTable& table, uint32 tag,
+//                                 io::CodedInputStream* input);
+//
+//   // Records an enum value which is not valid for its field.
+//   static void AddUnknownEnum(MessageLite* message, const ParseTable& table,
+//                              int field_number, int value);
+//
+//   // Checks a freshly parsed string field for valid UTF-8.
+//   static void VerifyUTF8(const char* data, int size);
+template <typename UnknownFieldHandler>
+bool MergePartialFromCodedStreamImpl(MessageLite* message,
+                                     const ParseTable& table,
+                                     io::CodedInputStream* input) {
+  uint32* has_bits = ParseTableRaw<uint32>(message, table.has_bits_offset);
+  const ParseTableField* const begin = table.fields;
+  const ParseTableField* const end = begin + table.num_fields;
+
+  // Fields usually arrive in field number order, and repeated fields in
+  // runs, so each tag is first compared against the field parsed last and
+  // the one following it before falling back to a binary search.
+  const ParseTableField* last = begin;
+
+  while (true) {
+    uint32 tag = input->ReadTag();
+    if (tag == 0) return true;
+
+    const ParseTableField* field;
+    if (last < end && last->tag == tag) {
+      field = last;
+    } else if (last + 1 < end && last[1].tag == tag) {
+      field = last + 1;
+    } else {
+      field = FindParseTableField(
+          begin, end, WireFormatLite::GetTagFieldNumber(tag));
+      if (field == NULL || !ParseTableTagMatches(*field, tag)) {
+        // Is this an end-group tag?  If so, this must be the end of the
+        // message.
+        if (WireFormatLite::GetTagWireType(tag) ==
+            WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        if (!UnknownFieldHandler::ParseUnknownField(
+                message, table, tag, input)) {
+          return false;
+        }
+        continue;
+      }
+    }
+    last = field;
+
+    bool packed_on_wire = field->repeated &&
+        WireFormatLite::GetTagWireType(tag) ==
+            WireFormatLite::WIRETYPE_LENGTH_DELIMITED;
+
+    switch (field->type) {
+#define HANDLE_PRIMITIVE_TYPE(TYPE, CPPTYPE)                                  \
+      case WireFormatLite::TYPE_##TYPE:                                       \
+        if (!field->repeated) {                                               \
+          if (!WireFormatLite::ReadPrimitive<                                 \
+                  CPPTYPE, WireFormatLite::TYPE_##TYPE>(                      \
+                  input, ParseTableRaw<CPPTYPE>(message, field->offset))) {   \
+            return false;                                                     \
+          }                                                                   \
+          ParseTableSetBit(has_bits, field->has_bit_index);                   \
+        } else if (packed_on_wire) {                                          \
+          if (!WireFormatLite::ReadPackedPrimitive<                           \
+                  CPPTYPE, WireFormatLite::TYPE_##TYPE>(                      \
+                  input, ParseTableRaw<RepeatedField<CPPTYPE> >(              \
+                      message, field->offset))) {                             \
+            return false;                                                     \
+          }                                                                   \
+        } else {                                                              \
+          if (!WireFormatLite::ReadRepeatedPrimitive<                         \
+                  CPPTYPE, WireFormatLite::TYPE_##TYPE>(                      \
+                  io::CodedOutputStream::VarintSize32(tag), tag, input,       \
+                  ParseTableRaw<RepeatedField<CPPTYPE> >(                     \
+                      message, field->offset))) {                             \
+            return false;                                                     \
+          }                                                                   \
+        }                                                                     \
+        break;
+
+      HANDLE_PRIMITIVE_TYPE(INT32   , int32 )
+      HANDLE_PRIMITIVE_TYPE(INT64   , int64 )
+      HANDLE_PRIMITIVE_TYPE(UINT32  , uint32)
+      HANDLE_PRIMITIVE_TYPE(UINT64  , uint64)
+      HANDLE_PRIMITIVE_TYPE(SINT32  , int32 )
+      HANDLE_PRIMITIVE_TYPE(SINT64  , int64 )
+      HANDLE_PRIMITIVE_TYPE(FIXED32 , uint32)
+      HANDLE_PRIMITIVE_TYPE(FIXED64 , uint64)
+      HANDLE_PRIMITIVE_TYPE(SFIXED32, int32 )
+      HANDLE_PRIMITIVE_TYPE(SFIXED64, int64 )
+      HANDLE_PRIMITIVE_TYPE(FLOAT   , float )
+      HANDLE_PRIMITIVE_TYPE(DOUBLE  , double)
+      HANDLE_PRIMITIVE_TYPE(BOOL    , bool  )
+#undef HANDLE_PRIMITIVE_TYPE
+
+      case WireFormatLite::TYPE_ENUM: {
+        if (packed_on_wire) {
+          // Like the generated code, drop invalid values of packed enums.
+          uint32 length;
+          if (!input->ReadVarint32(&length)) return false;
+          io::CodedInputStream::Limit limit = input->PushLimit(length);
+          RepeatedField<int>* values =
+              ParseTableRaw<RepeatedField<int> >(message, field->offset);
+          while (input->BytesUntilLimit() > 0) {
+            int value;
+            if (!WireFormatLite::ReadPrimitive<
+                    int, WireFormatLite::TYPE_ENUM>(input, &value)) {
+              return false;
+            }
+            if (ParseTableEnumIsValid(*field, value)) values->Add(value);
+          }
+          input->PopLimit(limit);
+          break;
+        }
+        int value;
+        if (!WireFormatLite::ReadPrimitive<int, WireFormatLite::TYPE_ENUM>(
+                input, &value)) {
+          return false;
+        }
+        if (!ParseTableEnumIsValid(*field, value)) {
+          UnknownFieldHandler::AddUnknownEnum(
+              message, table, WireFormatLite::GetTagFieldNumber(tag), value);
+        } else if (!field->repeated) {
+          *ParseTableRaw<int>(message, field->offset) = value;
+          ParseTableSetBit(has_bits, field->has_bit_index);
+        } else {
+          ParseTableRaw<RepeatedField<int> >(message, field->offset)
+              ->Add(value);
+        }
+        break;
+      }
+
+      case WireFormatLite::TYPE_STRING:
+      case WireFormatLite::TYPE_BYTES: {
+        if (field->string_piece) {
+          StringPieceField* value;
+          if (!field->repeated) {
+            value = ParseTableRaw<StringPieceField>(message, field->offset);
+            ParseTableSetBit(has_bits, field->has_bit_index);
+          } else {
+            value = ParseTableRaw<RepeatedPtrField<StringPieceField> >(
+                message, field->offset)->Add();
+          }
+          if (!WireFormatLite::ReadStringPiece(input, value)) return false;
+          if (field->verify_utf8) {
+            UnknownFieldHandler::VerifyUTF8(value->data(), value->size());
+          }
+          break;
+        }
+
+        string* value;
+        if (!field->repeated) {
+          string** member = ParseTableRaw<string*>(message, field->offset);
+          if (*member == field->default_string) {
+            *member = Arena::Create<string>(message->GetArena());
+          }
+          value = *member;
+          ParseTableSetBit(has_bits, field->has_bit_index);
+        } else {
+          value = ParseTableRaw<RepeatedPtrField<string> >(
+              message, field->offset)->Add();
+        }
+        if (!WireFormatLite::ReadString(input, value)) return false;
+        if (field->verify_utf8) {
+          UnknownFieldHandler::VerifyUTF8(value->data(), value->size());
+        }
+        break;
+      }
+
+      case WireFormatLite::TYPE_MESSAGE:
+      case WireFormatLite::TYPE_GROUP: {
+        if (field->lazy) {
+          ParseTableSetBit(has_bits, field->has_bit_index);
+          if (!ParseTableRaw<LazyField>(message, field->offset)
+                  ->MergeFromCodedStream(input)) {
+            return false;
+          }
+          break;
+        }
+
+        MessageLite* value;
+        if (!field->repeated) {
+          MessageLite** member =
+              ParseTableRaw<MessageLite*>(message, field->offset);
+          if (*member == NULL) {
+            *member = field->prototype->NewOnArena(message->GetArena());
+          }
+          value = *member;
+          ParseTableSetBit(has_bits, field->has_bit_index);
+        } else {
+          value = ParseTableHelper::AddMessage(
+              ParseTableRaw<RepeatedPtrFieldBase>(message, field->offset),
+              *field->prototype);
+        }
+        if (field->type == WireFormatLite::TYPE_MESSAGE) {
+          if (!WireFormatLite::ReadMessage(input, value)) return false;
+        } else {
+          if (!WireFormatLite::ReadGroup(
+                  WireFormatLite::GetTagFieldNumber(tag), input, value)) {
+            return false;
+          }
+        }
+        break;
+      }
+
+      default:
+        GOOGLE_LOG(DFATAL) << "Bad field type in ParseTable: "
+                           << static_cast<int>(field->type);
+        return false;
+    }
+  }
+}
+
+}  // namespace internal
+}  // namespace protobuf
+
+}  // namespace google
+#endif  // GOOGLE_PROTOBUF_GENERATED_MESSAGE_TABLE_DRIVEN_INL_H__
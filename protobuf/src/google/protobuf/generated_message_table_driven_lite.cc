@@ -0,0 +1,93 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// http://code.google.com/p/protobuf/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <google/protobuf/generated_message_table_driven.h>
+#include <google/protobuf/generated_message_table_driven_inl.h>
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/repeated_field.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/io/coded_stream.h>
+
+namespace google {
+namespace protobuf {
+namespace internal {
+
+namespace {
+
+// Lite messages have no UnknownFieldSet:  unknown fields and invalid enum
+// values are dropped, and strings are never checked for UTF-8.
+struct UnknownFieldHandlerLite {
+  static bool ParseUnknownField(MessageLite* message, const ParseTable& table,
+                                uint32 tag, io::CodedInputStream* input) {
+    if (table.extensions_offset >= 0 &&
+        InParseTableExtensionRange(
+            table, WireFormatLite::GetTagFieldNumber(tag))) {
+      return ParseTableRaw<ExtensionSet>(message, table.extensions_offset)
+          ->ParseField(tag, input, table.default_instance);
+    }
+    return WireFormatLite::SkipField(input, tag);
+  }
+
+  static void AddUnknownEnum(MessageLite* message, const ParseTable& table,
+                             int field_number, int value) {
+  }
+
+  static void VerifyUTF8(const char* data, int size) {
+  }
+};
+
+}  // namespace
+
+bool MergePartialFromCodedStreamLite(MessageLite* message,
+                                     const ParseTable& table,
+                                     io::CodedInputStream* input) {
+  return MergePartialFromCodedStreamImpl<UnknownFieldHandlerLite>(
+      message, table, input);
+}
+
+MessageLite* ParseTableHelper::AddMessage(RepeatedPtrFieldBase* field,
+                                          const MessageLite& prototype) {
+  // RepeatedPtrFieldBase cannot Add() an abstract MessageLite, so reuse a
+  // cleared element or allocate one from the prototype, as ExtensionSet
+  // does.  The element goes on the field's arena, which then owns it.
+  MessageLite* result =
+      field->AddFromCleared<GenericTypeHandler<MessageLite> >();
+  if (result == NULL) {
+    result = prototype.NewOnArena(field->GetArena());
+    field->UnsafeArenaAddAllocated<GenericTypeHandler<MessageLite> >(result);
+  }
+  return result;
+}
+
+}  // namespace internal
+}  // namespace protobuf
+}  // namespace google
@@ -0,0 +1,290 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// http://code.google.com/p/protobuf/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Tests for table-driven parsing.  Each test parses the same bytes with the
+// switch-based generated parser (the messages in unittest.proto) and the
+// table-driven one (their mirrors in unittest_table_driven.proto).
+
+#include <string>
+
+#include <google/protobuf/generated_message_table_driven.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/test_util.h>
+#include <google/protobuf/unittest.pb.h>
+#include <google/protobuf/unittest_table_driven.pb.h>
+#include <google/protobuf/unknown_field_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl.h>
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/testing/googletest.h>
+#include <gtest/gtest.h>
+
+namespace google {
+namespace protobuf {
+namespace internal {
+namespace {
+
+TEST(TableDrivenParsingTest, AllTypes) {
+  unittest::TestAllTypes message;
+  TestUtil::SetAllFields(&message);
+  string data = message.SerializeAsString();
+
+  unittest::TestTableDrivenAllTypes table_driven;
+  ASSERT_TRUE(table_driven.ParseFromString(data));
+  EXPECT_EQ(data, table_driven.SerializeAsString());
+  EXPECT_EQ(0, table_driven.unknown_fields().field_count());
+
+  // Check the values through the other parser as well.
+  unittest::TestAllTypes reparsed;
+  ASSERT_TRUE(reparsed.ParseFromString(table_driven.SerializeAsString()));
+  TestUtil::ExpectAllFieldsSet(reparsed);
+
+  // Merging appends to repeated fields and overwrites the rest, reusing the
+  // strings and sub-messages already allocated.
+  {
+    io::ArrayInputStream raw_input(data.data(), data.size());
+    io::CodedInputStream input(&raw_input);
+    ASSERT_TRUE(table_driven.MergeFromCodedStream(&input));
+  }
+  unittest::TestAllTypes merged(message);
+  merged.MergeFrom(message);
+  EXPECT_EQ(merged.SerializeAsString(), table_driven.SerializeAsString());
+}
+
+TEST(TableDrivenParsingTest, ParseOnArena) {
+  unittest::TestAllTypes message;
+  TestUtil::SetAllFields(&message);
+  string data = message.SerializeAsString();
+
+  Arena arena;
+  unittest::TestTableDrivenAllTypes* table_driven =
+      Arena::CreateMessage<unittest::TestTableDrivenAllTypes>(&arena);
+  ASSERT_TRUE(table_driven->ParseFromString(data));
+  EXPECT_EQ(data, table_driven->SerializeAsString());
+
+  // Sub-messages of arena-enabled types are constructed on the arena
+  // itself, not allocated on the heap and handed to it.
+  EXPECT_EQ(&arena, table_driven->optional_nested_message().GetArena());
+  EXPECT_EQ(&arena, table_driven->optionalgroup().GetArena());
+  ASSERT_EQ(2, table_driven->repeated_nested_message_size());
+  EXPECT_EQ(&arena, table_driven->repeated_nested_message(1).GetArena());
+  EXPECT_EQ(&arena, table_driven->repeatedgroup(1).GetArena());
+}
+
+TEST(TableDrivenParsingTest, ParseAfterClear) {
+  unittest::TestAllTypes message;
+  TestUtil::SetAllFields(&message);
+  string data = message.SerializeAsString();
+
+  unittest::TestTableDrivenAllTypes table_driven;
+  ASSERT_TRUE(table_driven.ParseFromString(data));
+  table_driven.Clear();
+  EXPECT_EQ(0, table_driven.ByteSize());
+  EXPECT_EQ("hello", table_driven.default_string());
+  ASSERT_TRUE(table_driven.ParseFromString(data));
+  EXPECT_EQ(data, table_driven.SerializeAsString());
+}
+
+TEST(TableDrivenParsingTest, PackedAndUnpacked) {
+  unittest::TestPackedTypes packed;
+  TestUtil::SetPackedFields(&packed);
+  string packed_data = packed.SerializeAsString();
+  unittest::TestUnpackedTypes unpacked;
+  TestUtil::SetUnpackedFields(&unpacked);
+  string unpacked_data = unpacked.SerializeAsString();
+
+  unittest::TestTableDrivenPackedTypes table_driven_packed;
+  ASSERT_TRUE(table_driven_packed.ParseFromString(packed_data));
+  EXPECT_EQ(packed_data, table_driven_packed.SerializeAsString());
+
+  unittest::TestTableDrivenUnpackedTypes table_driven_unpacked;
+  ASSERT_TRUE(table_driven_unpacked.ParseFromString(unpacked_data));
+  EXPECT_EQ(unpacked_data, table_driven_unpacked.SerializeAsString());
+
+  // Packed fields accept the unpacked encoding and vice versa.
+  ASSERT_TRUE(table_driven_packed.ParseFromString(unpacked_data));
+  EXPECT_EQ(packed_data, table_driven_packed.SerializeAsString());
+  ASSERT_TRUE(table_driven_unpacked.ParseFromString(packed_data));
+  EXPECT_EQ(unpacked_data, table_driven_unpacked.SerializeAsString());
+}
+
+TEST(TableDrivenParsingTest, UnknownFields) {
+  unittest::TestAllTypes message;
+  TestUtil::SetAllFields(&message);
+  string data = message.SerializeAsString();
+
+  unittest::TestTableDrivenSparse sparse;
+  ASSERT_TRUE(sparse.ParseFromString(data));
+  EXPECT_EQ(101, sparse.optional_int32());
+  EXPECT_EQ("115", sparse.optional_string());
+  ASSERT_EQ(2, sparse.repeated_int32_size());
+  EXPECT_EQ(201, sparse.repeated_int32(0));
+  EXPECT_EQ(301, sparse.repeated_int32(1));
+  EXPECT_GT(sparse.unknown_fields().field_count(), 0);
+
+  // Everything else survives as unknown fields.
+  unittest::TestAllTypes reparsed;
+  ASSERT_TRUE(reparsed.ParseFromString(sparse.SerializeAsString()));
+  TestUtil::ExpectAllFieldsSet(reparsed);
+}
+
+TEST(TableDrivenParsingTest, WrongWireType) {
+  // A varint where a string is expected is kept as an unknown field, like
+  // the generated parser does.
+  string data;
+  {
+    io::StringOutputStream raw_output(&data);
+    io::CodedOutputStream output(&raw_output);
+    WireFormatLite::WriteInt32(14, 5, &output);
+  }
+  unittest::TestTableDrivenSparse sparse;
+  ASSERT_TRUE(sparse.ParseFromString(data));
+  EXPECT_FALSE(sparse.has_optional_string());
+  ASSERT_EQ(1, sparse.unknown_fields().field_count());
+  EXPECT_EQ(14, sparse.unknown_fields().field(0).number());
+  EXPECT_EQ(5, sparse.unknown_fields().field(0).varint());
+}
+
+TEST(TableDrivenParsingTest, InvalidEnumValue) {
+  string data;
+  {
+    io::StringOutputStream raw_output(&data);
+    io::CodedOutputStream output(&raw_output);
+    WireFormatLite::WriteEnum(21, unittest::TestAllTypes::BAZ, &output);
+    WireFormatLite::WriteEnum(21, 12345, &output);
+    WireFormatLite::WriteEnum(51, unittest::TestAllTypes::FOO, &output);
+    WireFormatLite::WriteEnum(51, 12345, &output);
+  }
+
+  unittest::TestTableDrivenAllTypes table_driven;
+  ASSERT_TRUE(table_driven.ParseFromString(data));
+  EXPECT_EQ(unittest::TestTableDrivenAllTypes::BAZ,
+            table_driven.optional_nested_enum());
+  ASSERT_EQ(1, table_driven.repeated_nested_enum_size());
+  EXPECT_EQ(unittest::TestTableDrivenAllTypes::FOO,
+            table_driven.repeated_nested_enum(0));
+
+  const UnknownFieldSet& unknown_fields = table_driven.unknown_fields();
+  ASSERT_EQ(2, unknown_fields.field_count());
+  EXPECT_EQ(21, unknown_fields.field(0).number());
+  EXPECT_EQ(12345, unknown_fields.field(0).varint());
+  EXPECT_EQ(51, unknown_fields.field(1).number());
+  EXPECT_EQ(12345, unknown_fields.field(1).varint());
+}
+
+TEST(TableDrivenParsingTest, Extensions) {
+  unittest::TestTableDrivenSparse message;
+  message.set_optional_int32(1);
+  message.SetExtension(unittest::sparse_int32_extension, 2);
+  message.AddExtension(unittest::sparse_string_extension, "foo");
+  message.AddExtension(unittest::sparse_string_extension, "bar");
+  message.MutableExtension(unittest::sparse_message_extension)
+      ->set_optional_string("baz");
+  string data = message.SerializeAsString();
+
+  unittest::TestTableDrivenSparse parsed;
+  ASSERT_TRUE(parsed.ParseFromString(data));
+  EXPECT_EQ(1, parsed.optional_int32());
+  EXPECT_EQ(2, parsed.GetExtension(unittest::sparse_int32_extension));
+  ASSERT_EQ(2, parsed.ExtensionSize(unittest::sparse_string_extension));
+  EXPECT_EQ("bar", parsed.GetExtension(unittest::sparse_string_extension, 1));
+  EXPECT_EQ("baz",
+            parsed.GetExtension(unittest::sparse_message_extension)
+                .optional_string());
+  EXPECT_EQ(0, parsed.unknown_fields().field_count());
+  EXPECT_EQ(data, parsed.SerializeAsString());
+}
+
+TEST(TableDrivenParsingTest, Truncated) {
+  unittest::TestAllTypes message;
+  TestUtil::SetAllFields(&message);
+  string data = message.SerializeAsString();
+
+  // Every strict prefix either fails to parse or parses into a message that
+  // the generated parser agrees with.
+  for (int i = 0; i < data.size(); i++) {
+    string prefix = data.substr(0, i);
+    unittest::TestAllTypes generated;
+    unittest::TestTableDrivenAllTypes table_driven;
+    bool generated_ok = generated.ParsePartialFromString(prefix);
+    bool table_driven_ok = table_driven.ParsePartialFromString(prefix);
+    ASSERT_EQ(generated_ok, table_driven_ok) << "prefix length " << i;
+    if (generated_ok) {
+      EXPECT_EQ(generated.SerializePartialAsString(),
+                table_driven.SerializePartialAsString());
+    }
+  }
+}
+
+TEST(TableDrivenParsingTest, StringPieceAliasing) {
+  unittest::TestAllTypes message;
+  TestUtil::SetAllFields(&message);
+  string data = message.SerializeAsString();
+
+  io::CodedInputStream input(reinterpret_cast<const uint8*>(data.data()),
+                             data.size());
+  input.EnableAliasing(true);
+  unittest::TestTableDrivenAllTypes table_driven;
+  ASSERT_TRUE(table_driven.MergeFromCodedStream(&input));
+  EXPECT_EQ(data, table_driven.SerializeAsString());
+
+  const char* begin = data.data();
+  const char* end = data.data() + data.size();
+  EXPECT_EQ("124", table_driven.optional_string_piece().ToString());
+  EXPECT_TRUE(table_driven.optional_string_piece().data() >= begin &&
+              table_driven.optional_string_piece().data() < end);
+  ASSERT_EQ(2, table_driven.repeated_string_piece_size());
+  EXPECT_EQ("324", table_driven.repeated_string_piece(1).ToString());
+  EXPECT_TRUE(table_driven.repeated_string_piece(1).data() >= begin &&
+              table_driven.repeated_string_piece(1).data() < end);
+}
+
+TEST(TableDrivenParsingTest, Group) {
+  // A mismatched end-group tag must be rejected.
+  string data;
+  {
+    io::StringOutputStream raw_output(&data);
+    io::CodedOutputStream output(&raw_output);
+    WireFormatLite::WriteTag(16, WireFormatLite::WIRETYPE_START_GROUP,
+                             &output);
+    WireFormatLite::WriteInt32(17, 1, &output);
+    WireFormatLite::WriteTag(46, WireFormatLite::WIRETYPE_END_GROUP, &output);
+  }
+  unittest::TestTableDrivenAllTypes table_driven;
+  EXPECT_FALSE(table_driven.ParseFromString(data));
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace protobuf
+}  // namespace google
@@ -132,6 +132,30 @@ int CodedInputStream::BytesUntilLimit() {
   return current_limit_ - current_position;
 }
 
+int CodedInputStream::BytesUntilTotalBytesLimit() const {
+  int current_position = total_bytes_read_ -
+      (BufferSize() + buffer_size_after_limit_);
+
+  return total_bytes_limit_ - current_position;
+}
+
+int CodedInputStream::CurrentPosition() const {
+  return total_bytes_read_ - (BufferSize() + buffer_size_after_limit_);
+}
+
+void CodedInputStream::ResetSizeCounter() {
+  GOOGLE_DCHECK_EQ(current_limit_, INT_MAX)
+      << "ResetSizeCounter() called while a limit was pushed.";
+
+  if (overflow_bytes_ > 0) {
+    // Some of the buffer lies beyond INT_MAX and so was never counted.
+    // Give it back to input_; the next Refresh() will count it.
+    BackUpInputToCurrentPosition();
+  }
+  total_bytes_read_ -= CurrentPosition();
+  RecomputeBufferLimits();
+}
+
 void CodedInputStream::SetTotalBytesLimit(
     int total_bytes_limit, int warning_threshold) {
   // Make sure the limit isn't already past, since this could confuse other
@@ -456,6 +480,104 @@ bool CodedInputStream::ReadVarint64Fallback(uint64* value) {
   }
 }
 
+namespace {
+
+// Selects the continuation bit of each byte of a 64-bit word.
+static const uint64 kVarintContinuationBits =
+    GOOGLE_ULONGLONG(0x8080808080808080);
+
+// Packs the low seven bits of each byte of a little-endian word into a
+// 56-bit value, pairing up adjacent groups with shifts and masks rather than
+// handling each byte separately.
+inline uint64 GatherVarintGroups(uint64 word) {
+  word &= GOOGLE_ULONGLONG(0x7F7F7F7F7F7F7F7F);
+  word = ((word & GOOGLE_ULONGLONG(0x7F007F007F007F00)) >> 1) |
+         ( word & GOOGLE_ULONGLONG(0x007F007F007F007F));
+  word = ((word & GOOGLE_ULONGLONG(0x3FFF00003FFF0000)) >> 2) |
+         ( word & GOOGLE_ULONGLONG(0x00003FFF00003FFF));
+  word = ((word & GOOGLE_ULONGLONG(0x0FFFFFFF00000000)) >> 4) |
+         ( word & GOOGLE_ULONGLONG(0x000000000FFFFFFF));
+  return word;
+}
+
+// Decodes one varint from a buffer which has at least kMaxVarintBytes bytes
+// available.  Eight bytes are loaded at once and the terminating byte is
+// located from the continuation bits, so varints of up to eight bytes are
+// decoded without any data-dependent branches.  Returns NULL if the varint
+// is longer than kMaxVarintBytes.
+inline const uint8* ReadVarint64FromArrayBranchless(
+    const uint8* buffer, uint64* value) GOOGLE_ATTRIBUTE_ALWAYS_INLINE;
+inline const uint8* ReadVarint64FromArrayBranchless(
+    const uint8* buffer, uint64* value) {
+  uint64 word;
+  CodedInputStream::ReadLittleEndian64FromArray(buffer, &word);
+  uint64 stops = ~word & kVarintContinuationBits;
+
+  if (stops == 0) {
+    // Nine or ten bytes, which only happens for very large (or negative)
+    // values, so just finish byte-by-byte.
+    uint64 result = GatherVarintGroups(word);
+    uint32 b = buffer[8];
+    result |= static_cast<uint64>(b & 0x7F) << 56;
+    if (!(b & 0x80)) {
+      *value = result;
+      return buffer + 9;
+    }
+    b = buffer[9];
+    // We have overrun the maximum size of a varint (10 bytes).  The data
+    // must be corrupt.
+    if (b & 0x80) return NULL;
+    *value = result | (static_cast<uint64>(b) << 63);
+    return buffer + 10;
+  }
+
+  // Isolate the high bit of the first terminating byte.  If that byte has
+  // index k then the bit is 1 << (8 * k + 7); multiplying 1 << (8 * k) by the
+  // byte sequence 8, 7, ..., 1 leaves k + 1 (the varint's length) in the top
+  // byte.
+  uint64 last_bit = stops & (~stops + 1);
+  int length = static_cast<int>(
+      ((last_bit >> 7) * GOOGLE_ULONGLONG(0x0102030405060708)) >> 56);
+
+  // Drop the bytes following the terminator.  When the terminator is the
+  // eighth byte, last_bit << 1 wraps to zero and the whole word is kept.
+  *value = GatherVarintGroups(word & ((last_bit << 1) - 1));
+  return buffer + length;
+}
+
+}  // namespace
+
+int CodedInputStream::ReadVarint64Batch(uint64* values, int max_count) {
+  const uint8* ptr = buffer_;
+  int count = 0;
+
+  // Decoding a varint may look at up to kMaxVarintBytes bytes, so stop once
+  // fewer than that remain and leave the tail of the buffer to the caller.
+  while (count < max_count && buffer_end_ - ptr >= kMaxVarintBytes) {
+    uint64 word;
+    ReadLittleEndian64FromArray(ptr, &word);
+    if ((word & kVarintContinuationBits) == 0 && max_count - count >= 8) {
+      // Eight one-byte varints, which is typical for packed fields holding
+      // small values.
+      for (int i = 0; i < 8; i++) {
+        values[count + i] = ptr[i];
+      }
+      count += 8;
+      ptr += 8;
+      continue;
+    }
+
+    const uint8* end = ReadVarint64FromArrayBranchless(ptr, values + count);
+    // Corrupt data; let the caller's next read report the error.
+    if (end == NULL) break;
+    ptr = end;
+    ++count;
+  }
+
+  Advance(ptr - buffer_);
+  return count;
+}
+
 bool CodedInputStream::Refresh() {
   GOOGLE_DCHECK_EQ(0, BufferSize());
 
@@ -214,6 +214,15 @@ class LIBPROTOBUF_EXPORT CodedInputStream {
   // Read an unsigned integer with Varint encoding.
   bool ReadVarint64(uint64* value);
 
+  // Decodes up to max_count consecutive Varints into values[] and returns
+  // the number decoded.  Only Varints lying entirely within the current
+  // buffer (and the current limit) are decoded and the buffer is never
+  // refreshed, so a short count does not by itself indicate an error:  the
+  // caller should read the next value with ReadVarint64() (or ReadVarint32()),
+  // which handles buffer boundaries and reports malformed input.  This is
+  // used to speed up parsing of packed repeated fields.
+  int ReadVarint64Batch(uint64* values, int max_count);
+
   // Read a tag.  This calls ReadVarint32() and returns the result, or returns
   // zero (which is not a valid tag) if ReadVarint32() fails.  Also, it updates
   // the last tag value, which can be checked with LastTagWas().
@@ -336,6 +345,37 @@ class LIBPROTOBUF_EXPORT CodedInputStream {
   //   something unusual.
   void SetTotalBytesLimit(int total_bytes_limit, int warning_threshold);
 
+  // Returns the number of bytes left until the total bytes limit is hit.
+  // Unlike BytesUntilLimit(), there is always such a limit, so this never
+  // returns -1.
+  int BytesUntilTotalBytesLimit() const;
+
+  // Returns the current position relative to the beginning of the input
+  // stream, or to the last call to ResetSizeCounter().
+  int CurrentPosition() const;
+
+  // Makes the current position the beginning of the stream as far as the
+  // total bytes limit and CurrentPosition() are concerned.  This lets one
+  // CodedInputStream read a sequence of messages of any total length while
+  // applying the total bytes limit to each of them; DelimitedMessageReader
+  // (delimited_message_stream.h) does this.  Must not be called while a limit
+  // pushed by PushLimit() is in effect.
+  void ResetSizeCounter();
+
+  // Aliasing --------------------------------------------------------
+  // When enabled, string and bytes fields declared with [ctype=STRING_PIECE]
+  // may be parsed as pointers into the input rather than copies of it.  The
+  // caller must then keep the input alive and unmodified for as long as the
+  // parsed message uses it.  Aliasing only happens when reading from a flat
+  // array (see the CodedInputStream(const uint8*, int) constructor), since
+  // the buffers handed out by a ZeroCopyInputStream may be reused.  Disabled
+  // by default.
+  void EnableAliasing(bool enabled);
+
+  // Returns true if values read from this stream may alias its input, i.e.
+  // if EnableAliasing(true) was called and the input is a flat array.
+  bool AliasingEnabled() const;
+
   // Recursion Limit -------------------------------------------------
   // To prevent corrupt or malicious messages from causing stack overflows,
   // we must keep track of the depth of recursion when parsing embedded
@@ -1031,6 +1071,14 @@ inline MessageFactory* CodedInputStream::GetExtensionFactory() {
   return extension_factory_;
 }
 
+inline void CodedInputStream::EnableAliasing(bool enabled) {
+  aliasing_enabled_ = enabled;
+}
+
+inline bool CodedInputStream::AliasingEnabled() const {
+  return aliasing_enabled_ && input_ == NULL;
+}
+
 inline uint32 CodedInputStream::BufferSize() const {
   return buffer_end_ - buffer_;
 }
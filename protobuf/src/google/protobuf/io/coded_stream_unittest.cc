@@ -415,6 +415,134 @@ TEST_2D(CodedStreamTest, ReadVarint64Error, kVarintErrorCases, kBlockSizes) {
   EXPECT_EQ(kVarintErrorCases_case.can_parse, coded_input.ReadVarint64(&value));
 }
 
+// -------------------------------------------------------------------
+// Batch varint reads.
+
+// Reads count varints using ReadVarint64Batch(), falling back to
+// ReadVarint64() when the batch reader makes no progress, as the packed
+// field parser does.
+bool ReadVarintsInBatches(CodedInputStream* coded_input, int batch_size,
+                          int count, vector<uint64>* values) {
+  scoped_array<uint64> batch(new uint64[batch_size]);
+  while (static_cast<int>(values->size()) < count) {
+    int n = coded_input->ReadVarint64Batch(
+        batch.get(), min(batch_size, count - static_cast<int>(values->size())));
+    if (n == 0) {
+      uint64 value;
+      if (!coded_input->ReadVarint64(&value)) return false;
+      values->push_back(value);
+    } else {
+      values->insert(values->end(), batch.get(), batch.get() + n);
+    }
+  }
+  return true;
+}
+
+TEST_2D(CodedStreamTest, ReadVarint64Batch, kVarintCases, kBlockSizes) {
+  static const int kCount = 100;
+  for (int i = 0; i < kCount; i++) {
+    memcpy(buffer_ + i * kVarintCases_case.size, kVarintCases_case.bytes,
+           kVarintCases_case.size);
+  }
+  ArrayInputStream input(buffer_, sizeof(buffer_), kBlockSizes_case);
+
+  {
+    CodedInputStream coded_input(&input);
+
+    vector<uint64> values;
+    EXPECT_TRUE(ReadVarintsInBatches(&coded_input, 16, kCount, &values));
+    ASSERT_EQ(kCount, values.size());
+    for (int i = 0; i < kCount; i++) {
+      EXPECT_EQ(kVarintCases_case.value, values[i]);
+    }
+  }
+
+  EXPECT_EQ(kCount * kVarintCases_case.size, input.ByteCount());
+}
+
+TEST_1D(CodedStreamTest, ReadVarint64BatchMixedSizes, kBlockSizes) {
+  // Cycle through varints of every length, with runs of one-byte values
+  // in between so that both batch paths get exercised.
+  vector<uint64> expected;
+  for (int i = 0; i < 500; i++) {
+    if (i % 3 == 0) {
+      expected.push_back(i % 128);
+    } else {
+      expected.push_back(ULL(0xFFFFFFFFFFFFFFFF) >> ((i * 7) % 64));
+    }
+  }
+
+  int size;
+  {
+    ArrayOutputStream output(buffer_, sizeof(buffer_));
+    CodedOutputStream coded_output(&output);
+    for (int i = 0; i < expected.size(); i++) {
+      coded_output.WriteVarint64(expected[i]);
+    }
+    ASSERT_FALSE(coded_output.HadError());
+    size = coded_output.ByteCount();
+  }
+
+  for (int batch_size = 1; batch_size <= 33; batch_size += 8) {
+    ArrayInputStream input(buffer_, size, kBlockSizes_case);
+
+    {
+      CodedInputStream coded_input(&input);
+
+      vector<uint64> values;
+      EXPECT_TRUE(ReadVarintsInBatches(&coded_input, batch_size,
+                                       expected.size(), &values));
+      EXPECT_TRUE(values == expected);
+    }
+
+    EXPECT_EQ(size, input.ByteCount());
+  }
+}
+
+TEST_F(CodedStreamTest, ReadVarint64BatchRespectsLimit) {
+  for (int i = 0; i < 64; i++) {
+    buffer_[i] = i;
+  }
+
+  CodedInputStream coded_input(buffer_, 64);
+  CodedInputStream::Limit limit = coded_input.PushLimit(20);
+
+  uint64 values[64];
+  int count = coded_input.ReadVarint64Batch(values, 64);
+  // The last few bytes before the limit are left to ReadVarint64().
+  EXPECT_LE(count, 20);
+  for (int i = 0; i < count; i++) {
+    EXPECT_EQ(i, values[i]);
+  }
+  for (int i = count; i < 20; i++) {
+    ASSERT_TRUE(coded_input.ReadVarint64(values + i));
+    EXPECT_EQ(i, values[i]);
+  }
+  EXPECT_EQ(0, coded_input.BytesUntilLimit());
+  EXPECT_EQ(0, coded_input.ReadVarint64Batch(values, 64));
+  coded_input.PopLimit(limit);
+}
+
+TEST_F(CodedStreamTest, ReadVarint64BatchError) {
+  // Three good values followed by a varint which is too long.
+  static const uint8 kInput[] = {
+    0x01, 0x96, 0x01, 0x02,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00
+  };
+  CodedInputStream coded_input(kInput, sizeof(kInput));
+
+  uint64 values[8];
+  ASSERT_EQ(3, coded_input.ReadVarint64Batch(values, 8));
+  EXPECT_EQ(1, values[0]);
+  EXPECT_EQ(150, values[1]);
+  EXPECT_EQ(2, values[2]);
+
+  // The batch reader leaves the bad value alone; the normal path rejects it.
+  EXPECT_EQ(0, coded_input.ReadVarint64Batch(values, 8));
+  EXPECT_FALSE(coded_input.ReadVarint64(values));
+}
+
 // -------------------------------------------------------------------
 // VarintSize
 
@@ -995,6 +1123,35 @@ TEST_F(CodedStreamTest, TotalBytesLimitNotValidMessageEnd) {
   EXPECT_FALSE(coded_input.ConsumedEntireMessage());
 }
 
+TEST_1D(CodedStreamTest, ResetSizeCounter, kBlockSizes) {
+  ArrayInputStream input(buffer_, sizeof(buffer_), kBlockSizes_case);
+  CodedInputStream coded_input(&input);
+  coded_input.SetTotalBytesLimit(16, -1);
+
+  // Each reset lets another 16 bytes be read.
+  string str;
+  for (int i = 0; i < 4; i++) {
+    EXPECT_TRUE(coded_input.ReadString(&str, 10));
+    EXPECT_EQ(10, coded_input.CurrentPosition());
+    coded_input.ResetSizeCounter();
+    EXPECT_EQ(0, coded_input.CurrentPosition());
+    EXPECT_EQ(16, coded_input.BytesUntilTotalBytesLimit());
+  }
+
+  EXPECT_TRUE(coded_input.ReadString(&str, 16));
+  {
+    ScopedMemoryLog error_log;
+    EXPECT_FALSE(coded_input.ReadString(&str, 1));
+    EXPECT_EQ(1, error_log.GetMessages(ERROR).size());
+  }
+
+  // The reads have kept their place in the underlying stream.
+  coded_input.ResetSizeCounter();
+  EXPECT_EQ(0, coded_input.CurrentPosition());
+  EXPECT_TRUE(coded_input.ReadString(&str, 16));
+  EXPECT_EQ(16, coded_input.CurrentPosition());
+}
+
 TEST_F(CodedStreamTest, RecursionLimit) {
   ArrayInputStream input(buffer_, sizeof(buffer_));
   CodedInputStream coded_input(&input);
@@ -0,0 +1,734 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// http://code.google.com/p/protobuf/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "config.h"
+
+#include <google/protobuf/io/compressed_stream.h>
+
+#include <string.h>
+#if HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/stubs/once.h>
+
+namespace google {
+namespace protobuf {
+namespace io {
+
+Codec::~Codec() {}
+
+namespace {
+
+// ===================================================================
+// CRC-32C, computed eight bytes at a time ("slicing-by-8").
+
+uint32 crc32c_table_[8][256];
+GOOGLE_PROTOBUF_DECLARE_ONCE(crc32c_table_init_);
+
+void InitCrc32cTable() {
+  const uint32 kPolynomial = 0x82f63b78;  // Castagnoli, bit-reversed.
+  for (int i = 0; i < 256; i++) {
+    uint32 crc = i;
+    for (int j = 0; j < 8; j++) {
+      crc = (crc >> 1) ^ (kPolynomial & (0 - (crc & 1)));
+    }
+    crc32c_table_[0][i] = crc;
+  }
+  for (int i = 0; i < 256; i++) {
+    for (int k = 1; k < 8; k++) {
+      uint32 previous = crc32c_table_[k - 1][i];
+      crc32c_table_[k][i] =
+          (previous >> 8) ^ crc32c_table_[0][previous & 0xff];
+    }
+  }
+}
+
+inline uint32 LoadLittleEndian32(const uint8* p) {
+  return static_cast<uint32>(p[0]) | (static_cast<uint32>(p[1]) << 8) |
+         (static_cast<uint32>(p[2]) << 16) | (static_cast<uint32>(p[3]) << 24);
+}
+
+// ===================================================================
+// The built-in LZ77 codec.
+//
+// Its format is that of LZ4 blocks.  The compressed data is a series of
+// sequences, each made of:
+//   token:  a byte whose high four bits are the number of literal bytes
+//           which follow and whose low four bits are the length of the
+//           match minus 4.  A value of 15 in either means that the length
+//           continues in further bytes, each added to it, up to and
+//           including the first which is not 255.
+//   literal length bytes, if any.
+//   literals:  copied to the output as-is.
+//   offset:  two bytes, little-endian: how far back in the output the
+//            match starts, from 1 to 65535.
+//   match length bytes, if any.
+// The match is then copied to the output; it may overlap the bytes it
+// produces.  The last sequence consists of a token and literals only.
+//
+// LZ4 also requires that the last five bytes of a block be literals and
+// that the last match start at least twelve bytes before the end, so that
+// its decoder can copy in wide chunks without checking for the end.  The
+// compressor follows those rules, so LZ4's own decoders accept its output;
+// the decoder here does not rely on them.
+//
+// The compressor finds matches through a hash table of recent positions,
+// and skips ahead faster the longer it goes without finding one, so that
+// incompressible data passes through quickly.
+
+const int kMinMatch = 4;
+const int kMaxOffset = 65535;
+// The last kLastLiterals bytes are always literals, and no match starts in
+// the last kMatchStartLimit bytes.
+const int kLastLiterals = 5;
+const int kMatchStartLimit = 12;
+const int kHashBits = 12;
+// Length values in a token which mean that more length bytes follow.
+const int kLengthContinues = 15;
+// Keeps corrupt length bytes from overflowing an int.
+const int kMaxLength = 1 << 30;
+
+inline uint32 Load32(const uint8* p) {
+  uint32 value;
+  memcpy(&value, p, sizeof(value));
+  return value;
+}
+
+inline uint64 Load64(const uint8* p) {
+  uint64 value;
+  memcpy(&value, p, sizeof(value));
+  return value;
+}
+
+inline uint32 HashFour(const uint8* p) {
+  return (Load32(p) * 2654435761u) >> (32 - kHashBits);
+}
+
+inline uint8* WriteLengthContinuation(int length, uint8* target) {
+  while (length >= 255) {
+    *target++ = 255;
+    length -= 255;
+  }
+  *target++ = length;
+  return target;
+}
+
+inline uint8* WriteSequence(const uint8* literals, int literal_length,
+                            int offset, int match_length, uint8* target) {
+  uint8* token = target++;
+  match_length -= kMinMatch;
+  *token = (min(literal_length, kLengthContinues) << 4) |
+           min(match_length, kLengthContinues);
+  if (literal_length >= kLengthContinues) {
+    target = WriteLengthContinuation(literal_length - kLengthContinues,
+                                     target);
+  }
+  memcpy(target, literals, literal_length);
+  target += literal_length;
+  *target++ = offset & 0xff;
+  *target++ = offset >> 8;
+  if (match_length >= kLengthContinues) {
+    target = WriteLengthContinuation(match_length - kLengthContinues, target);
+  }
+  return target;
+}
+
+inline uint8* WriteLastLiterals(const uint8* literals, int literal_length,
+                                uint8* target) {
+  *target++ = min(literal_length, kLengthContinues) << 4;
+  if (literal_length >= kLengthContinues) {
+    target = WriteLengthContinuation(literal_length - kLengthContinues,
+                                     target);
+  }
+  memcpy(target, literals, literal_length);
+  return target + literal_length;
+}
+
+inline bool ReadLengthContinuation(const uint8** input, const uint8* end,
+                                   int* length) {
+  while (true) {
+    if (*input >= end) return false;
+    uint8 byte = *(*input)++;
+    *length += byte;
+    if (*length > kMaxLength) return false;
+    if (byte != 255) return true;
+  }
+}
+
+class FastCodec : public Codec {
+ public:
+  int MaxCompressedSize(int size) const {
+    return size + size / 255 + 16;
+  }
+
+  int Compress(const char* input, int size, char* output) const {
+    const uint8* begin = reinterpret_cast<const uint8*>(input);
+    const uint8* end = begin + size;
+    const uint8* anchor = begin;  // Start of the pending literals.
+    uint8* target = reinterpret_cast<uint8*>(output);
+
+    // Too short for any match to satisfy the end-of-block rules.  Returning
+    // here also keeps the limits below from pointing before begin.
+    if (size <= kMatchStartLimit) {
+      target = WriteLastLiterals(anchor, size, target);
+      return target - reinterpret_cast<uint8*>(output);
+    }
+
+    // Positions relative to begin, by the hash of the four bytes there.
+    uint32 table[1 << kHashBits];
+    memset(table, 0, sizeof(table));
+
+    // Matches start no later than search_limit and end no later than
+    // match_limit.
+    const uint8* search_limit = end - kMatchStartLimit;
+    const uint8* match_limit = end - kLastLiterals;
+    const uint8* ip = begin + 1;
+    while (ip <= search_limit) {
+      // Look for a match, skipping ahead faster the longer we go without
+      // finding one.
+      const uint8* match;
+      int misses = 0;
+      while (true) {
+        uint32 hash = HashFour(ip);
+        match = begin + table[hash];
+        table[hash] = ip - begin;
+        if (ip - match <= kMaxOffset && Load32(match) == Load32(ip)) break;
+        ip += 1 + (misses++ >> 5);
+        if (ip > search_limit) goto done;
+      }
+
+      // Extend the match backwards over the pending literals...
+      while (ip > anchor && match > begin && ip[-1] == match[-1]) {
+        --ip;
+        --match;
+      }
+      // ...and forwards as far as it goes.
+      const uint8* p = ip + kMinMatch;
+      const uint8* q = match + kMinMatch;
+      while (p + 8 <= match_limit && Load64(p) == Load64(q)) {
+        p += 8;
+        q += 8;
+      }
+      while (p < match_limit && *p == *q) {
+        ++p;
+        ++q;
+      }
+
+      target = WriteSequence(anchor, ip - anchor, ip - match, p - ip, target);
+      ip = p;
+      anchor = ip;
+
+      // Remember a position near the end of the match, which often starts
+      // the next one.
+      if (ip <= search_limit) {
+        table[HashFour(ip - 2)] = ip - 2 - begin;
+      }
+    }
+
+   done:
+    target = WriteLastLiterals(anchor, end - anchor, target);
+    return target - reinterpret_cast<uint8*>(output);
+  }
+
+  bool Uncompress(const char* input, int size,
+                  char* output, int uncompressed_size) const {
+    const uint8* ip = reinterpret_cast<const uint8*>(input);
+    const uint8* input_end = ip + size;
+    uint8* const begin = reinterpret_cast<uint8*>(output);
+    uint8* const end = begin + uncompressed_size;
+    uint8* op = begin;
+
+    while (true) {
+      if (ip >= input_end) return false;
+      int token = *ip++;
+
+      int literal_length = token >> 4;
+      if (literal_length == kLengthContinues &&
+          !ReadLengthContinuation(&ip, input_end, &literal_length)) {
+        return false;
+      }
+      if (literal_length > input_end - ip || literal_length > end - op) {
+        return false;
+      }
+      memcpy(op, ip, literal_length);
+      op += literal_length;
+      ip += literal_length;
+
+      if (ip == input_end) return op == end;  // That was the last sequence.
+
+      if (input_end - ip < 2) return false;
+      int offset = ip[0] | (ip[1] << 8);
+      ip += 2;
+      if (offset == 0 || offset > op - begin) return false;
+
+      int match_length = token & 0xf;
+      if (match_length == kLengthContinues &&
+          !ReadLengthContinuation(&ip, input_end, &match_length)) {
+        return false;
+      }
+      match_length += kMinMatch;
+      if (match_length > end - op) return false;
+
+      const uint8* match = op - offset;
+      if (offset >= 8) {
+        // Copying eight bytes at a time never reads what it is writing.
+        while (match_length >= 8) {
+          memcpy(op, match, 8);
+          op += 8;
+          match += 8;
+          match_length -= 8;
+        }
+      }
+      while (match_length-- > 0) {
+        *op++ = *match++;
+      }
+    }
+  }
+};
+
+// -------------------------------------------------------------------
+
+class NullCodec : public Codec {
+ public:
+  int MaxCompressedSize(int size) const { return size; }
+
+  int Compress(const char* input, int size, char* output) const {
+    memcpy(output, input, size);
+    return size;
+  }
+
+  bool Uncompress(const char* input, int size,
+                  char* output, int uncompressed_size) const {
+    if (size != uncompressed_size) return false;
+    memcpy(output, input, size);
+    return true;
+  }
+};
+
+#if HAVE_ZLIB
+class ZlibCodec : public Codec {
+ public:
+  int MaxCompressedSize(int size) const { return compressBound(size); }
+
+  int Compress(const char* input, int size, char* output) const {
+    uLongf output_size = compressBound(size);
+    int error = compress2(reinterpret_cast<Bytef*>(output), &output_size,
+                          reinterpret_cast<const Bytef*>(input), size,
+                          Z_DEFAULT_COMPRESSION);
+    if (error != Z_OK) {
+      GOOGLE_LOG(ERROR) << "zlib compression failed with error " << error
+                 << ".";
+      return -1;
+    }
+    return output_size;
+  }
+
+  bool Uncompress(const char* input, int size,
+                  char* output, int uncompressed_size) const {
+    uLongf output_size = uncompressed_size;
+    return uncompress(reinterpret_cast<Bytef*>(output), &output_size,
+                      reinterpret_cast<const Bytef*>(input), size) == Z_OK &&
+           output_size == uncompressed_size;
+  }
+};
+#endif  // HAVE_ZLIB
+
+// ===================================================================
+// Codec registry.
+
+const int kMaxCompressionType = 255;
+
+Mutex* codec_mutex_ = NULL;
+const Codec* codecs_[kMaxCompressionType + 1];
+GOOGLE_PROTOBUF_DECLARE_ONCE(codecs_init_);
+
+void DeleteCodecs() {
+  for (int i = 0; i <= kMaxCompressionType; i++) {
+    delete codecs_[i];
+    codecs_[i] = NULL;
+  }
+  delete codec_mutex_;
+  codec_mutex_ = NULL;
+}
+
+void InitCodecs() {
+  codec_mutex_ = new Mutex;
+  codecs_[NO_COMPRESSION] = new NullCodec;
+  codecs_[FAST_COMPRESSION] = new FastCodec;
+#if HAVE_ZLIB
+  codecs_[ZLIB_COMPRESSION] = new ZlibCodec;
+#endif
+  internal::OnShutdown(&DeleteCodecs);
+}
+
+// ===================================================================
+
+const int kDefaultBlockSize = 65536;
+const int kDefaultBlockSizeLimit = 16 << 20;
+const char kMagic[] = { 'P', 'B', 'Z' };
+const int kHeaderSize = sizeof(kMagic) + 1;
+const int kMaxVarint32Bytes = 5;
+// The sizes and the checksum.
+const int kMaxBlockHeaderSize = 2 * kMaxVarint32Bytes + sizeof(uint32);
+
+}  // namespace
+
+void RegisterCodec(CompressionType type, Codec* codec) {
+  ::google::protobuf::GoogleOnceInit(&codecs_init_, &InitCodecs);
+  GOOGLE_CHECK_GE(type, FIRST_CUSTOM_COMPRESSION);
+  GOOGLE_CHECK_LE(type, kMaxCompressionType);
+  MutexLock lock(codec_mutex_);
+  GOOGLE_CHECK(codecs_[type] == NULL)
+      << "A codec is already registered for compression type " << type << ".";
+  codecs_[type] = codec;
+}
+
+const Codec* GetCodec(CompressionType type) {
+  ::google::protobuf::GoogleOnceInit(&codecs_init_, &InitCodecs);
+  if (type < 0 || type > kMaxCompressionType) return NULL;
+  MutexLock lock(codec_mutex_);
+  return codecs_[type];
+}
+
+uint32 Crc32c(uint32 crc, const void* data, int size) {
+  ::google::protobuf::GoogleOnceInit(&crc32c_table_init_, &InitCrc32cTable);
+  const uint8* p = reinterpret_cast<const uint8*>(data);
+
+  crc = ~crc;
+  while (size >= 8) {
+    uint32 low = LoadLittleEndian32(p) ^ crc;
+    uint32 high = LoadLittleEndian32(p + 4);
+    crc = crc32c_table_[7][low & 0xff] ^
+          crc32c_table_[6][(low >> 8) & 0xff] ^
+          crc32c_table_[5][(low >> 16) & 0xff] ^
+          crc32c_table_[4][low >> 24] ^
+          crc32c_table_[3][high & 0xff] ^
+          crc32c_table_[2][(high >> 8) & 0xff] ^
+          crc32c_table_[1][(high >> 16) & 0xff] ^
+          crc32c_table_[0][high >> 24];
+    p += 8;
+    size -= 8;
+  }
+  while (size-- > 0) {
+    crc = crc32c_table_[0][(crc ^ *p++) & 0xff] ^ (crc >> 8);
+  }
+  return ~crc;
+}
+
+// ===================================================================
+
+CompressedOutputStream::CompressedOutputStream(
+    ZeroCopyOutputStream* sub_stream, CompressionType type, int block_size)
+  : sub_stream_(sub_stream),
+    type_(type),
+    codec_(GetCodec(type)),
+    block_size_(block_size > 0 ? block_size : kDefaultBlockSize),
+    buffer_(NULL),
+    buffer_used_(0),
+    compressed_buffer_(NULL),
+    flushed_bytes_(0),
+    header_written_(false),
+    closed_(false),
+    had_error_(false) {
+  GOOGLE_CHECK(codec_ != NULL)
+      << "No codec is registered for compression type " << type << ".";
+  buffer_ = new char[block_size_];
+  if (type_ != NO_COMPRESSION) {
+    compressed_buffer_ = new char[codec_->MaxCompressedSize(block_size_)];
+  }
+}
+
+CompressedOutputStream::~CompressedOutputStream() {
+  Close();
+  delete [] buffer_;
+  delete [] compressed_buffer_;
+}
+
+bool CompressedOutputStream::WriteRaw(const void* data, int size) {
+  const uint8* in = reinterpret_cast<const uint8*>(data);
+  while (size > 0) {
+    void* out;
+    int out_size;
+    if (!sub_stream_->Next(&out, &out_size)) {
+      had_error_ = true;
+      return false;
+    }
+    if (out_size >= size) {
+      memcpy(out, in, size);
+      sub_stream_->BackUp(out_size - size);
+      return true;
+    }
+    memcpy(out, in, out_size);
+    in += out_size;
+    size -= out_size;
+  }
+  return true;
+}
+
+bool CompressedOutputStream::WriteHeader() {
+  char header[kHeaderSize];
+  memcpy(header, kMagic, sizeof(kMagic));
+  header[sizeof(kMagic)] = type_;
+  if (!WriteRaw(header, sizeof(header))) return false;
+  header_written_ = true;
+  return true;
+}
+
+bool CompressedOutputStream::WriteBlock() {
+  if (!header_written_ && !WriteHeader()) return false;
+
+  int size = buffer_used_;
+  const char* data = buffer_;
+  int stored_size = size;
+  if (type_ != NO_COMPRESSION) {
+    int compressed_size = codec_->Compress(buffer_, size, compressed_buffer_);
+    if (compressed_size < 0) {
+      had_error_ = true;
+      return false;
+    }
+    // Store the block as-is if compressing it didn't help.
+    if (compressed_size < size) {
+      data = compressed_buffer_;
+      stored_size = compressed_size;
+    }
+  }
+
+  uint8 block_header[kMaxBlockHeaderSize];
+  uint8* end = CodedOutputStream::WriteVarint32ToArray(size, block_header);
+  end = CodedOutputStream::WriteVarint32ToArray(stored_size, end);
+  end = CodedOutputStream::WriteLittleEndian32ToArray(
+      Crc32c(0, buffer_, size), end);
+  if (!WriteRaw(block_header, end - block_header) ||
+      !WriteRaw(data, stored_size)) {
+    return false;
+  }
+
+  flushed_bytes_ += size;
+  buffer_used_ = 0;
+  return true;
+}
+
+bool CompressedOutputStream::Next(void** data, int* size) {
+  if (had_error_ || closed_) return false;
+  if (buffer_used_ == block_size_ && !WriteBlock()) return false;
+  *data = buffer_ + buffer_used_;
+  *size = block_size_ - buffer_used_;
+  buffer_used_ = block_size_;
+  return true;
+}
+
+void CompressedOutputStream::BackUp(int count) {
+  GOOGLE_CHECK_GE(count, 0);
+  GOOGLE_CHECK_LE(count, buffer_used_);
+  buffer_used_ -= count;
+}
+
+int64 CompressedOutputStream::ByteCount() const {
+  return flushed_bytes_ + buffer_used_;
+}
+
+bool CompressedOutputStream::Flush() {
+  if (had_error_ || closed_) return false;
+  if (buffer_used_ > 0) return WriteBlock();
+  return true;
+}
+
+bool CompressedOutputStream::Close() {
+  if (closed_) return !had_error_;
+  if (Flush()) {
+    // Even an empty stream gets a header, so that it can be read back.
+    if (header_written_ || WriteHeader()) {
+      uint8 end = 0;
+      WriteRaw(&end, 1);
+    }
+  }
+  closed_ = true;
+  return !had_error_;
+}
+
+// ===================================================================
+
+CompressedInputStream::CompressedInputStream(ZeroCopyInputStream* sub_stream)
+  : sub_stream_(sub_stream),
+    type_(NO_COMPRESSION),
+    codec_(NULL),
+    block_size_limit_(kDefaultBlockSizeLimit),
+    buffer_(NULL),
+    buffer_capacity_(0),
+    buffer_size_(0),
+    buffer_position_(0),
+    compressed_buffer_(NULL),
+    compressed_buffer_capacity_(0),
+    block_start_bytes_(0),
+    header_read_(false),
+    at_end_(false),
+    had_error_(false) {
+}
+
+CompressedInputStream::~CompressedInputStream() {
+  delete [] buffer_;
+  delete [] compressed_buffer_;
+}
+
+bool CompressedInputStream::Fail() {
+  had_error_ = true;
+  return false;
+}
+
+bool CompressedInputStream::ReadRaw(void* data, int size) {
+  uint8* out = reinterpret_cast<uint8*>(data);
+  while (size > 0) {
+    const void* in;
+    int in_size;
+    if (!sub_stream_->Next(&in, &in_size)) return false;
+    if (in_size >= size) {
+      memcpy(out, in, size);
+      sub_stream_->BackUp(in_size - size);
+      return true;
+    }
+    memcpy(out, in, in_size);
+    out += in_size;
+    size -= in_size;
+  }
+  return true;
+}
+
+bool CompressedInputStream::ReadVarint32(uint32* value) {
+  *value = 0;
+  for (int i = 0; i < kMaxVarint32Bytes; i++) {
+    uint8 byte;
+    if (!ReadRaw(&byte, 1)) return false;
+    *value |= static_cast<uint32>(byte & 0x7f) << (7 * i);
+    if (byte < 0x80) return true;
+  }
+  return false;
+}
+
+bool CompressedInputStream::ReadHeader() {
+  uint8 header[kHeaderSize];
+  if (!ReadRaw(header, sizeof(header)) ||
+      memcmp(header, kMagic, sizeof(kMagic)) != 0) {
+    return Fail();
+  }
+  type_ = static_cast<CompressionType>(header[sizeof(kMagic)]);
+  codec_ = GetCodec(type_);
+  if (codec_ == NULL) {
+    GOOGLE_LOG(ERROR) << "Compressed stream uses unknown compression type "
+                      << type_ << ".";
+    return Fail();
+  }
+  header_read_ = true;
+  return true;
+}
+
+bool CompressedInputStream::ReadBlock() {
+  if (at_end_ || had_error_) return false;
+  if (!header_read_ && !ReadHeader()) return false;
+
+  uint32 size, stored_size;
+  if (!ReadVarint32(&size)) return Fail();
+  if (size == 0) {
+    at_end_ = true;
+    return false;
+  }
+  uint8 checksum_bytes[sizeof(uint32)];
+  uint32 checksum;
+  if (!ReadVarint32(&stored_size) ||
+      !ReadRaw(checksum_bytes, sizeof(checksum_bytes))) {
+    return Fail();
+  }
+  CodedInputStream::ReadLittleEndian32FromArray(checksum_bytes, &checksum);
+  if (size > static_cast<uint32>(block_size_limit_) || stored_size > size) {
+    return Fail();
+  }
+
+  block_start_bytes_ += buffer_size_;
+  buffer_size_ = 0;
+  buffer_position_ = 0;
+  if (static_cast<int>(size) > buffer_capacity_) {
+    delete [] buffer_;
+    buffer_ = new char[size];
+    buffer_capacity_ = size;
+  }
+
+  if (stored_size == size) {
+    if (!ReadRaw(buffer_, size)) return Fail();
+  } else {
+    if (static_cast<int>(stored_size) > compressed_buffer_capacity_) {
+      delete [] compressed_buffer_;
+      compressed_buffer_ = new char[stored_size];
+      compressed_buffer_capacity_ = stored_size;
+    }
+    if (!ReadRaw(compressed_buffer_, stored_size) ||
+        !codec_->Uncompress(compressed_buffer_, stored_size, buffer_, size)) {
+      return Fail();
+    }
+  }
+  if (Crc32c(0, buffer_, size) != checksum) return Fail();
+
+  buffer_size_ = size;
+  return true;
+}
+
+bool CompressedInputStream::Next(const void** data, int* size) {
+  if (buffer_position_ == buffer_size_ && !ReadBlock()) return false;
+  *data = buffer_ + buffer_position_;
+  *size = buffer_size_ - buffer_position_;
+  buffer_position_ = buffer_size_;
+  return true;
+}
+
+void CompressedInputStream::BackUp(int count) {
+  GOOGLE_CHECK_GE(count, 0);
+  GOOGLE_CHECK_LE(count, buffer_position_);
+  buffer_position_ -= count;
+}
+
+bool CompressedInputStream::Skip(int count) {
+  GOOGLE_CHECK_GE(count, 0);
+  while (count > buffer_size_ - buffer_position_) {
+    count -= buffer_size_ - buffer_position_;
+    buffer_position_ = buffer_size_;
+    if (!ReadBlock()) return false;
+  }
+  buffer_position_ += count;
+  return true;
+}
+
+int64 CompressedInputStream::ByteCount() const {
+  return block_start_bytes_ + buffer_position_;
+}
+
+}  // namespace io
+}  // namespace protobuf
+}  // namespace google
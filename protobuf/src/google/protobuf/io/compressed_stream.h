@@ -0,0 +1,247 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// http://code.google.com/p/protobuf/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Streams which compress data a block at a time with a pluggable codec.
+//
+// CompressedOutputStream splits what is written to it into blocks (64kB by
+// default), compresses each with the codec for the chosen CompressionType,
+// and writes them to an underlying stream with a small amount of framing
+// and a checksum of each block's contents.  CompressedInputStream reads
+// such a stream back, taking the codec from the stream's header, and
+// detects truncated or corrupted data.  For example:
+//
+//   FileOutputStream file_output(fd);
+//   CompressedOutputStream compressed_output(&file_output, FAST_COMPRESSION);
+//   message.SerializeToZeroCopyStream(&compressed_output);
+//   if (!compressed_output.Close()) return false;
+//
+//   CompressedInputStream compressed_input(&file_input);
+//   message.ParseFromZeroCopyStream(&compressed_input);
+//
+// FAST_COMPRESSION is a built-in LZ77 codec producing LZ4 blocks, which
+// compresses at hundreds of MB/s and decompresses several times faster
+// still; it is meant for RPC payloads and other data where CPU time
+// matters more than size.  ZLIB_COMPRESSION compresses better, much more
+// slowly, and is only available if the library was built with zlib (see
+// gzip_stream.h for streams in the gzip and zlib formats themselves).
+// Other codecs can be added with RegisterCodec().
+//
+// The stream format is:
+//
+//   stream := "PBZ" type:byte block* end
+//   block  := size:varint32 stored_size:varint32 crc32c:fixed32 data
+//   end    := 0:varint32
+//
+// where size is the size of the block's uncompressed contents, which have
+// the given CRC-32C (fixed32s are little-endian), and data is stored_size
+// bytes: the compressed contents if stored_size < size, or the contents
+// themselves if they didn't compress.
+
+#ifndef GOOGLE_PROTOBUF_IO_COMPRESSED_STREAM_H__
+#define GOOGLE_PROTOBUF_IO_COMPRESSED_STREAM_H__
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/io/zero_copy_stream.h>
+
+namespace google {
+namespace protobuf {
+namespace io {
+
+// Selects the codec a CompressedOutputStream uses.  The values are written
+// to the stream, so must never change.
+enum CompressionType {
+  NO_COMPRESSION = 0,     // Blocks are stored as-is, with checksums.
+  FAST_COMPRESSION = 1,   // The built-in LZ77 codec.
+  ZLIB_COMPRESSION = 2,   // zlib's deflate, if available.
+
+  // Values from here to 255 are free for RegisterCodec().
+  FIRST_CUSTOM_COMPRESSION = 128
+};
+
+// Compresses and uncompresses independent blocks of data.  Implementations
+// must be thread-safe, since one instance is shared by all streams using
+// its CompressionType.
+class LIBPROTOBUF_EXPORT Codec {
+ public:
+  inline Codec() {}
+  virtual ~Codec();
+
+  // Returns the most bytes Compress() can produce from size bytes of input.
+  virtual int MaxCompressedSize(int size) const = 0;
+
+  // Compresses size bytes at input into output, which has room for
+  // MaxCompressedSize(size) bytes, and returns the compressed size.  Returns
+  // -1 if compression fails, which makes the stream writing the block fail.
+  virtual int Compress(const char* input, int size, char* output) const = 0;
+
+  // Uncompresses size bytes at input into output, which has room for
+  // exactly uncompressed_size bytes.  Returns false if the input is corrupt
+  // or does not uncompress to exactly uncompressed_size bytes.  Must not
+  // read or write out of bounds, whatever the input.
+  virtual bool Uncompress(const char* input, int size,
+                          char* output, int uncompressed_size) const = 0;
+
+ private:
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(Codec);
+};
+
+// Makes codec available as the given type, which must be at least
+// FIRST_CUSTOM_COMPRESSION and not already registered.  Takes ownership of
+// the codec, which is deleted at shutdown (see ShutdownProtobufLibrary()).
+LIBPROTOBUF_EXPORT void RegisterCodec(CompressionType type, Codec* codec);
+
+// Returns the codec for the given type, or NULL if there is none.
+LIBPROTOBUF_EXPORT const Codec* GetCodec(CompressionType type);
+
+// Computes the CRC-32C (Castagnoli) of size bytes at data, continuing from
+// the CRC of preceding data, or 0 at the start.
+LIBPROTOBUF_EXPORT uint32 Crc32c(uint32 crc, const void* data, int size);
+
+// ===================================================================
+
+// A ZeroCopyOutputStream which compresses what is written to it.
+class LIBPROTOBUF_EXPORT CompressedOutputStream : public ZeroCopyOutputStream {
+ public:
+  // Compresses to sub_stream with the codec for the given type, which must
+  // be available (see GetCodec()).  If a block_size is given, input is
+  // compressed in blocks of that many bytes; larger blocks compress better
+  // but need more memory to write and read.  Otherwise, a reasonable
+  // default is used.
+  explicit CompressedOutputStream(ZeroCopyOutputStream* sub_stream,
+                                  CompressionType type = FAST_COMPRESSION,
+                                  int block_size = -1);
+  // Calls Close().
+  ~CompressedOutputStream();
+
+  // Compresses what has been written so far, as a block of its own, and
+  // writes it to the underlying stream.  It is the caller's responsibility
+  // to flush the underlying stream if necessary.  Flushing often hurts
+  // compression.  Returns false if the underlying stream failed.
+  bool Flush();
+
+  // Flushes, then ends the stream.  It is the caller's responsibility to
+  // close the underlying stream if necessary.  Returns false if the
+  // underlying stream failed.
+  bool Close();
+
+  // Returns true if writing to the underlying stream has failed, after
+  // which everything else fails too.
+  bool HadError() const { return had_error_; }
+
+  // implements ZeroCopyOutputStream ---------------------------------
+  bool Next(void** data, int* size);
+  void BackUp(int count);
+  int64 ByteCount() const;
+
+ private:
+  bool WriteHeader();
+  bool WriteBlock();
+  bool WriteRaw(const void* data, int size);
+
+  ZeroCopyOutputStream* sub_stream_;
+  const CompressionType type_;
+  const Codec* codec_;
+  const int block_size_;
+
+  char* buffer_;             // block_size_ bytes of input.
+  int buffer_used_;
+  char* compressed_buffer_;  // Big enough for a compressed block.
+
+  int64 flushed_bytes_;      // Uncompressed bytes in blocks written so far.
+  bool header_written_;
+  bool closed_;
+  bool had_error_;
+
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(CompressedOutputStream);
+};
+
+// A ZeroCopyInputStream which uncompresses a stream written by
+// CompressedOutputStream.
+class LIBPROTOBUF_EXPORT CompressedInputStream : public ZeroCopyInputStream {
+ public:
+  // Reads compressed data from sub_stream.
+  explicit CompressedInputStream(ZeroCopyInputStream* sub_stream);
+  ~CompressedInputStream();
+
+  // Sets the largest block size accepted; a stream with larger blocks is
+  // treated as corrupt, so that corrupt or malicious input can't make the
+  // stream allocate huge buffers.  The default is 16MB.
+  void SetBlockSizeLimit(int limit) { block_size_limit_ = limit; }
+
+  // Returns the type of the stream's codec.  Only valid once Next() has
+  // been called.
+  CompressionType type() const { return type_; }
+
+  // Returns true if the input was found to be corrupt or truncated, or used
+  // an unknown codec.  Next() returning false means the end of the stream
+  // only if this is false.
+  bool HadError() const { return had_error_; }
+
+  // implements ZeroCopyInputStream ----------------------------------
+  bool Next(const void** data, int* size);
+  void BackUp(int count);
+  bool Skip(int count);
+  int64 ByteCount() const;
+
+ private:
+  // Reads the stream header.
+  bool ReadHeader();
+  // Reads and uncompresses the next block into buffer_.  Returns false at
+  // the end of the stream or on error.
+  bool ReadBlock();
+  bool ReadRaw(void* data, int size);
+  bool ReadVarint32(uint32* value);
+  bool Fail();
+
+  ZeroCopyInputStream* sub_stream_;
+  CompressionType type_;
+  const Codec* codec_;
+  int block_size_limit_;
+
+  char* buffer_;            // Holds the current block's contents.
+  int buffer_capacity_;
+  int buffer_size_;
+  int buffer_position_;     // How much of the block Next() has returned.
+  char* compressed_buffer_;
+  int compressed_buffer_capacity_;
+
+  int64 block_start_bytes_;  // ByteCount() at the start of the block.
+  bool header_read_;
+  bool at_end_;
+  bool had_error_;
+
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(CompressedInputStream);
+};
+
+}  // namespace io
+}  // namespace protobuf
+
+}  // namespace google
+#endif  // GOOGLE_PROTOBUF_IO_COMPRESSED_STREAM_H__
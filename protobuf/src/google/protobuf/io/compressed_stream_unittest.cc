@@ -0,0 +1,458 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// http://code.google.com/p/protobuf/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "config.h"
+
+#include <google/protobuf/io/compressed_stream.h>
+
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/io/zero_copy_stream_impl.h>
+#include <google/protobuf/stubs/stl_util-inl.h>
+#include <google/protobuf/stubs/strutil.h>
+#include <google/protobuf/testing/googletest.h>
+#include <gtest/gtest.h>
+
+namespace google {
+namespace protobuf {
+namespace io {
+namespace {
+
+// Some text which compresses, but not trivially.
+string MakeText(int size) {
+  string text;
+  for (int i = 0; text.size() < size; i++) {
+    text += "line ";
+    text += SimpleItoa(i * 7919 % 1000);
+    text += ": the quick brown fox jumps over the lazy dog ";
+    text += SimpleItoa(i);
+    text += "\n";
+  }
+  text.resize(size);
+  return text;
+}
+
+// Bytes which do not compress at all.
+string MakeRandom(int size) {
+  string data(size, '\0');
+  uint32 state = 12345;
+  for (int i = 0; i < size; i++) {
+    state = state * 1103515245 + 12345;
+    data[i] = state >> 24;
+  }
+  return data;
+}
+
+// Writes data through a CompressedOutputStream, at most write_size bytes
+// at a time.
+string Compress(const string& data, CompressionType type, int block_size,
+                int write_size) {
+  string compressed;
+  StringOutputStream string_output(&compressed);
+  {
+    CompressedOutputStream output(&string_output, type, block_size);
+    int position = 0;
+    while (position < data.size()) {
+      void* out;
+      int out_size;
+      EXPECT_TRUE(output.Next(&out, &out_size));
+      int n = min(min(out_size, write_size),
+                  static_cast<int>(data.size()) - position);
+      memcpy(out, data.data() + position, n);
+      output.BackUp(out_size - n);
+      position += n;
+    }
+    EXPECT_EQ(data.size(), output.ByteCount());
+    EXPECT_TRUE(output.Close());
+  }
+  return compressed;
+}
+
+// Reads a compressed stream back, from a sub-stream returning buffers of
+// sub_block_size bytes.  Returns false if the stream didn't read cleanly.
+bool Uncompress(const string& compressed, int sub_block_size,
+                string* data) {
+  data->clear();
+  ArrayInputStream array_input(compressed.data(), compressed.size(),
+                               sub_block_size);
+  CompressedInputStream input(&array_input);
+  const void* in;
+  int in_size;
+  while (input.Next(&in, &in_size)) {
+    data->append(reinterpret_cast<const char*>(in), in_size);
+  }
+  if (input.HadError()) return false;
+  EXPECT_EQ(data->size(), input.ByteCount());
+  // The whole stream, and nothing more, should have been consumed.
+  EXPECT_EQ(compressed.size(), array_input.ByteCount());
+  return true;
+}
+
+TEST(CompressedStreamTest, Crc32c) {
+  EXPECT_EQ(0, Crc32c(0, "", 0));
+  EXPECT_EQ(0xe3069283, Crc32c(0, "123456789", 9));
+
+  // Computing it piecewise gives the same result.
+  string text = MakeText(1000);
+  uint32 whole = Crc32c(0, text.data(), text.size());
+  uint32 pieces = 0;
+  for (int i = 0; i < text.size(); i += 37) {
+    pieces = Crc32c(pieces, text.data() + i,
+                    min(37, static_cast<int>(text.size()) - i));
+  }
+  EXPECT_EQ(whole, pieces);
+}
+
+TEST(CompressedStreamTest, RoundTrip) {
+  CompressionType types[] = { NO_COMPRESSION, FAST_COMPRESSION,
+#if HAVE_ZLIB
+                              ZLIB_COMPRESSION,
+#endif
+                            };
+  int block_sizes[] = { 1, 100, 4096, -1 };
+  int sizes[] = { 0, 1, 5, 1000, 200000 };
+
+  for (int t = 0; t < GOOGLE_ARRAYSIZE(types); t++) {
+    for (int b = 0; b < GOOGLE_ARRAYSIZE(block_sizes); b++) {
+      for (int s = 0; s < GOOGLE_ARRAYSIZE(sizes); s++) {
+        if (block_sizes[b] == 1 && sizes[s] > 1000) continue;
+        SCOPED_TRACE(testing::Message() << "type " << types[t]
+                     << ", block size " << block_sizes[b]
+                     << ", size " << sizes[s]);
+        string text = MakeText(sizes[s]);
+        string compressed = Compress(text, types[t], block_sizes[b], 1000);
+        string result;
+        EXPECT_TRUE(Uncompress(compressed, 7, &result));
+        EXPECT_TRUE(result == text);
+        EXPECT_TRUE(Uncompress(compressed, -1, &result));
+        EXPECT_TRUE(result == text);
+      }
+    }
+  }
+}
+
+TEST(CompressedStreamTest, Compresses) {
+  string text = MakeText(100000);
+  string compressed = Compress(text, FAST_COMPRESSION, -1, 100000);
+  EXPECT_LT(compressed.size(), text.size() / 2);
+
+  // Incompressible data grows only by the framing.
+  string random = MakeRandom(100000);
+  compressed = Compress(random, FAST_COMPRESSION, -1, 100000);
+  EXPECT_LT(compressed.size(), random.size() + 100);
+  string result;
+  EXPECT_TRUE(Uncompress(compressed, -1, &result));
+  EXPECT_TRUE(result == random);
+}
+
+TEST(CompressedStreamTest, Flush) {
+  string compressed;
+  {
+    StringOutputStream string_output(&compressed);
+    CompressedOutputStream output(&string_output);
+    void* out;
+    int out_size;
+    ASSERT_TRUE(output.Next(&out, &out_size));
+    memcpy(out, "hello", 5);
+    output.BackUp(out_size - 5);
+    EXPECT_TRUE(output.Flush());
+
+    // What was flushed can be read before the stream is closed.
+    ArrayInputStream array_input(compressed.data(), compressed.size());
+    CompressedInputStream input(&array_input);
+    const void* in;
+    int in_size;
+    ASSERT_TRUE(input.Next(&in, &in_size));
+    EXPECT_EQ("hello", string(reinterpret_cast<const char*>(in), in_size));
+    EXPECT_FALSE(input.Next(&in, &in_size));
+    EXPECT_TRUE(input.HadError());  // The stream is truncated.
+
+    ASSERT_TRUE(output.Next(&out, &out_size));
+    memcpy(out, " world", 6);
+    output.BackUp(out_size - 6);
+  }
+  string result;
+  EXPECT_TRUE(Uncompress(compressed, -1, &result));
+  EXPECT_EQ("hello world", result);
+}
+
+TEST(CompressedStreamTest, BackUpAndSkip) {
+  string text = MakeText(50000);
+  string compressed = Compress(text, FAST_COMPRESSION, 1000, 1000);
+
+  ArrayInputStream array_input(compressed.data(), compressed.size());
+  CompressedInputStream input(&array_input);
+  const void* in;
+  int in_size;
+  ASSERT_TRUE(input.Next(&in, &in_size));
+  EXPECT_EQ(FAST_COMPRESSION, input.type());
+  input.BackUp(in_size - 10);
+  EXPECT_EQ(10, input.ByteCount());
+  EXPECT_TRUE(input.Skip(20000));
+  EXPECT_EQ(20010, input.ByteCount());
+  ASSERT_TRUE(input.Next(&in, &in_size));
+  EXPECT_EQ(text.substr(20010, in_size),
+            string(reinterpret_cast<const char*>(in), in_size));
+
+  // Skipping past the end fails without being an error.
+  EXPECT_FALSE(input.Skip(50000));
+  EXPECT_FALSE(input.HadError());
+  EXPECT_EQ(text.size(), input.ByteCount());
+}
+
+TEST(CompressedStreamTest, DetectsCorruption) {
+  string text = MakeText(10000);
+  string compressed = Compress(text, FAST_COMPRESSION, 1000, 1000);
+  string result;
+  ASSERT_TRUE(Uncompress(compressed, -1, &result));
+
+  // Every truncation is detected.
+  for (int size = 0; size < compressed.size(); size++) {
+    EXPECT_FALSE(Uncompress(compressed.substr(0, size), -1, &result))
+        << "size " << size;
+  }
+
+  // So is a changed byte anywhere after the header.  Not every one can be
+  // caught -- e.g. a block may still uncompress to the right data -- but
+  // none should cause trouble.
+  int detected = 0;
+  for (int i = 4; i < compressed.size(); i++) {
+    string corrupt = compressed;
+    corrupt[i] ^= 0x20;
+    ArrayInputStream array_input(corrupt.data(), corrupt.size());
+    CompressedInputStream input(&array_input);
+    const void* in;
+    int in_size;
+    while (input.Next(&in, &in_size)) {}
+    if (input.HadError()) ++detected;
+  }
+  EXPECT_GT(detected, (compressed.size() - 4) * 9 / 10);
+
+  // A bad header is detected too.
+  string corrupt = compressed;
+  corrupt[0] = 'X';
+  EXPECT_FALSE(Uncompress(corrupt, -1, &result));
+  corrupt = compressed;
+  corrupt[3] = 100;  // No codec.
+  EXPECT_FALSE(Uncompress(corrupt, -1, &result));
+}
+
+TEST(CompressedStreamTest, BlockSizeLimit) {
+  string text = MakeText(10000);
+  string compressed = Compress(text, FAST_COMPRESSION, 5000, 10000);
+
+  ArrayInputStream array_input(compressed.data(), compressed.size());
+  CompressedInputStream input(&array_input);
+  input.SetBlockSizeLimit(4999);
+  const void* in;
+  int in_size;
+  EXPECT_FALSE(input.Next(&in, &in_size));
+  EXPECT_TRUE(input.HadError());
+}
+
+TEST(CompressedStreamTest, FastCodecEdgeCases) {
+  const Codec* codec = GetCodec(FAST_COMPRESSION);
+  ASSERT_TRUE(codec != NULL);
+
+  string inputs[] = {
+    "",
+    "a",
+    "abcd",
+    string(100000, 'x'),              // One long run.
+    MakeText(300) + MakeText(300),    // A long match.
+    MakeRandom(70000) + MakeRandom(70000),  // A match out of range.
+    MakeRandom(1000),
+  };
+  for (int i = 0; i < GOOGLE_ARRAYSIZE(inputs); i++) {
+    SCOPED_TRACE(testing::Message() << "input " << i);
+    const string& input = inputs[i];
+    string compressed(codec->MaxCompressedSize(input.size()), '\0');
+    int size = codec->Compress(input.data(), input.size(),
+                               string_as_array(&compressed));
+    ASSERT_LE(size, compressed.size());
+    compressed.resize(size);
+
+    string output(input.size(), '\0');
+    EXPECT_TRUE(codec->Uncompress(compressed.data(), compressed.size(),
+                                  string_as_array(&output), output.size()));
+    EXPECT_TRUE(output == input);
+
+    // Uncompressing to the wrong size fails.
+    string wrong(input.size() + 1, '\0');
+    EXPECT_FALSE(codec->Uncompress(compressed.data(), compressed.size(),
+                                   string_as_array(&wrong), wrong.size()));
+    if (!input.empty()) {
+      EXPECT_FALSE(codec->Uncompress(compressed.data(), compressed.size(),
+                                     string_as_array(&wrong),
+                                     input.size() - 1));
+    }
+  }
+
+  string run(100000, 'x');
+  string compressed(codec->MaxCompressedSize(run.size()), '\0');
+  EXPECT_LT(codec->Compress(run.data(), run.size(),
+                            string_as_array(&compressed)), 1000);
+}
+
+// Walks the sequences of a FAST_COMPRESSION block, checking that every
+// match starts at least 12 bytes before the end of the uncompressed data and
+// ends at least 5 bytes before it, as LZ4's decoders require.
+void ExpectLz4EndOfBlockRules(const string& compressed, int uncompressed_size) {
+  const uint8* ip = reinterpret_cast<const uint8*>(compressed.data());
+  const uint8* end = ip + compressed.size();
+  int position = 0;
+  while (ip < end) {
+    int token = *ip++;
+    int literal_length = token >> 4;
+    if (literal_length == 15) {
+      while (*ip == 255) literal_length += *ip++;
+      literal_length += *ip++;
+    }
+    ip += literal_length;
+    position += literal_length;
+    if (ip == end) break;  // The last sequence has no match.
+
+    ip += 2;  // The offset.
+    int match_length = token & 0xf;
+    if (match_length == 15) {
+      while (*ip == 255) match_length += *ip++;
+      match_length += *ip++;
+    }
+    match_length += 4;
+    EXPECT_LE(position, uncompressed_size - 12);
+    position += match_length;
+    EXPECT_LE(position, uncompressed_size - 5);
+  }
+  EXPECT_EQ(uncompressed_size, position);
+}
+
+TEST(CompressedStreamTest, FastCodecFollowsLz4EndOfBlockRules) {
+  const Codec* codec = GetCodec(FAST_COMPRESSION);
+  ASSERT_TRUE(codec != NULL);
+
+  // Runs of every length up to well past the limits, so that some would
+  // otherwise end in a match, and text whose last match would run to the
+  // end.
+  vector<string> inputs;
+  for (int size = 0; size <= 40; size++) {
+    inputs.push_back(string(size, 'x'));
+  }
+  inputs.push_back(MakeText(300) + MakeText(300));
+
+  for (int i = 0; i < inputs.size(); i++) {
+    SCOPED_TRACE(testing::Message() << "input " << i);
+    const string& input = inputs[i];
+    string compressed(codec->MaxCompressedSize(input.size()), '\0');
+    compressed.resize(codec->Compress(input.data(), input.size(),
+                                      string_as_array(&compressed)));
+    ExpectLz4EndOfBlockRules(compressed, input.size());
+
+    string output(input.size(), '\0');
+    EXPECT_TRUE(codec->Uncompress(compressed.data(), compressed.size(),
+                                  string_as_array(&output), output.size()));
+    EXPECT_TRUE(output == input);
+  }
+}
+
+// Drops trailing zeros from each block.
+class TrailingZeroCodec : public Codec {
+ public:
+  int MaxCompressedSize(int size) const { return size; }
+  int Compress(const char* input, int size, char* output) const {
+    while (size > 0 && input[size - 1] == '\0') --size;
+    memcpy(output, input, size);
+    return size;
+  }
+  bool Uncompress(const char* input, int size,
+                  char* output, int uncompressed_size) const {
+    if (size > uncompressed_size) return false;
+    memcpy(output, input, size);
+    memset(output + size, 0, uncompressed_size - size);
+    return true;
+  }
+};
+
+TEST(CompressedStreamTest, CustomCodec) {
+  const CompressionType kTrailingZero =
+      static_cast<CompressionType>(FIRST_CUSTOM_COMPRESSION + 1);
+  EXPECT_TRUE(GetCodec(kTrailingZero) == NULL);
+  RegisterCodec(kTrailingZero, new TrailingZeroCodec);
+  EXPECT_TRUE(GetCodec(kTrailingZero) != NULL);
+
+  string data = "abc";
+  data.append(10, '\0');
+  data += "def";
+  data.append(10, '\0');
+  string compressed = Compress(data, kTrailingZero, 13, 13);
+  EXPECT_EQ(kTrailingZero, compressed[3] & 0xff);
+  // The header, two blocks of two sizes, a checksum and three bytes each,
+  // and the end.
+  EXPECT_EQ(4 + 2 * (1 + 1 + 4 + 3) + 1, compressed.size());
+  string result;
+  EXPECT_TRUE(Uncompress(compressed, -1, &result));
+  EXPECT_TRUE(result == data);
+}
+
+// Fails to compress anything.
+class FailingCodec : public Codec {
+ public:
+  int MaxCompressedSize(int size) const { return size; }
+  int Compress(const char* input, int size, char* output) const {
+    return -1;
+  }
+  bool Uncompress(const char* input, int size,
+                  char* output, int uncompressed_size) const {
+    return false;
+  }
+};
+
+TEST(CompressedStreamTest, CompressionFailure) {
+  const CompressionType kFailing =
+      static_cast<CompressionType>(FIRST_CUSTOM_COMPRESSION + 2);
+  RegisterCodec(kFailing, new FailingCodec);
+
+  string compressed;
+  StringOutputStream string_output(&compressed);
+  CompressedOutputStream output(&string_output, kFailing);
+  void* out;
+  int out_size;
+  ASSERT_TRUE(output.Next(&out, &out_size));
+  memset(out, 'x', out_size);
+  EXPECT_FALSE(output.Close());
+  EXPECT_TRUE(output.HadError());
+}
+
+}  // namespace
+}  // namespace io
+}  // namespace protobuf
+}  // namespace google
@@ -0,0 +1,259 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// http://code.google.com/p/protobuf/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm>
+
+#include <google/protobuf/io/delimited_message_stream.h>
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/message_lite.h>
+
+namespace google {
+namespace protobuf {
+namespace io {
+
+namespace {
+
+const int kMaxVarint32Bytes = 5;
+
+const int kDefaultMessageSizeLimit = 64 << 20;  // 64MB
+
+// DelimitedMessageWriter replaces its CodedOutputStream after this many
+// bytes, long before the stream's int byte count could overflow.
+const int kBytesPerCodedOutputStream = 1 << 30;  // 1GB
+
+// Writes a message whose size has been cached, preceded by the size.
+inline void WriteWithCachedSize(const MessageLite& message,
+                                CodedOutputStream* output) {
+  const int size = message.GetCachedSize();
+  output->WriteVarint32(size);
+  uint8* buffer = output->GetDirectBufferForNBytesAndAdvance(size);
+  if (buffer != NULL) {
+    message.SerializeWithCachedSizesToArray(buffer);
+  } else {
+    message.SerializeWithCachedSizes(output);
+  }
+}
+
+}  // namespace
+
+// ===================================================================
+
+DelimitedMessageReader::DelimitedMessageReader(ZeroCopyInputStream* input)
+  : input_(input),
+    message_size_limit_(kDefaultMessageSizeLimit),
+    at_end_(false),
+    message_count_(0),
+    byte_count_(0) {
+  // Each message is limited by message_size_limit_ instead.
+  input_.SetTotalBytesLimit(kint32max, -1);
+}
+
+DelimitedMessageReader::~DelimitedMessageReader() {}
+
+void DelimitedMessageReader::SetMessageSizeLimit(int limit) {
+  // The position of the end of a message must fit in an int.
+  GOOGLE_CHECK_GE(limit, 0);
+  message_size_limit_ = min(limit, kint32max - kMaxVarint32Bytes);
+}
+
+void DelimitedMessageReader::SetRecursionLimit(int limit) {
+  input_.SetRecursionLimit(limit);
+}
+
+int64 DelimitedMessageReader::ByteCount() const {
+  return byte_count_ + input_.CurrentPosition();
+}
+
+bool DelimitedMessageReader::ReadSize(int* size) {
+  at_end_ = false;
+
+  // Count positions from the start of this message, so that they can't
+  // overflow however long the stream is.
+  byte_count_ += input_.CurrentPosition();
+  input_.ResetSizeCounter();
+
+  // The stream ends cleanly only if it ends before a size.
+  const void* data;
+  int buffer_size;
+  if (!input_.GetDirectBufferPointer(&data, &buffer_size)) {
+    at_end_ = true;
+    return false;
+  }
+
+  uint32 value;
+  if (!input_.ReadVarint32(&value)) return false;
+  if (value > static_cast<uint32>(message_size_limit_)) {
+    GOOGLE_LOG(ERROR) << "A delimited message was rejected because it was too "
+                  "big (" << value << " bytes, more than the limit of "
+               << message_size_limit_ << ").  To increase the limit, see "
+                  "DelimitedMessageReader::SetMessageSizeLimit() in "
+                  "google/protobuf/io/delimited_message_stream.h.";
+    return false;
+  }
+  *size = value;
+  return true;
+}
+
+bool DelimitedMessageReader::ParseNext(MessageLite* message) {
+  if (!ParsePartialNext(message)) return false;
+  if (!message->IsInitialized()) {
+    GOOGLE_LOG(ERROR) << "Can't parse message of type \""
+               << message->GetTypeName()
+               << "\" because it is missing required fields: "
+               << message->InitializationErrorString();
+    return false;
+  }
+  return true;
+}
+
+bool DelimitedMessageReader::ParsePartialNext(MessageLite* message) {
+  message->Clear();
+  int size;
+  if (!ReadSize(&size)) return false;
+
+  CodedInputStream::Limit limit = input_.PushLimit(size);
+  // A message which ends early because the input does is also accepted by
+  // MergePartialFromCodedStream(), so the limit must have been reached.
+  bool success = message->MergePartialFromCodedStream(&input_) &&
+                 input_.ConsumedEntireMessage() &&
+                 input_.BytesUntilLimit() == 0;
+  input_.PopLimit(limit);
+
+  if (success) ++message_count_;
+  return success;
+}
+
+bool DelimitedMessageReader::SkipNext() {
+  int size;
+  if (!ReadSize(&size) || !input_.Skip(size)) return false;
+  ++message_count_;
+  return true;
+}
+
+// ===================================================================
+
+DelimitedMessageWriter::DelimitedMessageWriter(ZeroCopyOutputStream* output)
+  : output_(output),
+    had_error_(false),
+    byte_count_(0) {
+}
+
+DelimitedMessageWriter::~DelimitedMessageWriter() {
+  Flush();
+}
+
+CodedOutputStream* DelimitedMessageWriter::coded_output() {
+  if (coded_output_ != NULL &&
+      coded_output_->ByteCount() >= kBytesPerCodedOutputStream) {
+    Flush();
+  }
+  if (coded_output_ == NULL) {
+    coded_output_.reset(new CodedOutputStream(output_));
+  }
+  return coded_output_.get();
+}
+
+bool DelimitedMessageWriter::Write(const MessageLite& message) {
+  GOOGLE_DCHECK(message.IsInitialized())
+      << "Can't serialize message of type \"" << message.GetTypeName()
+      << "\" because it is missing required fields: "
+      << message.InitializationErrorString();
+  return WritePartial(message);
+}
+
+bool DelimitedMessageWriter::WritePartial(const MessageLite& message) {
+  message.ByteSize();  // Force the size to be cached.
+  WriteWithCachedSize(message, coded_output());
+  return !HadError();
+}
+
+bool DelimitedMessageWriter::WriteBatch(const MessageLite* const messages[],
+                                        int count) {
+  // Size the whole batch first.  If it fits in the current buffer, it can
+  // then be written with no further checks for space.
+  int64 total_size = 0;
+  for (int i = 0; i < count; i++) {
+    const MessageLite& message = *messages[i];
+    GOOGLE_DCHECK(message.IsInitialized())
+        << "Can't serialize message of type \"" << message.GetTypeName()
+        << "\" because it is missing required fields: "
+        << message.InitializationErrorString();
+    const int size = message.ByteSize();
+    total_size += CodedOutputStream::VarintSize32(size) + size;
+  }
+
+  CodedOutputStream* output = coded_output();
+  uint8* target = NULL;
+  if (total_size <= kBytesPerCodedOutputStream) {
+    target = output->GetDirectBufferForNBytesAndAdvance(
+        static_cast<int>(total_size));
+  }
+  if (target != NULL) {
+    for (int i = 0; i < count; i++) {
+      target = CodedOutputStream::WriteVarint32ToArray(
+          messages[i]->GetCachedSize(), target);
+      target = messages[i]->SerializeWithCachedSizesToArray(target);
+    }
+  } else {
+    // Like Write(), get the stream for each message, so that a large batch
+    // moves on to a new CodedOutputStream before its byte count overflows.
+    for (int i = 0; i < count; i++) {
+      WriteWithCachedSize(*messages[i], coded_output());
+    }
+  }
+  return !HadError();
+}
+
+bool DelimitedMessageWriter::Flush() {
+  if (coded_output_ != NULL) {
+    // Destroying the CodedOutputStream backs output_ up over whatever is
+    // left of its buffer.
+    if (coded_output_->HadError()) had_error_ = true;
+    byte_count_ += coded_output_->ByteCount();
+    coded_output_.reset();
+  }
+  return !had_error_;
+}
+
+bool DelimitedMessageWriter::HadError() const {
+  return had_error_ ||
+         (coded_output_ != NULL && coded_output_->HadError());
+}
+
+int64 DelimitedMessageWriter::ByteCount() const {
+  int64 result = byte_count_;
+  if (coded_output_ != NULL) result += coded_output_->ByteCount();
+  return result;
+}
+
+}  // namespace io
+}  // namespace protobuf
+}  // namespace google
@@ -0,0 +1,175 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// http://code.google.com/p/protobuf/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Readers and writers for sequences of messages, each preceded by its size
+// as a varint.  This is the usual way to store many messages in one file or
+// stream, and the format used by Java's MessageLite.writeDelimitedTo() and
+// parseDelimitedFrom().  For example:
+//
+//   FileOutputStream file_output(fd);
+//   DelimitedMessageWriter writer(&file_output);
+//   for (...) {
+//     if (!writer.Write(record)) return false;
+//   }
+//   if (!writer.Flush()) return false;
+//
+//   FileInputStream file_input(fd);
+//   DelimitedMessageReader reader(&file_input);
+//   while (reader.ParseNext(&record)) {
+//     Process(record);
+//   }
+//   if (!reader.AtEnd()) HandleCorruptInput();
+//
+// Unlike a CodedInputStream used directly, a reader applies its size limit
+// to each message rather than to the stream as a whole, so a stream may be
+// any length.  It keeps one CodedInputStream, and so one buffer, for the
+// whole stream rather than building one per message.
+
+#ifndef GOOGLE_PROTOBUF_IO_DELIMITED_MESSAGE_STREAM_H__
+#define GOOGLE_PROTOBUF_IO_DELIMITED_MESSAGE_STREAM_H__
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/io/coded_stream.h>
+
+namespace google {
+namespace protobuf {
+  class MessageLite;             // message_lite.h
+
+namespace io {
+  class ZeroCopyInputStream;     // zero_copy_stream.h
+  class ZeroCopyOutputStream;    // zero_copy_stream.h
+
+// Reads size-delimited messages from a ZeroCopyInputStream.
+class LIBPROTOBUF_EXPORT DelimitedMessageReader {
+ public:
+  // The input must remain valid until the reader is destroyed, which backs
+  // it up to just past the last message read.
+  explicit DelimitedMessageReader(ZeroCopyInputStream* input);
+  ~DelimitedMessageReader();
+
+  // Sets the largest message size ParseNext() and SkipNext() accept.  A
+  // larger size is treated as corrupt input.  The default is 64MB, the same
+  // as CodedInputStream's total bytes limit.
+  void SetMessageSizeLimit(int limit);
+
+  // Sets the recursion limit for each message; see
+  // CodedInputStream::SetRecursionLimit().
+  void SetRecursionLimit(int limit);
+
+  // Clears *message and parses the next message into it.  Returns false if
+  // there are no more messages, if the input is corrupt, or if the message
+  // is missing required fields (after logging an error, as
+  // MessageLite::ParseFromCodedStream() does).  AtEnd() tells the first case
+  // from the others.
+  bool ParseNext(MessageLite* message);
+
+  // Like ParseNext(), but accepts a message which is missing required fields.
+  bool ParsePartialNext(MessageLite* message);
+
+  // Steps over the next message without parsing it.  Returns false if there
+  // are no more messages or the input is corrupt.
+  bool SkipNext();
+
+  // Returns true if the last call to ParseNext(), ParsePartialNext() or
+  // SkipNext() returned false because the input ended cleanly, after the
+  // last message.
+  bool AtEnd() const { return at_end_; }
+
+  // The number of messages read or skipped so far.
+  int64 MessageCount() const { return message_count_; }
+
+  // The number of bytes read from the input so far, through the end of the
+  // last message.
+  int64 ByteCount() const;
+
+ private:
+  // Reads the size of the next message, setting at_end_ if there is none.
+  bool ReadSize(int* size);
+
+  CodedInputStream input_;
+  int message_size_limit_;
+  bool at_end_;
+  int64 message_count_;
+  int64 byte_count_;  // Bytes read before the last ResetSizeCounter().
+
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(DelimitedMessageReader);
+};
+
+// Writes size-delimited messages to a ZeroCopyOutputStream.  Messages are
+// serialized straight into the stream's buffers; a message which does not
+// fit in what is left of the current buffer is serialized across buffers.
+class LIBPROTOBUF_EXPORT DelimitedMessageWriter {
+ public:
+  // The output must remain valid until the writer is destroyed.
+  explicit DelimitedMessageWriter(ZeroCopyOutputStream* output);
+  // Calls Flush().
+  ~DelimitedMessageWriter();
+
+  // Writes the message's size and then the message.  The message must be
+  // initialized; see MessageLite::SerializeToCodedStream().  Returns false
+  // if the output failed, in which case this and later writes are lost.
+  bool Write(const MessageLite& message);
+
+  // Like Write(), but allows missing required fields.
+  bool WritePartial(const MessageLite& message);
+
+  // Writes count messages, one after the other, as if by Write().
+  bool WriteBatch(const MessageLite* const messages[], int count);
+
+  // Hands everything written so far to the output, backing up over any
+  // unused part of its last buffer, so that the output may be flushed or
+  // closed.  Writing may continue afterwards.  Returns false if the output
+  // has failed.
+  bool Flush();
+
+  // True if the output has failed.
+  bool HadError() const;
+
+  // The number of bytes written so far.
+  int64 ByteCount() const;
+
+ private:
+  // Returns the CodedOutputStream to write with, replacing it from time to
+  // time so that its byte count can't overflow.
+  CodedOutputStream* coded_output();
+
+  ZeroCopyOutputStream* output_;
+  scoped_ptr<CodedOutputStream> coded_output_;  // NULL after Flush().
+  bool had_error_;    // True if a CodedOutputStream already destroyed failed.
+  int64 byte_count_;  // Bytes written with CodedOutputStreams destroyed.
+
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(DelimitedMessageWriter);
+};
+
+}  // namespace io
+}  // namespace protobuf
+
+}  // namespace google
+#endif  // GOOGLE_PROTOBUF_IO_DELIMITED_MESSAGE_STREAM_H__
@@ -0,0 +1,286 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// http://code.google.com/p/protobuf/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <google/protobuf/io/delimited_message_stream.h>
+
+#include <string>
+#include <vector>
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl.h>
+#include <google/protobuf/stubs/stl_util-inl.h>
+#include <google/protobuf/test_util.h>
+#include <google/protobuf/unittest.pb.h>
+#include <google/protobuf/testing/googletest.h>
+#include <gtest/gtest.h>
+
+namespace google {
+namespace protobuf {
+namespace io {
+namespace {
+
+// Writes the messages with a DelimitedMessageWriter.
+string WriteDelimited(const vector<const MessageLite*>& messages,
+                      int block_size) {
+  string data(messages.size() * 1024, '\0');
+  ArrayOutputStream output(string_as_array(&data), data.size(), block_size);
+  {
+    DelimitedMessageWriter writer(&output);
+    for (int i = 0; i < messages.size(); i++) {
+      EXPECT_TRUE(writer.Write(*messages[i]));
+    }
+    EXPECT_TRUE(writer.Flush());
+    EXPECT_EQ(output.ByteCount(), writer.ByteCount());
+  }
+  data.resize(output.ByteCount());
+  return data;
+}
+
+// Writes the messages the way one would by hand.
+string WriteDelimitedByHand(const vector<const MessageLite*>& messages) {
+  string data;
+  {
+    StringOutputStream output(&data);
+    CodedOutputStream coded_output(&output);
+    for (int i = 0; i < messages.size(); i++) {
+      coded_output.WriteVarint32(messages[i]->ByteSize());
+      messages[i]->SerializeWithCachedSizes(&coded_output);
+    }
+  }
+  return data;
+}
+
+class DelimitedMessageStreamTest : public testing::Test {
+ protected:
+  virtual void SetUp() {
+    TestUtil::SetAllFields(&all_types_);
+    packed_.add_packed_int32(-1);
+    packed_.add_packed_int32(12345);
+    // empty_ is empty, so it is written as just a zero size.
+
+    messages_.push_back(&all_types_);
+    messages_.push_back(&empty_);
+    messages_.push_back(&packed_);
+    messages_.push_back(&all_types_);
+  }
+
+  unittest::TestAllTypes all_types_;
+  unittest::TestAllTypes empty_;
+  unittest::TestPackedTypes packed_;
+  vector<const MessageLite*> messages_;
+};
+
+const int kBlockSizes[] = {-1, 1, 2, 3, 5, 7, 13, 32, 1024};
+
+TEST_F(DelimitedMessageStreamTest, WriteMatchesHandWritten) {
+  string expected = WriteDelimitedByHand(messages_);
+  for (int i = 0; i < GOOGLE_ARRAYSIZE(kBlockSizes); i++) {
+    SCOPED_TRACE(kBlockSizes[i]);
+    EXPECT_TRUE(WriteDelimited(messages_, kBlockSizes[i]) == expected);
+  }
+}
+
+TEST_F(DelimitedMessageStreamTest, WriteBatch) {
+  string expected = WriteDelimitedByHand(messages_);
+  for (int i = 0; i < GOOGLE_ARRAYSIZE(kBlockSizes); i++) {
+    SCOPED_TRACE(kBlockSizes[i]);
+    string data(expected.size() + 100, '\0');
+    ArrayOutputStream output(string_as_array(&data), data.size(),
+                             kBlockSizes[i]);
+    {
+      DelimitedMessageWriter writer(&output);
+      // Twice, so that the second batch starts part way through a buffer.
+      EXPECT_TRUE(writer.WriteBatch(&messages_[0], 2));
+      EXPECT_TRUE(writer.WriteBatch(&messages_[2], messages_.size() - 2));
+    }
+    data.resize(output.ByteCount());
+    EXPECT_TRUE(data == expected);
+  }
+}
+
+TEST_F(DelimitedMessageStreamTest, ParseNext) {
+  string data = WriteDelimitedByHand(messages_);
+  for (int i = 0; i < GOOGLE_ARRAYSIZE(kBlockSizes); i++) {
+    SCOPED_TRACE(kBlockSizes[i]);
+    ArrayInputStream input(data.data(), data.size(), kBlockSizes[i]);
+    DelimitedMessageReader reader(&input);
+
+    unittest::TestAllTypes message;
+    unittest::TestPackedTypes packed;
+    ASSERT_TRUE(reader.ParseNext(&message));
+    TestUtil::ExpectAllFieldsSet(message);
+    ASSERT_TRUE(reader.ParseNext(&message));
+    EXPECT_EQ(0, message.ByteSize());
+    ASSERT_TRUE(reader.ParseNext(&packed));
+    EXPECT_EQ(packed_.SerializeAsString(), packed.SerializeAsString());
+    ASSERT_TRUE(reader.ParseNext(&message));
+    TestUtil::ExpectAllFieldsSet(message);
+
+    EXPECT_EQ(4, reader.MessageCount());
+    EXPECT_EQ(data.size(), reader.ByteCount());
+    EXPECT_FALSE(reader.AtEnd());
+    EXPECT_FALSE(reader.ParseNext(&message));
+    EXPECT_TRUE(reader.AtEnd());
+    EXPECT_EQ(0, message.ByteSize());
+  }
+}
+
+TEST_F(DelimitedMessageStreamTest, SkipNext) {
+  string data = WriteDelimitedByHand(messages_);
+  for (int i = 0; i < GOOGLE_ARRAYSIZE(kBlockSizes); i++) {
+    SCOPED_TRACE(kBlockSizes[i]);
+    ArrayInputStream input(data.data(), data.size(), kBlockSizes[i]);
+    DelimitedMessageReader reader(&input);
+
+    unittest::TestPackedTypes packed;
+    EXPECT_TRUE(reader.SkipNext());
+    EXPECT_TRUE(reader.SkipNext());
+    ASSERT_TRUE(reader.ParseNext(&packed));
+    EXPECT_EQ(packed_.SerializeAsString(), packed.SerializeAsString());
+    EXPECT_TRUE(reader.SkipNext());
+    EXPECT_FALSE(reader.SkipNext());
+    EXPECT_TRUE(reader.AtEnd());
+    EXPECT_EQ(4, reader.MessageCount());
+  }
+}
+
+TEST_F(DelimitedMessageStreamTest, Truncated) {
+  string data = WriteDelimitedByHand(messages_);
+  unittest::TestAllTypes message;
+
+  // Cut off part way through the first message, and then part way through
+  // its size.
+  for (int size = data.size() - 1; size > 0; size = size * 3 / 4) {
+    if (size > all_types_.ByteSize()) continue;
+    SCOPED_TRACE(size);
+    ArrayInputStream input(data.data(), size);
+    DelimitedMessageReader reader(&input);
+    EXPECT_FALSE(reader.ParseNext(&message));
+    EXPECT_FALSE(reader.AtEnd());
+  }
+
+  // A size with nothing after it.
+  ArrayInputStream input("\x05", 1);
+  DelimitedMessageReader reader(&input);
+  EXPECT_FALSE(reader.SkipNext());
+  EXPECT_FALSE(reader.AtEnd());
+}
+
+TEST_F(DelimitedMessageStreamTest, MessageSizeLimit) {
+  string data = WriteDelimitedByHand(messages_);
+  ArrayInputStream input(data.data(), data.size());
+  DelimitedMessageReader reader(&input);
+  reader.SetMessageSizeLimit(all_types_.ByteSize() - 1);
+
+  unittest::TestAllTypes message;
+  vector<string> errors;
+  {
+    ScopedMemoryLog error_log;
+    EXPECT_FALSE(reader.ParseNext(&message));
+    errors = error_log.GetMessages(ERROR);
+  }
+  ASSERT_EQ(1, errors.size());
+  EXPECT_PRED_FORMAT2(testing::IsSubstring,
+    "A delimited message was rejected because it was too big", errors[0]);
+  EXPECT_FALSE(reader.AtEnd());
+}
+
+TEST_F(DelimitedMessageStreamTest, LimitIsPerMessage) {
+  // Many messages which together exceed the limit.
+  vector<const MessageLite*> messages(100, &all_types_);
+  string data = WriteDelimitedByHand(messages);
+
+  ArrayInputStream input(data.data(), data.size(), 7);
+  DelimitedMessageReader reader(&input);
+  reader.SetMessageSizeLimit(all_types_.ByteSize());
+
+  unittest::TestAllTypes message;
+  while (reader.ParseNext(&message)) {
+    TestUtil::ExpectAllFieldsSet(message);
+  }
+  EXPECT_TRUE(reader.AtEnd());
+  EXPECT_EQ(100, reader.MessageCount());
+  EXPECT_EQ(data.size(), reader.ByteCount());
+}
+
+TEST_F(DelimitedMessageStreamTest, RequiredFields) {
+  unittest::TestRequired partial;
+  partial.set_a(1);
+  vector<const MessageLite*> messages(2, &partial);
+  string data = WriteDelimitedByHand(messages);
+
+  ArrayInputStream input(data.data(), data.size());
+  DelimitedMessageReader reader(&input);
+
+  unittest::TestRequired message;
+  vector<string> errors;
+  {
+    ScopedMemoryLog error_log;
+    EXPECT_FALSE(reader.ParseNext(&message));
+    errors = error_log.GetMessages(ERROR);
+  }
+  ASSERT_EQ(1, errors.size());
+  EXPECT_PRED_FORMAT2(testing::IsSubstring,
+    "missing required fields", errors[0]);
+
+  // The reader is still positioned after the message.
+  EXPECT_TRUE(reader.ParsePartialNext(&message));
+  EXPECT_EQ(1, message.a());
+  EXPECT_FALSE(reader.ParsePartialNext(&message));
+  EXPECT_TRUE(reader.AtEnd());
+}
+
+TEST_F(DelimitedMessageStreamTest, ReaderBacksUpInput) {
+  string data = WriteDelimitedByHand(messages_);
+  data += "trailer";
+  ArrayInputStream input(data.data(), data.size());
+  {
+    DelimitedMessageReader reader(&input);
+    for (int i = 0; i < messages_.size(); i++) {
+      EXPECT_TRUE(reader.SkipNext());
+    }
+  }
+  EXPECT_EQ(data.size() - strlen("trailer"), input.ByteCount());
+}
+
+TEST_F(DelimitedMessageStreamTest, WriteError) {
+  char buffer[16];
+  ArrayOutputStream output(buffer, sizeof(buffer));
+  DelimitedMessageWriter writer(&output);
+  EXPECT_FALSE(writer.Write(all_types_));
+  EXPECT_TRUE(writer.HadError());
+  EXPECT_FALSE(writer.Flush());
+}
+
+}  // namespace
+}  // namespace io
+}  // namespace protobuf
+}  // namespace google
@@ -38,7 +38,16 @@
 #if HAVE_ZLIB
 #include <google/protobuf/io/gzip_stream.h>
 
+#if defined(HAVE_PTHREAD) && !defined(_WIN32)
+#include <pthread.h>
+#endif
+#include <string.h>
+#include <deque>
+#include <string>
+#include <vector>
+
 #include <google/protobuf/stubs/common.h>
+#include <google/protobuf/stubs/stl_util-inl.h>
 
 namespace google {
 namespace protobuf {
@@ -73,6 +82,22 @@ GzipInputStream::~GzipInputStream() {
   zerror_ = inflateEnd(&zcontext_);
 }
 
+void GzipInputStream::Reset(ZeroCopyInputStream* sub_stream) {
+  sub_stream_ = sub_stream;
+  zerror_ = Z_OK;
+  if (zcontext_.next_in != NULL) {
+    // Inflate() has initialized zcontext_, so we only need to reset it.  It
+    // takes a NULL next_in to mean that it hasn't, so leave that pointing
+    // somewhere.
+    zerror_ = inflateReset(&zcontext_);
+    zcontext_.next_in = static_cast<Bytef*>(output_buffer_);
+  }
+  zcontext_.avail_in = 0;
+  zcontext_.next_out = static_cast<Bytef*>(output_buffer_);
+  zcontext_.avail_out = output_buffer_length_;
+  output_position_ = output_buffer_;
+}
+
 int GzipInputStream::Inflate(int flush) {
   if ((zerror_ == Z_OK) && (zcontext_.avail_out == 0)) {
     // previous inflate filled output buffer. don't change input params yet.
@@ -172,7 +197,467 @@ GzipOutputStream::Options::Options()
     : format(GZIP),
       buffer_size(kDefaultBufferSize),
       compression_level(Z_DEFAULT_COMPRESSION),
-      compression_strategy(Z_DEFAULT_STRATEGY) {}
+      compression_strategy(Z_DEFAULT_STRATEGY),
+      threads(1) {}
+
+// -------------------------------------------------------------------------
+
+namespace {
+
+// How far back deflate can refer, and so how much of each block is worth
+// priming the next one's compressor with.
+const int kMaxDictionarySize = 32768;
+
+}  // namespace
+
+class GzipOutputStream::ParallelDeflater {
+ public:
+  explicit ParallelDeflater(const Options& options);
+  ~ParallelDeflater();
+
+  void Reset(ZeroCopyOutputStream* sub_stream);
+
+  // These mirror GzipOutputStream's methods, but return zlib error codes.
+  int Next(void** data, int* size);
+  void BackUp(int count);
+  int64 ByteCount() const;
+  int Flush();
+  int Close();
+
+ private:
+  // A buffer_size chunk of the input and what it compresses to.
+  struct Block {
+    char* input;
+    int input_size;
+    // The end of the previous block's input, which the compressor is primed
+    // with, or NULL.
+    const char* dictionary;
+    int dictionary_size;
+    // Whether this is the final block of the stream.
+    bool last;
+
+    // Set by Compress().
+    string output;
+    uLong check;  // The crc32 or adler32 of the input.
+    int error;
+    bool done;    // Guarded by mutex_ when there are workers.
+  };
+
+  // Compresses a block as a raw deflate stream, which ends byte-aligned so
+  // that its output can just be appended to the previous block's.
+  void Compress(Block* block, z_stream* stream);
+  // Hands current_ over to be compressed.
+  void Submit(bool last);
+  // Waits for the given block to be compressed.
+  void Wait(Block* block);
+  // Waits for the oldest pending block and writes it to sub_stream_.
+  int WriteOldest();
+  bool WriteRaw(const void* data, int size);
+  bool InitStream(z_stream* stream);
+  Block* NewBlock();
+
+  const Format format_;
+  const int buffer_size_;
+  const int compression_level_;
+  const int compression_strategy_;
+
+  ZeroCopyOutputStream* sub_stream_;
+  bool header_written_;
+  uLong check_;           // Of everything written so far.
+  int64 byte_count_;      // Total input size of the submitted blocks.
+
+  // The block being filled through Next(), or NULL.
+  Block* current_;
+  // The block submitted most recently, whose input primes the next one.
+  Block* last_submitted_;
+  // Blocks which have been submitted but not yet written, oldest first.
+  deque<Block*> pending_;
+  int max_pending_;
+  // The block written most recently.  Its input is kept until the block
+  // after it has been compressed.
+  Block* retired_;
+  vector<Block*> free_blocks_;
+
+  // Compresses blocks on the calling thread when there are no workers.
+  z_stream stream_;
+
+#if defined(HAVE_PTHREAD) && !defined(_WIN32)
+  static void* WorkerMain(void* arg);
+  void Work();
+
+  vector<pthread_t> workers_;
+  pthread_mutex_t mutex_;
+  pthread_cond_t work_available_;
+  pthread_cond_t work_done_;
+  deque<Block*> work_queue_;  // Guarded by mutex_.
+  bool stopping_;             // Guarded by mutex_.
+#endif
+
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(ParallelDeflater);
+};
+
+GzipOutputStream::ParallelDeflater::ParallelDeflater(const Options& options)
+    : format_(options.format),
+      buffer_size_(options.buffer_size),
+      compression_level_(options.compression_level),
+      compression_strategy_(options.compression_strategy),
+      sub_stream_(NULL),
+      header_written_(false),
+      check_(0),
+      byte_count_(0),
+      current_(NULL),
+      last_submitted_(NULL),
+      max_pending_(2 * options.threads),
+      retired_(NULL) {
+  GOOGLE_CHECK_GT(buffer_size_, 0);
+  memset(&stream_, 0, sizeof(stream_));
+#if defined(HAVE_PTHREAD) && !defined(_WIN32)
+  pthread_mutex_init(&mutex_, NULL);
+  pthread_cond_init(&work_available_, NULL);
+  pthread_cond_init(&work_done_, NULL);
+  stopping_ = false;
+  for (int i = 0; i < options.threads; i++) {
+    pthread_t thread;
+    if (pthread_create(&thread, NULL, &WorkerMain, this) != 0) break;
+    workers_.push_back(thread);
+  }
+  if (!workers_.empty()) return;
+#endif
+  InitStream(&stream_);
+}
+
+GzipOutputStream::ParallelDeflater::~ParallelDeflater() {
+#if defined(HAVE_PTHREAD) && !defined(_WIN32)
+  // The workers finish whatever is queued before they stop.
+  pthread_mutex_lock(&mutex_);
+  stopping_ = true;
+  pthread_cond_broadcast(&work_available_);
+  pthread_mutex_unlock(&mutex_);
+  for (int i = 0; i < workers_.size(); i++) {
+    pthread_join(workers_[i], NULL);
+  }
+  pthread_cond_destroy(&work_done_);
+  pthread_cond_destroy(&work_available_);
+  pthread_mutex_destroy(&mutex_);
+#endif
+  deflateEnd(&stream_);
+
+  if (current_ != NULL) free_blocks_.push_back(current_);
+  if (retired_ != NULL) free_blocks_.push_back(retired_);
+  free_blocks_.insert(free_blocks_.end(), pending_.begin(), pending_.end());
+  for (int i = 0; i < free_blocks_.size(); i++) {
+    delete [] free_blocks_[i]->input;
+    delete free_blocks_[i];
+  }
+}
+
+bool GzipOutputStream::ParallelDeflater::InitStream(z_stream* stream) {
+  memset(stream, 0, sizeof(*stream));
+  // Negative windowBits produce raw deflate data, without a header or
+  // trailer; we write those ourselves.
+  return deflateInit2(stream, compression_level_, Z_DEFLATED,
+                      /* windowBits */-15, /* memLevel (default) */8,
+                      compression_strategy_) == Z_OK;
+}
+
+#if defined(HAVE_PTHREAD) && !defined(_WIN32)
+void* GzipOutputStream::ParallelDeflater::WorkerMain(void* arg) {
+  reinterpret_cast<ParallelDeflater*>(arg)->Work();
+  return NULL;
+}
+
+void GzipOutputStream::ParallelDeflater::Work() {
+  z_stream stream;
+  bool initialized = InitStream(&stream);
+
+  pthread_mutex_lock(&mutex_);
+  while (true) {
+    while (work_queue_.empty() && !stopping_) {
+      pthread_cond_wait(&work_available_, &mutex_);
+    }
+    if (work_queue_.empty()) break;
+    Block* block = work_queue_.front();
+    work_queue_.pop_front();
+    pthread_mutex_unlock(&mutex_);
+
+    if (initialized) {
+      Compress(block, &stream);
+    } else {
+      block->error = Z_MEM_ERROR;
+    }
+
+    pthread_mutex_lock(&mutex_);
+    block->done = true;
+    pthread_cond_broadcast(&work_done_);
+  }
+  pthread_mutex_unlock(&mutex_);
+
+  if (initialized) deflateEnd(&stream);
+}
+#endif
+
+void GzipOutputStream::ParallelDeflater::Compress(
+    Block* block, z_stream* stream) {
+  block->error = deflateReset(stream);
+  if (block->error == Z_OK && block->dictionary_size > 0) {
+    block->error = deflateSetDictionary(
+        stream, reinterpret_cast<const Bytef*>(block->dictionary),
+        block->dictionary_size);
+  }
+  if (block->error != Z_OK) return;
+
+  // deflateBound() allows for Z_FINISH; a sync flush adds a few bytes more.
+  block->output.resize(deflateBound(stream, block->input_size) + 16);
+  stream->next_in = reinterpret_cast<Bytef*>(block->input);
+  stream->avail_in = block->input_size;
+  stream->next_out = reinterpret_cast<Bytef*>(string_as_array(&block->output));
+  stream->avail_out = block->output.size();
+
+  // Z_SYNC_FLUSH ends the block's data on a byte boundary without marking
+  // it as the end of the stream.
+  int flush = block->last ? Z_FINISH : Z_SYNC_FLUSH;
+  while (true) {
+    int error = deflate(stream, flush);
+    if (error == Z_STREAM_END ||
+        (flush == Z_SYNC_FLUSH && error == Z_OK && stream->avail_out > 0)) {
+      break;
+    }
+    if (error != Z_OK && error != Z_BUF_ERROR) {
+      block->error = error;
+      return;
+    }
+    // Out of room; shouldn't happen, given deflateBound().
+    int used = block->output.size() - stream->avail_out;
+    block->output.resize(block->output.size() * 2);
+    stream->next_out =
+        reinterpret_cast<Bytef*>(string_as_array(&block->output)) + used;
+    stream->avail_out = block->output.size() - used;
+  }
+  block->output.resize(block->output.size() - stream->avail_out);
+
+  const Bytef* input = reinterpret_cast<const Bytef*>(block->input);
+  if (format_ == ZLIB) {
+    block->check = adler32(adler32(0, Z_NULL, 0), input, block->input_size);
+  } else {
+    block->check = crc32(crc32(0, Z_NULL, 0), input, block->input_size);
+  }
+}
+
+GzipOutputStream::ParallelDeflater::Block*
+GzipOutputStream::ParallelDeflater::NewBlock() {
+  Block* block;
+  if (free_blocks_.empty()) {
+    block = new Block;
+    block->input = new char[buffer_size_];
+  } else {
+    block = free_blocks_.back();
+    free_blocks_.pop_back();
+  }
+  block->input_size = 0;
+  return block;
+}
+
+void GzipOutputStream::ParallelDeflater::Submit(bool last) {
+  if (current_ == NULL) current_ = NewBlock();
+  Block* block = current_;
+  current_ = NULL;
+
+  block->last = last;
+  block->error = Z_OK;
+  block->done = false;
+  if (last_submitted_ != NULL) {
+    block->dictionary_size =
+        min(last_submitted_->input_size, kMaxDictionarySize);
+    block->dictionary = last_submitted_->input +
+        last_submitted_->input_size - block->dictionary_size;
+  } else {
+    block->dictionary = NULL;
+    block->dictionary_size = 0;
+  }
+  last_submitted_ = block;
+  byte_count_ += block->input_size;
+  pending_.push_back(block);
+
+#if defined(HAVE_PTHREAD) && !defined(_WIN32)
+  if (!workers_.empty()) {
+    pthread_mutex_lock(&mutex_);
+    work_queue_.push_back(block);
+    pthread_cond_signal(&work_available_);
+    pthread_mutex_unlock(&mutex_);
+    return;
+  }
+#endif
+  Compress(block, &stream_);
+  block->done = true;
+}
+
+void GzipOutputStream::ParallelDeflater::Wait(Block* block) {
+#if defined(HAVE_PTHREAD) && !defined(_WIN32)
+  if (!workers_.empty()) {
+    pthread_mutex_lock(&mutex_);
+    while (!block->done) {
+      pthread_cond_wait(&work_done_, &mutex_);
+    }
+    pthread_mutex_unlock(&mutex_);
+  }
+#endif
+  GOOGLE_DCHECK(block->done);
+}
+
+bool GzipOutputStream::ParallelDeflater::WriteRaw(const void* data,
+                                                  int size) {
+  const uint8* in = reinterpret_cast<const uint8*>(data);
+  while (size > 0) {
+    void* out;
+    int out_size;
+    if (!sub_stream_->Next(&out, &out_size)) return false;
+    if (out_size >= size) {
+      memcpy(out, in, size);
+      sub_stream_->BackUp(out_size - size);
+      return true;
+    }
+    memcpy(out, in, out_size);
+    in += out_size;
+    size -= out_size;
+  }
+  return true;
+}
+
+int GzipOutputStream::ParallelDeflater::WriteOldest() {
+  Block* block = pending_.front();
+  Wait(block);
+  pending_.pop_front();
+
+  // The previously-written block's input was the dictionary for this one,
+  // and isn't needed any more.
+  if (retired_ != NULL) free_blocks_.push_back(retired_);
+  retired_ = block;
+
+  if (block->error != Z_OK) return block->error;
+
+  if (!header_written_) {
+    if (format_ == ZLIB) {
+      // See RFC 1950.  The level bits are informational only.
+      uint8 header[2] = { 0x78, 0 };
+      if (compression_level_ == Z_DEFAULT_COMPRESSION) {
+        header[1] = 2 << 6;
+      } else if (compression_level_ < 2 ||
+                 compression_strategy_ >= Z_HUFFMAN_ONLY) {
+        header[1] = 0 << 6;
+      } else if (compression_level_ < 6) {
+        header[1] = 1 << 6;
+      } else if (compression_level_ == 6) {
+        header[1] = 2 << 6;
+      } else {
+        header[1] = 3 << 6;
+      }
+      header[1] += 31 - (header[0] * 256 + header[1]) % 31;
+      if (!WriteRaw(header, sizeof(header))) return Z_BUF_ERROR;
+      check_ = adler32(0, Z_NULL, 0);
+    } else {
+      // See RFC 1952.  No file name or modification time, and an OS of
+      // "unknown".
+      static const uint8 kHeader[10] = {
+        0x1f, 0x8b, Z_DEFLATED, 0, 0, 0, 0, 0, 0, 0xff
+      };
+      if (!WriteRaw(kHeader, sizeof(kHeader))) return Z_BUF_ERROR;
+      check_ = crc32(0, Z_NULL, 0);
+    }
+    header_written_ = true;
+  }
+
+  if (!WriteRaw(block->output.data(), block->output.size())) {
+    return Z_BUF_ERROR;
+  }
+  if (format_ == ZLIB) {
+    check_ = adler32_combine(check_, block->check, block->input_size);
+  } else {
+    check_ = crc32_combine(check_, block->check, block->input_size);
+  }
+
+  if (block->last) {
+    uint8 trailer[8];
+    int trailer_size;
+    if (format_ == ZLIB) {
+      // The adler32, big-endian.
+      for (int i = 0; i < 4; i++) {
+        trailer[i] = static_cast<uint8>(check_ >> (24 - 8 * i));
+      }
+      trailer_size = 4;
+    } else {
+      // The crc32 and the input size modulo 2^32, little-endian.
+      for (int i = 0; i < 4; i++) {
+        trailer[i] = static_cast<uint8>(check_ >> (8 * i));
+        trailer[4 + i] = static_cast<uint8>(byte_count_ >> (8 * i));
+      }
+      trailer_size = 8;
+    }
+    if (!WriteRaw(trailer, trailer_size)) return Z_BUF_ERROR;
+  }
+  return Z_OK;
+}
+
+void GzipOutputStream::ParallelDeflater::Reset(
+    ZeroCopyOutputStream* sub_stream) {
+  // Throw away anything left over from the previous stream.
+  while (!pending_.empty()) {
+    Wait(pending_.front());
+    free_blocks_.push_back(pending_.front());
+    pending_.pop_front();
+  }
+  if (current_ != NULL) current_->input_size = 0;
+
+  sub_stream_ = sub_stream;
+  header_written_ = false;
+  byte_count_ = 0;
+  last_submitted_ = NULL;
+}
+
+int GzipOutputStream::ParallelDeflater::Next(void** data, int* size) {
+  if (current_ == NULL || current_->input_size == buffer_size_) {
+    if (current_ != NULL) Submit(false);
+    // Don't let the compressors get too far ahead of the writing.
+    while (pending_.size() >= max_pending_) {
+      int error = WriteOldest();
+      if (error != Z_OK) return error;
+    }
+    current_ = NewBlock();
+  }
+  *data = current_->input + current_->input_size;
+  *size = buffer_size_ - current_->input_size;
+  current_->input_size = buffer_size_;
+  return Z_OK;
+}
+
+void GzipOutputStream::ParallelDeflater::BackUp(int count) {
+  GOOGLE_CHECK(current_ != NULL);
+  GOOGLE_CHECK_GE(current_->input_size, count);
+  current_->input_size -= count;
+}
+
+int64 GzipOutputStream::ParallelDeflater::ByteCount() const {
+  return byte_count_ + (current_ == NULL ? 0 : current_->input_size);
+}
+
+int GzipOutputStream::ParallelDeflater::Flush() {
+  if (current_ != NULL && current_->input_size > 0) Submit(false);
+  while (!pending_.empty()) {
+    int error = WriteOldest();
+    if (error != Z_OK) return error;
+  }
+  return Z_OK;
+}
+
+int GzipOutputStream::ParallelDeflater::Close() {
+  Submit(true);
+  while (!pending_.empty()) {
+    int error = WriteOldest();
+    if (error != Z_OK) return error;
+  }
+  return Z_OK;
+}
+
+// -------------------------------------------------------------------------
 
 GzipOutputStream::GzipOutputStream(ZeroCopyOutputStream* sub_stream) {
   Init(sub_stream, Options());
@@ -198,10 +683,7 @@ void GzipOutputStream::Init(ZeroCopyOutputStream* sub_stream,
   sub_stream_ = sub_stream;
   sub_data_ = NULL;
   sub_data_size_ = 0;
-
-  input_buffer_length_ = options.buffer_size;
-  input_buffer_ = operator new(input_buffer_length_);
-  GOOGLE_CHECK(input_buffer_ != NULL);
+  parallel_ = NULL;
 
   zcontext_.zalloc = Z_NULL;
   zcontext_.zfree = Z_NULL;
@@ -213,6 +695,20 @@ void GzipOutputStream::Init(ZeroCopyOutputStream* sub_stream,
   zcontext_.avail_in = 0;
   zcontext_.total_in = 0;
   zcontext_.msg = NULL;
+
+  if (options.threads > 1) {
+    input_buffer_ = NULL;
+    input_buffer_length_ = 0;
+    parallel_ = new ParallelDeflater(options);
+    parallel_->Reset(sub_stream);
+    zerror_ = Z_OK;
+    return;
+  }
+
+  input_buffer_length_ = options.buffer_size;
+  input_buffer_ = operator new(input_buffer_length_);
+  GOOGLE_CHECK(input_buffer_ != NULL);
+
   // default to GZIP format
   int windowBitsFormat = 16;
   if (options.format == ZLIB) {
@@ -229,11 +725,32 @@ void GzipOutputStream::Init(ZeroCopyOutputStream* sub_stream,
 
 GzipOutputStream::~GzipOutputStream() {
   Close();
+  if (parallel_ != NULL) {
+    delete parallel_;
+  } else {
+    deflateEnd(&zcontext_);
+  }
   if (input_buffer_ != NULL) {
     operator delete(input_buffer_);
   }
 }
 
+void GzipOutputStream::Reset(ZeroCopyOutputStream* sub_stream) {
+  if (parallel_ != NULL) {
+    parallel_->Reset(sub_stream);
+    zerror_ = Z_OK;
+    return;
+  }
+  sub_stream_ = sub_stream;
+  sub_data_ = NULL;
+  sub_data_size_ = 0;
+  zcontext_.next_out = NULL;
+  zcontext_.avail_out = 0;
+  zcontext_.next_in = NULL;
+  zcontext_.avail_in = 0;
+  zerror_ = deflateReset(&zcontext_);
+}
+
 // private
 int GzipOutputStream::Deflate(int flush) {
   int error = Z_OK;
@@ -267,6 +784,10 @@ bool GzipOutputStream::Next(void** data, int* size) {
   if ((zerror_ != Z_OK) && (zerror_ != Z_BUF_ERROR)) {
     return false;
   }
+  if (parallel_ != NULL) {
+    zerror_ = parallel_->Next(data, size);
+    return zerror_ == Z_OK;
+  }
   if (zcontext_.avail_in != 0) {
     zerror_ = Deflate(Z_NO_FLUSH);
     if (zerror_ != Z_OK) {
@@ -286,14 +807,26 @@ bool GzipOutputStream::Next(void** data, int* size) {
   return true;
 }
 void GzipOutputStream::BackUp(int count) {
+  if (parallel_ != NULL) {
+    parallel_->BackUp(count);
+    return;
+  }
   GOOGLE_CHECK_GE(zcontext_.avail_in, count);
   zcontext_.avail_in -= count;
 }
 int64 GzipOutputStream::ByteCount() const {
+  if (parallel_ != NULL) return parallel_->ByteCount();
   return zcontext_.total_in + zcontext_.avail_in;
 }
 
 bool GzipOutputStream::Flush() {
+  if (parallel_ != NULL) {
+    if ((zerror_ != Z_OK) && (zerror_ != Z_BUF_ERROR)) {
+      return false;
+    }
+    zerror_ = parallel_->Flush();
+    return zerror_ == Z_OK;
+  }
   do {
     zerror_ = Deflate(Z_FULL_FLUSH);
   } while (zerror_ == Z_OK);
@@ -304,11 +837,16 @@ bool GzipOutputStream::Close() {
   if ((zerror_ != Z_OK) && (zerror_ != Z_BUF_ERROR)) {
     return false;
   }
-  do {
-    zerror_ = Deflate(Z_FINISH);
-  } while (zerror_ == Z_OK);
-  zerror_ = deflateEnd(&zcontext_);
-  bool ok = zerror_ == Z_OK;
+  bool ok;
+  if (parallel_ != NULL) {
+    ok = parallel_->Close() == Z_OK;
+  } else {
+    do {
+      zerror_ = Deflate(Z_FINISH);
+    } while (zerror_ == Z_OK);
+    // zcontext_ is kept for Reset(); the destructor frees it.
+    ok = zerror_ == Z_STREAM_END;
+  }
   zerror_ = Z_STREAM_END;
   return ok;
 }
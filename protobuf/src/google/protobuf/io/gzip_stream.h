@@ -38,7 +38,8 @@
 // ZeroCopyInputStream.
 //
 // GzipOutputStream is an ZeroCopyOutputStream that compresses data to
-// an underlying ZeroCopyOutputStream.
+// an underlying ZeroCopyOutputStream.  It can optionally spread the
+// compression over several threads.
 
 #ifndef GOOGLE_PROTOBUF_IO_GZIP_STREAM_H__
 #define GOOGLE_PROTOBUF_IO_GZIP_STREAM_H__
@@ -73,6 +74,11 @@ class LIBPROTOBUF_EXPORT GzipInputStream : public ZeroCopyInputStream {
       int buffer_size = -1);
   virtual ~GzipInputStream();
 
+  // Starts decompressing a new stream read from sub_stream, reusing this
+  // object's zlib state and buffer rather than allocating new ones.  Any of
+  // the previous stream that has not been read is discarded.
+  void Reset(ZeroCopyInputStream* sub_stream);
+
   // Return last error message or NULL if no error.
   inline const char* ZlibErrorMessage() const {
     return zcontext_.msg;
@@ -133,6 +139,17 @@ class LIBPROTOBUF_EXPORT GzipOutputStream : public ZeroCopyOutputStream {
     // zlib.h for definitions of these constants.
     int compression_strategy;
 
+    // How many threads to compress with.  Defaults to 1, which compresses
+    // on the calling thread as data is written.  If greater than 1, each
+    // buffer_size bytes of input are instead compressed as an independent
+    // block by a pool of that many threads, primed with the end of the
+    // previous block so little compression is lost, and the blocks are
+    // written out in order as a single stream which any zlib can read.
+    // Use a buffer_size of 128kB or more to get the most out of this.
+    // Without thread support, the blocks are compressed on the calling
+    // thread.
+    int threads;
+
     Options();  // Initializes with default values.
   };
 
@@ -173,6 +190,12 @@ class LIBPROTOBUF_EXPORT GzipOutputStream : public ZeroCopyOutputStream {
   // Returns true if no error.
   bool Close();
 
+  // Starts compressing a new stream to sub_stream with the same options,
+  // reusing this object's zlib state, buffers and threads rather than
+  // allocating new ones.  Call Close() first; anything written since the
+  // last Flush() or Close() is discarded.
+  void Reset(ZeroCopyOutputStream* sub_stream);
+
   // implements ZeroCopyOutputStream ---------------------------------
   bool Next(void** data, int* size);
   void BackUp(int count);
@@ -189,6 +212,11 @@ class LIBPROTOBUF_EXPORT GzipOutputStream : public ZeroCopyOutputStream {
   void* input_buffer_;
   size_t input_buffer_length_;
 
+  // Compresses blocks in parallel when Options::threads > 1, in which case
+  // it does all of the work and zcontext_ is unused.
+  class ParallelDeflater;
+  ParallelDeflater* parallel_;
+
   // Shared constructor code.
   void Init(ZeroCopyOutputStream* sub_stream, const Options& options);
 
@@ -118,6 +118,9 @@ namespace {
 
 CHARACTER_CLASS(Whitespace, c == ' ' || c == '\n' || c == '\t' ||
                             c == '\r' || c == '\v' || c == '\f');
+// Whitespace which doesn't affect the line and column counting specially.
+CHARACTER_CLASS(SameLineWhitespace, c == ' ' || c == '\r' ||
+                                    c == '\v' || c == '\f');
 
 CHARACTER_CLASS(Unprintable, c < ' ' && c > '\0');
 
@@ -140,6 +143,11 @@ CHARACTER_CLASS(Escape, c == 'a' || c == 'b' || c == 'f' || c == 'n' ||
                         c == 'r' || c == 't' || c == 'v' || c == '\\' ||
                         c == '?' || c == '\'' || c == '\"');
 
+// Characters in string literals which need no special handling, apart from
+// the other kind of quote.
+CHARACTER_CLASS(PlainStringChar, c != '\\' && c != '\n' && c != '\t' &&
+                                 c != '\0' && c != '\'' && c != '\"');
+
 #undef CHARACTER_CLASS
 
 // Given a char, interpret it as a numeric digit and return its value.
@@ -313,14 +321,31 @@ inline void Tokenizer::ConsumeZeroOrMore() {
   }
 }
 
+template<typename CharacterClass>
+inline void Tokenizer::ConsumeZeroOrMoreOnLine() {
+  while (CharacterClass::InClass(current_char_)) {
+    // Take the whole run within the current buffer at once.
+    int start = buffer_pos_;
+    do {
+      ++buffer_pos_;
+    } while (buffer_pos_ < buffer_size_ &&
+             CharacterClass::InClass(buffer_[buffer_pos_]));
+    column_ += buffer_pos_ - start;
+
+    if (buffer_pos_ < buffer_size_) {
+      current_char_ = buffer_[buffer_pos_];
+    } else {
+      Refresh();
+    }
+  }
+}
+
 template<typename CharacterClass>
 inline void Tokenizer::ConsumeOneOrMore(const char* error) {
   if (!CharacterClass::InClass(current_char_)) {
     AddError(error);
   } else {
-    do {
-      NextChar();
-    } while (CharacterClass::InClass(current_char_));
+    ConsumeZeroOrMoreOnLine<CharacterClass>();
   }
 }
 
@@ -330,6 +355,8 @@ inline void Tokenizer::ConsumeOneOrMore(const char* error) {
 
 void Tokenizer::ConsumeString(char delimiter) {
   while (true) {
+    ConsumeZeroOrMoreOnLine<PlainStringChar>();
+
     switch (current_char_) {
       case '\0':
       case '\n': {
@@ -379,23 +406,23 @@ Tokenizer::TokenType Tokenizer::ConsumeNumber(bool started_with_zero,
 
   } else if (started_with_zero && LookingAt<Digit>()) {
     // An octal number (had a leading zero).
-    ConsumeZeroOrMore<OctalDigit>();
+    ConsumeZeroOrMoreOnLine<OctalDigit>();
     if (LookingAt<Digit>()) {
       AddError("Numbers starting with leading zero must be in octal.");
-      ConsumeZeroOrMore<Digit>();
+      ConsumeZeroOrMoreOnLine<Digit>();
     }
 
   } else {
     // A decimal number.
     if (started_with_dot) {
       is_float = true;
-      ConsumeZeroOrMore<Digit>();
+      ConsumeZeroOrMoreOnLine<Digit>();
     } else {
-      ConsumeZeroOrMore<Digit>();
+      ConsumeZeroOrMoreOnLine<Digit>();
 
       if (TryConsume('.')) {
         is_float = true;
-        ConsumeZeroOrMore<Digit>();
+        ConsumeZeroOrMoreOnLine<Digit>();
       }
     }
 
@@ -468,8 +495,11 @@ bool Tokenizer::Next() {
   bool skipped_stuff = false;
 
   while (!read_error_) {
-    if (TryConsumeOne<Whitespace>()) {
-      ConsumeZeroOrMore<Whitespace>();
+    if (LookingAt<Whitespace>()) {
+      // Runs of spaces, as in indentation, are taken in bulk.
+      do {
+        ConsumeZeroOrMoreOnLine<SameLineWhitespace>();
+      } while (TryConsumeOne<Whitespace>());
 
     } else if (comment_style_ == CPP_COMMENT_STYLE && TryConsume('/')) {
       // Starting a comment?
@@ -507,7 +537,7 @@ bool Tokenizer::Next() {
       StartToken();
 
       if (TryConsumeOne<Letter>()) {
-        ConsumeZeroOrMore<Alphanumeric>();
+        ConsumeZeroOrMoreOnLine<Alphanumeric>();
         current_.type = TYPE_IDENTIFIER;
       } else if (TryConsume('0')) {
         current_.type = ConsumeNumber(true, false);
@@ -582,6 +612,24 @@ bool Tokenizer::ParseInteger(const string& text, uint64 max_value,
   }
 
   uint64 result = 0;
+
+  // With no more digits than this, the result can't overflow a uint64, so
+  // it only needs checking against max_value at the end.
+  int digits = text.c_str() + text.size() - ptr;
+  int safe_digits = (base == 16) ? 15 : (base == 10) ? 19 : 21;
+  if (digits <= safe_digits) {
+    for (; *ptr != '\0'; ptr++) {
+      int digit = DigitValue(*ptr);
+      GOOGLE_LOG_IF(DFATAL, digit < 0 || digit >= base)
+        << " Tokenizer::ParseInteger() passed text that could not have been"
+           " tokenized as an integer: " << CEscape(text);
+      result = result * base + digit;
+    }
+    if (result > max_value) return false;
+    *output = result;
+    return true;
+  }
+
   for (; *ptr != '\0'; ptr++) {
     int digit = DigitValue(*ptr);
     GOOGLE_LOG_IF(DFATAL, digit < 0 || digit >= base)
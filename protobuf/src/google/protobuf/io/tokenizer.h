@@ -279,6 +279,12 @@ class LIBPROTOBUF_EXPORT Tokenizer {
   template<typename CharacterClass>
   inline void ConsumeZeroOrMore();
 
+  // Like ConsumeZeroOrMore(), but faster, for character classes containing
+  // neither '\n' nor '\t':  since each character just advances the column
+  // by one, runs are consumed straight from the buffer without NextChar().
+  template<typename CharacterClass>
+  inline void ConsumeZeroOrMoreOnLine();
+
   // Consume one or more of the given character class or log the given
   // error message.
   // e.g. ConsumeOneOrMore<Digit>("Expected digits.");
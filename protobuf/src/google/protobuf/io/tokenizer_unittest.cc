@@ -410,6 +410,19 @@ MultiTokenCase kMultiTokenCases[] = {
     { Tokenizer::TYPE_IDENTIFIER, "bar", 1, 11 },
     { Tokenizer::TYPE_END       , ""   , 1, 14 },
   }},
+
+  // Test that column numbers stay right across long runs of characters,
+  // which are consumed in bulk, and tabs within strings, which are not.
+  { "    identifier_1234567890 12345678901234567890\n"
+    "  \"a\tstring 'with' \\\"escapes\\\"\" 'x\\'\"' end", {
+    { Tokenizer::TYPE_IDENTIFIER, "identifier_1234567890" , 0,  4 },
+    { Tokenizer::TYPE_INTEGER   , "12345678901234567890"  , 0, 26 },
+    { Tokenizer::TYPE_STRING    ,
+      "\"a\tstring 'with' \\\"escapes\\\"\"", 1,  2 },
+    { Tokenizer::TYPE_STRING    , "'x\\'\"'"               , 1, 35 },
+    { Tokenizer::TYPE_IDENTIFIER, "end"                   , 1, 42 },
+    { Tokenizer::TYPE_END       , ""                      , 1, 45 },
+  }},
 };
 
 TEST_2D(TokenizerTest, MultipleTokens, kMultiTokenCases, kBlockSizes) {
@@ -528,6 +541,22 @@ TEST_F(TokenizerTest, ParseInteger) {
   EXPECT_FALSE(Tokenizer::ParseInteger("12346", 12345, &i));
   EXPECT_TRUE (Tokenizer::ParseInteger("0xFFFFFFFFFFFFFFFF" , kuint64max, &i));
   EXPECT_FALSE(Tokenizer::ParseInteger("0x10000000000000000", kuint64max, &i));
+
+  // Around the number of digits which can't overflow, in each base.
+  EXPECT_TRUE (Tokenizer::ParseInteger("4294967295", kuint32max, &i));
+  EXPECT_FALSE(Tokenizer::ParseInteger("4294967296", kuint32max, &i));
+  EXPECT_TRUE (Tokenizer::ParseInteger("9999999999999999999", kuint64max, &i));
+  EXPECT_EQ(GOOGLE_ULONGLONG(9999999999999999999), i);
+  EXPECT_TRUE (Tokenizer::ParseInteger("18446744073709551615", kuint64max, &i));
+  EXPECT_EQ(kuint64max, i);
+  EXPECT_FALSE(Tokenizer::ParseInteger("18446744073709551616", kuint64max, &i));
+  EXPECT_FALSE(Tokenizer::ParseInteger("99999999999999999999", kuint64max, &i));
+  EXPECT_TRUE (Tokenizer::ParseInteger("0xFFFFFFFFFFFFFFF", kint64max, &i));
+  EXPECT_TRUE (Tokenizer::ParseInteger("01777777777777777777777", kuint64max,
+                                       &i));
+  EXPECT_EQ(kuint64max, i);
+  EXPECT_FALSE(Tokenizer::ParseInteger("02000000000000000000000", kuint64max,
+                                       &i));
 }
 
 TEST_F(TokenizerTest, ParseFloat) {
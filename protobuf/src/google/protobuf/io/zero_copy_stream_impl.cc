@@ -40,6 +40,11 @@
 #include <sys/stat.h>
 #include <fcntl.h>
 #endif
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/uio.h>
+#include <limits.h>
+#endif
 #include <errno.h>
 #include <iostream>
 #include <algorithm>
@@ -170,6 +175,171 @@ int FileInputStream::CopyingFileInputStream::Skip(int count) {
 
 // ===================================================================
 
+namespace {
+
+// Mapped windows start at multiples of this, and their sizes are rounded up
+// to it.  2MB is the huge page size on x86 and ARM64, and a multiple of any
+// normal page size, as mmap() requires of offsets.
+const int kWindowAlignment = 2 << 20;
+const int kDefaultWindowSize = 64 << 20;
+// The largest multiple of kWindowAlignment which fits in an int.
+const int kMaxWindowSize = kint32max / kWindowAlignment * kWindowAlignment;
+
+// Rounds a requested window size up to a multiple of kWindowAlignment.
+// Sizes too large to round up without overflowing are capped.
+int RoundUpWindowSize(int window_size) {
+  if (window_size <= 0) return kDefaultWindowSize;
+  if (window_size >= kMaxWindowSize) return kMaxWindowSize;
+  return (window_size + kWindowAlignment - 1) / kWindowAlignment *
+         kWindowAlignment;
+}
+
+}  // namespace
+
+MmapInputStream::MmapInputStream(int file_descriptor, int window_size)
+  : file_(file_descriptor),
+    window_size_(RoundUpWindowSize(window_size)),
+    fallback_(file_descriptor),
+    using_fallback_(true),
+    fallback_byte_count_(0),
+    is_closed_(false),
+    start_(0),
+    end_(0),
+    position_(0),
+    window_(NULL),
+    window_start_(0),
+    window_end_(0),
+    last_returned_size_(0) {
+#ifndef _WIN32
+  struct stat info;
+  if (fstat(file_, &info) == 0 && S_ISREG(info.st_mode)) {
+    off_t offset = lseek(file_, 0, SEEK_CUR);
+    if (offset >= 0) {
+      using_fallback_ = false;
+      start_ = offset;
+      position_ = offset;
+      end_ = max<int64>(info.st_size, offset);
+    }
+  }
+#endif
+}
+
+MmapInputStream::~MmapInputStream() {
+  UnmapWindow();
+  if (!using_fallback_ && !is_closed_) {
+    // Leave the descriptor where a FileInputStream which had read the same
+    // data would have left it.
+    lseek(file_, position_, SEEK_SET);
+  }
+}
+
+bool MmapInputStream::Close() {
+  UnmapWindow();
+  is_closed_ = true;
+  return fallback_.Close();
+}
+
+bool MmapInputStream::Next(const void** data, int* size) {
+  if (using_fallback_) return fallback_.Next(data, size);
+  GOOGLE_CHECK(!is_closed_);
+
+  if (window_ == NULL || position_ >= window_end_) {
+    if (!MapWindow()) {
+      last_returned_size_ = 0;
+      return using_fallback_ && fallback_.Next(data, size);
+    }
+  }
+
+  *data = window_ + (position_ - window_start_);
+  *size = window_end_ - position_;
+  last_returned_size_ = *size;
+  position_ = window_end_;
+  return true;
+}
+
+void MmapInputStream::BackUp(int count) {
+  if (using_fallback_) {
+    fallback_.BackUp(count);
+    return;
+  }
+  GOOGLE_CHECK_GT(last_returned_size_, 0)
+      << "BackUp() can only be called after a successful Next().";
+  GOOGLE_CHECK_LE(count, last_returned_size_);
+  GOOGLE_CHECK_GE(count, 0);
+  position_ -= count;
+  last_returned_size_ = 0;  // Don't let caller back up further.
+}
+
+bool MmapInputStream::Skip(int count) {
+  if (using_fallback_) return fallback_.Skip(count);
+  GOOGLE_CHECK_GE(count, 0);
+  last_returned_size_ = 0;  // Don't let caller back up.
+  if (count > end_ - position_) {
+    position_ = end_;
+    return false;
+  }
+  position_ += count;
+  return true;
+}
+
+int64 MmapInputStream::ByteCount() const {
+  if (using_fallback_) return fallback_byte_count_ + fallback_.ByteCount();
+  return position_ - start_;
+}
+
+bool MmapInputStream::MapWindow() {
+  UnmapWindow();
+  if (position_ >= end_) return false;
+
+#ifndef _WIN32
+  int64 start = position_ - position_ % kWindowAlignment;
+  int64 length = min<int64>(window_size_, end_ - start);
+  int flags = MAP_SHARED;
+#ifdef MAP_POPULATE
+  // Setting up the page tables for the whole window at once is much cheaper
+  // than taking a fault on every page as the reader gets to it.
+  flags |= MAP_POPULATE;
+#endif
+  void* mapping = mmap(NULL, length, PROT_READ, flags, file_, start);
+  if (mapping != MAP_FAILED) {
+    // Have the kernel start reading in the whole window now.  Both calls
+    // are only read-ahead hints; neither releases pages we have passed.
+    madvise(mapping, length, MADV_SEQUENTIAL);
+    madvise(mapping, length, MADV_WILLNEED);
+#ifdef POSIX_FADV_WILLNEED
+    // Also get the next window going, so that mapping it does not stall.
+    if (start + length < end_) {
+      posix_fadvise(file_, start + length,
+                    min<int64>(window_size_, end_ - start - length),
+                    POSIX_FADV_WILLNEED);
+    }
+#endif
+
+    window_ = reinterpret_cast<const uint8*>(mapping);
+    window_start_ = start;
+    window_end_ = start + length;
+    return true;
+  }
+#endif
+
+  // We couldn't map the file (e.g. we are out of address space), so read
+  // the rest of it instead.
+  fallback_byte_count_ = position_ - start_;
+  using_fallback_ = true;
+  lseek(file_, position_, SEEK_SET);
+  return false;
+}
+
+void MmapInputStream::UnmapWindow() {
+  if (window_ == NULL) return;
+#ifndef _WIN32
+  munmap(const_cast<uint8*>(window_), window_end_ - window_start_);
+#endif
+  window_ = NULL;
+}
+
+// ===================================================================
+
 FileOutputStream::FileOutputStream(int file_descriptor, int block_size)
   : copying_output_(file_descriptor),
     impl_(&copying_output_, block_size) {
@@ -268,6 +438,246 @@ bool FileOutputStream::CopyingFileOutputStream::Write(
 
 // ===================================================================
 
+namespace {
+
+const int kDefaultGatherBlockSize = 8192;
+
+// Aliased pieces smaller than this are copied into the chain instead.
+const int kMinAliasedSize = 128;
+
+#ifndef _WIN32
+// How many iovecs to pass to each writev().
+#ifdef IOV_MAX
+const int kMaxIovecs = IOV_MAX < 1024 ? IOV_MAX : 1024;
+#else
+const int kMaxIovecs = 16;  // The least POSIX allows.
+#endif
+#endif
+
+}  // namespace
+
+GatherOutputStream::GatherOutputStream(int file_descriptor, int block_size)
+  : file_(file_descriptor),
+    block_size_(block_size > 0 ? block_size : kDefaultGatherBlockSize),
+    close_on_delete_(false),
+    is_closed_(false),
+    errno_(0),
+    current_block_(NULL),
+    current_block_used_(0),
+    open_segment_(false),
+    buffered_bytes_(0),
+    byte_count_(0),
+    last_returned_size_(0) {
+}
+
+GatherOutputStream::~GatherOutputStream() {
+  if (file_ >= 0 && !is_closed_) Flush();
+  Clear();
+  delete [] current_block_;
+  if (close_on_delete_ && !is_closed_) {
+    is_closed_ = true;
+    if (close_no_eintr(file_) != 0) {
+      GOOGLE_LOG(ERROR) << "close() failed: " << strerror(errno);
+    }
+  }
+}
+
+void GatherOutputStream::AppendAliased(const void* data, int size) {
+  GOOGLE_CHECK_GE(size, 0);
+  if (size < kMinAliasedSize) {
+    AppendCopy(data, size);
+    return;
+  }
+  segments_.push_back(Segment(reinterpret_cast<const char*>(data), size));
+  open_segment_ = false;
+  last_returned_size_ = 0;
+  buffered_bytes_ += size;
+  byte_count_ += size;
+}
+
+void GatherOutputStream::AppendCopy(const void* data, int size) {
+  GOOGLE_CHECK_GE(size, 0);
+  const char* in = reinterpret_cast<const char*>(data);
+  while (size > 0) {
+    void* out;
+    int out_size;
+    if (!Next(&out, &out_size)) return;
+    if (out_size > size) {
+      memcpy(out, in, size);
+      BackUp(out_size - size);
+      return;
+    }
+    memcpy(out, in, out_size);
+    in += out_size;
+    size -= out_size;
+  }
+}
+
+void GatherOutputStream::AppendString(string* data) {
+  if (static_cast<int>(data->size()) < kMinAliasedSize) {
+    AppendCopy(data->data(), data->size());
+    data->clear();
+    return;
+  }
+  string* owned = new string;
+  owned->swap(*data);
+  strings_.push_back(owned);
+  AppendAliased(owned->data(), owned->size());
+}
+
+bool GatherOutputStream::Flush() {
+  GOOGLE_CHECK(!is_closed_);
+  if (errno_ != 0) return false;
+  bool succeeded = WriteSegments();
+  Clear();
+  return succeeded;
+}
+
+bool GatherOutputStream::Close() {
+  bool flush_succeeded = Flush();
+
+  is_closed_ = true;
+  if (close_no_eintr(file_) != 0) {
+    // See FileOutputStream::CopyingFileOutputStream::Close().
+    errno_ = errno;
+    return false;
+  }
+  return flush_succeeded;
+}
+
+void GatherOutputStream::Clear() {
+  segments_.clear();
+  for (int i = 0; i < blocks_.size(); i++) {
+    if (blocks_[i] != current_block_) delete [] blocks_[i];
+  }
+  blocks_.clear();
+  STLDeleteElements(&strings_);
+
+  // Keep the current block around for the next Next().
+  current_block_used_ = 0;
+  open_segment_ = false;
+  buffered_bytes_ = 0;
+  last_returned_size_ = 0;
+}
+
+#ifndef _WIN32
+void GatherOutputStream::ExportIovecs(vector<struct iovec>* iovecs) const {
+  iovecs->reserve(iovecs->size() + segments_.size());
+  for (int i = 0; i < segments_.size(); i++) {
+    if (segments_[i].size == 0) continue;
+    struct iovec iov;
+    iov.iov_base = const_cast<char*>(segments_[i].data);
+    iov.iov_len = segments_[i].size;
+    iovecs->push_back(iov);
+  }
+}
+#endif
+
+bool GatherOutputStream::WriteSegments() {
+#ifndef _WIN32
+  vector<struct iovec> iovecs;
+  ExportIovecs(&iovecs);
+
+  int first = 0;
+  while (first < iovecs.size()) {
+    int count = min<int>(iovecs.size() - first, kMaxIovecs);
+    ssize_t bytes;
+    do {
+      bytes = writev(file_, &iovecs[first], count);
+    } while (bytes < 0 && errno == EINTR);
+
+    if (bytes <= 0) {
+      // See FileOutputStream::CopyingFileOutputStream::Write() regarding
+      // a return value of zero.
+      if (bytes < 0) {
+        errno_ = errno;
+      }
+      return false;
+    }
+
+    // Skip over whatever was written, which may end partway through an
+    // iovec.
+    while (first < iovecs.size() &&
+           static_cast<size_t>(bytes) >= iovecs[first].iov_len) {
+      bytes -= iovecs[first].iov_len;
+      ++first;
+    }
+    if (bytes > 0) {
+      iovecs[first].iov_base =
+          reinterpret_cast<char*>(iovecs[first].iov_base) + bytes;
+      iovecs[first].iov_len -= bytes;
+    }
+  }
+#else
+  for (int i = 0; i < segments_.size(); i++) {
+    const char* data = segments_[i].data;
+    int size = segments_[i].size;
+    while (size > 0) {
+      int bytes;
+      do {
+        bytes = write(file_, data, size);
+      } while (bytes < 0 && errno == EINTR);
+
+      if (bytes <= 0) {
+        if (bytes < 0) {
+          errno_ = errno;
+        }
+        return false;
+      }
+      data += bytes;
+      size -= bytes;
+    }
+  }
+#endif
+  return true;
+}
+
+bool GatherOutputStream::Next(void** data, int* size) {
+  if (errno_ != 0) return false;
+
+  if (current_block_ == NULL || current_block_used_ == block_size_) {
+    current_block_ = new char[block_size_];
+    blocks_.push_back(current_block_);
+    current_block_used_ = 0;
+    open_segment_ = false;
+  } else if (blocks_.empty() || blocks_.back() != current_block_) {
+    // The chain was cleared, but current_block_ was kept for reuse.
+    blocks_.push_back(current_block_);
+  }
+
+  if (!open_segment_) {
+    segments_.push_back(Segment(current_block_ + current_block_used_, 0));
+    open_segment_ = true;
+  }
+
+  *data = current_block_ + current_block_used_;
+  *size = block_size_ - current_block_used_;
+  segments_.back().size += *size;
+  current_block_used_ = block_size_;
+  buffered_bytes_ += *size;
+  byte_count_ += *size;
+  last_returned_size_ = *size;
+  return true;
+}
+
+void GatherOutputStream::BackUp(int count) {
+  GOOGLE_CHECK_GT(last_returned_size_, 0)
+      << "BackUp() can only be called after a successful Next().";
+  GOOGLE_CHECK_LE(count, last_returned_size_);
+  GOOGLE_CHECK_GE(count, 0);
+  segments_.back().size -= count;
+  current_block_used_ -= count;
+  buffered_bytes_ -= count;
+  byte_count_ -= count;
+  last_returned_size_ = 0;  // Don't let caller back up further.
+}
+
+int64 GatherOutputStream::ByteCount() const {
+  return byte_count_;
+}
+
+// ===================================================================
+
 IstreamInputStream::IstreamInputStream(istream* input, int block_size)
   : copying_input_(input),
     impl_(&copying_input_, block_size) {
@@ -42,10 +42,14 @@
 
 #include <string>
 #include <iosfwd>
+#include <vector>
 #include <google/protobuf/io/zero_copy_stream.h>
 #include <google/protobuf/io/zero_copy_stream_impl_lite.h>
 #include <google/protobuf/stubs/common.h>
 
+#ifndef _WIN32
+struct iovec;
+#endif
 
 namespace google {
 namespace protobuf {
@@ -131,6 +135,102 @@ class LIBPROTOBUF_EXPORT FileInputStream : public ZeroCopyInputStream {
 
 // ===================================================================
 
+// A ZeroCopyInputStream which reads a file descriptor by mapping the file
+// into memory.
+//
+// Next() returns pointers straight into the mapping, so unlike
+// FileInputStream no data is copied.  The file is mapped a window at a
+// time; each window is advised to the kernel as sequential and needed, and
+// readahead is requested for the window after it, so that by the time the
+// reader gets there it is usually already in the page cache.  Windows are
+// aligned to 2MB so that kernels which back the page cache with huge pages
+// can map them as such.
+//
+// Only regular files can be mapped.  If the descriptor refers to anything
+// else (a pipe, socket, etc.), or the platform does not support mmap(), or
+// mapping fails, MmapInputStream transparently falls back to reading the
+// descriptor like FileInputStream does.
+//
+// Reading starts at the descriptor's current offset and ends at the size
+// the file had when the stream was created; data appended later is not
+// seen.  When the stream is destroyed, the descriptor's offset is set to
+// just past the last byte consumed.
+//
+// WARNING:  If the file is truncated while it is mapped, touching the part
+// of a window past the new end of the file raises SIGBUS, which by default
+// kills the process.  Don't use MmapInputStream on files which other
+// processes may truncate, or install a SIGBUS handler if you must.
+class LIBPROTOBUF_EXPORT MmapInputStream : public ZeroCopyInputStream {
+ public:
+  // Creates a stream that reads from the given Unix file descriptor.  If a
+  // window_size is given, it specifies the number of bytes to map at a time;
+  // it is rounded up to a multiple of 2MB, or down to the largest multiple
+  // of 2MB which fits in an int.  Otherwise, a reasonable default is used.
+  // Next() returns at most window_size bytes at a time.
+  explicit MmapInputStream(int file_descriptor, int window_size = -1);
+  ~MmapInputStream();
+
+  // Unmaps the file and closes the underlying file descriptor.  Returns
+  // false if an error occurs during the process; use GetErrno() to examine
+  // the error.  Even if an error occurs, the file descriptor is closed when
+  // this returns.
+  bool Close();
+
+  // By default, the file descriptor is not closed when the stream is
+  // destroyed.  Call SetCloseOnDelete(true) to change that.  The same
+  // warning as for FileInputStream::SetCloseOnDelete() applies.
+  void SetCloseOnDelete(bool value) { fallback_.SetCloseOnDelete(value); }
+
+  // If an I/O error has occurred on this file descriptor, this is the
+  // errno from that error.  Otherwise, this is zero.
+  int GetErrno() { return fallback_.GetErrno(); }
+
+  // Returns true if the file is being read through memory mappings, false
+  // if the stream has fallen back to read().
+  bool IsMapped() const { return !using_fallback_; }
+
+  // implements ZeroCopyInputStream ----------------------------------
+  bool Next(const void** data, int* size);
+  void BackUp(int count);
+  bool Skip(int count);
+  int64 ByteCount() const;
+
+ private:
+  // Maps the window containing position_, replacing the current one.
+  // Returns false at the end of the file, or if mapping failed, in which
+  // case the stream switches over to fallback_.
+  bool MapWindow();
+  void UnmapWindow();
+
+  // The file descriptor.
+  const int file_;
+  const int window_size_;
+
+  // Reads the descriptor when it can't be mapped.  Also owns closing it.
+  FileInputStream fallback_;
+  bool using_fallback_;
+  // The value of ByteCount() at the time we switched to fallback_.
+  int64 fallback_byte_count_;
+  bool is_closed_;
+
+  int64 start_;     // File offset at which the stream started.
+  int64 end_;       // Size of the file when the stream was created.
+  int64 position_;  // File offset of the next byte Next() will return.
+
+  // The currently-mapped window, covering the file offsets
+  // [window_start_, window_end_), or NULL if there is none.
+  const uint8* window_;
+  int64 window_start_;
+  int64 window_end_;
+
+  // How many bytes were returned the last time Next() was called.
+  int last_returned_size_;
+
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(MmapInputStream);
+};
+
+// ===================================================================
+
 // A ZeroCopyOutputStream which writes to a file descriptor.
 //
 // FileOutputStream is preferred over using an ofstream with
@@ -208,6 +308,125 @@ class LIBPROTOBUF_EXPORT FileOutputStream : public ZeroCopyOutputStream {
 
 // ===================================================================
 
+// A ZeroCopyOutputStream which collects what is written to it as a chain of
+// buffer segments, and writes the whole chain to a file descriptor with
+// writev().
+//
+// Data written through Next() is copied into blocks owned by the stream,
+// like FileOutputStream does, but data which is already serialized
+// elsewhere -- e.g. cached messages that go into many responses -- can be
+// added to the chain with AppendAliased() without being copied at all.
+// Nothing is written until Flush() is called, at which point the entire
+// chain goes out in as few system calls as possible.  The chain can also be
+// exported as an array of iovecs, for callers which do their own I/O (e.g.
+// with sendmsg()).
+class LIBPROTOBUF_EXPORT GatherOutputStream : public ZeroCopyOutputStream {
+ public:
+  // Creates a stream that writes to the given Unix file descriptor when
+  // flushed.  Pass -1 if the chain is only going to be exported.  If a
+  // block_size is given, it specifies the size of the blocks allocated to
+  // hold data written through Next().  Otherwise, a reasonable default is
+  // used.
+  explicit GatherOutputStream(int file_descriptor, int block_size = -1);
+  // Flushes the chain, unless the descriptor is -1.
+  ~GatherOutputStream();
+
+  // Appends size bytes at data to the chain without copying them.  The data
+  // must remain valid and unchanged until the next Flush() or Clear().
+  // Very small pieces are copied anyway, since an iovec for each one would
+  // cost more than the copy.
+  void AppendAliased(const void* data, int size);
+  void AppendAliased(const string& data) {
+    AppendAliased(data.data(), data.size());
+  }
+
+  // Appends a copy of size bytes at data to the chain.
+  void AppendCopy(const void* data, int size);
+
+  // Appends the contents of *data to the chain without copying them.  The
+  // stream takes them over, leaving *data empty.
+  void AppendString(string* data);
+
+  // Writes the chain to the file descriptor and then empties it.  Returns
+  // false if an error occurs; use GetErrno() to examine the error.
+  bool Flush();
+
+  // Flushes the chain and closes the underlying file.  Returns false if
+  // an error occurs during the process; use GetErrno() to examine the error.
+  // Even if an error occurs, the file descriptor is closed when this returns.
+  bool Close();
+
+  // Empties the chain without writing it anywhere.
+  void Clear();
+
+  // By default, the file descriptor is not closed when the stream is
+  // destroyed.  Call SetCloseOnDelete(true) to change that.  The same
+  // warning as for FileOutputStream::SetCloseOnDelete() applies.
+  void SetCloseOnDelete(bool value) { close_on_delete_ = value; }
+
+  // If an I/O error has occurred on this file descriptor, this is the
+  // errno from that error.  Otherwise, this is zero.  Once an error
+  // occurs, the stream is broken and all subsequent operations will
+  // fail.
+  int GetErrno() { return errno_; }
+
+  // The number of segments in the chain, and the number of bytes in them.
+  int SegmentCount() const { return segments_.size(); }
+  int64 BufferedBytes() const { return buffered_bytes_; }
+
+#ifndef _WIN32
+  // Appends an iovec for each segment of the chain to *iovecs.  They remain
+  // valid until the chain is next modified.
+  void ExportIovecs(vector<struct iovec>* iovecs) const;
+#endif
+
+  // implements ZeroCopyOutputStream ---------------------------------
+  bool Next(void** data, int* size);
+  void BackUp(int count);
+  int64 ByteCount() const;
+
+ private:
+  struct Segment {
+    const char* data;
+    int size;
+
+    Segment(const char* data_arg, int size_arg)
+      : data(data_arg), size(size_arg) {}
+  };
+
+  // Writes segments_ to file_, restarting after partial writes.
+  bool WriteSegments();
+
+  // The file descriptor.
+  const int file_;
+  const int block_size_;
+  bool close_on_delete_;
+  bool is_closed_;
+
+  // The errno of the I/O error, if one has occurred.  Otherwise, zero.
+  int errno_;
+
+  vector<Segment> segments_;
+  // Storage owned by the chain.
+  vector<char*> blocks_;
+  vector<string*> strings_;
+
+  // The block Next() hands out space from, and how much of it is used.
+  // If open_segment_ is true, the last segment ends at the end of the
+  // used space, so the next Next() can extend it rather than add another.
+  char* current_block_;
+  int current_block_used_;
+  bool open_segment_;
+
+  int64 buffered_bytes_;
+  int64 byte_count_;
+  int last_returned_size_;
+
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(GatherOutputStream);
+};
+
+// ===================================================================
+
 // A ZeroCopyInputStream which reads from a C++ istream.
 //
 // Note that for reading files (or anything represented by a file descriptor),
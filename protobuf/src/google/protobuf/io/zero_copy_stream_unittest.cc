@@ -59,6 +59,9 @@
 #include <fcntl.h>
 #include <errno.h>
 #include <sstream>
+#ifndef _WIN32
+#include <sys/uio.h>
+#endif
 
 #include <google/protobuf/io/zero_copy_stream_impl.h>
 
@@ -67,6 +70,7 @@
 #endif
 
 #include <google/protobuf/stubs/common.h>
+#include <google/protobuf/stubs/strutil.h>
 #include <google/protobuf/testing/googletest.h>
 #include <google/protobuf/testing/file.h>
 #include <gtest/gtest.h>
@@ -432,6 +436,107 @@ TEST_F(IoTest, CompressionOptions) {
   EXPECT_TRUE(Uncompress(gzip_compressed) == golden);
   EXPECT_TRUE(Uncompress(zlib_compressed) == golden);
 }
+
+TEST_F(IoTest, ParallelGzipIo) {
+  const int kParallelBufferSizes[] = {64, 1000, 65536};
+
+  for (int format = 0; format < 2; format++) {
+    for (int i = 0; i < kBlockSizeCount; i++) {
+      for (int z = 0; z < GOOGLE_ARRAYSIZE(kParallelBufferSizes); z++) {
+        string compressed;
+        {
+          StringOutputStream output(&compressed);
+          GzipOutputStream::Options options;
+          options.format =
+              format == 0 ? GzipOutputStream::GZIP : GzipOutputStream::ZLIB;
+          options.buffer_size = kParallelBufferSizes[z];
+          options.threads = 4;
+          GzipOutputStream gzout(&output, options);
+          WriteStuffLarge(&gzout);
+          EXPECT_TRUE(gzout.Close());
+        }
+        {
+          ArrayInputStream input(compressed.data(), compressed.size(),
+                                 kBlockSizes[i]);
+          GzipInputStream gzin(&input, format == 0 ?
+                               GzipInputStream::GZIP : GzipInputStream::ZLIB);
+          ReadStuffLarge(&gzin);
+          EXPECT_EQ(Z_STREAM_END, gzin.ZlibErrorCode());
+        }
+      }
+    }
+  }
+}
+
+TEST_F(IoTest, ParallelGzipCompression) {
+  // Compressing in parallel blocks should lose very little compression,
+  // since each block is primed with the end of the previous one.
+  string data;
+  for (int i = 0; i < 20000; i++) {
+    data += "record " + SimpleItoa(i) +
+            ": value " + SimpleItoa(i * 7919 % 100003) +
+            ", flags " + SimpleItoa(i * 31 % 257) + "\n";
+  }
+
+  GzipOutputStream::Options options;
+  string serial = Compress(data, options);
+  options.threads = 3;
+  options.buffer_size = 16384;
+  string parallel = Compress(data, options);
+
+  EXPECT_TRUE(Uncompress(parallel) == data);
+  EXPECT_LT(parallel.size(), serial.size() * 11 / 10);
+
+  // Flushing partway through is fine too.
+  string flushed;
+  {
+    StringOutputStream output(&flushed);
+    GzipOutputStream gzout(&output, options);
+    WriteToOutput(&gzout, data.data(), 12345);
+    EXPECT_TRUE(gzout.Flush());
+    WriteToOutput(&gzout, data.data() + 12345, data.size() - 12345);
+    EXPECT_TRUE(gzout.Close());
+  }
+  EXPECT_TRUE(Uncompress(flushed) == data);
+}
+
+TEST_F(IoTest, GzipReset) {
+  for (int threads = 1; threads <= 2; threads++) {
+    GzipOutputStream::Options options;
+    options.threads = threads;
+
+    string first, second, abandoned;
+    {
+      StringOutputStream output(&first);
+      GzipOutputStream gzout(&output, options);
+      WriteStuff(&gzout);
+      EXPECT_TRUE(gzout.Close());
+
+      StringOutputStream output2(&abandoned);
+      gzout.Reset(&output2);
+      WriteStuff(&gzout);
+
+      // Reset without closing.
+      StringOutputStream output3(&second);
+      gzout.Reset(&output3);
+      WriteStuffLarge(&gzout);
+      EXPECT_TRUE(gzout.Close());
+    }
+
+    ArrayInputStream input(first.data(), first.size());
+    GzipInputStream gzin(&input);
+    ReadStuff(&gzin);
+
+    // Reset before the first stream is finished.
+    ArrayInputStream input2(first.data(), first.size());
+    gzin.Reset(&input2);
+    ReadString(&gzin, "Hello world!\n");
+
+    ArrayInputStream input3(second.data(), second.size());
+    gzin.Reset(&input3);
+    ReadStuffLarge(&gzin);
+  }
+}
 #endif
 
 // There is no string input, only string output.  Also, it doesn't support
@@ -582,6 +687,136 @@ TEST_F(IoTest, FileWriteError) {
   EXPECT_EQ(EBADF, input.GetErrno());
 }
 
+TEST_F(IoTest, GatherIo) {
+  string filename = TestTempDir() + "/zero_copy_stream_test_file";
+
+  for (int i = 0; i < kBlockSizeCount; i++) {
+    int file =
+      open(filename.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_BINARY, 0777);
+    ASSERT_GE(file, 0);
+
+    {
+      GatherOutputStream output(file, kBlockSizes[i]);
+      WriteStuff(&output);
+      EXPECT_TRUE(output.Flush());
+      EXPECT_EQ(0, output.GetErrno());
+    }
+
+    // Rewind.
+    ASSERT_NE(lseek(file, 0, SEEK_SET), (off_t)-1);
+
+    {
+      FileInputStream input(file);
+      ReadStuff(&input);
+      EXPECT_EQ(0, input.GetErrno());
+    }
+
+    close(file);
+  }
+}
+
+// Test mixing aliased, copied and owned segments with Next().
+TEST_F(IoTest, GatherSegments) {
+  string filename = TestTempDir() + "/zero_copy_stream_test_file";
+  int file =
+    open(filename.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_BINARY, 0777);
+  ASSERT_GE(file, 0);
+
+  string aliased(1000, 'a');
+  string owned(2000, 'o');
+  string expected;
+
+  GatherOutputStream output(file, 64);
+  WriteString(&output, "header:");
+  output.AppendAliased(aliased);
+  output.AppendCopy("copied,", 7);
+  output.AppendString(&owned);
+  EXPECT_TRUE(owned.empty());
+  output.AppendAliased("tiny", 4);  // Copied, since it's so small.
+  WriteString(&output, ":trailer");
+  expected = "header:" + aliased + "copied," + string(2000, 'o') +
+             "tiny:trailer";
+
+  EXPECT_EQ(expected.size(), output.ByteCount());
+  EXPECT_EQ(expected.size(), output.BufferedBytes());
+  // The aliased and owned strings each get a segment of their own, and
+  // split the copied data into three runs.
+  EXPECT_EQ(5, output.SegmentCount());
+
+#ifndef _WIN32
+  vector<struct iovec> iovecs;
+  output.ExportIovecs(&iovecs);
+  ASSERT_EQ(5, iovecs.size());
+  EXPECT_EQ(aliased.data(), iovecs[1].iov_base);
+  string exported;
+  for (int i = 0; i < iovecs.size(); i++) {
+    exported.append(reinterpret_cast<const char*>(iovecs[i].iov_base),
+                    iovecs[i].iov_len);
+  }
+  EXPECT_EQ(expected, exported);
+#endif
+
+  EXPECT_TRUE(output.Flush());
+  EXPECT_EQ(0, output.SegmentCount());
+  EXPECT_EQ(0, output.BufferedBytes());
+  EXPECT_EQ(expected.size(), output.ByteCount());
+
+  // The stream is reusable after a flush.
+  WriteString(&output, "more");
+  EXPECT_TRUE(output.Close());
+
+  string contents;
+  File::ReadFileToStringOrDie(filename, &contents);
+  EXPECT_EQ(expected + "more", contents);
+}
+
+// Test a chain with more segments than can be passed to one writev().
+TEST_F(IoTest, GatherManySegments) {
+  string filename = TestTempDir() + "/zero_copy_stream_test_file";
+  int file =
+    open(filename.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_BINARY, 0777);
+  ASSERT_GE(file, 0);
+
+  vector<string> pieces;
+  string expected;
+  for (int i = 0; i < 5000; i++) {
+    pieces.push_back(string(200 + i % 7, 'a' + i % 26));
+    expected += pieces.back();
+  }
+
+  {
+    GatherOutputStream output(file);
+    output.SetCloseOnDelete(true);
+    for (int i = 0; i < pieces.size(); i++) {
+      output.AppendAliased(pieces[i]);
+    }
+    EXPECT_EQ(pieces.size(), output.SegmentCount());
+  }
+
+  string contents;
+  File::ReadFileToStringOrDie(filename, &contents);
+  EXPECT_TRUE(contents == expected);
+}
+
+// Test that GatherOutputStreams report errors correctly.
+TEST_F(IoTest, GatherWriteError) {
+  MsvcDebugDisabler debug_disabler;
+
+  // -1 = invalid file descriptor.
+  GatherOutputStream output(-1);
+
+  void* buffer;
+  int size;
+
+  // Nothing is written until Flush().
+  EXPECT_TRUE(output.Next(&buffer, &size));
+  EXPECT_FALSE(output.Flush());
+  EXPECT_EQ(EBADF, output.GetErrno());
+
+  // The stream is broken from then on.
+  EXPECT_FALSE(output.Next(&buffer, &size));
+}
+
 // Pipes are not seekable, so File{Input,Output}Stream ends up doing some
 // different things to handle them.  We'll test by writing to a pipe and
 // reading back from it.
@@ -611,6 +846,151 @@ TEST_F(IoTest, PipeIo) {
   }
 }
 
+// Test MmapInputStream on a regular file, which it should map.
+TEST_F(IoTest, MmapIo) {
+  string filename = TestTempDir() + "/zero_copy_stream_test_file";
+
+  for (int i = 0; i < kBlockSizeCount; i++) {
+    int file =
+      open(filename.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_BINARY, 0777);
+    ASSERT_GE(file, 0);
+
+    {
+      FileOutputStream output(file, kBlockSizes[i]);
+      WriteStuff(&output);
+      EXPECT_EQ(0, output.GetErrno());
+    }
+
+    // Rewind.
+    ASSERT_NE(lseek(file, 0, SEEK_SET), (off_t)-1);
+
+    {
+      MmapInputStream input(file);
+#ifndef _WIN32
+      EXPECT_TRUE(input.IsMapped());
+#endif
+      ReadStuff(&input);
+      EXPECT_EQ(0, input.GetErrno());
+    }
+
+    close(file);
+  }
+}
+
+// Test reading a file which spans several mapped windows.
+TEST_F(IoTest, MmapMultipleWindows) {
+  string filename = TestTempDir() + "/zero_copy_stream_test_file";
+  const int kWindowSize = 2 << 20;
+  const int kFileSize = 5 * kWindowSize + 12345;
+
+  string data(kFileSize, '\0');
+  for (int i = 0; i < kFileSize; i++) {
+    data[i] = static_cast<char>(i * 7 % 251);
+  }
+  File::WriteStringToFileOrDie(data, filename);
+
+  int file = open(filename.c_str(), O_RDONLY | O_BINARY);
+  ASSERT_GE(file, 0);
+
+  {
+    // Any window size is rounded up to the 2MB alignment.
+    MmapInputStream input(file, 1);
+    string read;
+    const void* buffer;
+    int size;
+    while (input.Next(&buffer, &size)) {
+      EXPECT_LE(size, kWindowSize);
+      read.append(reinterpret_cast<const char*>(buffer), size);
+    }
+    EXPECT_TRUE(read == data);
+    EXPECT_EQ(kFileSize, input.ByteCount());
+  }
+
+  ASSERT_NE(lseek(file, 0, SEEK_SET), (off_t)-1);
+
+  {
+    // Skip and back up across window boundaries.
+    MmapInputStream input(file, kWindowSize);
+    const void* buffer;
+    int size;
+
+    EXPECT_TRUE(input.Skip(kWindowSize - 10));
+    ASSERT_TRUE(input.Next(&buffer, &size));
+    EXPECT_EQ(10, size);
+    input.BackUp(4);
+    ASSERT_TRUE(input.Next(&buffer, &size));
+    EXPECT_EQ(4, size);
+    EXPECT_EQ(data.substr(kWindowSize - 4, 4),
+              string(reinterpret_cast<const char*>(buffer), size));
+
+    EXPECT_TRUE(input.Skip(2 * kWindowSize + 100));
+    EXPECT_EQ(3 * kWindowSize + 100, input.ByteCount());
+    ASSERT_TRUE(input.Next(&buffer, &size));
+    EXPECT_EQ(kWindowSize - 100, size);
+    EXPECT_EQ(data.substr(3 * kWindowSize + 100, 16),
+              string(reinterpret_cast<const char*>(buffer), 16));
+    input.BackUp(size);
+
+    EXPECT_FALSE(input.Skip(kFileSize));
+    EXPECT_EQ(kFileSize, input.ByteCount());
+    EXPECT_FALSE(input.Next(&buffer, &size));
+  }
+
+  ASSERT_NE(lseek(file, 0, SEEK_SET), (off_t)-1);
+
+  {
+    // Window sizes too large to round up are capped rather than overflowing.
+    MmapInputStream input(file, kint32max);
+    const void* buffer;
+    int size;
+    ASSERT_TRUE(input.Next(&buffer, &size));
+    if (input.IsMapped()) EXPECT_EQ(kFileSize, size);
+  }
+
+  close(file);
+}
+
+// MmapInputStream should start at the descriptor's current offset, and leave
+// it just past whatever was consumed.
+TEST_F(IoTest, MmapFileOffset) {
+  string filename = TestTempDir() + "/zero_copy_stream_test_file";
+  File::WriteStringToFileOrDie("header:payload", filename);
+
+  int file = open(filename.c_str(), O_RDONLY | O_BINARY);
+  ASSERT_GE(file, 0);
+  ASSERT_EQ(7, lseek(file, 7, SEEK_SET));
+
+  {
+    MmapInputStream input(file);
+    ReadString(&input, "pay");
+    EXPECT_EQ(3, input.ByteCount());
+  }
+
+  EXPECT_EQ(10, lseek(file, 0, SEEK_CUR));
+  close(file);
+}
+
+// Pipes can't be mapped, so MmapInputStream has to fall back to reading them.
+TEST_F(IoTest, MmapPipeIo) {
+  int files[2];
+  ASSERT_EQ(pipe(files), 0);
+
+  {
+    FileOutputStream output(files[1]);
+    WriteStuff(&output);
+    EXPECT_EQ(0, output.GetErrno());
+  }
+  close(files[1]);  // Send EOF.
+
+  {
+    MmapInputStream input(files[0]);
+    EXPECT_FALSE(input.IsMapped());
+    ReadStuff(&input);
+    EXPECT_EQ(0, input.GetErrno());
+  }
+  close(files[0]);
+}
+
 // Test using C++ iostreams.
 TEST_F(IoTest, IostreamIo) {
   for (int i = 0; i < kBlockSizeCount; i++) {
@@ -0,0 +1,200 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// http://code.google.com/p/protobuf/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm>
+#include <google/protobuf/lazy_field.h>
+#include <google/protobuf/message_lite.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/stubs/once.h>
+
+namespace google {
+namespace protobuf {
+namespace internal {
+
+namespace {
+
+// Get() parses under a lock so that concurrent readers don't race.  Rather
+// than give every LazyField its own Mutex, fields share a small set of them,
+// picked by address.  Once a field is parsed its readers no longer lock, so
+// sharing only costs anything during the first access.
+const int kLazyFieldMutexCount = 16;
+Mutex* lazy_field_mutexes_ = NULL;
+GOOGLE_PROTOBUF_DECLARE_ONCE(lazy_field_mutexes_once_);
+
+void DeleteLazyFieldMutexes() {
+  delete [] lazy_field_mutexes_;
+  lazy_field_mutexes_ = NULL;
+}
+
+void InitLazyFieldMutexes() {
+  lazy_field_mutexes_ = new Mutex[kLazyFieldMutexCount];
+  OnShutdown(&DeleteLazyFieldMutexes);
+}
+
+Mutex* LazyFieldMutex(const LazyField* field) {
+  ::google::protobuf::GoogleOnceInit(&lazy_field_mutexes_once_,
+                                     &InitLazyFieldMutexes);
+  return &lazy_field_mutexes_[
+      (reinterpret_cast<uintptr_t>(field) / sizeof(void*)) %
+      kLazyFieldMutexCount];
+}
+
+}  // namespace
+
+LazyField::LazyField()
+  : bytes_valid_(true),
+    message_(NULL),
+    message_valid_(false) {
+}
+
+LazyField::~LazyField() {
+  delete message_;
+}
+
+void LazyField::ParseRetainedBytes() const {
+  // A failed parse leaves whatever could be parsed; the caller has no way to
+  // report an error, just as a corrupt embedded message would have failed
+  // the outer parse if the field weren't lazy.
+  message_->ParsePartialFromString(bytes_);
+  Release_Store(&message_valid_, true);
+}
+
+const MessageLite& LazyField::Get(const MessageLite& prototype) const {
+  if (Acquire_Load(&message_valid_)) return *message_;
+  // Const methods only allocate message_ when there are bytes to parse, so
+  // it can be read here without the lock.
+  if (bytes_valid_ && bytes_.empty() && message_ == NULL) return prototype;
+
+  MutexLock lock(LazyFieldMutex(this));
+  if (!message_valid_) {
+    if (message_ == NULL) {
+      if (bytes_.empty()) return prototype;
+      message_ = prototype.New();
+    }
+    ParseRetainedBytes();
+  }
+  return *message_;
+}
+
+bool LazyField::IsInitialized() const {
+  if (!Acquire_Load(&message_valid_)) return true;
+  return message_->IsInitialized();
+}
+
+MessageLite* LazyField::Mutable(const MessageLite& prototype) {
+  if (!message_valid_) {
+    if (message_ == NULL) message_ = prototype.New();
+    ParseRetainedBytes();
+  }
+  if (bytes_valid_) {
+    bytes_valid_ = false;
+    bytes_.clear();
+  }
+  return message_;
+}
+
+void LazyField::Clear() {
+  bytes_.clear();
+  bytes_valid_ = true;
+  message_valid_ = false;
+}
+
+void LazyField::MergeFrom(const LazyField& other,
+                          const MessageLite& prototype) {
+  if (bytes_valid_ && other.bytes_valid_) {
+    bytes_.append(other.bytes_);
+    message_valid_ = false;
+  } else {
+    Mutable(prototype)->CheckTypeAndMergeFrom(other.Get(prototype));
+  }
+}
+
+void LazyField::Swap(LazyField* other) {
+  bytes_.swap(other->bytes_);
+  std::swap(bytes_valid_, other->bytes_valid_);
+  std::swap(message_, other->message_);
+  std::swap(message_valid_, other->message_valid_);
+}
+
+bool LazyField::MergeFromCodedStream(io::CodedInputStream* input) {
+  if (!bytes_valid_) {
+    return WireFormatLite::ReadMessage(input, message_);
+  }
+
+  uint32 length;
+  if (!input->ReadVarint32(&length)) return false;
+  message_valid_ = false;
+  if (bytes_.empty()) {
+    return input->ReadString(&bytes_, length);
+  } else {
+    string more;
+    if (!input->ReadString(&more, length)) return false;
+    bytes_.append(more);
+    return true;
+  }
+}
+
+int LazyField::ByteSize() const {
+  if (bytes_valid_) return bytes_.size();
+  return message_->ByteSize();
+}
+
+void LazyField::SerializeWithCachedSizes(
+    io::CodedOutputStream* output) const {
+  if (bytes_valid_) {
+    output->WriteVarint32(bytes_.size());
+    output->WriteString(bytes_);
+  } else {
+    output->WriteVarint32(message_->GetCachedSize());
+    message_->SerializeWithCachedSizes(output);
+  }
+}
+
+uint8* LazyField::SerializeWithCachedSizesToArray(uint8* target) const {
+  if (bytes_valid_) {
+    target = io::CodedOutputStream::WriteVarint32ToArray(bytes_.size(),
+                                                         target);
+    return io::CodedOutputStream::WriteStringToArray(bytes_, target);
+  } else {
+    target = io::CodedOutputStream::WriteVarint32ToArray(
+        message_->GetCachedSize(), target);
+    return message_->SerializeWithCachedSizesToArray(target);
+  }
+}
+
+int LazyField::SpaceUsedExcludingSelf() const {
+  return bytes_.capacity();
+}
+
+}  // namespace internal
+}  // namespace protobuf
+}  // namespace google
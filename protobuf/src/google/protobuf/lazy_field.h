@@ -0,0 +1,146 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// http://code.google.com/p/protobuf/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// This header is logically internal, but is made public because it is used
+// from protocol-compiler-generated code, which may reside in other components.
+//
+// LazyField is the representation of singular message fields declared with
+// [lazy=true]:
+//
+//   message Envelope {
+//     optional Header header = 1;
+//     optional Payload payload = 2 [lazy=true];
+//   }
+//
+// When an Envelope is parsed, payload's encoded bytes are stored as they are.
+// They are parsed the first time payload() or mutable_payload() is called,
+// and if payload is never modified, serializing the Envelope copies the
+// original bytes back out.  Code which only looks at the header thus never
+// pays for parsing the payload.
+
+#ifndef GOOGLE_PROTOBUF_LAZY_FIELD_H__
+#define GOOGLE_PROTOBUF_LAZY_FIELD_H__
+
+#include <string>
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/stubs/atomicops.h>
+
+namespace google {
+
+namespace protobuf {
+  class MessageLite;                    // message_lite.h
+  namespace io {
+    class CodedInputStream;             // coded_stream.h
+    class CodedOutputStream;            // coded_stream.h
+  }
+}
+
+namespace protobuf {
+namespace internal {
+
+class LIBPROTOBUF_EXPORT LazyField {
+ public:
+  LazyField();
+  ~LazyField();
+
+  // Returns the field's message, parsing the retained bytes on first use.
+  // Returns prototype itself if the field is empty and no message has been
+  // allocated yet.  Like other const accessors, this may be called from
+  // several threads at once; only the first call takes a lock.  If the bytes
+  // turn out to be malformed, the message holds whatever could be parsed.
+  const MessageLite& Get(const MessageLite& prototype) const;
+
+  // Returns true if the field's message has all its required fields set.
+  // Bytes which have not been parsed yet are assumed to be initialized,
+  // since they were checked when they were serialized, so this never forces
+  // a parse.
+  bool IsInitialized() const;
+
+  // Returns the field's message for modification, parsing the retained
+  // bytes first if necessary.  The bytes are then discarded, since they may
+  // no longer match the message.
+  MessageLite* Mutable(const MessageLite& prototype);
+
+  // Empties the field, keeping any allocated message around for reuse.
+  void Clear();
+
+  // Merges other into this field.  If neither field holds a modified
+  // message, this just concatenates the encoded bytes, which is how the
+  // wire format merges embedded messages anyway.
+  void MergeFrom(const LazyField& other, const MessageLite& prototype);
+
+  void Swap(LazyField* other);
+
+  // Reads a length-delimited value from input and merges it into the field.
+  // The value is only parsed if the field already holds a modified message.
+  bool MergeFromCodedStream(io::CodedInputStream* input);
+
+  // Returns the size of the field's encoded value, not counting its tag or
+  // length prefix.  Must be called before SerializeWithCachedSizes() so that
+  // a modified message can cache its size.
+  int ByteSize() const;
+
+  // Writes the length prefix and encoded value, without a tag.
+  void SerializeWithCachedSizes(io::CodedOutputStream* output) const;
+  uint8* SerializeWithCachedSizesToArray(uint8* target) const;
+
+  // True if the field still holds the bytes it was parsed from, i.e. no
+  // message has been modified through Mutable().
+  bool HasRetainedBytes() const { return bytes_valid_; }
+
+  // The message the field has allocated, or NULL.  Used for SpaceUsed().
+  const MessageLite* allocated_message() const { return message_; }
+
+  // Memory used by the retained bytes.
+  int SpaceUsedExcludingSelf() const;
+
+ private:
+  // Parses bytes_ into message_, which must be non-NULL.
+  void ParseRetainedBytes() const;
+
+  // The field's value is bytes_ when bytes_valid_, and *message_ when
+  // message_valid_.  At least one of the two always holds; if both do, they
+  // agree.  message_ may be allocated but stale so that it can be reused.
+  //
+  // Get() sets message_valid_ with a release store once message_ has been
+  // parsed, so that later calls can return it without locking.
+  string bytes_;
+  bool bytes_valid_;
+  mutable MessageLite* message_;
+  mutable Atomic32 message_valid_;
+
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(LazyField);
+};
+
+}  // namespace internal
+}  // namespace protobuf
+
+}  // namespace google
+#endif  // GOOGLE_PROTOBUF_LAZY_FIELD_H__
@@ -0,0 +1,258 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// http://code.google.com/p/protobuf/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <string>
+
+#include <google/protobuf/lazy_field.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/descriptor.pb.h>
+#include <google/protobuf/dynamic_message.h>
+#include <google/protobuf/test_util.h>
+#include <google/protobuf/unittest.pb.h>
+#include <google/protobuf/unittest_table_driven.pb.h>
+#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl.h>
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/testing/googletest.h>
+#include <gtest/gtest.h>
+
+namespace google {
+namespace protobuf {
+namespace internal {
+namespace {
+
+// Builds a serialized TestLazyMessage with both children set.
+string MakeSerializedLazyMessage() {
+  protobuf_unittest::TestAllTypes child;
+  TestUtil::SetAllFields(&child);
+
+  protobuf_unittest::TestLazyMessage message;
+  message.set_id(42);
+  message.mutable_lazy_child()->CopyFrom(child);
+  message.mutable_eager_child()->CopyFrom(child);
+  return message.SerializeAsString();
+}
+
+TEST(LazyFieldTest, Empty) {
+  LazyField field;
+  const protobuf_unittest::TestAllTypes& prototype =
+      protobuf_unittest::TestAllTypes::default_instance();
+  EXPECT_EQ(&prototype, &field.Get(prototype));
+  EXPECT_EQ(0, field.ByteSize());
+  EXPECT_TRUE(field.allocated_message() == NULL);
+}
+
+TEST(LazyFieldTest, ParseAndGet) {
+  protobuf_unittest::TestLazyMessage message;
+  ASSERT_TRUE(message.ParseFromString(MakeSerializedLazyMessage()));
+
+  EXPECT_EQ(42, message.id());
+  EXPECT_TRUE(message.has_lazy_child());
+  TestUtil::ExpectAllFieldsSet(message.lazy_child());
+  TestUtil::ExpectAllFieldsSet(message.eager_child());
+}
+
+TEST(LazyFieldTest, UntouchedFieldIsReserializedVerbatim) {
+  // Encode lazy_child by hand with a duplicated field, which a parsed and
+  // reserialized message would collapse.
+  string child_bytes;
+  {
+    protobuf_unittest::TestAllTypes child;
+    child.set_optional_int32(1);
+    child_bytes = child.SerializeAsString();
+    child.set_optional_int32(2);
+    child_bytes += child.SerializeAsString();
+  }
+  string data;
+  {
+    io::StringOutputStream raw_output(&data);
+    io::CodedOutputStream output(&raw_output);
+    WireFormatLite::WriteBytes(2, child_bytes, &output);
+  }
+
+  protobuf_unittest::TestLazyMessage message;
+  ASSERT_TRUE(message.ParseFromString(data));
+  EXPECT_EQ(data, message.SerializeAsString());
+
+  // Reading the field does not change the output either.
+  EXPECT_EQ(2, message.lazy_child().optional_int32());
+  EXPECT_EQ(data, message.SerializeAsString());
+  EXPECT_EQ(data.size(), message.ByteSize());
+
+  // Modifying it does.
+  message.mutable_lazy_child()->set_optional_int32(3);
+  protobuf_unittest::TestLazyMessage expected;
+  expected.mutable_lazy_child()->set_optional_int32(3);
+  EXPECT_EQ(expected.SerializeAsString(), message.SerializeAsString());
+}
+
+TEST(LazyFieldTest, MutableWithoutParse) {
+  protobuf_unittest::TestLazyMessage message;
+  TestUtil::SetAllFields(message.mutable_lazy_child());
+
+  protobuf_unittest::TestLazyMessage parsed;
+  ASSERT_TRUE(parsed.ParseFromString(message.SerializeAsString()));
+  TestUtil::ExpectAllFieldsSet(parsed.lazy_child());
+}
+
+TEST(LazyFieldTest, MergeFrom) {
+  protobuf_unittest::TestLazyMessage message1, message2;
+  ASSERT_TRUE(message1.ParseFromString(
+      "\x12\x02\x08\x01"));                    // lazy_child.optional_int32 = 1
+  ASSERT_TRUE(message2.ParseFromString(
+      "\x12\x02\x10\x02"));                    // lazy_child.optional_int64 = 2
+
+  // Both fields still hold bytes, so merging concatenates them.
+  message1.MergeFrom(message2);
+  EXPECT_EQ(1, message1.lazy_child().optional_int32());
+  EXPECT_EQ(2, message1.lazy_child().optional_int64());
+
+  // Merging into a modified message parses the source.
+  protobuf_unittest::TestLazyMessage message3;
+  message3.mutable_lazy_child()->set_optional_uint32(3);
+  message3.MergeFrom(message2);
+  EXPECT_EQ(3, message3.lazy_child().optional_uint32());
+  EXPECT_EQ(2, message3.lazy_child().optional_int64());
+}
+
+TEST(LazyFieldTest, MergeFromCodedStreamIntoModifiedMessage) {
+  protobuf_unittest::TestLazyMessage message;
+  message.mutable_lazy_child()->set_optional_int32(1);
+  io::CodedInputStream input(
+      reinterpret_cast<const uint8*>("\x12\x02\x10\x02"), 4);
+  ASSERT_TRUE(message.MergeFromCodedStream(&input));
+  EXPECT_EQ(1, message.lazy_child().optional_int32());
+  EXPECT_EQ(2, message.lazy_child().optional_int64());
+}
+
+TEST(LazyFieldTest, SwapAndClear) {
+  protobuf_unittest::TestLazyMessage message1, message2;
+  ASSERT_TRUE(message1.ParseFromString(MakeSerializedLazyMessage()));
+  message2.mutable_lazy_child()->set_optional_int32(7);
+
+  message1.Swap(&message2);
+  EXPECT_EQ(7, message1.lazy_child().optional_int32());
+  TestUtil::ExpectAllFieldsSet(message2.lazy_child());
+
+  message2.Clear();
+  EXPECT_FALSE(message2.has_lazy_child());
+  TestUtil::ExpectClear(message2.lazy_child());
+  EXPECT_EQ(0, message2.ByteSize());
+}
+
+TEST(LazyFieldTest, IsInitialized) {
+  protobuf_unittest::TestLazyMessage message;
+  EXPECT_TRUE(message.IsInitialized());
+
+  // lazy_required is missing b and c, but IsInitialized() doesn't parse it
+  // to find out.
+  ASSERT_TRUE(message.ParsePartialFromString("\x22\x02\x08\x01"));
+  EXPECT_TRUE(message.IsInitialized());
+  // Once the field has been parsed, its contents are checked.
+  EXPECT_EQ(1, message.lazy_required().a());
+  EXPECT_FALSE(message.IsInitialized());
+
+  message.mutable_lazy_required()->set_b(2);
+  message.mutable_lazy_required()->set_c(3);
+  EXPECT_TRUE(message.IsInitialized());
+}
+
+TEST(LazyFieldTest, MalformedBytesAreDetectedOnAccess) {
+  // lazy_child contains a truncated varint.  The parse of the outer message
+  // succeeds since the bytes are not looked at yet.
+  protobuf_unittest::TestLazyMessage message;
+  ASSERT_TRUE(message.ParseFromString("\x12\x02\x08\x80"));
+  EXPECT_TRUE(message.has_lazy_child());
+  EXPECT_FALSE(message.lazy_child().has_optional_int32());
+}
+
+TEST(LazyFieldTest, Reflection) {
+  protobuf_unittest::TestLazyMessage message;
+  ASSERT_TRUE(message.ParseFromString(MakeSerializedLazyMessage()));
+
+  const Reflection* reflection = message.GetReflection();
+  const FieldDescriptor* field =
+      message.GetDescriptor()->FindFieldByName("lazy_child");
+  ASSERT_TRUE(field != NULL);
+  EXPECT_TRUE(field->options().lazy());
+
+  EXPECT_TRUE(reflection->HasField(message, field));
+  const protobuf_unittest::TestAllTypes& child =
+      static_cast<const protobuf_unittest::TestAllTypes&>(
+          reflection->GetMessage(message, field));
+  EXPECT_EQ(&message.lazy_child(), &child);
+  TestUtil::ExpectAllFieldsSet(child);
+  EXPECT_GT(message.SpaceUsed(), child.SpaceUsed());
+
+  protobuf_unittest::TestAllTypes* mutable_child =
+      static_cast<protobuf_unittest::TestAllTypes*>(
+          reflection->MutableMessage(&message, field));
+  mutable_child->set_optional_int32(1234);
+  EXPECT_EQ(1234, message.lazy_child().optional_int32());
+
+  reflection->ClearField(&message, field);
+  EXPECT_FALSE(message.has_lazy_child());
+}
+
+TEST(LazyFieldTest, DynamicMessage) {
+  DynamicMessageFactory factory;
+  const Message* prototype =
+      factory.GetPrototype(protobuf_unittest::TestLazyMessage::descriptor());
+  scoped_ptr<Message> message(prototype->New());
+  string data = MakeSerializedLazyMessage();
+  ASSERT_TRUE(message->ParseFromString(data));
+
+  protobuf_unittest::TestLazyMessage generated;
+  ASSERT_TRUE(generated.ParseFromString(message->SerializeAsString()));
+  EXPECT_EQ(42, generated.id());
+  TestUtil::ExpectAllFieldsSet(generated.lazy_child());
+
+  scoped_ptr<Message> swapped(prototype->New());
+  message->GetReflection()->Swap(message.get(), swapped.get());
+  EXPECT_EQ(0, message->ByteSize());
+  EXPECT_EQ(data.size(), swapped->ByteSize());
+}
+
+TEST(LazyFieldTest, TableDrivenParse) {
+  protobuf_unittest::TestTableDrivenLazyMessage message;
+  string data = MakeSerializedLazyMessage();
+  ASSERT_TRUE(message.ParseFromString(data));
+  EXPECT_TRUE(message.has_lazy_child());
+  EXPECT_EQ(data, message.SerializeAsString());
+  TestUtil::ExpectAllFieldsSet(message.lazy_child());
+  TestUtil::ExpectAllFieldsSet(message.eager_child());
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace protobuf
+}  // namespace google
@@ -34,6 +34,7 @@
 #include <iostream>
 
 #include <google/protobuf/test_util_lite.h>
+#include <google/protobuf/unittest_table_driven_lite.pb.h>
 #include <google/protobuf/stubs/common.h>
 
 using namespace std;
@@ -107,6 +108,32 @@ int main(int argc, char* argv[]) {
     google::protobuf::TestUtilLite::ExpectPackedExtensionsClear(message);
   }
 
+  {
+    // Table-driven parsing must accept exactly what the generated parser
+    // does, and reproduce the same bytes.
+    protobuf_unittest::TestTableDrivenAllTypesLite message;
+    GOOGLE_CHECK(message.ParseFromString(data));
+    GOOGLE_CHECK(message.SerializeAsString() == data);
+    GOOGLE_CHECK(message.ParseFromString(data));
+    GOOGLE_CHECK(message.SerializeAsString() == data);
+
+    protobuf_unittest::TestAllTypesLite message2;
+    message2.ParseFromString(message.SerializeAsString());
+    google::protobuf::TestUtilLite::ExpectAllFieldsSet(message2);
+
+    // Unknown fields are dropped; extensions are parsed.
+    protobuf_unittest::TestTableDrivenSparseLite sparse, sparse2;
+    sparse.SetExtension(protobuf_unittest::sparse_int32_extension_lite, 7);
+    sparse.AddExtension(protobuf_unittest::sparse_string_extension_lite, "a");
+    GOOGLE_CHECK(sparse2.ParseFromString(data + sparse.SerializeAsString()));
+    GOOGLE_CHECK_EQ(101, sparse2.optional_int32());
+    GOOGLE_CHECK_EQ(2, sparse2.repeated_int32_size());
+    GOOGLE_CHECK_EQ(7, sparse2.GetExtension(
+        protobuf_unittest::sparse_int32_extension_lite));
+    GOOGLE_CHECK_EQ(1, sparse2.ExtensionSize(
+        protobuf_unittest::sparse_string_extension_lite));
+  }
+
   cout << "PASS" << endl;
   return 0;
 }
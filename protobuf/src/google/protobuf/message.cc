@@ -39,6 +39,8 @@
 #include <google/protobuf/message.h>
 
 #include <google/protobuf/stubs/common.h>
+#include <google/protobuf/stubs/flat_hash_map.h>
+#include <google/protobuf/stubs/lockfree_hash_map.h>
 #include <google/protobuf/stubs/once.h>
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/io/zero_copy_stream_impl.h>
@@ -184,6 +186,15 @@ bool Message::SerializePartialToOstream(ostream* output) const {
 
 Reflection::~Reflection() {}
 
+const internal::ExtensionSet* Reflection::GetExtensionSetForWireFormat(
+    const Message& message) const {
+  return NULL;
+}
+
+const internal::WireFormatPlan* Reflection::GetWireFormatPlan() const {
+  return NULL;
+}
+
 // ===================================================================
 // MessageFactory
 
@@ -207,12 +218,13 @@ class GeneratedMessageFactory : public MessageFactory {
 
  private:
   // Only written at static init time, so does not require locking.
-  hash_map<const char*, RegistrationFunc*,
-           hash<const char*>, streq> file_map_;
+  internal::FlatHashMap<const char*, RegistrationFunc*,
+                        hash<const char*>, streq> file_map_;
 
-  // Initialized lazily, so requires locking.
+  // Initialized lazily.  GetPrototype() searches type_map_ without locking;
+  // mutex_ serializes registrations.
   Mutex mutex_;
-  hash_map<const Descriptor*, const Message*> type_map_;
+  internal::LockFreeHashMap<const Descriptor*, const Message*> type_map_;
 };
 
 GeneratedMessageFactory* generated_message_factory_ = NULL;
@@ -253,17 +265,16 @@ void GeneratedMessageFactory::RegisterType(const Descriptor* descriptor,
   // function during GetPrototype(), in which case we already have locked
   // the mutex.
   mutex_.AssertHeld();
-  if (!InsertIfNotPresent(&type_map_, descriptor, prototype)) {
+  if (type_map_.Find(descriptor) != NULL) {
     GOOGLE_LOG(DFATAL) << "Type is already registered: " << descriptor->full_name();
+    return;
   }
+  type_map_.Insert(descriptor, prototype);
 }
 
 const Message* GeneratedMessageFactory::GetPrototype(const Descriptor* type) {
-  {
-    ReaderMutexLock lock(&mutex_);
-    const Message* result = FindPtrOrNull(type_map_, type);
-    if (result != NULL) return result;
-  }
+  const Message* result = type_map_.Find(type);
+  if (result != NULL) return result;
 
   // If the type is not in the generated pool, then we can't possibly handle
   // it.
@@ -281,12 +292,12 @@ const Message* GeneratedMessageFactory::GetPrototype(const Descriptor* type) {
   WriterMutexLock lock(&mutex_);
 
   // Check if another thread preempted us.
-  const Message* result = FindPtrOrNull(type_map_, type);
+  result = type_map_.Find(type);
   if (result == NULL) {
     // Nope.  OK, register everything.
     registration_func(type->file()->name());
     // Should be here now.
-    result = FindPtrOrNull(type_map_, type);
+    result = type_map_.Find(type);
   }
 
   if (result == NULL) {
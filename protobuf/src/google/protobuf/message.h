@@ -162,6 +162,11 @@ namespace io {
   class CodedOutputStream;     // coded_stream.h
 }
 class UnknownFieldSet;       // unknown_field_set.h
+namespace internal {
+  class ExtensionSet;          // extension_set.h
+  class WireFormat;            // wire_format.h
+  class WireFormatPlan;        // wire_format.cc
+}
 
 // A container to hold message metadata.
 struct Metadata {
@@ -638,6 +643,17 @@ class LIBPROTOBUF_EXPORT Reflection {
       int number) const = 0;
 
  private:
+  friend class internal::WireFormat;
+
+  // These let WireFormat serialize without calling ListFields().  The
+  // defaults return NULL, which makes WireFormat fall back to ListFields().
+  //
+  // Returns the ExtensionSet holding the message's extensions, or NULL.
+  virtual const internal::ExtensionSet* GetExtensionSetForWireFormat(
+      const Message& message) const;
+  // Returns WireFormat::GetPlan()'s plan for this type, or NULL.
+  virtual const internal::WireFormatPlan* GetWireFormatPlan() const;
+
   GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(Reflection);
 };
 
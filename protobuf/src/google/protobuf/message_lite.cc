@@ -35,6 +35,7 @@
 
 #include <google/protobuf/message_lite.h>
 #include <string>
+#include <google/protobuf/arena.h>
 #include <google/protobuf/stubs/common.h>
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/io/zero_copy_stream_impl.h>
@@ -45,6 +46,16 @@ namespace protobuf {
 
 MessageLite::~MessageLite() {}
 
+Arena* MessageLite::GetArena() const {
+  return NULL;
+}
+
+MessageLite* MessageLite::NewOnArena(Arena* arena) const {
+  MessageLite* message = New();
+  if (arena != NULL) arena->Own(message);
+  return message;
+}
+
 string MessageLite::InitializationErrorString() const {
   return "(cannot determine missing fields for lite message)";
 }
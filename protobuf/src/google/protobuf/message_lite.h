@@ -45,6 +45,8 @@
 namespace google {
 namespace protobuf {
 
+class Arena;                                    // arena.h
+
 // Interface to light weight protocol messages.
 //
 // This interface is implemented by all protocol message objects.  Non-lite
@@ -82,6 +84,17 @@ class LIBPROTOBUF_EXPORT MessageLite {
   // caller.
   virtual MessageLite* New() const = 0;
 
+  // Get the arena this message and its fields are allocated on, or NULL if
+  // it lives on the heap.  Only classes generated with cc_enable_arenas
+  // can be placed on an arena; see arena.h.
+  virtual Arena* GetArena() const;
+
+  // Construct a new instance of the same type on arena, or on the heap if
+  // arena is NULL.  Classes generated with cc_enable_arenas are constructed
+  // on the arena directly; any other message is allocated on the heap and
+  // handed to the arena to delete.
+  virtual MessageLite* NewOnArena(Arena* arena) const;
+
   // Clear all fields of the message and set them to their default values.
   // Clear() avoids freeing memory, assuming that any memory allocated
   // to hold parts of the message will be needed again to hold the next
@@ -161,6 +174,11 @@ class LIBPROTOBUF_EXPORT MessageLite {
   // Serialization ---------------------------------------------------
   // Methods for serializing in protocol buffer format.  Most of these
   // are just simple wrappers around ByteSize() and SerializeWithCachedSizes().
+  //
+  // Serializing updates the message's cached sizes (see GetCachedSize()),
+  // but they are stored atomically and every thread computes the same
+  // values, so a message which is not being modified may be serialized by
+  // several threads at once.
 
   // Write a protocol buffer of this message to the given output.  Returns
   // false on a write error.  If the message is missing required fields,
@@ -42,10 +42,16 @@
 #else
 #include <unistd.h>
 #endif
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
 #include <sstream>
 #include <fstream>
 
 #include <google/protobuf/stubs/common.h>
+#include <google/protobuf/stubs/stl_util-inl.h>
 #include <google/protobuf/io/zero_copy_stream_impl.h>
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/descriptor.h>
@@ -257,6 +263,94 @@ TEST(MessageTest, ParseFailsOnInvalidMessageEnd) {
   EXPECT_FALSE(message.ParseFromArray("\014", 1));
 }
 
+namespace {
+
+// Serializes a shared message over and over, recording whether every
+// serialization matched the expected bytes.
+class SerializerThread {
+ public:
+  SerializerThread(const Message* message, const string* expected)
+      : message_(message), expected_(expected), all_matched_(true) {
+#ifdef _WIN32
+    thread_ = CreateThread(NULL, 0, &Start, this, 0, NULL);
+#else
+    pthread_create(&thread_, NULL, &Start, this);
+#endif
+  }
+
+  void Join() {
+#ifdef _WIN32
+    WaitForSingleObject(thread_, INFINITE);
+    CloseHandle(thread_);
+#else
+    pthread_join(thread_, NULL);
+#endif
+  }
+
+  bool all_matched() const { return all_matched_; }
+
+ private:
+#ifdef _WIN32
+  HANDLE thread_;
+
+  static DWORD WINAPI Start(LPVOID arg) {
+#else
+  pthread_t thread_;
+
+  static void* Start(void* arg) {
+#endif
+    reinterpret_cast<SerializerThread*>(arg)->Run();
+    return 0;
+  }
+
+  void Run() {
+    string buffer(expected_->size(), '\0');
+    for (int i = 0; i < 1000; i++) {
+      if (!message_->SerializeToArray(string_as_array(&buffer),
+                                      buffer.size()) ||
+          buffer != *expected_) {
+        all_matched_ = false;
+      }
+    }
+  }
+
+  const Message* message_;
+  const string* expected_;
+  bool all_matched_;
+};
+
+// Serializes message from several threads at once and checks that each of
+// them gets the same bytes as a serialization on this thread.
+void ExpectConcurrentSerializationMatches(const Message& message) {
+  const string expected = message.SerializeAsString();
+
+  const int kThreadCount = 4;
+  SerializerThread* threads[kThreadCount];
+  for (int i = 0; i < kThreadCount; i++) {
+    threads[i] = new SerializerThread(&message, &expected);
+  }
+  for (int i = 0; i < kThreadCount; i++) {
+    threads[i]->Join();
+    EXPECT_TRUE(threads[i]->all_matched());
+    delete threads[i];
+  }
+}
+
+}  // namespace
+
+TEST(MessageTest, ConcurrentSerialization) {
+  // Serializing only writes the (atomic) cached sizes, so one message can be
+  // serialized by several threads at once.
+  unittest::TestAllTypes message;
+  TestUtil::SetAllFields(&message);
+  ExpectConcurrentSerializationMatches(message);
+
+  // Packed fields also cache the size of their data.
+  unittest::TestPackedTypes packed_message;
+  TestUtil::SetPackedFields(&packed_message);
+  ExpectConcurrentSerializationMatches(packed_message);
+}
+
 TEST(MessageFactoryTest, GeneratedFactoryLookup) {
   EXPECT_EQ(
     MessageFactory::generated_factory()->GetPrototype(
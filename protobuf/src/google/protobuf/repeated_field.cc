@@ -44,14 +44,17 @@ void RepeatedPtrFieldBase::Reserve(int new_size) {
 
   void** old_elements = elements_;
   total_size_ = max(total_size_ * 2, new_size);
-  elements_ = new void*[total_size_];
+  elements_ = Arena::CreateArray<void*>(arena_, total_size_);
   memcpy(elements_, old_elements, allocated_size_ * sizeof(elements_[0]));
-  if (old_elements != initial_space_) {
+  if (old_elements != initial_space_ && arena_ == NULL) {
     delete [] old_elements;
   }
 }
 
 void RepeatedPtrFieldBase::Swap(RepeatedPtrFieldBase* other) {
+  GOOGLE_DCHECK(arena_ == other->arena_)
+      << "Cannot swap the arrays of fields on different arenas.";
+
   void** swap_elements       = elements_;
   int    swap_current_size   = current_size_;
   int    swap_allocated_size = allocated_size_;
@@ -81,8 +84,8 @@ void RepeatedPtrFieldBase::Swap(RepeatedPtrFieldBase* other) {
   }
 }
 
-string* StringTypeHandlerBase::New() {
-  return new string;
+string* StringTypeHandlerBase::New(Arena* arena) {
+  return Arena::Create<string>(arena);
 }
 void StringTypeHandlerBase::Delete(string* value) {
   delete value;
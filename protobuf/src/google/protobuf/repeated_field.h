@@ -49,6 +49,7 @@
 #include <string>
 #include <iterator>
 #include <google/protobuf/stubs/common.h>
+#include <google/protobuf/arena.h>
 #include <google/protobuf/message_lite.h>
 
 namespace google {
@@ -72,6 +73,9 @@ template <typename Element>
 class RepeatedField {
  public:
   RepeatedField();
+  // Constructs a RepeatedField whose array is allocated on |arena|.  The
+  // array is then never freed individually; it goes away with the arena.
+  explicit RepeatedField(Arena* arena);
   ~RepeatedField();
 
   int size() const;
@@ -100,6 +104,10 @@ class RepeatedField {
 
   void AddAlreadyReserved(const Element& value);
   Element* AddAlreadyReserved();
+  // Appends the given number of elements, which must already have been
+  // reserved, without initializing them, and returns a pointer to the first.
+  // The caller is expected to fill them in (e.g. with memcpy()).
+  Element* AddNAlreadyReserved(int elements);
   int Capacity() const;
 
   // Gets the underlying array.  This pointer is possibly invalidated by
@@ -107,12 +115,16 @@ class RepeatedField {
   Element* mutable_data();
   const Element* data() const;
 
-  // Swap entire contents with "other".
+  // Swap entire contents with "other".  If the two fields live on different
+  // arenas the contents are copied rather than swapped.
   void Swap(RepeatedField* other);
 
   // Swap two elements.
   void SwapElements(int index1, int index2);
 
+  // The arena the array is allocated on, or NULL if it is on the heap.
+  Arena* GetArena() const { return arena_; }
+
   // STL-like iterator support
   typedef Element* iterator;
   typedef const Element* const_iterator;
@@ -134,9 +146,13 @@ class RepeatedField {
   Element* elements_;
   int      current_size_;
   int      total_size_;
+  Arena*   arena_;
 
   Element  initial_space_[kInitialSize];
 
+  // Swaps the arrays of two fields on the same arena.
+  void InternalSwap(RepeatedField* other);
+
   // Move the contents of |from| into |to|, possibly clobbering |from| in the
   // process.  For primitive types this is just a memcpy(), but it could be
   // specialized for non-primitive types to, say, swap each element instead.
@@ -161,7 +177,7 @@ namespace internal {
 //   class TypeHandler {
 //    public:
 //     typedef MyType Type;
-//     static Type* New();
+//     static Type* New(Arena* arena);  // "new Type" if arena is NULL.
 //     static void Delete(Type*);
 //     static void Clear(Type*);
 //     static void Merge(const Type& from, Type* to);
@@ -183,7 +199,12 @@ class LIBPROTOBUF_EXPORT RepeatedPtrFieldBase {
   // use of AddFromCleared(), which is not part of the public interface.
   friend class ExtensionSet;
 
+  // The table-driven parser adds elements to repeated message fields the
+  // same way ExtensionSet does.
+  friend class ParseTableHelper;
+
   RepeatedPtrFieldBase();
+  explicit RepeatedPtrFieldBase(Arena* arena);
 
   // Must be called from destructor.
   template <typename TypeHandler>
@@ -217,6 +238,8 @@ class LIBPROTOBUF_EXPORT RepeatedPtrFieldBase {
   template <typename TypeHandler>
   const typename TypeHandler::Type* const* data() const;
 
+  // Swaps the pointer arrays.  Both fields must be on the same arena;
+  // RepeatedPtrField::Swap() handles the other case by copying.
   void Swap(RepeatedPtrFieldBase* other);
 
   void SwapElements(int index1, int index2);
@@ -224,6 +247,8 @@ class LIBPROTOBUF_EXPORT RepeatedPtrFieldBase {
   template <typename TypeHandler>
   int SpaceUsedExcludingSelf() const;
 
+  Arena* GetArena() const { return arena_; }
+
 
   // Advanced memory management --------------------------------------
 
@@ -233,6 +258,10 @@ class LIBPROTOBUF_EXPORT RepeatedPtrFieldBase {
 
   template <typename TypeHandler>
   void AddAllocated(typename TypeHandler::Type* value);
+  // Like AddAllocated(), but value must already belong to the field's arena
+  // (or be on the heap if the field is), so the arena is not told to own it.
+  template <typename TypeHandler>
+  void UnsafeArenaAddAllocated(typename TypeHandler::Type* value);
   template <typename TypeHandler>
   typename TypeHandler::Type* ReleaseLast();
 
@@ -251,6 +280,7 @@ class LIBPROTOBUF_EXPORT RepeatedPtrFieldBase {
   int    current_size_;
   int    allocated_size_;
   int    total_size_;
+  Arena* arena_;
 
   void*  initial_space_[kInitialSize];
 
@@ -268,7 +298,9 @@ template <typename GenericType>
 class GenericTypeHandler {
  public:
   typedef GenericType Type;
-  static GenericType* New() { return new GenericType; }
+  static GenericType* New(Arena* arena) {
+    return Arena::CreateMessage<GenericType>(arena);
+  }
   static void Delete(GenericType* value) { delete value; }
   static void Clear(GenericType* value) { value->Clear(); }
   static void Merge(const GenericType& from, GenericType* to) {
@@ -294,7 +326,7 @@ inline void GenericTypeHandler<MessageLite>::Merge(
 class LIBPROTOBUF_EXPORT StringTypeHandlerBase {
  public:
   typedef string Type;
-  static string* New();
+  static string* New(Arena* arena);
   static void Delete(string* value);
   static void Clear(string* value) { value->clear(); }
   static void Merge(const string& from, string* to) { *to = from; }
@@ -316,6 +348,9 @@ template <typename Element>
 class RepeatedPtrField : public internal::RepeatedPtrFieldBase {
  public:
   RepeatedPtrField();
+  // Constructs a RepeatedPtrField whose pointer array and elements are all
+  // allocated on |arena|.
+  explicit RepeatedPtrField(Arena* arena);
 
   ~RepeatedPtrField();
 
@@ -340,12 +375,16 @@ class RepeatedPtrField : public internal::RepeatedPtrFieldBase {
   Element** mutable_data();
   const Element* const* data() const;
 
-  // Swap entire contents with "other".
+  // Swap entire contents with "other".  If the two fields live on different
+  // arenas the contents are copied rather than swapped.
   void Swap(RepeatedPtrField* other);
 
   // Swap two elements.
   void SwapElements(int index1, int index2);
 
+  // The arena the elements are allocated on, or NULL if they are on the heap.
+  Arena* GetArena() const;
+
   // STL-like iterator support
   typedef internal::RepeatedPtrIterator<Element> iterator;
   typedef internal::RepeatedPtrIterator<const Element> const_iterator;
@@ -375,10 +414,12 @@ class RepeatedPtrField : public internal::RepeatedPtrFieldBase {
   // does here at Google -- the following methods may be useful.
 
   // Add an already-allocated object, passing ownership to the
-  // RepeatedPtrField.
+  // RepeatedPtrField.  If the field is on an arena, the arena takes
+  // ownership of the object.
   void AddAllocated(Element* value);
   // Remove the last element and return it, passing ownership to the
-  // caller.
+  // caller.  If the field is on an arena, a heap-allocated copy of the
+  // element is returned instead.
   // Requires:  size() > 0
   Element* ReleaseLast();
 
@@ -399,7 +440,8 @@ class RepeatedPtrField : public internal::RepeatedPtrFieldBase {
   // this method.
   void AddCleared(Element* value);
   // Remove a single element from the cleared pool and return it, passing
-  // ownership to the caller.  The element is guaranteed to be cleared.
+  // ownership to the caller.  The element is guaranteed to be cleared.  If
+  // the field is on an arena, a new heap-allocated element is returned.
   // Requires:  ClearedCount() > 0
   Element* ReleaseCleared();
 
@@ -421,12 +463,21 @@ template <typename Element>
 inline RepeatedField<Element>::RepeatedField()
   : elements_(initial_space_),
     current_size_(0),
-    total_size_(kInitialSize) {
+    total_size_(kInitialSize),
+    arena_(NULL) {
+}
+
+template <typename Element>
+inline RepeatedField<Element>::RepeatedField(Arena* arena)
+  : elements_(initial_space_),
+    current_size_(0),
+    total_size_(kInitialSize),
+    arena_(arena) {
 }
 
 template <typename Element>
 RepeatedField<Element>::~RepeatedField() {
-  if (elements_ != initial_space_) {
+  if (elements_ != initial_space_ && arena_ == NULL) {
     delete [] elements_;
   }
 }
@@ -453,6 +504,14 @@ inline Element* RepeatedField<Element>::AddAlreadyReserved() {
   return &elements_[current_size_++];
 }
 
+template<typename Element>
+inline Element* RepeatedField<Element>::AddNAlreadyReserved(int elements) {
+  GOOGLE_DCHECK_LE(size() + elements, Capacity());
+  Element* result = elements_ + current_size_;
+  current_size_ += elements;
+  return result;
+}
+
 template <typename Element>
 inline const Element& RepeatedField<Element>::Get(int index) const {
   GOOGLE_DCHECK_LT(index, size());
@@ -514,6 +573,19 @@ inline const Element* RepeatedField<Element>::data() const {
 
 template <typename Element>
 void RepeatedField<Element>::Swap(RepeatedField* other) {
+  if (arena_ == other->arena_) {
+    InternalSwap(other);
+  } else {
+    RepeatedField temp(other->arena_);
+    temp.MergeFrom(*this);
+    Clear();
+    MergeFrom(*other);
+    other->InternalSwap(&temp);
+  }
+}
+
+template <typename Element>
+void RepeatedField<Element>::InternalSwap(RepeatedField* other) {
   Element* swap_elements     = elements_;
   int      swap_current_size = current_size_;
   int      swap_total_size   = total_size_;
@@ -579,9 +651,9 @@ void RepeatedField<Element>::Reserve(int new_size) {
 
   Element* old_elements = elements_;
   total_size_ = max(total_size_ * 2, new_size);
-  elements_ = new Element[total_size_];
+  elements_ = Arena::CreateArray<Element>(arena_, total_size_);
   MoveArray(elements_, old_elements, current_size_);
-  if (old_elements != initial_space_) {
+  if (old_elements != initial_space_ && arena_ == NULL) {
     delete [] old_elements;
   }
 }
@@ -613,11 +685,22 @@ inline RepeatedPtrFieldBase::RepeatedPtrFieldBase()
   : elements_(initial_space_),
     current_size_(0),
     allocated_size_(0),
-    total_size_(kInitialSize) {
+    total_size_(kInitialSize),
+    arena_(NULL) {
+}
+
+inline RepeatedPtrFieldBase::RepeatedPtrFieldBase(Arena* arena)
+  : elements_(initial_space_),
+    current_size_(0),
+    allocated_size_(0),
+    total_size_(kInitialSize),
+    arena_(arena) {
 }
 
 template <typename TypeHandler>
 void RepeatedPtrFieldBase::Destroy() {
+  // The elements and the array belong to the arena, if there is one.
+  if (arena_ != NULL) return;
   for (int i = 0; i < allocated_size_; i++) {
     TypeHandler::Delete(cast<TypeHandler>(elements_[i]));
   }
@@ -652,7 +735,7 @@ inline typename TypeHandler::Type* RepeatedPtrFieldBase::Add() {
   }
   if (allocated_size_ == total_size_) Reserve(total_size_ + 1);
   ++allocated_size_;
-  typename TypeHandler::Type* result = TypeHandler::New();
+  typename TypeHandler::Type* result = TypeHandler::New(arena_);
   elements_[current_size_++] = result;
   return result;
 }
@@ -730,7 +813,14 @@ inline typename TypeHandler::Type* RepeatedPtrFieldBase::AddFromCleared() {
 }
 
 template <typename TypeHandler>
-void RepeatedPtrFieldBase::AddAllocated(
+inline void RepeatedPtrFieldBase::AddAllocated(
+    typename TypeHandler::Type* value) {
+  if (arena_ != NULL) arena_->Own(value);
+  UnsafeArenaAddAllocated<TypeHandler>(value);
+}
+
+template <typename TypeHandler>
+void RepeatedPtrFieldBase::UnsafeArenaAddAllocated(
     typename TypeHandler::Type* value) {
   // Make room for the new pointer.
   if (current_size_ == total_size_) {
@@ -741,8 +831,11 @@ void RepeatedPtrFieldBase::AddAllocated(
     // There is no more space in the pointer array because it contains some
     // cleared objects awaiting reuse.  We don't want to grow the array in this
     // case because otherwise a loop calling AddAllocated() followed by Clear()
-    // would leak memory.
-    TypeHandler::Delete(cast<TypeHandler>(elements_[current_size_]));
+    // would leak memory.  (On an arena the object is simply abandoned; the
+    // arena frees it.)
+    if (arena_ == NULL) {
+      TypeHandler::Delete(cast<TypeHandler>(elements_[current_size_]));
+    }
   } else if (current_size_ < allocated_size_) {
     // We have some cleared objects.  We don't care about their order, so we
     // can just move the first one to the end to make space.
@@ -767,6 +860,12 @@ inline typename TypeHandler::Type* RepeatedPtrFieldBase::ReleaseLast() {
     // with the last allocated element.
     elements_[current_size_] = elements_[allocated_size_];
   }
+  if (arena_ != NULL) {
+    // The caller gets ownership, so it must not get an arena object.
+    typename TypeHandler::Type* copy = TypeHandler::New(NULL);
+    TypeHandler::Merge(*result, copy);
+    result = copy;
+  }
   return result;
 }
 
@@ -778,6 +877,7 @@ inline int RepeatedPtrFieldBase::ClearedCount() const {
 template <typename TypeHandler>
 inline void RepeatedPtrFieldBase::AddCleared(
     typename TypeHandler::Type* value) {
+  if (arena_ != NULL) arena_->Own(value);
   if (allocated_size_ == total_size_) Reserve(total_size_ + 1);
   elements_[allocated_size_++] = value;
 }
@@ -785,7 +885,13 @@ inline void RepeatedPtrFieldBase::AddCleared(
 template <typename TypeHandler>
 inline typename TypeHandler::Type* RepeatedPtrFieldBase::ReleaseCleared() {
   GOOGLE_DCHECK_GT(allocated_size_, current_size_);
-  return cast<TypeHandler>(elements_[--allocated_size_]);
+  typename TypeHandler::Type* result =
+      cast<TypeHandler>(elements_[--allocated_size_]);
+  if (arena_ != NULL) {
+    // Leave the arena's object to the arena and hand out a fresh one.
+    result = TypeHandler::New(NULL);
+  }
+  return result;
 }
 
 }  // namespace internal
@@ -804,6 +910,10 @@ class RepeatedPtrField<string>::TypeHandler
 template <typename Element>
 inline RepeatedPtrField<Element>::RepeatedPtrField() {}
 
+template <typename Element>
+inline RepeatedPtrField<Element>::RepeatedPtrField(Arena* arena)
+  : RepeatedPtrFieldBase(arena) {}
+
 template <typename Element>
 RepeatedPtrField<Element>::~RepeatedPtrField() {
   Destroy<TypeHandler>();
@@ -857,7 +967,15 @@ inline const Element* const* RepeatedPtrField<Element>::data() const {
 
 template <typename Element>
 void RepeatedPtrField<Element>::Swap(RepeatedPtrField* other) {
-  RepeatedPtrFieldBase::Swap(other);
+  if (GetArena() == other->GetArena()) {
+    RepeatedPtrFieldBase::Swap(other);
+  } else {
+    RepeatedPtrField temp(other->GetArena());
+    temp.MergeFrom(*this);
+    Clear();
+    MergeFrom(*other);
+    other->RepeatedPtrFieldBase::Swap(&temp);
+  }
 }
 
 template <typename Element>
@@ -865,6 +983,11 @@ void RepeatedPtrField<Element>::SwapElements(int index1, int index2) {
   RepeatedPtrFieldBase::SwapElements(index1, index2);
 }
 
+template <typename Element>
+inline Arena* RepeatedPtrField<Element>::GetArena() const {
+  return RepeatedPtrFieldBase::GetArena();
+}
+
 template <typename Element>
 inline int RepeatedPtrField<Element>::SpaceUsedExcludingSelf() const {
   return RepeatedPtrFieldBase::SpaceUsedExcludingSelf<TypeHandler>();
@@ -211,6 +211,24 @@ TEST(RepeatedField, ReserveLessThanExisting) {
   EXPECT_EQ(20, ReservedSpace(&field));
 }
 
+TEST(RepeatedField, AddNAlreadyReserved) {
+  RepeatedField<int> field;
+  field.Add(1);
+  field.Reserve(10);
+  const int* previous_ptr = field.data();
+
+  int* added = field.AddNAlreadyReserved(5);
+  for (int i = 0; i < 5; i++) {
+    added[i] = i + 2;
+  }
+
+  EXPECT_EQ(previous_ptr, field.data());
+  ASSERT_EQ(6, field.size());
+  for (int i = 0; i < 6; i++) {
+    EXPECT_EQ(i + 1, field.Get(i));
+  }
+}
+
 TEST(RepeatedField, MergeFrom) {
   RepeatedField<int> source, destination;
 
@@ -0,0 +1,126 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// http://code.google.com/p/protobuf/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// This header is logically internal, but is made public because it is used
+// from protocol-compiler-generated code, which may reside in other components.
+//
+// StringPieceField is the representation of string and bytes fields declared
+// with [ctype=STRING_PIECE].  Such fields can refer directly to the buffer a
+// message was parsed from instead of holding a copy:
+//
+//   message Blob {
+//     optional bytes payload = 1 [ctype=STRING_PIECE];
+//   }
+//
+//   io::CodedInputStream input(data, size);
+//   input.EnableAliasing(true);
+//   Blob blob;
+//   blob.MergeFromCodedStream(&input);
+//   // blob.payload().data() now points into data[].
+//
+// The generated accessors return a StringPieceField, which offers data(),
+// size() and ToString().  Setters and mutable_*() always copy, as does
+// MergeFrom(), so aliasing only ever comes from parsing with
+// CodedInputStream::EnableAliasing().
+
+#ifndef GOOGLE_PROTOBUF_STRING_PIECE_FIELD_H__
+#define GOOGLE_PROTOBUF_STRING_PIECE_FIELD_H__
+
+#include <string>
+#include <google/protobuf/stubs/common.h>
+
+namespace google {
+namespace protobuf {
+namespace internal {
+
+// A string value which either points at memory owned by someone else (an
+// "alias") or at a string owned by the field itself.
+class LIBPROTOBUF_EXPORT StringPieceField {
+ public:
+  StringPieceField();
+  ~StringPieceField();
+
+  const char* data() const { return data_ != NULL ? data_ : owned_->data(); }
+  int size() const {
+    return data_ != NULL ? size_ : static_cast<int>(owned_->size());
+  }
+  bool empty() const { return size() == 0; }
+
+  // Returns a copy of the value.
+  string ToString() const { return string(data(), size()); }
+
+  // Makes the field refer to size bytes at data without copying them.  The
+  // caller must keep the data alive and unchanged for as long as the field
+  // refers to it.
+  void SetAliased(const char* data, int size) {
+    data_ = data;
+    size_ = size;
+  }
+
+  // Copies size bytes at data into storage owned by the field.
+  void CopyFrom(const char* data, int size);
+
+  // Returns a string owned by the field, holding its current value, which
+  // the caller may modify.  The field's value follows the string until the
+  // next call to SetAliased(), CopyFrom() or Clear().
+  string* Mutable();
+
+  // Sets the value to the empty string, keeping any owned storage around for
+  // reuse.
+  void Clear() { SetAliased("", 0); }
+
+  // Makes this a copy of other's value.  The result never aliases other's
+  // data.
+  void MergeFrom(const StringPieceField& other) {
+    CopyFrom(other.data(), other.size());
+  }
+
+  void Swap(StringPieceField* other);
+
+  // Memory used by the owned string, if any.  Aliased data isn't counted.
+  int SpaceUsedExcludingSelf() const;
+  int SpaceUsed() const { return sizeof(*this) + SpaceUsedExcludingSelf(); }
+
+ private:
+  // The value is data_[0..size_) unless data_ is NULL, in which case it is
+  // *owned_.  owned_ may be non-NULL while aliased so that its buffer can be
+  // reused by the next CopyFrom().
+  const char* data_;
+  int size_;
+  string* owned_;
+
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(StringPieceField);
+};
+
+}  // namespace internal
+}  // namespace protobuf
+
+}  // namespace google
+#endif  // GOOGLE_PROTOBUF_STRING_PIECE_FIELD_H__
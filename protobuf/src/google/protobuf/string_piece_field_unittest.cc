@@ -0,0 +1,131 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// http://code.google.com/p/protobuf/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <string.h>
+#include <string>
+
+#include <google/protobuf/string_piece_field.h>
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/testing/googletest.h>
+#include <gtest/gtest.h>
+
+namespace google {
+namespace protobuf {
+namespace internal {
+namespace {
+
+TEST(StringPieceFieldTest, Empty) {
+  StringPieceField field;
+  EXPECT_TRUE(field.empty());
+  EXPECT_EQ(0, field.size());
+  EXPECT_EQ("", field.ToString());
+  EXPECT_EQ(0, field.SpaceUsedExcludingSelf());
+}
+
+TEST(StringPieceFieldTest, Aliased) {
+  const char kData[] = "hello world";
+  StringPieceField field;
+  field.SetAliased(kData, 5);
+
+  EXPECT_EQ(kData, field.data());
+  EXPECT_EQ(5, field.size());
+  EXPECT_EQ("hello", field.ToString());
+  EXPECT_EQ(0, field.SpaceUsedExcludingSelf());
+}
+
+TEST(StringPieceFieldTest, CopyFrom) {
+  char buffer[] = "hello";
+  StringPieceField field;
+  field.CopyFrom(buffer, 5);
+  buffer[0] = 'j';
+
+  EXPECT_NE(buffer, field.data());
+  EXPECT_EQ("hello", field.ToString());
+  EXPECT_GT(field.SpaceUsedExcludingSelf(), 0);
+}
+
+TEST(StringPieceFieldTest, MutableCopiesAliasedData) {
+  const char kData[] = "foo";
+  StringPieceField field;
+  field.SetAliased(kData, 3);
+
+  string* value = field.Mutable();
+  EXPECT_EQ("foo", *value);
+  value->append("bar");
+  EXPECT_EQ("foobar", field.ToString());
+  EXPECT_STREQ("foo", kData);
+
+  // Mutable() on an owned value returns the same string.
+  EXPECT_EQ(value, field.Mutable());
+}
+
+TEST(StringPieceFieldTest, ClearReusesStorage) {
+  StringPieceField field;
+  field.CopyFrom("some long value which doesn't fit inline", 40);
+  string* value = field.Mutable();
+
+  field.Clear();
+  EXPECT_TRUE(field.empty());
+  EXPECT_EQ("", field.ToString());
+
+  field.CopyFrom("bar", 3);
+  EXPECT_EQ("bar", field.ToString());
+  EXPECT_EQ(value, field.Mutable());
+}
+
+TEST(StringPieceFieldTest, MergeFromNeverAliases) {
+  const char kData[] = "hello";
+  StringPieceField from;
+  from.SetAliased(kData, 5);
+
+  StringPieceField to;
+  to.MergeFrom(from);
+  EXPECT_NE(kData, to.data());
+  EXPECT_EQ("hello", to.ToString());
+}
+
+TEST(StringPieceFieldTest, Swap) {
+  const char kData[] = "aliased";
+  StringPieceField field1;
+  StringPieceField field2;
+  field1.SetAliased(kData, strlen(kData));
+  field2.CopyFrom("owned", 5);
+
+  field1.Swap(&field2);
+  EXPECT_EQ("owned", field1.ToString());
+  EXPECT_EQ(kData, field2.data());
+  EXPECT_EQ("aliased", field2.ToString());
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace protobuf
+}  // namespace google
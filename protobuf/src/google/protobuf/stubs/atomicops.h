@@ -0,0 +1,217 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// http://code.google.com/p/protobuf/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// emulates google3/base/atomicops.h
+//
+// This header is intended to be included only by internal .cc files and
+// generated .pb.cc files.  Users should not use this directly.
+//
+// This is a minimal set of atomic operations on 32-bit integers, enough to
+// let state which is written from const methods (such as whether a lazy
+// field has been parsed) be shared safely between threads.  The operations
+// are:
+//
+// * NoBarrier_Load() / NoBarrier_Store():  Atomic, but impose no ordering on
+//   surrounding memory accesses.  Useful when concurrent writers are known to
+//   write the same value and nothing else is published through the variable.
+// * Acquire_Load() / Release_Store():  A Release_Store() of a value
+//   happens-before any Acquire_Load() which observes it, so these may be used
+//   to publish data which was initialized before the store.
+//
+// On GCC 4.7 and later (and compilers which imitate it) these map onto the
+// __atomic builtins.  On older GCC and on MSVC aligned 32-bit loads and
+// stores are atomic on every processor we support, and we only need to keep
+// the compiler (and, for the acquire/release forms, the processor) from
+// reordering around them.  Any other compiler falls back to guarding every
+// operation with one global mutex, which is slow but correct.
+//
+// Acquire_Load() and Release_Store() are also provided for pointers, to
+// publish objects which are not modified once published.
+
+#ifndef GOOGLE_PROTOBUF_STUBS_ATOMICOPS_H__
+#define GOOGLE_PROTOBUF_STUBS_ATOMICOPS_H__
+
+#include <google/protobuf/stubs/common.h>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace google {
+namespace protobuf {
+namespace internal {
+
+typedef int32 Atomic32;
+
+// The mutex used by the fallback implementation below.  Defined in
+// common.cc.
+LIBPROTOBUF_EXPORT Mutex* AtomicOpsMutex();
+
+#if defined(__ATOMIC_RELAXED)
+
+inline Atomic32 NoBarrier_Load(volatile const Atomic32* ptr) {
+  return __atomic_load_n(ptr, __ATOMIC_RELAXED);
+}
+
+inline void NoBarrier_Store(volatile Atomic32* ptr, Atomic32 value) {
+  __atomic_store_n(ptr, value, __ATOMIC_RELAXED);
+}
+
+inline Atomic32 Acquire_Load(volatile const Atomic32* ptr) {
+  return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+}
+
+inline void Release_Store(volatile Atomic32* ptr, Atomic32 value) {
+  __atomic_store_n(ptr, value, __ATOMIC_RELEASE);
+}
+
+template <typename T>
+inline T* Acquire_Load(T* volatile const* ptr) {
+  return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+}
+
+template <typename T>
+inline void Release_Store(T* volatile* ptr, T* value) {
+  __atomic_store_n(ptr, value, __ATOMIC_RELEASE);
+}
+
+#elif defined(_MSC_VER)
+
+// MSVC gives volatile accesses acquire and release semantics, and never
+// moves other accesses across them.
+inline Atomic32 NoBarrier_Load(volatile const Atomic32* ptr) {
+  return *ptr;
+}
+
+inline void NoBarrier_Store(volatile Atomic32* ptr, Atomic32 value) {
+  *ptr = value;
+}
+
+inline Atomic32 Acquire_Load(volatile const Atomic32* ptr) {
+  Atomic32 value = *ptr;
+  _ReadWriteBarrier();
+  return value;
+}
+
+inline void Release_Store(volatile Atomic32* ptr, Atomic32 value) {
+  _ReadWriteBarrier();
+  *ptr = value;
+}
+
+template <typename T>
+inline T* Acquire_Load(T* volatile const* ptr) {
+  T* value = *ptr;
+  _ReadWriteBarrier();
+  return value;
+}
+
+template <typename T>
+inline void Release_Store(T* volatile* ptr, T* value) {
+  _ReadWriteBarrier();
+  *ptr = value;
+}
+
+#elif defined(__GNUC__)
+
+inline Atomic32 NoBarrier_Load(volatile const Atomic32* ptr) {
+  return *ptr;
+}
+
+inline void NoBarrier_Store(volatile Atomic32* ptr, Atomic32 value) {
+  *ptr = value;
+}
+
+inline Atomic32 Acquire_Load(volatile const Atomic32* ptr) {
+  Atomic32 value = *ptr;
+  __sync_synchronize();
+  return value;
+}
+
+inline void Release_Store(volatile Atomic32* ptr, Atomic32 value) {
+  __sync_synchronize();
+  *ptr = value;
+}
+
+template <typename T>
+inline T* Acquire_Load(T* volatile const* ptr) {
+  T* value = *ptr;
+  __sync_synchronize();
+  return value;
+}
+
+template <typename T>
+inline void Release_Store(T* volatile* ptr, T* value) {
+  __sync_synchronize();
+  *ptr = value;
+}
+
+#else
+
+// Locking and unlocking a mutex orders memory accesses in both directions,
+// so every operation here is at least as strong as its name promises.
+inline Atomic32 NoBarrier_Load(volatile const Atomic32* ptr) {
+  MutexLock lock(AtomicOpsMutex());
+  return *ptr;
+}
+
+inline void NoBarrier_Store(volatile Atomic32* ptr, Atomic32 value) {
+  MutexLock lock(AtomicOpsMutex());
+  *ptr = value;
+}
+
+inline Atomic32 Acquire_Load(volatile const Atomic32* ptr) {
+  MutexLock lock(AtomicOpsMutex());
+  return *ptr;
+}
+
+inline void Release_Store(volatile Atomic32* ptr, Atomic32 value) {
+  MutexLock lock(AtomicOpsMutex());
+  *ptr = value;
+}
+
+template <typename T>
+inline T* Acquire_Load(T* volatile const* ptr) {
+  MutexLock lock(AtomicOpsMutex());
+  return *ptr;
+}
+
+template <typename T>
+inline void Release_Store(T* volatile* ptr, T* value) {
+  MutexLock lock(AtomicOpsMutex());
+  *ptr = value;
+}
+
+#endif
+
+}  // namespace internal
+}  // namespace protobuf
+
+}  // namespace google
+#endif  // GOOGLE_PROTOBUF_STUBS_ATOMICOPS_H__
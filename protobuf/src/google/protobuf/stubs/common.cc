@@ -31,6 +31,7 @@
 // Author: kenton@google.com (Kenton Varda)
 
 #include <google/protobuf/stubs/common.h>
+#include <google/protobuf/stubs/atomicops.h>
 #include <google/protobuf/stubs/once.h>
 #include <stdio.h>
 #include <errno.h>
@@ -278,36 +279,57 @@ void Mutex::AssertHeld() {
 #endif
 }
 
+// Slim reader/writer locks need Windows Vista, so for now readers simply
+// take the critical section like writers do.
+void Mutex::ReaderLock() {
+  Lock();
+}
+
+void Mutex::ReaderUnlock() {
+  Unlock();
+}
+
 #elif defined(HAVE_PTHREAD)
 
 struct Mutex::Internal {
-  pthread_mutex_t mutex;
+  pthread_rwlock_t mutex;
 };
 
 Mutex::Mutex()
   : mInternal(new Internal) {
-  pthread_mutex_init(&mInternal->mutex, NULL);
+  pthread_rwlock_init(&mInternal->mutex, NULL);
 }
 
 Mutex::~Mutex() {
-  pthread_mutex_destroy(&mInternal->mutex);
+  pthread_rwlock_destroy(&mInternal->mutex);
   delete mInternal;
 }
 
 void Mutex::Lock() {
-  int result = pthread_mutex_lock(&mInternal->mutex);
+  int result = pthread_rwlock_wrlock(&mInternal->mutex);
   if (result != 0) {
-    GOOGLE_LOG(FATAL) << "pthread_mutex_lock: " << strerror(result);
+    GOOGLE_LOG(FATAL) << "pthread_rwlock_wrlock: " << strerror(result);
   }
 }
 
 void Mutex::Unlock() {
-  int result = pthread_mutex_unlock(&mInternal->mutex);
+  int result = pthread_rwlock_unlock(&mInternal->mutex);
   if (result != 0) {
-    GOOGLE_LOG(FATAL) << "pthread_mutex_unlock: " << strerror(result);
+    GOOGLE_LOG(FATAL) << "pthread_rwlock_unlock: " << strerror(result);
   }
 }
 
+void Mutex::ReaderLock() {
+  int result = pthread_rwlock_rdlock(&mInternal->mutex);
+  if (result != 0) {
+    GOOGLE_LOG(FATAL) << "pthread_rwlock_rdlock: " << strerror(result);
+  }
+}
+
+void Mutex::ReaderUnlock() {
+  Unlock();
+}
+
 void Mutex::AssertHeld() {
   // pthreads dosn't provide a way to check which thread holds the mutex.
   // TODO(kenton):  Maybe keep track of locking thread ID like with WIN32?
@@ -340,6 +362,25 @@ void OnShutdown(void (*func)()) {
   shutdown_functions->push_back(func);
 }
 
+// Atomic operations which have no native implementation.
+
+namespace {
+
+Mutex* atomic_ops_mutex_ = NULL;
+GOOGLE_PROTOBUF_DECLARE_ONCE(atomic_ops_mutex_init_);
+
+void InitAtomicOpsMutex() {
+  // Never deleted:  shutdown functions may still use atomic operations.
+  atomic_ops_mutex_ = new Mutex;
+}
+
+}  // namespace
+
+Mutex* AtomicOpsMutex() {
+  GoogleOnceInit(&atomic_ops_mutex_init_, &InitAtomicOpsMutex);
+  return atomic_ops_mutex_;
+}
+
 }  // namespace internal
 
 void ShutdownProtobufLibrary() {
@@ -1040,9 +1040,12 @@ void LIBPROTOBUF_EXPORT DoNothing();
 
 namespace internal {
 
-// A Mutex is a non-reentrant (aka non-recursive) mutex.  At most one thread T
-// may hold a mutex at a given time.  If T attempts to Lock() the same Mutex
-// while holding it, T will deadlock.
+// A Mutex is a non-reentrant (aka non-recursive) reader/writer mutex.  At
+// most one thread T may hold a mutex exclusively at a given time.  If T
+// attempts to Lock() the same Mutex while holding it, T will deadlock.
+// Several threads may hold the Mutex in shared mode at once, but not while
+// another thread holds it exclusively.  On Windows, shared mode is currently
+// implemented as exclusive mode.
 class LIBPROTOBUF_EXPORT Mutex {
  public:
   // Create a Mutex that is not held by anybody.
@@ -1057,6 +1060,14 @@ class LIBPROTOBUF_EXPORT Mutex {
   // Release this Mutex.  Caller must hold it exclusively.
   void Unlock();
 
+  // Block if necessary until this Mutex is not held exclusively, then acquire
+  // it in shared mode.  A thread must not call ReaderLock() on a Mutex which
+  // it already holds in any mode.
+  void ReaderLock();
+
+  // Release this Mutex.  Caller must hold it in shared mode.
+  void ReaderUnlock();
+
   // Crash if this Mutex is not held exclusively by this thread.
   // May fail to crash when it should; will never crash when it should not.
   void AssertHeld();
@@ -1078,8 +1089,17 @@ class LIBPROTOBUF_EXPORT MutexLock {
   GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(MutexLock);
 };
 
-// TODO(kenton):  Implement these?  Hard to implement portably.
-typedef MutexLock ReaderMutexLock;
+// ReaderMutexLock(mu) acquires mu in shared mode when constructed and
+// releases it when destroyed.
+class LIBPROTOBUF_EXPORT ReaderMutexLock {
+ public:
+  explicit ReaderMutexLock(Mutex *mu) : mu_(mu) { this->mu_->ReaderLock(); }
+  ~ReaderMutexLock() { this->mu_->ReaderUnlock(); }
+ private:
+  Mutex *const mu_;
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(ReaderMutexLock);
+};
+
 typedef MutexLock WriterMutexLock;
 
 // MutexLockMaybe is like MutexLock, but is a no-op when mu is NULL.
@@ -1093,6 +1113,20 @@ class LIBPROTOBUF_EXPORT MutexLockMaybe {
   GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(MutexLockMaybe);
 };
 
+// ReaderMutexLockMaybe is like ReaderMutexLock, but is a no-op when mu is
+// NULL.
+class LIBPROTOBUF_EXPORT ReaderMutexLockMaybe {
+ public:
+  explicit ReaderMutexLockMaybe(Mutex *mu) :
+    mu_(mu) { if (this->mu_ != NULL) { this->mu_->ReaderLock(); } }
+  ~ReaderMutexLockMaybe() {
+    if (this->mu_ != NULL) { this->mu_->ReaderUnlock(); }
+  }
+ private:
+  Mutex *const mu_;
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(ReaderMutexLockMaybe);
+};
+
 }  // namespace internal
 
 // We made these internal so that they would show up as such in the docs,
@@ -1102,6 +1136,7 @@ using internal::MutexLock;
 using internal::ReaderMutexLock;
 using internal::WriterMutexLock;
 using internal::MutexLockMaybe;
+using internal::ReaderMutexLockMaybe;
 
 // ===================================================================
 // from google3/base/type_traits.h
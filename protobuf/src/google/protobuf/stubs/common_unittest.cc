@@ -40,6 +40,10 @@
 
 #include "config.h"
 
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#endif
+
 namespace google {
 namespace protobuf {
 namespace {
@@ -340,6 +344,35 @@ TEST_F(ClosureTest, TestPermanentClosureMethod2) {
   delete closure;
 }
 
+TEST(MutexTest, ReaderAndWriterLocks) {
+  Mutex mutex;
+  { ReaderMutexLock lock(&mutex); }
+  { MutexLock lock(&mutex); }
+  { ReaderMutexLockMaybe lock(&mutex); }
+  { ReaderMutexLockMaybe lock(NULL); }
+
+  mutex.Lock();
+  mutex.AssertHeld();
+  mutex.Unlock();
+}
+
+#ifdef HAVE_PTHREAD
+void* TakeReaderLock(void* mutex) {
+  ReaderMutexLock lock(reinterpret_cast<Mutex*>(mutex));
+  return NULL;
+}
+
+TEST(MutexTest, ReadersShareMutex) {
+  Mutex mutex;
+  ReaderMutexLock lock(&mutex);
+
+  // If readers excluded each other, this would deadlock.
+  pthread_t thread;
+  ASSERT_EQ(0, pthread_create(&thread, NULL, &TakeReaderLock, &mutex));
+  pthread_join(thread, NULL);
+}
+#endif  // HAVE_PTHREAD
+
 }  // anonymous namespace
 }  // namespace protobuf
 }  // namespace google
@@ -0,0 +1,314 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// http://code.google.com/p/protobuf/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// This header is intended to be included only by internal .cc files.
+//
+// FlatHashMap is a hash map which stores its entries in a single array,
+// using open addressing with linear probing, rather than allocating a node
+// per entry like hash_map and map do.  A lookup usually touches one cache
+// line of the entry array, plus one byte per probed slot in a separate
+// array of control bytes.  Each control byte holds seven bits of the
+// entry's hash, so a probe rarely has to call EqualKey on a key that does
+// not match; this matters for the const char* keys used throughout the
+// descriptor code.
+//
+// The interface is the subset of hash_map's used by the library:  find(),
+// insert(), operator[], erase(), iteration, and the helpers in map-util.h.
+// Iterators and references are invalidated by insert() and operator[].
+// Unlike hash_map in stubs/hash.h, FlatHashMap calls HashFcn on every
+// platform, including those which have no hash_map of their own.
+
+#ifndef GOOGLE_PROTOBUF_STUBS_FLAT_HASH_MAP_H__
+#define GOOGLE_PROTOBUF_STUBS_FLAT_HASH_MAP_H__
+
+#include <string.h>
+#include <functional>
+#include <new>
+#include <utility>
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/stubs/hash.h>
+
+namespace google {
+namespace protobuf {
+namespace internal {
+
+template <typename Key, typename Value,
+          typename HashFcn = hash<Key>,
+          typename EqualKey = std::equal_to<Key> >
+class FlatHashMap {
+ public:
+  typedef Key key_type;
+  typedef Value mapped_type;
+  // The key is not const so that entries can be moved when the table grows.
+  // Do not modify it through an iterator.
+  typedef std::pair<Key, Value> value_type;
+
+  template <typename ValueType>
+  class Iterator {
+   public:
+    Iterator() : ctrl_(NULL), end_(NULL), slot_(NULL) {}
+
+    // Allows converting an iterator to a const_iterator.
+    template <typename OtherValueType>
+    Iterator(const Iterator<OtherValueType>& other)
+      : ctrl_(other.ctrl_), end_(other.end_), slot_(other.slot_) {}
+
+    ValueType& operator*() const { return *slot_; }
+    ValueType* operator->() const { return slot_; }
+
+    Iterator& operator++() {
+      ++ctrl_;
+      ++slot_;
+      SkipUnusedSlots();
+      return *this;
+    }
+    Iterator operator++(int) {
+      Iterator result(*this);
+      ++*this;
+      return result;
+    }
+
+    template <typename OtherValueType>
+    bool operator==(const Iterator<OtherValueType>& other) const {
+      return slot_ == other.slot_;
+    }
+    template <typename OtherValueType>
+    bool operator!=(const Iterator<OtherValueType>& other) const {
+      return slot_ != other.slot_;
+    }
+
+   private:
+    template <typename OtherValueType> friend class Iterator;
+    friend class FlatHashMap;
+
+    Iterator(const uint8* ctrl, const uint8* end, ValueType* slot)
+      : ctrl_(ctrl), end_(end), slot_(slot) {}
+
+    void SkipUnusedSlots() {
+      while (ctrl_ != end_ && !IsFull(*ctrl_)) {
+        ++ctrl_;
+        ++slot_;
+      }
+    }
+
+    const uint8* ctrl_;
+    const uint8* end_;
+    ValueType* slot_;
+  };
+
+  typedef Iterator<value_type> iterator;
+  typedef Iterator<const value_type> const_iterator;
+
+  FlatHashMap()
+    : ctrl_(NULL), slots_(NULL), capacity_(0), shift_(64), size_(0),
+      deleted_(0) {}
+  ~FlatHashMap() { Destroy(); }
+
+  iterator begin() {
+    iterator result(ctrl_, ctrl_ + capacity_, slots_);
+    result.SkipUnusedSlots();
+    return result;
+  }
+  iterator end() {
+    return iterator(ctrl_ + capacity_, ctrl_ + capacity_, slots_ + capacity_);
+  }
+  const_iterator begin() const {
+    return const_cast<FlatHashMap*>(this)->begin();
+  }
+  const_iterator end() const {
+    return const_cast<FlatHashMap*>(this)->end();
+  }
+
+  int size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+
+  iterator find(const Key& key) {
+    int index = FindIndex(key, HashOf(key));
+    return index < 0 ? end() : IteratorAt(index);
+  }
+  const_iterator find(const Key& key) const {
+    return const_cast<FlatHashMap*>(this)->find(key);
+  }
+
+  std::pair<iterator, bool> insert(const value_type& value) {
+    uint64 hash = HashOf(value.first);
+    int index = FindIndex(value.first, hash);
+    if (index >= 0) return std::make_pair(IteratorAt(index), false);
+
+    if ((size_ + deleted_ + 1) * 4 > capacity_ * 3) Rehash();
+    index = FindInsertIndex(hash);
+    if (ctrl_[index] == kDeleted) --deleted_;
+    new (&slots_[index]) value_type(value);
+    ctrl_[index] = ControlByte(hash);
+    ++size_;
+    return std::make_pair(IteratorAt(index), true);
+  }
+
+  Value& operator[](const Key& key) {
+    return insert(value_type(key, Value())).first->second;
+  }
+
+  // Returns the number of entries removed (zero or one).
+  int erase(const Key& key) {
+    int index = FindIndex(key, HashOf(key));
+    if (index < 0) return 0;
+    slots_[index].~value_type();
+    ctrl_[index] = kDeleted;
+    --size_;
+    ++deleted_;
+    return 1;
+  }
+
+  void clear() {
+    Destroy();
+    ctrl_ = NULL;
+    slots_ = NULL;
+    capacity_ = 0;
+    shift_ = 64;
+    size_ = 0;
+    deleted_ = 0;
+  }
+
+  // Bytes of memory used by the map, not counting anything the keys and
+  // values point to.
+  int SpaceUsed() const {
+    return sizeof(*this) + capacity_ * (sizeof(value_type) + sizeof(uint8));
+  }
+
+ private:
+  // Control byte values.  A slot which holds an entry has the high bit set
+  // and seven bits of the entry's hash in the rest.
+  static const uint8 kEmpty = 0;
+  static const uint8 kDeleted = 1;
+  static bool IsFull(uint8 ctrl) { return (ctrl & 0x80) != 0; }
+
+  static const int kMinCapacityLog2 = 4;
+  static const int kMinCapacity = 1 << kMinCapacityLog2;
+
+  // The hash functions in stubs/hash.h return pointers and small integers
+  // nearly unchanged, so using their low bits as the slot index would put
+  // related keys in the same few slots.  Instead the hash is multiplied by
+  // 2^64 divided by the golden ratio and the slot index is taken from the
+  // top bits of the product ("Fibonacci hashing"), which spreads out keys
+  // that differ in any bits.  The control byte uses the seven bits below.
+  static uint64 HashOf(const Key& key) {
+    return static_cast<uint64>(HashFcn()(key)) *
+           GOOGLE_ULONGLONG(0x9e3779b97f4a7c15);
+  }
+  int IndexOf(uint64 hash) const {
+    return static_cast<int>(hash >> shift_);
+  }
+  uint8 ControlByte(uint64 hash) const {
+    return static_cast<uint8>(0x80 | ((hash >> (shift_ - 7)) & 0x7f));
+  }
+
+  iterator IteratorAt(int index) {
+    return iterator(ctrl_ + index, ctrl_ + capacity_, slots_ + index);
+  }
+
+  // Returns the index of the slot holding key, or -1.
+  int FindIndex(const Key& key, uint64 hash) const {
+    if (capacity_ == 0) return -1;
+    const int mask = capacity_ - 1;
+    const uint8 ctrl = ControlByte(hash);
+    EqualKey equal;
+    for (int i = IndexOf(hash); ; i = (i + 1) & mask) {
+      if (ctrl_[i] == ctrl && equal(slots_[i].first, key)) return i;
+      if (ctrl_[i] == kEmpty) return -1;
+    }
+  }
+
+  // Returns the index of the first empty or deleted slot in the probe
+  // sequence for hash.  There must be one.
+  int FindInsertIndex(uint64 hash) const {
+    const int mask = capacity_ - 1;
+    int i = IndexOf(hash);
+    while (IsFull(ctrl_[i])) i = (i + 1) & mask;
+    return i;
+  }
+
+  // Moves every entry into a new table with room for at least one more,
+  // dropping deleted slots.  The new table is at most half full.
+  void Rehash() {
+    int new_capacity = (capacity_ == 0) ? kMinCapacity : capacity_;
+    int new_shift = (capacity_ == 0) ? 64 - kMinCapacityLog2 : shift_;
+    while ((size_ + 1) * 2 > new_capacity) {
+      new_capacity *= 2;
+      --new_shift;
+    }
+
+    uint8* old_ctrl = ctrl_;
+    value_type* old_slots = slots_;
+    int old_capacity = capacity_;
+
+    ctrl_ = new uint8[new_capacity];
+    memset(ctrl_, kEmpty, new_capacity);
+    slots_ = static_cast<value_type*>(
+        ::operator new(new_capacity * sizeof(value_type)));
+    capacity_ = new_capacity;
+    shift_ = new_shift;
+    deleted_ = 0;
+
+    for (int i = 0; i < old_capacity; i++) {
+      if (!IsFull(old_ctrl[i])) continue;
+      uint64 hash = HashOf(old_slots[i].first);
+      int index = FindInsertIndex(hash);
+      new (&slots_[index]) value_type(old_slots[i]);
+      ctrl_[index] = ControlByte(hash);
+      old_slots[i].~value_type();
+    }
+
+    delete [] old_ctrl;
+    ::operator delete(old_slots);
+  }
+
+  void Destroy() {
+    for (int i = 0; i < capacity_; i++) {
+      if (IsFull(ctrl_[i])) slots_[i].~value_type();
+    }
+    delete [] ctrl_;
+    ::operator delete(slots_);
+  }
+
+  uint8* ctrl_;         // One control byte per slot.
+  value_type* slots_;   // Constructed only where the control byte is full.
+  int capacity_;        // Zero or a power of two.
+  int shift_;           // 64 minus log2(capacity_).
+  int size_;
+  int deleted_;         // Slots whose control byte is kDeleted.
+
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(FlatHashMap);
+};
+
+}  // namespace internal
+}  // namespace protobuf
+
+}  // namespace google
+#endif  // GOOGLE_PROTOBUF_STUBS_FLAT_HASH_MAP_H__
@@ -0,0 +1,200 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// http://code.google.com/p/protobuf/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <google/protobuf/stubs/flat_hash_map.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/stubs/map-util.h>
+#include <google/protobuf/stubs/strutil.h>
+#include <google/protobuf/testing/googletest.h>
+#include <gtest/gtest.h>
+
+namespace google {
+namespace protobuf {
+namespace internal {
+namespace {
+
+TEST(FlatHashMapTest, Empty) {
+  FlatHashMap<int, int> map;
+  EXPECT_EQ(0, map.size());
+  EXPECT_TRUE(map.empty());
+  EXPECT_TRUE(map.begin() == map.end());
+  EXPECT_TRUE(map.find(1) == map.end());
+  EXPECT_EQ(0, map.erase(1));
+}
+
+TEST(FlatHashMapTest, InsertAndFind) {
+  FlatHashMap<int, int> map;
+  // Enough entries to grow the table several times.
+  for (int i = 1; i <= 1000; i++) {
+    EXPECT_TRUE(map.insert(make_pair(i * 7, i)).second);
+    EXPECT_EQ(i, map.find(i * 7)->second);
+  }
+  EXPECT_EQ(1000, map.size());
+
+  for (int i = 1; i <= 1000; i++) {
+    EXPECT_EQ(i, FindWithDefault(map, i * 7, 0));
+    EXPECT_TRUE(map.find(i * 7 + 1) == map.end());
+  }
+}
+
+TEST(FlatHashMapTest, InsertExisting) {
+  FlatHashMap<int, int> map;
+  EXPECT_TRUE(InsertIfNotPresent(&map, 1, 2));
+  EXPECT_FALSE(InsertIfNotPresent(&map, 1, 3));
+  EXPECT_EQ(2, map[1]);
+  EXPECT_EQ(1, map.size());
+
+  map[1] = 4;
+  map[5] = 6;
+  EXPECT_EQ(4, map[1]);
+  EXPECT_EQ(6, map[5]);
+  EXPECT_EQ(2, map.size());
+}
+
+TEST(FlatHashMapTest, Erase) {
+  FlatHashMap<int, string> map;
+  for (int i = 0; i < 100; i++) {
+    map[i] = SimpleItoa(i);
+  }
+
+  // Erase every other entry.  The remaining ones must still be found even
+  // when an erased entry was earlier in their probe sequence.
+  for (int i = 0; i < 100; i += 2) {
+    EXPECT_EQ(1, map.erase(i));
+    EXPECT_EQ(0, map.erase(i));
+  }
+  EXPECT_EQ(50, map.size());
+  for (int i = 0; i < 100; i++) {
+    const string* value = FindOrNull(map, i);
+    if (i % 2 == 0) {
+      EXPECT_TRUE(value == NULL);
+    } else {
+      ASSERT_TRUE(value != NULL);
+      EXPECT_EQ(SimpleItoa(i), *value);
+    }
+  }
+
+  // Inserting and erasing repeatedly reuses deleted slots rather than
+  // growing the table without bound.
+  int space_used = map.SpaceUsed();
+  for (int i = 0; i < 10000; i++) {
+    map[1000 + i] = "x";
+    map.erase(1000 + i);
+  }
+  EXPECT_EQ(50, map.size());
+  EXPECT_EQ(space_used, map.SpaceUsed());
+}
+
+TEST(FlatHashMapTest, Clear) {
+  FlatHashMap<int, string> map;
+  map[1] = "one";
+  map[2] = "two";
+  map.clear();
+  EXPECT_TRUE(map.empty());
+  EXPECT_TRUE(map.find(1) == map.end());
+
+  map[3] = "three";
+  EXPECT_EQ("three", map[3]);
+}
+
+TEST(FlatHashMapTest, Iteration) {
+  FlatHashMap<int, int> map;
+  std::map<int, int> expected;
+  for (int i = 0; i < 200; i++) {
+    map[i * 3] = i;
+    expected[i * 3] = i;
+  }
+  for (int i = 0; i < 200; i += 5) {
+    map.erase(i * 3);
+    expected.erase(i * 3);
+  }
+
+  std::map<int, int> actual;
+  const FlatHashMap<int, int>& const_map = map;
+  for (FlatHashMap<int, int>::const_iterator it = const_map.begin();
+       it != const_map.end(); ++it) {
+    EXPECT_TRUE(actual.insert(*it).second);
+  }
+  EXPECT_TRUE(expected == actual);
+
+  // Values can be modified through a non-const iterator.
+  for (FlatHashMap<int, int>::iterator it = map.begin();
+       it != map.end(); ++it) {
+    it->second = -it->second;
+  }
+  EXPECT_EQ(-1, map[3]);
+}
+
+TEST(FlatHashMapTest, StringKeys) {
+  vector<string> names;
+  for (int i = 0; i < 100; i++) {
+    names.push_back("name" + SimpleItoa(i));
+  }
+
+  FlatHashMap<const char*, int, hash<const char*>, streq> map;
+  for (int i = 0; i < names.size(); i++) {
+    map[names[i].c_str()] = i + 1;
+  }
+
+  // Keys are compared by value, not by pointer.
+  for (int i = 0; i < names.size(); i++) {
+    string copy = names[i];
+    EXPECT_EQ(i + 1, FindWithDefault(map, copy.c_str(), 0));
+  }
+  EXPECT_TRUE(map.find("name100") == map.end());
+}
+
+TEST(FlatHashMapTest, PairKeys) {
+  // Like the descriptor tables:  (parent pointer, number) pairs, where the
+  // pointers are all aligned and the numbers are small.
+  vector<int> parents(10);
+  FlatHashMap<pair<const int*, int>, int> map;
+  for (int i = 0; i < parents.size(); i++) {
+    for (int j = 1; j <= 50; j++) {
+      map[make_pair(&parents[i], j)] = i * 100 + j;
+    }
+  }
+  EXPECT_EQ(500, map.size());
+  for (int i = 0; i < parents.size(); i++) {
+    for (int j = 1; j <= 50; j++) {
+      EXPECT_EQ(i * 100 + j, map[make_pair(&parents[i], j)]);
+    }
+  }
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace protobuf
+}  // namespace google
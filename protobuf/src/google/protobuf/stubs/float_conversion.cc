@@ -0,0 +1,1270 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// http://code.google.com/p/protobuf/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <google/protobuf/stubs/float_conversion.h>
+
+#include <string.h>
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+namespace google {
+namespace protobuf {
+namespace internal {
+
+namespace {
+
+// ===================================================================
+// 128-bit powers of five.
+//
+// kPowersOfFive[q - kMinPowerOfFive] holds {high, low} 64-bit halves of
+// 5^q, scaled by a power of two to lie in [2^127, 2^128) and truncated, for
+// q from kMinPowerOfFive to kMaxPowerOfFive.  Negative powers are rounded up
+// instead:  for -27 <= q < 0 the entry is floor(2^k / 5^-q) + 1, and for
+// smaller q it is floor(2^k' / 5^-q) + 1 truncated to 128 bits, with k'
+// larger than needed.  This is the table Eisel-Lemire parsing is proven
+// correct with.  Ryu's tables, which round differently and keep 125 bits,
+// are derived from it exactly by Pow5Split() and Pow5InvSplit().
+
+const int kMinPowerOfFive = -342;
+const int kMaxPowerOfFive = 325;
+
+#define POW5(high, low) \
+  { GOOGLE_ULONGLONG(0x##high), GOOGLE_ULONGLONG(0x##low) }
+
+const uint64 kPowersOfFive[kMaxPowerOfFive - kMinPowerOfFive + 1][2] = {
+  POW5(eef453d6923bd65a, 113faa2906a13b3f),  // 5^-342
+  POW5(9558b4661b6565f8, 4ac7ca59a424c507),  // 5^-341
+  POW5(baaee17fa23ebf76, 5d79bcf00d2df649),  // 5^-340
+  POW5(e95a99df8ace6f53, f4d82c2c107973dc),  // 5^-339
+  POW5(91d8a02bb6c10594, 79071b9b8a4be869),  // 5^-338
+  POW5(b64ec836a47146f9, 9748e2826cdee284),  // 5^-337
+  POW5(e3e27a444d8d98b7, fd1b1b2308169b25),  // 5^-336
+  POW5(8e6d8c6ab0787f72, fe30f0f5e50e20f7),  // 5^-335
+  POW5(b208ef855c969f4f, bdbd2d335e51a935),  // 5^-334
+  POW5(de8b2b66b3bc4723, ad2c788035e61382),  // 5^-333
+  POW5(8b16fb203055ac76, 4c3bcb5021afcc31),  // 5^-332
+  POW5(addcb9e83c6b1793, df4abe242a1bbf3d),  // 5^-331
+  POW5(d953e8624b85dd78, d71d6dad34a2af0d),  // 5^-330
+  POW5(87d4713d6f33aa6b, 8672648c40e5ad68),  // 5^-329
+  POW5(a9c98d8ccb009506, 680efdaf511f18c2),  // 5^-328
+  POW5(d43bf0effdc0ba48, 0212bd1b2566def2),  // 5^-327
+  POW5(84a57695fe98746d, 014bb630f7604b57),  // 5^-326
+  POW5(a5ced43b7e3e9188, 419ea3bd35385e2d),  // 5^-325
+  POW5(cf42894a5dce35ea, 52064cac828675b9),  // 5^-324
+  POW5(818995ce7aa0e1b2, 7343efebd1940993),  // 5^-323
+  POW5(a1ebfb4219491a1f, 1014ebe6c5f90bf8),  // 5^-322
+  POW5(ca66fa129f9b60a6, d41a26e077774ef6),  // 5^-321
+  POW5(fd00b897478238d0, 8920b098955522b4),  // 5^-320
+  POW5(9e20735e8cb16382, 55b46e5f5d5535b0),  // 5^-319
+  POW5(c5a890362fddbc62, eb2189f734aa831d),  // 5^-318
+  POW5(f712b443bbd52b7b, a5e9ec7501d523e4),  // 5^-317
+  POW5(9a6bb0aa55653b2d, 47b233c92125366e),  // 5^-316
+  POW5(c1069cd4eabe89f8, 999ec0bb696e840a),  // 5^-315
+  POW5(f148440a256e2c76, c00670ea43ca250d),  // 5^-314
+  POW5(96cd2a865764dbca, 380406926a5e5728),  // 5^-313
+  POW5(bc807527ed3e12bc, c605083704f5ecf2),  // 5^-312
+  POW5(eba09271e88d976b, f7864a44c633682e),  // 5^-311
+  POW5(93445b8731587ea3, 7ab3ee6afbe0211d),  // 5^-310
+  POW5(b8157268fdae9e4c, 5960ea05bad82964),  // 5^-309
+  POW5(e61acf033d1a45df, 6fb92487298e33bd),  // 5^-308
+  POW5(8fd0c16206306bab, a5d3b6d479f8e056),  // 5^-307
+  POW5(b3c4f1ba87bc8696, 8f48a4899877186c),  // 5^-306
+  POW5(e0b62e2929aba83c, 331acdabfe94de87),  // 5^-305
+  POW5(8c71dcd9ba0b4925, 9ff0c08b7f1d0b14),  // 5^-304
+  POW5(af8e5410288e1b6f, 07ecf0ae5ee44dd9),  // 5^-303
+  POW5(db71e91432b1a24a, c9e82cd9f69d6150),  // 5^-302
+  POW5(892731ac9faf056e, be311c083a225cd2),  // 5^-301
+  POW5(ab70fe17c79ac6ca, 6dbd630a48aaf406),  // 5^-300
+  POW5(d64d3d9db981787d, 092cbbccdad5b108),  // 5^-299
+  POW5(85f0468293f0eb4e, 25bbf56008c58ea5),  // 5^-298
+  POW5(a76c582338ed2621, af2af2b80af6f24e),  // 5^-297
+  POW5(d1476e2c07286faa, 1af5af660db4aee1),  // 5^-296
+  POW5(82cca4db847945ca, 50d98d9fc890ed4d),  // 5^-295
+  POW5(a37fce126597973c, e50ff107bab528a0),  // 5^-294
+  POW5(cc5fc196fefd7d0c, 1e53ed49a96272c8),  // 5^-293
+  POW5(ff77b1fcbebcdc4f, 25e8e89c13bb0f7a),  // 5^-292
+  POW5(9faacf3df73609b1, 77b191618c54e9ac),  // 5^-291
+  POW5(c795830d75038c1d, d59df5b9ef6a2417),  // 5^-290
+  POW5(f97ae3d0d2446f25, 4b0573286b44ad1d),  // 5^-289
+  POW5(9becce62836ac577, 4ee367f9430aec32),  // 5^-288
+  POW5(c2e801fb244576d5, 229c41f793cda73f),  // 5^-287
+  POW5(f3a20279ed56d48a, 6b43527578c1110f),  // 5^-286
+  POW5(9845418c345644d6, 830a13896b78aaa9),  // 5^-285
+  POW5(be5691ef416bd60c, 23cc986bc656d553),  // 5^-284
+  POW5(edec366b11c6cb8f, 2cbfbe86b7ec8aa8),  // 5^-283
+  POW5(94b3a202eb1c3f39, 7bf7d71432f3d6a9),  // 5^-282
+  POW5(b9e08a83a5e34f07, daf5ccd93fb0cc53),  // 5^-281
+  POW5(e858ad248f5c22c9, d1b3400f8f9cff68),  // 5^-280
+  POW5(91376c36d99995be, 23100809b9c21fa1),  // 5^-279
+  POW5(b58547448ffffb2d, abd40a0c2832a78a),  // 5^-278
+  POW5(e2e69915b3fff9f9, 16c90c8f323f516c),  // 5^-277
+  POW5(8dd01fad907ffc3b, ae3da7d97f6792e3),  // 5^-276
+  POW5(b1442798f49ffb4a, 99cd11cfdf41779c),  // 5^-275
+  POW5(dd95317f31c7fa1d, 40405643d711d583),  // 5^-274
+  POW5(8a7d3eef7f1cfc52, 482835ea666b2572),  // 5^-273
+  POW5(ad1c8eab5ee43b66, da3243650005eecf),  // 5^-272
+  POW5(d863b256369d4a40, 90bed43e40076a82),  // 5^-271
+  POW5(873e4f75e2224e68, 5a7744a6e804a291),  // 5^-270
+  POW5(a90de3535aaae202, 711515d0a205cb36),  // 5^-269
+  POW5(d3515c2831559a83, 0d5a5b44ca873e03),  // 5^-268
+  POW5(8412d9991ed58091, e858790afe9486c2),  // 5^-267
+  POW5(a5178fff668ae0b6, 626e974dbe39a872),  // 5^-266
+  POW5(ce5d73ff402d98e3, fb0a3d212dc8128f),  // 5^-265
+  POW5(80fa687f881c7f8e, 7ce66634bc9d0b99),  // 5^-264
+  POW5(a139029f6a239f72, 1c1fffc1ebc44e80),  // 5^-263
+  POW5(c987434744ac874e, a327ffb266b56220),  // 5^-262
+  POW5(fbe9141915d7a922, 4bf1ff9f0062baa8),  // 5^-261
+  POW5(9d71ac8fada6c9b5, 6f773fc3603db4a9),  // 5^-260
+  POW5(c4ce17b399107c22, cb550fb4384d21d3),  // 5^-259
+  POW5(f6019da07f549b2b, 7e2a53a146606a48),  // 5^-258
+  POW5(99c102844f94e0fb, 2eda7444cbfc426d),  // 5^-257
+  POW5(c0314325637a1939, fa911155fefb5308),  // 5^-256
+  POW5(f03d93eebc589f88, 793555ab7eba27ca),  // 5^-255
+  POW5(96267c7535b763b5, 4bc1558b2f3458de),  // 5^-254
+  POW5(bbb01b9283253ca2, 9eb1aaedfb016f16),  // 5^-253
+  POW5(ea9c227723ee8bcb, 465e15a979c1cadc),  // 5^-252
+  POW5(92a1958a7675175f, 0bfacd89ec191ec9),  // 5^-251
+  POW5(b749faed14125d36, cef980ec671f667b),  // 5^-250
+  POW5(e51c79a85916f484, 82b7e12780e7401a),  // 5^-249
+  POW5(8f31cc0937ae58d2, d1b2ecb8b0908810),  // 5^-248
+  POW5(b2fe3f0b8599ef07, 861fa7e6dcb4aa15),  // 5^-247
+  POW5(dfbdcece67006ac9, 67a791e093e1d49a),  // 5^-246
+  POW5(8bd6a141006042bd, e0c8bb2c5c6d24e0),  // 5^-245
+  POW5(aecc49914078536d, 58fae9f773886e18),  // 5^-244
+  POW5(da7f5bf590966848, af39a475506a899e),  // 5^-243
+  POW5(888f99797a5e012d, 6d8406c952429603),  // 5^-242
+  POW5(aab37fd7d8f58178, c8e5087ba6d33b83),  // 5^-241
+  POW5(d5605fcdcf32e1d6, fb1e4a9a90880a64),  // 5^-240
+  POW5(855c3be0a17fcd26, 5cf2eea09a55067f),  // 5^-239
+  POW5(a6b34ad8c9dfc06f, f42faa48c0ea481e),  // 5^-238
+  POW5(d0601d8efc57b08b, f13b94daf124da26),  // 5^-237
+  POW5(823c12795db6ce57, 76c53d08d6b70858),  // 5^-236
+  POW5(a2cb1717b52481ed, 54768c4b0c64ca6e),  // 5^-235
+  POW5(cb7ddcdda26da268, a9942f5dcf7dfd09),  // 5^-234
+  POW5(fe5d54150b090b02, d3f93b35435d7c4c),  // 5^-233
+  POW5(9efa548d26e5a6e1, c47bc5014a1a6daf),  // 5^-232
+  POW5(c6b8e9b0709f109a, 359ab6419ca1091b),  // 5^-231
+  POW5(f867241c8cc6d4c0, c30163d203c94b62),  // 5^-230
+  POW5(9b407691d7fc44f8, 79e0de63425dcf1d),  // 5^-229
+  POW5(c21094364dfb5636, 985915fc12f542e4),  // 5^-228
+  POW5(f294b943e17a2bc4, 3e6f5b7b17b2939d),  // 5^-227
+  POW5(979cf3ca6cec5b5a, a705992ceecf9c42),  // 5^-226
+  POW5(bd8430bd08277231, 50c6ff782a838353),  // 5^-225
+  POW5(ece53cec4a314ebd, a4f8bf5635246428),  // 5^-224
+  POW5(940f4613ae5ed136, 871b7795e136be99),  // 5^-223
+  POW5(b913179899f68584, 28e2557b59846e3f),  // 5^-222
+  POW5(e757dd7ec07426e5, 331aeada2fe589cf),  // 5^-221
+  POW5(9096ea6f3848984f, 3ff0d2c85def7621),  // 5^-220
+  POW5(b4bca50b065abe63, 0fed077a756b53a9),  // 5^-219
+  POW5(e1ebce4dc7f16dfb, d3e8495912c62894),  // 5^-218
+  POW5(8d3360f09cf6e4bd, 64712dd7abbbd95c),  // 5^-217
+  POW5(b080392cc4349dec, bd8d794d96aacfb3),  // 5^-216
+  POW5(dca04777f541c567, ecf0d7a0fc5583a0),  // 5^-215
+  POW5(89e42caaf9491b60, f41686c49db57244),  // 5^-214
+  POW5(ac5d37d5b79b6239, 311c2875c522ced5),  // 5^-213
+  POW5(d77485cb25823ac7, 7d633293366b828b),  // 5^-212
+  POW5(86a8d39ef77164bc, ae5dff9c02033197),  // 5^-211
+  POW5(a8530886b54dbdeb, d9f57f830283fdfc),  // 5^-210
+  POW5(d267caa862a12d66, d072df63c324fd7b),  // 5^-209
+  POW5(8380dea93da4bc60, 4247cb9e59f71e6d),  // 5^-208
+  POW5(a46116538d0deb78, 52d9be85f074e608),  // 5^-207
+  POW5(cd795be870516656, 67902e276c921f8b),  // 5^-206
+  POW5(806bd9714632dff6, 00ba1cd8a3db53b6),  // 5^-205
+  POW5(a086cfcd97bf97f3, 80e8a40eccd228a4),  // 5^-204
+  POW5(c8a883c0fdaf7df0, 6122cd128006b2cd),  // 5^-203
+  POW5(fad2a4b13d1b5d6c, 796b805720085f81),  // 5^-202
+  POW5(9cc3a6eec6311a63, cbe3303674053bb0),  // 5^-201
+  POW5(c3f490aa77bd60fc, bedbfc4411068a9c),  // 5^-200
+  POW5(f4f1b4d515acb93b, ee92fb5515482d44),  // 5^-199
+  POW5(991711052d8bf3c5, 751bdd152d4d1c4a),  // 5^-198
+  POW5(bf5cd54678eef0b6, d262d45a78a0635d),  // 5^-197
+  POW5(ef340a98172aace4, 86fb897116c87c34),  // 5^-196
+  POW5(9580869f0e7aac0e, d45d35e6ae3d4da0),  // 5^-195
+  POW5(bae0a846d2195712, 8974836059cca109),  // 5^-194
+  POW5(e998d258869facd7, 2bd1a438703fc94b),  // 5^-193
+  POW5(91ff83775423cc06, 7b6306a34627ddcf),  // 5^-192
+  POW5(b67f6455292cbf08, 1a3bc84c17b1d542),  // 5^-191
+  POW5(e41f3d6a7377eeca, 20caba5f1d9e4a93),  // 5^-190
+  POW5(8e938662882af53e, 547eb47b7282ee9c),  // 5^-189
+  POW5(b23867fb2a35b28d, e99e619a4f23aa43),  // 5^-188
+  POW5(dec681f9f4c31f31, 6405fa00e2ec94d4),  // 5^-187
+  POW5(8b3c113c38f9f37e, de83bc408dd3dd04),  // 5^-186
+  POW5(ae0b158b4738705e, 9624ab50b148d445),  // 5^-185
+  POW5(d98ddaee19068c76, 3badd624dd9b0957),  // 5^-184
+  POW5(87f8a8d4cfa417c9, e54ca5d70a80e5d6),  // 5^-183
+  POW5(a9f6d30a038d1dbc, 5e9fcf4ccd211f4c),  // 5^-182
+  POW5(d47487cc8470652b, 7647c3200069671f),  // 5^-181
+  POW5(84c8d4dfd2c63f3b, 29ecd9f40041e073),  // 5^-180
+  POW5(a5fb0a17c777cf09, f468107100525890),  // 5^-179
+  POW5(cf79cc9db955c2cc, 7182148d4066eeb4),  // 5^-178
+  POW5(81ac1fe293d599bf, c6f14cd848405530),  // 5^-177
+  POW5(a21727db38cb002f, b8ada00e5a506a7c),  // 5^-176
+  POW5(ca9cf1d206fdc03b, a6d90811f0e4851c),  // 5^-175
+  POW5(fd442e4688bd304a, 908f4a166d1da663),  // 5^-174
+  POW5(9e4a9cec15763e2e, 9a598e4e043287fe),  // 5^-173
+  POW5(c5dd44271ad3cdba, 40eff1e1853f29fd),  // 5^-172
+  POW5(f7549530e188c128, d12bee59e68ef47c),  // 5^-171
+  POW5(9a94dd3e8cf578b9, 82bb74f8301958ce),  // 5^-170
+  POW5(c13a148e3032d6e7, e36a52363c1faf01),  // 5^-169
+  POW5(f18899b1bc3f8ca1, dc44e6c3cb279ac1),  // 5^-168
+  POW5(96f5600f15a7b7e5, 29ab103a5ef8c0b9),  // 5^-167
+  POW5(bcb2b812db11a5de, 7415d448f6b6f0e7),  // 5^-166
+  POW5(ebdf661791d60f56, 111b495b3464ad21),  // 5^-165
+  POW5(936b9fcebb25c995, cab10dd900beec34),  // 5^-164
+  POW5(b84687c269ef3bfb, 3d5d514f40eea742),  // 5^-163
+  POW5(e65829b3046b0afa, 0cb4a5a3112a5112),  // 5^-162
+  POW5(8ff71a0fe2c2e6dc, 47f0e785eaba72ab),  // 5^-161
+  POW5(b3f4e093db73a093, 59ed216765690f56),  // 5^-160
+  POW5(e0f218b8d25088b8, 306869c13ec3532c),  // 5^-159
+  POW5(8c974f7383725573, 1e414218c73a13fb),  // 5^-158
+  POW5(afbd2350644eeacf, e5d1929ef90898fa),  // 5^-157
+  POW5(dbac6c247d62a583, df45f746b74abf39),  // 5^-156
+  POW5(894bc396ce5da772, 6b8bba8c328eb783),  // 5^-155
+  POW5(ab9eb47c81f5114f, 066ea92f3f326564),  // 5^-154
+  POW5(d686619ba27255a2, c80a537b0efefebd),  // 5^-153
+  POW5(8613fd0145877585, bd06742ce95f5f36),  // 5^-152
+  POW5(a798fc4196e952e7, 2c48113823b73704),  // 5^-151
+  POW5(d17f3b51fca3a7a0, f75a15862ca504c5),  // 5^-150
+  POW5(82ef85133de648c4, 9a984d73dbe722fb),  // 5^-149
+  POW5(a3ab66580d5fdaf5, c13e60d0d2e0ebba),  // 5^-148
+  POW5(cc963fee10b7d1b3, 318df905079926a8),  // 5^-147
+  POW5(ffbbcfe994e5c61f, fdf17746497f7052),  // 5^-146
+  POW5(9fd561f1fd0f9bd3, feb6ea8bedefa633),  // 5^-145
+  POW5(c7caba6e7c5382c8, fe64a52ee96b8fc0),  // 5^-144
+  POW5(f9bd690a1b68637b, 3dfdce7aa3c673b0),  // 5^-143
+  POW5(9c1661a651213e2d, 06bea10ca65c084e),  // 5^-142
+  POW5(c31bfa0fe5698db8, 486e494fcff30a62),  // 5^-141
+  POW5(f3e2f893dec3f126, 5a89dba3c3efccfa),  // 5^-140
+  POW5(986ddb5c6b3a76b7, f89629465a75e01c),  // 5^-139
+  POW5(be89523386091465, f6bbb397f1135823),  // 5^-138
+  POW5(ee2ba6c0678b597f, 746aa07ded582e2c),  // 5^-137
+  POW5(94db483840b717ef, a8c2a44eb4571cdc),  // 5^-136
+  POW5(ba121a4650e4ddeb, 92f34d62616ce413),  // 5^-135
+  POW5(e896a0d7e51e1566, 77b020baf9c81d17),  // 5^-134
+  POW5(915e2486ef32cd60, 0ace1474dc1d122e),  // 5^-133
+  POW5(b5b5ada8aaff80b8, 0d819992132456ba),  // 5^-132
+  POW5(e3231912d5bf60e6, 10e1fff697ed6c69),  // 5^-131
+  POW5(8df5efabc5979c8f, ca8d3ffa1ef463c1),  // 5^-130
+  POW5(b1736b96b6fd83b3, bd308ff8a6b17cb2),  // 5^-129
+  POW5(ddd0467c64bce4a0, ac7cb3f6d05ddbde),  // 5^-128
+  POW5(8aa22c0dbef60ee4, 6bcdf07a423aa96b),  // 5^-127
+  POW5(ad4ab7112eb3929d, 86c16c98d2c953c6),  // 5^-126
+  POW5(d89d64d57a607744, e871c7bf077ba8b7),  // 5^-125
+  POW5(87625f056c7c4a8b, 11471cd764ad4972),  // 5^-124
+  POW5(a93af6c6c79b5d2d, d598e40d3dd89bcf),  // 5^-123
+  POW5(d389b47879823479, 4aff1d108d4ec2c3),  // 5^-122
+  POW5(843610cb4bf160cb, cedf722a585139ba),  // 5^-121
+  POW5(a54394fe1eedb8fe, c2974eb4ee658828),  // 5^-120
+  POW5(ce947a3da6a9273e, 733d226229feea32),  // 5^-119
+  POW5(811ccc668829b887, 0806357d5a3f525f),  // 5^-118
+  POW5(a163ff802a3426a8, ca07c2dcb0cf26f7),  // 5^-117
+  POW5(c9bcff6034c13052, fc89b393dd02f0b5),  // 5^-116
+  POW5(fc2c3f3841f17c67, bbac2078d443ace2),  // 5^-115
+  POW5(9d9ba7832936edc0, d54b944b84aa4c0d),  // 5^-114
+  POW5(c5029163f384a931, 0a9e795e65d4df11),  // 5^-113
+  POW5(f64335bcf065d37d, 4d4617b5ff4a16d5),  // 5^-112
+  POW5(99ea0196163fa42e, 504bced1bf8e4e45),  // 5^-111
+  POW5(c06481fb9bcf8d39, e45ec2862f71e1d6),  // 5^-110
+  POW5(f07da27a82c37088, 5d767327bb4e5a4c),  // 5^-109
+  POW5(964e858c91ba2655, 3a6a07f8d510f86f),  // 5^-108
+  POW5(bbe226efb628afea, 890489f70a55368b),  // 5^-107
+  POW5(eadab0aba3b2dbe5, 2b45ac74ccea842e),  // 5^-106
+  POW5(92c8ae6b464fc96f, 3b0b8bc90012929d),  // 5^-105
+  POW5(b77ada0617e3bbcb, 09ce6ebb40173744),  // 5^-104
+  POW5(e55990879ddcaabd, cc420a6a101d0515),  // 5^-103
+  POW5(8f57fa54c2a9eab6, 9fa946824a12232d),  // 5^-102
+  POW5(b32df8e9f3546564, 47939822dc96abf9),  // 5^-101
+  POW5(dff9772470297ebd, 59787e2b93bc56f7),  // 5^-100
+  POW5(8bfbea76c619ef36, 57eb4edb3c55b65a),  // 5^-99
+  POW5(aefae51477a06b03, ede622920b6b23f1),  // 5^-98
+  POW5(dab99e59958885c4, e95fab368e45eced),  // 5^-97
+  POW5(88b402f7fd75539b, 11dbcb0218ebb414),  // 5^-96
+  POW5(aae103b5fcd2a881, d652bdc29f26a119),  // 5^-95
+  POW5(d59944a37c0752a2, 4be76d3346f0495f),  // 5^-94
+  POW5(857fcae62d8493a5, 6f70a4400c562ddb),  // 5^-93
+  POW5(a6dfbd9fb8e5b88e, cb4ccd500f6bb952),  // 5^-92
+  POW5(d097ad07a71f26b2, 7e2000a41346a7a7),  // 5^-91
+  POW5(825ecc24c873782f, 8ed400668c0c28c8),  // 5^-90
+  POW5(a2f67f2dfa90563b, 728900802f0f32fa),  // 5^-89
+  POW5(cbb41ef979346bca, 4f2b40a03ad2ffb9),  // 5^-88
+  POW5(fea126b7d78186bc, e2f610c84987bfa8),  // 5^-87
+  POW5(9f24b832e6b0f436, 0dd9ca7d2df4d7c9),  // 5^-86
+  POW5(c6ede63fa05d3143, 91503d1c79720dbb),  // 5^-85
+  POW5(f8a95fcf88747d94, 75a44c6397ce912a),  // 5^-84
+  POW5(9b69dbe1b548ce7c, c986afbe3ee11aba),  // 5^-83
+  POW5(c24452da229b021b, fbe85badce996168),  // 5^-82
+  POW5(f2d56790ab41c2a2, fae27299423fb9c3),  // 5^-81
+  POW5(97c560ba6b0919a5, dccd879fc967d41a),  // 5^-80
+  POW5(bdb6b8e905cb600f, 5400e987bbc1c920),  // 5^-79
+  POW5(ed246723473e3813, 290123e9aab23b68),  // 5^-78
+  POW5(9436c0760c86e30b, f9a0b6720aaf6521),  // 5^-77
+  POW5(b94470938fa89bce, f808e40e8d5b3e69),  // 5^-76
+  POW5(e7958cb87392c2c2, b60b1d1230b20e04),  // 5^-75
+  POW5(90bd77f3483bb9b9, b1c6f22b5e6f48c2),  // 5^-74
+  POW5(b4ecd5f01a4aa828, 1e38aeb6360b1af3),  // 5^-73
+  POW5(e2280b6c20dd5232, 25c6da63c38de1b0),  // 5^-72
+  POW5(8d590723948a535f, 579c487e5a38ad0e),  // 5^-71
+  POW5(b0af48ec79ace837, 2d835a9df0c6d851),  // 5^-70
+  POW5(dcdb1b2798182244, f8e431456cf88e65),  // 5^-69
+  POW5(8a08f0f8bf0f156b, 1b8e9ecb641b58ff),  // 5^-68
+  POW5(ac8b2d36eed2dac5, e272467e3d222f3f),  // 5^-67
+  POW5(d7adf884aa879177, 5b0ed81dcc6abb0f),  // 5^-66
+  POW5(86ccbb52ea94baea, 98e947129fc2b4e9),  // 5^-65
+  POW5(a87fea27a539e9a5, 3f2398d747b36224),  // 5^-64
+  POW5(d29fe4b18e88640e, 8eec7f0d19a03aad),  // 5^-63
+  POW5(83a3eeeef9153e89, 1953cf68300424ac),  // 5^-62
+  POW5(a48ceaaab75a8e2b, 5fa8c3423c052dd7),  // 5^-61
+  POW5(cdb02555653131b6, 3792f412cb06794d),  // 5^-60
+  POW5(808e17555f3ebf11, e2bbd88bbee40bd0),  // 5^-59
+  POW5(a0b19d2ab70e6ed6, 5b6aceaeae9d0ec4),  // 5^-58
+  POW5(c8de047564d20a8b, f245825a5a445275),  // 5^-57
+  POW5(fb158592be068d2e, eed6e2f0f0d56712),  // 5^-56
+  POW5(9ced737bb6c4183d, 55464dd69685606b),  // 5^-55
+  POW5(c428d05aa4751e4c, aa97e14c3c26b886),  // 5^-54
+  POW5(f53304714d9265df, d53dd99f4b3066a8),  // 5^-53
+  POW5(993fe2c6d07b7fab, e546a8038efe4029),  // 5^-52
+  POW5(bf8fdb78849a5f96, de98520472bdd033),  // 5^-51
+  POW5(ef73d256a5c0f77c, 963e66858f6d4440),  // 5^-50
+  POW5(95a8637627989aad, dde7001379a44aa8),  // 5^-49
+  POW5(bb127c53b17ec159, 5560c018580d5d52),  // 5^-48
+  POW5(e9d71b689dde71af, aab8f01e6e10b4a6),  // 5^-47
+  POW5(9226712162ab070d, cab3961304ca70e8),  // 5^-46
+  POW5(b6b00d69bb55c8d1, 3d607b97c5fd0d22),  // 5^-45
+  POW5(e45c10c42a2b3b05, 8cb89a7db77c506a),  // 5^-44
+  POW5(8eb98a7a9a5b04e3, 77f3608e92adb242),  // 5^-43
+  POW5(b267ed1940f1c61c, 55f038b237591ed3),  // 5^-42
+  POW5(df01e85f912e37a3, 6b6c46dec52f6688),  // 5^-41
+  POW5(8b61313bbabce2c6, 2323ac4b3b3da015),  // 5^-40
+  POW5(ae397d8aa96c1b77, abec975e0a0d081a),  // 5^-39
+  POW5(d9c7dced53c72255, 96e7bd358c904a21),  // 5^-38
+  POW5(881cea14545c7575, 7e50d64177da2e54),  // 5^-37
+  POW5(aa242499697392d2, dde50bd1d5d0b9e9),  // 5^-36
+  POW5(d4ad2dbfc3d07787, 955e4ec64b44e864),  // 5^-35
+  POW5(84ec3c97da624ab4, bd5af13bef0b113e),  // 5^-34
+  POW5(a6274bbdd0fadd61, ecb1ad8aeacdd58e),  // 5^-33
+  POW5(cfb11ead453994ba, 67de18eda5814af2),  // 5^-32
+  POW5(81ceb32c4b43fcf4, 80eacf948770ced7),  // 5^-31
+  POW5(a2425ff75e14fc31, a1258379a94d028d),  // 5^-30
+  POW5(cad2f7f5359a3b3e, 096ee45813a04330),  // 5^-29
+  POW5(fd87b5f28300ca0d, 8bca9d6e188853fc),  // 5^-28
+  POW5(9e74d1b791e07e48, 775ea264cf55347e),  // 5^-27
+  POW5(c612062576589dda, 95364afe032a819e),  // 5^-26
+  POW5(f79687aed3eec551, 3a83ddbd83f52205),  // 5^-25
+  POW5(9abe14cd44753b52, c4926a9672793543),  // 5^-24
+  POW5(c16d9a0095928a27, 75b7053c0f178294),  // 5^-23
+  POW5(f1c90080baf72cb1, 5324c68b12dd6339),  // 5^-22
+  POW5(971da05074da7bee, d3f6fc16ebca5e04),  // 5^-21
+  POW5(bce5086492111aea, 88f4bb1ca6bcf585),  // 5^-20
+  POW5(ec1e4a7db69561a5, 2b31e9e3d06c32e6),  // 5^-19
+  POW5(9392ee8e921d5d07, 3aff322e62439fd0),  // 5^-18
+  POW5(b877aa3236a4b449, 09befeb9fad487c3),  // 5^-17
+  POW5(e69594bec44de15b, 4c2ebe687989a9b4),  // 5^-16
+  POW5(901d7cf73ab0acd9, 0f9d37014bf60a11),  // 5^-15
+  POW5(b424dc35095cd80f, 538484c19ef38c95),  // 5^-14
+  POW5(e12e13424bb40e13, 2865a5f206b06fba),  // 5^-13
+  POW5(8cbccc096f5088cb, f93f87b7442e45d4),  // 5^-12
+  POW5(afebff0bcb24aafe, f78f69a51539d749),  // 5^-11
+  POW5(dbe6fecebdedd5be, b573440e5a884d1c),  // 5^-10
+  POW5(89705f4136b4a597, 31680a88f8953031),  // 5^-9
+  POW5(abcc77118461cefc, fdc20d2b36ba7c3e),  // 5^-8
+  POW5(d6bf94d5e57a42bc, 3d32907604691b4d),  // 5^-7
+  POW5(8637bd05af6c69b5, a63f9a49c2c1b110),  // 5^-6
+  POW5(a7c5ac471b478423, 0fcf80dc33721d54),  // 5^-5
+  POW5(d1b71758e219652b, d3c36113404ea4a9),  // 5^-4
+  POW5(83126e978d4fdf3b, 645a1cac083126ea),  // 5^-3
+  POW5(a3d70a3d70a3d70a, 3d70a3d70a3d70a4),  // 5^-2
+  POW5(cccccccccccccccc, cccccccccccccccd),  // 5^-1
+  POW5(8000000000000000, 0000000000000000),  // 5^0
+  POW5(a000000000000000, 0000000000000000),  // 5^1
+  POW5(c800000000000000, 0000000000000000),  // 5^2
+  POW5(fa00000000000000, 0000000000000000),  // 5^3
+  POW5(9c40000000000000, 0000000000000000),  // 5^4
+  POW5(c350000000000000, 0000000000000000),  // 5^5
+  POW5(f424000000000000, 0000000000000000),  // 5^6
+  POW5(9896800000000000, 0000000000000000),  // 5^7
+  POW5(bebc200000000000, 0000000000000000),  // 5^8
+  POW5(ee6b280000000000, 0000000000000000),  // 5^9
+  POW5(9502f90000000000, 0000000000000000),  // 5^10
+  POW5(ba43b74000000000, 0000000000000000),  // 5^11
+  POW5(e8d4a51000000000, 0000000000000000),  // 5^12
+  POW5(9184e72a00000000, 0000000000000000),  // 5^13
+  POW5(b5e620f480000000, 0000000000000000),  // 5^14
+  POW5(e35fa931a0000000, 0000000000000000),  // 5^15
+  POW5(8e1bc9bf04000000, 0000000000000000),  // 5^16
+  POW5(b1a2bc2ec5000000, 0000000000000000),  // 5^17
+  POW5(de0b6b3a76400000, 0000000000000000),  // 5^18
+  POW5(8ac7230489e80000, 0000000000000000),  // 5^19
+  POW5(ad78ebc5ac620000, 0000000000000000),  // 5^20
+  POW5(d8d726b7177a8000, 0000000000000000),  // 5^21
+  POW5(878678326eac9000, 0000000000000000),  // 5^22
+  POW5(a968163f0a57b400, 0000000000000000),  // 5^23
+  POW5(d3c21bcecceda100, 0000000000000000),  // 5^24
+  POW5(84595161401484a0, 0000000000000000),  // 5^25
+  POW5(a56fa5b99019a5c8, 0000000000000000),  // 5^26
+  POW5(cecb8f27f4200f3a, 0000000000000000),  // 5^27
+  POW5(813f3978f8940984, 4000000000000000),  // 5^28
+  POW5(a18f07d736b90be5, 5000000000000000),  // 5^29
+  POW5(c9f2c9cd04674ede, a400000000000000),  // 5^30
+  POW5(fc6f7c4045812296, 4d00000000000000),  // 5^31
+  POW5(9dc5ada82b70b59d, f020000000000000),  // 5^32
+  POW5(c5371912364ce305, 6c28000000000000),  // 5^33
+  POW5(f684df56c3e01bc6, c732000000000000),  // 5^34
+  POW5(9a130b963a6c115c, 3c7f400000000000),  // 5^35
+  POW5(c097ce7bc90715b3, 4b9f100000000000),  // 5^36
+  POW5(f0bdc21abb48db20, 1e86d40000000000),  // 5^37
+  POW5(96769950b50d88f4, 1314448000000000),  // 5^38
+  POW5(bc143fa4e250eb31, 17d955a000000000),  // 5^39
+  POW5(eb194f8e1ae525fd, 5dcfab0800000000),  // 5^40
+  POW5(92efd1b8d0cf37be, 5aa1cae500000000),  // 5^41
+  POW5(b7abc627050305ad, f14a3d9e40000000),  // 5^42
+  POW5(e596b7b0c643c719, 6d9ccd05d0000000),  // 5^43
+  POW5(8f7e32ce7bea5c6f, e4820023a2000000),  // 5^44
+  POW5(b35dbf821ae4f38b, dda2802c8a800000),  // 5^45
+  POW5(e0352f62a19e306e, d50b2037ad200000),  // 5^46
+  POW5(8c213d9da502de45, 4526f422cc340000),  // 5^47
+  POW5(af298d050e4395d6, 9670b12b7f410000),  // 5^48
+  POW5(daf3f04651d47b4c, 3c0cdd765f114000),  // 5^49
+  POW5(88d8762bf324cd0f, a5880a69fb6ac800),  // 5^50
+  POW5(ab0e93b6efee0053, 8eea0d047a457a00),  // 5^51
+  POW5(d5d238a4abe98068, 72a4904598d6d880),  // 5^52
+  POW5(85a36366eb71f041, 47a6da2b7f864750),  // 5^53
+  POW5(a70c3c40a64e6c51, 999090b65f67d924),  // 5^54
+  POW5(d0cf4b50cfe20765, fff4b4e3f741cf6d),  // 5^55
+  POW5(82818f1281ed449f, bff8f10e7a8921a4),  // 5^56
+  POW5(a321f2d7226895c7, aff72d52192b6a0d),  // 5^57
+  POW5(cbea6f8ceb02bb39, 9bf4f8a69f764490),  // 5^58
+  POW5(fee50b7025c36a08, 02f236d04753d5b4),  // 5^59
+  POW5(9f4f2726179a2245, 01d762422c946590),  // 5^60
+  POW5(c722f0ef9d80aad6, 424d3ad2b7b97ef5),  // 5^61
+  POW5(f8ebad2b84e0d58b, d2e0898765a7deb2),  // 5^62
+  POW5(9b934c3b330c8577, 63cc55f49f88eb2f),  // 5^63
+  POW5(c2781f49ffcfa6d5, 3cbf6b71c76b25fb),  // 5^64
+  POW5(f316271c7fc3908a, 8bef464e3945ef7a),  // 5^65
+  POW5(97edd871cfda3a56, 97758bf0e3cbb5ac),  // 5^66
+  POW5(bde94e8e43d0c8ec, 3d52eeed1cbea317),  // 5^67
+  POW5(ed63a231d4c4fb27, 4ca7aaa863ee4bdd),  // 5^68
+  POW5(945e455f24fb1cf8, 8fe8caa93e74ef6a),  // 5^69
+  POW5(b975d6b6ee39e436, b3e2fd538e122b44),  // 5^70
+  POW5(e7d34c64a9c85d44, 60dbbca87196b616),  // 5^71
+  POW5(90e40fbeea1d3a4a, bc8955e946fe31cd),  // 5^72
+  POW5(b51d13aea4a488dd, 6babab6398bdbe41),  // 5^73
+  POW5(e264589a4dcdab14, c696963c7eed2dd1),  // 5^74
+  POW5(8d7eb76070a08aec, fc1e1de5cf543ca2),  // 5^75
+  POW5(b0de65388cc8ada8, 3b25a55f43294bcb),  // 5^76
+  POW5(dd15fe86affad912, 49ef0eb713f39ebe),  // 5^77
+  POW5(8a2dbf142dfcc7ab, 6e3569326c784337),  // 5^78
+  POW5(acb92ed9397bf996, 49c2c37f07965404),  // 5^79
+  POW5(d7e77a8f87daf7fb, dc33745ec97be906),  // 5^80
+  POW5(86f0ac99b4e8dafd, 69a028bb3ded71a3),  // 5^81
+  POW5(a8acd7c0222311bc, c40832ea0d68ce0c),  // 5^82
+  POW5(d2d80db02aabd62b, f50a3fa490c30190),  // 5^83
+  POW5(83c7088e1aab65db, 792667c6da79e0fa),  // 5^84
+  POW5(a4b8cab1a1563f52, 577001b891185938),  // 5^85
+  POW5(cde6fd5e09abcf26, ed4c0226b55e6f86),  // 5^86
+  POW5(80b05e5ac60b6178, 544f8158315b05b4),  // 5^87
+  POW5(a0dc75f1778e39d6, 696361ae3db1c721),  // 5^88
+  POW5(c913936dd571c84c, 03bc3a19cd1e38e9),  // 5^89
+  POW5(fb5878494ace3a5f, 04ab48a04065c723),  // 5^90
+  POW5(9d174b2dcec0e47b, 62eb0d64283f9c76),  // 5^91
+  POW5(c45d1df942711d9a, 3ba5d0bd324f8394),  // 5^92
+  POW5(f5746577930d6500, ca8f44ec7ee36479),  // 5^93
+  POW5(9968bf6abbe85f20, 7e998b13cf4e1ecb),  // 5^94
+  POW5(bfc2ef456ae276e8, 9e3fedd8c321a67e),  // 5^95
+  POW5(efb3ab16c59b14a2, c5cfe94ef3ea101e),  // 5^96
+  POW5(95d04aee3b80ece5, bba1f1d158724a12),  // 5^97
+  POW5(bb445da9ca61281f, 2a8a6e45ae8edc97),  // 5^98
+  POW5(ea1575143cf97226, f52d09d71a3293bd),  // 5^99
+  POW5(924d692ca61be758, 593c2626705f9c56),  // 5^100
+  POW5(b6e0c377cfa2e12e, 6f8b2fb00c77836c),  // 5^101
+  POW5(e498f455c38b997a, 0b6dfb9c0f956447),  // 5^102
+  POW5(8edf98b59a373fec, 4724bd4189bd5eac),  // 5^103
+  POW5(b2977ee300c50fe7, 58edec91ec2cb657),  // 5^104
+  POW5(df3d5e9bc0f653e1, 2f2967b66737e3ed),  // 5^105
+  POW5(8b865b215899f46c, bd79e0d20082ee74),  // 5^106
+  POW5(ae67f1e9aec07187, ecd8590680a3aa11),  // 5^107
+  POW5(da01ee641a708de9, e80e6f4820cc9495),  // 5^108
+  POW5(884134fe908658b2, 3109058d147fdcdd),  // 5^109
+  POW5(aa51823e34a7eede, bd4b46f0599fd415),  // 5^110
+  POW5(d4e5e2cdc1d1ea96, 6c9e18ac7007c91a),  // 5^111
+  POW5(850fadc09923329e, 03e2cf6bc604ddb0),  // 5^112
+  POW5(a6539930bf6bff45, 84db8346b786151c),  // 5^113
+  POW5(cfe87f7cef46ff16, e612641865679a63),  // 5^114
+  POW5(81f14fae158c5f6e, 4fcb7e8f3f60c07e),  // 5^115
+  POW5(a26da3999aef7749, e3be5e330f38f09d),  // 5^116
+  POW5(cb090c8001ab551c, 5cadf5bfd3072cc5),  // 5^117
+  POW5(fdcb4fa002162a63, 73d9732fc7c8f7f6),  // 5^118
+  POW5(9e9f11c4014dda7e, 2867e7fddcdd9afa),  // 5^119
+  POW5(c646d63501a1511d, b281e1fd541501b8),  // 5^120
+  POW5(f7d88bc24209a565, 1f225a7ca91a4226),  // 5^121
+  POW5(9ae757596946075f, 3375788de9b06958),  // 5^122
+  POW5(c1a12d2fc3978937, 0052d6b1641c83ae),  // 5^123
+  POW5(f209787bb47d6b84, c0678c5dbd23a49a),  // 5^124
+  POW5(9745eb4d50ce6332, f840b7ba963646e0),  // 5^125
+  POW5(bd176620a501fbff, b650e5a93bc3d898),  // 5^126
+  POW5(ec5d3fa8ce427aff, a3e51f138ab4cebe),  // 5^127
+  POW5(93ba47c980e98cdf, c66f336c36b10137),  // 5^128
+  POW5(b8a8d9bbe123f017, b80b0047445d4184),  // 5^129
+  POW5(e6d3102ad96cec1d, a60dc059157491e5),  // 5^130
+  POW5(9043ea1ac7e41392, 87c89837ad68db2f),  // 5^131
+  POW5(b454e4a179dd1877, 29babe4598c311fb),  // 5^132
+  POW5(e16a1dc9d8545e94, f4296dd6fef3d67a),  // 5^133
+  POW5(8ce2529e2734bb1d, 1899e4a65f58660c),  // 5^134
+  POW5(b01ae745b101e9e4, 5ec05dcff72e7f8f),  // 5^135
+  POW5(dc21a1171d42645d, 76707543f4fa1f73),  // 5^136
+  POW5(899504ae72497eba, 6a06494a791c53a8),  // 5^137
+  POW5(abfa45da0edbde69, 0487db9d17636892),  // 5^138
+  POW5(d6f8d7509292d603, 45a9d2845d3c42b6),  // 5^139
+  POW5(865b86925b9bc5c2, 0b8a2392ba45a9b2),  // 5^140
+  POW5(a7f26836f282b732, 8e6cac7768d7141e),  // 5^141
+  POW5(d1ef0244af2364ff, 3207d795430cd926),  // 5^142
+  POW5(8335616aed761f1f, 7f44e6bd49e807b8),  // 5^143
+  POW5(a402b9c5a8d3a6e7, 5f16206c9c6209a6),  // 5^144
+  POW5(cd036837130890a1, 36dba887c37a8c0f),  // 5^145
+  POW5(802221226be55a64, c2494954da2c9789),  // 5^146
+  POW5(a02aa96b06deb0fd, f2db9baa10b7bd6c),  // 5^147
+  POW5(c83553c5c8965d3d, 6f92829494e5acc7),  // 5^148
+  POW5(fa42a8b73abbf48c, cb772339ba1f17f9),  // 5^149
+  POW5(9c69a97284b578d7, ff2a760414536efb),  // 5^150
+  POW5(c38413cf25e2d70d, fef5138519684aba),  // 5^151
+  POW5(f46518c2ef5b8cd1, 7eb258665fc25d69),  // 5^152
+  POW5(98bf2f79d5993802, ef2f773ffbd97a61),  // 5^153
+  POW5(beeefb584aff8603, aafb550ffacfd8fa),  // 5^154
+  POW5(eeaaba2e5dbf6784, 95ba2a53f983cf38),  // 5^155
+  POW5(952ab45cfa97a0b2, dd945a747bf26183),  // 5^156
+  POW5(ba756174393d88df, 94f971119aeef9e4),  // 5^157
+  POW5(e912b9d1478ceb17, 7a37cd5601aab85d),  // 5^158
+  POW5(91abb422ccb812ee, ac62e055c10ab33a),  // 5^159
+  POW5(b616a12b7fe617aa, 577b986b314d6009),  // 5^160
+  POW5(e39c49765fdf9d94, ed5a7e85fda0b80b),  // 5^161
+  POW5(8e41ade9fbebc27d, 14588f13be847307),  // 5^162
+  POW5(b1d219647ae6b31c, 596eb2d8ae258fc8),  // 5^163
+  POW5(de469fbd99a05fe3, 6fca5f8ed9aef3bb),  // 5^164
+  POW5(8aec23d680043bee, 25de7bb9480d5854),  // 5^165
+  POW5(ada72ccc20054ae9, af561aa79a10ae6a),  // 5^166
+  POW5(d910f7ff28069da4, 1b2ba1518094da04),  // 5^167
+  POW5(87aa9aff79042286, 90fb44d2f05d0842),  // 5^168
+  POW5(a99541bf57452b28, 353a1607ac744a53),  // 5^169
+  POW5(d3fa922f2d1675f2, 42889b8997915ce8),  // 5^170
+  POW5(847c9b5d7c2e09b7, 69956135febada11),  // 5^171
+  POW5(a59bc234db398c25, 43fab9837e699095),  // 5^172
+  POW5(cf02b2c21207ef2e, 94f967e45e03f4bb),  // 5^173
+  POW5(8161afb94b44f57d, 1d1be0eebac278f5),  // 5^174
+  POW5(a1ba1ba79e1632dc, 6462d92a69731732),  // 5^175
+  POW5(ca28a291859bbf93, 7d7b8f7503cfdcfe),  // 5^176
+  POW5(fcb2cb35e702af78, 5cda735244c3d43e),  // 5^177
+  POW5(9defbf01b061adab, 3a0888136afa64a7),  // 5^178
+  POW5(c56baec21c7a1916, 088aaa1845b8fdd0),  // 5^179
+  POW5(f6c69a72a3989f5b, 8aad549e57273d45),  // 5^180
+  POW5(9a3c2087a63f6399, 36ac54e2f678864b),  // 5^181
+  POW5(c0cb28a98fcf3c7f, 84576a1bb416a7dd),  // 5^182
+  POW5(f0fdf2d3f3c30b9f, 656d44a2a11c51d5),  // 5^183
+  POW5(969eb7c47859e743, 9f644ae5a4b1b325),  // 5^184
+  POW5(bc4665b596706114, 873d5d9f0dde1fee),  // 5^185
+  POW5(eb57ff22fc0c7959, a90cb506d155a7ea),  // 5^186
+  POW5(9316ff75dd87cbd8, 09a7f12442d588f2),  // 5^187
+  POW5(b7dcbf5354e9bece, 0c11ed6d538aeb2f),  // 5^188
+  POW5(e5d3ef282a242e81, 8f1668c8a86da5fa),  // 5^189
+  POW5(8fa475791a569d10, f96e017d694487bc),  // 5^190
+  POW5(b38d92d760ec4455, 37c981dcc395a9ac),  // 5^191
+  POW5(e070f78d3927556a, 85bbe253f47b1417),  // 5^192
+  POW5(8c469ab843b89562, 93956d7478ccec8e),  // 5^193
+  POW5(af58416654a6babb, 387ac8d1970027b2),  // 5^194
+  POW5(db2e51bfe9d0696a, 06997b05fcc0319e),  // 5^195
+  POW5(88fcf317f22241e2, 441fece3bdf81f03),  // 5^196
+  POW5(ab3c2fddeeaad25a, d527e81cad7626c3),  // 5^197
+  POW5(d60b3bd56a5586f1, 8a71e223d8d3b074),  // 5^198
+  POW5(85c7056562757456, f6872d5667844e49),  // 5^199
+  POW5(a738c6bebb12d16c, b428f8ac016561db),  // 5^200
+  POW5(d106f86e69d785c7, e13336d701beba52),  // 5^201
+  POW5(82a45b450226b39c, ecc0024661173473),  // 5^202
+  POW5(a34d721642b06084, 27f002d7f95d0190),  // 5^203
+  POW5(cc20ce9bd35c78a5, 31ec038df7b441f4),  // 5^204
+  POW5(ff290242c83396ce, 7e67047175a15271),  // 5^205
+  POW5(9f79a169bd203e41, 0f0062c6e984d386),  // 5^206
+  POW5(c75809c42c684dd1, 52c07b78a3e60868),  // 5^207
+  POW5(f92e0c3537826145, a7709a56ccdf8a82),  // 5^208
+  POW5(9bbcc7a142b17ccb, 88a66076400bb691),  // 5^209
+  POW5(c2abf989935ddbfe, 6acff893d00ea435),  // 5^210
+  POW5(f356f7ebf83552fe, 0583f6b8c4124d43),  // 5^211
+  POW5(98165af37b2153de, c3727a337a8b704a),  // 5^212
+  POW5(be1bf1b059e9a8d6, 744f18c0592e4c5c),  // 5^213
+  POW5(eda2ee1c7064130c, 1162def06f79df73),  // 5^214
+  POW5(9485d4d1c63e8be7, 8addcb5645ac2ba8),  // 5^215
+  POW5(b9a74a0637ce2ee1, 6d953e2bd7173692),  // 5^216
+  POW5(e8111c87c5c1ba99, c8fa8db6ccdd0437),  // 5^217
+  POW5(910ab1d4db9914a0, 1d9c9892400a22a2),  // 5^218
+  POW5(b54d5e4a127f59c8, 2503beb6d00cab4b),  // 5^219
+  POW5(e2a0b5dc971f303a, 2e44ae64840fd61d),  // 5^220
+  POW5(8da471a9de737e24, 5ceaecfed289e5d2),  // 5^221
+  POW5(b10d8e1456105dad, 7425a83e872c5f47),  // 5^222
+  POW5(dd50f1996b947518, d12f124e28f77719),  // 5^223
+  POW5(8a5296ffe33cc92f, 82bd6b70d99aaa6f),  // 5^224
+  POW5(ace73cbfdc0bfb7b, 636cc64d1001550b),  // 5^225
+  POW5(d8210befd30efa5a, 3c47f7e05401aa4e),  // 5^226
+  POW5(8714a775e3e95c78, 65acfaec34810a71),  // 5^227
+  POW5(a8d9d1535ce3b396, 7f1839a741a14d0d),  // 5^228
+  POW5(d31045a8341ca07c, 1ede48111209a050),  // 5^229
+  POW5(83ea2b892091e44d, 934aed0aab460432),  // 5^230
+  POW5(a4e4b66b68b65d60, f81da84d5617853f),  // 5^231
+  POW5(ce1de40642e3f4b9, 36251260ab9d668e),  // 5^232
+  POW5(80d2ae83e9ce78f3, c1d72b7c6b426019),  // 5^233
+  POW5(a1075a24e4421730, b24cf65b8612f81f),  // 5^234
+  POW5(c94930ae1d529cfc, dee033f26797b627),  // 5^235
+  POW5(fb9b7cd9a4a7443c, 169840ef017da3b1),  // 5^236
+  POW5(9d412e0806e88aa5, 8e1f289560ee864e),  // 5^237
+  POW5(c491798a08a2ad4e, f1a6f2bab92a27e2),  // 5^238
+  POW5(f5b5d7ec8acb58a2, ae10af696774b1db),  // 5^239
+  POW5(9991a6f3d6bf1765, acca6da1e0a8ef29),  // 5^240
+  POW5(bff610b0cc6edd3f, 17fd090a58d32af3),  // 5^241
+  POW5(eff394dcff8a948e, ddfc4b4cef07f5b0),  // 5^242
+  POW5(95f83d0a1fb69cd9, 4abdaf101564f98e),  // 5^243
+  POW5(bb764c4ca7a4440f, 9d6d1ad41abe37f1),  // 5^244
+  POW5(ea53df5fd18d5513, 84c86189216dc5ed),  // 5^245
+  POW5(92746b9be2f8552c, 32fd3cf5b4e49bb4),  // 5^246
+  POW5(b7118682dbb66a77, 3fbc8c33221dc2a1),  // 5^247
+  POW5(e4d5e82392a40515, 0fabaf3feaa5334a),  // 5^248
+  POW5(8f05b1163ba6832d, 29cb4d87f2a7400e),  // 5^249
+  POW5(b2c71d5bca9023f8, 743e20e9ef511012),  // 5^250
+  POW5(df78e4b2bd342cf6, 914da9246b255416),  // 5^251
+  POW5(8bab8eefb6409c1a, 1ad089b6c2f7548e),  // 5^252
+  POW5(ae9672aba3d0c320, a184ac2473b529b1),  // 5^253
+  POW5(da3c0f568cc4f3e8, c9e5d72d90a2741e),  // 5^254
+  POW5(8865899617fb1871, 7e2fa67c7a658892),  // 5^255
+  POW5(aa7eebfb9df9de8d, ddbb901b98feeab7),  // 5^256
+  POW5(d51ea6fa85785631, 552a74227f3ea565),  // 5^257
+  POW5(8533285c936b35de, d53a88958f87275f),  // 5^258
+  POW5(a67ff273b8460356, 8a892abaf368f137),  // 5^259
+  POW5(d01fef10a657842c, 2d2b7569b0432d85),  // 5^260
+  POW5(8213f56a67f6b29b, 9c3b29620e29fc73),  // 5^261
+  POW5(a298f2c501f45f42, 8349f3ba91b47b8f),  // 5^262
+  POW5(cb3f2f7642717713, 241c70a936219a73),  // 5^263
+  POW5(fe0efb53d30dd4d7, ed238cd383aa0110),  // 5^264
+  POW5(9ec95d1463e8a506, f4363804324a40aa),  // 5^265
+  POW5(c67bb4597ce2ce48, b143c6053edcd0d5),  // 5^266
+  POW5(f81aa16fdc1b81da, dd94b7868e94050a),  // 5^267
+  POW5(9b10a4e5e9913128, ca7cf2b4191c8326),  // 5^268
+  POW5(c1d4ce1f63f57d72, fd1c2f611f63a3f0),  // 5^269
+  POW5(f24a01a73cf2dccf, bc633b39673c8cec),  // 5^270
+  POW5(976e41088617ca01, d5be0503e085d813),  // 5^271
+  POW5(bd49d14aa79dbc82, 4b2d8644d8a74e18),  // 5^272
+  POW5(ec9c459d51852ba2, ddf8e7d60ed1219e),  // 5^273
+  POW5(93e1ab8252f33b45, cabb90e5c942b503),  // 5^274
+  POW5(b8da1662e7b00a17, 3d6a751f3b936243),  // 5^275
+  POW5(e7109bfba19c0c9d, 0cc512670a783ad4),  // 5^276
+  POW5(906a617d450187e2, 27fb2b80668b24c5),  // 5^277
+  POW5(b484f9dc9641e9da, b1f9f660802dedf6),  // 5^278
+  POW5(e1a63853bbd26451, 5e7873f8a0396973),  // 5^279
+  POW5(8d07e33455637eb2, db0b487b6423e1e8),  // 5^280
+  POW5(b049dc016abc5e5f, 91ce1a9a3d2cda62),  // 5^281
+  POW5(dc5c5301c56b75f7, 7641a140cc7810fb),  // 5^282
+  POW5(89b9b3e11b6329ba, a9e904c87fcb0a9d),  // 5^283
+  POW5(ac2820d9623bf429, 546345fa9fbdcd44),  // 5^284
+  POW5(d732290fbacaf133, a97c177947ad4095),  // 5^285
+  POW5(867f59a9d4bed6c0, 49ed8eabcccc485d),  // 5^286
+  POW5(a81f301449ee8c70, 5c68f256bfff5a74),  // 5^287
+  POW5(d226fc195c6a2f8c, 73832eec6fff3111),  // 5^288
+  POW5(83585d8fd9c25db7, c831fd53c5ff7eab),  // 5^289
+  POW5(a42e74f3d032f525, ba3e7ca8b77f5e55),  // 5^290
+  POW5(cd3a1230c43fb26f, 28ce1bd2e55f35eb),  // 5^291
+  POW5(80444b5e7aa7cf85, 7980d163cf5b81b3),  // 5^292
+  POW5(a0555e361951c366, d7e105bcc332621f),  // 5^293
+  POW5(c86ab5c39fa63440, 8dd9472bf3fefaa7),  // 5^294
+  POW5(fa856334878fc150, b14f98f6f0feb951),  // 5^295
+  POW5(9c935e00d4b9d8d2, 6ed1bf9a569f33d3),  // 5^296
+  POW5(c3b8358109e84f07, 0a862f80ec4700c8),  // 5^297
+  POW5(f4a642e14c6262c8, cd27bb612758c0fa),  // 5^298
+  POW5(98e7e9cccfbd7dbd, 8038d51cb897789c),  // 5^299
+  POW5(bf21e44003acdd2c, e0470a63e6bd56c3),  // 5^300
+  POW5(eeea5d5004981478, 1858ccfce06cac74),  // 5^301
+  POW5(95527a5202df0ccb, 0f37801e0c43ebc8),  // 5^302
+  POW5(baa718e68396cffd, d30560258f54e6ba),  // 5^303
+  POW5(e950df20247c83fd, 47c6b82ef32a2069),  // 5^304
+  POW5(91d28b7416cdd27e, 4cdc331d57fa5441),  // 5^305
+  POW5(b6472e511c81471d, e0133fe4adf8e952),  // 5^306
+  POW5(e3d8f9e563a198e5, 58180fddd97723a6),  // 5^307
+  POW5(8e679c2f5e44ff8f, 570f09eaa7ea7648),  // 5^308
+  POW5(b201833b35d63f73, 2cd2cc6551e513da),  // 5^309
+  POW5(de81e40a034bcf4f, f8077f7ea65e58d1),  // 5^310
+  POW5(8b112e86420f6191, fb04afaf27faf782),  // 5^311
+  POW5(add57a27d29339f6, 79c5db9af1f9b563),  // 5^312
+  POW5(d94ad8b1c7380874, 18375281ae7822bc),  // 5^313
+  POW5(87cec76f1c830548, 8f2293910d0b15b5),  // 5^314
+  POW5(a9c2794ae3a3c69a, b2eb3875504ddb22),  // 5^315
+  POW5(d433179d9c8cb841, 5fa60692a46151eb),  // 5^316
+  POW5(849feec281d7f328, dbc7c41ba6bcd333),  // 5^317
+  POW5(a5c7ea73224deff3, 12b9b522906c0800),  // 5^318
+  POW5(cf39e50feae16bef, d768226b34870a00),  // 5^319
+  POW5(81842f29f2cce375, e6a1158300d46640),  // 5^320
+  POW5(a1e53af46f801c53, 60495ae3c1097fd0),  // 5^321
+  POW5(ca5e89b18b602368, 385bb19cb14bdfc4),  // 5^322
+  POW5(fcf62c1dee382c42, 46729e03dd9ed7b5),  // 5^323
+  POW5(9e19db92b4e31ba9, 6c07a2c26a8346d1),  // 5^324
+  POW5(c5a05277621be293, c7098b7305241885),  // 5^325
+};
+
+#undef POW5
+
+// ===================================================================
+// Integer helpers.
+
+// Computes the 128-bit product of a and b.
+inline void Multiply64(uint64 a, uint64 b, uint64* high, uint64* low) {
+#if defined(__SIZEOF_INT128__)
+  __extension__ typedef unsigned __int128 uint128;
+  uint128 product = static_cast<uint128>(a) * b;
+  *high = static_cast<uint64>(product >> 64);
+  *low = static_cast<uint64>(product);
+#elif defined(_MSC_VER) && defined(_M_X64)
+  *low = _umul128(a, b, high);
+#else
+  uint64 a_low = static_cast<uint32>(a);
+  uint64 a_high = a >> 32;
+  uint64 b_low = static_cast<uint32>(b);
+  uint64 b_high = b >> 32;
+  uint64 low_low = a_low * b_low;
+  uint64 low_high = a_low * b_high;
+  uint64 high_low = a_high * b_low;
+  uint64 high_high = a_high * b_high;
+  uint64 middle = (low_low >> 32) + static_cast<uint32>(low_high) +
+                  static_cast<uint32>(high_low);
+  *low = (middle << 32) | static_cast<uint32>(low_low);
+  *high = high_high + (low_high >> 32) + (high_low >> 32) + (middle >> 32);
+#endif
+}
+
+inline uint64 DoubleBits(double value) {
+  uint64 bits;
+  memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+inline uint32 FloatBits(float value) {
+  uint32 bits;
+  memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+// floor(log10(2^e)), for 0 <= e <= 1650.
+inline int Log10Pow2(int e) {
+  return (static_cast<uint32>(e) * 78913) >> 18;
+}
+
+// floor(log10(5^e)), for 0 <= e <= 2620.
+inline int Log10Pow5(int e) {
+  return (static_cast<uint32>(e) * 732923) >> 20;
+}
+
+// The number of bits in 5^e, for 0 <= e <= 3528.
+inline int Pow5Bits(int e) {
+  return static_cast<int>((static_cast<uint32>(e) * 1217359) >> 19) + 1;
+}
+
+inline bool MultipleOfPowerOf5(uint64 value, int p) {
+  int count = 0;
+  while (value % 5 == 0) {
+    value /= 5;
+    ++count;
+  }
+  return count >= p;
+}
+
+inline bool MultipleOfPowerOf2(uint64 value, int p) {
+  return (value & ((GOOGLE_ULONGLONG(1) << p) - 1)) == 0;
+}
+
+// ===================================================================
+// Ryu.
+//
+// The value is m2 * 2^e2; mv = 4 * m2 and the values halfway to its
+// neighbours, mp and mm, are scaled by 10^-e10 using either 2^-e2 / 10^q
+// (for e2 >= 0) or 5^-e2 / 10^q (for e2 < 0), computed to enough precision
+// that the digits of the results vp, vr and vm are exact.  Digits are then
+// removed from all three while vp and vm still differ, which leaves the
+// shortest decimal within the rounding interval; vr, rounded, picks the
+// closest one.
+
+// 5^i, truncated to 125 bits, for 0 <= i <= kMaxPowerOfFive.
+const int kPow5BitCount = 125;
+inline void Pow5Split(int i, uint64* high, uint64* low) {
+  const uint64* entry = kPowersOfFive[i - kMinPowerOfFive];
+  *high = entry[0] >> 3;
+  *low = (entry[1] >> 3) | (entry[0] << 61);
+}
+
+// floor(2^k / 5^q) + 1 for the k which makes it 125 bits long (126 for
+// q = 0), for 0 <= q <= -kMinPowerOfFive.
+const int kPow5InvBitCount = 125;
+inline void Pow5InvSplit(int q, uint64* high, uint64* low) {
+  if (q == 0) {
+    *high = GOOGLE_ULONGLONG(1) << 61;
+    *low = 1;
+    return;
+  }
+  uint64 entry_high = kPowersOfFive[-q - kMinPowerOfFive][0];
+  uint64 entry_low = kPowersOfFive[-q - kMinPowerOfFive][1];
+  if (q <= 27) {
+    // The entry is exactly the floor plus one.
+    if (entry_low-- == 0) --entry_high;
+  }
+  *high = entry_high >> 3;
+  *low = (entry_low >> 3) | (entry_high << 61);
+  if (++*low == 0) ++*high;
+}
+
+// (m * multiplier) >> shift, where multiplier is 128 bits and
+// 64 <= shift < 128.  The result must fit in 64 bits.
+inline uint64 MulShift64(uint64 m, uint64 multiplier_high,
+                         uint64 multiplier_low, int shift) {
+  uint64 low_high, low_low;
+  Multiply64(m, multiplier_low, &low_high, &low_low);
+  uint64 high_high, high_low;
+  Multiply64(m, multiplier_high, &high_high, &high_low);
+  uint64 sum_low = high_low + low_high;
+  uint64 sum_high = high_high + (sum_low < low_high);
+  shift -= 64;
+  if (shift == 0) return sum_low;
+  return (sum_high << (64 - shift)) | (sum_low >> shift);
+}
+
+// (m * multiplier) >> shift, where 32 <= shift < 96.  The result must fit
+// in 32 bits.
+inline uint32 MulShift32(uint32 m, uint64 multiplier, int shift) {
+  uint64 low = static_cast<uint64>(m) * static_cast<uint32>(multiplier);
+  uint64 high = static_cast<uint64>(m) * (multiplier >> 32);
+  uint64 sum = (low >> 32) + high;
+  return static_cast<uint32>(sum >> (shift - 32));
+}
+
+// Removes digits from vr while vp and vm still differ after removing the
+// same digits from them, and rounds the result.  The shared tail of Ryu for
+// doubles and floats.
+template <typename UInt>
+UInt RemoveDigits(UInt vr, UInt vp, UInt vm, bool accept_bounds,
+                  bool vm_is_trailing_zeros, bool vr_is_trailing_zeros,
+                  int last_removed_digit, int* removed) {
+  if (vm_is_trailing_zeros || vr_is_trailing_zeros) {
+    // The general case, which happens rarely.
+    while (vp / 10 > vm / 10) {
+      vm_is_trailing_zeros &= vm % 10 == 0;
+      vr_is_trailing_zeros &= last_removed_digit == 0;
+      last_removed_digit = static_cast<int>(vr % 10);
+      vr /= 10;
+      vp /= 10;
+      vm /= 10;
+      ++*removed;
+    }
+    if (vm_is_trailing_zeros) {
+      while (vm % 10 == 0) {
+        vr_is_trailing_zeros &= last_removed_digit == 0;
+        last_removed_digit = static_cast<int>(vr % 10);
+        vr /= 10;
+        vp /= 10;
+        vm /= 10;
+        ++*removed;
+      }
+    }
+    if (vr_is_trailing_zeros && last_removed_digit == 5 && vr % 2 == 0) {
+      // Exactly halfway between two decimals:  round to even.
+      last_removed_digit = 4;
+    }
+    return vr + ((vr == vm && (!accept_bounds || !vm_is_trailing_zeros)) ||
+                 last_removed_digit >= 5);
+  } else {
+    // The common case:  no trailing zeros to worry about.
+    while (vp / 10 > vm / 10) {
+      last_removed_digit = static_cast<int>(vr % 10);
+      vr /= 10;
+      vp /= 10;
+      vm /= 10;
+      ++*removed;
+    }
+    return vr + (vr == vm || last_removed_digit >= 5);
+  }
+}
+
+// ===================================================================
+// Eisel-Lemire.
+
+// Returns the bits of the double nearest to w * 10^q, rounding halfway
+// cases to even.  This is exact for any w, including the zero and infinite
+// results of q out of range, without ever needing more than the 128 bits of
+// the table (see Mushtak and Lemire, "Fast Number Parsing Without
+// Fallback", 2023).
+uint64 DecimalToDoubleBits(uint64 w, int q) {
+  const int kMantissaBits = 52;
+  const int kMinimumExponent = -1023;
+  const int kInfinitePower = 0x7ff;
+
+  if (w == 0 || q < kMinPowerOfFive) return 0;
+  if (q > 308) return static_cast<uint64>(kInfinitePower) << kMantissaBits;
+
+  int leading_zeros = 0;
+  while ((w & (GOOGLE_ULONGLONG(1) << 63)) == 0) {
+    w <<= 1;
+    ++leading_zeros;
+  }
+
+  // w * 5^q to 64 bits, plus the next 64 where those could matter.
+  const uint64* entry = kPowersOfFive[q - kMinPowerOfFive];
+  uint64 product_high, product_low;
+  Multiply64(w, entry[0], &product_high, &product_low);
+  const uint64 kPrecisionMask = GOOGLE_ULONGLONG(0xffffffffffffffff) >>
+                                (kMantissaBits + 3);
+  if ((product_high & kPrecisionMask) == kPrecisionMask) {
+    uint64 second_high, second_low;
+    Multiply64(w, entry[1], &second_high, &second_low);
+    product_low += second_high;
+    if (second_high > product_low) ++product_high;
+  }
+
+  int upper_bit = static_cast<int>(product_high >> 63);
+  int shift = upper_bit + 64 - kMantissaBits - 3;
+  uint64 mantissa = product_high >> shift;
+  // floor(log2(10^q)) + 63, plus the exponent bias.
+  int power2 = (((152170 + 65536) * q) >> 16) + 63 + upper_bit -
+               leading_zeros - kMinimumExponent;
+
+  if (power2 <= 0) {
+    // Subnormal, or zero.
+    if (-power2 + 1 >= 64) return 0;
+    mantissa >>= -power2 + 1;
+    mantissa += mantissa & 1;
+    mantissa >>= 1;
+    // Rounding up may have made it normal after all.
+    power2 = mantissa < (GOOGLE_ULONGLONG(1) << kMantissaBits) ? 0 : 1;
+    return (mantissa & ((GOOGLE_ULONGLONG(1) << kMantissaBits) - 1)) |
+           (static_cast<uint64>(power2) << kMantissaBits);
+  }
+
+  // If the product is exactly halfway between two doubles, round to even
+  // rather than up.  This can only happen where 5^q is exact in 64 bits.
+  if (product_low <= 1 && q >= -4 && q <= 23 && (mantissa & 3) == 1 &&
+      (mantissa << shift) == product_high) {
+    mantissa &= ~GOOGLE_ULONGLONG(1);
+  }
+  mantissa += mantissa & 1;
+  mantissa >>= 1;
+  if (mantissa >= (GOOGLE_ULONGLONG(2) << kMantissaBits)) {
+    mantissa = GOOGLE_ULONGLONG(1) << kMantissaBits;
+    ++power2;
+  }
+  mantissa &= ~(GOOGLE_ULONGLONG(1) << kMantissaBits);
+  if (power2 >= kInfinitePower) {
+    return static_cast<uint64>(kInfinitePower) << kMantissaBits;
+  }
+  return mantissa | (static_cast<uint64>(power2) << kMantissaBits);
+}
+
+inline bool IsDigit(char c) {
+  return '0' <= c && c <= '9';
+}
+
+}  // namespace
+
+// -------------------------------------------------------------------
+
+void ShortestDecimal(double value, uint64* significand, int* exponent) {
+  const int kMantissaBits = 52;
+  const int kBias = 1023;
+
+  uint64 bits = DoubleBits(value);
+  uint64 ieee_mantissa = bits & ((GOOGLE_ULONGLONG(1) << kMantissaBits) - 1);
+  int ieee_exponent = static_cast<int>(bits >> kMantissaBits) & 0x7ff;
+  GOOGLE_DCHECK(ieee_exponent != 0x7ff && (bits >> 63) == 0 && bits != 0);
+
+  // Integers below 2^53 are exact, so are their own shortest decimal, less
+  // any trailing zeros.  They are common enough to be worth the shortcut.
+  int unbiased = ieee_exponent - kBias - kMantissaBits;
+  if (ieee_exponent != 0 && unbiased <= 0 && unbiased >= -kMantissaBits) {
+    uint64 m = (GOOGLE_ULONGLONG(1) << kMantissaBits) | ieee_mantissa;
+    uint64 fraction_mask = (GOOGLE_ULONGLONG(1) << -unbiased) - 1;
+    if ((m & fraction_mask) == 0) {
+      m >>= -unbiased;
+      int e = 0;
+      while (m % 10 == 0) {
+        m /= 10;
+        ++e;
+      }
+      *significand = m;
+      *exponent = e;
+      return;
+    }
+  }
+
+  int e2;
+  uint64 m2;
+  if (ieee_exponent == 0) {
+    e2 = 1 - kBias - kMantissaBits - 2;
+    m2 = ieee_mantissa;
+  } else {
+    e2 = ieee_exponent - kBias - kMantissaBits - 2;
+    m2 = (GOOGLE_ULONGLONG(1) << kMantissaBits) | ieee_mantissa;
+  }
+  bool accept_bounds = (m2 & 1) == 0;
+
+  uint64 mv = 4 * m2;
+  // The lower neighbour is closer if m2 is the smallest normal significand.
+  int mm_shift = ieee_mantissa != 0 || ieee_exponent <= 1;
+  uint64 mp = mv + 2;
+  uint64 mm = mv - 1 - mm_shift;
+
+  uint64 vr, vp, vm;
+  int e10;
+  bool vm_is_trailing_zeros = false;
+  bool vr_is_trailing_zeros = false;
+  if (e2 >= 0) {
+    // One digit less than could be, so that the loop below removes at
+    // least one and so computes last_removed_digit.
+    int q = Log10Pow2(e2) - (e2 > 3);
+    e10 = q;
+    int k = kPow5InvBitCount + Pow5Bits(q) - 1;
+    int i = -e2 + q + k;
+    uint64 high, low;
+    Pow5InvSplit(q, &high, &low);
+    vr = MulShift64(mv, high, low, i);
+    vp = MulShift64(mp, high, low, i);
+    vm = MulShift64(mm, high, low, i);
+    if (q <= 21) {
+      // Only one of mp, mv and mm can be a multiple of 5, if any.
+      if (mv % 5 == 0) {
+        vr_is_trailing_zeros = MultipleOfPowerOf5(mv, q);
+      } else if (accept_bounds) {
+        vm_is_trailing_zeros = MultipleOfPowerOf5(mm, q);
+      } else {
+        vp -= MultipleOfPowerOf5(mp, q);
+      }
+    }
+  } else {
+    int q = Log10Pow5(-e2) - (-e2 > 1);
+    e10 = q + e2;
+    int i = -e2 - q;
+    int k = Pow5Bits(i) - kPow5BitCount;
+    int j = q - k;
+    uint64 high, low;
+    Pow5Split(i, &high, &low);
+    vr = MulShift64(mv, high, low, j);
+    vp = MulShift64(mp, high, low, j);
+    vm = MulShift64(mm, high, low, j);
+    if (q <= 1) {
+      // mv, mp and mm all have at least q trailing zero bits, and since
+      // e2 < 0 they are multiplied by at least q fives.
+      vr_is_trailing_zeros = true;
+      if (accept_bounds) {
+        vm_is_trailing_zeros = mm_shift == 1;
+      } else {
+        --vp;
+      }
+    } else if (q < 63) {
+      vr_is_trailing_zeros = MultipleOfPowerOf2(mv, q);
+    }
+  }
+
+  int removed = 0;
+  *significand = RemoveDigits(vr, vp, vm, accept_bounds,
+                              vm_is_trailing_zeros, vr_is_trailing_zeros,
+                              0, &removed);
+  *exponent = e10 + removed;
+}
+
+void ShortestDecimal(float value, uint32* significand, int* exponent) {
+  const int kMantissaBits = 23;
+  const int kBias = 127;
+  // Ryu for floats uses 64-bit multipliers:  the high halves of the double
+  // tables.
+  const int kFloatPow5InvBitCount = kPow5InvBitCount - 64;
+  const int kFloatPow5BitCount = kPow5BitCount - 64;
+
+  uint32 bits = FloatBits(value);
+  uint32 ieee_mantissa = bits & ((1u << kMantissaBits) - 1);
+  int ieee_exponent = static_cast<int>(bits >> kMantissaBits) & 0xff;
+  GOOGLE_DCHECK(ieee_exponent != 0xff && (bits >> 31) == 0 && bits != 0);
+
+  int e2;
+  uint32 m2;
+  if (ieee_exponent == 0) {
+    e2 = 1 - kBias - kMantissaBits - 2;
+    m2 = ieee_mantissa;
+  } else {
+    e2 = ieee_exponent - kBias - kMantissaBits - 2;
+    m2 = (1u << kMantissaBits) | ieee_mantissa;
+  }
+  bool accept_bounds = (m2 & 1) == 0;
+
+  uint32 mv = 4 * m2;
+  uint32 mp = 4 * m2 + 2;
+  int mm_shift = ieee_mantissa != 0 || ieee_exponent <= 1;
+  uint32 mm = 4 * m2 - 1 - mm_shift;
+
+  uint32 vr, vp, vm;
+  int e10;
+  bool vm_is_trailing_zeros = false;
+  bool vr_is_trailing_zeros = false;
+  int last_removed_digit = 0;
+  uint64 high, low;
+  if (e2 >= 0) {
+    int q = Log10Pow2(e2);
+    e10 = q;
+    int k = kFloatPow5InvBitCount + Pow5Bits(q) - 1;
+    int i = -e2 + q + k;
+    Pow5InvSplit(q, &high, &low);
+    vr = MulShift32(mv, high + 1, i);
+    vp = MulShift32(mp, high + 1, i);
+    vm = MulShift32(mm, high + 1, i);
+    if (q != 0 && (vp - 1) / 10 <= vm / 10) {
+      // The loop below won't remove any digits, but rounding needs the
+      // last one that would have been removed.
+      int l = kFloatPow5InvBitCount + Pow5Bits(q - 1) - 1;
+      Pow5InvSplit(q - 1, &high, &low);
+      last_removed_digit = MulShift32(mv, high + 1, -e2 + q - 1 + l) % 10;
+    }
+    if (q <= 9) {
+      if (mv % 5 == 0) {
+        vr_is_trailing_zeros = MultipleOfPowerOf5(mv, q);
+      } else if (accept_bounds) {
+        vm_is_trailing_zeros = MultipleOfPowerOf5(mm, q);
+      } else {
+        vp -= MultipleOfPowerOf5(mp, q);
+      }
+    }
+  } else {
+    int q = Log10Pow5(-e2);
+    e10 = q + e2;
+    int i = -e2 - q;
+    int k = Pow5Bits(i) - kFloatPow5BitCount;
+    int j = q - k;
+    Pow5Split(i, &high, &low);
+    vr = MulShift32(mv, high, j);
+    vp = MulShift32(mp, high, j);
+    vm = MulShift32(mm, high, j);
+    if (q != 0 && (vp - 1) / 10 <= vm / 10) {
+      j = q - 1 - (Pow5Bits(i + 1) - kFloatPow5BitCount);
+      Pow5Split(i + 1, &high, &low);
+      last_removed_digit = MulShift32(mv, high, j) % 10;
+    }
+    if (q <= 1) {
+      vr_is_trailing_zeros = true;
+      if (accept_bounds) {
+        vm_is_trailing_zeros = mm_shift == 1;
+      } else {
+        --vp;
+      }
+    } else if (q < 31) {
+      vr_is_trailing_zeros = MultipleOfPowerOf2(mv, q - 1);
+    }
+  }
+
+  int removed = 0;
+  *significand = RemoveDigits(vr, vp, vm, accept_bounds,
+                              vm_is_trailing_zeros, vr_is_trailing_zeros,
+                              last_removed_digit, &removed);
+  *exponent = e10 + removed;
+}
+
+// -------------------------------------------------------------------
+
+bool FastStrtod(const char* text, double* value, const char** end) {
+  const char* p = text;
+  bool negative = false;
+  if (*p == '-' || *p == '+') {
+    negative = *p == '-';
+    ++p;
+  }
+
+  // The first 19 significant digits, which always fit.
+  const int kMaxDigits = 19;
+  uint64 w = 0;
+  int digits = 0;
+  // What the last digit of w is worth, as a power of ten.
+  int exponent = 0;
+  bool truncated = false;
+  bool any_digits = false;
+
+  for (; IsDigit(*p); ++p) {
+    any_digits = true;
+    if (digits < kMaxDigits) {
+      w = w * 10 + (*p - '0');
+      if (w != 0) ++digits;
+    } else {
+      truncated |= *p != '0';
+      ++exponent;
+    }
+  }
+  if (*p == '.') {
+    ++p;
+    for (; IsDigit(*p); ++p) {
+      any_digits = true;
+      if (digits < kMaxDigits) {
+        w = w * 10 + (*p - '0');
+        if (w != 0) ++digits;
+        --exponent;
+      } else {
+        truncated |= *p != '0';
+      }
+    }
+  }
+  if (!any_digits || *p == 'x' || *p == 'X') return false;
+
+  if (*p == 'e' || *p == 'E') {
+    const char* e = p + 1;
+    bool negative_exponent = false;
+    if (*e == '-' || *e == '+') {
+      negative_exponent = *e == '-';
+      ++e;
+    }
+    if (IsDigit(*e)) {
+      int explicit_exponent = 0;
+      for (; IsDigit(*e); ++e) {
+        // Anything this large is zero or infinity anyway.
+        if (explicit_exponent < 100000) {
+          explicit_exponent = explicit_exponent * 10 + (*e - '0');
+        }
+      }
+      exponent += negative_exponent ? -explicit_exponent : explicit_exponent;
+      p = e;
+    }
+  }
+
+  uint64 bits = DecimalToDoubleBits(w, exponent);
+  if (truncated) {
+    // The true value lies between w and w + 1; if those round the same
+    // way, so does it.  (w + 1 can't overflow:  w < 10^19.)
+    if (DecimalToDoubleBits(w + 1, exponent) != bits) return false;
+  }
+  if (negative) bits |= GOOGLE_ULONGLONG(1) << 63;
+
+  memcpy(value, &bits, sizeof(bits));
+  *end = p;
+  return true;
+}
+
+}  // namespace internal
+}  // namespace protobuf
+}  // namespace google
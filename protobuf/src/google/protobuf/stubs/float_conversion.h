@@ -0,0 +1,79 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// http://code.google.com/p/protobuf/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Conversions between binary floating-point numbers and their shortest
+// decimal representations, used by SimpleDtoa(), SimpleFtoa() and
+// NoLocaleStrtod() in strutil.h, which are what most code should call.
+//
+// ShortestDecimal() implements Ryu ("Ryu: Fast Float-to-String Conversion",
+// Ulf Adams, PLDI 2018), which finds the shortest decimal that reads back as
+// the same number, exactly, using only integer arithmetic.  FastStrtod()
+// implements the Eisel-Lemire algorithm ("Number Parsing at a Gigabyte per
+// Second", Daniel Lemire, 2021), which rounds decimals of up to 19 digits
+// correctly, also with integer arithmetic.  Both use the same table of
+// 128-bit powers of five.
+
+#ifndef GOOGLE_PROTOBUF_STUBS_FLOAT_CONVERSION_H__
+#define GOOGLE_PROTOBUF_STUBS_FLOAT_CONVERSION_H__
+
+#include <google/protobuf/stubs/common.h>
+
+namespace google {
+namespace protobuf {
+namespace internal {
+
+// Finds the shortest decimal, significand * 10^exponent, which is closer to
+// value than to any other double (or float), choosing the closest to value
+// if there are several.  value must be finite and greater than zero.  The
+// significand has no trailing zeros, and at most 17 digits for a double or
+// 9 for a float.
+LIBPROTOBUF_EXPORT void ShortestDecimal(double value,
+                                        uint64* significand, int* exponent);
+LIBPROTOBUF_EXPORT void ShortestDecimal(float value,
+                                        uint32* significand, int* exponent);
+
+// Parses a decimal number at the start of text exactly as strtod() would in
+// the "C" locale, without strtod()'s locale dependence, locking or errno.
+// Only handles text of the form:
+//   [+-]? digits? ('.' digits?)? ([eE] [+-]? digits)?
+// with at least one digit before the exponent.  Returns false for anything
+// else -- leading whitespace, hexadecimal, "inf", "nan" -- or, rarely, if
+// there are more than 19 significant digits and the result depends on the
+// ones beyond those, in which case the caller should use strtod().
+// Otherwise sets *value, and *end to the first character not parsed.
+// Out-of-range values become zero or infinity, as with strtod().
+LIBPROTOBUF_EXPORT bool FastStrtod(const char* text, double* value,
+                                   const char** end);
+
+}  // namespace internal
+}  // namespace protobuf
+
+}  // namespace google
+#endif  // GOOGLE_PROTOBUF_STUBS_FLOAT_CONVERSION_H__
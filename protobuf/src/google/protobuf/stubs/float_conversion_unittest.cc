@@ -0,0 +1,309 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// http://code.google.com/p/protobuf/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <google/protobuf/stubs/float_conversion.h>
+
+#include <float.h>
+#include <limits>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <google/protobuf/stubs/strutil.h>
+
+#include <google/protobuf/testing/googletest.h>
+#include <gtest/gtest.h>
+
+namespace google {
+namespace protobuf {
+namespace internal {
+namespace {
+
+// Deterministic 64-bit generator (xorshift64*), so failures reproduce.
+class Random {
+ public:
+  Random() : state_(GOOGLE_ULONGLONG(0x9e3779b97f4a7c15)) {}
+  uint64 Next() {
+    state_ ^= state_ >> 12;
+    state_ ^= state_ << 25;
+    state_ ^= state_ >> 27;
+    return state_ * GOOGLE_ULONGLONG(2685821657736338717);
+  }
+ private:
+  uint64 state_;
+};
+
+double DoubleFromBits(uint64 bits) {
+  double value;
+  memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+float FloatFromBits(uint32 bits) {
+  float value;
+  memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+float ParseFloat(const char* text) {
+#ifdef _WIN32
+  // MSVC didn't have strtof() until recently.  Going through double can
+  // round twice, but never for the short strings these tests produce.
+  return static_cast<float>(strtod(text, NULL));
+#else
+  return strtof(text, NULL);
+#endif
+}
+
+int DigitCount(uint64 value) {
+  int count = 1;
+  while (value >= 10) {
+    value /= 10;
+    ++count;
+  }
+  return count;
+}
+
+// Checks that ShortestDecimal(value) reads back as value, and that printf()
+// can't do it in fewer digits.
+void ExpectShortestDouble(double value) {
+  uint64 significand;
+  int exponent;
+  ShortestDecimal(value, &significand, &exponent);
+  EXPECT_NE(0, significand % 10) << value;
+
+  char buffer[64];
+  snprintf(buffer, sizeof(buffer), "%llue%d",
+           static_cast<unsigned long long>(significand), exponent);
+  EXPECT_EQ(value, strtod(buffer, NULL)) << buffer;
+
+  int digits = DigitCount(significand);
+  if (digits > 1) {
+    snprintf(buffer, sizeof(buffer), "%.*e", digits - 2, value);
+    EXPECT_NE(value, strtod(buffer, NULL)) << buffer;
+  }
+}
+
+void ExpectShortestFloat(float value) {
+  uint32 significand;
+  int exponent;
+  ShortestDecimal(value, &significand, &exponent);
+  EXPECT_NE(0, significand % 10) << value;
+
+  char buffer[64];
+  snprintf(buffer, sizeof(buffer), "%ue%d", significand, exponent);
+  EXPECT_EQ(value, ParseFloat(buffer)) << buffer;
+
+  int digits = DigitCount(significand);
+  if (digits > 1) {
+    snprintf(buffer, sizeof(buffer), "%.*e", digits - 2, value);
+    EXPECT_NE(value, ParseFloat(buffer)) << buffer;
+  }
+}
+
+TEST(FloatConversionTest, ShortestDecimalKnownValues) {
+  uint64 significand;
+  int exponent;
+
+  ShortestDecimal(1.0, &significand, &exponent);
+  EXPECT_EQ(1, significand);
+  EXPECT_EQ(0, exponent);
+
+  ShortestDecimal(1e23, &significand, &exponent);
+  EXPECT_EQ(1, significand);
+  EXPECT_EQ(23, exponent);
+
+  ShortestDecimal(0.1 + 0.2, &significand, &exponent);
+  EXPECT_EQ(GOOGLE_ULONGLONG(30000000000000004), significand);
+  EXPECT_EQ(-17, exponent);
+
+  ShortestDecimal(numeric_limits<double>::max(), &significand, &exponent);
+  EXPECT_EQ(GOOGLE_ULONGLONG(17976931348623157), significand);
+  EXPECT_EQ(292, exponent);
+
+  ShortestDecimal(numeric_limits<double>::min(), &significand, &exponent);
+  EXPECT_EQ(GOOGLE_ULONGLONG(22250738585072014), significand);
+  EXPECT_EQ(-324, exponent);
+
+  ShortestDecimal(DoubleFromBits(1), &significand, &exponent);
+  EXPECT_EQ(5, significand);
+  EXPECT_EQ(-324, exponent);
+
+  uint32 float_significand;
+  ShortestDecimal(0.3f, &float_significand, &exponent);
+  EXPECT_EQ(3, float_significand);
+  EXPECT_EQ(-1, exponent);
+
+  ShortestDecimal(numeric_limits<float>::max(), &float_significand, &exponent);
+  EXPECT_EQ(34028235, float_significand);
+  EXPECT_EQ(31, exponent);
+
+  ShortestDecimal(FloatFromBits(1), &float_significand, &exponent);
+  EXPECT_EQ(1, float_significand);
+  EXPECT_EQ(-45, exponent);
+}
+
+TEST(FloatConversionTest, ShortestDecimalRandomDoubles) {
+  Random random;
+  for (int i = 0; i < 100000; i++) {
+    double value = DoubleFromBits(random.Next() >> 1);  // positive
+    if (value != value || value == numeric_limits<double>::infinity() ||
+        value == 0) {
+      continue;
+    }
+    ExpectShortestDouble(value);
+  }
+
+  // Integers and small powers of two, which take the shortcuts.
+  for (int i = 1; i < 10000; i++) {
+    ExpectShortestDouble(i);
+    ExpectShortestDouble(i * 1e15);
+    ExpectShortestDouble(i / 1024.0);
+  }
+}
+
+TEST(FloatConversionTest, ShortestDecimalStridedFloats) {
+  // Every 4999th positive float.  The DISABLED_ test below covers all of
+  // them, but takes a while.
+  for (uint32 bits = 1; bits < 0x7f800000; bits += 4999) {
+    ExpectShortestFloat(FloatFromBits(bits));
+  }
+}
+
+TEST(FloatConversionTest, DISABLED_ShortestDecimalAllFloats) {
+  for (uint32 bits = 1; bits < 0x7f800000; bits++) {
+    ExpectShortestFloat(FloatFromBits(bits));
+    if (HasFailure()) break;
+  }
+}
+
+// Parses text with FastStrtod() and checks that it agrees with strtod(),
+// bit for bit.  Returns false if FastStrtod() declined.
+bool ExpectSameAsStrtod(const string& text) {
+  double value;
+  const char* end;
+  if (!FastStrtod(text.c_str(), &value, &end)) return false;
+
+  char* expected_end;
+  double expected = strtod(text.c_str(), &expected_end);
+  uint64 bits, expected_bits;
+  memcpy(&bits, &value, sizeof(bits));
+  memcpy(&expected_bits, &expected, sizeof(expected_bits));
+  EXPECT_EQ(expected_bits, bits) << text;
+  EXPECT_EQ(expected_end - text.c_str(), end - text.c_str()) << text;
+  return true;
+}
+
+TEST(FloatConversionTest, FastStrtodKnownValues) {
+  const char* kValues[] = {
+    "0", "-0", "+1", "1.5", ".5", "5.", "0.1", "1e23", "8.5e-3",
+    "1.7976931348623157e308", "1.7976931348623159e308",  // inf
+    "2.2250738585072011e-308", "2.2250738585072014e-308",
+    "4.9406564584124654e-324", "2.4703282292062327e-324",  // 0
+    "2.4703282292062328e-324", "1e-400", "1e400", "1e100000000000",
+    "9007199254740993", "9007199254740995",  // ties in round-to-even
+    "123456789012345678", "0.000000000000000000000000000012345",
+    "1.5f", "1e", "1e+", "1.5e-x", "12abc",
+  };
+  for (int i = 0; i < GOOGLE_ARRAYSIZE(kValues); i++) {
+    EXPECT_TRUE(ExpectSameAsStrtod(kValues[i])) << kValues[i];
+  }
+
+  // More than 19 digits, but the rest don't matter.
+  EXPECT_TRUE(ExpectSameAsStrtod("1.00000000000000000000000000001"));
+  EXPECT_TRUE(ExpectSameAsStrtod("3.14159265358979323846264338327950288"));
+}
+
+TEST(FloatConversionTest, FastStrtodDeclines) {
+  const char* kValues[] = {
+    "", "-", ".", "e5", " 1", "0x10", "inf", "-nan",
+    // Exactly halfway between 1 and the next double, plus a little more in
+    // the 40th digit, which FastStrtod() doesn't look at.
+    "1.000000000000000111022302462515654042363166809082031250000001",
+  };
+  for (int i = 0; i < GOOGLE_ARRAYSIZE(kValues); i++) {
+    double value;
+    const char* end;
+    EXPECT_FALSE(FastStrtod(kValues[i], &value, &end)) << kValues[i];
+  }
+
+  // NoLocaleStrtod() still gets these right, via strtod().
+  EXPECT_EQ(16, NoLocaleStrtod("0x10", NULL));
+  EXPECT_EQ(1.0000000000000002,
+            NoLocaleStrtod("1.00000000000000011102230246251565404236316680908"
+                           "2031250000001", NULL));
+}
+
+TEST(FloatConversionTest, FastStrtodRandomDecimals) {
+  Random random;
+  int declined = 0;
+  for (int i = 0; i < 100000; i++) {
+    uint64 r = random.Next();
+    string text;
+    if (r & 1) text += '-';
+    int digits = 1 + (r >> 1) % 20;
+    uint64 significand = random.Next();
+    for (int j = 0; j < digits; j++) {
+      text += static_cast<char>('0' + significand % 10);
+      significand /= 10;
+    }
+    int point = (r >> 8) % (digits + 1);
+    text.insert(text.size() - point, ".");
+    text += 'e';
+    text += SimpleItoa(static_cast<int>((r >> 16) % 700) - 350);
+
+    if (!ExpectSameAsStrtod(text)) ++declined;
+    if (HasFailure()) break;
+  }
+  // Declining should be rare.
+  EXPECT_LT(declined, 100);
+}
+
+TEST(FloatConversionTest, FastStrtodRoundTrip) {
+  Random random;
+  char buffer[kDoubleToBufferSize];
+  for (int i = 0; i < 100000; i++) {
+    double value = DoubleFromBits(random.Next());
+    if (value != value || value == numeric_limits<double>::infinity() ||
+        value == -numeric_limits<double>::infinity()) {
+      continue;
+    }
+    DoubleToBuffer(value, buffer);
+    double parsed;
+    const char* end;
+    ASSERT_TRUE(FastStrtod(buffer, &parsed, &end)) << buffer;
+    EXPECT_EQ(value, parsed) << buffer;
+    EXPECT_EQ('\0', *end);
+  }
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace protobuf
+}  // namespace google
@@ -59,12 +59,13 @@ namespace protobuf {
 // Make hash<T> be the same as less<T>.  Note that everywhere where custom
 // hash functions are defined in the protobuf code, they are also defined such
 // that they can be used as "less" functions, which is required by MSVC anyway.
+// The one-argument forms are not used by hash_map here, but FlatHashMap
+// (stubs/flat_hash_map.h) needs them.  The generic one only compiles for
+// integer keys.
 template <typename Key>
 struct hash {
-  // Dummy, just to make derivative hash functions compile.
-  int operator()(const Key& key) {
-    GOOGLE_LOG(FATAL) << "Should never be called.";
-    return 0;
+  inline size_t operator()(const Key& key) const {
+    return static_cast<size_t>(key);
   }
 
   inline bool operator()(const Key& a, const Key& b) const {
@@ -72,13 +73,26 @@ struct hash {
   }
 };
 
+template <typename Key>
+struct hash<const Key*> {
+  inline size_t operator()(const Key* key) const {
+    return reinterpret_cast<size_t>(key);
+  }
+
+  inline bool operator()(const Key* a, const Key* b) const {
+    return a < b;
+  }
+};
+
 // Make sure char* is compared by value.
 template <>
 struct hash<const char*> {
-  // Dummy, just to make derivative hash functions compile.
-  int operator()(const char* key) {
-    GOOGLE_LOG(FATAL) << "Should never be called.";
-    return 0;
+  inline size_t operator()(const char* str) const {
+    size_t result = 0;
+    for (; *str != '\0'; str++) {
+      result = 5 * result + *str;
+    }
+    return result;
   }
 
   inline bool operator()(const char* a, const char* b) const {
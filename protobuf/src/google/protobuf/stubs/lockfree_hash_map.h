@@ -0,0 +1,166 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// http://code.google.com/p/protobuf/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// This header is intended to be included only by internal .cc files.
+//
+// LockFreeHashMap is an insert-only hash map which may be searched without
+// any locking while another thread inserts into it.  It suits registries
+// which are filled lazily and then read constantly from many threads, like
+// the descriptor pools and the generated message factory.
+//
+// Inserts must be serialized by the caller, typically with a Mutex which
+// the caller also uses to decide whether an insert is needed.  Entries can
+// never be modified or removed, so a reader which finds an entry may use it
+// without further synchronization.  When the table gets half full, a copy
+// twice its size is published in its place.  Old tables are kept until the
+// map is destroyed, since readers may still be probing them; together they
+// never take more space than the current table.
+
+#ifndef GOOGLE_PROTOBUF_STUBS_LOCKFREE_HASH_MAP_H__
+#define GOOGLE_PROTOBUF_STUBS_LOCKFREE_HASH_MAP_H__
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/stubs/atomicops.h>
+#include <google/protobuf/stubs/hash.h>
+
+namespace google {
+namespace protobuf {
+namespace internal {
+
+template <typename Key, typename Value,
+          typename HashFcn = hash<Key>,
+          typename EqualKey = std::equal_to<Key> >
+class LockFreeHashMap {
+ public:
+  LockFreeHashMap() : table_(NULL), size_(0) {}
+
+  ~LockFreeHashMap() {
+    for (int i = 0; i < entries_.size(); i++) {
+      delete entries_[i];
+    }
+    for (int i = 0; i < tables_.size(); i++) {
+      delete [] tables_[i]->slots;
+      delete tables_[i];
+    }
+  }
+
+  // Returns the value inserted under key, or Value() if there is none.  May
+  // be called concurrently with Insert().
+  Value Find(const Key& key) const {
+    const Table* table = Acquire_Load(&table_);
+    if (table == NULL) return Value();
+
+    EqualKey equal;
+    for (int i = HomeSlot(*table, key); ; i = (i + 1) & table->mask) {
+      const Entry* entry = Acquire_Load(&table->slots[i]);
+      if (entry == NULL) return Value();
+      if (equal(entry->key, key)) return entry->value;
+    }
+  }
+
+  // Adds a key which is not yet in the map.  Calls must be serialized.
+  void Insert(const Key& key, const Value& value) {
+    if (table_ == NULL || (size_ + 1) * 2 > table_->mask + 1) Grow();
+
+    Entry* entry = new Entry(key, value);
+    entries_.push_back(entry);
+    ++size_;
+
+    // The entry must be fully written before readers can reach it.
+    Table* table = tables_.back();
+    Release_Store(&table->slots[FindEmptySlot(*table, key)],
+                  static_cast<const Entry*>(entry));
+  }
+
+  // The number of entries inserted.  Only meaningful to the inserting thread.
+  int size() const { return size_; }
+
+ private:
+  struct Entry {
+    Entry(const Key& k, const Value& v) : key(k), value(v) {}
+    const Key key;
+    const Value value;
+  };
+
+  struct Table {
+    int mask;             // The number of slots, a power of two, minus one.
+    int shift;            // 64 minus the base-2 log of the number of slots.
+    const Entry** slots;  // NULL where empty.
+  };
+
+  // The slot where a search for key starts.  The hash functions in
+  // stubs/hash.h return pointers nearly unchanged, and since allocations are
+  // aligned their low bits are all zero.  So, like FlatHashMap, this
+  // multiplies the hash by 2^64 divided by the golden ratio and takes the
+  // slot from the top bits of the product, which depend on all of the key.
+  static int HomeSlot(const Table& table, const Key& key) {
+    return static_cast<int>(
+        (static_cast<uint64>(HashFcn()(key)) *
+         GOOGLE_ULONGLONG(0x9e3779b97f4a7c15)) >> table.shift);
+  }
+
+  static int FindEmptySlot(const Table& table, const Key& key) {
+    int i = HomeSlot(table, key);
+    while (table.slots[i] != NULL) i = (i + 1) & table.mask;
+    return i;
+  }
+
+  // Publishes a copy of the current table with twice as many slots.
+  void Grow() {
+    Table* table = new Table;
+    table->mask = (table_ == NULL) ? 15 : table_->mask * 2 + 1;
+    table->shift = (table_ == NULL) ? 60 : table_->shift - 1;
+    table->slots = new const Entry*[table->mask + 1];
+    std::fill(table->slots, table->slots + table->mask + 1,
+              static_cast<const Entry*>(NULL));
+    for (int i = 0; i < entries_.size(); i++) {
+      table->slots[FindEmptySlot(*table, entries_[i]->key)] = entries_[i];
+    }
+
+    tables_.push_back(table);
+    Release_Store(&table_, static_cast<const Table*>(table));
+  }
+
+  const Table* table_;          // The table readers search.
+  int size_;
+  std::vector<Table*> tables_;  // All tables, the current one last.
+  std::vector<Entry*> entries_;
+
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(LockFreeHashMap);
+};
+
+}  // namespace internal
+}  // namespace protobuf
+
+}  // namespace google
+#endif  // GOOGLE_PROTOBUF_STUBS_LOCKFREE_HASH_MAP_H__
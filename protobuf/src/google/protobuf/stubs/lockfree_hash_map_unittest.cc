@@ -0,0 +1,155 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// http://code.google.com/p/protobuf/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <google/protobuf/stubs/lockfree_hash_map.h>
+
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/stubs/strutil.h>
+#include <google/protobuf/testing/googletest.h>
+#include <gtest/gtest.h>
+
+#include "config.h"
+
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#endif
+
+namespace google {
+namespace protobuf {
+namespace internal {
+namespace {
+
+TEST(LockFreeHashMapTest, Empty) {
+  LockFreeHashMap<int, const char*> map;
+  EXPECT_EQ(0, map.size());
+  EXPECT_TRUE(map.Find(1) == NULL);
+}
+
+TEST(LockFreeHashMapTest, InsertAndFind) {
+  LockFreeHashMap<int, int> map;
+  // Enough entries to grow the table several times.
+  for (int i = 1; i <= 1000; i++) {
+    map.Insert(i * 7, i);
+    EXPECT_EQ(i, map.Find(i * 7));
+  }
+  EXPECT_EQ(1000, map.size());
+
+  for (int i = 1; i <= 1000; i++) {
+    EXPECT_EQ(i, map.Find(i * 7));
+    EXPECT_EQ(0, map.Find(i * 7 + 1));
+  }
+}
+
+// Pointers into an array of these all have their low six bits clear, like
+// pointers to separately allocated descriptors.
+struct Aligned { char padding[64]; };
+
+TEST(LockFreeHashMapTest, AlignedPointerKeys) {
+  vector<Aligned> objects(1000);
+
+  LockFreeHashMap<const Aligned*, int> map;
+  for (int i = 0; i < objects.size(); i++) {
+    map.Insert(&objects[i], i + 1);
+  }
+  for (int i = 0; i < objects.size(); i++) {
+    EXPECT_EQ(i + 1, map.Find(&objects[i]));
+  }
+  Aligned other;
+  EXPECT_EQ(0, map.Find(&other));
+}
+
+TEST(LockFreeHashMapTest, StringKeys) {
+  vector<string> names;
+  for (int i = 0; i < 100; i++) {
+    names.push_back("name" + SimpleItoa(i));
+  }
+
+  LockFreeHashMap<const char*, int, hash<const char*>, streq> map;
+  for (int i = 0; i < names.size(); i++) {
+    map.Insert(names[i].c_str(), i + 1);
+  }
+
+  // Keys are compared by value, not by pointer.
+  for (int i = 0; i < names.size(); i++) {
+    string copy = names[i];
+    EXPECT_EQ(i + 1, map.Find(copy.c_str()));
+  }
+  EXPECT_EQ(0, map.Find("name100"));
+}
+
+#ifdef HAVE_PTHREAD
+
+const int kConcurrentEntries = 20000;
+
+struct ConcurrentTestState {
+  LockFreeHashMap<int, int> map;
+  bool all_consistent;
+};
+
+void* FindWhileInserting(void* arg) {
+  ConcurrentTestState* state = reinterpret_cast<ConcurrentTestState*>(arg);
+  int checked = 0;
+  while (checked < kConcurrentEntries) {
+    // Entries are inserted in order, so once entry n can be found, so can
+    // every entry before it.
+    int n = checked;
+    while (n < kConcurrentEntries && state->map.Find(n + 1) != 0) ++n;
+    for (int i = checked + 1; i <= n; i++) {
+      if (state->map.Find(i) != -i) state->all_consistent = false;
+    }
+    checked = n;
+  }
+  return NULL;
+}
+
+TEST(LockFreeHashMapTest, FindWhileInserting) {
+  ConcurrentTestState state;
+  state.all_consistent = true;
+
+  pthread_t reader;
+  ASSERT_EQ(0, pthread_create(&reader, NULL, &FindWhileInserting, &state));
+  for (int i = 1; i <= kConcurrentEntries; i++) {
+    state.map.Insert(i, -i);
+  }
+  pthread_join(reader, NULL);
+
+  EXPECT_TRUE(state.all_consistent);
+}
+
+#endif  // HAVE_PTHREAD
+
+}  // namespace
+}  // namespace internal
+}  // namespace protobuf
+}  // namespace google
@@ -1,7 +1,20 @@
 // Copyright 2005-2008 Google Inc. All Rights Reserved.
 // Author: jrm@google.com (Jim Meehan)
 
-#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/stubs/structurally_valid.h>
+
+#include <string.h>
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#endif
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || \
+    defined(_M_IX86)
+#include <immintrin.h>
+#endif
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
 
 namespace google {
 namespace protobuf {
@@ -503,32 +516,362 @@ int UTF8GenericScanFastAscii(const UTF8ScanObj* st,
   return exit_reason;
 }
 
+namespace {
+
+bool IsStructurallyValidUTF8Table(const char* buf, int len) {
+  int bytes_consumed = 0;
+  UTF8GenericScanFastAscii(&utf8acceptnonsurrogates_obj,
+                           buf, len, &bytes_consumed);
+  return (bytes_consumed == len);
+}
+
+// ===================================================================
+// Character at a time
+
+// Returns the length of the character starting at p, which is not ASCII, or
+// zero if it is malformed or runs past end.  This accepts the same characters
+// as utf8acceptnonsurrogates_obj:  the second byte is limited to exclude
+// overlong forms (after 0xE0 and 0xF0), surrogates (after 0xED) and code
+// points past U+10FFFF (after 0xF4).
+inline int MultiByteCharLength(const uint8* p, const uint8* end) {
+  uint8 lead = p[0];
+  if (lead < 0xC2) {
+    return 0;  // A continuation byte, or an overlong two-byte form.
+  } else if (lead < 0xE0) {
+    return (end - p >= 2 && (p[1] & 0xC0) == 0x80) ? 2 : 0;
+  } else if (lead < 0xF0) {
+    if (end - p < 3) return 0;
+    uint8 min = lead == 0xE0 ? 0xA0 : 0x80;
+    uint8 max = lead == 0xED ? 0x9F : 0xBF;
+    return (p[1] >= min && p[1] <= max && (p[2] & 0xC0) == 0x80) ? 3 : 0;
+  } else if (lead < 0xF5) {
+    if (end - p < 4) return 0;
+    uint8 min = lead == 0xF0 ? 0x90 : 0x80;
+    uint8 max = lead == 0xF4 ? 0x8F : 0xBF;
+    return (p[1] >= min && p[1] <= max &&
+            (p[2] & 0xC0) == 0x80 && (p[3] & 0xC0) == 0x80) ? 4 : 0;
+  } else {
+    return 0;
+  }
+}
+
+// Checks the characters from p up to limit, or to the end of the one which
+// straddles it.  Returns where it stopped, or NULL if a character was
+// malformed.
+inline const uint8* CheckCharacters(const uint8* p, const uint8* limit,
+                                    const uint8* end) {
+  while (p < limit) {
+    if (*p < 0x80) {
+      ++p;
+    } else {
+      int length = MultiByteCharLength(p, end);
+      if (length == 0) return NULL;
+      p += length;
+    }
+  }
+  return p;
+}
+
+// ===================================================================
+// SSE2
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define GOOGLE_PROTOBUF_UTF8_SSE2
+
+bool IsStructurallyValidUTF8SSE2(const char* buf, int len) {
+  const uint8* p = reinterpret_cast<const uint8*>(buf);
+  const uint8* end = p + len;
+  while (p < end) {
+    while (end - p >= 16 &&
+           _mm_movemask_epi8(
+               _mm_loadu_si128(reinterpret_cast<const __m128i*>(p))) == 0) {
+      p += 16;
+    }
+    // Check the rest of the block one character at a time.  Text which is
+    // not ASCII rarely has long runs of ASCII in it, so a character which
+    // ends past the block does not send us back to the loop above.
+    p = CheckCharacters(p, end - p > 16 ? p + 16 : end, end);
+    if (p == NULL) return false;
+  }
+  return true;
+}
+
+#endif  // SSE2
+
+// ===================================================================
+// AVX2
+
+#if defined(__x86_64__) || defined(__i386__)
+#if defined(__clang__) && defined(__has_attribute)
+#if __has_attribute(target)
+#define GOOGLE_PROTOBUF_UTF8_AVX2
+#endif
+#elif defined(__GNUC__) && !defined(__clang__) && \
+    (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))
+#define GOOGLE_PROTOBUF_UTF8_AVX2
+#endif
+#ifdef GOOGLE_PROTOBUF_UTF8_AVX2
+// Lets these functions use AVX2 without building the whole file for it.
+#define GOOGLE_PROTOBUF_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#elif defined(_MSC_VER) && _MSC_VER >= 1800 && \
+    (defined(_M_X64) || defined(_M_IX86))
+#define GOOGLE_PROTOBUF_UTF8_AVX2
+#define GOOGLE_PROTOBUF_TARGET_AVX2
+#endif
+
+#ifdef GOOGLE_PROTOBUF_UTF8_AVX2
+
+bool ProcessorHasAVX2() {
+#if defined(_MSC_VER)
+  int info[4];
+  __cpuid(info, 0);
+  if (info[0] < 7) return false;
+  __cpuid(info, 1);
+  // The processor must have AVX and the OS must save the YMM registers.
+  const int kOSXSAVE = 1 << 27, kAVX = 1 << 28;
+  if ((info[2] & (kOSXSAVE | kAVX)) != (kOSXSAVE | kAVX)) return false;
+  if ((_xgetbv(0) & 6) != 6) return false;
+  __cpuidex(info, 7, 0);
+  return (info[1] & (1 << 5)) != 0;
+#else
+  // This checks that the OS saves the YMM registers, too.
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx2");
+#endif
+}
+
+// The bits of the lookup tables.  Each names an error which a pair of
+// consecutive bytes may show; the pair is in error if its first byte's high
+// nibble, its first byte's low nibble and its second byte's high nibble all
+// map to a set containing the bit.
+const uint8 kTooShort = 1 << 0;    // 11______ 0_______, 11______ 11______
+const uint8 kTooLong = 1 << 1;     // 0_______ 10______
+const uint8 kOverlong3 = 1 << 2;   // 11100000 100_____
+const uint8 kTooLarge = 1 << 3;    // 11110100 1001____, 11110100 101_____,
+                                   // 11110101+ 1001____, 11110101+ 101_____
+const uint8 kSurrogate = 1 << 4;   // 11101101 101_____
+const uint8 kOverlong2 = 1 << 5;   // 1100000_ 10______
+const uint8 kTooLarge1000 = 1 << 6;  // 11110101+ 1000____
+const uint8 kOverlong4 = 1 << 6;   // 11110000 1000____
+const uint8 kTwoConts = 1 << 7;    // 10______ 10______
+// Errors which any low nibble in the first byte allows.
+const uint8 kCarry = kTooShort | kTooLong | kTwoConts;
+
+const uint8 kByte1High[16] = {
+  // 0_______:  ASCII.
+  kTooLong, kTooLong, kTooLong, kTooLong,
+  kTooLong, kTooLong, kTooLong, kTooLong,
+  // 10______:  a continuation byte.
+  kTwoConts, kTwoConts, kTwoConts, kTwoConts,
+  // 1100____, 1101____:  the lead of a two-byte character.
+  kTooShort | kOverlong2,
+  kTooShort,
+  // 1110____:  the lead of a three-byte character.
+  kTooShort | kOverlong3 | kSurrogate,
+  // 1111____:  the lead of a four-byte character, or worse.
+  kTooShort | kTooLarge | kTooLarge1000 | kOverlong4
+};
+
+const uint8 kByte1Low[16] = {
+  // ____0000, ____0001
+  kCarry | kOverlong3 | kOverlong2 | kOverlong4,
+  kCarry | kOverlong2,
+  // ____001_
+  kCarry,
+  kCarry,
+  // ____0100, ____0101, ____011_
+  kCarry | kTooLarge,
+  kCarry | kTooLarge | kTooLarge1000,
+  kCarry | kTooLarge | kTooLarge1000,
+  kCarry | kTooLarge | kTooLarge1000,
+  // ____1___, with ____1101 the surrogates' 0xED
+  kCarry | kTooLarge | kTooLarge1000,
+  kCarry | kTooLarge | kTooLarge1000,
+  kCarry | kTooLarge | kTooLarge1000,
+  kCarry | kTooLarge | kTooLarge1000,
+  kCarry | kTooLarge | kTooLarge1000,
+  kCarry | kTooLarge | kTooLarge1000 | kSurrogate,
+  kCarry | kTooLarge | kTooLarge1000,
+  kCarry | kTooLarge | kTooLarge1000
+};
+
+const uint8 kByte2High[16] = {
+  // 0_______:  ASCII.
+  kTooShort, kTooShort, kTooShort, kTooShort,
+  kTooShort, kTooShort, kTooShort, kTooShort,
+  // 1000____, 1001____, 101_____:  a continuation byte.
+  kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge1000 | kOverlong4,
+  kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge,
+  kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+  kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+  // 11______:  a lead byte.
+  kTooShort, kTooShort, kTooShort, kTooShort
+};
+
+// The largest value each byte of the last block may have if no character
+// is left unfinished:  the last three bytes may not start characters which
+// are longer than what fits.
+const uint8 kMaxLastBytes[32] = {
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 0xF0 - 1, 0xE0 - 1, 0xC0 - 1
+};
+
+// Loads a 16-entry table into both lanes, for _mm256_shuffle_epi8().
+GOOGLE_PROTOBUF_TARGET_AVX2
+inline __m256i LoadTable(const uint8* table) {
+  __m128i lane = _mm_loadu_si128(reinterpret_cast<const __m128i*>(table));
+  return _mm256_inserti128_si256(_mm256_castsi128_si256(lane), lane, 1);
+}
+
+// Returns input shifted N bytes later, with the last N bytes of previous
+// shifted in.
+template <int N>
+GOOGLE_PROTOBUF_TARGET_AVX2
+inline __m256i Previous(__m256i input, __m256i previous) {
+  return _mm256_alignr_epi8(
+      input, _mm256_permute2x128_si256(previous, input, 0x21), 16 - N);
+}
+
+// The state carried from one block to the next.
+struct AVX2State {
+  __m256i byte_1_high;
+  __m256i byte_1_low;
+  __m256i byte_2_high;
+  __m256i max_last_bytes;
+  __m256i previous;    // The previous block.
+  __m256i incomplete;  // Non-zero if it ended in an unfinished character.
+  __m256i error;       // Non-zero once anything was wrong.
+};
+
+GOOGLE_PROTOBUF_TARGET_AVX2
+inline void CheckBlock(__m256i input, AVX2State* state) {
+  if (_mm256_movemask_epi8(input) == 0) {
+    // ASCII is always valid, unless it follows an unfinished character.
+    state->error = _mm256_or_si256(state->error, state->incomplete);
+    state->previous = input;
+    state->incomplete = _mm256_setzero_si256();
+    return;
+  }
+
+  const __m256i low_nibble = _mm256_set1_epi8(0x0F);
+  __m256i previous1 = Previous<1>(input, state->previous);
+  __m256i special_cases = _mm256_and_si256(
+      _mm256_and_si256(
+          _mm256_shuffle_epi8(
+              state->byte_1_high,
+              _mm256_and_si256(_mm256_srli_epi16(previous1, 4), low_nibble)),
+          _mm256_shuffle_epi8(
+              state->byte_1_low, _mm256_and_si256(previous1, low_nibble))),
+      _mm256_shuffle_epi8(
+          state->byte_2_high,
+          _mm256_and_si256(_mm256_srli_epi16(input, 4), low_nibble)));
+
+  // The only pairs of continuation bytes which are allowed are those that
+  // come two or three bytes after a lead byte which asks for them.  Those
+  // have the top bit set here, and it cancels kTwoConts.
+  __m256i third_byte = _mm256_subs_epu8(
+      Previous<2>(input, state->previous), _mm256_set1_epi8(0xE0 - 0x80));
+  __m256i fourth_byte = _mm256_subs_epu8(
+      Previous<3>(input, state->previous), _mm256_set1_epi8(0xF0 - 0x80));
+  __m256i must_be_continuation = _mm256_and_si256(
+      _mm256_or_si256(third_byte, fourth_byte),
+      _mm256_set1_epi8(static_cast<char>(0x80)));
+
+  state->error = _mm256_or_si256(
+      state->error, _mm256_xor_si256(must_be_continuation, special_cases));
+  state->previous = input;
+  state->incomplete = _mm256_subs_epu8(input, state->max_last_bytes);
+}
+
+GOOGLE_PROTOBUF_TARGET_AVX2
+bool IsStructurallyValidUTF8AVX2(const char* buf, int len) {
+  const uint8* p = reinterpret_cast<const uint8*>(buf);
+  const uint8* end = p + len;
+  if (len < 32) {
+    // Loading the tables and padding a block costs more than checking a
+    // short string one character at a time, after skipping sixteen bytes of
+    // ASCII if there are.
+    if (len >= 16 && _mm_movemask_epi8(_mm_loadu_si128(
+                         reinterpret_cast<const __m128i*>(p))) == 0) {
+      p += 16;
+    }
+    return CheckCharacters(p, end, end) != NULL;
+  }
+
+  AVX2State state;
+  state.byte_1_high = LoadTable(kByte1High);
+  state.byte_1_low = LoadTable(kByte1Low);
+  state.byte_2_high = LoadTable(kByte2High);
+  state.max_last_bytes = _mm256_loadu_si256(
+      reinterpret_cast<const __m256i*>(kMaxLastBytes));
+  state.previous = _mm256_setzero_si256();
+  state.incomplete = _mm256_setzero_si256();
+  state.error = _mm256_setzero_si256();
+
+  for (; end - p >= 32; p += 32) {
+    CheckBlock(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)),
+               &state);
+  }
+  if (p < end) {
+    // Pad the rest with ASCII, which also catches a last character that is
+    // unfinished.
+    uint8 last_block[32] = { 0 };
+    memcpy(last_block, p, end - p);
+    CheckBlock(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(last_block)),
+               &state);
+  }
+  state.error = _mm256_or_si256(state.error, state.incomplete);
+  return _mm256_testz_si256(state.error, state.error) != 0;
+}
+
+#endif  // AVX2
+
+// ===================================================================
+
 // Hack:  On some compilers the static tables are initialized at startup.
 //   We can't use them until they are initialized.  However, some Protocol
 //   Buffer parsing happens at static init time and may try to validate
 //   UTF-8 strings.  Since UTF-8 validation is only used for debugging
 //   anyway, we simply always return success if initialization hasn't
-//   occurred yet.
-namespace {
-
-bool module_initialized_ = false;
+//   occurred yet.  The initializer also picks the validator, so that
+//   IsStructurallyValidUTF8() needs nothing more than a NULL check.
+UTF8ValidatorFunction* validator_ = NULL;
 
 struct InitDetector {
   InitDetector() {
-    module_initialized_ = true;
+    for (int i = UTF8_VALIDATOR_TYPE_COUNT - 1; validator_ == NULL; i--) {
+      validator_ = GetUTF8Validator(static_cast<UTF8ValidatorType>(i));
+    }
   }
 };
 InitDetector init_detector;
 
 }  // namespace
 
+UTF8ValidatorFunction* GetUTF8Validator(UTF8ValidatorType type) {
+  switch (type) {
+    case UTF8_VALIDATOR_TABLE:
+      return &IsStructurallyValidUTF8Table;
+#ifdef GOOGLE_PROTOBUF_UTF8_SSE2
+    case UTF8_VALIDATOR_SSE2:
+      return &IsStructurallyValidUTF8SSE2;
+#endif
+#ifdef GOOGLE_PROTOBUF_UTF8_AVX2
+    case UTF8_VALIDATOR_AVX2:
+      return ProcessorHasAVX2() ? &IsStructurallyValidUTF8AVX2 : NULL;
+#endif
+    default:
+      return NULL;
+  }
+}
+
 bool IsStructurallyValidUTF8(const char* buf, int len) {
-  if (!module_initialized_) return true;
-  
-  int bytes_consumed = 0;
-  UTF8GenericScanFastAscii(&utf8acceptnonsurrogates_obj,
-                           buf, len, &bytes_consumed);
-  return (bytes_consumed == len);
+  if (validator_ == NULL) return true;
+  return validator_(buf, len);
 }
 
 }  // namespace internal
@@ -0,0 +1,79 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// http://code.google.com/p/protobuf/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// The implementations behind IsStructurallyValidUTF8() in common.h, which
+// is what everything else should call.  It uses the fastest one that was
+// compiled in and that the processor supports; the others are exposed so
+// that tests and benchmarks can compare them.
+//
+// All of them accept exactly the UTF-8 of RFC 3629:  no overlong forms, no
+// surrogates (U+D800 through U+DFFF) and nothing beyond U+10FFFF.
+
+#ifndef GOOGLE_PROTOBUF_STUBS_STRUCTURALLY_VALID_H__
+#define GOOGLE_PROTOBUF_STUBS_STRUCTURALLY_VALID_H__
+
+#include <google/protobuf/stubs/common.h>
+
+namespace google {
+namespace protobuf {
+namespace internal {
+
+enum UTF8ValidatorType {
+  // Runs a state machine over the bytes, skipping runs of ASCII eight bytes
+  // at a time.  Works everywhere.
+  UTF8_VALIDATOR_TABLE,
+
+  // Skips ASCII sixteen bytes at a time with SSE2, and checks the other
+  // characters one at a time.  Compiled in where SSE2 is always available,
+  // i.e. x86-64 and x86 builds which target it.
+  UTF8_VALIDATOR_SSE2,
+
+  // Checks 32 bytes at a time with AVX2, whatever they contain, using the
+  // lookup algorithm from "Validating UTF-8 In Less Than One Instruction
+  // Per Byte" (John Keiser and Daniel Lemire, 2021).  Compiled in on x86
+  // with GCC 4.9 or later, clang or MSVC 2013 or later, and used if the
+  // processor and operating system support AVX2.
+  UTF8_VALIDATOR_AVX2,
+
+  UTF8_VALIDATOR_TYPE_COUNT
+};
+
+typedef bool UTF8ValidatorFunction(const char* buf, int len);
+
+// Returns the validator of the given type, or NULL if it was not compiled in
+// or the processor cannot run it.
+LIBPROTOBUF_EXPORT UTF8ValidatorFunction* GetUTF8Validator(
+    UTF8ValidatorType type);
+
+}  // namespace internal
+}  // namespace protobuf
+
+}  // namespace google
+#endif  // GOOGLE_PROTOBUF_STUBS_STRUCTURALLY_VALID_H__
@@ -1,6 +1,7 @@
 // Copyright 2008 Google Inc. All Rights Reserved.
 // Author: xpeng@google.com (Peter Peng)
 
+#include <google/protobuf/stubs/structurally_valid.h>
 #include <google/protobuf/stubs/common.h>
 #include <gtest/gtest.h>
 
@@ -34,6 +35,129 @@ TEST(StructurallyValidTest, InvalidUTF8String) {
   }
 }
 
+// Decodes buf one code point at a time, following RFC 3629 to the letter.
+bool IsValidByDecoding(const string& buf) {
+  for (int i = 0; i < buf.size(); ) {
+    uint8 lead = buf[i];
+    int length;
+    uint32 code_point;
+    if (lead < 0x80) {
+      length = 1, code_point = lead;
+    } else if (lead >= 0xC0 && lead < 0xE0) {
+      length = 2, code_point = lead & 0x1F;
+    } else if (lead >= 0xE0 && lead < 0xF0) {
+      length = 3, code_point = lead & 0x0F;
+    } else if (lead >= 0xF0 && lead < 0xF8) {
+      length = 4, code_point = lead & 0x07;
+    } else {
+      return false;
+    }
+    if (i + length > buf.size()) return false;
+    for (int j = 1; j < length; j++) {
+      uint8 byte = buf[i + j];
+      if ((byte & 0xC0) != 0x80) return false;
+      code_point = (code_point << 6) | (byte & 0x3F);
+    }
+    static const uint32 kMinCodePoint[] = { 0, 0, 0x80, 0x800, 0x10000 };
+    if (code_point < kMinCodePoint[length]) return false;  // Overlong.
+    if (code_point >= 0xD800 && code_point <= 0xDFFF) return false;
+    if (code_point > 0x10FFFF) return false;
+    i += length;
+  }
+  return true;
+}
+
+// Bytes from each range which the validators treat differently.
+const uint8 kInterestingBytes[] = {
+  0x00, 0x41, 0x7F, 0x80, 0x8F, 0x90, 0x9F, 0xA0, 0xBF, 0xC0, 0xC1, 0xC2,
+  0xDF, 0xE0, 0xE1, 0xEC, 0xED, 0xEE, 0xEF, 0xF0, 0xF1, 0xF3, 0xF4, 0xF5,
+  0xF7, 0xF8, 0xFF
+};
+const int kInterestingByteCount = GOOGLE_ARRAYSIZE(kInterestingBytes);
+
+TEST(StructurallyValidTest, ValidatorsAcceptExactlyRFC3629) {
+  // Every sequence of up to four interesting bytes, alone and at the end
+  // of a block full of CJK, where vectorized validators must carry what
+  // they know into the next block.
+  const string kPrefix =
+      "\344\270\255\346\226\207\344\270\255\346\226\207"
+      "\344\270\255\346\226\207\344\270\255\346\226\207"
+      "\344\270\255\346\226\207ab";
+  for (int type = 0; type < UTF8_VALIDATOR_TYPE_COUNT; type++) {
+    UTF8ValidatorFunction* validator =
+      GetUTF8Validator(static_cast<UTF8ValidatorType>(type));
+    if (validator == NULL) continue;
+    SCOPED_TRACE(type);
+
+    for (int length = 1; length <= 4; length++) {
+      int total = 1;
+      for (int i = 0; i < length; i++) total *= kInterestingByteCount;
+      for (int n = 0; n < total; n++) {
+        string buf;
+        for (int i = 0, rest = n; i < length; i++) {
+          buf.push_back(kInterestingBytes[rest % kInterestingByteCount]);
+          rest /= kInterestingByteCount;
+        }
+        bool expected = IsValidByDecoding(buf);
+        string long_buf = kPrefix + buf;
+        EXPECT_EQ(expected, validator(buf.data(), buf.size()));
+        EXPECT_EQ(expected, validator(long_buf.data(), long_buf.size()));
+      }
+    }
+  }
+}
+
+TEST(StructurallyValidTest, ValidatorsFindErrorsAnywhere) {
+  // Put each sequence at every offset in a buffer long enough for several
+  // blocks, surrounded by ASCII or by three-byte characters.
+  const char* kValid[] = {
+    "\302\200", "\337\277", "\340\240\200", "\355\237\277", "\356\200\200",
+    "\357\277\277", "\360\220\200\200", "\364\217\277\277"
+  };
+  const char* kInvalid[] = {
+    "\200", "\277", "\300\200", "\301\277", "\302", "\340\237\277",
+    "\355\240\200", "\355\277\277", "\360\217\277\277", "\364\220\200\200",
+    "\365\200\200\200", "\370\210\200\200\200", "\377", "\342\202",
+    "\360\220\200"
+  };
+  for (int type = 0; type < UTF8_VALIDATOR_TYPE_COUNT; type++) {
+    UTF8ValidatorFunction* validator =
+      GetUTF8Validator(static_cast<UTF8ValidatorType>(type));
+    if (validator == NULL) continue;
+    SCOPED_TRACE(type);
+
+    for (int cjk = 0; cjk < 2; cjk++) {
+      const string filler = cjk ? "\344\270\255" : "a";
+      for (int offset = 0; offset < 100; offset++) {
+        string before, after;
+        while (before.size() + filler.size() <= offset) before += filler;
+        while (before.size() < offset) before += "b";
+        while (after.size() < 100 - offset) after += filler;
+
+        for (int i = 0; i < GOOGLE_ARRAYSIZE(kValid); i++) {
+          string buf = before + kValid[i] + after;
+          EXPECT_TRUE(validator(buf.data(), buf.size()))
+            << "offset " << offset << ", valid " << i;
+          // Cut off in the middle of its last character, the buffer is not
+          // valid.
+          buf = before + kValid[i];
+          EXPECT_FALSE(validator(buf.data(), buf.size() - 1))
+            << "offset " << offset << ", truncated " << i;
+        }
+        for (int i = 0; i < GOOGLE_ARRAYSIZE(kInvalid); i++) {
+          string buf = before + kInvalid[i] + after;
+          EXPECT_FALSE(validator(buf.data(), buf.size()))
+            << "offset " << offset << ", invalid " << i;
+        }
+      }
+    }
+  }
+}
+
+TEST(StructurallyValidTest, TableValidatorIsAlwaysAvailable) {
+  EXPECT_TRUE(GetUTF8Validator(UTF8_VALIDATOR_TABLE) != NULL);
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace protobuf
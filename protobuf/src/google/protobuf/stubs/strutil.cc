@@ -31,6 +31,7 @@
 // from google3/strings/strutil.cc
 
 #include <google/protobuf/stubs/strutil.h>
+#include <google/protobuf/stubs/float_conversion.h>
 #include <errno.h>
 #include <float.h>    // FLT_DIG and DBL_DIG
 #include <limits>
@@ -452,10 +453,19 @@ int CEscapeInternal(const char* src, int src_len, char* dest,
              (last_hex_escape && isxdigit(*src)))) {
           if (dest_len - used < 4) // need space for 4 letter escape
             return -1;
-          sprintf(dest + used, (use_hex ? "\\x%02x" : "\\%03o"),
-                  static_cast<uint8>(*src));
+          static const char kHexDigits[] = "0123456789abcdef";
+          uint8 c = static_cast<uint8>(*src);
+          dest[used++] = '\\';
+          if (use_hex) {
+            dest[used++] = 'x';
+            dest[used++] = kHexDigits[c >> 4];
+            dest[used++] = kHexDigits[c & 0xf];
+          } else {
+            dest[used++] = '0' + (c >> 6);
+            dest[used++] = '0' + ((c >> 3) & 7);
+            dest[used++] = '0' + (c & 7);
+          }
           is_hex_escape = use_hex;
-          used += 4;
         } else {
           dest[used++] = *src; break;
         }
@@ -504,6 +514,11 @@ string Utf8SafeCEscape(const string& src) {
   return string(dest.get(), len);
 }
 
+int Utf8SafeCEscapeString(const char* src, int src_len,
+                          char* dest, int dest_len) {
+  return CEscapeInternal(src, src_len, dest, dest_len, false, true);
+}
+
 string CHexEscape(const string& src) {
   const int dest_length = src.size() * 4 + 1; // Maximum possible expansion
   scoped_array<char> dest(new char[dest_length]);
@@ -927,39 +942,19 @@ string SimpleItoa(unsigned long long i) {
 // DoubleToBuffer()
 // FloatToBuffer()
 //    We want to print the value without losing precision, but we also do
-//    not want to print more digits than necessary.  This turns out to be
-//    trickier than it sounds.  Numbers like 0.2 cannot be represented
-//    exactly in binary.  If we print 0.2 with a very large precision,
-//    e.g. "%.50g", we get "0.2000000000000000111022302462515654042363167".
-//    On the other hand, if we set the precision too low, we lose
-//    significant digits when printing numbers that actually need them.
-//    It turns out there is no precision value that does the right thing
-//    for all numbers.
-//
-//    Our strategy is to first try printing with a precision that is never
-//    over-precise, then parse the result with strtod() to see if it
-//    matches.  If not, we print again with a precision that will always
-//    give a precise result, but may use more digits than necessary.
+//    not want to print more digits than necessary.  Numbers like 0.2 cannot
+//    be represented exactly in binary, so printing them with a large fixed
+//    precision, e.g. "%.50g", gives "0.2000000000000000111022302462515654",
+//    while too small a precision loses digits of numbers which need them.
 //
-//    An arguably better strategy would be to use the algorithm described
-//    in "How to Print Floating-Point Numbers Accurately" by Steele &
-//    White, e.g. as implemented by David M. Gay's dtoa().  It turns out,
-//    however, that the following implementation is about as fast as
-//    DMG's code.  Furthermore, DMG's code locks mutexes, which means it
-//    will not scale well on multi-core machines.  DMG's code is slightly
-//    more accurate (in that it will never use more digits than
-//    necessary), but this is probably irrelevant for most users.
-//
-//    Rob Pike and Ken Thompson also have an implementation of dtoa() in
-//    third_party/fmt/fltfmt.cc.  Their implementation is similar to this
-//    one in that it makes guesses and then uses strtod() to check them.
-//    Their implementation is faster because they use their own code to
-//    generate the digits in the first place rather than use snprintf(),
-//    thus avoiding format string parsing overhead.  However, this makes
-//    it considerably more complicated than the following implementation,
-//    and it is embedded in a larger library.  If speed turns out to be
-//    an issue, we could re-implement this in terms of their
-//    implementation.
+//    We used to print with snprintf() at DBL_DIG digits, parse the result
+//    with strtod() to check it, and print again with two more digits if it
+//    didn't match -- slow, and not always the shortest.  Now
+//    internal::ShortestDecimal() (see float_conversion.h) finds the
+//    shortest digits directly, and we lay them out as "%.*g" would:  in
+//    exponential notation if the decimal exponent is below -4 or at least
+//    the precision, where the precision is DBL_DIG (FLT_DIG for floats) if
+//    the digits fit in that many, and two more otherwise, just as before.
 // ----------------------------------------------------------------------
 
 string SimpleDtoa(double value) {
@@ -972,46 +967,57 @@ string SimpleFtoa(float value) {
   return FloatToBuffer(value, buffer);
 }
 
-static inline bool IsValidFloatChar(char c) {
-  return ('0' <= c && c <= '9') ||
-         c == 'e' || c == 'E' ||
-         c == '+' || c == '-';
-}
-
-void DelocalizeRadix(char* buffer) {
-  // Fast check:  if the buffer has a normal decimal point, assume no
-  // translation is needed.
-  if (strchr(buffer, '.') != NULL) return;
-
-  // Find the first unknown character.
-  while (IsValidFloatChar(*buffer)) ++buffer;
-
-  if (*buffer == '\0') {
-    // No radix character found.
-    return;
-  }
-
-  // We are now pointing at the locale-specific radix character.  Replace it
-  // with '.'.
-  *buffer = '.';
-  ++buffer;
-
-  if (!IsValidFloatChar(*buffer) && *buffer != '\0') {
-    // It appears the radix was a multi-byte character.  We need to remove the
-    // extra bytes.
-    char* target = buffer;
-    do { ++buffer; } while (!IsValidFloatChar(*buffer) && *buffer != '\0');
-    memmove(target, buffer, strlen(buffer) + 1);
+namespace {
+
+// Writes significand * 10^exponent as described above, where digits is
+// DBL_DIG or FLT_DIG.  Returns a pointer to the terminating '\0'.
+char* FormatDecimal(uint64 significand, int exponent, int digits,
+                    char* buffer) {
+  char text[kFastToBufferSize];
+  int length = FastUInt64ToBufferLeft(significand, text) - text;
+  int precision = length <= digits ? digits : digits + 2;
+  // The exponent of the first digit, as in "d.ddde+XX".
+  int scientific_exponent = exponent + length - 1;
+
+  char* p = buffer;
+  if (scientific_exponent < -4 || scientific_exponent >= precision) {
+    *p++ = text[0];
+    if (length > 1) {
+      *p++ = '.';
+      memcpy(p, text + 1, length - 1);
+      p += length - 1;
+    }
+    *p++ = 'e';
+    *p++ = scientific_exponent < 0 ? '-' : '+';
+    int magnitude = scientific_exponent < 0 ? -scientific_exponent
+                                            : scientific_exponent;
+    if (magnitude < 10) *p++ = '0';
+    p = FastUInt32ToBufferLeft(magnitude, p);
+  } else if (scientific_exponent < 0) {
+    *p++ = '0';
+    *p++ = '.';
+    for (int i = -1; i > scientific_exponent; i--) *p++ = '0';
+    memcpy(p, text, length);
+    p += length;
+  } else if (length <= scientific_exponent + 1) {
+    memcpy(p, text, length);
+    p += length;
+    for (int i = length; i <= scientific_exponent; i++) *p++ = '0';
+  } else {
+    int integer_length = scientific_exponent + 1;
+    memcpy(p, text, integer_length);
+    p += integer_length;
+    *p++ = '.';
+    memcpy(p, text + integer_length, length - integer_length);
+    p += length - integer_length;
   }
+  *p = '\0';
+  return p;
 }
 
-char* DoubleToBuffer(double value, char* buffer) {
-  // DBL_DIG is 15 for IEEE-754 doubles, which are used on almost all
-  // platforms these days.  Just in case some system exists where DBL_DIG
-  // is significantly larger -- and risks overflowing our buffer -- we have
-  // this assert.
-  GOOGLE_COMPILE_ASSERT(DBL_DIG < 20, DBL_DIG_is_too_big);
+}  // namespace
 
+char* DoubleToBuffer(double value, char* buffer) {
   if (value == numeric_limits<double>::infinity()) {
     strcpy(buffer, "inf");
     return buffer;
@@ -1023,50 +1029,26 @@ char* DoubleToBuffer(double value, char* buffer) {
     return buffer;
   }
 
-  int snprintf_result =
-    snprintf(buffer, kDoubleToBufferSize, "%.*g", DBL_DIG, value);
-
-  // The snprintf should never overflow because the buffer is significantly
-  // larger than the precision we asked for.
-  GOOGLE_DCHECK(snprintf_result > 0 && snprintf_result < kDoubleToBufferSize);
-
-  // We need to make parsed_value volatile in order to force the compiler to
-  // write it out to the stack.  Otherwise, it may keep the value in a
-  // register, and if it does that, it may keep it as a long double instead
-  // of a double.  This long double may have extra bits that make it compare
-  // unequal to "value" even though it would be exactly equal if it were
-  // truncated to a double.
-  volatile double parsed_value = strtod(buffer, NULL);
-  if (parsed_value != value) {
-    int snprintf_result =
-      snprintf(buffer, kDoubleToBufferSize, "%.*g", DBL_DIG+2, value);
-
-    // Should never overflow; see above.
-    GOOGLE_DCHECK(snprintf_result > 0 && snprintf_result < kDoubleToBufferSize);
+  char* p = buffer;
+  uint64 bits;
+  memcpy(&bits, &value, sizeof(bits));
+  if (bits >> 63) {  // Includes -0.
+    *p++ = '-';
+    value = -value;
+  }
+  if (value == 0) {
+    strcpy(p, "0");
+    return buffer;
   }
 
-  DelocalizeRadix(buffer);
+  uint64 significand;
+  int exponent;
+  internal::ShortestDecimal(value, &significand, &exponent);
+  FormatDecimal(significand, exponent, DBL_DIG, p);
   return buffer;
 }
 
-bool safe_strtof(const char* str, float* value) {
-  char* endptr;
-  errno = 0;  // errno only gets set on errors
-#if defined(_WIN32) || defined (__hpux)  // has no strtof()
-  *value = strtod(str, &endptr);
-#else
-  *value = strtof(str, &endptr);
-#endif
-  return *str != 0 && *endptr == 0 && errno == 0;
-}
-
 char* FloatToBuffer(float value, char* buffer) {
-  // FLT_DIG is 6 for IEEE-754 floats, which are used on almost all
-  // platforms these days.  Just in case some system exists where FLT_DIG
-  // is significantly larger -- and risks overflowing our buffer -- we have
-  // this assert.
-  GOOGLE_COMPILE_ASSERT(FLT_DIG < 10, FLT_DIG_is_too_big);
-
   if (value == numeric_limits<double>::infinity()) {
     strcpy(buffer, "inf");
     return buffer;
@@ -1078,23 +1060,22 @@ char* FloatToBuffer(float value, char* buffer) {
     return buffer;
   }
 
-  int snprintf_result =
-    snprintf(buffer, kFloatToBufferSize, "%.*g", FLT_DIG, value);
-
-  // The snprintf should never overflow because the buffer is significantly
-  // larger than the precision we asked for.
-  GOOGLE_DCHECK(snprintf_result > 0 && snprintf_result < kFloatToBufferSize);
-
-  float parsed_value;
-  if (!safe_strtof(buffer, &parsed_value) || parsed_value != value) {
-    int snprintf_result =
-      snprintf(buffer, kFloatToBufferSize, "%.*g", FLT_DIG+2, value);
-
-    // Should never overflow; see above.
-    GOOGLE_DCHECK(snprintf_result > 0 && snprintf_result < kFloatToBufferSize);
+  char* p = buffer;
+  uint32 bits;
+  memcpy(&bits, &value, sizeof(bits));
+  if (bits >> 31) {  // Includes -0.
+    *p++ = '-';
+    value = -value;
+  }
+  if (value == 0) {
+    strcpy(p, "0");
+    return buffer;
   }
 
-  DelocalizeRadix(buffer);
+  uint32 significand;
+  int exponent;
+  internal::ShortestDecimal(value, &significand, &exponent);
+  FormatDecimal(significand, exponent, FLT_DIG, p);
   return buffer;
 }
 
@@ -1128,6 +1109,18 @@ string LocalizeRadix(const char* input, const char* radix_pos) {
 }
 
 double NoLocaleStrtod(const char* text, char** original_endptr) {
+  // Almost everything is handled by FastStrtod(), which ignores the locale
+  // and is much faster than strtod() besides.
+  double fast_result;
+  const char* fast_endptr;
+  if (internal::FastStrtod(text, &fast_result, &fast_endptr)) {
+    // const_cast is necessary to match the strtod() interface.
+    if (original_endptr != NULL) {
+      *original_endptr = const_cast<char*>(fast_endptr);
+    }
+    return fast_result;
+  }
+
   // We cannot simply set the locale to "C" temporarily with setlocale()
   // as this is not thread-safe.  Instead, we try to parse in the current
   // locale first.  If parsing stops at a '.' character, then this is a
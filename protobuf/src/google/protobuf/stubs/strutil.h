@@ -269,6 +269,10 @@ namespace strings {
 // Like CEscape() but does not escape bytes with the upper bit set.
 LIBPROTOBUF_EXPORT string Utf8SafeCEscape(const string& src);
 
+// Like CEscapeString() but does not escape bytes with the upper bit set.
+LIBPROTOBUF_EXPORT int Utf8SafeCEscapeString(const char* src, int src_len,
+                                             char* dest, int dest_len);
+
 // Like CEscape() but uses hex (\x) escapes instead of octals.
 LIBPROTOBUF_EXPORT string CHexEscape(const string& src);
 }  // namespace strings
@@ -420,8 +424,7 @@ LIBPROTOBUF_EXPORT string SimpleItoa(unsigned long long i);
 //    Description: converts a double or float to a string which, if
 //    passed to NoLocaleStrtod(), will produce the exact same original double
 //    (except in case of NaN; all NaNs are considered the same value).
-//    We try to keep the string short but it's not guaranteed to be as
-//    short as possible.
+//    The digits are the fewest that do so, as with Ryu or Grisu.
 //
 //    DoubleToBuffer() and FloatToBuffer() write the text to the given
 //    buffer and return it.  The buffer must be at least
@@ -446,7 +449,8 @@ static const int kFloatToBufferSize = 24;
 // ----------------------------------------------------------------------
 // NoLocaleStrtod()
 //   Exactly like strtod(), except it always behaves as if in the "C"
-//   locale (i.e. decimal points must be '.'s).
+//   locale (i.e. decimal points must be '.'s).  Plain decimal numbers are
+//   converted without calling strtod() at all, which is considerably faster.
 // ----------------------------------------------------------------------
 
 LIBPROTOBUF_EXPORT double NoLocaleStrtod(const char* text, char** endptr);
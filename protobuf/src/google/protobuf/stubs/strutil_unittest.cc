@@ -35,6 +35,7 @@
 #include <google/protobuf/testing/googletest.h>
 #include <gtest/gtest.h>
 #include <locale.h>
+#include <limits>
 
 namespace google {
 namespace protobuf {
@@ -78,6 +79,38 @@ TEST(StringUtilityTest, ImmuneToLocales) {
   setlocale(LC_NUMERIC, old_locale.c_str());
 }
 
+TEST(StringUtilityTest, SimpleDtoa) {
+  // Same layout as printf("%.15g"), or "%.17g" when more digits are needed,
+  // but with no more digits than necessary.
+  EXPECT_EQ("0", SimpleDtoa(0.0));
+  EXPECT_EQ("-0", SimpleDtoa(-0.0));
+  EXPECT_EQ("1", SimpleDtoa(1.0));
+  EXPECT_EQ("-1.5", SimpleDtoa(-1.5));
+  EXPECT_EQ("0.1", SimpleDtoa(0.1));
+  EXPECT_EQ("0.30000000000000004", SimpleDtoa(0.1 + 0.2));
+  EXPECT_EQ("0.0001", SimpleDtoa(1e-4));
+  EXPECT_EQ("1e-05", SimpleDtoa(1e-5));
+  EXPECT_EQ("1.25e-05", SimpleDtoa(1.25e-5));
+  EXPECT_EQ("100000000000000", SimpleDtoa(1e14));
+  EXPECT_EQ("1e+15", SimpleDtoa(1e15));
+  EXPECT_EQ("1234567890123456", SimpleDtoa(1234567890123456.0));
+  EXPECT_EQ("1.7976931348623157e+308", SimpleDtoa(1.7976931348623157e308));
+  EXPECT_EQ("5e-324", SimpleDtoa(4.9406564584124654e-324));
+  EXPECT_EQ("inf", SimpleDtoa(numeric_limits<double>::infinity()));
+  EXPECT_EQ("-inf", SimpleDtoa(-numeric_limits<double>::infinity()));
+}
+
+TEST(StringUtilityTest, SimpleFtoa) {
+  EXPECT_EQ("0", SimpleFtoa(0.0f));
+  EXPECT_EQ("0.1", SimpleFtoa(0.1f));
+  EXPECT_EQ("0.3", SimpleFtoa(0.3f));
+  EXPECT_EQ("100000", SimpleFtoa(1e5f));
+  EXPECT_EQ("1e+06", SimpleFtoa(1e6f));
+  EXPECT_EQ("16777216", SimpleFtoa(16777216.0f));
+  EXPECT_EQ("3.4028235e+38", SimpleFtoa(3.4028235e38f));
+  EXPECT_EQ("1e-45", SimpleFtoa(1e-45f));
+}
+
 }  // anonymous namespace
 }  // namespace protobuf
 }  // namespace google
@@ -47,6 +47,11 @@
 #include <google/protobuf/unknown_field_set.h>
 #include <google/protobuf/descriptor.pb.h>
 #include <google/protobuf/io/tokenizer.h>
+#include <google/protobuf/stubs/flat_hash_map.h>
+#include <google/protobuf/stubs/lockfree_hash_map.h>
+#include <google/protobuf/stubs/map-util.h>
+#include <google/protobuf/stubs/once.h>
+#include <google/protobuf/stubs/stl_util-inl.h>
 #include <google/protobuf/stubs/strutil.h>
 
 namespace google {
@@ -92,6 +97,111 @@ void Message::PrintDebugString() const {
 }
 
 
+// ===========================================================================
+// What printing and parsing need to know about a message type, worked out
+// once for each type.  Only types from the generated pool are cached, since
+// they live as long as the program; a dynamic type may be deleted and
+// another allocated at its address.
+
+namespace {
+
+struct TypeInfo {
+  // The text which starts each printed field, indexed by
+  // FieldDescriptor::index():  its name followed by ": ", or by " {" for
+  // messages and groups.
+  vector<string> field_tokens;
+
+  // The fields by the names they are written with:  their own names, or the
+  // type names for groups, which keep their capitalization.
+  internal::FlatHashMap<const char*, const FieldDescriptor*,
+                        hash<const char*>, streq> fields_by_name;
+};
+
+class TypeInfoCache {
+ public:
+  TypeInfoCache() {}
+  ~TypeInfoCache() {
+    STLDeleteElements(&all_info_);
+  }
+
+  static TypeInfoCache* singleton();
+
+  // Returns the information for type, or NULL if type is not from the
+  // generated pool.
+  const TypeInfo* Get(const Descriptor* type);
+
+ private:
+  // Get() searches map_ without locking; mutex_ serializes insertions.
+  Mutex mutex_;
+  internal::LockFreeHashMap<const Descriptor*, const TypeInfo*> map_;
+  vector<TypeInfo*> all_info_;
+
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(TypeInfoCache);
+};
+
+TypeInfoCache* type_info_cache_ = NULL;
+GOOGLE_PROTOBUF_DECLARE_ONCE(type_info_cache_once_init_);
+
+void ShutdownTypeInfoCache() {
+  delete type_info_cache_;
+}
+
+void InitTypeInfoCache() {
+  type_info_cache_ = new TypeInfoCache;
+  internal::OnShutdown(&ShutdownTypeInfoCache);
+}
+
+TypeInfoCache* TypeInfoCache::singleton() {
+  ::google::protobuf::GoogleOnceInit(&type_info_cache_once_init_,
+                 &InitTypeInfoCache);
+  return type_info_cache_;
+}
+
+const TypeInfo* TypeInfoCache::Get(const Descriptor* type) {
+  const TypeInfo* result = map_.Find(type);
+  if (result != NULL) return result;
+  if (type->file()->pool() != DescriptorPool::generated_pool()) return NULL;
+
+  MutexLock lock(&mutex_);
+
+  // Check if another thread preempted us.
+  result = map_.Find(type);
+  if (result != NULL) return result;
+
+  TypeInfo* info = new TypeInfo;
+  info->field_tokens.resize(type->field_count());
+  for (int i = 0; i < type->field_count(); i++) {
+    const FieldDescriptor* field = type->field(i);
+    string* token = &info->field_tokens[i];
+    if (field->type() == FieldDescriptor::TYPE_GROUP) {
+      // Groups must be serialized with their original capitalization.
+      *token = field->message_type()->name();
+    } else {
+      *token = field->name();
+      info->fields_by_name[field->name().c_str()] = field;
+    }
+    if (field->cpp_type() == FieldDescriptor::CPPTYPE_MESSAGE) {
+      token->append(" {");
+    } else {
+      token->append(": ");
+    }
+  }
+  // A field's own name takes precedence over a group's type name.
+  for (int i = 0; i < type->field_count(); i++) {
+    const FieldDescriptor* field = type->field(i);
+    if (field->type() == FieldDescriptor::TYPE_GROUP) {
+      InsertIfNotPresent(&info->fields_by_name,
+                         field->message_type()->name().c_str(), field);
+    }
+  }
+
+  all_info_.push_back(info);
+  map_.Insert(type, info);
+  return info;
+}
+
+}  // namespace
+
 // ===========================================================================
 // Internal class for parsing an ASCII representation of a Protocol Message.
 // This class makes use of the Protocol Message compiler's tokenizer found
@@ -142,13 +252,16 @@ class TextFormat::Parser::ParserImpl {
   // false if an error occurs (an error will also be logged to
   // GOOGLE_LOG(ERROR)).
   bool Parse(Message* output) {
+    const TypeInfo* type_info =
+        TypeInfoCache::singleton()->Get(output->GetDescriptor());
+
     // Consume fields until we cannot do so anymore.
     while(true) {
       if (LookingAtType(io::Tokenizer::TYPE_END)) {
         return !had_errors_;
       }
 
-      DO(ConsumeField(output));
+      DO(ConsumeField(output, type_info));
     }
   }
 
@@ -217,9 +330,12 @@ class TextFormat::Parser::ParserImpl {
   // Consumes the specified message with the given starting delimeter.
   // This method checks to see that the end delimeter at the conclusion of
   // the consumption matches the starting delimeter passed in here.
-  bool ConsumeMessage(Message* message, const string delimeter) {
+  bool ConsumeMessage(Message* message, const char* delimeter) {
+    const TypeInfo* type_info =
+        TypeInfoCache::singleton()->Get(message->GetDescriptor());
+
     while (!LookingAt(">") &&  !LookingAt("}")) {
-      DO(ConsumeField(message));
+      DO(ConsumeField(message, type_info));
     }
 
     // Confirm that we have a valid ending delimeter.
@@ -229,11 +345,14 @@ class TextFormat::Parser::ParserImpl {
   }
 
   // Consumes the current field (as returned by the tokenizer) on the
-  // passed in message.
-  bool ConsumeField(Message* message) {
+  // passed in message.  type_info is the message type's entry in the
+  // TypeInfoCache, if it has one.
+  bool ConsumeField(Message* message, const TypeInfo* type_info) {
     const Reflection* reflection = message->GetReflection();
     const Descriptor* descriptor = message->GetDescriptor();
 
+    // Not filled in when the field is found in type_info, which is done
+    // with the current token's text rather than a copy of it.
     string field_name;
 
     const FieldDescriptor* field = NULL;
@@ -257,6 +376,20 @@ class TextFormat::Parser::ParserImpl {
                     descriptor->full_name() + "\".");
         return false;
       }
+    } else if (type_info != NULL) {
+      DO(ExpectIdentifier());
+      field = FindPtrOrNull(type_info->fields_by_name,
+                            tokenizer_.current().text.c_str());
+      if (field == NULL) {
+        // Errors are reported at the next token, as if the name had been
+        // consumed.
+        field_name = tokenizer_.current().text;
+        tokenizer_.Next();
+        ReportError("Message type \"" + descriptor->full_name() +
+                    "\" has no field named \"" + field_name + "\".");
+        return false;
+      }
+      tokenizer_.Next();
     } else {
       DO(ConsumeIdentifier(&field_name));
 
@@ -289,7 +422,7 @@ class TextFormat::Parser::ParserImpl {
     // Fail if the field is not repeated and it has already been specified.
     if ((singular_overwrite_policy_ == FORBID_SINGULAR_OVERWRITES) &&
         !field->is_repeated() && reflection->HasField(*message, field)) {
-      ReportError("Non-repeated field \"" + field_name +
+      ReportError("Non-repeated field \"" + WrittenName(field, field_name) +
                   "\" is specified multiple times.");
       return false;
     }
@@ -306,16 +439,29 @@ class TextFormat::Parser::ParserImpl {
 
     if (field->options().deprecated()) {
       ReportWarning("text format contains deprecated field \""
-                    + field_name + "\"");
+                    + WrittenName(field, field_name) + "\"");
     }
 
     return true;
   }
 
+  // Returns the name field was written with, which is field_name if it
+  // was filled in.
+  static const string& WrittenName(const FieldDescriptor* field,
+                                   const string& field_name) {
+    if (!field_name.empty()) {
+      return field_name;
+    } else if (field->type() == FieldDescriptor::TYPE_GROUP) {
+      return field->message_type()->name();
+    } else {
+      return field->name();
+    }
+  }
+
   bool ConsumeFieldMessage(Message* message,
                            const Reflection* reflection,
                            const FieldDescriptor* field) {
-    string delimeter;
+    const char* delimeter;
     if (TryConsume("<")) {
       delimeter = ">";
     } else {
@@ -390,31 +536,34 @@ class TextFormat::Parser::ParserImpl {
       }
 
       case FieldDescriptor::CPPTYPE_STRING: {
-        string value;
-        DO(ConsumeString(&value));
-        SET_FIELD(String, value);
+        // string_value_ is reused so that its buffer is too.
+        DO(ConsumeString(&string_value_));
+        SET_FIELD(String, string_value_);
         break;
       }
 
       case FieldDescriptor::CPPTYPE_BOOL: {
-        string value;
-        DO(ConsumeIdentifier(&value));
+        DO(ExpectIdentifier());
+        const string& value = tokenizer_.current().text;
 
         if (value == "true") {
           SET_FIELD(Bool, true);
         } else if (value == "false") {
           SET_FIELD(Bool, false);
         } else {
+          string invalid_value = value;
+          tokenizer_.Next();
           ReportError("Invalid value for boolean field \"" + field->name()
-                      + "\". Value: \"" + value  + "\".");
+                      + "\". Value: \"" + invalid_value  + "\".");
           return false;
         }
+        tokenizer_.Next();
         break;
       }
 
       case FieldDescriptor::CPPTYPE_ENUM: {
-        string value;
-        DO(ConsumeIdentifier(&value));
+        DO(ExpectIdentifier());
+        const string& value = tokenizer_.current().text;
 
         // Find the enumeration value.
         const EnumDescriptor* enum_type = field->enum_type();
@@ -422,12 +571,15 @@ class TextFormat::Parser::ParserImpl {
             = enum_type->FindValueByName(value);
 
         if (enum_value == NULL) {
-          ReportError("Unknown enumeration value of \"" + value  + "\" for "
-                      "field \"" + field->name() + "\".");
+          string invalid_value = value;
+          tokenizer_.Next();
+          ReportError("Unknown enumeration value of \"" + invalid_value +
+                      "\" for field \"" + field->name() + "\".");
           return false;
         }
 
         SET_FIELD(Enum, enum_value);
+        tokenizer_.Next();
         break;
       }
 
@@ -443,7 +595,7 @@ class TextFormat::Parser::ParserImpl {
   }
 
   // Returns true if the current token's text is equal to that specified.
-  bool LookingAt(const string& text) {
+  bool LookingAt(const char* text) {
     return tokenizer_.current().text == text;
   }
 
@@ -455,10 +607,7 @@ class TextFormat::Parser::ParserImpl {
   // Consumes an identifier and saves its value in the identifier parameter.
   // Returns false if the token is not of type IDENTFIER.
   bool ConsumeIdentifier(string* identifier) {
-    if (!LookingAtType(io::Tokenizer::TYPE_IDENTIFIER)) {
-      ReportError("Expected identifier.");
-      return false;
-    }
+    DO(ExpectIdentifier());
 
     *identifier = tokenizer_.current().text;
 
@@ -466,6 +615,17 @@ class TextFormat::Parser::ParserImpl {
     return true;
   }
 
+  // Returns false if the token is not of type IDENTIFIER.  Unlike
+  // ConsumeIdentifier(), leaves the token where it is, so that the caller
+  // can use its text without copying it and then call tokenizer_.Next().
+  bool ExpectIdentifier() {
+    if (!LookingAtType(io::Tokenizer::TYPE_IDENTIFIER)) {
+      ReportError("Expected identifier.");
+      return false;
+    }
+    return true;
+  }
+
   // Consumes a string and saves its value in the text parameter.
   // Returns false if the token is not of type STRING.
   bool ConsumeString(string* text) {
@@ -584,12 +744,12 @@ class TextFormat::Parser::ParserImpl {
   // Consumes a token and confirms that it matches that specified in the
   // value parameter. Returns false if the token found does not match that
   // which was specified.
-  bool Consume(const string& value) {
+  bool Consume(const char* value) {
     const string& current_value = tokenizer_.current().text;
 
     if (current_value != value) {
-      ReportError("Expected \"" + value + "\", found \"" + current_value
-                  + "\".");
+      ReportError(string("Expected \"") + value + "\", found \"" +
+                  current_value + "\".");
       return false;
     }
 
@@ -600,7 +760,7 @@ class TextFormat::Parser::ParserImpl {
 
   // Attempts to consume the supplied value. Returns false if a the
   // token found does not match the value specified.
-  bool TryConsume(const string& value) {
+  bool TryConsume(const char* value) {
     if (tokenizer_.current().text == value) {
       tokenizer_.Next();
       return true;
@@ -637,18 +797,35 @@ class TextFormat::Parser::ParserImpl {
   const Descriptor* root_message_type_;
   SingularOverwritePolicy singular_overwrite_policy_;
   bool had_errors_;
+  string string_value_;
 };
 
 #undef DO
 
 // ===========================================================================
-// Internal class for writing text to the io::ZeroCopyOutputStream. Adapted
-// from the Printer found in //google/protobuf/io/printer.h
+// Internal class for writing text to the io::ZeroCopyOutputStream, or
+// straight into a string. Adapted from the Printer found in
+// //google/protobuf/io/printer.h
 class TextFormat::Printer::TextGenerator {
  public:
   explicit TextGenerator(io::ZeroCopyOutputStream* output,
                          int initial_indent_level)
     : output_(output),
+      string_(NULL),
+      buffer_(NULL),
+      buffer_size_(0),
+      at_start_of_line_(true),
+      failed_(false),
+      indent_(""),
+      initial_indent_level_(initial_indent_level) {
+    indent_.resize(initial_indent_level_ * 2, ' ');
+  }
+
+  // Writes into *output directly, growing it as needed, rather than through
+  // a StringOutputStream.  The *ToString() methods use this.
+  explicit TextGenerator(string* output, int initial_indent_level)
+    : output_(NULL),
+      string_(output),
       buffer_(NULL),
       buffer_size_(0),
       at_start_of_line_(true),
@@ -662,7 +839,11 @@ class TextFormat::Printer::TextGenerator {
     // Only BackUp() if we're sure we've successfully called Next() at least
     // once.
     if (buffer_size_ > 0) {
-      output_->BackUp(buffer_size_);
+      if (string_ != NULL) {
+        string_->resize(string_->size() - buffer_size_);
+      } else {
+        output_->BackUp(buffer_size_);
+      }
     }
   }
 
@@ -716,6 +897,33 @@ class TextFormat::Printer::TextGenerator {
     Write(text + pos, size - pos);
   }
 
+  // Print text which is known not to contain any newlines, such as names
+  // and values, without looking for them.
+  void PrintRaw(const string& str) {
+    Write(str.data(), str.size());
+  }
+
+  // Print text which is known not to contain any newlines.
+  void PrintRaw(const char* text, int size) {
+    Write(text, size);
+  }
+
+  // Print str with C-style escapes, as CEscape() would (or Utf8SafeCEscape(),
+  // if utf8_safe), without building the escaped copy first.
+  void PrintCEscaped(const string& str, bool utf8_safe) {
+    // Each chunk can grow to four times its size, plus a '\0'.
+    static const int kChunkSize = 256;
+    char escaped[kChunkSize * 4 + 1];
+    for (int pos = 0; pos < str.size(); pos += kChunkSize) {
+      int size = min<int>(kChunkSize, str.size() - pos);
+      int escaped_size = utf8_safe ?
+          strings::Utf8SafeCEscapeString(str.data() + pos, size,
+                                         escaped, sizeof(escaped)) :
+          CEscapeString(str.data() + pos, size, escaped, sizeof(escaped));
+      Write(escaped, escaped_size);
+    }
+  }
+
   // True if any write to the underlying stream failed.  (We don't just
   // crash in this case because this is an I/O failure, not a programming
   // error.)
@@ -741,10 +949,8 @@ class TextFormat::Printer::TextGenerator {
       memcpy(buffer_, data, buffer_size_);
       data += buffer_size_;
       size -= buffer_size_;
-      void* void_buffer;
-      failed_ = !output_->Next(&void_buffer, &buffer_size_);
+      Next();
       if (failed_) return;
-      buffer_ = reinterpret_cast<char*>(void_buffer);
     }
 
     // Buffer is big enough to receive the data; copy it.
@@ -753,7 +959,26 @@ class TextFormat::Printer::TextGenerator {
     buffer_size_ -= size;
   }
 
+  // Gets a new buffer_ from the stream, or by growing the string.
+  void Next() {
+    if (string_ != NULL) {
+      // Use whatever capacity the string has, then double it.
+      static const int kMinimumSize = 64;
+      int old_size = string_->size();
+      int new_size = max(static_cast<int>(string_->capacity()), old_size * 2);
+      new_size = max(new_size, kMinimumSize);
+      string_->resize(new_size);
+      buffer_ = string_as_array(string_) + old_size;
+      buffer_size_ = new_size - old_size;
+    } else {
+      void* void_buffer;
+      failed_ = !output_->Next(&void_buffer, &buffer_size_);
+      if (!failed_) buffer_ = reinterpret_cast<char*>(void_buffer);
+    }
+  }
+
   io::ZeroCopyOutputStream* const output_;
+  string* const string_;
   char* buffer_;
   int buffer_size_;
   bool at_start_of_line_;
@@ -844,6 +1069,33 @@ bool TextFormat::Parser::ParseFieldValueFromString(
 
 // ===========================================================================
 
+namespace {
+
+// Formats value into buffer, which must hold kFastToBufferSize bytes, and
+// returns a pointer to the end of the text.
+inline char* FormatValue(int32 value, char* buffer) {
+  return FastInt32ToBufferLeft(value, buffer);
+}
+inline char* FormatValue(int64 value, char* buffer) {
+  return FastInt64ToBufferLeft(value, buffer);
+}
+inline char* FormatValue(uint32 value, char* buffer) {
+  return FastUInt32ToBufferLeft(value, buffer);
+}
+inline char* FormatValue(uint64 value, char* buffer) {
+  return FastUInt64ToBufferLeft(value, buffer);
+}
+inline char* FormatValue(float value, char* buffer) {
+  FloatToBuffer(value, buffer);
+  return buffer + strlen(buffer);
+}
+inline char* FormatValue(double value, char* buffer) {
+  DoubleToBuffer(value, buffer);
+  return buffer + strlen(buffer);
+}
+
+}  // namespace
+
 TextFormat::Printer::Printer()
   : initial_indent_level_(0),
     single_line_mode_(false),
@@ -857,11 +1109,12 @@ bool TextFormat::Printer::PrintToString(const Message& message,
   GOOGLE_DCHECK(output) << "output specified is NULL";
 
   output->clear();
-  io::StringOutputStream output_stream(output);
+  TextGenerator generator(output, initial_indent_level_);
 
-  bool result = Print(message, &output_stream);
+  Print(message, generator);
 
-  return result;
+  // Output false if the generator failed internally.
+  return !generator.failed();
 }
 
 bool TextFormat::Printer::PrintUnknownFieldsToString(
@@ -870,8 +1123,12 @@ bool TextFormat::Printer::PrintUnknownFieldsToString(
   GOOGLE_DCHECK(output) << "output specified is NULL";
 
   output->clear();
-  io::StringOutputStream output_stream(output);
-  return PrintUnknownFields(unknown_fields, &output_stream);
+  TextGenerator generator(output, initial_indent_level_);
+
+  PrintUnknownFields(unknown_fields, generator);
+
+  // Output false if the generator failed internally.
+  return !generator.failed();
 }
 
 bool TextFormat::Printer::Print(const Message& message,
@@ -898,10 +1155,14 @@ bool TextFormat::Printer::PrintUnknownFields(
 void TextFormat::Printer::Print(const Message& message,
                                 TextGenerator& generator) {
   const Reflection* reflection = message.GetReflection();
+  const TypeInfo* type_info =
+      TypeInfoCache::singleton()->Get(message.GetDescriptor());
+  const vector<string>* field_tokens =
+      type_info == NULL ? NULL : &type_info->field_tokens;
   vector<const FieldDescriptor*> fields;
   reflection->ListFields(message, &fields);
   for (int i = 0; i < fields.size(); i++) {
-    PrintField(message, reflection, fields[i], generator);
+    PrintField(message, reflection, fields[i], field_tokens, generator);
   }
   PrintUnknownFields(reflection->GetUnknownFields(message), generator);
 }
@@ -915,8 +1176,7 @@ void TextFormat::Printer::PrintFieldValueToString(
   GOOGLE_DCHECK(output) << "output specified is NULL";
 
   output->clear();
-  io::StringOutputStream output_stream(output);
-  TextGenerator generator(&output_stream, initial_indent_level_);
+  TextGenerator generator(output, initial_indent_level_);
 
   PrintFieldValue(message, message.GetReflection(), field, index, generator);
 }
@@ -924,6 +1184,7 @@ void TextFormat::Printer::PrintFieldValueToString(
 void TextFormat::Printer::PrintField(const Message& message,
                                      const Reflection* reflection,
                                      const FieldDescriptor* field,
+                                     const vector<string>* field_tokens,
                                      TextGenerator& generator) {
   if (use_short_repeated_primitives_ &&
       field->is_repeated() &&
@@ -942,17 +1203,25 @@ void TextFormat::Printer::PrintField(const Message& message,
   }
 
   for (int j = 0; j < count; ++j) {
-    PrintFieldName(message, reflection, field, generator);
+    // The name and the " {" or ": " after it.
+    if (field_tokens != NULL && !field->is_extension()) {
+      generator.PrintRaw((*field_tokens)[field->index()]);
+    } else {
+      PrintFieldName(message, reflection, field, generator);
+      if (field->cpp_type() == FieldDescriptor::CPPTYPE_MESSAGE) {
+        generator.PrintRaw(" {", 2);
+      } else {
+        generator.PrintRaw(": ", 2);
+      }
+    }
 
     if (field->cpp_type() == FieldDescriptor::CPPTYPE_MESSAGE) {
       if (single_line_mode_) {
-        generator.Print(" { ");
+        generator.PrintRaw(" ", 1);
       } else {
-        generator.Print(" {\n");
+        generator.Print("\n");
         generator.Indent();
       }
-    } else {
-      generator.Print(": ");
     }
 
     // Write the field value.
@@ -1011,17 +1280,17 @@ void TextFormat::Printer::PrintFieldName(const Message& message,
         && field->type() == FieldDescriptor::TYPE_MESSAGE
         && field->is_optional()
         && field->extension_scope() == field->message_type()) {
-      generator.Print(field->message_type()->full_name());
+      generator.PrintRaw(field->message_type()->full_name());
     } else {
-      generator.Print(field->full_name());
+      generator.PrintRaw(field->full_name());
     }
     generator.Print("]");
   } else {
     if (field->type() == FieldDescriptor::TYPE_GROUP) {
       // Groups must be serialized with their original capitalization.
-      generator.Print(field->message_type()->name());
+      generator.PrintRaw(field->message_type()->name());
     } else {
-      generator.Print(field->name());
+      generator.PrintRaw(field->name());
     }
   }
 }
@@ -1036,19 +1305,22 @@ void TextFormat::Printer::PrintFieldValue(
       << "Index must be -1 for non-repeated fields";
 
   switch (field->cpp_type()) {
-#define OUTPUT_FIELD(CPPTYPE, METHOD, TO_STRING)                             \
-      case FieldDescriptor::CPPTYPE_##CPPTYPE:                               \
-        generator.Print(TO_STRING(field->is_repeated() ?                     \
+#define OUTPUT_FIELD(CPPTYPE, METHOD)                                        \
+      case FieldDescriptor::CPPTYPE_##CPPTYPE: {                             \
+        char buffer[kFastToBufferSize];                                      \
+        char* end = FormatValue(field->is_repeated() ?                       \
           reflection->GetRepeated##METHOD(message, field, index) :           \
-          reflection->Get##METHOD(message, field)));                         \
+          reflection->Get##METHOD(message, field), buffer);                  \
+        generator.PrintRaw(buffer, end - buffer);                            \
         break;                                                               \
+      }
 
-      OUTPUT_FIELD( INT32,  Int32, SimpleItoa);
-      OUTPUT_FIELD( INT64,  Int64, SimpleItoa);
-      OUTPUT_FIELD(UINT32, UInt32, SimpleItoa);
-      OUTPUT_FIELD(UINT64, UInt64, SimpleItoa);
-      OUTPUT_FIELD( FLOAT,  Float, SimpleFtoa);
-      OUTPUT_FIELD(DOUBLE, Double, SimpleDtoa);
+      OUTPUT_FIELD( INT32,  Int32);
+      OUTPUT_FIELD( INT64,  Int64);
+      OUTPUT_FIELD(UINT32, UInt32);
+      OUTPUT_FIELD(UINT64, UInt64);
+      OUTPUT_FIELD( FLOAT,  Float);
+      OUTPUT_FIELD(DOUBLE, Double);
 #undef OUTPUT_FIELD
 
       case FieldDescriptor::CPPTYPE_STRING: {
@@ -1058,29 +1330,25 @@ void TextFormat::Printer::PrintFieldValue(
               message, field, index, &scratch) :
             reflection->GetStringReference(message, field, &scratch);
 
-        generator.Print("\"");
-        if (utf8_string_escaping_) {
-          generator.Print(strings::Utf8SafeCEscape(value));
-        } else {
-          generator.Print(CEscape(value));
-        }
-        generator.Print("\"");
+        generator.PrintRaw("\"", 1);
+        generator.PrintCEscaped(value, utf8_string_escaping_);
+        generator.PrintRaw("\"", 1);
 
         break;
       }
 
       case FieldDescriptor::CPPTYPE_BOOL:
-        if (field->is_repeated()) {
-          generator.Print(reflection->GetRepeatedBool(message, field, index)
-                          ? "true" : "false");
+        if (field->is_repeated() ?
+                reflection->GetRepeatedBool(message, field, index) :
+                reflection->GetBool(message, field)) {
+          generator.PrintRaw("true", 4);
         } else {
-          generator.Print(reflection->GetBool(message, field)
-                          ? "true" : "false");
+          generator.PrintRaw("false", 5);
         }
         break;
 
       case FieldDescriptor::CPPTYPE_ENUM:
-        generator.Print(field->is_repeated() ?
+        generator.PrintRaw(field->is_repeated() ?
           reflection->GetRepeatedEnum(message, field, index)->name() :
           reflection->GetEnum(message, field)->name());
         break;
@@ -1146,19 +1414,23 @@ void TextFormat::Printer::PrintUnknownFields(
     const UnknownFieldSet& unknown_fields, TextGenerator& generator) {
   for (int i = 0; i < unknown_fields.field_count(); i++) {
     const UnknownField& field = unknown_fields.field(i);
-    string field_number = SimpleItoa(field.number());
+    char field_number[kFastToBufferSize];
+    FastInt32ToBufferLeft(field.number(), field_number);
 
     switch (field.type()) {
-      case UnknownField::TYPE_VARINT:
+      case UnknownField::TYPE_VARINT: {
         generator.Print(field_number);
         generator.Print(": ");
-        generator.Print(SimpleItoa(field.varint()));
+        char buffer[kFastToBufferSize];
+        FastUInt64ToBufferLeft(field.varint(), buffer);
+        generator.Print(buffer);
         if (single_line_mode_) {
           generator.Print(" ");
         } else {
           generator.Print("\n");
         }
         break;
+      }
       case UnknownField::TYPE_FIXED32: {
         generator.Print(field_number);
         generator.Print(": 0x");
@@ -1207,7 +1479,7 @@ void TextFormat::Printer::PrintUnknownFields(
           // This field is not parseable as a Message.
           // So it is probably just a plain string.
           generator.Print(": \"");
-          generator.Print(CEscape(value));
+          generator.PrintCEscaped(value, false);
           generator.Print("\"");
           if (single_line_mode_) {
             generator.Print(" ");
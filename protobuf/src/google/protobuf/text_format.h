@@ -39,6 +39,7 @@
 #define GOOGLE_PROTOBUF_TEXT_FORMAT_H__
 
 #include <string>
+#include <vector>
 #include <google/protobuf/message.h>
 #include <google/protobuf/descriptor.h>
 
@@ -145,10 +146,12 @@ class LIBPROTOBUF_EXPORT TextFormat {
     void Print(const Message& message,
                TextGenerator& generator);
 
-    // Print a single field.
+    // Print a single field.  field_tokens, if not NULL, holds the text
+    // which starts each field of the message's type (see text_format.cc).
     void PrintField(const Message& message,
                     const Reflection* reflection,
                     const FieldDescriptor* field,
+                    const vector<string>* field_tokens,
                     TextGenerator& generator);
 
     // Print a repeated primitive field in short form.
@@ -37,6 +37,8 @@
 #include <limits>
 
 #include <google/protobuf/text_format.h>
+#include <google/protobuf/descriptor.pb.h>
+#include <google/protobuf/dynamic_message.h>
 #include <google/protobuf/io/zero_copy_stream_impl.h>
 #include <google/protobuf/io/tokenizer.h>
 #include <google/protobuf/unittest.pb.h>
@@ -126,6 +128,38 @@ TEST_F(TextFormatExtensionsTest, Extensions) {
   EXPECT_EQ(proto_debug_string_, proto_.DebugString());
 }
 
+TEST_F(TextFormatTest, BasicToStream) {
+  // Print() goes through a ZeroCopyOutputStream rather than writing to the
+  // string directly, but must produce the same text.
+  TestUtil::SetAllFields(&proto_);
+  string text;
+  {
+    io::StringOutputStream output(&text);
+    EXPECT_TRUE(TextFormat::Print(proto_, &output));
+  }
+  EXPECT_EQ(proto_debug_string_, text);
+}
+
+TEST_F(TextFormatTest, DynamicMessage) {
+  // Types outside the generated pool are printed without the cached field
+  // names, but the same way.
+  DescriptorPool pool;
+  FileDescriptorProto file;
+  unittest_import::ImportMessage::descriptor()->file()->CopyTo(&file);
+  ASSERT_TRUE(pool.BuildFile(file) != NULL);
+  unittest::TestAllTypes::descriptor()->file()->CopyTo(&file);
+  ASSERT_TRUE(pool.BuildFile(file) != NULL);
+
+  DynamicMessageFactory factory;
+  scoped_ptr<Message> message(factory.GetPrototype(
+      pool.FindMessageTypeByName("protobuf_unittest.TestAllTypes"))->New());
+  TestUtil::SetAllFields(&proto_);
+  ASSERT_TRUE(message->ParseFromString(proto_.SerializeAsString()));
+
+  EXPECT_EQ(proto_debug_string_, message->DebugString());
+  EXPECT_EQ(proto_.ShortDebugString(), message->ShortDebugString());
+}
+
 TEST_F(TextFormatTest, ShortDebugString) {
   proto_.set_optional_int32(1);
   proto_.set_optional_string("hello");
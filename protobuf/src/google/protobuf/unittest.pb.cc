@@ -124,6 +124,9 @@ const ::google::protobuf::EnumDescriptor* TestDynamicExtensions_DynamicEnumType_
 const ::google::protobuf::Descriptor* TestRepeatedScalarDifferentTagSizes_descriptor_ = NULL;
 const ::google::protobuf::internal::GeneratedMessageReflection*
   TestRepeatedScalarDifferentTagSizes_reflection_ = NULL;
+const ::google::protobuf::Descriptor* TestLazyMessage_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  TestLazyMessage_reflection_ = NULL;
 const ::google::protobuf::Descriptor* FooRequest_descriptor_ = NULL;
 const ::google::protobuf::internal::GeneratedMessageReflection*
   FooRequest_reflection_ = NULL;
@@ -146,6 +149,7 @@ const ::google::protobuf::ServiceDescriptor* TestService_descriptor_ = NULL;
 
 void protobuf_AssignDesc_google_2fprotobuf_2funittest_2eproto() {
   protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();
+  protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto();
   const ::google::protobuf::FileDescriptor* file =
     ::google::protobuf::DescriptorPool::generated_pool()->FindFileByName(
       "google/protobuf/unittest.proto");
@@ -861,7 +865,25 @@ void protobuf_AssignDesc_google_2fprotobuf_2funittest_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(TestRepeatedScalarDifferentTagSizes));
-  FooRequest_descriptor_ = file->message_type(29);
+  TestLazyMessage_descriptor_ = file->message_type(29);
+  static const int TestLazyMessage_offsets_[4] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestLazyMessage, id_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestLazyMessage, lazy_child_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestLazyMessage, eager_child_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestLazyMessage, lazy_required_),
+  };
+  TestLazyMessage_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      TestLazyMessage_descriptor_,
+      TestLazyMessage::default_instance_,
+      TestLazyMessage_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestLazyMessage, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestLazyMessage, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(TestLazyMessage));
+  FooRequest_descriptor_ = file->message_type(30);
   static const int FooRequest_offsets_[1] = {
   };
   FooRequest_reflection_ =
@@ -875,7 +897,7 @@ void protobuf_AssignDesc_google_2fprotobuf_2funittest_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(FooRequest));
-  FooResponse_descriptor_ = file->message_type(30);
+  FooResponse_descriptor_ = file->message_type(31);
   static const int FooResponse_offsets_[1] = {
   };
   FooResponse_reflection_ =
@@ -889,7 +911,7 @@ void protobuf_AssignDesc_google_2fprotobuf_2funittest_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(FooResponse));
-  BarRequest_descriptor_ = file->message_type(31);
+  BarRequest_descriptor_ = file->message_type(32);
   static const int BarRequest_offsets_[1] = {
   };
   BarRequest_reflection_ =
@@ -903,7 +925,7 @@ void protobuf_AssignDesc_google_2fprotobuf_2funittest_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(BarRequest));
-  BarResponse_descriptor_ = file->message_type(32);
+  BarResponse_descriptor_ = file->message_type(33);
   static const int BarResponse_offsets_[1] = {
   };
   BarResponse_reflection_ =
@@ -1005,6 +1027,8 @@ void protobuf_RegisterTypes(const ::std::string&) {
     TestDynamicExtensions_DynamicMessageType_descriptor_, &TestDynamicExtensions_DynamicMessageType::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
     TestRepeatedScalarDifferentTagSizes_descriptor_, &TestRepeatedScalarDifferentTagSizes::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    TestLazyMessage_descriptor_, &TestLazyMessage::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
     FooRequest_descriptor_, &FooRequest::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
@@ -1090,6 +1114,8 @@ void protobuf_ShutdownFile_google_2fprotobuf_2funittest_2eproto() {
   delete TestDynamicExtensions_DynamicMessageType_reflection_;
   delete TestRepeatedScalarDifferentTagSizes::default_instance_;
   delete TestRepeatedScalarDifferentTagSizes_reflection_;
+  delete TestLazyMessage::default_instance_;
+  delete TestLazyMessage_reflection_;
   delete FooRequest::default_instance_;
   delete FooRequest_reflection_;
   delete FooResponse::default_instance_;
@@ -1100,404 +1126,8 @@ void protobuf_ShutdownFile_google_2fprotobuf_2funittest_2eproto() {
   delete BarResponse_reflection_;
 }
 
-void protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto() {
-  static bool already_here = false;
-  if (already_here) return;
-  already_here = true;
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  ::protobuf_unittest_import::protobuf_AddDesc_google_2fprotobuf_2funittest_5fimport_2eproto();
-  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-    "\n\036google/protobuf/unittest.proto\022\021protob"
-    "uf_unittest\032%google/protobuf/unittest_im"
-    "port.proto\"\273\025\n\014TestAllTypes\022\026\n\016optional_"
-    "int32\030\001 \001(\005\022\026\n\016optional_int64\030\002 \001(\003\022\027\n\017o"
-    "ptional_uint32\030\003 \001(\r\022\027\n\017optional_uint64\030"
-    "\004 \001(\004\022\027\n\017optional_sint32\030\005 \001(\021\022\027\n\017option"
-    "al_sint64\030\006 \001(\022\022\030\n\020optional_fixed32\030\007 \001("
-    "\007\022\030\n\020optional_fixed64\030\010 \001(\006\022\031\n\021optional_"
-    "sfixed32\030\t \001(\017\022\031\n\021optional_sfixed64\030\n \001("
-    "\020\022\026\n\016optional_float\030\013 \001(\002\022\027\n\017optional_do"
-    "uble\030\014 \001(\001\022\025\n\roptional_bool\030\r \001(\010\022\027\n\017opt"
-    "ional_string\030\016 \001(\t\022\026\n\016optional_bytes\030\017 \001"
-    "(\014\022D\n\roptionalgroup\030\020 \001(\n2-.protobuf_uni"
-    "ttest.TestAllTypes.OptionalGroup\022N\n\027opti"
-    "onal_nested_message\030\022 \001(\0132-.protobuf_uni"
-    "ttest.TestAllTypes.NestedMessage\022C\n\030opti"
-    "onal_foreign_message\030\023 \001(\0132!.protobuf_un"
-    "ittest.ForeignMessage\022H\n\027optional_import"
-    "_message\030\024 \001(\0132\'.protobuf_unittest_impor"
-    "t.ImportMessage\022H\n\024optional_nested_enum\030"
-    "\025 \001(\0162*.protobuf_unittest.TestAllTypes.N"
-    "estedEnum\022=\n\025optional_foreign_enum\030\026 \001(\016"
-    "2\036.protobuf_unittest.ForeignEnum\022B\n\024opti"
-    "onal_import_enum\030\027 \001(\0162$.protobuf_unitte"
-    "st_import.ImportEnum\022!\n\025optional_string_"
-    "piece\030\030 \001(\tB\002\010\002\022\031\n\roptional_cord\030\031 \001(\tB\002"
-    "\010\001\022\026\n\016repeated_int32\030\037 \003(\005\022\026\n\016repeated_i"
-    "nt64\030  \003(\003\022\027\n\017repeated_uint32\030! \003(\r\022\027\n\017r"
-    "epeated_uint64\030\" \003(\004\022\027\n\017repeated_sint32\030"
-    "# \003(\021\022\027\n\017repeated_sint64\030$ \003(\022\022\030\n\020repeat"
-    "ed_fixed32\030% \003(\007\022\030\n\020repeated_fixed64\030& \003"
-    "(\006\022\031\n\021repeated_sfixed32\030\' \003(\017\022\031\n\021repeate"
-    "d_sfixed64\030( \003(\020\022\026\n\016repeated_float\030) \003(\002"
-    "\022\027\n\017repeated_double\030* \003(\001\022\025\n\rrepeated_bo"
-    "ol\030+ \003(\010\022\027\n\017repeated_string\030, \003(\t\022\026\n\016rep"
-    "eated_bytes\030- \003(\014\022D\n\rrepeatedgroup\030. \003(\n"
-    "2-.protobuf_unittest.TestAllTypes.Repeat"
-    "edGroup\022N\n\027repeated_nested_message\0300 \003(\013"
-    "2-.protobuf_unittest.TestAllTypes.Nested"
-    "Message\022C\n\030repeated_foreign_message\0301 \003("
-    "\0132!.protobuf_unittest.ForeignMessage\022H\n\027"
-    "repeated_import_message\0302 \003(\0132\'.protobuf"
-    "_unittest_import.ImportMessage\022H\n\024repeat"
-    "ed_nested_enum\0303 \003(\0162*.protobuf_unittest"
-    ".TestAllTypes.NestedEnum\022=\n\025repeated_for"
-    "eign_enum\0304 \003(\0162\036.protobuf_unittest.Fore"
-    "ignEnum\022B\n\024repeated_import_enum\0305 \003(\0162$."
-    "protobuf_unittest_import.ImportEnum\022!\n\025r"
-    "epeated_string_piece\0306 \003(\tB\002\010\002\022\031\n\rrepeat"
-    "ed_cord\0307 \003(\tB\002\010\001\022\031\n\rdefault_int32\030= \001(\005"
-    ":\00241\022\031\n\rdefault_int64\030> \001(\003:\00242\022\032\n\016defau"
-    "lt_uint32\030? \001(\r:\00243\022\032\n\016default_uint64\030@ "
-    "\001(\004:\00244\022\033\n\016default_sint32\030A \001(\021:\003-45\022\032\n\016"
-    "default_sint64\030B \001(\022:\00246\022\033\n\017default_fixe"
-    "d32\030C \001(\007:\00247\022\033\n\017default_fixed64\030D \001(\006:\002"
-    "48\022\034\n\020default_sfixed32\030E \001(\017:\00249\022\035\n\020defa"
-    "ult_sfixed64\030F \001(\020:\003-50\022\033\n\rdefault_float"
-    "\030G \001(\002:\00451.5\022\035\n\016default_double\030H \001(\001:\00552"
-    "000\022\032\n\014default_bool\030I \001(\010:\004true\022\035\n\016defau"
-    "lt_string\030J \001(\t:\005hello\022\034\n\rdefault_bytes\030"
-    "K \001(\014:\005world\022L\n\023default_nested_enum\030Q \001("
-    "\0162*.protobuf_unittest.TestAllTypes.Neste"
-    "dEnum:\003BAR\022I\n\024default_foreign_enum\030R \001(\016"
-    "2\036.protobuf_unittest.ForeignEnum:\013FOREIG"
-    "N_BAR\022M\n\023default_import_enum\030S \001(\0162$.pro"
-    "tobuf_unittest_import.ImportEnum:\nIMPORT"
-    "_BAR\022%\n\024default_string_piece\030T \001(\t:\003abcB"
-    "\002\010\002\022\035\n\014default_cord\030U \001(\t:\003123B\002\010\001\032\033\n\rNe"
-    "stedMessage\022\n\n\002bb\030\001 \001(\005\032\032\n\rOptionalGroup"
-    "\022\t\n\001a\030\021 \001(\005\032\032\n\rRepeatedGroup\022\t\n\001a\030/ \001(\005\""
-    "\'\n\nNestedEnum\022\007\n\003FOO\020\001\022\007\n\003BAR\020\002\022\007\n\003BAZ\020\003"
-    "\"4\n\024TestDeprecatedFields\022\034\n\020deprecated_i"
-    "nt32\030\001 \001(\005B\002\030\001\"\033\n\016ForeignMessage\022\t\n\001c\030\001 "
-    "\001(\005\"\035\n\021TestAllExtensions*\010\010\001\020\200\200\200\200\002\"$\n\027Op"
-    "tionalGroup_extension\022\t\n\001a\030\021 \001(\005\"$\n\027Repe"
-    "atedGroup_extension\022\t\n\001a\030/ \001(\005\"P\n\023TestNe"
-    "stedExtension29\n\004test\022$.protobuf_unittes"
-    "t.TestAllExtensions\030\352\007 \001(\t:\004test\"\325\005\n\014Tes"
-    "tRequired\022\t\n\001a\030\001 \002(\005\022\016\n\006dummy2\030\002 \001(\005\022\t\n\001"
-    "b\030\003 \002(\005\022\016\n\006dummy4\030\004 \001(\005\022\016\n\006dummy5\030\005 \001(\005\022"
-    "\016\n\006dummy6\030\006 \001(\005\022\016\n\006dummy7\030\007 \001(\005\022\016\n\006dummy"
-    "8\030\010 \001(\005\022\016\n\006dummy9\030\t \001(\005\022\017\n\007dummy10\030\n \001(\005"
-    "\022\017\n\007dummy11\030\013 \001(\005\022\017\n\007dummy12\030\014 \001(\005\022\017\n\007du"
-    "mmy13\030\r \001(\005\022\017\n\007dummy14\030\016 \001(\005\022\017\n\007dummy15\030"
-    "\017 \001(\005\022\017\n\007dummy16\030\020 \001(\005\022\017\n\007dummy17\030\021 \001(\005\022"
-    "\017\n\007dummy18\030\022 \001(\005\022\017\n\007dummy19\030\023 \001(\005\022\017\n\007dum"
-    "my20\030\024 \001(\005\022\017\n\007dummy21\030\025 \001(\005\022\017\n\007dummy22\030\026"
-    " \001(\005\022\017\n\007dummy23\030\027 \001(\005\022\017\n\007dummy24\030\030 \001(\005\022\017"
-    "\n\007dummy25\030\031 \001(\005\022\017\n\007dummy26\030\032 \001(\005\022\017\n\007dumm"
-    "y27\030\033 \001(\005\022\017\n\007dummy28\030\034 \001(\005\022\017\n\007dummy29\030\035 "
-    "\001(\005\022\017\n\007dummy30\030\036 \001(\005\022\017\n\007dummy31\030\037 \001(\005\022\017\n"
-    "\007dummy32\030  \001(\005\022\t\n\001c\030! \002(\0052V\n\006single\022$.pr"
-    "otobuf_unittest.TestAllExtensions\030\350\007 \001(\013"
-    "2\037.protobuf_unittest.TestRequired2U\n\005mul"
-    "ti\022$.protobuf_unittest.TestAllExtensions"
-    "\030\351\007 \003(\0132\037.protobuf_unittest.TestRequired"
-    "\"\232\001\n\023TestRequiredForeign\0229\n\020optional_mes"
-    "sage\030\001 \001(\0132\037.protobuf_unittest.TestRequi"
-    "red\0229\n\020repeated_message\030\002 \003(\0132\037.protobuf"
-    "_unittest.TestRequired\022\r\n\005dummy\030\003 \001(\005\"Z\n"
-    "\021TestForeignNested\022E\n\016foreign_nested\030\001 \001"
-    "(\0132-.protobuf_unittest.TestAllTypes.Nest"
-    "edMessage\"\022\n\020TestEmptyMessage\"*\n\036TestEmp"
-    "tyMessageWithExtensions*\010\010\001\020\200\200\200\200\002\"7\n\033Tes"
-    "tMultipleExtensionRanges*\004\010*\020+*\006\010\257 \020\224!*\n"
-    "\010\200\200\004\020\200\200\200\200\002\"4\n\030TestReallyLargeTagNumber\022\t"
-    "\n\001a\030\001 \001(\005\022\r\n\002bb\030\377\377\377\177 \001(\005\"U\n\024TestRecursiv"
-    "eMessage\0222\n\001a\030\001 \001(\0132\'.protobuf_unittest."
-    "TestRecursiveMessage\022\t\n\001i\030\002 \001(\005\"K\n\024TestM"
-    "utualRecursionA\0223\n\002bb\030\001 \001(\0132\'.protobuf_u"
-    "nittest.TestMutualRecursionB\"b\n\024TestMutu"
-    "alRecursionB\0222\n\001a\030\001 \001(\0132\'.protobuf_unitt"
-    "est.TestMutualRecursionA\022\026\n\016optional_int"
-    "32\030\002 \001(\005\"\263\001\n\022TestDupFieldNumber\022\t\n\001a\030\001 \001"
-    "(\005\0226\n\003foo\030\002 \001(\n2).protobuf_unittest.Test"
-    "DupFieldNumber.Foo\0226\n\003bar\030\003 \001(\n2).protob"
-    "uf_unittest.TestDupFieldNumber.Bar\032\020\n\003Fo"
-    "o\022\t\n\001a\030\001 \001(\005\032\020\n\003Bar\022\t\n\001a\030\001 \001(\005\"\200\002\n\030TestN"
-    "estedMessageHasBits\022Z\n\027optional_nested_m"
-    "essage\030\001 \001(\01329.protobuf_unittest.TestNes"
-    "tedMessageHasBits.NestedMessage\032\207\001\n\rNest"
-    "edMessage\022$\n\034nestedmessage_repeated_int3"
-    "2\030\001 \003(\005\022P\n%nestedmessage_repeated_foreig"
-    "nmessage\030\002 \003(\0132!.protobuf_unittest.Forei"
-    "gnMessage\"\345\003\n\027TestCamelCaseFieldNames\022\026\n"
-    "\016PrimitiveField\030\001 \001(\005\022\023\n\013StringField\030\002 \001"
-    "(\t\0221\n\tEnumField\030\003 \001(\0162\036.protobuf_unittes"
-    "t.ForeignEnum\0227\n\014MessageField\030\004 \001(\0132!.pr"
-    "otobuf_unittest.ForeignMessage\022\034\n\020String"
-    "PieceField\030\005 \001(\tB\002\010\002\022\025\n\tCordField\030\006 \001(\tB"
-    "\002\010\001\022\036\n\026RepeatedPrimitiveField\030\007 \003(\005\022\033\n\023R"
-    "epeatedStringField\030\010 \003(\t\0229\n\021RepeatedEnum"
-    "Field\030\t \003(\0162\036.protobuf_unittest.ForeignE"
-    "num\022?\n\024RepeatedMessageField\030\n \003(\0132!.prot"
-    "obuf_unittest.ForeignMessage\022$\n\030Repeated"
-    "StringPieceField\030\013 \003(\tB\002\010\002\022\035\n\021RepeatedCo"
-    "rdField\030\014 \003(\tB\002\010\001\"U\n\022TestFieldOrderings\022"
-    "\021\n\tmy_string\030\013 \001(\t\022\016\n\006my_int\030\001 \001(\003\022\020\n\010my"
-    "_float\030e \001(\002*\004\010\002\020\013*\004\010\014\020e\"\364\004\n\030TestExtreme"
-    "DefaultValues\022?\n\rescaped_bytes\030\001 \001(\014:(\\0"
-    "00\\001\\007\\010\\014\\n\\r\\t\\013\\\\\\\'\\\"\\376\022 "
-    "\n\014large_uint32\030\002 \001(\r:\n4294967295\022*\n\014larg"
-    "e_uint64\030\003 \001(\004:\02418446744073709551615\022 \n\013"
-    "small_int32\030\004 \001(\005:\013-2147483647\022)\n\013small_"
-    "int64\030\005 \001(\003:\024-9223372036854775807\022\030\n\013utf"
-    "8_string\030\006 \001(\t:\003\341\210\264\022\025\n\nzero_float\030\007 \001(\002:"
-    "\0010\022\024\n\tone_float\030\010 \001(\002:\0011\022\030\n\013small_float\030"
-    "\t \001(\002:\0031.5\022\036\n\022negative_one_float\030\n \001(\002:\002"
-    "-1\022\034\n\016negative_float\030\013 \001(\002:\004-1.5\022\032\n\013larg"
-    "e_float\030\014 \001(\002:\0052e+08\022$\n\024small_negative_f"
-    "loat\030\r \001(\002:\006-8e-28\022\027\n\ninf_double\030\016 \001(\001:\003"
-    "inf\022\034\n\016neg_inf_double\030\017 \001(\001:\004-inf\022\027\n\nnan"
-    "_double\030\020 \001(\001:\003nan\022\026\n\tinf_float\030\021 \001(\002:\003i"
-    "nf\022\033\n\rneg_inf_float\030\022 \001(\002:\004-inf\022\026\n\tnan_f"
-    "loat\030\023 \001(\002:\003nan\"\031\n\tOneString\022\014\n\004data\030\001 \001"
-    "(\t\"\030\n\010OneBytes\022\014\n\004data\030\001 \001(\014\"\252\003\n\017TestPac"
-    "kedTypes\022\030\n\014packed_int32\030Z \003(\005B\002\020\001\022\030\n\014pa"
-    "cked_int64\030[ \003(\003B\002\020\001\022\031\n\rpacked_uint32\030\\ "
-    "\003(\rB\002\020\001\022\031\n\rpacked_uint64\030] \003(\004B\002\020\001\022\031\n\rpa"
-    "cked_sint32\030^ \003(\021B\002\020\001\022\031\n\rpacked_sint64\030_"
-    " \003(\022B\002\020\001\022\032\n\016packed_fixed32\030` \003(\007B\002\020\001\022\032\n\016"
-    "packed_fixed64\030a \003(\006B\002\020\001\022\033\n\017packed_sfixe"
-    "d32\030b \003(\017B\002\020\001\022\033\n\017packed_sfixed64\030c \003(\020B\002"
-    "\020\001\022\030\n\014packed_float\030d \003(\002B\002\020\001\022\031\n\rpacked_d"
-    "ouble\030e \003(\001B\002\020\001\022\027\n\013packed_bool\030f \003(\010B\002\020\001"
-    "\0227\n\013packed_enum\030g \003(\0162\036.protobuf_unittes"
-    "t.ForeignEnumB\002\020\001\"\310\003\n\021TestUnpackedTypes\022"
-    "\032\n\016unpacked_int32\030Z \003(\005B\002\020\000\022\032\n\016unpacked_"
-    "int64\030[ \003(\003B\002\020\000\022\033\n\017unpacked_uint32\030\\ \003(\r"
-    "B\002\020\000\022\033\n\017unpacked_uint64\030] \003(\004B\002\020\000\022\033\n\017unp"
-    "acked_sint32\030^ \003(\021B\002\020\000\022\033\n\017unpacked_sint6"
-    "4\030_ \003(\022B\002\020\000\022\034\n\020unpacked_fixed32\030` \003(\007B\002\020"
-    "\000\022\034\n\020unpacked_fixed64\030a \003(\006B\002\020\000\022\035\n\021unpac"
-    "ked_sfixed32\030b \003(\017B\002\020\000\022\035\n\021unpacked_sfixe"
-    "d64\030c \003(\020B\002\020\000\022\032\n\016unpacked_float\030d \003(\002B\002\020"
-    "\000\022\033\n\017unpacked_double\030e \003(\001B\002\020\000\022\031\n\runpack"
-    "ed_bool\030f \003(\010B\002\020\000\0229\n\runpacked_enum\030g \003(\016"
-    "2\036.protobuf_unittest.ForeignEnumB\002\020\000\" \n\024"
-    "TestPackedExtensions*\010\010\001\020\200\200\200\200\002\"\231\004\n\025TestD"
-    "ynamicExtensions\022\031\n\020scalar_extension\030\320\017 "
-    "\001(\007\0227\n\016enum_extension\030\321\017 \001(\0162\036.protobuf_"
-    "unittest.ForeignEnum\022Y\n\026dynamic_enum_ext"
-    "ension\030\322\017 \001(\01628.protobuf_unittest.TestDy"
-    "namicExtensions.DynamicEnumType\022=\n\021messa"
-    "ge_extension\030\323\017 \001(\0132!.protobuf_unittest."
-    "ForeignMessage\022_\n\031dynamic_message_extens"
-    "ion\030\324\017 \001(\0132;.protobuf_unittest.TestDynam"
-    "icExtensions.DynamicMessageType\022\033\n\022repea"
-    "ted_extension\030\325\017 \003(\t\022\035\n\020packed_extension"
-    "\030\326\017 \003(\021B\002\020\001\032,\n\022DynamicMessageType\022\026\n\rdyn"
-    "amic_field\030\264\020 \001(\005\"G\n\017DynamicEnumType\022\020\n\013"
-    "DYNAMIC_FOO\020\230\021\022\020\n\013DYNAMIC_BAR\020\231\021\022\020\n\013DYNA"
-    "MIC_BAZ\020\232\021\"\300\001\n#TestRepeatedScalarDiffere"
-    "ntTagSizes\022\030\n\020repeated_fixed32\030\014 \003(\007\022\026\n\016"
-    "repeated_int32\030\r \003(\005\022\031\n\020repeated_fixed64"
-    "\030\376\017 \003(\006\022\027\n\016repeated_int64\030\377\017 \003(\003\022\030\n\016repe"
-    "ated_float\030\376\377\017 \003(\002\022\031\n\017repeated_uint64\030\377\377"
-    "\017 \003(\004\"\014\n\nFooRequest\"\r\n\013FooResponse\"\014\n\nBa"
-    "rRequest\"\r\n\013BarResponse*@\n\013ForeignEnum\022\017"
-    "\n\013FOREIGN_FOO\020\004\022\017\n\013FOREIGN_BAR\020\005\022\017\n\013FORE"
-    "IGN_BAZ\020\006*G\n\024TestEnumWithDupValue\022\010\n\004FOO"
-    "1\020\001\022\010\n\004BAR1\020\002\022\007\n\003BAZ\020\003\022\010\n\004FOO2\020\001\022\010\n\004BAR2"
-    "\020\002*\211\001\n\016TestSparseEnum\022\014\n\010SPARSE_A\020{\022\016\n\010S"
-    "PARSE_B\020\246\347\003\022\017\n\010SPARSE_C\020\262\261\200\006\022\025\n\010SPARSE_D"
-    "\020\361\377\377\377\377\377\377\377\377\001\022\025\n\010SPARSE_E\020\264\336\374\377\377\377\377\377\377\001\022\014\n\010SP"
-    "ARSE_F\020\000\022\014\n\010SPARSE_G\020\0022\231\001\n\013TestService\022D"
-    "\n\003Foo\022\035.protobuf_unittest.FooRequest\032\036.p"
-    "rotobuf_unittest.FooResponse\022D\n\003Bar\022\035.pr"
-    "otobuf_unittest.BarRequest\032\036.protobuf_un"
-    "ittest.BarResponse:F\n\030optional_int32_ext"
-    "ension\022$.protobuf_unittest.TestAllExtens"
-    "ions\030\001 \001(\005:F\n\030optional_int64_extension\022$"
-    ".protobuf_unittest.TestAllExtensions\030\002 \001"
-    "(\003:G\n\031optional_uint32_extension\022$.protob"
-    "uf_unittest.TestAllExtensions\030\003 \001(\r:G\n\031o"
-    "ptional_uint64_extension\022$.protobuf_unit"
-    "test.TestAllExtensions\030\004 \001(\004:G\n\031optional"
-    "_sint32_extension\022$.protobuf_unittest.Te"
-    "stAllExtensions\030\005 \001(\021:G\n\031optional_sint64"
-    "_extension\022$.protobuf_unittest.TestAllEx"
-    "tensions\030\006 \001(\022:H\n\032optional_fixed32_exten"
-    "sion\022$.protobuf_unittest.TestAllExtensio"
-    "ns\030\007 \001(\007:H\n\032optional_fixed64_extension\022$"
-    ".protobuf_unittest.TestAllExtensions\030\010 \001"
-    "(\006:I\n\033optional_sfixed32_extension\022$.prot"
-    "obuf_unittest.TestAllExtensions\030\t \001(\017:I\n"
-    "\033optional_sfixed64_extension\022$.protobuf_"
-    "unittest.TestAllExtensions\030\n \001(\020:F\n\030opti"
-    "onal_float_extension\022$.protobuf_unittest"
-    ".TestAllExtensions\030\013 \001(\002:G\n\031optional_dou"
-    "ble_extension\022$.protobuf_unittest.TestAl"
-    "lExtensions\030\014 \001(\001:E\n\027optional_bool_exten"
-    "sion\022$.protobuf_unittest.TestAllExtensio"
-    "ns\030\r \001(\010:G\n\031optional_string_extension\022$."
-    "protobuf_unittest.TestAllExtensions\030\016 \001("
-    "\t:F\n\030optional_bytes_extension\022$.protobuf"
-    "_unittest.TestAllExtensions\030\017 \001(\014:q\n\027opt"
-    "ionalgroup_extension\022$.protobuf_unittest"
-    ".TestAllExtensions\030\020 \001(\n2*.protobuf_unit"
-    "test.OptionalGroup_extension:~\n!optional"
-    "_nested_message_extension\022$.protobuf_uni"
-    "ttest.TestAllExtensions\030\022 \001(\0132-.protobuf"
-    "_unittest.TestAllTypes.NestedMessage:s\n\""
-    "optional_foreign_message_extension\022$.pro"
-    "tobuf_unittest.TestAllExtensions\030\023 \001(\0132!"
-    ".protobuf_unittest.ForeignMessage:x\n!opt"
-    "ional_import_message_extension\022$.protobu"
-    "f_unittest.TestAllExtensions\030\024 \001(\0132\'.pro"
-    "tobuf_unittest_import.ImportMessage:x\n\036o"
-    "ptional_nested_enum_extension\022$.protobuf"
-    "_unittest.TestAllExtensions\030\025 \001(\0162*.prot"
-    "obuf_unittest.TestAllTypes.NestedEnum:m\n"
-    "\037optional_foreign_enum_extension\022$.proto"
-    "buf_unittest.TestAllExtensions\030\026 \001(\0162\036.p"
-    "rotobuf_unittest.ForeignEnum:r\n\036optional"
-    "_import_enum_extension\022$.protobuf_unitte"
-    "st.TestAllExtensions\030\027 \001(\0162$.protobuf_un"
-    "ittest_import.ImportEnum:Q\n\037optional_str"
-    "ing_piece_extension\022$.protobuf_unittest."
-    "TestAllExtensions\030\030 \001(\tB\002\010\002:I\n\027optional_"
-    "cord_extension\022$.protobuf_unittest.TestA"
-    "llExtensions\030\031 \001(\tB\002\010\001:F\n\030repeated_int32"
-    "_extension\022$.protobuf_unittest.TestAllEx"
-    "tensions\030\037 \003(\005:F\n\030repeated_int64_extensi"
-    "on\022$.protobuf_unittest.TestAllExtensions"
-    "\030  \003(\003:G\n\031repeated_uint32_extension\022$.pr"
-    "otobuf_unittest.TestAllExtensions\030! \003(\r:"
-    "G\n\031repeated_uint64_extension\022$.protobuf_"
-    "unittest.TestAllExtensions\030\" \003(\004:G\n\031repe"
-    "ated_sint32_extension\022$.protobuf_unittes"
-    "t.TestAllExtensions\030# \003(\021:G\n\031repeated_si"
-    "nt64_extension\022$.protobuf_unittest.TestA"
-    "llExtensions\030$ \003(\022:H\n\032repeated_fixed32_e"
-    "xtension\022$.protobuf_unittest.TestAllExte"
-    "nsions\030% \003(\007:H\n\032repeated_fixed64_extensi"
-    "on\022$.protobuf_unittest.TestAllExtensions"
-    "\030& \003(\006:I\n\033repeated_sfixed32_extension\022$."
-    "protobuf_unittest.TestAllExtensions\030\' \003("
-    "\017:I\n\033repeated_sfixed64_extension\022$.proto"
-    "buf_unittest.TestAllExtensions\030( \003(\020:F\n\030"
-    "repeated_float_extension\022$.protobuf_unit"
-    "test.TestAllExtensions\030) \003(\002:G\n\031repeated"
-    "_double_extension\022$.protobuf_unittest.Te"
-    "stAllExtensions\030* \003(\001:E\n\027repeated_bool_e"
-    "xtension\022$.protobuf_unittest.TestAllExte"
-    "nsions\030+ \003(\010:G\n\031repeated_string_extensio"
-    "n\022$.protobuf_unittest.TestAllExtensions\030"
-    ", \003(\t:F\n\030repeated_bytes_extension\022$.prot"
-    "obuf_unittest.TestAllExtensions\030- \003(\014:q\n"
-    "\027repeatedgroup_extension\022$.protobuf_unit"
-    "test.TestAllExtensions\030. \003(\n2*.protobuf_"
-    "unittest.RepeatedGroup_extension:~\n!repe"
-    "ated_nested_message_extension\022$.protobuf"
-    "_unittest.TestAllExtensions\0300 \003(\0132-.prot"
-    "obuf_unittest.TestAllTypes.NestedMessage"
-    ":s\n\"repeated_foreign_message_extension\022$"
-    ".protobuf_unittest.TestAllExtensions\0301 \003"
-    "(\0132!.protobuf_unittest.ForeignMessage:x\n"
-    "!repeated_import_message_extension\022$.pro"
-    "tobuf_unittest.TestAllExtensions\0302 \003(\0132\'"
-    ".protobuf_unittest_import.ImportMessage:"
-    "x\n\036repeated_nested_enum_extension\022$.prot"
-    "obuf_unittest.TestAllExtensions\0303 \003(\0162*."
-    "protobuf_unittest.TestAllTypes.NestedEnu"
-    "m:m\n\037repeated_foreign_enum_extension\022$.p"
-    "rotobuf_unittest.TestAllExtensions\0304 \003(\016"
-    "2\036.protobuf_unittest.ForeignEnum:r\n\036repe"
-    "ated_import_enum_extension\022$.protobuf_un"
-    "ittest.TestAllExtensions\0305 \003(\0162$.protobu"
-    "f_unittest_import.ImportEnum:Q\n\037repeated"
-    "_string_piece_extension\022$.protobuf_unitt"
-    "est.TestAllExtensions\0306 \003(\tB\002\010\002:I\n\027repea"
-    "ted_cord_extension\022$.protobuf_unittest.T"
-    "estAllExtensions\0307 \003(\tB\002\010\001:I\n\027default_in"
-    "t32_extension\022$.protobuf_unittest.TestAl"
-    "lExtensions\030= \001(\005:\00241:I\n\027default_int64_e"
-    "xtension\022$.protobuf_unittest.TestAllExte"
-    "nsions\030> \001(\003:\00242:J\n\030default_uint32_exten"
-    "sion\022$.protobuf_unittest.TestAllExtensio"
-    "ns\030? \001(\r:\00243:J\n\030default_uint64_extension"
-    "\022$.protobuf_unittest.TestAllExtensions\030@"
-    " \001(\004:\00244:K\n\030default_sint32_extension\022$.p"
-    "rotobuf_unittest.TestAllExtensions\030A \001(\021"
-    ":\003-45:J\n\030default_sint64_extension\022$.prot"
-    "obuf_unittest.TestAllExtensions\030B \001(\022:\0024"
-    "6:K\n\031default_fixed32_extension\022$.protobu"
-    "f_unittest.TestAllExtensions\030C \001(\007:\00247:K"
-    "\n\031default_fixed64_extension\022$.protobuf_u"
-    "nittest.TestAllExtensions\030D \001(\006:\00248:L\n\032d"
-    "efault_sfixed32_extension\022$.protobuf_uni"
-    "ttest.TestAllExtensions\030E \001(\017:\00249:M\n\032def"
-    "ault_sfixed64_extension\022$.protobuf_unitt"
-    "est.TestAllExtensions\030F \001(\020:\003-50:K\n\027defa"
-    "ult_float_extension\022$.protobuf_unittest."
-    "TestAllExtensions\030G \001(\002:\00451.5:M\n\030default"
-    "_double_extension\022$.protobuf_unittest.Te"
-    "stAllExtensions\030H \001(\001:\00552000:J\n\026default_"
-    "bool_extension\022$.protobuf_unittest.TestA"
-    "llExtensions\030I \001(\010:\004true:M\n\030default_stri"
-    "ng_extension\022$.protobuf_unittest.TestAll"
-    "Extensions\030J \001(\t:\005hello:L\n\027default_bytes"
-    "_extension\022$.protobuf_unittest.TestAllEx"
-    "tensions\030K \001(\014:\005world:|\n\035default_nested_"
-    "enum_extension\022$.protobuf_unittest.TestA"
-    "llExtensions\030Q \001(\0162*.protobuf_unittest.T"
-    "estAllTypes.NestedEnum:\003BAR:y\n\036default_f"
-    "oreign_enum_extension\022$.protobuf_unittes"
-    "t.TestAllExtensions\030R \001(\0162\036.protobuf_uni"
-    "ttest.ForeignEnum:\013FOREIGN_BAR:}\n\035defaul"
-    "t_import_enum_extension\022$.protobuf_unitt"
-    "est.TestAllExtensions\030S \001(\0162$.protobuf_u"
-    "nittest_import.ImportEnum:\nIMPORT_BAR:U\n"
-    "\036default_string_piece_extension\022$.protob"
-    "uf_unittest.TestAllExtensions\030T \001(\t:\003abc"
-    "B\002\010\002:M\n\026default_cord_extension\022$.protobu"
-    "f_unittest.TestAllExtensions\030U \001(\t:\003123B"
-    "\002\010\001:B\n\023my_extension_string\022%.protobuf_un"
-    "ittest.TestFieldOrderings\0302 \001(\t:?\n\020my_ex"
-    "tension_int\022%.protobuf_unittest.TestFiel"
-    "dOrderings\030\005 \001(\005:K\n\026packed_int32_extensi"
-    "on\022\'.protobuf_unittest.TestPackedExtensi"
-    "ons\030Z \003(\005B\002\020\001:K\n\026packed_int64_extension\022"
-    "\'.protobuf_unittest.TestPackedExtensions"
-    "\030[ \003(\003B\002\020\001:L\n\027packed_uint32_extension\022\'."
-    "protobuf_unittest.TestPackedExtensions\030\\"
-    " \003(\rB\002\020\001:L\n\027packed_uint64_extension\022\'.pr"
-    "otobuf_unittest.TestPackedExtensions\030] \003"
-    "(\004B\002\020\001:L\n\027packed_sint32_extension\022\'.prot"
-    "obuf_unittest.TestPackedExtensions\030^ \003(\021"
-    "B\002\020\001:L\n\027packed_sint64_extension\022\'.protob"
-    "uf_unittest.TestPackedExtensions\030_ \003(\022B\002"
-    "\020\001:M\n\030packed_fixed32_extension\022\'.protobu"
-    "f_unittest.TestPackedExtensions\030` \003(\007B\002\020"
-    "\001:M\n\030packed_fixed64_extension\022\'.protobuf"
-    "_unittest.TestPackedExtensions\030a \003(\006B\002\020\001"
-    ":N\n\031packed_sfixed32_extension\022\'.protobuf"
-    "_unittest.TestPackedExtensions\030b \003(\017B\002\020\001"
-    ":N\n\031packed_sfixed64_extension\022\'.protobuf"
-    "_unittest.TestPackedExtensions\030c \003(\020B\002\020\001"
-    ":K\n\026packed_float_extension\022\'.protobuf_un"
-    "ittest.TestPackedExtensions\030d \003(\002B\002\020\001:L\n"
-    "\027packed_double_extension\022\'.protobuf_unit"
-    "test.TestPackedExtensions\030e \003(\001B\002\020\001:J\n\025p"
-    "acked_bool_extension\022\'.protobuf_unittest"
-    ".TestPackedExtensions\030f \003(\010B\002\020\001:j\n\025packe"
-    "d_enum_extension\022\'.protobuf_unittest.Tes"
-    "tPackedExtensions\030g \003(\0162\036.protobuf_unitt"
-    "est.ForeignEnumB\002\020\001B\021B\rUnittestProtoH\001", 15518);
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
-    "google/protobuf/unittest.proto", &protobuf_RegisterTypes);
+void protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto_impl() {
+  ::protobuf_unittest_import::protobuf_InitDefaults_google_2fprotobuf_2funittest_5fimport_2eproto();
   TestAllTypes::default_instance_ = new TestAllTypes();
   TestAllTypes_NestedMessage::default_instance_ = new TestAllTypes_NestedMessage();
   TestAllTypes_OptionalGroup::default_instance_ = new TestAllTypes_OptionalGroup();
@@ -1534,278 +1164,279 @@ void protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto() {
   TestDynamicExtensions::default_instance_ = new TestDynamicExtensions();
   TestDynamicExtensions_DynamicMessageType::default_instance_ = new TestDynamicExtensions_DynamicMessageType();
   TestRepeatedScalarDifferentTagSizes::default_instance_ = new TestRepeatedScalarDifferentTagSizes();
+  TestLazyMessage::default_instance_ = new TestLazyMessage();
   FooRequest::default_instance_ = new FooRequest();
   FooResponse::default_instance_ = new FooResponse();
   BarRequest::default_instance_ = new BarRequest();
   BarResponse::default_instance_ = new BarResponse();
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     1, 5, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     2, 3, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     3, 13, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     4, 4, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     5, 17, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     6, 18, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     7, 7, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     8, 6, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     9, 15, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     10, 16, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     11, 2, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     12, 1, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     13, 8, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     14, 9, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     15, 12, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterMessageExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     16, 10, false, false,
-    &::protobuf_unittest::OptionalGroup_extension::default_instance());
+    ::protobuf_unittest::OptionalGroup_extension::internal_default_instance());
   ::google::protobuf::internal::ExtensionSet::RegisterMessageExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     18, 11, false, false,
-    &::protobuf_unittest::TestAllTypes_NestedMessage::default_instance());
+    ::protobuf_unittest::TestAllTypes_NestedMessage::internal_default_instance());
   ::google::protobuf::internal::ExtensionSet::RegisterMessageExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     19, 11, false, false,
-    &::protobuf_unittest::ForeignMessage::default_instance());
+    ::protobuf_unittest::ForeignMessage::internal_default_instance());
   ::google::protobuf::internal::ExtensionSet::RegisterMessageExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     20, 11, false, false,
-    &::protobuf_unittest_import::ImportMessage::default_instance());
+    ::protobuf_unittest_import::ImportMessage::internal_default_instance());
   ::google::protobuf::internal::ExtensionSet::RegisterEnumExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     21, 14, false, false,
     &::protobuf_unittest::TestAllTypes_NestedEnum_IsValid);
   ::google::protobuf::internal::ExtensionSet::RegisterEnumExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     22, 14, false, false,
     &protobuf_unittest::ForeignEnum_IsValid);
   ::google::protobuf::internal::ExtensionSet::RegisterEnumExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     23, 14, false, false,
     &protobuf_unittest_import::ImportEnum_IsValid);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     24, 9, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     25, 9, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     31, 5, true, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     32, 3, true, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     33, 13, true, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     34, 4, true, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     35, 17, true, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     36, 18, true, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     37, 7, true, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     38, 6, true, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     39, 15, true, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     40, 16, true, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     41, 2, true, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     42, 1, true, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     43, 8, true, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     44, 9, true, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     45, 12, true, false);
   ::google::protobuf::internal::ExtensionSet::RegisterMessageExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     46, 10, true, false,
-    &::protobuf_unittest::RepeatedGroup_extension::default_instance());
+    ::protobuf_unittest::RepeatedGroup_extension::internal_default_instance());
   ::google::protobuf::internal::ExtensionSet::RegisterMessageExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     48, 11, true, false,
-    &::protobuf_unittest::TestAllTypes_NestedMessage::default_instance());
+    ::protobuf_unittest::TestAllTypes_NestedMessage::internal_default_instance());
   ::google::protobuf::internal::ExtensionSet::RegisterMessageExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     49, 11, true, false,
-    &::protobuf_unittest::ForeignMessage::default_instance());
+    ::protobuf_unittest::ForeignMessage::internal_default_instance());
   ::google::protobuf::internal::ExtensionSet::RegisterMessageExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     50, 11, true, false,
-    &::protobuf_unittest_import::ImportMessage::default_instance());
+    ::protobuf_unittest_import::ImportMessage::internal_default_instance());
   ::google::protobuf::internal::ExtensionSet::RegisterEnumExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     51, 14, true, false,
     &::protobuf_unittest::TestAllTypes_NestedEnum_IsValid);
   ::google::protobuf::internal::ExtensionSet::RegisterEnumExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     52, 14, true, false,
     &protobuf_unittest::ForeignEnum_IsValid);
   ::google::protobuf::internal::ExtensionSet::RegisterEnumExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     53, 14, true, false,
     &protobuf_unittest_import::ImportEnum_IsValid);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     54, 9, true, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     55, 9, true, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     61, 5, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     62, 3, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     63, 13, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     64, 4, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     65, 17, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     66, 18, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     67, 7, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     68, 6, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     69, 15, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     70, 16, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     71, 2, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     72, 1, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     73, 8, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     74, 9, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     75, 12, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterEnumExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     81, 14, false, false,
     &::protobuf_unittest::TestAllTypes_NestedEnum_IsValid);
   ::google::protobuf::internal::ExtensionSet::RegisterEnumExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     82, 14, false, false,
     &protobuf_unittest::ForeignEnum_IsValid);
   ::google::protobuf::internal::ExtensionSet::RegisterEnumExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     83, 14, false, false,
     &protobuf_unittest_import::ImportEnum_IsValid);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     84, 9, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     85, 9, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestFieldOrderings::default_instance(),
+    ::protobuf_unittest::TestFieldOrderings::internal_default_instance(),
     50, 9, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestFieldOrderings::default_instance(),
+    ::protobuf_unittest::TestFieldOrderings::internal_default_instance(),
     5, 5, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestPackedExtensions::default_instance(),
+    ::protobuf_unittest::TestPackedExtensions::internal_default_instance(),
     90, 5, true, true);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestPackedExtensions::default_instance(),
+    ::protobuf_unittest::TestPackedExtensions::internal_default_instance(),
     91, 3, true, true);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestPackedExtensions::default_instance(),
+    ::protobuf_unittest::TestPackedExtensions::internal_default_instance(),
     92, 13, true, true);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestPackedExtensions::default_instance(),
+    ::protobuf_unittest::TestPackedExtensions::internal_default_instance(),
     93, 4, true, true);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestPackedExtensions::default_instance(),
+    ::protobuf_unittest::TestPackedExtensions::internal_default_instance(),
     94, 17, true, true);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestPackedExtensions::default_instance(),
+    ::protobuf_unittest::TestPackedExtensions::internal_default_instance(),
     95, 18, true, true);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestPackedExtensions::default_instance(),
+    ::protobuf_unittest::TestPackedExtensions::internal_default_instance(),
     96, 7, true, true);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestPackedExtensions::default_instance(),
+    ::protobuf_unittest::TestPackedExtensions::internal_default_instance(),
     97, 6, true, true);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestPackedExtensions::default_instance(),
+    ::protobuf_unittest::TestPackedExtensions::internal_default_instance(),
     98, 15, true, true);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestPackedExtensions::default_instance(),
+    ::protobuf_unittest::TestPackedExtensions::internal_default_instance(),
     99, 16, true, true);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestPackedExtensions::default_instance(),
+    ::protobuf_unittest::TestPackedExtensions::internal_default_instance(),
     100, 2, true, true);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestPackedExtensions::default_instance(),
+    ::protobuf_unittest::TestPackedExtensions::internal_default_instance(),
     101, 1, true, true);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestPackedExtensions::default_instance(),
+    ::protobuf_unittest::TestPackedExtensions::internal_default_instance(),
     102, 8, true, true);
   ::google::protobuf::internal::ExtensionSet::RegisterEnumExtension(
-    &::protobuf_unittest::TestPackedExtensions::default_instance(),
+    ::protobuf_unittest::TestPackedExtensions::internal_default_instance(),
     103, 14, true, true,
     &protobuf_unittest::ForeignEnum_IsValid);
   TestAllTypes::default_instance_->InitAsDefaultInstance();
@@ -1819,17 +1450,17 @@ void protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto() {
   RepeatedGroup_extension::default_instance_->InitAsDefaultInstance();
   TestNestedExtension::default_instance_->InitAsDefaultInstance();
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     1002, 9, false, false);
   TestRequired::default_instance_->InitAsDefaultInstance();
   ::google::protobuf::internal::ExtensionSet::RegisterMessageExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     1000, 11, false, false,
-    &::protobuf_unittest::TestRequired::default_instance());
+    ::protobuf_unittest::TestRequired::internal_default_instance());
   ::google::protobuf::internal::ExtensionSet::RegisterMessageExtension(
-    &::protobuf_unittest::TestAllExtensions::default_instance(),
+    ::protobuf_unittest::TestAllExtensions::internal_default_instance(),
     1001, 11, true, false,
-    &::protobuf_unittest::TestRequired::default_instance());
+    ::protobuf_unittest::TestRequired::internal_default_instance());
   TestRequiredForeign::default_instance_->InitAsDefaultInstance();
   TestForeignNested::default_instance_->InitAsDefaultInstance();
   TestEmptyMessage::default_instance_->InitAsDefaultInstance();
@@ -1855,6 +1486,7 @@ void protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto() {
   TestDynamicExtensions::default_instance_->InitAsDefaultInstance();
   TestDynamicExtensions_DynamicMessageType::default_instance_->InitAsDefaultInstance();
   TestRepeatedScalarDifferentTagSizes::default_instance_->InitAsDefaultInstance();
+  TestLazyMessage::default_instance_->InitAsDefaultInstance();
   FooRequest::default_instance_->InitAsDefaultInstance();
   FooResponse::default_instance_->InitAsDefaultInstance();
   BarRequest::default_instance_->InitAsDefaultInstance();
@@ -1862,6 +1494,434 @@ void protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto() {
   ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_google_2fprotobuf_2funittest_2eproto);
 }
 
+namespace {
+
+GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_InitDefaults_once_);
+// Set once the defaults are built, so that default_instance() and the
+// other callers on hot paths can skip the once.
+::google::protobuf::internal::Atomic32 protobuf_InitDefaults_done_ = 0;
+
+}  // namespace
+
+void protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto() {
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) != 0) {
+    return;
+  }
+  ::google::protobuf::GoogleOnceInit(&protobuf_InitDefaults_once_,
+                 &protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto_impl);
+  ::google::protobuf::internal::Release_Store(
+      &protobuf_InitDefaults_done_, 1);
+}
+
+void protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto() {
+  static bool already_here = false;
+  if (already_here) return;
+  already_here = true;
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  ::protobuf_unittest_import::protobuf_AddDesc_google_2fprotobuf_2funittest_5fimport_2eproto();
+  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
+    "\n\036google/protobuf/unittest.proto\022\021protob"
+    "uf_unittest\032%google/protobuf/unittest_im"
+    "port.proto\"\273\025\n\014TestAllTypes\022\026\n\016optional_"
+    "int32\030\001 \001(\005\022\026\n\016optional_int64\030\002 \001(\003\022\027\n\017o"
+    "ptional_uint32\030\003 \001(\r\022\027\n\017optional_uint64\030"
+    "\004 \001(\004\022\027\n\017optional_sint32\030\005 \001(\021\022\027\n\017option"
+    "al_sint64\030\006 \001(\022\022\030\n\020optional_fixed32\030\007 \001("
+    "\007\022\030\n\020optional_fixed64\030\010 \001(\006\022\031\n\021optional_"
+    "sfixed32\030\t \001(\017\022\031\n\021optional_sfixed64\030\n \001("
+    "\020\022\026\n\016optional_float\030\013 \001(\002\022\027\n\017optional_do"
+    "uble\030\014 \001(\001\022\025\n\roptional_bool\030\r \001(\010\022\027\n\017opt"
+    "ional_string\030\016 \001(\t\022\026\n\016optional_bytes\030\017 \001"
+    "(\014\022D\n\roptionalgroup\030\020 \001(\n2-.protobuf_uni"
+    "ttest.TestAllTypes.OptionalGroup\022N\n\027opti"
+    "onal_nested_message\030\022 \001(\0132-.protobuf_uni"
+    "ttest.TestAllTypes.NestedMessage\022C\n\030opti"
+    "onal_foreign_message\030\023 \001(\0132!.protobuf_un"
+    "ittest.ForeignMessage\022H\n\027optional_import"
+    "_message\030\024 \001(\0132\'.protobuf_unittest_impor"
+    "t.ImportMessage\022H\n\024optional_nested_enum\030"
+    "\025 \001(\0162*.protobuf_unittest.TestAllTypes.N"
+    "estedEnum\022=\n\025optional_foreign_enum\030\026 \001(\016"
+    "2\036.protobuf_unittest.ForeignEnum\022B\n\024opti"
+    "onal_import_enum\030\027 \001(\0162$.protobuf_unitte"
+    "st_import.ImportEnum\022!\n\025optional_string_"
+    "piece\030\030 \001(\tB\002\010\002\022\031\n\roptional_cord\030\031 \001(\tB\002"
+    "\010\001\022\026\n\016repeated_int32\030\037 \003(\005\022\026\n\016repeated_i"
+    "nt64\030  \003(\003\022\027\n\017repeated_uint32\030! \003(\r\022\027\n\017r"
+    "epeated_uint64\030\" \003(\004\022\027\n\017repeated_sint32\030"
+    "# \003(\021\022\027\n\017repeated_sint64\030$ \003(\022\022\030\n\020repeat"
+    "ed_fixed32\030% \003(\007\022\030\n\020repeated_fixed64\030& \003"
+    "(\006\022\031\n\021repeated_sfixed32\030\' \003(\017\022\031\n\021repeate"
+    "d_sfixed64\030( \003(\020\022\026\n\016repeated_float\030) \003(\002"
+    "\022\027\n\017repeated_double\030* \003(\001\022\025\n\rrepeated_bo"
+    "ol\030+ \003(\010\022\027\n\017repeated_string\030, \003(\t\022\026\n\016rep"
+    "eated_bytes\030- \003(\014\022D\n\rrepeatedgroup\030. \003(\n"
+    "2-.protobuf_unittest.TestAllTypes.Repeat"
+    "edGroup\022N\n\027repeated_nested_message\0300 \003(\013"
+    "2-.protobuf_unittest.TestAllTypes.Nested"
+    "Message\022C\n\030repeated_foreign_message\0301 \003("
+    "\0132!.protobuf_unittest.ForeignMessage\022H\n\027"
+    "repeated_import_message\0302 \003(\0132\'.protobuf"
+    "_unittest_import.ImportMessage\022H\n\024repeat"
+    "ed_nested_enum\0303 \003(\0162*.protobuf_unittest"
+    ".TestAllTypes.NestedEnum\022=\n\025repeated_for"
+    "eign_enum\0304 \003(\0162\036.protobuf_unittest.Fore"
+    "ignEnum\022B\n\024repeated_import_enum\0305 \003(\0162$."
+    "protobuf_unittest_import.ImportEnum\022!\n\025r"
+    "epeated_string_piece\0306 \003(\tB\002\010\002\022\031\n\rrepeat"
+    "ed_cord\0307 \003(\tB\002\010\001\022\031\n\rdefault_int32\030= \001(\005"
+    ":\00241\022\031\n\rdefault_int64\030> \001(\003:\00242\022\032\n\016defau"
+    "lt_uint32\030? \001(\r:\00243\022\032\n\016default_uint64\030@ "
+    "\001(\004:\00244\022\033\n\016default_sint32\030A \001(\021:\003-45\022\032\n\016"
+    "default_sint64\030B \001(\022:\00246\022\033\n\017default_fixe"
+    "d32\030C \001(\007:\00247\022\033\n\017default_fixed64\030D \001(\006:\002"
+    "48\022\034\n\020default_sfixed32\030E \001(\017:\00249\022\035\n\020defa"
+    "ult_sfixed64\030F \001(\020:\003-50\022\033\n\rdefault_float"
+    "\030G \001(\002:\00451.5\022\035\n\016default_double\030H \001(\001:\00552"
+    "000\022\032\n\014default_bool\030I \001(\010:\004true\022\035\n\016defau"
+    "lt_string\030J \001(\t:\005hello\022\034\n\rdefault_bytes\030"
+    "K \001(\014:\005world\022L\n\023default_nested_enum\030Q \001("
+    "\0162*.protobuf_unittest.TestAllTypes.Neste"
+    "dEnum:\003BAR\022I\n\024default_foreign_enum\030R \001(\016"
+    "2\036.protobuf_unittest.ForeignEnum:\013FOREIG"
+    "N_BAR\022M\n\023default_import_enum\030S \001(\0162$.pro"
+    "tobuf_unittest_import.ImportEnum:\nIMPORT"
+    "_BAR\022%\n\024default_string_piece\030T \001(\t:\003abcB"
+    "\002\010\002\022\035\n\014default_cord\030U \001(\t:\003123B\002\010\001\032\033\n\rNe"
+    "stedMessage\022\n\n\002bb\030\001 \001(\005\032\032\n\rOptionalGroup"
+    "\022\t\n\001a\030\021 \001(\005\032\032\n\rRepeatedGroup\022\t\n\001a\030/ \001(\005\""
+    "\'\n\nNestedEnum\022\007\n\003FOO\020\001\022\007\n\003BAR\020\002\022\007\n\003BAZ\020\003"
+    "\"4\n\024TestDeprecatedFields\022\034\n\020deprecated_i"
+    "nt32\030\001 \001(\005B\002\030\001\"\033\n\016ForeignMessage\022\t\n\001c\030\001 "
+    "\001(\005\"\035\n\021TestAllExtensions*\010\010\001\020\200\200\200\200\002\"$\n\027Op"
+    "tionalGroup_extension\022\t\n\001a\030\021 \001(\005\"$\n\027Repe"
+    "atedGroup_extension\022\t\n\001a\030/ \001(\005\"P\n\023TestNe"
+    "stedExtension29\n\004test\022$.protobuf_unittes"
+    "t.TestAllExtensions\030\352\007 \001(\t:\004test\"\325\005\n\014Tes"
+    "tRequired\022\t\n\001a\030\001 \002(\005\022\016\n\006dummy2\030\002 \001(\005\022\t\n\001"
+    "b\030\003 \002(\005\022\016\n\006dummy4\030\004 \001(\005\022\016\n\006dummy5\030\005 \001(\005\022"
+    "\016\n\006dummy6\030\006 \001(\005\022\016\n\006dummy7\030\007 \001(\005\022\016\n\006dummy"
+    "8\030\010 \001(\005\022\016\n\006dummy9\030\t \001(\005\022\017\n\007dummy10\030\n \001(\005"
+    "\022\017\n\007dummy11\030\013 \001(\005\022\017\n\007dummy12\030\014 \001(\005\022\017\n\007du"
+    "mmy13\030\r \001(\005\022\017\n\007dummy14\030\016 \001(\005\022\017\n\007dummy15\030"
+    "\017 \001(\005\022\017\n\007dummy16\030\020 \001(\005\022\017\n\007dummy17\030\021 \001(\005\022"
+    "\017\n\007dummy18\030\022 \001(\005\022\017\n\007dummy19\030\023 \001(\005\022\017\n\007dum"
+    "my20\030\024 \001(\005\022\017\n\007dummy21\030\025 \001(\005\022\017\n\007dummy22\030\026"
+    " \001(\005\022\017\n\007dummy23\030\027 \001(\005\022\017\n\007dummy24\030\030 \001(\005\022\017"
+    "\n\007dummy25\030\031 \001(\005\022\017\n\007dummy26\030\032 \001(\005\022\017\n\007dumm"
+    "y27\030\033 \001(\005\022\017\n\007dummy28\030\034 \001(\005\022\017\n\007dummy29\030\035 "
+    "\001(\005\022\017\n\007dummy30\030\036 \001(\005\022\017\n\007dummy31\030\037 \001(\005\022\017\n"
+    "\007dummy32\030  \001(\005\022\t\n\001c\030! \002(\0052V\n\006single\022$.pr"
+    "otobuf_unittest.TestAllExtensions\030\350\007 \001(\013"
+    "2\037.protobuf_unittest.TestRequired2U\n\005mul"
+    "ti\022$.protobuf_unittest.TestAllExtensions"
+    "\030\351\007 \003(\0132\037.protobuf_unittest.TestRequired"
+    "\"\232\001\n\023TestRequiredForeign\0229\n\020optional_mes"
+    "sage\030\001 \001(\0132\037.protobuf_unittest.TestRequi"
+    "red\0229\n\020repeated_message\030\002 \003(\0132\037.protobuf"
+    "_unittest.TestRequired\022\r\n\005dummy\030\003 \001(\005\"Z\n"
+    "\021TestForeignNested\022E\n\016foreign_nested\030\001 \001"
+    "(\0132-.protobuf_unittest.TestAllTypes.Nest"
+    "edMessage\"\022\n\020TestEmptyMessage\"*\n\036TestEmp"
+    "tyMessageWithExtensions*\010\010\001\020\200\200\200\200\002\"7\n\033Tes"
+    "tMultipleExtensionRanges*\004\010*\020+*\006\010\257 \020\224!*\n"
+    "\010\200\200\004\020\200\200\200\200\002\"4\n\030TestReallyLargeTagNumber\022\t"
+    "\n\001a\030\001 \001(\005\022\r\n\002bb\030\377\377\377\177 \001(\005\"U\n\024TestRecursiv"
+    "eMessage\0222\n\001a\030\001 \001(\0132\'.protobuf_unittest."
+    "TestRecursiveMessage\022\t\n\001i\030\002 \001(\005\"K\n\024TestM"
+    "utualRecursionA\0223\n\002bb\030\001 \001(\0132\'.protobuf_u"
+    "nittest.TestMutualRecursionB\"b\n\024TestMutu"
+    "alRecursionB\0222\n\001a\030\001 \001(\0132\'.protobuf_unitt"
+    "est.TestMutualRecursionA\022\026\n\016optional_int"
+    "32\030\002 \001(\005\"\263\001\n\022TestDupFieldNumber\022\t\n\001a\030\001 \001"
+    "(\005\0226\n\003foo\030\002 \001(\n2).protobuf_unittest.Test"
+    "DupFieldNumber.Foo\0226\n\003bar\030\003 \001(\n2).protob"
+    "uf_unittest.TestDupFieldNumber.Bar\032\020\n\003Fo"
+    "o\022\t\n\001a\030\001 \001(\005\032\020\n\003Bar\022\t\n\001a\030\001 \001(\005\"\200\002\n\030TestN"
+    "estedMessageHasBits\022Z\n\027optional_nested_m"
+    "essage\030\001 \001(\01329.protobuf_unittest.TestNes"
+    "tedMessageHasBits.NestedMessage\032\207\001\n\rNest"
+    "edMessage\022$\n\034nestedmessage_repeated_int3"
+    "2\030\001 \003(\005\022P\n%nestedmessage_repeated_foreig"
+    "nmessage\030\002 \003(\0132!.protobuf_unittest.Forei"
+    "gnMessage\"\345\003\n\027TestCamelCaseFieldNames\022\026\n"
+    "\016PrimitiveField\030\001 \001(\005\022\023\n\013StringField\030\002 \001"
+    "(\t\0221\n\tEnumField\030\003 \001(\0162\036.protobuf_unittes"
+    "t.ForeignEnum\0227\n\014MessageField\030\004 \001(\0132!.pr"
+    "otobuf_unittest.ForeignMessage\022\034\n\020String"
+    "PieceField\030\005 \001(\tB\002\010\002\022\025\n\tCordField\030\006 \001(\tB"
+    "\002\010\001\022\036\n\026RepeatedPrimitiveField\030\007 \003(\005\022\033\n\023R"
+    "epeatedStringField\030\010 \003(\t\0229\n\021RepeatedEnum"
+    "Field\030\t \003(\0162\036.protobuf_unittest.ForeignE"
+    "num\022?\n\024RepeatedMessageField\030\n \003(\0132!.prot"
+    "obuf_unittest.ForeignMessage\022$\n\030Repeated"
+    "StringPieceField\030\013 \003(\tB\002\010\002\022\035\n\021RepeatedCo"
+    "rdField\030\014 \003(\tB\002\010\001\"U\n\022TestFieldOrderings\022"
+    "\021\n\tmy_string\030\013 \001(\t\022\016\n\006my_int\030\001 \001(\003\022\020\n\010my"
+    "_float\030e \001(\002*\004\010\002\020\013*\004\010\014\020e\"\364\004\n\030TestExtreme"
+    "DefaultValues\022?\n\rescaped_bytes\030\001 \001(\014:(\\0"
+    "00\\001\\007\\010\\014\\n\\r\\t\\013\\\\\\\'\\\"\\376\022 "
+    "\n\014large_uint32\030\002 \001(\r:\n4294967295\022*\n\014larg"
+    "e_uint64\030\003 \001(\004:\02418446744073709551615\022 \n\013"
+    "small_int32\030\004 \001(\005:\013-2147483647\022)\n\013small_"
+    "int64\030\005 \001(\003:\024-9223372036854775807\022\030\n\013utf"
+    "8_string\030\006 \001(\t:\003\341\210\264\022\025\n\nzero_float\030\007 \001(\002:"
+    "\0010\022\024\n\tone_float\030\010 \001(\002:\0011\022\030\n\013small_float\030"
+    "\t \001(\002:\0031.5\022\036\n\022negative_one_float\030\n \001(\002:\002"
+    "-1\022\034\n\016negative_float\030\013 \001(\002:\004-1.5\022\032\n\013larg"
+    "e_float\030\014 \001(\002:\0052e+08\022$\n\024small_negative_f"
+    "loat\030\r \001(\002:\006-8e-28\022\027\n\ninf_double\030\016 \001(\001:\003"
+    "inf\022\034\n\016neg_inf_double\030\017 \001(\001:\004-inf\022\027\n\nnan"
+    "_double\030\020 \001(\001:\003nan\022\026\n\tinf_float\030\021 \001(\002:\003i"
+    "nf\022\033\n\rneg_inf_float\030\022 \001(\002:\004-inf\022\026\n\tnan_f"
+    "loat\030\023 \001(\002:\003nan\"\031\n\tOneString\022\014\n\004data\030\001 \001"
+    "(\t\"\030\n\010OneBytes\022\014\n\004data\030\001 \001(\014\"\252\003\n\017TestPac"
+    "kedTypes\022\030\n\014packed_int32\030Z \003(\005B\002\020\001\022\030\n\014pa"
+    "cked_int64\030[ \003(\003B\002\020\001\022\031\n\rpacked_uint32\030\\ "
+    "\003(\rB\002\020\001\022\031\n\rpacked_uint64\030] \003(\004B\002\020\001\022\031\n\rpa"
+    "cked_sint32\030^ \003(\021B\002\020\001\022\031\n\rpacked_sint64\030_"
+    " \003(\022B\002\020\001\022\032\n\016packed_fixed32\030` \003(\007B\002\020\001\022\032\n\016"
+    "packed_fixed64\030a \003(\006B\002\020\001\022\033\n\017packed_sfixe"
+    "d32\030b \003(\017B\002\020\001\022\033\n\017packed_sfixed64\030c \003(\020B\002"
+    "\020\001\022\030\n\014packed_float\030d \003(\002B\002\020\001\022\031\n\rpacked_d"
+    "ouble\030e \003(\001B\002\020\001\022\027\n\013packed_bool\030f \003(\010B\002\020\001"
+    "\0227\n\013packed_enum\030g \003(\0162\036.protobuf_unittes"
+    "t.ForeignEnumB\002\020\001\"\310\003\n\021TestUnpackedTypes\022"
+    "\032\n\016unpacked_int32\030Z \003(\005B\002\020\000\022\032\n\016unpacked_"
+    "int64\030[ \003(\003B\002\020\000\022\033\n\017unpacked_uint32\030\\ \003(\r"
+    "B\002\020\000\022\033\n\017unpacked_uint64\030] \003(\004B\002\020\000\022\033\n\017unp"
+    "acked_sint32\030^ \003(\021B\002\020\000\022\033\n\017unpacked_sint6"
+    "4\030_ \003(\022B\002\020\000\022\034\n\020unpacked_fixed32\030` \003(\007B\002\020"
+    "\000\022\034\n\020unpacked_fixed64\030a \003(\006B\002\020\000\022\035\n\021unpac"
+    "ked_sfixed32\030b \003(\017B\002\020\000\022\035\n\021unpacked_sfixe"
+    "d64\030c \003(\020B\002\020\000\022\032\n\016unpacked_float\030d \003(\002B\002\020"
+    "\000\022\033\n\017unpacked_double\030e \003(\001B\002\020\000\022\031\n\runpack"
+    "ed_bool\030f \003(\010B\002\020\000\0229\n\runpacked_enum\030g \003(\016"
+    "2\036.protobuf_unittest.ForeignEnumB\002\020\000\" \n\024"
+    "TestPackedExtensions*\010\010\001\020\200\200\200\200\002\"\231\004\n\025TestD"
+    "ynamicExtensions\022\031\n\020scalar_extension\030\320\017 "
+    "\001(\007\0227\n\016enum_extension\030\321\017 \001(\0162\036.protobuf_"
+    "unittest.ForeignEnum\022Y\n\026dynamic_enum_ext"
+    "ension\030\322\017 \001(\01628.protobuf_unittest.TestDy"
+    "namicExtensions.DynamicEnumType\022=\n\021messa"
+    "ge_extension\030\323\017 \001(\0132!.protobuf_unittest."
+    "ForeignMessage\022_\n\031dynamic_message_extens"
+    "ion\030\324\017 \001(\0132;.protobuf_unittest.TestDynam"
+    "icExtensions.DynamicMessageType\022\033\n\022repea"
+    "ted_extension\030\325\017 \003(\t\022\035\n\020packed_extension"
+    "\030\326\017 \003(\021B\002\020\001\032,\n\022DynamicMessageType\022\026\n\rdyn"
+    "amic_field\030\264\020 \001(\005\"G\n\017DynamicEnumType\022\020\n\013"
+    "DYNAMIC_FOO\020\230\021\022\020\n\013DYNAMIC_BAR\020\231\021\022\020\n\013DYNA"
+    "MIC_BAZ\020\232\021\"\300\001\n#TestRepeatedScalarDiffere"
+    "ntTagSizes\022\030\n\020repeated_fixed32\030\014 \003(\007\022\026\n\016"
+    "repeated_int32\030\r \003(\005\022\031\n\020repeated_fixed64"
+    "\030\376\017 \003(\006\022\027\n\016repeated_int64\030\377\017 \003(\003\022\030\n\016repe"
+    "ated_float\030\376\377\017 \003(\002\022\031\n\017repeated_uint64\030\377\377"
+    "\017 \003(\004\"\310\001\n\017TestLazyMessage\022\n\n\002id\030\001 \001(\005\0227\n"
+    "\nlazy_child\030\002 \001(\0132\037.protobuf_unittest.Te"
+    "stAllTypesB\002(\001\0224\n\013eager_child\030\003 \001(\0132\037.pr"
+    "otobuf_unittest.TestAllTypes\022:\n\rlazy_req"
+    "uired\030\004 \001(\0132\037.protobuf_unittest.TestRequ"
+    "iredB\002(\001\"\014\n\nFooRequest\"\r\n\013FooResponse\"\014\n"
+    "\nBarRequest\"\r\n\013BarResponse*@\n\013ForeignEnu"
+    "m\022\017\n\013FOREIGN_FOO\020\004\022\017\n\013FOREIGN_BAR\020\005\022\017\n\013F"
+    "OREIGN_BAZ\020\006*G\n\024TestEnumWithDupValue\022\010\n\004"
+    "FOO1\020\001\022\010\n\004BAR1\020\002\022\007\n\003BAZ\020\003\022\010\n\004FOO2\020\001\022\010\n\004B"
+    "AR2\020\002*\211\001\n\016TestSparseEnum\022\014\n\010SPARSE_A\020{\022\016"
+    "\n\010SPARSE_B\020\246\347\003\022\017\n\010SPARSE_C\020\262\261\200\006\022\025\n\010SPARS"
+    "E_D\020\361\377\377\377\377\377\377\377\377\001\022\025\n\010SPARSE_E\020\264\336\374\377\377\377\377\377\377\001\022\014\n"
+    "\010SPARSE_F\020\000\022\014\n\010SPARSE_G\020\0022\231\001\n\013TestServic"
+    "e\022D\n\003Foo\022\035.protobuf_unittest.FooRequest\032"
+    "\036.protobuf_unittest.FooResponse\022D\n\003Bar\022\035"
+    ".protobuf_unittest.BarRequest\032\036.protobuf"
+    "_unittest.BarResponse:F\n\030optional_int32_"
+    "extension\022$.protobuf_unittest.TestAllExt"
+    "ensions\030\001 \001(\005:F\n\030optional_int64_extensio"
+    "n\022$.protobuf_unittest.TestAllExtensions\030"
+    "\002 \001(\003:G\n\031optional_uint32_extension\022$.pro"
+    "tobuf_unittest.TestAllExtensions\030\003 \001(\r:G"
+    "\n\031optional_uint64_extension\022$.protobuf_u"
+    "nittest.TestAllExtensions\030\004 \001(\004:G\n\031optio"
+    "nal_sint32_extension\022$.protobuf_unittest"
+    ".TestAllExtensions\030\005 \001(\021:G\n\031optional_sin"
+    "t64_extension\022$.protobuf_unittest.TestAl"
+    "lExtensions\030\006 \001(\022:H\n\032optional_fixed32_ex"
+    "tension\022$.protobuf_unittest.TestAllExten"
+    "sions\030\007 \001(\007:H\n\032optional_fixed64_extensio"
+    "n\022$.protobuf_unittest.TestAllExtensions\030"
+    "\010 \001(\006:I\n\033optional_sfixed32_extension\022$.p"
+    "rotobuf_unittest.TestAllExtensions\030\t \001(\017"
+    ":I\n\033optional_sfixed64_extension\022$.protob"
+    "uf_unittest.TestAllExtensions\030\n \001(\020:F\n\030o"
+    "ptional_float_extension\022$.protobuf_unitt"
+    "est.TestAllExtensions\030\013 \001(\002:G\n\031optional_"
+    "double_extension\022$.protobuf_unittest.Tes"
+    "tAllExtensions\030\014 \001(\001:E\n\027optional_bool_ex"
+    "tension\022$.protobuf_unittest.TestAllExten"
+    "sions\030\r \001(\010:G\n\031optional_string_extension"
+    "\022$.protobuf_unittest.TestAllExtensions\030\016"
+    " \001(\t:F\n\030optional_bytes_extension\022$.proto"
+    "buf_unittest.TestAllExtensions\030\017 \001(\014:q\n\027"
+    "optionalgroup_extension\022$.protobuf_unitt"
+    "est.TestAllExtensions\030\020 \001(\n2*.protobuf_u"
+    "nittest.OptionalGroup_extension:~\n!optio"
+    "nal_nested_message_extension\022$.protobuf_"
+    "unittest.TestAllExtensions\030\022 \001(\0132-.proto"
+    "buf_unittest.TestAllTypes.NestedMessage:"
+    "s\n\"optional_foreign_message_extension\022$."
+    "protobuf_unittest.TestAllExtensions\030\023 \001("
+    "\0132!.protobuf_unittest.ForeignMessage:x\n!"
+    "optional_import_message_extension\022$.prot"
+    "obuf_unittest.TestAllExtensions\030\024 \001(\0132\'."
+    "protobuf_unittest_import.ImportMessage:x"
+    "\n\036optional_nested_enum_extension\022$.proto"
+    "buf_unittest.TestAllExtensions\030\025 \001(\0162*.p"
+    "rotobuf_unittest.TestAllTypes.NestedEnum"
+    ":m\n\037optional_foreign_enum_extension\022$.pr"
+    "otobuf_unittest.TestAllExtensions\030\026 \001(\0162"
+    "\036.protobuf_unittest.ForeignEnum:r\n\036optio"
+    "nal_import_enum_extension\022$.protobuf_uni"
+    "ttest.TestAllExtensions\030\027 \001(\0162$.protobuf"
+    "_unittest_import.ImportEnum:Q\n\037optional_"
+    "string_piece_extension\022$.protobuf_unitte"
+    "st.TestAllExtensions\030\030 \001(\tB\002\010\002:I\n\027option"
+    "al_cord_extension\022$.protobuf_unittest.Te"
+    "stAllExtensions\030\031 \001(\tB\002\010\001:F\n\030repeated_in"
+    "t32_extension\022$.protobuf_unittest.TestAl"
+    "lExtensions\030\037 \003(\005:F\n\030repeated_int64_exte"
+    "nsion\022$.protobuf_unittest.TestAllExtensi"
+    "ons\030  \003(\003:G\n\031repeated_uint32_extension\022$"
+    ".protobuf_unittest.TestAllExtensions\030! \003"
+    "(\r:G\n\031repeated_uint64_extension\022$.protob"
+    "uf_unittest.TestAllExtensions\030\" \003(\004:G\n\031r"
+    "epeated_sint32_extension\022$.protobuf_unit"
+    "test.TestAllExtensions\030# \003(\021:G\n\031repeated"
+    "_sint64_extension\022$.protobuf_unittest.Te"
+    "stAllExtensions\030$ \003(\022:H\n\032repeated_fixed3"
+    "2_extension\022$.protobuf_unittest.TestAllE"
+    "xtensions\030% \003(\007:H\n\032repeated_fixed64_exte"
+    "nsion\022$.protobuf_unittest.TestAllExtensi"
+    "ons\030& \003(\006:I\n\033repeated_sfixed32_extension"
+    "\022$.protobuf_unittest.TestAllExtensions\030\'"
+    " \003(\017:I\n\033repeated_sfixed64_extension\022$.pr"
+    "otobuf_unittest.TestAllExtensions\030( \003(\020:"
+    "F\n\030repeated_float_extension\022$.protobuf_u"
+    "nittest.TestAllExtensions\030) \003(\002:G\n\031repea"
+    "ted_double_extension\022$.protobuf_unittest"
+    ".TestAllExtensions\030* \003(\001:E\n\027repeated_boo"
+    "l_extension\022$.protobuf_unittest.TestAllE"
+    "xtensions\030+ \003(\010:G\n\031repeated_string_exten"
+    "sion\022$.protobuf_unittest.TestAllExtensio"
+    "ns\030, \003(\t:F\n\030repeated_bytes_extension\022$.p"
+    "rotobuf_unittest.TestAllExtensions\030- \003(\014"
+    ":q\n\027repeatedgroup_extension\022$.protobuf_u"
+    "nittest.TestAllExtensions\030. \003(\n2*.protob"
+    "uf_unittest.RepeatedGroup_extension:~\n!r"
+    "epeated_nested_message_extension\022$.proto"
+    "buf_unittest.TestAllExtensions\0300 \003(\0132-.p"
+    "rotobuf_unittest.TestAllTypes.NestedMess"
+    "age:s\n\"repeated_foreign_message_extensio"
+    "n\022$.protobuf_unittest.TestAllExtensions\030"
+    "1 \003(\0132!.protobuf_unittest.ForeignMessage"
+    ":x\n!repeated_import_message_extension\022$."
+    "protobuf_unittest.TestAllExtensions\0302 \003("
+    "\0132\'.protobuf_unittest_import.ImportMessa"
+    "ge:x\n\036repeated_nested_enum_extension\022$.p"
+    "rotobuf_unittest.TestAllExtensions\0303 \003(\016"
+    "2*.protobuf_unittest.TestAllTypes.Nested"
+    "Enum:m\n\037repeated_foreign_enum_extension\022"
+    "$.protobuf_unittest.TestAllExtensions\0304 "
+    "\003(\0162\036.protobuf_unittest.ForeignEnum:r\n\036r"
+    "epeated_import_enum_extension\022$.protobuf"
+    "_unittest.TestAllExtensions\0305 \003(\0162$.prot"
+    "obuf_unittest_import.ImportEnum:Q\n\037repea"
+    "ted_string_piece_extension\022$.protobuf_un"
+    "ittest.TestAllExtensions\0306 \003(\tB\002\010\002:I\n\027re"
+    "peated_cord_extension\022$.protobuf_unittes"
+    "t.TestAllExtensions\0307 \003(\tB\002\010\001:I\n\027default"
+    "_int32_extension\022$.protobuf_unittest.Tes"
+    "tAllExtensions\030= \001(\005:\00241:I\n\027default_int6"
+    "4_extension\022$.protobuf_unittest.TestAllE"
+    "xtensions\030> \001(\003:\00242:J\n\030default_uint32_ex"
+    "tension\022$.protobuf_unittest.TestAllExten"
+    "sions\030? \001(\r:\00243:J\n\030default_uint64_extens"
+    "ion\022$.protobuf_unittest.TestAllExtension"
+    "s\030@ \001(\004:\00244:K\n\030default_sint32_extension\022"
+    "$.protobuf_unittest.TestAllExtensions\030A "
+    "\001(\021:\003-45:J\n\030default_sint64_extension\022$.p"
+    "rotobuf_unittest.TestAllExtensions\030B \001(\022"
+    ":\00246:K\n\031default_fixed32_extension\022$.prot"
+    "obuf_unittest.TestAllExtensions\030C \001(\007:\0024"
+    "7:K\n\031default_fixed64_extension\022$.protobu"
+    "f_unittest.TestAllExtensions\030D \001(\006:\00248:L"
+    "\n\032default_sfixed32_extension\022$.protobuf_"
+    "unittest.TestAllExtensions\030E \001(\017:\00249:M\n\032"
+    "default_sfixed64_extension\022$.protobuf_un"
+    "ittest.TestAllExtensions\030F \001(\020:\003-50:K\n\027d"
+    "efault_float_extension\022$.protobuf_unitte"
+    "st.TestAllExtensions\030G \001(\002:\00451.5:M\n\030defa"
+    "ult_double_extension\022$.protobuf_unittest"
+    ".TestAllExtensions\030H \001(\001:\00552000:J\n\026defau"
+    "lt_bool_extension\022$.protobuf_unittest.Te"
+    "stAllExtensions\030I \001(\010:\004true:M\n\030default_s"
+    "tring_extension\022$.protobuf_unittest.Test"
+    "AllExtensions\030J \001(\t:\005hello:L\n\027default_by"
+    "tes_extension\022$.protobuf_unittest.TestAl"
+    "lExtensions\030K \001(\014:\005world:|\n\035default_nest"
+    "ed_enum_extension\022$.protobuf_unittest.Te"
+    "stAllExtensions\030Q \001(\0162*.protobuf_unittes"
+    "t.TestAllTypes.NestedEnum:\003BAR:y\n\036defaul"
+    "t_foreign_enum_extension\022$.protobuf_unit"
+    "test.TestAllExtensions\030R \001(\0162\036.protobuf_"
+    "unittest.ForeignEnum:\013FOREIGN_BAR:}\n\035def"
+    "ault_import_enum_extension\022$.protobuf_un"
+    "ittest.TestAllExtensions\030S \001(\0162$.protobu"
+    "f_unittest_import.ImportEnum:\nIMPORT_BAR"
+    ":U\n\036default_string_piece_extension\022$.pro"
+    "tobuf_unittest.TestAllExtensions\030T \001(\t:\003"
+    "abcB\002\010\002:M\n\026default_cord_extension\022$.prot"
+    "obuf_unittest.TestAllExtensions\030U \001(\t:\0031"
+    "23B\002\010\001:B\n\023my_extension_string\022%.protobuf"
+    "_unittest.TestFieldOrderings\0302 \001(\t:?\n\020my"
+    "_extension_int\022%.protobuf_unittest.TestF"
+    "ieldOrderings\030\005 \001(\005:K\n\026packed_int32_exte"
+    "nsion\022\'.protobuf_unittest.TestPackedExte"
+    "nsions\030Z \003(\005B\002\020\001:K\n\026packed_int64_extensi"
+    "on\022\'.protobuf_unittest.TestPackedExtensi"
+    "ons\030[ \003(\003B\002\020\001:L\n\027packed_uint32_extension"
+    "\022\'.protobuf_unittest.TestPackedExtension"
+    "s\030\\ \003(\rB\002\020\001:L\n\027packed_uint64_extension\022\'"
+    ".protobuf_unittest.TestPackedExtensions\030"
+    "] \003(\004B\002\020\001:L\n\027packed_sint32_extension\022\'.p"
+    "rotobuf_unittest.TestPackedExtensions\030^ "
+    "\003(\021B\002\020\001:L\n\027packed_sint64_extension\022\'.pro"
+    "tobuf_unittest.TestPackedExtensions\030_ \003("
+    "\022B\002\020\001:M\n\030packed_fixed32_extension\022\'.prot"
+    "obuf_unittest.TestPackedExtensions\030` \003(\007"
+    "B\002\020\001:M\n\030packed_fixed64_extension\022\'.proto"
+    "buf_unittest.TestPackedExtensions\030a \003(\006B"
+    "\002\020\001:N\n\031packed_sfixed32_extension\022\'.proto"
+    "buf_unittest.TestPackedExtensions\030b \003(\017B"
+    "\002\020\001:N\n\031packed_sfixed64_extension\022\'.proto"
+    "buf_unittest.TestPackedExtensions\030c \003(\020B"
+    "\002\020\001:K\n\026packed_float_extension\022\'.protobuf"
+    "_unittest.TestPackedExtensions\030d \003(\002B\002\020\001"
+    ":L\n\027packed_double_extension\022\'.protobuf_u"
+    "nittest.TestPackedExtensions\030e \003(\001B\002\020\001:J"
+    "\n\025packed_bool_extension\022\'.protobuf_unitt"
+    "est.TestPackedExtensions\030f \003(\010B\002\020\001:j\n\025pa"
+    "cked_enum_extension\022\'.protobuf_unittest."
+    "TestPackedExtensions\030g \003(\0162\036.protobuf_un"
+    "ittest.ForeignEnumB\002\020\001B\021B\rUnittestProtoH"
+    "\001", 15721);
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
+    "google/protobuf/unittest.proto", &protobuf_RegisterTypes);
+  ::google::protobuf::internal::ExtensionSet::RegisterDeferredExtensions(
+    &protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto);
+}
+
 // Force AddDescriptors() to be called at static initialization time.
 struct StaticDescriptorInitializer_google_2fprotobuf_2funittest_2eproto {
   StaticDescriptorInitializer_google_2fprotobuf_2funittest_2eproto() {
@@ -1978,9 +2038,7 @@ void TestAllTypes_NestedMessage::SharedDtor() {
 }
 
 void TestAllTypes_NestedMessage::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* TestAllTypes_NestedMessage::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -1988,7 +2046,11 @@ const ::google::protobuf::Descriptor* TestAllTypes_NestedMessage::descriptor() {
 }
 
 const TestAllTypes_NestedMessage& TestAllTypes_NestedMessage::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestAllTypes_NestedMessage* TestAllTypes_NestedMessage::default_instance_ = NULL;
@@ -2086,9 +2148,8 @@ int TestAllTypes_NestedMessage::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -2185,9 +2246,7 @@ void TestAllTypes_OptionalGroup::SharedDtor() {
 }
 
 void TestAllTypes_OptionalGroup::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* TestAllTypes_OptionalGroup::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -2195,7 +2254,11 @@ const ::google::protobuf::Descriptor* TestAllTypes_OptionalGroup::descriptor() {
 }
 
 const TestAllTypes_OptionalGroup& TestAllTypes_OptionalGroup::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestAllTypes_OptionalGroup* TestAllTypes_OptionalGroup::default_instance_ = NULL;
@@ -2293,9 +2356,8 @@ int TestAllTypes_OptionalGroup::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -2392,9 +2454,7 @@ void TestAllTypes_RepeatedGroup::SharedDtor() {
 }
 
 void TestAllTypes_RepeatedGroup::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* TestAllTypes_RepeatedGroup::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -2402,7 +2462,11 @@ const ::google::protobuf::Descriptor* TestAllTypes_RepeatedGroup::descriptor() {
 }
 
 const TestAllTypes_RepeatedGroup& TestAllTypes_RepeatedGroup::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestAllTypes_RepeatedGroup* TestAllTypes_RepeatedGroup::default_instance_ = NULL;
@@ -2500,9 +2564,8 @@ int TestAllTypes_RepeatedGroup::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -2567,11 +2630,9 @@ void TestAllTypes_RepeatedGroup::Swap(TestAllTypes_RepeatedGroup* other) {
 
 const ::std::string TestAllTypes::_default_optional_string_;
 const ::std::string TestAllTypes::_default_optional_bytes_;
-const ::std::string TestAllTypes::_default_optional_string_piece_;
 const ::std::string TestAllTypes::_default_optional_cord_;
 const ::std::string TestAllTypes::_default_default_string_("hello");
 const ::std::string TestAllTypes::_default_default_bytes_("world");
-const ::std::string TestAllTypes::_default_default_string_piece_("abc");
 const ::std::string TestAllTypes::_default_default_cord_("123");
 #ifndef _MSC_VER
 const int TestAllTypes::kOptionalInt32FieldNumber;
@@ -2650,10 +2711,14 @@ TestAllTypes::TestAllTypes()
 }
 
 void TestAllTypes::InitAsDefaultInstance() {
-  optionalgroup_ = const_cast< ::protobuf_unittest::TestAllTypes_OptionalGroup*>(&::protobuf_unittest::TestAllTypes_OptionalGroup::default_instance());
-  optional_nested_message_ = const_cast< ::protobuf_unittest::TestAllTypes_NestedMessage*>(&::protobuf_unittest::TestAllTypes_NestedMessage::default_instance());
-  optional_foreign_message_ = const_cast< ::protobuf_unittest::ForeignMessage*>(&::protobuf_unittest::ForeignMessage::default_instance());
-  optional_import_message_ = const_cast< ::protobuf_unittest_import::ImportMessage*>(&::protobuf_unittest_import::ImportMessage::default_instance());
+  optionalgroup_ = const_cast< ::protobuf_unittest::TestAllTypes_OptionalGroup*>(
+      ::protobuf_unittest::TestAllTypes_OptionalGroup::internal_default_instance());
+  optional_nested_message_ = const_cast< ::protobuf_unittest::TestAllTypes_NestedMessage*>(
+      ::protobuf_unittest::TestAllTypes_NestedMessage::internal_default_instance());
+  optional_foreign_message_ = const_cast< ::protobuf_unittest::ForeignMessage*>(
+      ::protobuf_unittest::ForeignMessage::internal_default_instance());
+  optional_import_message_ = const_cast< ::protobuf_unittest_import::ImportMessage*>(
+      ::protobuf_unittest_import::ImportMessage::internal_default_instance());
 }
 
 TestAllTypes::TestAllTypes(const TestAllTypes& from)
@@ -2686,7 +2751,6 @@ void TestAllTypes::SharedCtor() {
   optional_nested_enum_ = 1;
   optional_foreign_enum_ = 4;
   optional_import_enum_ = 7;
-  optional_string_piece_ = const_cast< ::std::string*>(&_default_optional_string_piece_);
   optional_cord_ = const_cast< ::std::string*>(&_default_optional_cord_);
   default_int32_ = 41;
   default_int64_ = GOOGLE_LONGLONG(42);
@@ -2706,7 +2770,7 @@ void TestAllTypes::SharedCtor() {
   default_nested_enum_ = 2;
   default_foreign_enum_ = 5;
   default_import_enum_ = 8;
-  default_string_piece_ = const_cast< ::std::string*>(&_default_default_string_piece_);
+  default_string_piece_.SetAliased("abc", 3);
   default_cord_ = const_cast< ::std::string*>(&_default_default_cord_);
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
@@ -2722,9 +2786,6 @@ void TestAllTypes::SharedDtor() {
   if (optional_bytes_ != &_default_optional_bytes_) {
     delete optional_bytes_;
   }
-  if (optional_string_piece_ != &_default_optional_string_piece_) {
-    delete optional_string_piece_;
-  }
   if (optional_cord_ != &_default_optional_cord_) {
     delete optional_cord_;
   }
@@ -2734,9 +2795,6 @@ void TestAllTypes::SharedDtor() {
   if (default_bytes_ != &_default_default_bytes_) {
     delete default_bytes_;
   }
-  if (default_string_piece_ != &_default_default_string_piece_) {
-    delete default_string_piece_;
-  }
   if (default_cord_ != &_default_default_cord_) {
     delete default_cord_;
   }
@@ -2749,9 +2807,7 @@ void TestAllTypes::SharedDtor() {
 }
 
 void TestAllTypes::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* TestAllTypes::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -2759,7 +2815,11 @@ const ::google::protobuf::Descriptor* TestAllTypes::descriptor() {
 }
 
 const TestAllTypes& TestAllTypes::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestAllTypes* TestAllTypes::default_instance_ = NULL;
@@ -2813,9 +2873,7 @@ void TestAllTypes::Clear() {
     optional_foreign_enum_ = 4;
     optional_import_enum_ = 7;
     if (_has_bit(22)) {
-      if (optional_string_piece_ != &_default_optional_string_piece_) {
-        optional_string_piece_->clear();
-      }
+      optional_string_piece_.Clear();
     }
     if (_has_bit(23)) {
       if (optional_cord_ != &_default_optional_cord_) {
@@ -2855,9 +2913,7 @@ void TestAllTypes::Clear() {
     default_foreign_enum_ = 5;
     default_import_enum_ = 8;
     if (_has_bit(66)) {
-      if (default_string_piece_ != &_default_default_string_piece_) {
-        default_string_piece_->assign(_default_default_string_piece_);
-      }
+      default_string_piece_.SetAliased("abc", 3);
     }
     if (_has_bit(67)) {
       if (default_cord_ != &_default_default_cord_) {
@@ -3261,10 +3317,11 @@ bool TestAllTypes::MergePartialFromCodedStream(
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
             ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
          parse_optional_string_piece:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_optional_string_piece()));
+          _set_bit(22);
+          DO_(::google::protobuf::internal::WireFormatLite::ReadStringPiece(
+                input, &optional_string_piece_));
           ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->optional_string_piece().data(), this->optional_string_piece().length(),
+            this->optional_string_piece().data(), this->optional_string_piece().size(),
             ::google::protobuf::internal::WireFormat::PARSE);
         } else {
           goto handle_uninterpreted;
@@ -3761,10 +3818,11 @@ bool TestAllTypes::MergePartialFromCodedStream(
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
             ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
          parse_repeated_string_piece:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->add_repeated_string_piece()));
+          DO_(::google::protobuf::internal::WireFormatLite::ReadStringPiece(
+                input, repeated_string_piece_.Add()));
           ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->repeated_string_piece(0).data(), this->repeated_string_piece(0).length(),
+            this->repeated_string_piece(this->repeated_string_piece_size() - 1).data(),
+            this->repeated_string_piece(this->repeated_string_piece_size() - 1).size(),
             ::google::protobuf::internal::WireFormat::PARSE);
         } else {
           goto handle_uninterpreted;
@@ -4099,10 +4157,11 @@ bool TestAllTypes::MergePartialFromCodedStream(
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
             ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
          parse_default_string_piece:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_default_string_piece()));
+          _set_bit(66);
+          DO_(::google::protobuf::internal::WireFormatLite::ReadStringPiece(
+                input, &default_string_piece_));
           ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->default_string_piece().data(), this->default_string_piece().length(),
+            this->default_string_piece().data(), this->default_string_piece().size(),
             ::google::protobuf::internal::WireFormat::PARSE);
         } else {
           goto handle_uninterpreted;
@@ -4271,9 +4330,9 @@ void TestAllTypes::SerializeWithCachedSizes(
   // optional string optional_string_piece = 24 [ctype = STRING_PIECE];
   if (_has_bit(22)) {
     ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->optional_string_piece().data(), this->optional_string_piece().length(),
+      this->optional_string_piece().data(), this->optional_string_piece().size(),
       ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
+    ::google::protobuf::internal::WireFormatLite::WriteStringPiece(
       24, this->optional_string_piece(), output);
   }
   
@@ -4423,10 +4482,10 @@ void TestAllTypes::SerializeWithCachedSizes(
   
   // repeated string repeated_string_piece = 54 [ctype = STRING_PIECE];
   for (int i = 0; i < this->repeated_string_piece_size(); i++) {
-  ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-    this->repeated_string_piece(i).data(), this->repeated_string_piece(i).length(),
-    ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->repeated_string_piece(i).data(), this->repeated_string_piece(i).size(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    ::google::protobuf::internal::WireFormatLite::WriteStringPiece(
       54, this->repeated_string_piece(i), output);
   }
   
@@ -4540,9 +4599,9 @@ void TestAllTypes::SerializeWithCachedSizes(
   // optional string default_string_piece = 84 [default = "abc", ctype = STRING_PIECE];
   if (_has_bit(66)) {
     ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->default_string_piece().data(), this->default_string_piece().length(),
+      this->default_string_piece().data(), this->default_string_piece().size(),
       ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
+    ::google::protobuf::internal::WireFormatLite::WriteStringPiece(
       84, this->default_string_piece(), output);
   }
   
@@ -4694,10 +4753,10 @@ void TestAllTypes::SerializeWithCachedSizes(
   // optional string optional_string_piece = 24 [ctype = STRING_PIECE];
   if (_has_bit(22)) {
     ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->optional_string_piece().data(), this->optional_string_piece().length(),
+      this->optional_string_piece().data(), this->optional_string_piece().size(),
       ::google::protobuf::internal::WireFormat::SERIALIZE);
     target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+      ::google::protobuf::internal::WireFormatLite::WriteStringPieceToArray(
         24, this->optional_string_piece(), target);
   }
   
@@ -4853,10 +4912,10 @@ void TestAllTypes::SerializeWithCachedSizes(
   // repeated string repeated_string_piece = 54 [ctype = STRING_PIECE];
   for (int i = 0; i < this->repeated_string_piece_size(); i++) {
     ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->repeated_string_piece(i).data(), this->repeated_string_piece(i).length(),
+      this->repeated_string_piece(i).data(), this->repeated_string_piece(i).size(),
       ::google::protobuf::internal::WireFormat::SERIALIZE);
     target = ::google::protobuf::internal::WireFormatLite::
-      WriteStringToArray(54, this->repeated_string_piece(i), target);
+      WriteStringPieceToArray(54, this->repeated_string_piece(i), target);
   }
   
   // repeated string repeated_cord = 55 [ctype = CORD];
@@ -4971,10 +5030,10 @@ void TestAllTypes::SerializeWithCachedSizes(
   // optional string default_string_piece = 84 [default = "abc", ctype = STRING_PIECE];
   if (_has_bit(66)) {
     ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->default_string_piece().data(), this->default_string_piece().length(),
+      this->default_string_piece().data(), this->default_string_piece().size(),
       ::google::protobuf::internal::WireFormat::SERIALIZE);
     target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+      ::google::protobuf::internal::WireFormatLite::WriteStringPieceToArray(
         84, this->default_string_piece(), target);
   }
   
@@ -5143,7 +5202,7 @@ int TestAllTypes::ByteSize() const {
     // optional string optional_string_piece = 24 [ctype = STRING_PIECE];
     if (has_optional_string_piece()) {
       total_size += 2 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
+        ::google::protobuf::internal::WireFormatLite::StringPieceSize(
           this->optional_string_piece());
     }
     
@@ -5272,7 +5331,7 @@ int TestAllTypes::ByteSize() const {
     // optional string default_string_piece = 84 [default = "abc", ctype = STRING_PIECE];
     if (has_default_string_piece()) {
       total_size += 2 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
+        ::google::protobuf::internal::WireFormatLite::StringPieceSize(
           this->default_string_piece());
     }
     
@@ -5472,7 +5531,7 @@ int TestAllTypes::ByteSize() const {
   // repeated string repeated_string_piece = 54 [ctype = STRING_PIECE];
   total_size += 2 * this->repeated_string_piece_size();
   for (int i = 0; i < this->repeated_string_piece_size(); i++) {
-    total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
+    total_size += ::google::protobuf::internal::WireFormatLite::StringPieceSize(
       this->repeated_string_piece(i));
   }
   
@@ -5488,9 +5547,8 @@ int TestAllTypes::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -5604,7 +5662,7 @@ void TestAllTypes::MergeFrom(const TestAllTypes& from) {
       set_optional_import_enum(from.optional_import_enum());
     }
     if (from._has_bit(22)) {
-      set_optional_string_piece(from.optional_string_piece());
+      set_optional_string_piece(from.optional_string_piece().data(), from.optional_string_piece().size());
     }
     if (from._has_bit(23)) {
       set_optional_cord(from.optional_cord());
@@ -5670,7 +5728,7 @@ void TestAllTypes::MergeFrom(const TestAllTypes& from) {
       set_default_import_enum(from.default_import_enum());
     }
     if (from._has_bit(66)) {
-      set_default_string_piece(from.default_string_piece());
+      set_default_string_piece(from.default_string_piece().data(), from.default_string_piece().size());
     }
     if (from._has_bit(67)) {
       set_default_cord(from.default_cord());
@@ -5720,7 +5778,7 @@ void TestAllTypes::Swap(TestAllTypes* other) {
     std::swap(optional_nested_enum_, other->optional_nested_enum_);
     std::swap(optional_foreign_enum_, other->optional_foreign_enum_);
     std::swap(optional_import_enum_, other->optional_import_enum_);
-    std::swap(optional_string_piece_, other->optional_string_piece_);
+    optional_string_piece_.Swap(&other->optional_string_piece_);
     std::swap(optional_cord_, other->optional_cord_);
     repeated_int32_.Swap(&other->repeated_int32_);
     repeated_int64_.Swap(&other->repeated_int64_);
@@ -5764,7 +5822,7 @@ void TestAllTypes::Swap(TestAllTypes* other) {
     std::swap(default_nested_enum_, other->default_nested_enum_);
     std::swap(default_foreign_enum_, other->default_foreign_enum_);
     std::swap(default_import_enum_, other->default_import_enum_);
-    std::swap(default_string_piece_, other->default_string_piece_);
+    default_string_piece_.Swap(&other->default_string_piece_);
     std::swap(default_cord_, other->default_cord_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     std::swap(_has_bits_[1], other->_has_bits_[1]);
@@ -5819,9 +5877,7 @@ void TestDeprecatedFields::SharedDtor() {
 }
 
 void TestDeprecatedFields::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* TestDeprecatedFields::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -5829,7 +5885,11 @@ const ::google::protobuf::Descriptor* TestDeprecatedFields::descriptor() {
 }
 
 const TestDeprecatedFields& TestDeprecatedFields::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestDeprecatedFields* TestDeprecatedFields::default_instance_ = NULL;
@@ -5927,9 +5987,8 @@ int TestDeprecatedFields::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -6026,9 +6085,7 @@ void ForeignMessage::SharedDtor() {
 }
 
 void ForeignMessage::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* ForeignMessage::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -6036,7 +6093,11 @@ const ::google::protobuf::Descriptor* ForeignMessage::descriptor() {
 }
 
 const ForeignMessage& ForeignMessage::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto();
+  }
+  return *default_instance_;
 }
 
 ForeignMessage* ForeignMessage::default_instance_ = NULL;
@@ -6134,9 +6195,8 @@ int ForeignMessage::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -6231,9 +6291,7 @@ void TestAllExtensions::SharedDtor() {
 }
 
 void TestAllExtensions::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* TestAllExtensions::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -6241,7 +6299,11 @@ const ::google::protobuf::Descriptor* TestAllExtensions::descriptor() {
 }
 
 const TestAllExtensions& TestAllExtensions::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestAllExtensions* TestAllExtensions::default_instance_ = NULL;
@@ -6266,7 +6328,7 @@ bool TestAllExtensions::MergePartialFromCodedStream(
       return true;
     }
     if ((8u <= tag)) {
-      DO_(_extensions_.ParseField(tag, input, default_instance_,
+      DO_(_extensions_.ParseField(tag, input, &default_instance(),
                                   mutable_unknown_fields()));
       continue;
     }
@@ -6312,9 +6374,8 @@ int TestAllExtensions::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -6407,9 +6468,7 @@ void OptionalGroup_extension::SharedDtor() {
 }
 
 void OptionalGroup_extension::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* OptionalGroup_extension::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -6417,7 +6476,11 @@ const ::google::protobuf::Descriptor* OptionalGroup_extension::descriptor() {
 }
 
 const OptionalGroup_extension& OptionalGroup_extension::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto();
+  }
+  return *default_instance_;
 }
 
 OptionalGroup_extension* OptionalGroup_extension::default_instance_ = NULL;
@@ -6515,9 +6578,8 @@ int OptionalGroup_extension::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -6614,9 +6676,7 @@ void RepeatedGroup_extension::SharedDtor() {
 }
 
 void RepeatedGroup_extension::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* RepeatedGroup_extension::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -6624,7 +6684,11 @@ const ::google::protobuf::Descriptor* RepeatedGroup_extension::descriptor() {
 }
 
 const RepeatedGroup_extension& RepeatedGroup_extension::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto();
+  }
+  return *default_instance_;
 }
 
 RepeatedGroup_extension* RepeatedGroup_extension::default_instance_ = NULL;
@@ -6722,9 +6786,8 @@ int RepeatedGroup_extension::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -6826,9 +6889,7 @@ void TestNestedExtension::SharedDtor() {
 }
 
 void TestNestedExtension::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* TestNestedExtension::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -6836,7 +6897,11 @@ const ::google::protobuf::Descriptor* TestNestedExtension::descriptor() {
 }
 
 const TestNestedExtension& TestNestedExtension::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestNestedExtension* TestNestedExtension::default_instance_ = NULL;
@@ -6891,9 +6956,8 @@ int TestNestedExtension::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -6990,13 +7054,13 @@ const int TestRequired::kSingleFieldNumber;
 #endif
 ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensions,
     ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::TestRequired >, 11, false >
-  TestRequired::single(kSingleFieldNumber, ::protobuf_unittest::TestRequired::default_instance());
+  TestRequired::single(kSingleFieldNumber);
 #ifndef _MSC_VER
 const int TestRequired::kMultiFieldNumber;
 #endif
 ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensions,
     ::google::protobuf::internal::RepeatedMessageTypeTraits< ::protobuf_unittest::TestRequired >, 11, false >
-  TestRequired::multi(kMultiFieldNumber, ::protobuf_unittest::TestRequired::default_instance());
+  TestRequired::multi(kMultiFieldNumber);
 TestRequired::TestRequired()
   : ::google::protobuf::Message() {
   SharedCtor();
@@ -7059,9 +7123,7 @@ void TestRequired::SharedDtor() {
 }
 
 void TestRequired::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* TestRequired::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -7069,7 +7131,11 @@ const ::google::protobuf::Descriptor* TestRequired::descriptor() {
 }
 
 const TestRequired& TestRequired::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestRequired* TestRequired::default_instance_ = NULL;
@@ -8271,9 +8337,8 @@ int TestRequired::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -8487,7 +8552,8 @@ TestRequiredForeign::TestRequiredForeign()
 }
 
 void TestRequiredForeign::InitAsDefaultInstance() {
-  optional_message_ = const_cast< ::protobuf_unittest::TestRequired*>(&::protobuf_unittest::TestRequired::default_instance());
+  optional_message_ = const_cast< ::protobuf_unittest::TestRequired*>(
+      ::protobuf_unittest::TestRequired::internal_default_instance());
 }
 
 TestRequiredForeign::TestRequiredForeign(const TestRequiredForeign& from)
@@ -8514,9 +8580,7 @@ void TestRequiredForeign::SharedDtor() {
 }
 
 void TestRequiredForeign::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* TestRequiredForeign::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -8524,7 +8588,11 @@ const ::google::protobuf::Descriptor* TestRequiredForeign::descriptor() {
 }
 
 const TestRequiredForeign& TestRequiredForeign::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestRequiredForeign* TestRequiredForeign::default_instance_ = NULL;
@@ -8696,9 +8764,8 @@ int TestRequiredForeign::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -8783,7 +8850,8 @@ TestForeignNested::TestForeignNested()
 }
 
 void TestForeignNested::InitAsDefaultInstance() {
-  foreign_nested_ = const_cast< ::protobuf_unittest::TestAllTypes_NestedMessage*>(&::protobuf_unittest::TestAllTypes_NestedMessage::default_instance());
+  foreign_nested_ = const_cast< ::protobuf_unittest::TestAllTypes_NestedMessage*>(
+      ::protobuf_unittest::TestAllTypes_NestedMessage::internal_default_instance());
 }
 
 TestForeignNested::TestForeignNested(const TestForeignNested& from)
@@ -8809,9 +8877,7 @@ void TestForeignNested::SharedDtor() {
 }
 
 void TestForeignNested::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* TestForeignNested::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -8819,7 +8885,11 @@ const ::google::protobuf::Descriptor* TestForeignNested::descriptor() {
 }
 
 const TestForeignNested& TestForeignNested::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestForeignNested* TestForeignNested::default_instance_ = NULL;
@@ -8920,9 +8990,8 @@ int TestForeignNested::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -9017,9 +9086,7 @@ void TestEmptyMessage::SharedDtor() {
 }
 
 void TestEmptyMessage::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* TestEmptyMessage::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -9027,7 +9094,11 @@ const ::google::protobuf::Descriptor* TestEmptyMessage::descriptor() {
 }
 
 const TestEmptyMessage& TestEmptyMessage::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestEmptyMessage* TestEmptyMessage::default_instance_ = NULL;
@@ -9082,9 +9153,8 @@ int TestEmptyMessage::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -9172,9 +9242,7 @@ void TestEmptyMessageWithExtensions::SharedDtor() {
 }
 
 void TestEmptyMessageWithExtensions::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* TestEmptyMessageWithExtensions::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -9182,7 +9250,11 @@ const ::google::protobuf::Descriptor* TestEmptyMessageWithExtensions::descriptor
 }
 
 const TestEmptyMessageWithExtensions& TestEmptyMessageWithExtensions::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestEmptyMessageWithExtensions* TestEmptyMessageWithExtensions::default_instance_ = NULL;
@@ -9207,7 +9279,7 @@ bool TestEmptyMessageWithExtensions::MergePartialFromCodedStream(
       return true;
     }
     if ((8u <= tag)) {
-      DO_(_extensions_.ParseField(tag, input, default_instance_,
+      DO_(_extensions_.ParseField(tag, input, &default_instance(),
                                   mutable_unknown_fields()));
       continue;
     }
@@ -9253,9 +9325,8 @@ int TestEmptyMessageWithExtensions::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -9346,9 +9417,7 @@ void TestMultipleExtensionRanges::SharedDtor() {
 }
 
 void TestMultipleExtensionRanges::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* TestMultipleExtensionRanges::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -9356,7 +9425,11 @@ const ::google::protobuf::Descriptor* TestMultipleExtensionRanges::descriptor()
 }
 
 const TestMultipleExtensionRanges& TestMultipleExtensionRanges::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestMultipleExtensionRanges* TestMultipleExtensionRanges::default_instance_ = NULL;
@@ -9383,7 +9456,7 @@ bool TestMultipleExtensionRanges::MergePartialFromCodedStream(
     if ((336u <= tag && tag < 344u) ||
         (33144u <= tag && tag < 33952u) ||
         (524288u <= tag)) {
-      DO_(_extensions_.ParseField(tag, input, default_instance_,
+      DO_(_extensions_.ParseField(tag, input, &default_instance(),
                                   mutable_unknown_fields()));
       continue;
     }
@@ -9445,9 +9518,8 @@ int TestMultipleExtensionRanges::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -9542,9 +9614,7 @@ void TestReallyLargeTagNumber::SharedDtor() {
 }
 
 void TestReallyLargeTagNumber::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* TestReallyLargeTagNumber::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -9552,7 +9622,11 @@ const ::google::protobuf::Descriptor* TestReallyLargeTagNumber::descriptor() {
 }
 
 const TestReallyLargeTagNumber& TestReallyLargeTagNumber::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestReallyLargeTagNumber* TestReallyLargeTagNumber::default_instance_ = NULL;
@@ -9684,9 +9758,8 @@ int TestReallyLargeTagNumber::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -9764,7 +9837,8 @@ TestRecursiveMessage::TestRecursiveMessage()
 }
 
 void TestRecursiveMessage::InitAsDefaultInstance() {
-  a_ = const_cast< ::protobuf_unittest::TestRecursiveMessage*>(&::protobuf_unittest::TestRecursiveMessage::default_instance());
+  a_ = const_cast< ::protobuf_unittest::TestRecursiveMessage*>(
+      ::protobuf_unittest::TestRecursiveMessage::internal_default_instance());
 }
 
 TestRecursiveMessage::TestRecursiveMessage(const TestRecursiveMessage& from)
@@ -9791,9 +9865,7 @@ void TestRecursiveMessage::SharedDtor() {
 }
 
 void TestRecursiveMessage::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* TestRecursiveMessage::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -9801,7 +9873,11 @@ const ::google::protobuf::Descriptor* TestRecursiveMessage::descriptor() {
 }
 
 const TestRecursiveMessage& TestRecursiveMessage::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestRecursiveMessage* TestRecursiveMessage::default_instance_ = NULL;
@@ -9936,9 +10012,8 @@ int TestRecursiveMessage::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -10015,7 +10090,8 @@ TestMutualRecursionA::TestMutualRecursionA()
 }
 
 void TestMutualRecursionA::InitAsDefaultInstance() {
-  bb_ = const_cast< ::protobuf_unittest::TestMutualRecursionB*>(&::protobuf_unittest::TestMutualRecursionB::default_instance());
+  bb_ = const_cast< ::protobuf_unittest::TestMutualRecursionB*>(
+      ::protobuf_unittest::TestMutualRecursionB::internal_default_instance());
 }
 
 TestMutualRecursionA::TestMutualRecursionA(const TestMutualRecursionA& from)
@@ -10041,9 +10117,7 @@ void TestMutualRecursionA::SharedDtor() {
 }
 
 void TestMutualRecursionA::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* TestMutualRecursionA::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -10051,7 +10125,11 @@ const ::google::protobuf::Descriptor* TestMutualRecursionA::descriptor() {
 }
 
 const TestMutualRecursionA& TestMutualRecursionA::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestMutualRecursionA* TestMutualRecursionA::default_instance_ = NULL;
@@ -10152,9 +10230,8 @@ int TestMutualRecursionA::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -10228,7 +10305,8 @@ TestMutualRecursionB::TestMutualRecursionB()
 }
 
 void TestMutualRecursionB::InitAsDefaultInstance() {
-  a_ = const_cast< ::protobuf_unittest::TestMutualRecursionA*>(&::protobuf_unittest::TestMutualRecursionA::default_instance());
+  a_ = const_cast< ::protobuf_unittest::TestMutualRecursionA*>(
+      ::protobuf_unittest::TestMutualRecursionA::internal_default_instance());
 }
 
 TestMutualRecursionB::TestMutualRecursionB(const TestMutualRecursionB& from)
@@ -10255,9 +10333,7 @@ void TestMutualRecursionB::SharedDtor() {
 }
 
 void TestMutualRecursionB::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* TestMutualRecursionB::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -10265,7 +10341,11 @@ const ::google::protobuf::Descriptor* TestMutualRecursionB::descriptor() {
 }
 
 const TestMutualRecursionB& TestMutualRecursionB::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestMutualRecursionB* TestMutualRecursionB::default_instance_ = NULL;
@@ -10400,9 +10480,8 @@ int TestMutualRecursionB::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -10503,9 +10582,7 @@ void TestDupFieldNumber_Foo::SharedDtor() {
 }
 
 void TestDupFieldNumber_Foo::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* TestDupFieldNumber_Foo::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -10513,7 +10590,11 @@ const ::google::protobuf::Descriptor* TestDupFieldNumber_Foo::descriptor() {
 }
 
 const TestDupFieldNumber_Foo& TestDupFieldNumber_Foo::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestDupFieldNumber_Foo* TestDupFieldNumber_Foo::default_instance_ = NULL;
@@ -10611,9 +10692,8 @@ int TestDupFieldNumber_Foo::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -10710,9 +10790,7 @@ void TestDupFieldNumber_Bar::SharedDtor() {
 }
 
 void TestDupFieldNumber_Bar::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* TestDupFieldNumber_Bar::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -10720,7 +10798,11 @@ const ::google::protobuf::Descriptor* TestDupFieldNumber_Bar::descriptor() {
 }
 
 const TestDupFieldNumber_Bar& TestDupFieldNumber_Bar::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestDupFieldNumber_Bar* TestDupFieldNumber_Bar::default_instance_ = NULL;
@@ -10818,9 +10900,8 @@ int TestDupFieldNumber_Bar::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -10895,8 +10976,10 @@ TestDupFieldNumber::TestDupFieldNumber()
 }
 
 void TestDupFieldNumber::InitAsDefaultInstance() {
-  foo_ = const_cast< ::protobuf_unittest::TestDupFieldNumber_Foo*>(&::protobuf_unittest::TestDupFieldNumber_Foo::default_instance());
-  bar_ = const_cast< ::protobuf_unittest::TestDupFieldNumber_Bar*>(&::protobuf_unittest::TestDupFieldNumber_Bar::default_instance());
+  foo_ = const_cast< ::protobuf_unittest::TestDupFieldNumber_Foo*>(
+      ::protobuf_unittest::TestDupFieldNumber_Foo::internal_default_instance());
+  bar_ = const_cast< ::protobuf_unittest::TestDupFieldNumber_Bar*>(
+      ::protobuf_unittest::TestDupFieldNumber_Bar::internal_default_instance());
 }
 
 TestDupFieldNumber::TestDupFieldNumber(const TestDupFieldNumber& from)
@@ -10925,9 +11008,7 @@ void TestDupFieldNumber::SharedDtor() {
 }
 
 void TestDupFieldNumber::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* TestDupFieldNumber::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -10935,7 +11016,11 @@ const ::google::protobuf::Descriptor* TestDupFieldNumber::descriptor() {
 }
 
 const TestDupFieldNumber& TestDupFieldNumber::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestDupFieldNumber* TestDupFieldNumber::default_instance_ = NULL;
@@ -11107,9 +11192,8 @@ int TestDupFieldNumber::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -11214,9 +11298,7 @@ void TestNestedMessageHasBits_NestedMessage::SharedDtor() {
 }
 
 void TestNestedMessageHasBits_NestedMessage::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* TestNestedMessageHasBits_NestedMessage::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -11224,7 +11306,11 @@ const ::google::protobuf::Descriptor* TestNestedMessageHasBits_NestedMessage::de
 }
 
 const TestNestedMessageHasBits_NestedMessage& TestNestedMessageHasBits_NestedMessage::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestNestedMessageHasBits_NestedMessage* TestNestedMessageHasBits_NestedMessage::default_instance_ = NULL;
@@ -11367,9 +11453,8 @@ int TestNestedMessageHasBits_NestedMessage::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -11440,7 +11525,8 @@ TestNestedMessageHasBits::TestNestedMessageHasBits()
 }
 
 void TestNestedMessageHasBits::InitAsDefaultInstance() {
-  optional_nested_message_ = const_cast< ::protobuf_unittest::TestNestedMessageHasBits_NestedMessage*>(&::protobuf_unittest::TestNestedMessageHasBits_NestedMessage::default_instance());
+  optional_nested_message_ = const_cast< ::protobuf_unittest::TestNestedMessageHasBits_NestedMessage*>(
+      ::protobuf_unittest::TestNestedMessageHasBits_NestedMessage::internal_default_instance());
 }
 
 TestNestedMessageHasBits::TestNestedMessageHasBits(const TestNestedMessageHasBits& from)
@@ -11466,9 +11552,7 @@ void TestNestedMessageHasBits::SharedDtor() {
 }
 
 void TestNestedMessageHasBits::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* TestNestedMessageHasBits::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -11476,7 +11560,11 @@ const ::google::protobuf::Descriptor* TestNestedMessageHasBits::descriptor() {
 }
 
 const TestNestedMessageHasBits& TestNestedMessageHasBits::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestNestedMessageHasBits* TestNestedMessageHasBits::default_instance_ = NULL;
@@ -11577,9 +11665,8 @@ int TestNestedMessageHasBits::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -11643,7 +11730,6 @@ void TestNestedMessageHasBits::Swap(TestNestedMessageHasBits* other) {
 // ===================================================================
 
 const ::std::string TestCamelCaseFieldNames::_default_stringfield_;
-const ::std::string TestCamelCaseFieldNames::_default_stringpiecefield_;
 const ::std::string TestCamelCaseFieldNames::_default_cordfield_;
 #ifndef _MSC_VER
 const int TestCamelCaseFieldNames::kPrimitiveFieldFieldNumber;
@@ -11666,7 +11752,8 @@ TestCamelCaseFieldNames::TestCamelCaseFieldNames()
 }
 
 void TestCamelCaseFieldNames::InitAsDefaultInstance() {
-  messagefield_ = const_cast< ::protobuf_unittest::ForeignMessage*>(&::protobuf_unittest::ForeignMessage::default_instance());
+  messagefield_ = const_cast< ::protobuf_unittest::ForeignMessage*>(
+      ::protobuf_unittest::ForeignMessage::internal_default_instance());
 }
 
 TestCamelCaseFieldNames::TestCamelCaseFieldNames(const TestCamelCaseFieldNames& from)
@@ -11681,7 +11768,6 @@ void TestCamelCaseFieldNames::SharedCtor() {
   stringfield_ = const_cast< ::std::string*>(&_default_stringfield_);
   enumfield_ = 4;
   messagefield_ = NULL;
-  stringpiecefield_ = const_cast< ::std::string*>(&_default_stringpiecefield_);
   cordfield_ = const_cast< ::std::string*>(&_default_cordfield_);
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
@@ -11694,9 +11780,6 @@ void TestCamelCaseFieldNames::SharedDtor() {
   if (stringfield_ != &_default_stringfield_) {
     delete stringfield_;
   }
-  if (stringpiecefield_ != &_default_stringpiecefield_) {
-    delete stringpiecefield_;
-  }
   if (cordfield_ != &_default_cordfield_) {
     delete cordfield_;
   }
@@ -11706,9 +11789,7 @@ void TestCamelCaseFieldNames::SharedDtor() {
 }
 
 void TestCamelCaseFieldNames::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* TestCamelCaseFieldNames::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -11716,7 +11797,11 @@ const ::google::protobuf::Descriptor* TestCamelCaseFieldNames::descriptor() {
 }
 
 const TestCamelCaseFieldNames& TestCamelCaseFieldNames::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestCamelCaseFieldNames* TestCamelCaseFieldNames::default_instance_ = NULL;
@@ -11738,9 +11823,7 @@ void TestCamelCaseFieldNames::Clear() {
       if (messagefield_ != NULL) messagefield_->::protobuf_unittest::ForeignMessage::Clear();
     }
     if (_has_bit(4)) {
-      if (stringpiecefield_ != &_default_stringpiecefield_) {
-        stringpiecefield_->clear();
-      }
+      stringpiecefield_.Clear();
     }
     if (_has_bit(5)) {
       if (cordfield_ != &_default_cordfield_) {
@@ -11836,10 +11919,11 @@ bool TestCamelCaseFieldNames::MergePartialFromCodedStream(
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
             ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
          parse_StringPieceField:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_stringpiecefield()));
+          _set_bit(4);
+          DO_(::google::protobuf::internal::WireFormatLite::ReadStringPiece(
+                input, &stringpiecefield_));
           ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->stringpiecefield().data(), this->stringpiecefield().length(),
+            this->stringpiecefield().data(), this->stringpiecefield().size(),
             ::google::protobuf::internal::WireFormat::PARSE);
         } else {
           goto handle_uninterpreted;
@@ -11954,10 +12038,11 @@ bool TestCamelCaseFieldNames::MergePartialFromCodedStream(
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
             ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
          parse_RepeatedStringPieceField:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->add_repeatedstringpiecefield()));
+          DO_(::google::protobuf::internal::WireFormatLite::ReadStringPiece(
+                input, repeatedstringpiecefield_.Add()));
           ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->repeatedstringpiecefield(0).data(), this->repeatedstringpiecefield(0).length(),
+            this->repeatedstringpiecefield(this->repeatedstringpiecefield_size() - 1).data(),
+            this->repeatedstringpiecefield(this->repeatedstringpiecefield_size() - 1).size(),
             ::google::protobuf::internal::WireFormat::PARSE);
         } else {
           goto handle_uninterpreted;
@@ -12032,9 +12117,9 @@ void TestCamelCaseFieldNames::SerializeWithCachedSizes(
   // optional string StringPieceField = 5 [ctype = STRING_PIECE];
   if (_has_bit(4)) {
     ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->stringpiecefield().data(), this->stringpiecefield().length(),
+      this->stringpiecefield().data(), this->stringpiecefield().size(),
       ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
+    ::google::protobuf::internal::WireFormatLite::WriteStringPiece(
       5, this->stringpiecefield(), output);
   }
   
@@ -12076,10 +12161,10 @@ void TestCamelCaseFieldNames::SerializeWithCachedSizes(
   
   // repeated string RepeatedStringPieceField = 11 [ctype = STRING_PIECE];
   for (int i = 0; i < this->repeatedstringpiecefield_size(); i++) {
-  ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-    this->repeatedstringpiecefield(i).data(), this->repeatedstringpiecefield(i).length(),
-    ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->repeatedstringpiecefield(i).data(), this->repeatedstringpiecefield(i).size(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    ::google::protobuf::internal::WireFormatLite::WriteStringPiece(
       11, this->repeatedstringpiecefield(i), output);
   }
   
@@ -12131,10 +12216,10 @@ void TestCamelCaseFieldNames::SerializeWithCachedSizes(
   // optional string StringPieceField = 5 [ctype = STRING_PIECE];
   if (_has_bit(4)) {
     ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->stringpiecefield().data(), this->stringpiecefield().length(),
+      this->stringpiecefield().data(), this->stringpiecefield().size(),
       ::google::protobuf::internal::WireFormat::SERIALIZE);
     target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+      ::google::protobuf::internal::WireFormatLite::WriteStringPieceToArray(
         5, this->stringpiecefield(), target);
   }
   
@@ -12179,10 +12264,10 @@ void TestCamelCaseFieldNames::SerializeWithCachedSizes(
   // repeated string RepeatedStringPieceField = 11 [ctype = STRING_PIECE];
   for (int i = 0; i < this->repeatedstringpiecefield_size(); i++) {
     ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->repeatedstringpiecefield(i).data(), this->repeatedstringpiecefield(i).length(),
+      this->repeatedstringpiecefield(i).data(), this->repeatedstringpiecefield(i).size(),
       ::google::protobuf::internal::WireFormat::SERIALIZE);
     target = ::google::protobuf::internal::WireFormatLite::
-      WriteStringToArray(11, this->repeatedstringpiecefield(i), target);
+      WriteStringPieceToArray(11, this->repeatedstringpiecefield(i), target);
   }
   
   // repeated string RepeatedCordField = 12 [ctype = CORD];
@@ -12235,7 +12320,7 @@ int TestCamelCaseFieldNames::ByteSize() const {
     // optional string StringPieceField = 5 [ctype = STRING_PIECE];
     if (has_stringpiecefield()) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
+        ::google::protobuf::internal::WireFormatLite::StringPieceSize(
           this->stringpiecefield());
     }
     
@@ -12285,7 +12370,7 @@ int TestCamelCaseFieldNames::ByteSize() const {
   // repeated string RepeatedStringPieceField = 11 [ctype = STRING_PIECE];
   total_size += 1 * this->repeatedstringpiecefield_size();
   for (int i = 0; i < this->repeatedstringpiecefield_size(); i++) {
-    total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
+    total_size += ::google::protobuf::internal::WireFormatLite::StringPieceSize(
       this->repeatedstringpiecefield(i));
   }
   
@@ -12301,9 +12386,8 @@ int TestCamelCaseFieldNames::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -12341,7 +12425,7 @@ void TestCamelCaseFieldNames::MergeFrom(const TestCamelCaseFieldNames& from) {
       mutable_messagefield()->::protobuf_unittest::ForeignMessage::MergeFrom(from.messagefield());
     }
     if (from._has_bit(4)) {
-      set_stringpiecefield(from.stringpiecefield());
+      set_stringpiecefield(from.stringpiecefield().data(), from.stringpiecefield().size());
     }
     if (from._has_bit(5)) {
       set_cordfield(from.cordfield());
@@ -12373,7 +12457,7 @@ void TestCamelCaseFieldNames::Swap(TestCamelCaseFieldNames* other) {
     std::swap(stringfield_, other->stringfield_);
     std::swap(enumfield_, other->enumfield_);
     std::swap(messagefield_, other->messagefield_);
-    std::swap(stringpiecefield_, other->stringpiecefield_);
+    stringpiecefield_.Swap(&other->stringpiecefield_);
     std::swap(cordfield_, other->cordfield_);
     repeatedprimitivefield_.Swap(&other->repeatedprimitivefield_);
     repeatedstringfield_.Swap(&other->repeatedstringfield_);
@@ -12440,9 +12524,7 @@ void TestFieldOrderings::SharedDtor() {
 }
 
 void TestFieldOrderings::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* TestFieldOrderings::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -12450,7 +12532,11 @@ const ::google::protobuf::Descriptor* TestFieldOrderings::descriptor() {
 }
 
 const TestFieldOrderings& TestFieldOrderings::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestFieldOrderings* TestFieldOrderings::default_instance_ = NULL;
@@ -12536,7 +12622,7 @@ bool TestFieldOrderings::MergePartialFromCodedStream(
         }
         if ((16u <= tag && tag < 88u) ||
             (96u <= tag && tag < 808u)) {
-          DO_(_extensions_.ParseField(tag, input, default_instance_,
+          DO_(_extensions_.ParseField(tag, input, &default_instance(),
                                       mutable_unknown_fields()));
           continue;
         }
@@ -12653,9 +12739,8 @@ int TestFieldOrderings::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -12807,9 +12892,7 @@ void TestExtremeDefaultValues::SharedDtor() {
 }
 
 void TestExtremeDefaultValues::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* TestExtremeDefaultValues::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -12817,7 +12900,11 @@ const ::google::protobuf::Descriptor* TestExtremeDefaultValues::descriptor() {
 }
 
 const TestExtremeDefaultValues& TestExtremeDefaultValues::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestExtremeDefaultValues* TestExtremeDefaultValues::default_instance_ = NULL;
@@ -13528,9 +13615,8 @@ int TestExtremeDefaultValues::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -13707,9 +13793,7 @@ void OneString::SharedDtor() {
 }
 
 void OneString::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* OneString::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -13717,7 +13801,11 @@ const ::google::protobuf::Descriptor* OneString::descriptor() {
 }
 
 const OneString& OneString::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto();
+  }
+  return *default_instance_;
 }
 
 OneString* OneString::default_instance_ = NULL;
@@ -13829,9 +13917,8 @@ int OneString::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -13932,9 +14019,7 @@ void OneBytes::SharedDtor() {
 }
 
 void OneBytes::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* OneBytes::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -13942,7 +14027,11 @@ const ::google::protobuf::Descriptor* OneBytes::descriptor() {
 }
 
 const OneBytes& OneBytes::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto();
+  }
+  return *default_instance_;
 }
 
 OneBytes* OneBytes::default_instance_ = NULL;
@@ -14045,9 +14134,8 @@ int OneBytes::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -14156,9 +14244,7 @@ void TestPackedTypes::SharedDtor() {
 }
 
 void TestPackedTypes::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* TestPackedTypes::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -14166,7 +14252,11 @@ const ::google::protobuf::Descriptor* TestPackedTypes::descriptor() {
 }
 
 const TestPackedTypes& TestPackedTypes::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestPackedTypes* TestPackedTypes::default_instance_ = NULL;
@@ -14530,7 +14620,8 @@ void TestPackedTypes::SerializeWithCachedSizes(
   // repeated int32 packed_int32 = 90 [packed = true];
   if (this->packed_int32_size() > 0) {
     ::google::protobuf::internal::WireFormatLite::WriteTag(90, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
-    output->WriteVarint32(_packed_int32_cached_byte_size_);
+    output->WriteVarint32(
+        ::google::protobuf::internal::NoBarrier_Load(&_packed_int32_cached_byte_size_));
   }
   for (int i = 0; i < this->packed_int32_size(); i++) {
     ::google::protobuf::internal::WireFormatLite::WriteInt32NoTag(
@@ -14540,7 +14631,8 @@ void TestPackedTypes::SerializeWithCachedSizes(
   // repeated int64 packed_int64 = 91 [packed = true];
   if (this->packed_int64_size() > 0) {
     ::google::protobuf::internal::WireFormatLite::WriteTag(91, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
-    output->WriteVarint32(_packed_int64_cached_byte_size_);
+    output->WriteVarint32(
+        ::google::protobuf::internal::NoBarrier_Load(&_packed_int64_cached_byte_size_));
   }
   for (int i = 0; i < this->packed_int64_size(); i++) {
     ::google::protobuf::internal::WireFormatLite::WriteInt64NoTag(
@@ -14550,7 +14642,8 @@ void TestPackedTypes::SerializeWithCachedSizes(
   // repeated uint32 packed_uint32 = 92 [packed = true];
   if (this->packed_uint32_size() > 0) {
     ::google::protobuf::internal::WireFormatLite::WriteTag(92, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
-    output->WriteVarint32(_packed_uint32_cached_byte_size_);
+    output->WriteVarint32(
+        ::google::protobuf::internal::NoBarrier_Load(&_packed_uint32_cached_byte_size_));
   }
   for (int i = 0; i < this->packed_uint32_size(); i++) {
     ::google::protobuf::internal::WireFormatLite::WriteUInt32NoTag(
@@ -14560,7 +14653,8 @@ void TestPackedTypes::SerializeWithCachedSizes(
   // repeated uint64 packed_uint64 = 93 [packed = true];
   if (this->packed_uint64_size() > 0) {
     ::google::protobuf::internal::WireFormatLite::WriteTag(93, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
-    output->WriteVarint32(_packed_uint64_cached_byte_size_);
+    output->WriteVarint32(
+        ::google::protobuf::internal::NoBarrier_Load(&_packed_uint64_cached_byte_size_));
   }
   for (int i = 0; i < this->packed_uint64_size(); i++) {
     ::google::protobuf::internal::WireFormatLite::WriteUInt64NoTag(
@@ -14570,7 +14664,8 @@ void TestPackedTypes::SerializeWithCachedSizes(
   // repeated sint32 packed_sint32 = 94 [packed = true];
   if (this->packed_sint32_size() > 0) {
     ::google::protobuf::internal::WireFormatLite::WriteTag(94, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
-    output->WriteVarint32(_packed_sint32_cached_byte_size_);
+    output->WriteVarint32(
+        ::google::protobuf::internal::NoBarrier_Load(&_packed_sint32_cached_byte_size_));
   }
   for (int i = 0; i < this->packed_sint32_size(); i++) {
     ::google::protobuf::internal::WireFormatLite::WriteSInt32NoTag(
@@ -14580,7 +14675,8 @@ void TestPackedTypes::SerializeWithCachedSizes(
   // repeated sint64 packed_sint64 = 95 [packed = true];
   if (this->packed_sint64_size() > 0) {
     ::google::protobuf::internal::WireFormatLite::WriteTag(95, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
-    output->WriteVarint32(_packed_sint64_cached_byte_size_);
+    output->WriteVarint32(
+        ::google::protobuf::internal::NoBarrier_Load(&_packed_sint64_cached_byte_size_));
   }
   for (int i = 0; i < this->packed_sint64_size(); i++) {
     ::google::protobuf::internal::WireFormatLite::WriteSInt64NoTag(
@@ -14590,7 +14686,8 @@ void TestPackedTypes::SerializeWithCachedSizes(
   // repeated fixed32 packed_fixed32 = 96 [packed = true];
   if (this->packed_fixed32_size() > 0) {
     ::google::protobuf::internal::WireFormatLite::WriteTag(96, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
-    output->WriteVarint32(_packed_fixed32_cached_byte_size_);
+    output->WriteVarint32(
+        ::google::protobuf::internal::NoBarrier_Load(&_packed_fixed32_cached_byte_size_));
   }
   for (int i = 0; i < this->packed_fixed32_size(); i++) {
     ::google::protobuf::internal::WireFormatLite::WriteFixed32NoTag(
@@ -14600,7 +14697,8 @@ void TestPackedTypes::SerializeWithCachedSizes(
   // repeated fixed64 packed_fixed64 = 97 [packed = true];
   if (this->packed_fixed64_size() > 0) {
     ::google::protobuf::internal::WireFormatLite::WriteTag(97, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
-    output->WriteVarint32(_packed_fixed64_cached_byte_size_);
+    output->WriteVarint32(
+        ::google::protobuf::internal::NoBarrier_Load(&_packed_fixed64_cached_byte_size_));
   }
   for (int i = 0; i < this->packed_fixed64_size(); i++) {
     ::google::protobuf::internal::WireFormatLite::WriteFixed64NoTag(
@@ -14610,7 +14708,8 @@ void TestPackedTypes::SerializeWithCachedSizes(
   // repeated sfixed32 packed_sfixed32 = 98 [packed = true];
   if (this->packed_sfixed32_size() > 0) {
     ::google::protobuf::internal::WireFormatLite::WriteTag(98, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
-    output->WriteVarint32(_packed_sfixed32_cached_byte_size_);
+    output->WriteVarint32(
+        ::google::protobuf::internal::NoBarrier_Load(&_packed_sfixed32_cached_byte_size_));
   }
   for (int i = 0; i < this->packed_sfixed32_size(); i++) {
     ::google::protobuf::internal::WireFormatLite::WriteSFixed32NoTag(
@@ -14620,7 +14719,8 @@ void TestPackedTypes::SerializeWithCachedSizes(
   // repeated sfixed64 packed_sfixed64 = 99 [packed = true];
   if (this->packed_sfixed64_size() > 0) {
     ::google::protobuf::internal::WireFormatLite::WriteTag(99, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
-    output->WriteVarint32(_packed_sfixed64_cached_byte_size_);
+    output->WriteVarint32(
+        ::google::protobuf::internal::NoBarrier_Load(&_packed_sfixed64_cached_byte_size_));
   }
   for (int i = 0; i < this->packed_sfixed64_size(); i++) {
     ::google::protobuf::internal::WireFormatLite::WriteSFixed64NoTag(
@@ -14630,7 +14730,8 @@ void TestPackedTypes::SerializeWithCachedSizes(
   // repeated float packed_float = 100 [packed = true];
   if (this->packed_float_size() > 0) {
     ::google::protobuf::internal::WireFormatLite::WriteTag(100, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
-    output->WriteVarint32(_packed_float_cached_byte_size_);
+    output->WriteVarint32(
+        ::google::protobuf::internal::NoBarrier_Load(&_packed_float_cached_byte_size_));
   }
   for (int i = 0; i < this->packed_float_size(); i++) {
     ::google::protobuf::internal::WireFormatLite::WriteFloatNoTag(
@@ -14640,7 +14741,8 @@ void TestPackedTypes::SerializeWithCachedSizes(
   // repeated double packed_double = 101 [packed = true];
   if (this->packed_double_size() > 0) {
     ::google::protobuf::internal::WireFormatLite::WriteTag(101, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
-    output->WriteVarint32(_packed_double_cached_byte_size_);
+    output->WriteVarint32(
+        ::google::protobuf::internal::NoBarrier_Load(&_packed_double_cached_byte_size_));
   }
   for (int i = 0; i < this->packed_double_size(); i++) {
     ::google::protobuf::internal::WireFormatLite::WriteDoubleNoTag(
@@ -14650,7 +14752,8 @@ void TestPackedTypes::SerializeWithCachedSizes(
   // repeated bool packed_bool = 102 [packed = true];
   if (this->packed_bool_size() > 0) {
     ::google::protobuf::internal::WireFormatLite::WriteTag(102, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
-    output->WriteVarint32(_packed_bool_cached_byte_size_);
+    output->WriteVarint32(
+        ::google::protobuf::internal::NoBarrier_Load(&_packed_bool_cached_byte_size_));
   }
   for (int i = 0; i < this->packed_bool_size(); i++) {
     ::google::protobuf::internal::WireFormatLite::WriteBoolNoTag(
@@ -14663,7 +14766,8 @@ void TestPackedTypes::SerializeWithCachedSizes(
       103,
       ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
       output);
-    output->WriteVarint32(_packed_enum_cached_byte_size_);
+    output->WriteVarint32(
+        ::google::protobuf::internal::NoBarrier_Load(&_packed_enum_cached_byte_size_));
   }
   for (int i = 0; i < this->packed_enum_size(); i++) {
     ::google::protobuf::internal::WireFormatLite::WriteEnumNoTag(
@@ -14685,7 +14789,8 @@ void TestPackedTypes::SerializeWithCachedSizes(
       ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
       target);
     target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
-      _packed_int32_cached_byte_size_, target);
+      ::google::protobuf::internal::NoBarrier_Load(&_packed_int32_cached_byte_size_),
+      target);
   }
   for (int i = 0; i < this->packed_int32_size(); i++) {
     target = ::google::protobuf::internal::WireFormatLite::
@@ -14699,7 +14804,8 @@ void TestPackedTypes::SerializeWithCachedSizes(
       ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
       target);
     target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
-      _packed_int64_cached_byte_size_, target);
+      ::google::protobuf::internal::NoBarrier_Load(&_packed_int64_cached_byte_size_),
+      target);
   }
   for (int i = 0; i < this->packed_int64_size(); i++) {
     target = ::google::protobuf::internal::WireFormatLite::
@@ -14713,7 +14819,8 @@ void TestPackedTypes::SerializeWithCachedSizes(
       ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
       target);
     target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
-      _packed_uint32_cached_byte_size_, target);
+      ::google::protobuf::internal::NoBarrier_Load(&_packed_uint32_cached_byte_size_),
+      target);
   }
   for (int i = 0; i < this->packed_uint32_size(); i++) {
     target = ::google::protobuf::internal::WireFormatLite::
@@ -14727,7 +14834,8 @@ void TestPackedTypes::SerializeWithCachedSizes(
       ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
       target);
     target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
-      _packed_uint64_cached_byte_size_, target);
+      ::google::protobuf::internal::NoBarrier_Load(&_packed_uint64_cached_byte_size_),
+      target);
   }
   for (int i = 0; i < this->packed_uint64_size(); i++) {
     target = ::google::protobuf::internal::WireFormatLite::
@@ -14741,7 +14849,8 @@ void TestPackedTypes::SerializeWithCachedSizes(
       ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
       target);
     target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
-      _packed_sint32_cached_byte_size_, target);
+      ::google::protobuf::internal::NoBarrier_Load(&_packed_sint32_cached_byte_size_),
+      target);
   }
   for (int i = 0; i < this->packed_sint32_size(); i++) {
     target = ::google::protobuf::internal::WireFormatLite::
@@ -14755,7 +14864,8 @@ void TestPackedTypes::SerializeWithCachedSizes(
       ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
       target);
     target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
-      _packed_sint64_cached_byte_size_, target);
+      ::google::protobuf::internal::NoBarrier_Load(&_packed_sint64_cached_byte_size_),
+      target);
   }
   for (int i = 0; i < this->packed_sint64_size(); i++) {
     target = ::google::protobuf::internal::WireFormatLite::
@@ -14769,7 +14879,8 @@ void TestPackedTypes::SerializeWithCachedSizes(
       ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
       target);
     target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
-      _packed_fixed32_cached_byte_size_, target);
+      ::google::protobuf::internal::NoBarrier_Load(&_packed_fixed32_cached_byte_size_),
+      target);
   }
   for (int i = 0; i < this->packed_fixed32_size(); i++) {
     target = ::google::protobuf::internal::WireFormatLite::
@@ -14783,7 +14894,8 @@ void TestPackedTypes::SerializeWithCachedSizes(
       ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
       target);
     target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
-      _packed_fixed64_cached_byte_size_, target);
+      ::google::protobuf::internal::NoBarrier_Load(&_packed_fixed64_cached_byte_size_),
+      target);
   }
   for (int i = 0; i < this->packed_fixed64_size(); i++) {
     target = ::google::protobuf::internal::WireFormatLite::
@@ -14797,7 +14909,8 @@ void TestPackedTypes::SerializeWithCachedSizes(
       ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
       target);
     target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
-      _packed_sfixed32_cached_byte_size_, target);
+      ::google::protobuf::internal::NoBarrier_Load(&_packed_sfixed32_cached_byte_size_),
+      target);
   }
   for (int i = 0; i < this->packed_sfixed32_size(); i++) {
     target = ::google::protobuf::internal::WireFormatLite::
@@ -14811,7 +14924,8 @@ void TestPackedTypes::SerializeWithCachedSizes(
       ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
       target);
     target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
-      _packed_sfixed64_cached_byte_size_, target);
+      ::google::protobuf::internal::NoBarrier_Load(&_packed_sfixed64_cached_byte_size_),
+      target);
   }
   for (int i = 0; i < this->packed_sfixed64_size(); i++) {
     target = ::google::protobuf::internal::WireFormatLite::
@@ -14825,7 +14939,8 @@ void TestPackedTypes::SerializeWithCachedSizes(
       ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
       target);
     target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
-      _packed_float_cached_byte_size_, target);
+      ::google::protobuf::internal::NoBarrier_Load(&_packed_float_cached_byte_size_),
+      target);
   }
   for (int i = 0; i < this->packed_float_size(); i++) {
     target = ::google::protobuf::internal::WireFormatLite::
@@ -14839,7 +14954,8 @@ void TestPackedTypes::SerializeWithCachedSizes(
       ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
       target);
     target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
-      _packed_double_cached_byte_size_, target);
+      ::google::protobuf::internal::NoBarrier_Load(&_packed_double_cached_byte_size_),
+      target);
   }
   for (int i = 0; i < this->packed_double_size(); i++) {
     target = ::google::protobuf::internal::WireFormatLite::
@@ -14853,7 +14969,8 @@ void TestPackedTypes::SerializeWithCachedSizes(
       ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
       target);
     target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
-      _packed_bool_cached_byte_size_, target);
+      ::google::protobuf::internal::NoBarrier_Load(&_packed_bool_cached_byte_size_),
+      target);
   }
   for (int i = 0; i < this->packed_bool_size(); i++) {
     target = ::google::protobuf::internal::WireFormatLite::
@@ -14866,7 +14983,8 @@ void TestPackedTypes::SerializeWithCachedSizes(
       103,
       ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
       target);
-    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(    _packed_enum_cached_byte_size_, target);
+    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(    ::google::protobuf::internal::NoBarrier_Load(&_packed_enum_cached_byte_size_),
+      target);
   }
   for (int i = 0; i < this->packed_enum_size(); i++) {
     target = ::google::protobuf::internal::WireFormatLite::WriteEnumNoTagToArray(
@@ -14894,7 +15012,8 @@ int TestPackedTypes::ByteSize() const {
       total_size += 2 +
         ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
     }
-    _packed_int32_cached_byte_size_ = data_size;
+    ::google::protobuf::internal::NoBarrier_Store(
+        &_packed_int32_cached_byte_size_, data_size);
     total_size += data_size;
   }
   
@@ -14909,7 +15028,8 @@ int TestPackedTypes::ByteSize() const {
       total_size += 2 +
         ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
     }
-    _packed_int64_cached_byte_size_ = data_size;
+    ::google::protobuf::internal::NoBarrier_Store(
+        &_packed_int64_cached_byte_size_, data_size);
     total_size += data_size;
   }
   
@@ -14924,7 +15044,8 @@ int TestPackedTypes::ByteSize() const {
       total_size += 2 +
         ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
     }
-    _packed_uint32_cached_byte_size_ = data_size;
+    ::google::protobuf::internal::NoBarrier_Store(
+        &_packed_uint32_cached_byte_size_, data_size);
     total_size += data_size;
   }
   
@@ -14939,7 +15060,8 @@ int TestPackedTypes::ByteSize() const {
       total_size += 2 +
         ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
     }
-    _packed_uint64_cached_byte_size_ = data_size;
+    ::google::protobuf::internal::NoBarrier_Store(
+        &_packed_uint64_cached_byte_size_, data_size);
     total_size += data_size;
   }
   
@@ -14954,7 +15076,8 @@ int TestPackedTypes::ByteSize() const {
       total_size += 2 +
         ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
     }
-    _packed_sint32_cached_byte_size_ = data_size;
+    ::google::protobuf::internal::NoBarrier_Store(
+        &_packed_sint32_cached_byte_size_, data_size);
     total_size += data_size;
   }
   
@@ -14969,7 +15092,8 @@ int TestPackedTypes::ByteSize() const {
       total_size += 2 +
         ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
     }
-    _packed_sint64_cached_byte_size_ = data_size;
+    ::google::protobuf::internal::NoBarrier_Store(
+        &_packed_sint64_cached_byte_size_, data_size);
     total_size += data_size;
   }
   
@@ -14981,7 +15105,8 @@ int TestPackedTypes::ByteSize() const {
       total_size += 2 +
         ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
     }
-    _packed_fixed32_cached_byte_size_ = data_size;
+    ::google::protobuf::internal::NoBarrier_Store(
+        &_packed_fixed32_cached_byte_size_, data_size);
     total_size += data_size;
   }
   
@@ -14993,7 +15118,8 @@ int TestPackedTypes::ByteSize() const {
       total_size += 2 +
         ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
     }
-    _packed_fixed64_cached_byte_size_ = data_size;
+    ::google::protobuf::internal::NoBarrier_Store(
+        &_packed_fixed64_cached_byte_size_, data_size);
     total_size += data_size;
   }
   
@@ -15005,7 +15131,8 @@ int TestPackedTypes::ByteSize() const {
       total_size += 2 +
         ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
     }
-    _packed_sfixed32_cached_byte_size_ = data_size;
+    ::google::protobuf::internal::NoBarrier_Store(
+        &_packed_sfixed32_cached_byte_size_, data_size);
     total_size += data_size;
   }
   
@@ -15017,7 +15144,8 @@ int TestPackedTypes::ByteSize() const {
       total_size += 2 +
         ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
     }
-    _packed_sfixed64_cached_byte_size_ = data_size;
+    ::google::protobuf::internal::NoBarrier_Store(
+        &_packed_sfixed64_cached_byte_size_, data_size);
     total_size += data_size;
   }
   
@@ -15029,7 +15157,8 @@ int TestPackedTypes::ByteSize() const {
       total_size += 2 +
         ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
     }
-    _packed_float_cached_byte_size_ = data_size;
+    ::google::protobuf::internal::NoBarrier_Store(
+        &_packed_float_cached_byte_size_, data_size);
     total_size += data_size;
   }
   
@@ -15041,7 +15170,8 @@ int TestPackedTypes::ByteSize() const {
       total_size += 2 +
         ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
     }
-    _packed_double_cached_byte_size_ = data_size;
+    ::google::protobuf::internal::NoBarrier_Store(
+        &_packed_double_cached_byte_size_, data_size);
     total_size += data_size;
   }
   
@@ -15053,7 +15183,8 @@ int TestPackedTypes::ByteSize() const {
       total_size += 2 +
         ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
     }
-    _packed_bool_cached_byte_size_ = data_size;
+    ::google::protobuf::internal::NoBarrier_Store(
+        &_packed_bool_cached_byte_size_, data_size);
     total_size += data_size;
   }
   
@@ -15068,7 +15199,8 @@ int TestPackedTypes::ByteSize() const {
       total_size += 2 +
         ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
     }
-    _packed_enum_cached_byte_size_ = data_size;
+    ::google::protobuf::internal::NoBarrier_Store(
+        &_packed_enum_cached_byte_size_, data_size);
     total_size += data_size;
   }
   
@@ -15077,9 +15209,8 @@ int TestPackedTypes::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -15210,9 +15341,7 @@ void TestUnpackedTypes::SharedDtor() {
 }
 
 void TestUnpackedTypes::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* TestUnpackedTypes::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -15220,7 +15349,11 @@ const ::google::protobuf::Descriptor* TestUnpackedTypes::descriptor() {
 }
 
 const TestUnpackedTypes& TestUnpackedTypes::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestUnpackedTypes* TestUnpackedTypes::default_instance_ = NULL;
@@ -15897,9 +16030,8 @@ int TestUnpackedTypes::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -16016,9 +16148,7 @@ void TestPackedExtensions::SharedDtor() {
 }
 
 void TestPackedExtensions::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* TestPackedExtensions::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -16026,7 +16156,11 @@ const ::google::protobuf::Descriptor* TestPackedExtensions::descriptor() {
 }
 
 const TestPackedExtensions& TestPackedExtensions::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestPackedExtensions* TestPackedExtensions::default_instance_ = NULL;
@@ -16051,7 +16185,7 @@ bool TestPackedExtensions::MergePartialFromCodedStream(
       return true;
     }
     if ((8u <= tag)) {
-      DO_(_extensions_.ParseField(tag, input, default_instance_,
+      DO_(_extensions_.ParseField(tag, input, &default_instance(),
                                   mutable_unknown_fields()));
       continue;
     }
@@ -16097,9 +16231,8 @@ int TestPackedExtensions::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -16215,9 +16348,7 @@ void TestDynamicExtensions_DynamicMessageType::SharedDtor() {
 }
 
 void TestDynamicExtensions_DynamicMessageType::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* TestDynamicExtensions_DynamicMessageType::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -16225,7 +16356,11 @@ const ::google::protobuf::Descriptor* TestDynamicExtensions_DynamicMessageType::
 }
 
 const TestDynamicExtensions_DynamicMessageType& TestDynamicExtensions_DynamicMessageType::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestDynamicExtensions_DynamicMessageType* TestDynamicExtensions_DynamicMessageType::default_instance_ = NULL;
@@ -16323,9 +16458,8 @@ int TestDynamicExtensions_DynamicMessageType::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -16404,8 +16538,10 @@ TestDynamicExtensions::TestDynamicExtensions()
 }
 
 void TestDynamicExtensions::InitAsDefaultInstance() {
-  message_extension_ = const_cast< ::protobuf_unittest::ForeignMessage*>(&::protobuf_unittest::ForeignMessage::default_instance());
-  dynamic_message_extension_ = const_cast< ::protobuf_unittest::TestDynamicExtensions_DynamicMessageType*>(&::protobuf_unittest::TestDynamicExtensions_DynamicMessageType::default_instance());
+  message_extension_ = const_cast< ::protobuf_unittest::ForeignMessage*>(
+      ::protobuf_unittest::ForeignMessage::internal_default_instance());
+  dynamic_message_extension_ = const_cast< ::protobuf_unittest::TestDynamicExtensions_DynamicMessageType*>(
+      ::protobuf_unittest::TestDynamicExtensions_DynamicMessageType::internal_default_instance());
 }
 
 TestDynamicExtensions::TestDynamicExtensions(const TestDynamicExtensions& from)
@@ -16436,9 +16572,7 @@ void TestDynamicExtensions::SharedDtor() {
 }
 
 void TestDynamicExtensions::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* TestDynamicExtensions::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -16446,7 +16580,11 @@ const ::google::protobuf::Descriptor* TestDynamicExtensions::descriptor() {
 }
 
 const TestDynamicExtensions& TestDynamicExtensions::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestDynamicExtensions* TestDynamicExtensions::default_instance_ = NULL;
@@ -16662,7 +16800,8 @@ void TestDynamicExtensions::SerializeWithCachedSizes(
   // repeated sint32 packed_extension = 2006 [packed = true];
   if (this->packed_extension_size() > 0) {
     ::google::protobuf::internal::WireFormatLite::WriteTag(2006, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
-    output->WriteVarint32(_packed_extension_cached_byte_size_);
+    output->WriteVarint32(
+        ::google::protobuf::internal::NoBarrier_Load(&_packed_extension_cached_byte_size_));
   }
   for (int i = 0; i < this->packed_extension_size(); i++) {
     ::google::protobuf::internal::WireFormatLite::WriteSInt32NoTag(
@@ -16724,7 +16863,8 @@ void TestDynamicExtensions::SerializeWithCachedSizes(
       ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
       target);
     target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
-      _packed_extension_cached_byte_size_, target);
+      ::google::protobuf::internal::NoBarrier_Load(&_packed_extension_cached_byte_size_),
+      target);
   }
   for (int i = 0; i < this->packed_extension_size(); i++) {
     target = ::google::protobuf::internal::WireFormatLite::
@@ -16792,7 +16932,8 @@ int TestDynamicExtensions::ByteSize() const {
       total_size += 2 +
         ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
     }
-    _packed_extension_cached_byte_size_ = data_size;
+    ::google::protobuf::internal::NoBarrier_Store(
+        &_packed_extension_cached_byte_size_, data_size);
     total_size += data_size;
   }
   
@@ -16801,9 +16942,8 @@ int TestDynamicExtensions::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -16924,9 +17064,7 @@ void TestRepeatedScalarDifferentTagSizes::SharedDtor() {
 }
 
 void TestRepeatedScalarDifferentTagSizes::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* TestRepeatedScalarDifferentTagSizes::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -16934,7 +17072,11 @@ const ::google::protobuf::Descriptor* TestRepeatedScalarDifferentTagSizes::descr
 }
 
 const TestRepeatedScalarDifferentTagSizes& TestRepeatedScalarDifferentTagSizes::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestRepeatedScalarDifferentTagSizes* TestRepeatedScalarDifferentTagSizes::default_instance_ = NULL;
@@ -17256,9 +17398,8 @@ int TestRepeatedScalarDifferentTagSizes::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -17325,6 +17466,363 @@ void TestRepeatedScalarDifferentTagSizes::Swap(TestRepeatedScalarDifferentTagSiz
 }
 
 
+// ===================================================================
+
+#ifndef _MSC_VER
+const int TestLazyMessage::kIdFieldNumber;
+const int TestLazyMessage::kLazyChildFieldNumber;
+const int TestLazyMessage::kEagerChildFieldNumber;
+const int TestLazyMessage::kLazyRequiredFieldNumber;
+#endif  // !_MSC_VER
+
+TestLazyMessage::TestLazyMessage()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+}
+
+void TestLazyMessage::InitAsDefaultInstance() {
+  eager_child_ = const_cast< ::protobuf_unittest::TestAllTypes*>(
+      ::protobuf_unittest::TestAllTypes::internal_default_instance());
+}
+
+TestLazyMessage::TestLazyMessage(const TestLazyMessage& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void TestLazyMessage::SharedCtor() {
+  _cached_size_ = 0;
+  id_ = 0;
+  eager_child_ = NULL;
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+TestLazyMessage::~TestLazyMessage() {
+  SharedDtor();
+}
+
+void TestLazyMessage::SharedDtor() {
+  if (this != default_instance_) {
+    delete eager_child_;
+  }
+}
+
+void TestLazyMessage::SetCachedSize(int size) const {
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
+}
+const ::google::protobuf::Descriptor* TestLazyMessage::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return TestLazyMessage_descriptor_;
+}
+
+const TestLazyMessage& TestLazyMessage::default_instance() {
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto();
+  }
+  return *default_instance_;
+}
+
+TestLazyMessage* TestLazyMessage::default_instance_ = NULL;
+
+TestLazyMessage* TestLazyMessage::New() const {
+  return new TestLazyMessage;
+}
+
+void TestLazyMessage::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    id_ = 0;
+    if (_has_bit(1)) {
+      lazy_child_.Clear();
+    }
+    if (_has_bit(2)) {
+      if (eager_child_ != NULL) eager_child_->::protobuf_unittest::TestAllTypes::Clear();
+    }
+    if (_has_bit(3)) {
+      lazy_required_.Clear();
+    }
+  }
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool TestLazyMessage::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
+  ::google::protobuf::uint32 tag;
+  while ((tag = input->ReadTag()) != 0) {
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional int32 id = 1;
+      case 1: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &id_)));
+          _set_bit(0);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(18)) goto parse_lazy_child;
+        break;
+      }
+      
+      // optional .protobuf_unittest.TestAllTypes lazy_child = 2 [lazy = true];
+      case 2: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_lazy_child:
+          _set_bit(1);
+          DO_(lazy_child_.MergeFromCodedStream(input));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(26)) goto parse_eager_child;
+        break;
+      }
+      
+      // optional .protobuf_unittest.TestAllTypes eager_child = 3;
+      case 3: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_eager_child:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_eager_child()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(34)) goto parse_lazy_required;
+        break;
+      }
+      
+      // optional .protobuf_unittest.TestRequired lazy_required = 4 [lazy = true];
+      case 4: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_lazy_required:
+          _set_bit(3);
+          DO_(lazy_required_.MergeFromCodedStream(input));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+      
+      default: {
+      handle_uninterpreted:
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+  return true;
+#undef DO_
+}
+
+void TestLazyMessage::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // optional int32 id = 1;
+  if (_has_bit(0)) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->id(), output);
+  }
+  
+  // optional .protobuf_unittest.TestAllTypes lazy_child = 2 [lazy = true];
+  if (_has_bit(1)) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(
+      2,
+      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      output);
+    lazy_child_.SerializeWithCachedSizes(output);
+  }
+  
+  // optional .protobuf_unittest.TestAllTypes eager_child = 3;
+  if (_has_bit(2)) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      3, this->eager_child(), output);
+  }
+  
+  // optional .protobuf_unittest.TestRequired lazy_required = 4 [lazy = true];
+  if (_has_bit(3)) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(
+      4,
+      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      output);
+    lazy_required_.SerializeWithCachedSizes(output);
+  }
+  
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google::protobuf::uint8* TestLazyMessage::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // optional int32 id = 1;
+  if (_has_bit(0)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->id(), target);
+  }
+  
+  // optional .protobuf_unittest.TestAllTypes lazy_child = 2 [lazy = true];
+  if (_has_bit(1)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
+      2,
+      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = lazy_child_.SerializeWithCachedSizesToArray(target);
+  }
+  
+  // optional .protobuf_unittest.TestAllTypes eager_child = 3;
+  if (_has_bit(2)) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        3, this->eager_child(), target);
+  }
+  
+  // optional .protobuf_unittest.TestRequired lazy_required = 4 [lazy = true];
+  if (_has_bit(3)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
+      4,
+      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = lazy_required_.SerializeWithCachedSizesToArray(target);
+  }
+  
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int TestLazyMessage::ByteSize() const {
+  int total_size = 0;
+  
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // optional int32 id = 1;
+    if (has_id()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->id());
+    }
+    
+    // optional .protobuf_unittest.TestAllTypes lazy_child = 2 [lazy = true];
+    if (has_lazy_child()) {
+      {
+        int size = lazy_child_.ByteSize();
+        total_size += 1 +
+          ::google::protobuf::io::CodedOutputStream::VarintSize32(size) + size;
+      }
+    }
+    
+    // optional .protobuf_unittest.TestAllTypes eager_child = 3;
+    if (has_eager_child()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->eager_child());
+    }
+    
+    // optional .protobuf_unittest.TestRequired lazy_required = 4 [lazy = true];
+    if (has_lazy_required()) {
+      {
+        int size = lazy_required_.ByteSize();
+        total_size += 1 +
+          ::google::protobuf::io::CodedOutputStream::VarintSize32(size) + size;
+      }
+    }
+    
+  }
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
+  return total_size;
+}
+
+void TestLazyMessage::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const TestLazyMessage* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const TestLazyMessage*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void TestLazyMessage::MergeFrom(const TestLazyMessage& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from._has_bit(0)) {
+      set_id(from.id());
+    }
+    if (from._has_bit(1)) {
+      _set_bit(1);
+      lazy_child_.MergeFrom(from.lazy_child_, ::protobuf_unittest::TestAllTypes::default_instance());
+    }
+    if (from._has_bit(2)) {
+      mutable_eager_child()->::protobuf_unittest::TestAllTypes::MergeFrom(from.eager_child());
+    }
+    if (from._has_bit(3)) {
+      _set_bit(3);
+      lazy_required_.MergeFrom(from.lazy_required_, ::protobuf_unittest::TestRequired::default_instance());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void TestLazyMessage::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void TestLazyMessage::CopyFrom(const TestLazyMessage& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestLazyMessage::IsInitialized() const {
+  
+  if (has_lazy_required()) {
+    if (!lazy_required_.IsInitialized()) return false;
+  }
+  return true;
+}
+
+void TestLazyMessage::Swap(TestLazyMessage* other) {
+  if (other != this) {
+    std::swap(id_, other->id_);
+    lazy_child_.Swap(&other->lazy_child_);
+    std::swap(eager_child_, other->eager_child_);
+    lazy_required_.Swap(&other->lazy_required_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata TestLazyMessage::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = TestLazyMessage_descriptor_;
+  metadata.reflection = TestLazyMessage_reflection_;
+  return metadata;
+}
+
+
 // ===================================================================
 
 #ifndef _MSC_VER
@@ -17359,9 +17857,7 @@ void FooRequest::SharedDtor() {
 }
 
 void FooRequest::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* FooRequest::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -17369,7 +17865,11 @@ const ::google::protobuf::Descriptor* FooRequest::descriptor() {
 }
 
 const FooRequest& FooRequest::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto();
+  }
+  return *default_instance_;
 }
 
 FooRequest* FooRequest::default_instance_ = NULL;
@@ -17424,9 +17924,8 @@ int FooRequest::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -17514,9 +18013,7 @@ void FooResponse::SharedDtor() {
 }
 
 void FooResponse::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* FooResponse::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -17524,7 +18021,11 @@ const ::google::protobuf::Descriptor* FooResponse::descriptor() {
 }
 
 const FooResponse& FooResponse::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto();
+  }
+  return *default_instance_;
 }
 
 FooResponse* FooResponse::default_instance_ = NULL;
@@ -17579,9 +18080,8 @@ int FooResponse::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -17669,9 +18169,7 @@ void BarRequest::SharedDtor() {
 }
 
 void BarRequest::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* BarRequest::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -17679,7 +18177,11 @@ const ::google::protobuf::Descriptor* BarRequest::descriptor() {
 }
 
 const BarRequest& BarRequest::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto();
+  }
+  return *default_instance_;
 }
 
 BarRequest* BarRequest::default_instance_ = NULL;
@@ -17734,9 +18236,8 @@ int BarRequest::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -17824,9 +18325,7 @@ void BarResponse::SharedDtor() {
 }
 
 void BarResponse::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* BarResponse::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -17834,7 +18333,11 @@ const ::google::protobuf::Descriptor* BarResponse::descriptor() {
 }
 
 const BarResponse& BarResponse::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto();
+  }
+  return *default_instance_;
 }
 
 BarResponse* BarResponse::default_instance_ = NULL;
@@ -17889,9 +18392,8 @@ int BarResponse::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -18102,16 +18604,16 @@ const ::std::string optional_bytes_extension_default("");
   optional_bytes_extension(kOptionalBytesExtensionFieldNumber, optional_bytes_extension_default);
 ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensions,
     ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::OptionalGroup_extension >, 10, false >
-  optionalgroup_extension(kOptionalgroupExtensionFieldNumber, ::protobuf_unittest::OptionalGroup_extension::default_instance());
+  optionalgroup_extension(kOptionalgroupExtensionFieldNumber);
 ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensions,
     ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::TestAllTypes_NestedMessage >, 11, false >
-  optional_nested_message_extension(kOptionalNestedMessageExtensionFieldNumber, ::protobuf_unittest::TestAllTypes_NestedMessage::default_instance());
+  optional_nested_message_extension(kOptionalNestedMessageExtensionFieldNumber);
 ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensions,
     ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::ForeignMessage >, 11, false >
-  optional_foreign_message_extension(kOptionalForeignMessageExtensionFieldNumber, ::protobuf_unittest::ForeignMessage::default_instance());
+  optional_foreign_message_extension(kOptionalForeignMessageExtensionFieldNumber);
 ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensions,
     ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest_import::ImportMessage >, 11, false >
-  optional_import_message_extension(kOptionalImportMessageExtensionFieldNumber, ::protobuf_unittest_import::ImportMessage::default_instance());
+  optional_import_message_extension(kOptionalImportMessageExtensionFieldNumber);
 ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensions,
     ::google::protobuf::internal::EnumTypeTraits< ::protobuf_unittest::TestAllTypes_NestedEnum, ::protobuf_unittest::TestAllTypes_NestedEnum_IsValid>, 14, false >
   optional_nested_enum_extension(kOptionalNestedEnumExtensionFieldNumber, static_cast< ::protobuf_unittest::TestAllTypes_NestedEnum >(1));
@@ -18178,16 +18680,16 @@ const ::std::string repeated_bytes_extension_default("");
   repeated_bytes_extension(kRepeatedBytesExtensionFieldNumber, repeated_bytes_extension_default);
 ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensions,
     ::google::protobuf::internal::RepeatedMessageTypeTraits< ::protobuf_unittest::RepeatedGroup_extension >, 10, false >
-  repeatedgroup_extension(kRepeatedgroupExtensionFieldNumber, ::protobuf_unittest::RepeatedGroup_extension::default_instance());
+  repeatedgroup_extension(kRepeatedgroupExtensionFieldNumber);
 ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensions,
     ::google::protobuf::internal::RepeatedMessageTypeTraits< ::protobuf_unittest::TestAllTypes_NestedMessage >, 11, false >
-  repeated_nested_message_extension(kRepeatedNestedMessageExtensionFieldNumber, ::protobuf_unittest::TestAllTypes_NestedMessage::default_instance());
+  repeated_nested_message_extension(kRepeatedNestedMessageExtensionFieldNumber);
 ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensions,
     ::google::protobuf::internal::RepeatedMessageTypeTraits< ::protobuf_unittest::ForeignMessage >, 11, false >
-  repeated_foreign_message_extension(kRepeatedForeignMessageExtensionFieldNumber, ::protobuf_unittest::ForeignMessage::default_instance());
+  repeated_foreign_message_extension(kRepeatedForeignMessageExtensionFieldNumber);
 ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensions,
     ::google::protobuf::internal::RepeatedMessageTypeTraits< ::protobuf_unittest_import::ImportMessage >, 11, false >
-  repeated_import_message_extension(kRepeatedImportMessageExtensionFieldNumber, ::protobuf_unittest_import::ImportMessage::default_instance());
+  repeated_import_message_extension(kRepeatedImportMessageExtensionFieldNumber);
 ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensions,
     ::google::protobuf::internal::RepeatedEnumTypeTraits< ::protobuf_unittest::TestAllTypes_NestedEnum, ::protobuf_unittest::TestAllTypes_NestedEnum_IsValid>, 14, false >
   repeated_nested_enum_extension(kRepeatedNestedEnumExtensionFieldNumber, static_cast< ::protobuf_unittest::TestAllTypes_NestedEnum >(1));
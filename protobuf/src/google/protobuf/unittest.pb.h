@@ -24,6 +24,8 @@
 #include <google/protobuf/extension_set.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/service.h>
+#include <google/protobuf/string_piece_field.h>
+#include <google/protobuf/lazy_field.h>
 #include "google/protobuf/unittest_import.pb.h"
 // @@protoc_insertion_point(includes)
 
@@ -31,6 +33,8 @@ namespace protobuf_unittest {
 
 // Internal implementation detail -- do not call these.
 void  protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();
+void  protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto();
+void protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto_impl();
 void protobuf_AssignDesc_google_2fprotobuf_2funittest_2eproto();
 void protobuf_ShutdownFile_google_2fprotobuf_2funittest_2eproto();
 
@@ -70,6 +74,7 @@ class TestPackedExtensions;
 class TestDynamicExtensions;
 class TestDynamicExtensions_DynamicMessageType;
 class TestRepeatedScalarDifferentTagSizes;
+class TestLazyMessage;
 class FooRequest;
 class FooResponse;
 class BarRequest;
@@ -206,6 +211,12 @@ class TestAllTypes_NestedMessage : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const TestAllTypes_NestedMessage& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestAllTypes_NestedMessage* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestAllTypes_NestedMessage* other);
   
   // implements Message ----------------------------------------------
@@ -224,7 +235,9 @@ class TestAllTypes_NestedMessage : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -247,10 +260,10 @@ class TestAllTypes_NestedMessage : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.TestAllTypes.NestedMessage)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::google::protobuf::int32 bb_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_2eproto();
   
@@ -295,6 +308,12 @@ class TestAllTypes_OptionalGroup : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const TestAllTypes_OptionalGroup& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestAllTypes_OptionalGroup* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestAllTypes_OptionalGroup* other);
   
   // implements Message ----------------------------------------------
@@ -313,7 +332,9 @@ class TestAllTypes_OptionalGroup : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -336,10 +357,10 @@ class TestAllTypes_OptionalGroup : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.TestAllTypes.OptionalGroup)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::google::protobuf::int32 a_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_2eproto();
   
@@ -384,6 +405,12 @@ class TestAllTypes_RepeatedGroup : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const TestAllTypes_RepeatedGroup& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestAllTypes_RepeatedGroup* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestAllTypes_RepeatedGroup* other);
   
   // implements Message ----------------------------------------------
@@ -402,7 +429,9 @@ class TestAllTypes_RepeatedGroup : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -425,10 +454,10 @@ class TestAllTypes_RepeatedGroup : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.TestAllTypes.RepeatedGroup)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::google::protobuf::int32 a_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_2eproto();
   
@@ -473,6 +502,12 @@ class TestAllTypes : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const TestAllTypes& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestAllTypes* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestAllTypes* other);
   
   // implements Message ----------------------------------------------
@@ -491,7 +526,9 @@ class TestAllTypes : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -697,14 +734,11 @@ class TestAllTypes : public ::google::protobuf::Message {
   inline bool has_optional_string_piece() const;
   inline void clear_optional_string_piece();
   static const int kOptionalStringPieceFieldNumber = 24;
- private:
-  // Hidden due to unknown ctype option.
-  inline const ::std::string& optional_string_piece() const;
+  inline const ::google::protobuf::internal::StringPieceField& optional_string_piece() const;
   inline void set_optional_string_piece(const ::std::string& value);
   inline void set_optional_string_piece(const char* value);
   inline void set_optional_string_piece(const char* value, size_t size);
   inline ::std::string* mutable_optional_string_piece();
- public:
   
   // optional string optional_cord = 25 [ctype = CORD];
   inline bool has_optional_cord() const;
@@ -989,9 +1023,7 @@ class TestAllTypes : public ::google::protobuf::Message {
   inline int repeated_string_piece_size() const;
   inline void clear_repeated_string_piece();
   static const int kRepeatedStringPieceFieldNumber = 54;
- private:
-  // Hidden due to unknown ctype option.
-  inline const ::std::string& repeated_string_piece(int index) const;
+  inline const ::google::protobuf::internal::StringPieceField& repeated_string_piece(int index) const;
   inline ::std::string* mutable_repeated_string_piece(int index);
   inline void set_repeated_string_piece(int index, const ::std::string& value);
   inline void set_repeated_string_piece(int index, const char* value);
@@ -1000,9 +1032,8 @@ class TestAllTypes : public ::google::protobuf::Message {
   inline void add_repeated_string_piece(const ::std::string& value);
   inline void add_repeated_string_piece(const char* value);
   inline void add_repeated_string_piece(const char* value, size_t size);
-  inline const ::google::protobuf::RepeatedPtrField< ::std::string>& repeated_string_piece() const;
-  inline ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_repeated_string_piece();
- public:
+  inline const ::google::protobuf::RepeatedPtrField< ::google::protobuf::internal::StringPieceField>& repeated_string_piece() const;
+  inline ::google::protobuf::RepeatedPtrField< ::google::protobuf::internal::StringPieceField>* mutable_repeated_string_piece();
   
   // repeated string repeated_cord = 55 [ctype = CORD];
   inline int repeated_cord_size() const;
@@ -1159,14 +1190,11 @@ class TestAllTypes : public ::google::protobuf::Message {
   inline bool has_default_string_piece() const;
   inline void clear_default_string_piece();
   static const int kDefaultStringPieceFieldNumber = 84;
- private:
-  // Hidden due to unknown ctype option.
-  inline const ::std::string& default_string_piece() const;
+  inline const ::google::protobuf::internal::StringPieceField& default_string_piece() const;
   inline void set_default_string_piece(const ::std::string& value);
   inline void set_default_string_piece(const char* value);
   inline void set_default_string_piece(const char* value, size_t size);
   inline ::std::string* mutable_default_string_piece();
- public:
   
   // optional string default_cord = 85 [default = "123", ctype = CORD];
   inline bool has_default_cord() const;
@@ -1184,7 +1212,7 @@ class TestAllTypes : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.TestAllTypes)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::google::protobuf::int32 optional_int32_;
   ::google::protobuf::int64 optional_int64_;
@@ -1210,8 +1238,7 @@ class TestAllTypes : public ::google::protobuf::Message {
   int optional_nested_enum_;
   int optional_foreign_enum_;
   int optional_import_enum_;
-  ::std::string* optional_string_piece_;
-  static const ::std::string _default_optional_string_piece_;
+  ::google::protobuf::internal::StringPieceField optional_string_piece_;
   ::std::string* optional_cord_;
   static const ::std::string _default_optional_cord_;
   ::google::protobuf::RepeatedField< ::google::protobuf::int32 > repeated_int32_;
@@ -1236,7 +1263,7 @@ class TestAllTypes : public ::google::protobuf::Message {
   ::google::protobuf::RepeatedField<int> repeated_nested_enum_;
   ::google::protobuf::RepeatedField<int> repeated_foreign_enum_;
   ::google::protobuf::RepeatedField<int> repeated_import_enum_;
-  ::google::protobuf::RepeatedPtrField< ::std::string> repeated_string_piece_;
+  ::google::protobuf::RepeatedPtrField< ::google::protobuf::internal::StringPieceField> repeated_string_piece_;
   ::google::protobuf::RepeatedPtrField< ::std::string> repeated_cord_;
   ::google::protobuf::int32 default_int32_;
   ::google::protobuf::int64 default_int64_;
@@ -1258,11 +1285,10 @@ class TestAllTypes : public ::google::protobuf::Message {
   int default_nested_enum_;
   int default_foreign_enum_;
   int default_import_enum_;
-  ::std::string* default_string_piece_;
-  static const ::std::string _default_default_string_piece_;
+  ::google::protobuf::internal::StringPieceField default_string_piece_;
   ::std::string* default_cord_;
   static const ::std::string _default_default_cord_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_2eproto();
   
@@ -1307,6 +1333,12 @@ class TestDeprecatedFields : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const TestDeprecatedFields& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestDeprecatedFields* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestDeprecatedFields* other);
   
   // implements Message ----------------------------------------------
@@ -1325,7 +1357,9 @@ class TestDeprecatedFields : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -1348,10 +1382,10 @@ class TestDeprecatedFields : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.TestDeprecatedFields)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::google::protobuf::int32 deprecated_int32_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_2eproto();
   
@@ -1396,6 +1430,12 @@ class ForeignMessage : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const ForeignMessage& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const ForeignMessage* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(ForeignMessage* other);
   
   // implements Message ----------------------------------------------
@@ -1414,7 +1454,9 @@ class ForeignMessage : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -1437,10 +1479,10 @@ class ForeignMessage : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.ForeignMessage)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::google::protobuf::int32 c_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_2eproto();
   
@@ -1485,6 +1527,12 @@ class TestAllExtensions : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const TestAllExtensions& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestAllExtensions* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestAllExtensions* other);
   
   // implements Message ----------------------------------------------
@@ -1503,7 +1551,9 @@ class TestAllExtensions : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -1521,9 +1571,9 @@ class TestAllExtensions : public ::google::protobuf::Message {
  private:
   ::google::protobuf::internal::ExtensionSet _extensions_;
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_2eproto();
   
@@ -1568,6 +1618,12 @@ class OptionalGroup_extension : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const OptionalGroup_extension& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const OptionalGroup_extension* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(OptionalGroup_extension* other);
   
   // implements Message ----------------------------------------------
@@ -1586,7 +1642,9 @@ class OptionalGroup_extension : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -1609,10 +1667,10 @@ class OptionalGroup_extension : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.OptionalGroup_extension)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::google::protobuf::int32 a_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_2eproto();
   
@@ -1657,6 +1715,12 @@ class RepeatedGroup_extension : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const RepeatedGroup_extension& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const RepeatedGroup_extension* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(RepeatedGroup_extension* other);
   
   // implements Message ----------------------------------------------
@@ -1675,7 +1739,9 @@ class RepeatedGroup_extension : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -1698,10 +1764,10 @@ class RepeatedGroup_extension : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.RepeatedGroup_extension)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::google::protobuf::int32 a_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_2eproto();
   
@@ -1746,6 +1812,12 @@ class TestNestedExtension : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const TestNestedExtension& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestNestedExtension* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestNestedExtension* other);
   
   // implements Message ----------------------------------------------
@@ -1764,7 +1836,9 @@ class TestNestedExtension : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -1784,9 +1858,9 @@ class TestNestedExtension : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.TestNestedExtension)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_2eproto();
   
@@ -1831,6 +1905,12 @@ class TestRequired : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const TestRequired& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestRequired* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestRequired* other);
   
   // implements Message ----------------------------------------------
@@ -1849,7 +1929,9 @@ class TestRequired : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -2104,7 +2186,7 @@ class TestRequired : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.TestRequired)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::google::protobuf::int32 a_;
   ::google::protobuf::int32 dummy2_;
@@ -2139,7 +2221,7 @@ class TestRequired : public ::google::protobuf::Message {
   ::google::protobuf::int32 dummy31_;
   ::google::protobuf::int32 dummy32_;
   ::google::protobuf::int32 c_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_2eproto();
   
@@ -2184,6 +2266,12 @@ class TestRequiredForeign : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const TestRequiredForeign& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestRequiredForeign* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestRequiredForeign* other);
   
   // implements Message ----------------------------------------------
@@ -2202,7 +2290,9 @@ class TestRequiredForeign : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -2244,12 +2334,12 @@ class TestRequiredForeign : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.TestRequiredForeign)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::protobuf_unittest::TestRequired* optional_message_;
   ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestRequired > repeated_message_;
   ::google::protobuf::int32 dummy_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_2eproto();
   
@@ -2294,6 +2384,12 @@ class TestForeignNested : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const TestForeignNested& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestForeignNested* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestForeignNested* other);
   
   // implements Message ----------------------------------------------
@@ -2312,7 +2408,9 @@ class TestForeignNested : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -2335,10 +2433,10 @@ class TestForeignNested : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.TestForeignNested)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::protobuf_unittest::TestAllTypes_NestedMessage* foreign_nested_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_2eproto();
   
@@ -2383,6 +2481,12 @@ class TestEmptyMessage : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const TestEmptyMessage& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestEmptyMessage* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestEmptyMessage* other);
   
   // implements Message ----------------------------------------------
@@ -2401,7 +2505,9 @@ class TestEmptyMessage : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -2417,9 +2523,9 @@ class TestEmptyMessage : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.TestEmptyMessage)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_2eproto();
   
@@ -2464,6 +2570,12 @@ class TestEmptyMessageWithExtensions : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const TestEmptyMessageWithExtensions& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestEmptyMessageWithExtensions* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestEmptyMessageWithExtensions* other);
   
   // implements Message ----------------------------------------------
@@ -2482,7 +2594,9 @@ class TestEmptyMessageWithExtensions : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -2500,9 +2614,9 @@ class TestEmptyMessageWithExtensions : public ::google::protobuf::Message {
  private:
   ::google::protobuf::internal::ExtensionSet _extensions_;
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_2eproto();
   
@@ -2547,6 +2661,12 @@ class TestMultipleExtensionRanges : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const TestMultipleExtensionRanges& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestMultipleExtensionRanges* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestMultipleExtensionRanges* other);
   
   // implements Message ----------------------------------------------
@@ -2565,7 +2685,9 @@ class TestMultipleExtensionRanges : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -2583,9 +2705,9 @@ class TestMultipleExtensionRanges : public ::google::protobuf::Message {
  private:
   ::google::protobuf::internal::ExtensionSet _extensions_;
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_2eproto();
   
@@ -2630,6 +2752,12 @@ class TestReallyLargeTagNumber : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const TestReallyLargeTagNumber& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestReallyLargeTagNumber* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestReallyLargeTagNumber* other);
   
   // implements Message ----------------------------------------------
@@ -2648,7 +2776,9 @@ class TestReallyLargeTagNumber : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -2678,11 +2808,11 @@ class TestReallyLargeTagNumber : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.TestReallyLargeTagNumber)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::google::protobuf::int32 a_;
   ::google::protobuf::int32 bb_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_2eproto();
   
@@ -2727,6 +2857,12 @@ class TestRecursiveMessage : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const TestRecursiveMessage& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestRecursiveMessage* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestRecursiveMessage* other);
   
   // implements Message ----------------------------------------------
@@ -2745,7 +2881,9 @@ class TestRecursiveMessage : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -2775,11 +2913,11 @@ class TestRecursiveMessage : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.TestRecursiveMessage)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::protobuf_unittest::TestRecursiveMessage* a_;
   ::google::protobuf::int32 i_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_2eproto();
   
@@ -2824,6 +2962,12 @@ class TestMutualRecursionA : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const TestMutualRecursionA& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestMutualRecursionA* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestMutualRecursionA* other);
   
   // implements Message ----------------------------------------------
@@ -2842,7 +2986,9 @@ class TestMutualRecursionA : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -2865,10 +3011,10 @@ class TestMutualRecursionA : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.TestMutualRecursionA)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::protobuf_unittest::TestMutualRecursionB* bb_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_2eproto();
   
@@ -2913,6 +3059,12 @@ class TestMutualRecursionB : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const TestMutualRecursionB& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestMutualRecursionB* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestMutualRecursionB* other);
   
   // implements Message ----------------------------------------------
@@ -2931,7 +3083,9 @@ class TestMutualRecursionB : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -2961,11 +3115,11 @@ class TestMutualRecursionB : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.TestMutualRecursionB)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::protobuf_unittest::TestMutualRecursionA* a_;
   ::google::protobuf::int32 optional_int32_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_2eproto();
   
@@ -3010,6 +3164,12 @@ class TestDupFieldNumber_Foo : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const TestDupFieldNumber_Foo& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestDupFieldNumber_Foo* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestDupFieldNumber_Foo* other);
   
   // implements Message ----------------------------------------------
@@ -3028,7 +3188,9 @@ class TestDupFieldNumber_Foo : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -3051,10 +3213,10 @@ class TestDupFieldNumber_Foo : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.TestDupFieldNumber.Foo)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::google::protobuf::int32 a_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_2eproto();
   
@@ -3099,6 +3261,12 @@ class TestDupFieldNumber_Bar : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const TestDupFieldNumber_Bar& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestDupFieldNumber_Bar* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestDupFieldNumber_Bar* other);
   
   // implements Message ----------------------------------------------
@@ -3117,7 +3285,9 @@ class TestDupFieldNumber_Bar : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -3140,10 +3310,10 @@ class TestDupFieldNumber_Bar : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.TestDupFieldNumber.Bar)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::google::protobuf::int32 a_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_2eproto();
   
@@ -3188,6 +3358,12 @@ class TestDupFieldNumber : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const TestDupFieldNumber& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestDupFieldNumber* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestDupFieldNumber* other);
   
   // implements Message ----------------------------------------------
@@ -3206,7 +3382,9 @@ class TestDupFieldNumber : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -3246,12 +3424,12 @@ class TestDupFieldNumber : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.TestDupFieldNumber)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::google::protobuf::int32 a_;
   ::protobuf_unittest::TestDupFieldNumber_Foo* foo_;
   ::protobuf_unittest::TestDupFieldNumber_Bar* bar_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_2eproto();
   
@@ -3296,6 +3474,12 @@ class TestNestedMessageHasBits_NestedMessage : public ::google::protobuf::Messag
   static const ::google::protobuf::Descriptor* descriptor();
   static const TestNestedMessageHasBits_NestedMessage& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestNestedMessageHasBits_NestedMessage* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestNestedMessageHasBits_NestedMessage* other);
   
   // implements Message ----------------------------------------------
@@ -3314,7 +3498,9 @@ class TestNestedMessageHasBits_NestedMessage : public ::google::protobuf::Messag
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -3354,11 +3540,11 @@ class TestNestedMessageHasBits_NestedMessage : public ::google::protobuf::Messag
   // @@protoc_insertion_point(class_scope:protobuf_unittest.TestNestedMessageHasBits.NestedMessage)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::google::protobuf::RepeatedField< ::google::protobuf::int32 > nestedmessage_repeated_int32_;
   ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::ForeignMessage > nestedmessage_repeated_foreignmessage_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_2eproto();
   
@@ -3403,6 +3589,12 @@ class TestNestedMessageHasBits : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const TestNestedMessageHasBits& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestNestedMessageHasBits* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestNestedMessageHasBits* other);
   
   // implements Message ----------------------------------------------
@@ -3421,7 +3613,9 @@ class TestNestedMessageHasBits : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -3446,10 +3640,10 @@ class TestNestedMessageHasBits : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.TestNestedMessageHasBits)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::protobuf_unittest::TestNestedMessageHasBits_NestedMessage* optional_nested_message_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_2eproto();
   
@@ -3494,6 +3688,12 @@ class TestCamelCaseFieldNames : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const TestCamelCaseFieldNames& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestCamelCaseFieldNames* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestCamelCaseFieldNames* other);
   
   // implements Message ----------------------------------------------
@@ -3512,7 +3712,9 @@ class TestCamelCaseFieldNames : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -3560,14 +3762,11 @@ class TestCamelCaseFieldNames : public ::google::protobuf::Message {
   inline bool has_stringpiecefield() const;
   inline void clear_stringpiecefield();
   static const int kStringPieceFieldFieldNumber = 5;
- private:
-  // Hidden due to unknown ctype option.
-  inline const ::std::string& stringpiecefield() const;
+  inline const ::google::protobuf::internal::StringPieceField& stringpiecefield() const;
   inline void set_stringpiecefield(const ::std::string& value);
   inline void set_stringpiecefield(const char* value);
   inline void set_stringpiecefield(const char* value, size_t size);
   inline ::std::string* mutable_stringpiecefield();
- public:
   
   // optional string CordField = 6 [ctype = CORD];
   inline bool has_cordfield() const;
@@ -3636,9 +3835,7 @@ class TestCamelCaseFieldNames : public ::google::protobuf::Message {
   inline int repeatedstringpiecefield_size() const;
   inline void clear_repeatedstringpiecefield();
   static const int kRepeatedStringPieceFieldFieldNumber = 11;
- private:
-  // Hidden due to unknown ctype option.
-  inline const ::std::string& repeatedstringpiecefield(int index) const;
+  inline const ::google::protobuf::internal::StringPieceField& repeatedstringpiecefield(int index) const;
   inline ::std::string* mutable_repeatedstringpiecefield(int index);
   inline void set_repeatedstringpiecefield(int index, const ::std::string& value);
   inline void set_repeatedstringpiecefield(int index, const char* value);
@@ -3647,9 +3844,8 @@ class TestCamelCaseFieldNames : public ::google::protobuf::Message {
   inline void add_repeatedstringpiecefield(const ::std::string& value);
   inline void add_repeatedstringpiecefield(const char* value);
   inline void add_repeatedstringpiecefield(const char* value, size_t size);
-  inline const ::google::protobuf::RepeatedPtrField< ::std::string>& repeatedstringpiecefield() const;
-  inline ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_repeatedstringpiecefield();
- public:
+  inline const ::google::protobuf::RepeatedPtrField< ::google::protobuf::internal::StringPieceField>& repeatedstringpiecefield() const;
+  inline ::google::protobuf::RepeatedPtrField< ::google::protobuf::internal::StringPieceField>* mutable_repeatedstringpiecefield();
   
   // repeated string RepeatedCordField = 12 [ctype = CORD];
   inline int repeatedcordfield_size() const;
@@ -3673,24 +3869,23 @@ class TestCamelCaseFieldNames : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.TestCamelCaseFieldNames)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::google::protobuf::int32 primitivefield_;
   ::std::string* stringfield_;
   static const ::std::string _default_stringfield_;
   int enumfield_;
   ::protobuf_unittest::ForeignMessage* messagefield_;
-  ::std::string* stringpiecefield_;
-  static const ::std::string _default_stringpiecefield_;
+  ::google::protobuf::internal::StringPieceField stringpiecefield_;
   ::std::string* cordfield_;
   static const ::std::string _default_cordfield_;
   ::google::protobuf::RepeatedField< ::google::protobuf::int32 > repeatedprimitivefield_;
   ::google::protobuf::RepeatedPtrField< ::std::string> repeatedstringfield_;
   ::google::protobuf::RepeatedField<int> repeatedenumfield_;
   ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::ForeignMessage > repeatedmessagefield_;
-  ::google::protobuf::RepeatedPtrField< ::std::string> repeatedstringpiecefield_;
+  ::google::protobuf::RepeatedPtrField< ::google::protobuf::internal::StringPieceField> repeatedstringpiecefield_;
   ::google::protobuf::RepeatedPtrField< ::std::string> repeatedcordfield_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_2eproto();
   
@@ -3735,6 +3930,12 @@ class TestFieldOrderings : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const TestFieldOrderings& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestFieldOrderings* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestFieldOrderings* other);
   
   // implements Message ----------------------------------------------
@@ -3753,7 +3954,9 @@ class TestFieldOrderings : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -3795,13 +3998,13 @@ class TestFieldOrderings : public ::google::protobuf::Message {
  private:
   ::google::protobuf::internal::ExtensionSet _extensions_;
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::std::string* my_string_;
   static const ::std::string _default_my_string_;
   ::google::protobuf::int64 my_int_;
   float my_float_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_2eproto();
   
@@ -3846,6 +4049,12 @@ class TestExtremeDefaultValues : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const TestExtremeDefaultValues& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestExtremeDefaultValues* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestExtremeDefaultValues* other);
   
   // implements Message ----------------------------------------------
@@ -3864,7 +4073,9 @@ class TestExtremeDefaultValues : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -4019,7 +4230,7 @@ class TestExtremeDefaultValues : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.TestExtremeDefaultValues)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::std::string* escaped_bytes_;
   static const ::std::string _default_escaped_bytes_;
@@ -4042,7 +4253,7 @@ class TestExtremeDefaultValues : public ::google::protobuf::Message {
   float inf_float_;
   float neg_inf_float_;
   float nan_float_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_2eproto();
   
@@ -4087,6 +4298,12 @@ class OneString : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const OneString& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const OneString* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(OneString* other);
   
   // implements Message ----------------------------------------------
@@ -4105,7 +4322,9 @@ class OneString : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -4131,11 +4350,11 @@ class OneString : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.OneString)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::std::string* data_;
   static const ::std::string _default_data_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_2eproto();
   
@@ -4180,6 +4399,12 @@ class OneBytes : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const OneBytes& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const OneBytes* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(OneBytes* other);
   
   // implements Message ----------------------------------------------
@@ -4198,7 +4423,9 @@ class OneBytes : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -4224,11 +4451,11 @@ class OneBytes : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.OneBytes)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::std::string* data_;
   static const ::std::string _default_data_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_2eproto();
   
@@ -4273,6 +4500,12 @@ class TestPackedTypes : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const TestPackedTypes& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestPackedTypes* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestPackedTypes* other);
   
   // implements Message ----------------------------------------------
@@ -4291,7 +4524,9 @@ class TestPackedTypes : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -4473,37 +4708,37 @@ class TestPackedTypes : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.TestPackedTypes)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::google::protobuf::RepeatedField< ::google::protobuf::int32 > packed_int32_;
-  mutable int _packed_int32_cached_byte_size_;
+  mutable ::google::protobuf::internal::Atomic32 _packed_int32_cached_byte_size_;
   ::google::protobuf::RepeatedField< ::google::protobuf::int64 > packed_int64_;
-  mutable int _packed_int64_cached_byte_size_;
+  mutable ::google::protobuf::internal::Atomic32 _packed_int64_cached_byte_size_;
   ::google::protobuf::RepeatedField< ::google::protobuf::uint32 > packed_uint32_;
-  mutable int _packed_uint32_cached_byte_size_;
+  mutable ::google::protobuf::internal::Atomic32 _packed_uint32_cached_byte_size_;
   ::google::protobuf::RepeatedField< ::google::protobuf::uint64 > packed_uint64_;
-  mutable int _packed_uint64_cached_byte_size_;
+  mutable ::google::protobuf::internal::Atomic32 _packed_uint64_cached_byte_size_;
   ::google::protobuf::RepeatedField< ::google::protobuf::int32 > packed_sint32_;
-  mutable int _packed_sint32_cached_byte_size_;
+  mutable ::google::protobuf::internal::Atomic32 _packed_sint32_cached_byte_size_;
   ::google::protobuf::RepeatedField< ::google::protobuf::int64 > packed_sint64_;
-  mutable int _packed_sint64_cached_byte_size_;
+  mutable ::google::protobuf::internal::Atomic32 _packed_sint64_cached_byte_size_;
   ::google::protobuf::RepeatedField< ::google::protobuf::uint32 > packed_fixed32_;
-  mutable int _packed_fixed32_cached_byte_size_;
+  mutable ::google::protobuf::internal::Atomic32 _packed_fixed32_cached_byte_size_;
   ::google::protobuf::RepeatedField< ::google::protobuf::uint64 > packed_fixed64_;
-  mutable int _packed_fixed64_cached_byte_size_;
+  mutable ::google::protobuf::internal::Atomic32 _packed_fixed64_cached_byte_size_;
   ::google::protobuf::RepeatedField< ::google::protobuf::int32 > packed_sfixed32_;
-  mutable int _packed_sfixed32_cached_byte_size_;
+  mutable ::google::protobuf::internal::Atomic32 _packed_sfixed32_cached_byte_size_;
   ::google::protobuf::RepeatedField< ::google::protobuf::int64 > packed_sfixed64_;
-  mutable int _packed_sfixed64_cached_byte_size_;
+  mutable ::google::protobuf::internal::Atomic32 _packed_sfixed64_cached_byte_size_;
   ::google::protobuf::RepeatedField< float > packed_float_;
-  mutable int _packed_float_cached_byte_size_;
+  mutable ::google::protobuf::internal::Atomic32 _packed_float_cached_byte_size_;
   ::google::protobuf::RepeatedField< double > packed_double_;
-  mutable int _packed_double_cached_byte_size_;
+  mutable ::google::protobuf::internal::Atomic32 _packed_double_cached_byte_size_;
   ::google::protobuf::RepeatedField< bool > packed_bool_;
-  mutable int _packed_bool_cached_byte_size_;
+  mutable ::google::protobuf::internal::Atomic32 _packed_bool_cached_byte_size_;
   ::google::protobuf::RepeatedField<int> packed_enum_;
-  mutable int _packed_enum_cached_byte_size_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();
+  mutable ::google::protobuf::internal::Atomic32 _packed_enum_cached_byte_size_;
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_2eproto();
   
@@ -4548,6 +4783,12 @@ class TestUnpackedTypes : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const TestUnpackedTypes& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestUnpackedTypes* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestUnpackedTypes* other);
   
   // implements Message ----------------------------------------------
@@ -4566,7 +4807,9 @@ class TestUnpackedTypes : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -4748,7 +4991,7 @@ class TestUnpackedTypes : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.TestUnpackedTypes)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::google::protobuf::RepeatedField< ::google::protobuf::int32 > unpacked_int32_;
   ::google::protobuf::RepeatedField< ::google::protobuf::int64 > unpacked_int64_;
@@ -4764,7 +5007,7 @@ class TestUnpackedTypes : public ::google::protobuf::Message {
   ::google::protobuf::RepeatedField< double > unpacked_double_;
   ::google::protobuf::RepeatedField< bool > unpacked_bool_;
   ::google::protobuf::RepeatedField<int> unpacked_enum_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_2eproto();
   
@@ -4809,6 +5052,12 @@ class TestPackedExtensions : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const TestPackedExtensions& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestPackedExtensions* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestPackedExtensions* other);
   
   // implements Message ----------------------------------------------
@@ -4827,7 +5076,9 @@ class TestPackedExtensions : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -4845,9 +5096,9 @@ class TestPackedExtensions : public ::google::protobuf::Message {
  private:
   ::google::protobuf::internal::ExtensionSet _extensions_;
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_2eproto();
   
@@ -4892,6 +5143,12 @@ class TestDynamicExtensions_DynamicMessageType : public ::google::protobuf::Mess
   static const ::google::protobuf::Descriptor* descriptor();
   static const TestDynamicExtensions_DynamicMessageType& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestDynamicExtensions_DynamicMessageType* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestDynamicExtensions_DynamicMessageType* other);
   
   // implements Message ----------------------------------------------
@@ -4910,7 +5167,9 @@ class TestDynamicExtensions_DynamicMessageType : public ::google::protobuf::Mess
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -4933,10 +5192,10 @@ class TestDynamicExtensions_DynamicMessageType : public ::google::protobuf::Mess
   // @@protoc_insertion_point(class_scope:protobuf_unittest.TestDynamicExtensions.DynamicMessageType)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::google::protobuf::int32 dynamic_field_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_2eproto();
   
@@ -4981,6 +5240,12 @@ class TestDynamicExtensions : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const TestDynamicExtensions& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestDynamicExtensions* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestDynamicExtensions* other);
   
   // implements Message ----------------------------------------------
@@ -4999,7 +5264,9 @@ class TestDynamicExtensions : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -5105,7 +5372,7 @@ class TestDynamicExtensions : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.TestDynamicExtensions)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::google::protobuf::uint32 scalar_extension_;
   int enum_extension_;
@@ -5114,8 +5381,8 @@ class TestDynamicExtensions : public ::google::protobuf::Message {
   ::protobuf_unittest::TestDynamicExtensions_DynamicMessageType* dynamic_message_extension_;
   ::google::protobuf::RepeatedPtrField< ::std::string> repeated_extension_;
   ::google::protobuf::RepeatedField< ::google::protobuf::int32 > packed_extension_;
-  mutable int _packed_extension_cached_byte_size_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();
+  mutable ::google::protobuf::internal::Atomic32 _packed_extension_cached_byte_size_;
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_2eproto();
   
@@ -5160,6 +5427,12 @@ class TestRepeatedScalarDifferentTagSizes : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const TestRepeatedScalarDifferentTagSizes& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestRepeatedScalarDifferentTagSizes* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestRepeatedScalarDifferentTagSizes* other);
   
   // implements Message ----------------------------------------------
@@ -5178,7 +5451,9 @@ class TestRepeatedScalarDifferentTagSizes : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -5266,7 +5541,7 @@ class TestRepeatedScalarDifferentTagSizes : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.TestRepeatedScalarDifferentTagSizes)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::google::protobuf::RepeatedField< ::google::protobuf::uint32 > repeated_fixed32_;
   ::google::protobuf::RepeatedField< ::google::protobuf::int32 > repeated_int32_;
@@ -5274,7 +5549,7 @@ class TestRepeatedScalarDifferentTagSizes : public ::google::protobuf::Message {
   ::google::protobuf::RepeatedField< ::google::protobuf::int64 > repeated_int64_;
   ::google::protobuf::RepeatedField< float > repeated_float_;
   ::google::protobuf::RepeatedField< ::google::protobuf::uint64 > repeated_uint64_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_2eproto();
   
@@ -5296,6 +5571,127 @@ class TestRepeatedScalarDifferentTagSizes : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
+class TestLazyMessage : public ::google::protobuf::Message {
+ public:
+  TestLazyMessage();
+  virtual ~TestLazyMessage();
+  
+  TestLazyMessage(const TestLazyMessage& from);
+  
+  inline TestLazyMessage& operator=(const TestLazyMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+  
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+  
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const TestLazyMessage& default_instance();
+  
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestLazyMessage* internal_default_instance() {
+    return default_instance_;
+  }
+  
+  void Swap(TestLazyMessage* other);
+  
+  // implements Message ----------------------------------------------
+  
+  TestLazyMessage* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const TestLazyMessage& from);
+  void MergeFrom(const TestLazyMessage& from);
+  void Clear();
+  bool IsInitialized() const;
+  
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+  
+  ::google::protobuf::Metadata GetMetadata() const;
+  
+  // nested types ----------------------------------------------------
+  
+  // accessors -------------------------------------------------------
+  
+  // optional int32 id = 1;
+  inline bool has_id() const;
+  inline void clear_id();
+  static const int kIdFieldNumber = 1;
+  inline ::google::protobuf::int32 id() const;
+  inline void set_id(::google::protobuf::int32 value);
+  
+  // optional .protobuf_unittest.TestAllTypes lazy_child = 2 [lazy = true];
+  inline bool has_lazy_child() const;
+  inline void clear_lazy_child();
+  static const int kLazyChildFieldNumber = 2;
+  inline const ::protobuf_unittest::TestAllTypes& lazy_child() const;
+  inline ::protobuf_unittest::TestAllTypes* mutable_lazy_child();
+  
+  // optional .protobuf_unittest.TestAllTypes eager_child = 3;
+  inline bool has_eager_child() const;
+  inline void clear_eager_child();
+  static const int kEagerChildFieldNumber = 3;
+  inline const ::protobuf_unittest::TestAllTypes& eager_child() const;
+  inline ::protobuf_unittest::TestAllTypes* mutable_eager_child();
+  
+  // optional .protobuf_unittest.TestRequired lazy_required = 4 [lazy = true];
+  inline bool has_lazy_required() const;
+  inline void clear_lazy_required();
+  static const int kLazyRequiredFieldNumber = 4;
+  inline const ::protobuf_unittest::TestRequired& lazy_required() const;
+  inline ::protobuf_unittest::TestRequired* mutable_lazy_required();
+  
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestLazyMessage)
+ private:
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
+  
+  ::google::protobuf::int32 id_;
+  ::google::protobuf::internal::LazyField lazy_child_;
+  ::protobuf_unittest::TestAllTypes* eager_child_;
+  ::google::protobuf::internal::LazyField lazy_required_;
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto_impl();
+  friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_2eproto();
+  friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_2eproto();
+  
+  ::google::protobuf::uint32 _has_bits_[(4 + 31) / 32];
+  
+  // WHY DOES & HAVE LOWER PRECEDENCE THAN != !?
+  inline bool _has_bit(int index) const {
+    return (_has_bits_[index / 32] & (1u << (index % 32))) != 0;
+  }
+  inline void _set_bit(int index) {
+    _has_bits_[index / 32] |= (1u << (index % 32));
+  }
+  inline void _clear_bit(int index) {
+    _has_bits_[index / 32] &= ~(1u << (index % 32));
+  }
+  
+  void InitAsDefaultInstance();
+  static TestLazyMessage* default_instance_;
+};
+// -------------------------------------------------------------------
+
 class FooRequest : public ::google::protobuf::Message {
  public:
   FooRequest();
@@ -5319,6 +5715,12 @@ class FooRequest : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const FooRequest& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const FooRequest* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(FooRequest* other);
   
   // implements Message ----------------------------------------------
@@ -5337,7 +5739,9 @@ class FooRequest : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -5353,9 +5757,9 @@ class FooRequest : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.FooRequest)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_2eproto();
   
@@ -5400,6 +5804,12 @@ class FooResponse : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const FooResponse& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const FooResponse* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(FooResponse* other);
   
   // implements Message ----------------------------------------------
@@ -5418,7 +5828,9 @@ class FooResponse : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -5434,9 +5846,9 @@ class FooResponse : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.FooResponse)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_2eproto();
   
@@ -5481,6 +5893,12 @@ class BarRequest : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const BarRequest& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const BarRequest* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(BarRequest* other);
   
   // implements Message ----------------------------------------------
@@ -5499,7 +5917,9 @@ class BarRequest : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -5515,9 +5935,9 @@ class BarRequest : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.BarRequest)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_2eproto();
   
@@ -5562,6 +5982,12 @@ class BarResponse : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const BarResponse& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const BarResponse* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(BarResponse* other);
   
   // implements Message ----------------------------------------------
@@ -5580,7 +6006,9 @@ class BarResponse : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -5596,9 +6024,9 @@ class BarResponse : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.BarResponse)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_2eproto();
   
@@ -6389,7 +6817,7 @@ inline void TestAllTypes::clear_optionalgroup() {
   _clear_bit(15);
 }
 inline const ::protobuf_unittest::TestAllTypes_OptionalGroup& TestAllTypes::optionalgroup() const {
-  return optionalgroup_ != NULL ? *optionalgroup_ : *default_instance_->optionalgroup_;
+  return optionalgroup_ != NULL ? *optionalgroup_ : ::protobuf_unittest::TestAllTypes_OptionalGroup::default_instance();
 }
 inline ::protobuf_unittest::TestAllTypes_OptionalGroup* TestAllTypes::mutable_optionalgroup() {
   _set_bit(15);
@@ -6406,7 +6834,7 @@ inline void TestAllTypes::clear_optional_nested_message() {
   _clear_bit(16);
 }
 inline const ::protobuf_unittest::TestAllTypes_NestedMessage& TestAllTypes::optional_nested_message() const {
-  return optional_nested_message_ != NULL ? *optional_nested_message_ : *default_instance_->optional_nested_message_;
+  return optional_nested_message_ != NULL ? *optional_nested_message_ : ::protobuf_unittest::TestAllTypes_NestedMessage::default_instance();
 }
 inline ::protobuf_unittest::TestAllTypes_NestedMessage* TestAllTypes::mutable_optional_nested_message() {
   _set_bit(16);
@@ -6423,7 +6851,7 @@ inline void TestAllTypes::clear_optional_foreign_message() {
   _clear_bit(17);
 }
 inline const ::protobuf_unittest::ForeignMessage& TestAllTypes::optional_foreign_message() const {
-  return optional_foreign_message_ != NULL ? *optional_foreign_message_ : *default_instance_->optional_foreign_message_;
+  return optional_foreign_message_ != NULL ? *optional_foreign_message_ : ::protobuf_unittest::ForeignMessage::default_instance();
 }
 inline ::protobuf_unittest::ForeignMessage* TestAllTypes::mutable_optional_foreign_message() {
   _set_bit(17);
@@ -6440,7 +6868,7 @@ inline void TestAllTypes::clear_optional_import_message() {
   _clear_bit(18);
 }
 inline const ::protobuf_unittest_import::ImportMessage& TestAllTypes::optional_import_message() const {
-  return optional_import_message_ != NULL ? *optional_import_message_ : *default_instance_->optional_import_message_;
+  return optional_import_message_ != NULL ? *optional_import_message_ : ::protobuf_unittest_import::ImportMessage::default_instance();
 }
 inline ::protobuf_unittest_import::ImportMessage* TestAllTypes::mutable_optional_import_message() {
   _set_bit(18);
@@ -6504,41 +6932,27 @@ inline bool TestAllTypes::has_optional_string_piece() const {
   return _has_bit(22);
 }
 inline void TestAllTypes::clear_optional_string_piece() {
-  if (optional_string_piece_ != &_default_optional_string_piece_) {
-    optional_string_piece_->clear();
-  }
+  optional_string_piece_.Clear();
   _clear_bit(22);
 }
-inline const ::std::string& TestAllTypes::optional_string_piece() const {
-  return *optional_string_piece_;
+inline const ::google::protobuf::internal::StringPieceField& TestAllTypes::optional_string_piece() const {
+  return optional_string_piece_;
 }
 inline void TestAllTypes::set_optional_string_piece(const ::std::string& value) {
   _set_bit(22);
-  if (optional_string_piece_ == &_default_optional_string_piece_) {
-    optional_string_piece_ = new ::std::string;
-  }
-  optional_string_piece_->assign(value);
+  optional_string_piece_.CopyFrom(value.data(), value.size());
 }
 inline void TestAllTypes::set_optional_string_piece(const char* value) {
   _set_bit(22);
-  if (optional_string_piece_ == &_default_optional_string_piece_) {
-    optional_string_piece_ = new ::std::string;
-  }
-  optional_string_piece_->assign(value);
+  optional_string_piece_.CopyFrom(value, strlen(value));
 }
 inline void TestAllTypes::set_optional_string_piece(const char* value, size_t size) {
   _set_bit(22);
-  if (optional_string_piece_ == &_default_optional_string_piece_) {
-    optional_string_piece_ = new ::std::string;
-  }
-  optional_string_piece_->assign(reinterpret_cast<const char*>(value), size);
+  optional_string_piece_.CopyFrom(reinterpret_cast<const char*>(value), size);
 }
 inline ::std::string* TestAllTypes::mutable_optional_string_piece() {
   _set_bit(22);
-  if (optional_string_piece_ == &_default_optional_string_piece_) {
-    optional_string_piece_ = new ::std::string;
-  }
-  return optional_string_piece_;
+  return optional_string_piece_.Mutable();
 }
 
 // optional string optional_cord = 25 [ctype = CORD];
@@ -7184,39 +7598,39 @@ inline int TestAllTypes::repeated_string_piece_size() const {
 inline void TestAllTypes::clear_repeated_string_piece() {
   repeated_string_piece_.Clear();
 }
-inline const ::std::string& TestAllTypes::repeated_string_piece(int index) const {
+inline const ::google::protobuf::internal::StringPieceField& TestAllTypes::repeated_string_piece(int index) const {
   return repeated_string_piece_.Get(index);
 }
 inline ::std::string* TestAllTypes::mutable_repeated_string_piece(int index) {
-  return repeated_string_piece_.Mutable(index);
+  return repeated_string_piece_.Mutable(index)->Mutable();
 }
 inline void TestAllTypes::set_repeated_string_piece(int index, const ::std::string& value) {
-  repeated_string_piece_.Mutable(index)->assign(value);
+  repeated_string_piece_.Mutable(index)->CopyFrom(value.data(), value.size());
 }
 inline void TestAllTypes::set_repeated_string_piece(int index, const char* value) {
-  repeated_string_piece_.Mutable(index)->assign(value);
+  repeated_string_piece_.Mutable(index)->CopyFrom(value, strlen(value));
 }
 inline void TestAllTypes::set_repeated_string_piece(int index, const char* value, size_t size) {
-  repeated_string_piece_.Mutable(index)->assign(
+  repeated_string_piece_.Mutable(index)->CopyFrom(
     reinterpret_cast<const char*>(value), size);
 }
 inline ::std::string* TestAllTypes::add_repeated_string_piece() {
-  return repeated_string_piece_.Add();
+  return repeated_string_piece_.Add()->Mutable();
 }
 inline void TestAllTypes::add_repeated_string_piece(const ::std::string& value) {
-  repeated_string_piece_.Add()->assign(value);
+  repeated_string_piece_.Add()->CopyFrom(value.data(), value.size());
 }
 inline void TestAllTypes::add_repeated_string_piece(const char* value) {
-  repeated_string_piece_.Add()->assign(value);
+  repeated_string_piece_.Add()->CopyFrom(value, strlen(value));
 }
 inline void TestAllTypes::add_repeated_string_piece(const char* value, size_t size) {
-  repeated_string_piece_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  repeated_string_piece_.Add()->CopyFrom(reinterpret_cast<const char*>(value), size);
 }
-inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+inline const ::google::protobuf::RepeatedPtrField< ::google::protobuf::internal::StringPieceField>&
 TestAllTypes::repeated_string_piece() const {
   return repeated_string_piece_;
 }
-inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+inline ::google::protobuf::RepeatedPtrField< ::google::protobuf::internal::StringPieceField>*
 TestAllTypes::mutable_repeated_string_piece() {
   return &repeated_string_piece_;
 }
@@ -7613,41 +8027,27 @@ inline bool TestAllTypes::has_default_string_piece() const {
   return _has_bit(66);
 }
 inline void TestAllTypes::clear_default_string_piece() {
-  if (default_string_piece_ != &_default_default_string_piece_) {
-    default_string_piece_->assign(_default_default_string_piece_);
-  }
+  default_string_piece_.SetAliased("abc", 3);
   _clear_bit(66);
 }
-inline const ::std::string& TestAllTypes::default_string_piece() const {
-  return *default_string_piece_;
+inline const ::google::protobuf::internal::StringPieceField& TestAllTypes::default_string_piece() const {
+  return default_string_piece_;
 }
 inline void TestAllTypes::set_default_string_piece(const ::std::string& value) {
   _set_bit(66);
-  if (default_string_piece_ == &_default_default_string_piece_) {
-    default_string_piece_ = new ::std::string;
-  }
-  default_string_piece_->assign(value);
+  default_string_piece_.CopyFrom(value.data(), value.size());
 }
 inline void TestAllTypes::set_default_string_piece(const char* value) {
   _set_bit(66);
-  if (default_string_piece_ == &_default_default_string_piece_) {
-    default_string_piece_ = new ::std::string;
-  }
-  default_string_piece_->assign(value);
+  default_string_piece_.CopyFrom(value, strlen(value));
 }
 inline void TestAllTypes::set_default_string_piece(const char* value, size_t size) {
   _set_bit(66);
-  if (default_string_piece_ == &_default_default_string_piece_) {
-    default_string_piece_ = new ::std::string;
-  }
-  default_string_piece_->assign(reinterpret_cast<const char*>(value), size);
+  default_string_piece_.CopyFrom(reinterpret_cast<const char*>(value), size);
 }
 inline ::std::string* TestAllTypes::mutable_default_string_piece() {
   _set_bit(66);
-  if (default_string_piece_ == &_default_default_string_piece_) {
-    default_string_piece_ = new ::std::string(_default_default_string_piece_);
-  }
-  return default_string_piece_;
+  return default_string_piece_.Mutable();
 }
 
 // optional string default_cord = 85 [default = "123", ctype = CORD];
@@ -8325,7 +8725,7 @@ inline void TestRequiredForeign::clear_optional_message() {
   _clear_bit(0);
 }
 inline const ::protobuf_unittest::TestRequired& TestRequiredForeign::optional_message() const {
-  return optional_message_ != NULL ? *optional_message_ : *default_instance_->optional_message_;
+  return optional_message_ != NULL ? *optional_message_ : ::protobuf_unittest::TestRequired::default_instance();
 }
 inline ::protobuf_unittest::TestRequired* TestRequiredForeign::mutable_optional_message() {
   _set_bit(0);
@@ -8387,7 +8787,7 @@ inline void TestForeignNested::clear_foreign_nested() {
   _clear_bit(0);
 }
 inline const ::protobuf_unittest::TestAllTypes_NestedMessage& TestForeignNested::foreign_nested() const {
-  return foreign_nested_ != NULL ? *foreign_nested_ : *default_instance_->foreign_nested_;
+  return foreign_nested_ != NULL ? *foreign_nested_ : ::protobuf_unittest::TestAllTypes_NestedMessage::default_instance();
 }
 inline ::protobuf_unittest::TestAllTypes_NestedMessage* TestForeignNested::mutable_foreign_nested() {
   _set_bit(0);
@@ -8456,7 +8856,7 @@ inline void TestRecursiveMessage::clear_a() {
   _clear_bit(0);
 }
 inline const ::protobuf_unittest::TestRecursiveMessage& TestRecursiveMessage::a() const {
-  return a_ != NULL ? *a_ : *default_instance_->a_;
+  return a_ != NULL ? *a_ : ::protobuf_unittest::TestRecursiveMessage::default_instance();
 }
 inline ::protobuf_unittest::TestRecursiveMessage* TestRecursiveMessage::mutable_a() {
   _set_bit(0);
@@ -8493,7 +8893,7 @@ inline void TestMutualRecursionA::clear_bb() {
   _clear_bit(0);
 }
 inline const ::protobuf_unittest::TestMutualRecursionB& TestMutualRecursionA::bb() const {
-  return bb_ != NULL ? *bb_ : *default_instance_->bb_;
+  return bb_ != NULL ? *bb_ : ::protobuf_unittest::TestMutualRecursionB::default_instance();
 }
 inline ::protobuf_unittest::TestMutualRecursionB* TestMutualRecursionA::mutable_bb() {
   _set_bit(0);
@@ -8514,7 +8914,7 @@ inline void TestMutualRecursionB::clear_a() {
   _clear_bit(0);
 }
 inline const ::protobuf_unittest::TestMutualRecursionA& TestMutualRecursionB::a() const {
-  return a_ != NULL ? *a_ : *default_instance_->a_;
+  return a_ != NULL ? *a_ : ::protobuf_unittest::TestMutualRecursionA::default_instance();
 }
 inline ::protobuf_unittest::TestMutualRecursionA* TestMutualRecursionB::mutable_a() {
   _set_bit(0);
@@ -8607,7 +9007,7 @@ inline void TestDupFieldNumber::clear_foo() {
   _clear_bit(1);
 }
 inline const ::protobuf_unittest::TestDupFieldNumber_Foo& TestDupFieldNumber::foo() const {
-  return foo_ != NULL ? *foo_ : *default_instance_->foo_;
+  return foo_ != NULL ? *foo_ : ::protobuf_unittest::TestDupFieldNumber_Foo::default_instance();
 }
 inline ::protobuf_unittest::TestDupFieldNumber_Foo* TestDupFieldNumber::mutable_foo() {
   _set_bit(1);
@@ -8624,7 +9024,7 @@ inline void TestDupFieldNumber::clear_bar() {
   _clear_bit(2);
 }
 inline const ::protobuf_unittest::TestDupFieldNumber_Bar& TestDupFieldNumber::bar() const {
-  return bar_ != NULL ? *bar_ : *default_instance_->bar_;
+  return bar_ != NULL ? *bar_ : ::protobuf_unittest::TestDupFieldNumber_Bar::default_instance();
 }
 inline ::protobuf_unittest::TestDupFieldNumber_Bar* TestDupFieldNumber::mutable_bar() {
   _set_bit(2);
@@ -8699,7 +9099,7 @@ inline void TestNestedMessageHasBits::clear_optional_nested_message() {
   _clear_bit(0);
 }
 inline const ::protobuf_unittest::TestNestedMessageHasBits_NestedMessage& TestNestedMessageHasBits::optional_nested_message() const {
-  return optional_nested_message_ != NULL ? *optional_nested_message_ : *default_instance_->optional_nested_message_;
+  return optional_nested_message_ != NULL ? *optional_nested_message_ : ::protobuf_unittest::TestNestedMessageHasBits_NestedMessage::default_instance();
 }
 inline ::protobuf_unittest::TestNestedMessageHasBits_NestedMessage* TestNestedMessageHasBits::mutable_optional_nested_message() {
   _set_bit(0);
@@ -8795,7 +9195,7 @@ inline void TestCamelCaseFieldNames::clear_messagefield() {
   _clear_bit(3);
 }
 inline const ::protobuf_unittest::ForeignMessage& TestCamelCaseFieldNames::messagefield() const {
-  return messagefield_ != NULL ? *messagefield_ : *default_instance_->messagefield_;
+  return messagefield_ != NULL ? *messagefield_ : ::protobuf_unittest::ForeignMessage::default_instance();
 }
 inline ::protobuf_unittest::ForeignMessage* TestCamelCaseFieldNames::mutable_messagefield() {
   _set_bit(3);
@@ -8808,41 +9208,27 @@ inline bool TestCamelCaseFieldNames::has_stringpiecefield() const {
   return _has_bit(4);
 }
 inline void TestCamelCaseFieldNames::clear_stringpiecefield() {
-  if (stringpiecefield_ != &_default_stringpiecefield_) {
-    stringpiecefield_->clear();
-  }
+  stringpiecefield_.Clear();
   _clear_bit(4);
 }
-inline const ::std::string& TestCamelCaseFieldNames::stringpiecefield() const {
-  return *stringpiecefield_;
+inline const ::google::protobuf::internal::StringPieceField& TestCamelCaseFieldNames::stringpiecefield() const {
+  return stringpiecefield_;
 }
 inline void TestCamelCaseFieldNames::set_stringpiecefield(const ::std::string& value) {
   _set_bit(4);
-  if (stringpiecefield_ == &_default_stringpiecefield_) {
-    stringpiecefield_ = new ::std::string;
-  }
-  stringpiecefield_->assign(value);
+  stringpiecefield_.CopyFrom(value.data(), value.size());
 }
 inline void TestCamelCaseFieldNames::set_stringpiecefield(const char* value) {
   _set_bit(4);
-  if (stringpiecefield_ == &_default_stringpiecefield_) {
-    stringpiecefield_ = new ::std::string;
-  }
-  stringpiecefield_->assign(value);
+  stringpiecefield_.CopyFrom(value, strlen(value));
 }
 inline void TestCamelCaseFieldNames::set_stringpiecefield(const char* value, size_t size) {
   _set_bit(4);
-  if (stringpiecefield_ == &_default_stringpiecefield_) {
-    stringpiecefield_ = new ::std::string;
-  }
-  stringpiecefield_->assign(reinterpret_cast<const char*>(value), size);
+  stringpiecefield_.CopyFrom(reinterpret_cast<const char*>(value), size);
 }
 inline ::std::string* TestCamelCaseFieldNames::mutable_stringpiecefield() {
   _set_bit(4);
-  if (stringpiecefield_ == &_default_stringpiecefield_) {
-    stringpiecefield_ = new ::std::string;
-  }
-  return stringpiecefield_;
+  return stringpiecefield_.Mutable();
 }
 
 // optional string CordField = 6 [ctype = CORD];
@@ -9015,39 +9401,39 @@ inline int TestCamelCaseFieldNames::repeatedstringpiecefield_size() const {
 inline void TestCamelCaseFieldNames::clear_repeatedstringpiecefield() {
   repeatedstringpiecefield_.Clear();
 }
-inline const ::std::string& TestCamelCaseFieldNames::repeatedstringpiecefield(int index) const {
+inline const ::google::protobuf::internal::StringPieceField& TestCamelCaseFieldNames::repeatedstringpiecefield(int index) const {
   return repeatedstringpiecefield_.Get(index);
 }
 inline ::std::string* TestCamelCaseFieldNames::mutable_repeatedstringpiecefield(int index) {
-  return repeatedstringpiecefield_.Mutable(index);
+  return repeatedstringpiecefield_.Mutable(index)->Mutable();
 }
 inline void TestCamelCaseFieldNames::set_repeatedstringpiecefield(int index, const ::std::string& value) {
-  repeatedstringpiecefield_.Mutable(index)->assign(value);
+  repeatedstringpiecefield_.Mutable(index)->CopyFrom(value.data(), value.size());
 }
 inline void TestCamelCaseFieldNames::set_repeatedstringpiecefield(int index, const char* value) {
-  repeatedstringpiecefield_.Mutable(index)->assign(value);
+  repeatedstringpiecefield_.Mutable(index)->CopyFrom(value, strlen(value));
 }
 inline void TestCamelCaseFieldNames::set_repeatedstringpiecefield(int index, const char* value, size_t size) {
-  repeatedstringpiecefield_.Mutable(index)->assign(
+  repeatedstringpiecefield_.Mutable(index)->CopyFrom(
     reinterpret_cast<const char*>(value), size);
 }
 inline ::std::string* TestCamelCaseFieldNames::add_repeatedstringpiecefield() {
-  return repeatedstringpiecefield_.Add();
+  return repeatedstringpiecefield_.Add()->Mutable();
 }
 inline void TestCamelCaseFieldNames::add_repeatedstringpiecefield(const ::std::string& value) {
-  repeatedstringpiecefield_.Add()->assign(value);
+  repeatedstringpiecefield_.Add()->CopyFrom(value.data(), value.size());
 }
 inline void TestCamelCaseFieldNames::add_repeatedstringpiecefield(const char* value) {
-  repeatedstringpiecefield_.Add()->assign(value);
+  repeatedstringpiecefield_.Add()->CopyFrom(value, strlen(value));
 }
 inline void TestCamelCaseFieldNames::add_repeatedstringpiecefield(const char* value, size_t size) {
-  repeatedstringpiecefield_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  repeatedstringpiecefield_.Add()->CopyFrom(reinterpret_cast<const char*>(value), size);
 }
-inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+inline const ::google::protobuf::RepeatedPtrField< ::google::protobuf::internal::StringPieceField>&
 TestCamelCaseFieldNames::repeatedstringpiecefield() const {
   return repeatedstringpiecefield_;
 }
-inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+inline ::google::protobuf::RepeatedPtrField< ::google::protobuf::internal::StringPieceField>*
 TestCamelCaseFieldNames::mutable_repeatedstringpiecefield() {
   return &repeatedstringpiecefield_;
 }
@@ -10425,7 +10811,7 @@ inline void TestDynamicExtensions::clear_message_extension() {
   _clear_bit(3);
 }
 inline const ::protobuf_unittest::ForeignMessage& TestDynamicExtensions::message_extension() const {
-  return message_extension_ != NULL ? *message_extension_ : *default_instance_->message_extension_;
+  return message_extension_ != NULL ? *message_extension_ : ::protobuf_unittest::ForeignMessage::default_instance();
 }
 inline ::protobuf_unittest::ForeignMessage* TestDynamicExtensions::mutable_message_extension() {
   _set_bit(3);
@@ -10442,7 +10828,7 @@ inline void TestDynamicExtensions::clear_dynamic_message_extension() {
   _clear_bit(4);
 }
 inline const ::protobuf_unittest::TestDynamicExtensions_DynamicMessageType& TestDynamicExtensions::dynamic_message_extension() const {
-  return dynamic_message_extension_ != NULL ? *dynamic_message_extension_ : *default_instance_->dynamic_message_extension_;
+  return dynamic_message_extension_ != NULL ? *dynamic_message_extension_ : ::protobuf_unittest::TestDynamicExtensions_DynamicMessageType::default_instance();
 }
 inline ::protobuf_unittest::TestDynamicExtensions_DynamicMessageType* TestDynamicExtensions::mutable_dynamic_message_extension() {
   _set_bit(4);
@@ -10675,6 +11061,79 @@ TestRepeatedScalarDifferentTagSizes::mutable_repeated_uint64() {
 
 // -------------------------------------------------------------------
 
+// TestLazyMessage
+
+// optional int32 id = 1;
+inline bool TestLazyMessage::has_id() const {
+  return _has_bit(0);
+}
+inline void TestLazyMessage::clear_id() {
+  id_ = 0;
+  _clear_bit(0);
+}
+inline ::google::protobuf::int32 TestLazyMessage::id() const {
+  return id_;
+}
+inline void TestLazyMessage::set_id(::google::protobuf::int32 value) {
+  _set_bit(0);
+  id_ = value;
+}
+
+// optional .protobuf_unittest.TestAllTypes lazy_child = 2 [lazy = true];
+inline bool TestLazyMessage::has_lazy_child() const {
+  return _has_bit(1);
+}
+inline void TestLazyMessage::clear_lazy_child() {
+  lazy_child_.Clear();
+  _clear_bit(1);
+}
+inline const ::protobuf_unittest::TestAllTypes& TestLazyMessage::lazy_child() const {
+  return static_cast<const ::protobuf_unittest::TestAllTypes&>(
+      lazy_child_.Get(::protobuf_unittest::TestAllTypes::default_instance()));
+}
+inline ::protobuf_unittest::TestAllTypes* TestLazyMessage::mutable_lazy_child() {
+  _set_bit(1);
+  return static_cast< ::protobuf_unittest::TestAllTypes*>(
+      lazy_child_.Mutable(::protobuf_unittest::TestAllTypes::default_instance()));
+}
+
+// optional .protobuf_unittest.TestAllTypes eager_child = 3;
+inline bool TestLazyMessage::has_eager_child() const {
+  return _has_bit(2);
+}
+inline void TestLazyMessage::clear_eager_child() {
+  if (eager_child_ != NULL) eager_child_->::protobuf_unittest::TestAllTypes::Clear();
+  _clear_bit(2);
+}
+inline const ::protobuf_unittest::TestAllTypes& TestLazyMessage::eager_child() const {
+  return eager_child_ != NULL ? *eager_child_ : ::protobuf_unittest::TestAllTypes::default_instance();
+}
+inline ::protobuf_unittest::TestAllTypes* TestLazyMessage::mutable_eager_child() {
+  _set_bit(2);
+  if (eager_child_ == NULL) eager_child_ = new ::protobuf_unittest::TestAllTypes;
+  return eager_child_;
+}
+
+// optional .protobuf_unittest.TestRequired lazy_required = 4 [lazy = true];
+inline bool TestLazyMessage::has_lazy_required() const {
+  return _has_bit(3);
+}
+inline void TestLazyMessage::clear_lazy_required() {
+  lazy_required_.Clear();
+  _clear_bit(3);
+}
+inline const ::protobuf_unittest::TestRequired& TestLazyMessage::lazy_required() const {
+  return static_cast<const ::protobuf_unittest::TestRequired&>(
+      lazy_required_.Get(::protobuf_unittest::TestRequired::default_instance()));
+}
+inline ::protobuf_unittest::TestRequired* TestLazyMessage::mutable_lazy_required() {
+  _set_bit(3);
+  return static_cast< ::protobuf_unittest::TestRequired*>(
+      lazy_required_.Mutable(::protobuf_unittest::TestRequired::default_instance()));
+}
+
+// -------------------------------------------------------------------
+
 // FooRequest
 
 // -------------------------------------------------------------------
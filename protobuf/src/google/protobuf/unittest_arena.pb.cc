@@ -0,0 +1,1161 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+
+#define INTERNAL_SUPPRESS_PROTOBUF_FIELD_DEPRECATION
+#include "google/protobuf/unittest_arena.pb.h"
+#include <google/protobuf/stubs/once.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+
+namespace protobuf_unittest {
+
+namespace {
+
+const ::google::protobuf::Descriptor* TestArenaMessage_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  TestArenaMessage_reflection_ = NULL;
+const ::google::protobuf::Descriptor* TestArenaMessage_OptionalGroup_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  TestArenaMessage_OptionalGroup_reflection_ = NULL;
+
+}  // namespace
+
+
+void protobuf_AssignDesc_google_2fprotobuf_2funittest_5farena_2eproto() {
+  protobuf_AddDesc_google_2fprotobuf_2funittest_5farena_2eproto();
+  protobuf_InitDefaults_google_2fprotobuf_2funittest_5farena_2eproto();
+  const ::google::protobuf::FileDescriptor* file =
+    ::google::protobuf::DescriptorPool::generated_pool()->FindFileByName(
+      "google/protobuf/unittest_arena.proto");
+  GOOGLE_CHECK(file != NULL);
+  TestArenaMessage_descriptor_ = file->message_type(0);
+  static const int TestArenaMessage_offsets_[11] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestArenaMessage, optional_int32_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestArenaMessage, optional_string_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestArenaMessage, default_bytes_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestArenaMessage, optional_child_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestArenaMessage, optional_foreign_message_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestArenaMessage, optionalgroup_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestArenaMessage, repeated_int64_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestArenaMessage, repeated_string_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestArenaMessage, repeated_child_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestArenaMessage, repeated_foreign_message_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestArenaMessage, packed_fixed32_),
+  };
+  TestArenaMessage_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      TestArenaMessage_descriptor_,
+      TestArenaMessage::default_instance_,
+      TestArenaMessage_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestArenaMessage, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestArenaMessage, _unknown_fields_),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestArenaMessage, _extensions_),
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(TestArenaMessage));
+  TestArenaMessage_OptionalGroup_descriptor_ = TestArenaMessage_descriptor_->nested_type(0);
+  static const int TestArenaMessage_OptionalGroup_offsets_[1] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestArenaMessage_OptionalGroup, a_),
+  };
+  TestArenaMessage_OptionalGroup_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      TestArenaMessage_OptionalGroup_descriptor_,
+      TestArenaMessage_OptionalGroup::default_instance_,
+      TestArenaMessage_OptionalGroup_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestArenaMessage_OptionalGroup, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestArenaMessage_OptionalGroup, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(TestArenaMessage_OptionalGroup));
+}
+
+namespace {
+
+GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_AssignDescriptors_once_);
+inline void protobuf_AssignDescriptorsOnce() {
+  ::google::protobuf::GoogleOnceInit(&protobuf_AssignDescriptors_once_,
+                 &protobuf_AssignDesc_google_2fprotobuf_2funittest_5farena_2eproto);
+}
+
+void protobuf_RegisterTypes(const ::std::string&) {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    TestArenaMessage_descriptor_, &TestArenaMessage::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    TestArenaMessage_OptionalGroup_descriptor_, &TestArenaMessage_OptionalGroup::default_instance());
+}
+
+}  // namespace
+
+void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5farena_2eproto() {
+  delete TestArenaMessage::default_instance_;
+  delete TestArenaMessage_reflection_;
+  delete TestArenaMessage_OptionalGroup::default_instance_;
+  delete TestArenaMessage_OptionalGroup_reflection_;
+}
+
+void protobuf_InitDefaults_google_2fprotobuf_2funittest_5farena_2eproto_impl() {
+  ::protobuf_unittest::protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto();
+  TestArenaMessage::default_instance_ = new TestArenaMessage();
+  TestArenaMessage_OptionalGroup::default_instance_ = new TestArenaMessage_OptionalGroup();
+  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
+    ::protobuf_unittest::TestArenaMessage::internal_default_instance(),
+    100, 5, false, false);
+  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
+    ::protobuf_unittest::TestArenaMessage::internal_default_instance(),
+    101, 9, false, false);
+  TestArenaMessage::default_instance_->InitAsDefaultInstance();
+  TestArenaMessage_OptionalGroup::default_instance_->InitAsDefaultInstance();
+  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_google_2fprotobuf_2funittest_5farena_2eproto);
+}
+
+namespace {
+
+GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_InitDefaults_once_);
+// Set once the defaults are built, so that default_instance() and the
+// other callers on hot paths can skip the once.
+::google::protobuf::internal::Atomic32 protobuf_InitDefaults_done_ = 0;
+
+}  // namespace
+
+void protobuf_InitDefaults_google_2fprotobuf_2funittest_5farena_2eproto() {
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) != 0) {
+    return;
+  }
+  ::google::protobuf::GoogleOnceInit(&protobuf_InitDefaults_once_,
+                 &protobuf_InitDefaults_google_2fprotobuf_2funittest_5farena_2eproto_impl);
+  ::google::protobuf::internal::Release_Store(
+      &protobuf_InitDefaults_done_, 1);
+}
+
+void protobuf_AddDesc_google_2fprotobuf_2funittest_5farena_2eproto() {
+  static bool already_here = false;
+  if (already_here) return;
+  already_here = true;
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  ::protobuf_unittest::protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();
+  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
+    "\n$google/protobuf/unittest_arena.proto\022\021"
+    "protobuf_unittest\032\036google/protobuf/unitt"
+    "est.proto\"\242\004\n\020TestArenaMessage\022\026\n\016option"
+    "al_int32\030\001 \001(\005\022\027\n\017optional_string\030\002 \001(\t\022"
+    "\034\n\rdefault_bytes\030\003 \001(\014:\005arena\022;\n\016optiona"
+    "l_child\030\004 \001(\0132#.protobuf_unittest.TestAr"
+    "enaMessage\022C\n\030optional_foreign_message\030\005"
+    " \001(\0132!.protobuf_unittest.ForeignMessage\022"
+    "H\n\roptionalgroup\030\006 \001(\n21.protobuf_unitte"
+    "st.TestArenaMessage.OptionalGroup\022\026\n\016rep"
+    "eated_int64\030\013 \003(\003\022\027\n\017repeated_string\030\014 \003"
+    "(\t\022;\n\016repeated_child\030\r \003(\0132#.protobuf_un"
+    "ittest.TestArenaMessage\022C\n\030repeated_fore"
+    "ign_message\030\016 \003(\0132!.protobuf_unittest.Fo"
+    "reignMessage\022\032\n\016packed_fixed32\030\017 \003(\007B\002\020\001"
+    "\032\032\n\rOptionalGroup\022\t\n\001a\030\007 \001(\005*\010\010d\020\200\200\200\200\002:B"
+    "\n\025arena_int32_extension\022#.protobuf_unitt"
+    "est.TestArenaMessage\030d \001(\005:C\n\026arena_stri"
+    "ng_extension\022#.protobuf_unittest.TestAre"
+    "naMessage\030e \001(\tB\003\370\001\001", 780);
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
+    "google/protobuf/unittest_arena.proto", &protobuf_RegisterTypes);
+  ::google::protobuf::internal::ExtensionSet::RegisterDeferredExtensions(
+    &protobuf_InitDefaults_google_2fprotobuf_2funittest_5farena_2eproto);
+}
+
+// Force AddDescriptors() to be called at static initialization time.
+struct StaticDescriptorInitializer_google_2fprotobuf_2funittest_5farena_2eproto {
+  StaticDescriptorInitializer_google_2fprotobuf_2funittest_5farena_2eproto() {
+    protobuf_AddDesc_google_2fprotobuf_2funittest_5farena_2eproto();
+  }
+} static_descriptor_initializer_google_2fprotobuf_2funittest_5farena_2eproto_;
+
+
+// ===================================================================
+
+#ifndef _MSC_VER
+const int TestArenaMessage_OptionalGroup::kAFieldNumber;
+#endif  // !_MSC_VER
+
+TestArenaMessage_OptionalGroup::TestArenaMessage_OptionalGroup()
+  : ::google::protobuf::Message(),
+    _arena_(NULL) {
+  SharedCtor();
+}
+
+TestArenaMessage_OptionalGroup::TestArenaMessage_OptionalGroup(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+    _arena_(arena) {
+  SharedCtor();
+}
+
+void TestArenaMessage_OptionalGroup::InitAsDefaultInstance() {
+}
+
+TestArenaMessage_OptionalGroup::TestArenaMessage_OptionalGroup(const TestArenaMessage_OptionalGroup& from)
+  : ::google::protobuf::Message(),
+    _arena_(NULL) {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void TestArenaMessage_OptionalGroup::SharedCtor() {
+  _cached_size_ = 0;
+  a_ = 0;
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+TestArenaMessage_OptionalGroup::~TestArenaMessage_OptionalGroup() {
+  SharedDtor();
+}
+
+void TestArenaMessage_OptionalGroup::SharedDtor() {
+  if (_arena_ != NULL) return;
+  if (this != default_instance_) {
+  }
+}
+
+void TestArenaMessage_OptionalGroup::SetCachedSize(int size) const {
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
+}
+const ::google::protobuf::Descriptor* TestArenaMessage_OptionalGroup::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return TestArenaMessage_OptionalGroup_descriptor_;
+}
+
+const TestArenaMessage_OptionalGroup& TestArenaMessage_OptionalGroup::default_instance() {
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5farena_2eproto();
+  }
+  return *default_instance_;
+}
+
+TestArenaMessage_OptionalGroup* TestArenaMessage_OptionalGroup::default_instance_ = NULL;
+
+TestArenaMessage_OptionalGroup* TestArenaMessage_OptionalGroup::New() const {
+  return new TestArenaMessage_OptionalGroup;
+}
+
+TestArenaMessage_OptionalGroup* TestArenaMessage_OptionalGroup::NewOnArena(
+    ::google::protobuf::Arena* arena) const {
+  return ::google::protobuf::Arena::CreateMessage<TestArenaMessage_OptionalGroup>(arena);
+}
+
+void TestArenaMessage_OptionalGroup::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    a_ = 0;
+  }
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool TestArenaMessage_OptionalGroup::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
+  ::google::protobuf::uint32 tag;
+  while ((tag = input->ReadTag()) != 0) {
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional int32 a = 7;
+      case 7: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &a_)));
+          _set_bit(0);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+      
+      default: {
+      handle_uninterpreted:
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+  return true;
+#undef DO_
+}
+
+void TestArenaMessage_OptionalGroup::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // optional int32 a = 7;
+  if (_has_bit(0)) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(7, this->a(), output);
+  }
+  
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google::protobuf::uint8* TestArenaMessage_OptionalGroup::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // optional int32 a = 7;
+  if (_has_bit(0)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(7, this->a(), target);
+  }
+  
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int TestArenaMessage_OptionalGroup::ByteSize() const {
+  int total_size = 0;
+  
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // optional int32 a = 7;
+    if (has_a()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->a());
+    }
+    
+  }
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
+  return total_size;
+}
+
+void TestArenaMessage_OptionalGroup::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const TestArenaMessage_OptionalGroup* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const TestArenaMessage_OptionalGroup*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void TestArenaMessage_OptionalGroup::MergeFrom(const TestArenaMessage_OptionalGroup& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from._has_bit(0)) {
+      set_a(from.a());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void TestArenaMessage_OptionalGroup::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void TestArenaMessage_OptionalGroup::CopyFrom(const TestArenaMessage_OptionalGroup& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestArenaMessage_OptionalGroup::IsInitialized() const {
+  
+  return true;
+}
+
+void TestArenaMessage_OptionalGroup::Swap(TestArenaMessage_OptionalGroup* other) {
+  if (other != this) {
+    if (GetArena() != other->GetArena()) {
+      TestArenaMessage_OptionalGroup temp;
+      temp.MergeFrom(*this);
+      CopyFrom(*other);
+      other->CopyFrom(temp);
+      return;
+    }
+    std::swap(a_, other->a_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata TestArenaMessage_OptionalGroup::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = TestArenaMessage_OptionalGroup_descriptor_;
+  metadata.reflection = TestArenaMessage_OptionalGroup_reflection_;
+  return metadata;
+}
+
+
+// -------------------------------------------------------------------
+
+const ::std::string TestArenaMessage::_default_optional_string_;
+const ::std::string TestArenaMessage::_default_default_bytes_("arena");
+#ifndef _MSC_VER
+const int TestArenaMessage::kOptionalInt32FieldNumber;
+const int TestArenaMessage::kOptionalStringFieldNumber;
+const int TestArenaMessage::kDefaultBytesFieldNumber;
+const int TestArenaMessage::kOptionalChildFieldNumber;
+const int TestArenaMessage::kOptionalForeignMessageFieldNumber;
+const int TestArenaMessage::kOptionalgroupFieldNumber;
+const int TestArenaMessage::kRepeatedInt64FieldNumber;
+const int TestArenaMessage::kRepeatedStringFieldNumber;
+const int TestArenaMessage::kRepeatedChildFieldNumber;
+const int TestArenaMessage::kRepeatedForeignMessageFieldNumber;
+const int TestArenaMessage::kPackedFixed32FieldNumber;
+#endif  // !_MSC_VER
+
+TestArenaMessage::TestArenaMessage()
+  : ::google::protobuf::Message(),
+    _arena_(NULL) {
+  SharedCtor();
+}
+
+TestArenaMessage::TestArenaMessage(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+    _arena_(arena),
+    repeated_int64_(arena),
+    repeated_string_(arena),
+    repeated_child_(arena),
+    repeated_foreign_message_(arena),
+    packed_fixed32_(arena) {
+  SharedCtor();
+}
+
+void TestArenaMessage::InitAsDefaultInstance() {
+  optional_child_ = const_cast< ::protobuf_unittest::TestArenaMessage*>(
+      ::protobuf_unittest::TestArenaMessage::internal_default_instance());
+  optional_foreign_message_ = const_cast< ::protobuf_unittest::ForeignMessage*>(
+      ::protobuf_unittest::ForeignMessage::internal_default_instance());
+  optionalgroup_ = const_cast< ::protobuf_unittest::TestArenaMessage_OptionalGroup*>(
+      ::protobuf_unittest::TestArenaMessage_OptionalGroup::internal_default_instance());
+}
+
+TestArenaMessage::TestArenaMessage(const TestArenaMessage& from)
+  : ::google::protobuf::Message(),
+    _arena_(NULL) {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void TestArenaMessage::SharedCtor() {
+  _cached_size_ = 0;
+  optional_int32_ = 0;
+  optional_string_ = const_cast< ::std::string*>(&_default_optional_string_);
+  default_bytes_ = const_cast< ::std::string*>(&_default_default_bytes_);
+  optional_child_ = NULL;
+  optional_foreign_message_ = NULL;
+  optionalgroup_ = NULL;
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+TestArenaMessage::~TestArenaMessage() {
+  SharedDtor();
+}
+
+void TestArenaMessage::SharedDtor() {
+  if (_arena_ != NULL) return;
+  if (optional_string_ != &_default_optional_string_) {
+    delete optional_string_;
+  }
+  if (default_bytes_ != &_default_default_bytes_) {
+    delete default_bytes_;
+  }
+  if (this != default_instance_) {
+    delete optional_child_;
+    delete optional_foreign_message_;
+    delete optionalgroup_;
+  }
+}
+
+void TestArenaMessage::SetCachedSize(int size) const {
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
+}
+const ::google::protobuf::Descriptor* TestArenaMessage::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return TestArenaMessage_descriptor_;
+}
+
+const TestArenaMessage& TestArenaMessage::default_instance() {
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5farena_2eproto();
+  }
+  return *default_instance_;
+}
+
+TestArenaMessage* TestArenaMessage::default_instance_ = NULL;
+
+TestArenaMessage* TestArenaMessage::New() const {
+  return new TestArenaMessage;
+}
+
+TestArenaMessage* TestArenaMessage::NewOnArena(
+    ::google::protobuf::Arena* arena) const {
+  return ::google::protobuf::Arena::CreateMessage<TestArenaMessage>(arena);
+}
+
+void TestArenaMessage::Clear() {
+  _extensions_.Clear();
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    optional_int32_ = 0;
+    if (_has_bit(1)) {
+      if (optional_string_ != &_default_optional_string_) {
+        optional_string_->clear();
+      }
+    }
+    if (_has_bit(2)) {
+      if (default_bytes_ != &_default_default_bytes_) {
+        default_bytes_->assign(_default_default_bytes_);
+      }
+    }
+    if (_has_bit(3)) {
+      if (optional_child_ != NULL) optional_child_->::protobuf_unittest::TestArenaMessage::Clear();
+    }
+    if (_has_bit(4)) {
+      if (optional_foreign_message_ != NULL) optional_foreign_message_->::protobuf_unittest::ForeignMessage::Clear();
+    }
+    if (_has_bit(5)) {
+      if (optionalgroup_ != NULL) optionalgroup_->::protobuf_unittest::TestArenaMessage_OptionalGroup::Clear();
+    }
+  }
+  repeated_int64_.Clear();
+  repeated_string_.Clear();
+  repeated_child_.Clear();
+  repeated_foreign_message_.Clear();
+  packed_fixed32_.Clear();
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool TestArenaMessage::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
+  ::google::protobuf::uint32 tag;
+  while ((tag = input->ReadTag()) != 0) {
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional int32 optional_int32 = 1;
+      case 1: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &optional_int32_)));
+          _set_bit(0);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(18)) goto parse_optional_string;
+        break;
+      }
+      
+      // optional string optional_string = 2;
+      case 2: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_optional_string:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_optional_string()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+            this->optional_string().data(), this->optional_string().length(),
+            ::google::protobuf::internal::WireFormat::PARSE);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(26)) goto parse_default_bytes;
+        break;
+      }
+      
+      // optional bytes default_bytes = 3 [default = "arena"];
+      case 3: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_default_bytes:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_default_bytes()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(34)) goto parse_optional_child;
+        break;
+      }
+      
+      // optional .protobuf_unittest.TestArenaMessage optional_child = 4;
+      case 4: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_optional_child:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_optional_child()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(42)) goto parse_optional_foreign_message;
+        break;
+      }
+      
+      // optional .protobuf_unittest.ForeignMessage optional_foreign_message = 5;
+      case 5: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_optional_foreign_message:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_optional_foreign_message()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(51)) goto parse_optionalgroup;
+        break;
+      }
+      
+      // optional group OptionalGroup = 6 {
+      case 6: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_START_GROUP) {
+         parse_optionalgroup:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadGroupNoVirtual(
+                6, input, mutable_optionalgroup()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(88)) goto parse_repeated_int64;
+        break;
+      }
+      
+      // repeated int64 repeated_int64 = 11;
+      case 11: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_repeated_int64:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitive<
+                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
+                 1, 88, input, this->mutable_repeated_int64())));
+        } else if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag)
+                   == ::google::protobuf::internal::WireFormatLite::
+                      WIRETYPE_LENGTH_DELIMITED) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitiveNoInline<
+                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
+                 input, this->mutable_repeated_int64())));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(88)) goto parse_repeated_int64;
+        if (input->ExpectTag(98)) goto parse_repeated_string;
+        break;
+      }
+      
+      // repeated string repeated_string = 12;
+      case 12: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_repeated_string:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->add_repeated_string()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+            this->repeated_string(0).data(), this->repeated_string(0).length(),
+            ::google::protobuf::internal::WireFormat::PARSE);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(98)) goto parse_repeated_string;
+        if (input->ExpectTag(106)) goto parse_repeated_child;
+        break;
+      }
+      
+      // repeated .protobuf_unittest.TestArenaMessage repeated_child = 13;
+      case 13: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_repeated_child:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+                input, add_repeated_child()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(106)) goto parse_repeated_child;
+        if (input->ExpectTag(114)) goto parse_repeated_foreign_message;
+        break;
+      }
+      
+      // repeated .protobuf_unittest.ForeignMessage repeated_foreign_message = 14;
+      case 14: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_repeated_foreign_message:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+                input, add_repeated_foreign_message()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(114)) goto parse_repeated_foreign_message;
+        if (input->ExpectTag(122)) goto parse_packed_fixed32;
+        break;
+      }
+      
+      // repeated fixed32 packed_fixed32 = 15 [packed = true];
+      case 15: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_packed_fixed32:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_FIXED32>(
+                 input, this->mutable_packed_fixed32())));
+        } else if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag)
+                   == ::google::protobuf::internal::WireFormatLite::
+                      WIRETYPE_FIXED32) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_FIXED32>(
+                 1, 122, input, this->mutable_packed_fixed32())));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+      
+      default: {
+      handle_uninterpreted:
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        if ((800u <= tag)) {
+          DO_(_extensions_.ParseField(tag, input, &default_instance(),
+                                      mutable_unknown_fields()));
+          continue;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+  return true;
+#undef DO_
+}
+
+void TestArenaMessage::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // optional int32 optional_int32 = 1;
+  if (_has_bit(0)) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->optional_int32(), output);
+  }
+  
+  // optional string optional_string = 2;
+  if (_has_bit(1)) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->optional_string().data(), this->optional_string().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      2, this->optional_string(), output);
+  }
+  
+  // optional bytes default_bytes = 3 [default = "arena"];
+  if (_has_bit(2)) {
+    ::google::protobuf::internal::WireFormatLite::WriteBytes(
+      3, this->default_bytes(), output);
+  }
+  
+  // optional .protobuf_unittest.TestArenaMessage optional_child = 4;
+  if (_has_bit(3)) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      4, this->optional_child(), output);
+  }
+  
+  // optional .protobuf_unittest.ForeignMessage optional_foreign_message = 5;
+  if (_has_bit(4)) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      5, this->optional_foreign_message(), output);
+  }
+  
+  // optional group OptionalGroup = 6 {
+  if (_has_bit(5)) {
+    ::google::protobuf::internal::WireFormatLite::WriteGroupMaybeToArray(
+      6, this->optionalgroup(), output);
+  }
+  
+  // repeated int64 repeated_int64 = 11;
+  for (int i = 0; i < this->repeated_int64_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt64(
+      11, this->repeated_int64(i), output);
+  }
+  
+  // repeated string repeated_string = 12;
+  for (int i = 0; i < this->repeated_string_size(); i++) {
+  ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+    this->repeated_string(i).data(), this->repeated_string(i).length(),
+    ::google::protobuf::internal::WireFormat::SERIALIZE);
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      12, this->repeated_string(i), output);
+  }
+  
+  // repeated .protobuf_unittest.TestArenaMessage repeated_child = 13;
+  for (int i = 0; i < this->repeated_child_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      13, this->repeated_child(i), output);
+  }
+  
+  // repeated .protobuf_unittest.ForeignMessage repeated_foreign_message = 14;
+  for (int i = 0; i < this->repeated_foreign_message_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      14, this->repeated_foreign_message(i), output);
+  }
+  
+  // repeated fixed32 packed_fixed32 = 15 [packed = true];
+  if (this->packed_fixed32_size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(15, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(
+        ::google::protobuf::internal::NoBarrier_Load(&_packed_fixed32_cached_byte_size_));
+  }
+  for (int i = 0; i < this->packed_fixed32_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteFixed32NoTag(
+      this->packed_fixed32(i), output);
+  }
+  
+  // Extension range [100, 536870912)
+  _extensions_.SerializeWithCachedSizes(
+      100, 536870912, output);
+  
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google::protobuf::uint8* TestArenaMessage::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // optional int32 optional_int32 = 1;
+  if (_has_bit(0)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->optional_int32(), target);
+  }
+  
+  // optional string optional_string = 2;
+  if (_has_bit(1)) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->optional_string().data(), this->optional_string().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        2, this->optional_string(), target);
+  }
+  
+  // optional bytes default_bytes = 3 [default = "arena"];
+  if (_has_bit(2)) {
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
+        3, this->default_bytes(), target);
+  }
+  
+  // optional .protobuf_unittest.TestArenaMessage optional_child = 4;
+  if (_has_bit(3)) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        4, this->optional_child(), target);
+  }
+  
+  // optional .protobuf_unittest.ForeignMessage optional_foreign_message = 5;
+  if (_has_bit(4)) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        5, this->optional_foreign_message(), target);
+  }
+  
+  // optional group OptionalGroup = 6 {
+  if (_has_bit(5)) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteGroupNoVirtualToArray(
+        6, this->optionalgroup(), target);
+  }
+  
+  // repeated int64 repeated_int64 = 11;
+  for (int i = 0; i < this->repeated_int64_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteInt64ToArray(11, this->repeated_int64(i), target);
+  }
+  
+  // repeated string repeated_string = 12;
+  for (int i = 0; i < this->repeated_string_size(); i++) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->repeated_string(i).data(), this->repeated_string(i).length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteStringToArray(12, this->repeated_string(i), target);
+  }
+  
+  // repeated .protobuf_unittest.TestArenaMessage repeated_child = 13;
+  for (int i = 0; i < this->repeated_child_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        13, this->repeated_child(i), target);
+  }
+  
+  // repeated .protobuf_unittest.ForeignMessage repeated_foreign_message = 14;
+  for (int i = 0; i < this->repeated_foreign_message_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        14, this->repeated_foreign_message(i), target);
+  }
+  
+  // repeated fixed32 packed_fixed32 = 15 [packed = true];
+  if (this->packed_fixed32_size() > 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
+      15,
+      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
+      ::google::protobuf::internal::NoBarrier_Load(&_packed_fixed32_cached_byte_size_),
+      target);
+  }
+  for (int i = 0; i < this->packed_fixed32_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteFixed32NoTagToArray(this->packed_fixed32(i), target);
+  }
+  
+  // Extension range [100, 536870912)
+  target = _extensions_.SerializeWithCachedSizesToArray(
+      100, 536870912, target);
+  
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int TestArenaMessage::ByteSize() const {
+  int total_size = 0;
+  
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // optional int32 optional_int32 = 1;
+    if (has_optional_int32()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->optional_int32());
+    }
+    
+    // optional string optional_string = 2;
+    if (has_optional_string()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->optional_string());
+    }
+    
+    // optional bytes default_bytes = 3 [default = "arena"];
+    if (has_default_bytes()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::BytesSize(
+          this->default_bytes());
+    }
+    
+    // optional .protobuf_unittest.TestArenaMessage optional_child = 4;
+    if (has_optional_child()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->optional_child());
+    }
+    
+    // optional .protobuf_unittest.ForeignMessage optional_foreign_message = 5;
+    if (has_optional_foreign_message()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->optional_foreign_message());
+    }
+    
+    // optional group OptionalGroup = 6 {
+    if (has_optionalgroup()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::GroupSizeNoVirtual(
+          this->optionalgroup());
+    }
+    
+  }
+  // repeated int64 repeated_int64 = 11;
+  {
+    int data_size = 0;
+    for (int i = 0; i < this->repeated_int64_size(); i++) {
+      data_size += ::google::protobuf::internal::WireFormatLite::
+        Int64Size(this->repeated_int64(i));
+    }
+    total_size += 1 * this->repeated_int64_size() + data_size;
+  }
+  
+  // repeated string repeated_string = 12;
+  total_size += 1 * this->repeated_string_size();
+  for (int i = 0; i < this->repeated_string_size(); i++) {
+    total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
+      this->repeated_string(i));
+  }
+  
+  // repeated .protobuf_unittest.TestArenaMessage repeated_child = 13;
+  total_size += 1 * this->repeated_child_size();
+  for (int i = 0; i < this->repeated_child_size(); i++) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        this->repeated_child(i));
+  }
+  
+  // repeated .protobuf_unittest.ForeignMessage repeated_foreign_message = 14;
+  total_size += 1 * this->repeated_foreign_message_size();
+  for (int i = 0; i < this->repeated_foreign_message_size(); i++) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        this->repeated_foreign_message(i));
+  }
+  
+  // repeated fixed32 packed_fixed32 = 15 [packed = true];
+  {
+    int data_size = 0;
+    data_size = 4 * this->packed_fixed32_size();
+    if (data_size > 0) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
+    }
+    ::google::protobuf::internal::NoBarrier_Store(
+        &_packed_fixed32_cached_byte_size_, data_size);
+    total_size += data_size;
+  }
+  
+  total_size += _extensions_.ByteSize();
+  
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
+  return total_size;
+}
+
+void TestArenaMessage::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const TestArenaMessage* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const TestArenaMessage*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void TestArenaMessage::MergeFrom(const TestArenaMessage& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  repeated_int64_.MergeFrom(from.repeated_int64_);
+  repeated_string_.MergeFrom(from.repeated_string_);
+  repeated_child_.MergeFrom(from.repeated_child_);
+  repeated_foreign_message_.MergeFrom(from.repeated_foreign_message_);
+  packed_fixed32_.MergeFrom(from.packed_fixed32_);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from._has_bit(0)) {
+      set_optional_int32(from.optional_int32());
+    }
+    if (from._has_bit(1)) {
+      set_optional_string(from.optional_string());
+    }
+    if (from._has_bit(2)) {
+      set_default_bytes(from.default_bytes());
+    }
+    if (from._has_bit(3)) {
+      mutable_optional_child()->::protobuf_unittest::TestArenaMessage::MergeFrom(from.optional_child());
+    }
+    if (from._has_bit(4)) {
+      mutable_optional_foreign_message()->::protobuf_unittest::ForeignMessage::MergeFrom(from.optional_foreign_message());
+    }
+    if (from._has_bit(5)) {
+      mutable_optionalgroup()->::protobuf_unittest::TestArenaMessage_OptionalGroup::MergeFrom(from.optionalgroup());
+    }
+  }
+  _extensions_.MergeFrom(from._extensions_);
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void TestArenaMessage::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void TestArenaMessage::CopyFrom(const TestArenaMessage& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestArenaMessage::IsInitialized() const {
+  
+  if (has_optional_child()) {
+    if (!this->optional_child().IsInitialized()) return false;
+  }
+  for (int i = 0; i < repeated_child_size(); i++) {
+    if (!this->repeated_child(i).IsInitialized()) return false;
+  }
+  
+  if (!_extensions_.IsInitialized()) return false;  return true;
+}
+
+void TestArenaMessage::Swap(TestArenaMessage* other) {
+  if (other != this) {
+    if (GetArena() != other->GetArena()) {
+      TestArenaMessage temp;
+      temp.MergeFrom(*this);
+      CopyFrom(*other);
+      other->CopyFrom(temp);
+      return;
+    }
+    std::swap(optional_int32_, other->optional_int32_);
+    std::swap(optional_string_, other->optional_string_);
+    std::swap(default_bytes_, other->default_bytes_);
+    std::swap(optional_child_, other->optional_child_);
+    std::swap(optional_foreign_message_, other->optional_foreign_message_);
+    std::swap(optionalgroup_, other->optionalgroup_);
+    repeated_int64_.Swap(&other->repeated_int64_);
+    repeated_string_.Swap(&other->repeated_string_);
+    repeated_child_.Swap(&other->repeated_child_);
+    repeated_foreign_message_.Swap(&other->repeated_foreign_message_);
+    packed_fixed32_.Swap(&other->packed_fixed32_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+    _extensions_.Swap(&other->_extensions_);
+  }
+}
+
+::google::protobuf::Metadata TestArenaMessage::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = TestArenaMessage_descriptor_;
+  metadata.reflection = TestArenaMessage_reflection_;
+  return metadata;
+}
+
+::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestArenaMessage,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::google::protobuf::int32 >, 5, false >
+  arena_int32_extension(kArenaInt32ExtensionFieldNumber, 0);
+const ::std::string arena_string_extension_default("");
+::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestArenaMessage,
+    ::google::protobuf::internal::StringTypeTraits, 9, false >
+  arena_string_extension(kArenaStringExtensionFieldNumber, arena_string_extension_default);
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace protobuf_unittest
+
+// @@protoc_insertion_point(global_scope)
@@ -0,0 +1,719 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/unittest_arena.proto
+
+#ifndef PROTOBUF_google_2fprotobuf_2funittest_5farena_2eproto__INCLUDED
+#define PROTOBUF_google_2fprotobuf_2funittest_5farena_2eproto__INCLUDED
+
+#include <string>
+
+#include <google/protobuf/stubs/common.h>
+
+#if GOOGLE_PROTOBUF_VERSION < 2003000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers.  Please update
+#error your headers.
+#endif
+#if 2003000 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers.  Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/repeated_field.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/arena.h>
+#include "google/protobuf/unittest.pb.h"
+// @@protoc_insertion_point(includes)
+
+namespace protobuf_unittest {
+
+// Internal implementation detail -- do not call these.
+void  protobuf_AddDesc_google_2fprotobuf_2funittest_5farena_2eproto();
+void  protobuf_InitDefaults_google_2fprotobuf_2funittest_5farena_2eproto();
+void protobuf_InitDefaults_google_2fprotobuf_2funittest_5farena_2eproto_impl();
+void protobuf_AssignDesc_google_2fprotobuf_2funittest_5farena_2eproto();
+void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5farena_2eproto();
+
+class TestArenaMessage;
+class TestArenaMessage_OptionalGroup;
+
+// ===================================================================
+
+class TestArenaMessage_OptionalGroup : public ::google::protobuf::Message {
+ public:
+  TestArenaMessage_OptionalGroup();
+  virtual ~TestArenaMessage_OptionalGroup();
+  
+  TestArenaMessage_OptionalGroup(const TestArenaMessage_OptionalGroup& from);
+  
+  inline TestArenaMessage_OptionalGroup& operator=(const TestArenaMessage_OptionalGroup& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  
+  explicit TestArenaMessage_OptionalGroup(::google::protobuf::Arena* arena);
+  inline ::google::protobuf::Arena* GetArena() const { return _arena_; }
+  TestArenaMessage_OptionalGroup* NewOnArena(::google::protobuf::Arena* arena) const;
+  // Tells Arena::CreateMessage() to use the constructor above.
+  typedef void InternalArenaConstructable_;
+  
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+  
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+  
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const TestArenaMessage_OptionalGroup& default_instance();
+  
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestArenaMessage_OptionalGroup* internal_default_instance() {
+    return default_instance_;
+  }
+  
+  void Swap(TestArenaMessage_OptionalGroup* other);
+  
+  // implements Message ----------------------------------------------
+  
+  TestArenaMessage_OptionalGroup* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const TestArenaMessage_OptionalGroup& from);
+  void MergeFrom(const TestArenaMessage_OptionalGroup& from);
+  void Clear();
+  bool IsInitialized() const;
+  
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+  
+  ::google::protobuf::Metadata GetMetadata() const;
+  
+  // nested types ----------------------------------------------------
+  
+  // accessors -------------------------------------------------------
+  
+  // optional int32 a = 7;
+  inline bool has_a() const;
+  inline void clear_a();
+  static const int kAFieldNumber = 7;
+  inline ::google::protobuf::int32 a() const;
+  inline void set_a(::google::protobuf::int32 value);
+  
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestArenaMessage.OptionalGroup)
+ private:
+  ::google::protobuf::Arena* _arena_;
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
+  
+  ::google::protobuf::int32 a_;
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5farena_2eproto_impl();
+  friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5farena_2eproto();
+  friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5farena_2eproto();
+  
+  ::google::protobuf::uint32 _has_bits_[(1 + 31) / 32];
+  
+  // WHY DOES & HAVE LOWER PRECEDENCE THAN != !?
+  inline bool _has_bit(int index) const {
+    return (_has_bits_[index / 32] & (1u << (index % 32))) != 0;
+  }
+  inline void _set_bit(int index) {
+    _has_bits_[index / 32] |= (1u << (index % 32));
+  }
+  inline void _clear_bit(int index) {
+    _has_bits_[index / 32] &= ~(1u << (index % 32));
+  }
+  
+  void InitAsDefaultInstance();
+  static TestArenaMessage_OptionalGroup* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class TestArenaMessage : public ::google::protobuf::Message {
+ public:
+  TestArenaMessage();
+  virtual ~TestArenaMessage();
+  
+  TestArenaMessage(const TestArenaMessage& from);
+  
+  inline TestArenaMessage& operator=(const TestArenaMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  
+  explicit TestArenaMessage(::google::protobuf::Arena* arena);
+  inline ::google::protobuf::Arena* GetArena() const { return _arena_; }
+  TestArenaMessage* NewOnArena(::google::protobuf::Arena* arena) const;
+  // Tells Arena::CreateMessage() to use the constructor above.
+  typedef void InternalArenaConstructable_;
+  
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+  
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+  
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const TestArenaMessage& default_instance();
+  
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestArenaMessage* internal_default_instance() {
+    return default_instance_;
+  }
+  
+  void Swap(TestArenaMessage* other);
+  
+  // implements Message ----------------------------------------------
+  
+  TestArenaMessage* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const TestArenaMessage& from);
+  void MergeFrom(const TestArenaMessage& from);
+  void Clear();
+  bool IsInitialized() const;
+  
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+  
+  ::google::protobuf::Metadata GetMetadata() const;
+  
+  // nested types ----------------------------------------------------
+  
+  typedef TestArenaMessage_OptionalGroup OptionalGroup;
+  
+  // accessors -------------------------------------------------------
+  
+  // optional int32 optional_int32 = 1;
+  inline bool has_optional_int32() const;
+  inline void clear_optional_int32();
+  static const int kOptionalInt32FieldNumber = 1;
+  inline ::google::protobuf::int32 optional_int32() const;
+  inline void set_optional_int32(::google::protobuf::int32 value);
+  
+  // optional string optional_string = 2;
+  inline bool has_optional_string() const;
+  inline void clear_optional_string();
+  static const int kOptionalStringFieldNumber = 2;
+  inline const ::std::string& optional_string() const;
+  inline void set_optional_string(const ::std::string& value);
+  inline void set_optional_string(const char* value);
+  inline void set_optional_string(const char* value, size_t size);
+  inline ::std::string* mutable_optional_string();
+  
+  // optional bytes default_bytes = 3 [default = "arena"];
+  inline bool has_default_bytes() const;
+  inline void clear_default_bytes();
+  static const int kDefaultBytesFieldNumber = 3;
+  inline const ::std::string& default_bytes() const;
+  inline void set_default_bytes(const ::std::string& value);
+  inline void set_default_bytes(const char* value);
+  inline void set_default_bytes(const void* value, size_t size);
+  inline ::std::string* mutable_default_bytes();
+  
+  // optional .protobuf_unittest.TestArenaMessage optional_child = 4;
+  inline bool has_optional_child() const;
+  inline void clear_optional_child();
+  static const int kOptionalChildFieldNumber = 4;
+  inline const ::protobuf_unittest::TestArenaMessage& optional_child() const;
+  inline ::protobuf_unittest::TestArenaMessage* mutable_optional_child();
+  
+  // optional .protobuf_unittest.ForeignMessage optional_foreign_message = 5;
+  inline bool has_optional_foreign_message() const;
+  inline void clear_optional_foreign_message();
+  static const int kOptionalForeignMessageFieldNumber = 5;
+  inline const ::protobuf_unittest::ForeignMessage& optional_foreign_message() const;
+  inline ::protobuf_unittest::ForeignMessage* mutable_optional_foreign_message();
+  
+  // optional group OptionalGroup = 6 {
+  inline bool has_optionalgroup() const;
+  inline void clear_optionalgroup();
+  static const int kOptionalgroupFieldNumber = 6;
+  inline const ::protobuf_unittest::TestArenaMessage_OptionalGroup& optionalgroup() const;
+  inline ::protobuf_unittest::TestArenaMessage_OptionalGroup* mutable_optionalgroup();
+  
+  // repeated int64 repeated_int64 = 11;
+  inline int repeated_int64_size() const;
+  inline void clear_repeated_int64();
+  static const int kRepeatedInt64FieldNumber = 11;
+  inline ::google::protobuf::int64 repeated_int64(int index) const;
+  inline void set_repeated_int64(int index, ::google::protobuf::int64 value);
+  inline void add_repeated_int64(::google::protobuf::int64 value);
+  inline const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
+      repeated_int64() const;
+  inline ::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
+      mutable_repeated_int64();
+  
+  // repeated string repeated_string = 12;
+  inline int repeated_string_size() const;
+  inline void clear_repeated_string();
+  static const int kRepeatedStringFieldNumber = 12;
+  inline const ::std::string& repeated_string(int index) const;
+  inline ::std::string* mutable_repeated_string(int index);
+  inline void set_repeated_string(int index, const ::std::string& value);
+  inline void set_repeated_string(int index, const char* value);
+  inline void set_repeated_string(int index, const char* value, size_t size);
+  inline ::std::string* add_repeated_string();
+  inline void add_repeated_string(const ::std::string& value);
+  inline void add_repeated_string(const char* value);
+  inline void add_repeated_string(const char* value, size_t size);
+  inline const ::google::protobuf::RepeatedPtrField< ::std::string>& repeated_string() const;
+  inline ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_repeated_string();
+  
+  // repeated .protobuf_unittest.TestArenaMessage repeated_child = 13;
+  inline int repeated_child_size() const;
+  inline void clear_repeated_child();
+  static const int kRepeatedChildFieldNumber = 13;
+  inline const ::protobuf_unittest::TestArenaMessage& repeated_child(int index) const;
+  inline ::protobuf_unittest::TestArenaMessage* mutable_repeated_child(int index);
+  inline ::protobuf_unittest::TestArenaMessage* add_repeated_child();
+  inline const ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestArenaMessage >&
+      repeated_child() const;
+  inline ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestArenaMessage >*
+      mutable_repeated_child();
+  
+  // repeated .protobuf_unittest.ForeignMessage repeated_foreign_message = 14;
+  inline int repeated_foreign_message_size() const;
+  inline void clear_repeated_foreign_message();
+  static const int kRepeatedForeignMessageFieldNumber = 14;
+  inline const ::protobuf_unittest::ForeignMessage& repeated_foreign_message(int index) const;
+  inline ::protobuf_unittest::ForeignMessage* mutable_repeated_foreign_message(int index);
+  inline ::protobuf_unittest::ForeignMessage* add_repeated_foreign_message();
+  inline const ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::ForeignMessage >&
+      repeated_foreign_message() const;
+  inline ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::ForeignMessage >*
+      mutable_repeated_foreign_message();
+  
+  // repeated fixed32 packed_fixed32 = 15 [packed = true];
+  inline int packed_fixed32_size() const;
+  inline void clear_packed_fixed32();
+  static const int kPackedFixed32FieldNumber = 15;
+  inline ::google::protobuf::uint32 packed_fixed32(int index) const;
+  inline void set_packed_fixed32(int index, ::google::protobuf::uint32 value);
+  inline void add_packed_fixed32(::google::protobuf::uint32 value);
+  inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+      packed_fixed32() const;
+  inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+      mutable_packed_fixed32();
+  
+  GOOGLE_PROTOBUF_EXTENSION_ACCESSORS(TestArenaMessage)
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestArenaMessage)
+ private:
+  ::google::protobuf::Arena* _arena_;
+  ::google::protobuf::internal::ExtensionSet _extensions_;
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
+  
+  ::google::protobuf::int32 optional_int32_;
+  ::std::string* optional_string_;
+  static const ::std::string _default_optional_string_;
+  ::std::string* default_bytes_;
+  static const ::std::string _default_default_bytes_;
+  ::protobuf_unittest::TestArenaMessage* optional_child_;
+  ::protobuf_unittest::ForeignMessage* optional_foreign_message_;
+  ::protobuf_unittest::TestArenaMessage_OptionalGroup* optionalgroup_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int64 > repeated_int64_;
+  ::google::protobuf::RepeatedPtrField< ::std::string> repeated_string_;
+  ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestArenaMessage > repeated_child_;
+  ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::ForeignMessage > repeated_foreign_message_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 > packed_fixed32_;
+  mutable ::google::protobuf::internal::Atomic32 _packed_fixed32_cached_byte_size_;
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5farena_2eproto_impl();
+  friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5farena_2eproto();
+  friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5farena_2eproto();
+  
+  ::google::protobuf::uint32 _has_bits_[(11 + 31) / 32];
+  
+  // WHY DOES & HAVE LOWER PRECEDENCE THAN != !?
+  inline bool _has_bit(int index) const {
+    return (_has_bits_[index / 32] & (1u << (index % 32))) != 0;
+  }
+  inline void _set_bit(int index) {
+    _has_bits_[index / 32] |= (1u << (index % 32));
+  }
+  inline void _clear_bit(int index) {
+    _has_bits_[index / 32] &= ~(1u << (index % 32));
+  }
+  
+  void InitAsDefaultInstance();
+  static TestArenaMessage* default_instance_;
+};
+// ===================================================================
+
+static const int kArenaInt32ExtensionFieldNumber = 100;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestArenaMessage,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::google::protobuf::int32 >, 5, false >
+  arena_int32_extension;
+static const int kArenaStringExtensionFieldNumber = 101;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestArenaMessage,
+    ::google::protobuf::internal::StringTypeTraits, 9, false >
+  arena_string_extension;
+
+// ===================================================================
+
+// TestArenaMessage_OptionalGroup
+
+// optional int32 a = 7;
+inline bool TestArenaMessage_OptionalGroup::has_a() const {
+  return _has_bit(0);
+}
+inline void TestArenaMessage_OptionalGroup::clear_a() {
+  a_ = 0;
+  _clear_bit(0);
+}
+inline ::google::protobuf::int32 TestArenaMessage_OptionalGroup::a() const {
+  return a_;
+}
+inline void TestArenaMessage_OptionalGroup::set_a(::google::protobuf::int32 value) {
+  _set_bit(0);
+  a_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// TestArenaMessage
+
+// optional int32 optional_int32 = 1;
+inline bool TestArenaMessage::has_optional_int32() const {
+  return _has_bit(0);
+}
+inline void TestArenaMessage::clear_optional_int32() {
+  optional_int32_ = 0;
+  _clear_bit(0);
+}
+inline ::google::protobuf::int32 TestArenaMessage::optional_int32() const {
+  return optional_int32_;
+}
+inline void TestArenaMessage::set_optional_int32(::google::protobuf::int32 value) {
+  _set_bit(0);
+  optional_int32_ = value;
+}
+
+// optional string optional_string = 2;
+inline bool TestArenaMessage::has_optional_string() const {
+  return _has_bit(1);
+}
+inline void TestArenaMessage::clear_optional_string() {
+  if (optional_string_ != &_default_optional_string_) {
+    optional_string_->clear();
+  }
+  _clear_bit(1);
+}
+inline const ::std::string& TestArenaMessage::optional_string() const {
+  return *optional_string_;
+}
+inline void TestArenaMessage::set_optional_string(const ::std::string& value) {
+  _set_bit(1);
+  if (optional_string_ == &_default_optional_string_) {
+    optional_string_ = ::google::protobuf::Arena::Create< ::std::string>(_arena_);
+  }
+  optional_string_->assign(value);
+}
+inline void TestArenaMessage::set_optional_string(const char* value) {
+  _set_bit(1);
+  if (optional_string_ == &_default_optional_string_) {
+    optional_string_ = ::google::protobuf::Arena::Create< ::std::string>(_arena_);
+  }
+  optional_string_->assign(value);
+}
+inline void TestArenaMessage::set_optional_string(const char* value, size_t size) {
+  _set_bit(1);
+  if (optional_string_ == &_default_optional_string_) {
+    optional_string_ = ::google::protobuf::Arena::Create< ::std::string>(_arena_);
+  }
+  optional_string_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* TestArenaMessage::mutable_optional_string() {
+  _set_bit(1);
+  if (optional_string_ == &_default_optional_string_) {
+    optional_string_ = ::google::protobuf::Arena::Create< ::std::string>(_arena_);
+  }
+  return optional_string_;
+}
+
+// optional bytes default_bytes = 3 [default = "arena"];
+inline bool TestArenaMessage::has_default_bytes() const {
+  return _has_bit(2);
+}
+inline void TestArenaMessage::clear_default_bytes() {
+  if (default_bytes_ != &_default_default_bytes_) {
+    default_bytes_->assign(_default_default_bytes_);
+  }
+  _clear_bit(2);
+}
+inline const ::std::string& TestArenaMessage::default_bytes() const {
+  return *default_bytes_;
+}
+inline void TestArenaMessage::set_default_bytes(const ::std::string& value) {
+  _set_bit(2);
+  if (default_bytes_ == &_default_default_bytes_) {
+    default_bytes_ = ::google::protobuf::Arena::Create< ::std::string>(_arena_);
+  }
+  default_bytes_->assign(value);
+}
+inline void TestArenaMessage::set_default_bytes(const char* value) {
+  _set_bit(2);
+  if (default_bytes_ == &_default_default_bytes_) {
+    default_bytes_ = ::google::protobuf::Arena::Create< ::std::string>(_arena_);
+  }
+  default_bytes_->assign(value);
+}
+inline void TestArenaMessage::set_default_bytes(const void* value, size_t size) {
+  _set_bit(2);
+  if (default_bytes_ == &_default_default_bytes_) {
+    default_bytes_ = ::google::protobuf::Arena::Create< ::std::string>(_arena_);
+  }
+  default_bytes_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* TestArenaMessage::mutable_default_bytes() {
+  _set_bit(2);
+  if (default_bytes_ == &_default_default_bytes_) {
+    default_bytes_ = ::google::protobuf::Arena::Create< ::std::string>(_arena_);
+    default_bytes_->assign(_default_default_bytes_);
+  }
+  return default_bytes_;
+}
+
+// optional .protobuf_unittest.TestArenaMessage optional_child = 4;
+inline bool TestArenaMessage::has_optional_child() const {
+  return _has_bit(3);
+}
+inline void TestArenaMessage::clear_optional_child() {
+  if (optional_child_ != NULL) optional_child_->::protobuf_unittest::TestArenaMessage::Clear();
+  _clear_bit(3);
+}
+inline const ::protobuf_unittest::TestArenaMessage& TestArenaMessage::optional_child() const {
+  return optional_child_ != NULL ? *optional_child_ : ::protobuf_unittest::TestArenaMessage::default_instance();
+}
+inline ::protobuf_unittest::TestArenaMessage* TestArenaMessage::mutable_optional_child() {
+  _set_bit(3);
+  if (optional_child_ == NULL) optional_child_ = ::google::protobuf::Arena::CreateMessage< ::protobuf_unittest::TestArenaMessage >(_arena_);
+  return optional_child_;
+}
+
+// optional .protobuf_unittest.ForeignMessage optional_foreign_message = 5;
+inline bool TestArenaMessage::has_optional_foreign_message() const {
+  return _has_bit(4);
+}
+inline void TestArenaMessage::clear_optional_foreign_message() {
+  if (optional_foreign_message_ != NULL) optional_foreign_message_->::protobuf_unittest::ForeignMessage::Clear();
+  _clear_bit(4);
+}
+inline const ::protobuf_unittest::ForeignMessage& TestArenaMessage::optional_foreign_message() const {
+  return optional_foreign_message_ != NULL ? *optional_foreign_message_ : ::protobuf_unittest::ForeignMessage::default_instance();
+}
+inline ::protobuf_unittest::ForeignMessage* TestArenaMessage::mutable_optional_foreign_message() {
+  _set_bit(4);
+  if (optional_foreign_message_ == NULL) optional_foreign_message_ = ::google::protobuf::Arena::CreateMessage< ::protobuf_unittest::ForeignMessage >(_arena_);
+  return optional_foreign_message_;
+}
+
+// optional group OptionalGroup = 6 {
+inline bool TestArenaMessage::has_optionalgroup() const {
+  return _has_bit(5);
+}
+inline void TestArenaMessage::clear_optionalgroup() {
+  if (optionalgroup_ != NULL) optionalgroup_->::protobuf_unittest::TestArenaMessage_OptionalGroup::Clear();
+  _clear_bit(5);
+}
+inline const ::protobuf_unittest::TestArenaMessage_OptionalGroup& TestArenaMessage::optionalgroup() const {
+  return optionalgroup_ != NULL ? *optionalgroup_ : ::protobuf_unittest::TestArenaMessage_OptionalGroup::default_instance();
+}
+inline ::protobuf_unittest::TestArenaMessage_OptionalGroup* TestArenaMessage::mutable_optionalgroup() {
+  _set_bit(5);
+  if (optionalgroup_ == NULL) optionalgroup_ = ::google::protobuf::Arena::CreateMessage< ::protobuf_unittest::TestArenaMessage_OptionalGroup >(_arena_);
+  return optionalgroup_;
+}
+
+// repeated int64 repeated_int64 = 11;
+inline int TestArenaMessage::repeated_int64_size() const {
+  return repeated_int64_.size();
+}
+inline void TestArenaMessage::clear_repeated_int64() {
+  repeated_int64_.Clear();
+}
+inline ::google::protobuf::int64 TestArenaMessage::repeated_int64(int index) const {
+  return repeated_int64_.Get(index);
+}
+inline void TestArenaMessage::set_repeated_int64(int index, ::google::protobuf::int64 value) {
+  repeated_int64_.Set(index, value);
+}
+inline void TestArenaMessage::add_repeated_int64(::google::protobuf::int64 value) {
+  repeated_int64_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
+TestArenaMessage::repeated_int64() const {
+  return repeated_int64_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
+TestArenaMessage::mutable_repeated_int64() {
+  return &repeated_int64_;
+}
+
+// repeated string repeated_string = 12;
+inline int TestArenaMessage::repeated_string_size() const {
+  return repeated_string_.size();
+}
+inline void TestArenaMessage::clear_repeated_string() {
+  repeated_string_.Clear();
+}
+inline const ::std::string& TestArenaMessage::repeated_string(int index) const {
+  return repeated_string_.Get(index);
+}
+inline ::std::string* TestArenaMessage::mutable_repeated_string(int index) {
+  return repeated_string_.Mutable(index);
+}
+inline void TestArenaMessage::set_repeated_string(int index, const ::std::string& value) {
+  repeated_string_.Mutable(index)->assign(value);
+}
+inline void TestArenaMessage::set_repeated_string(int index, const char* value) {
+  repeated_string_.Mutable(index)->assign(value);
+}
+inline void TestArenaMessage::set_repeated_string(int index, const char* value, size_t size) {
+  repeated_string_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* TestArenaMessage::add_repeated_string() {
+  return repeated_string_.Add();
+}
+inline void TestArenaMessage::add_repeated_string(const ::std::string& value) {
+  repeated_string_.Add()->assign(value);
+}
+inline void TestArenaMessage::add_repeated_string(const char* value) {
+  repeated_string_.Add()->assign(value);
+}
+inline void TestArenaMessage::add_repeated_string(const char* value, size_t size) {
+  repeated_string_.Add()->assign(reinterpret_cast<const char*>(value), size);
+}
+inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+TestArenaMessage::repeated_string() const {
+  return repeated_string_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+TestArenaMessage::mutable_repeated_string() {
+  return &repeated_string_;
+}
+
+// repeated .protobuf_unittest.TestArenaMessage repeated_child = 13;
+inline int TestArenaMessage::repeated_child_size() const {
+  return repeated_child_.size();
+}
+inline void TestArenaMessage::clear_repeated_child() {
+  repeated_child_.Clear();
+}
+inline const ::protobuf_unittest::TestArenaMessage& TestArenaMessage::repeated_child(int index) const {
+  return repeated_child_.Get(index);
+}
+inline ::protobuf_unittest::TestArenaMessage* TestArenaMessage::mutable_repeated_child(int index) {
+  return repeated_child_.Mutable(index);
+}
+inline ::protobuf_unittest::TestArenaMessage* TestArenaMessage::add_repeated_child() {
+  return repeated_child_.Add();
+}
+inline const ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestArenaMessage >&
+TestArenaMessage::repeated_child() const {
+  return repeated_child_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestArenaMessage >*
+TestArenaMessage::mutable_repeated_child() {
+  return &repeated_child_;
+}
+
+// repeated .protobuf_unittest.ForeignMessage repeated_foreign_message = 14;
+inline int TestArenaMessage::repeated_foreign_message_size() const {
+  return repeated_foreign_message_.size();
+}
+inline void TestArenaMessage::clear_repeated_foreign_message() {
+  repeated_foreign_message_.Clear();
+}
+inline const ::protobuf_unittest::ForeignMessage& TestArenaMessage::repeated_foreign_message(int index) const {
+  return repeated_foreign_message_.Get(index);
+}
+inline ::protobuf_unittest::ForeignMessage* TestArenaMessage::mutable_repeated_foreign_message(int index) {
+  return repeated_foreign_message_.Mutable(index);
+}
+inline ::protobuf_unittest::ForeignMessage* TestArenaMessage::add_repeated_foreign_message() {
+  return repeated_foreign_message_.Add();
+}
+inline const ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::ForeignMessage >&
+TestArenaMessage::repeated_foreign_message() const {
+  return repeated_foreign_message_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::ForeignMessage >*
+TestArenaMessage::mutable_repeated_foreign_message() {
+  return &repeated_foreign_message_;
+}
+
+// repeated fixed32 packed_fixed32 = 15 [packed = true];
+inline int TestArenaMessage::packed_fixed32_size() const {
+  return packed_fixed32_.size();
+}
+inline void TestArenaMessage::clear_packed_fixed32() {
+  packed_fixed32_.Clear();
+}
+inline ::google::protobuf::uint32 TestArenaMessage::packed_fixed32(int index) const {
+  return packed_fixed32_.Get(index);
+}
+inline void TestArenaMessage::set_packed_fixed32(int index, ::google::protobuf::uint32 value) {
+  packed_fixed32_.Set(index, value);
+}
+inline void TestArenaMessage::add_packed_fixed32(::google::protobuf::uint32 value) {
+  packed_fixed32_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+TestArenaMessage::packed_fixed32() const {
+  return packed_fixed32_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+TestArenaMessage::mutable_packed_fixed32() {
+  return &packed_fixed32_;
+}
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace protobuf_unittest
+
+#ifndef SWIG
+namespace google {
+namespace protobuf {
+
+
+}  // namespace google
+}  // namespace protobuf
+#endif  // SWIG
+
+// @@protoc_insertion_point(global_scope)
+
+#endif  // PROTOBUF_google_2fprotobuf_2funittest_5farena_2eproto__INCLUDED
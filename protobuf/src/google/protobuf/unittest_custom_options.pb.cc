@@ -75,6 +75,7 @@ const ::google::protobuf::ServiceDescriptor* TestServiceWithCustomOptions_descri
 
 void protobuf_AssignDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto() {
   protobuf_AddDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
+  protobuf_InitDefaults_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
   const ::google::protobuf::FileDescriptor* file =
     ::google::protobuf::DescriptorPool::generated_pool()->FindFileByName(
       "google/protobuf/unittest_custom_options.proto");
@@ -420,6 +421,177 @@ void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5fcustom_5foptions_2epro
   delete VariousComplexOptions_reflection_;
 }
 
+void protobuf_InitDefaults_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_impl() {
+  ::google::protobuf::protobuf_InitDefaults_google_2fprotobuf_2fdescriptor_2eproto();
+  TestMessageWithCustomOptions::default_instance_ = new TestMessageWithCustomOptions();
+  CustomOptionFooRequest::default_instance_ = new CustomOptionFooRequest();
+  CustomOptionFooResponse::default_instance_ = new CustomOptionFooResponse();
+  DummyMessageContainingEnum::default_instance_ = new DummyMessageContainingEnum();
+  DummyMessageInvalidAsOptionType::default_instance_ = new DummyMessageInvalidAsOptionType();
+  CustomOptionMinIntegerValues::default_instance_ = new CustomOptionMinIntegerValues();
+  CustomOptionMaxIntegerValues::default_instance_ = new CustomOptionMaxIntegerValues();
+  CustomOptionOtherValues::default_instance_ = new CustomOptionOtherValues();
+  SettingRealsFromPositiveInts::default_instance_ = new SettingRealsFromPositiveInts();
+  SettingRealsFromNegativeInts::default_instance_ = new SettingRealsFromNegativeInts();
+  ComplexOptionType1::default_instance_ = new ComplexOptionType1();
+  ComplexOptionType2::default_instance_ = new ComplexOptionType2();
+  ComplexOptionType2_ComplexOptionType4::default_instance_ = new ComplexOptionType2_ComplexOptionType4();
+  ComplexOptionType3::default_instance_ = new ComplexOptionType3();
+  ComplexOptionType3_ComplexOptionType5::default_instance_ = new ComplexOptionType3_ComplexOptionType5();
+  ComplexOpt6::default_instance_ = new ComplexOpt6();
+  VariousComplexOptions::default_instance_ = new VariousComplexOptions();
+  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
+    ::google::protobuf::FileOptions::internal_default_instance(),
+    7736974, 4, false, false);
+  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
+    ::google::protobuf::MessageOptions::internal_default_instance(),
+    7739036, 5, false, false);
+  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
+    ::google::protobuf::FieldOptions::internal_default_instance(),
+    7740936, 6, false, false);
+  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
+    ::google::protobuf::FieldOptions::internal_default_instance(),
+    7753913, 5, false, false);
+  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
+    ::google::protobuf::EnumOptions::internal_default_instance(),
+    7753576, 15, false, false);
+  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
+    ::google::protobuf::EnumValueOptions::internal_default_instance(),
+    1560678, 5, false, false);
+  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
+    ::google::protobuf::ServiceOptions::internal_default_instance(),
+    7887650, 18, false, false);
+  ::google::protobuf::internal::ExtensionSet::RegisterEnumExtension(
+    ::google::protobuf::MethodOptions::internal_default_instance(),
+    7890860, 14, false, false,
+    &protobuf_unittest::MethodOpt1_IsValid);
+  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
+    ::google::protobuf::MessageOptions::internal_default_instance(),
+    7706090, 8, false, false);
+  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
+    ::google::protobuf::MessageOptions::internal_default_instance(),
+    7705709, 5, false, false);
+  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
+    ::google::protobuf::MessageOptions::internal_default_instance(),
+    7705542, 3, false, false);
+  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
+    ::google::protobuf::MessageOptions::internal_default_instance(),
+    7704880, 13, false, false);
+  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
+    ::google::protobuf::MessageOptions::internal_default_instance(),
+    7702367, 4, false, false);
+  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
+    ::google::protobuf::MessageOptions::internal_default_instance(),
+    7701568, 17, false, false);
+  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
+    ::google::protobuf::MessageOptions::internal_default_instance(),
+    7700863, 18, false, false);
+  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
+    ::google::protobuf::MessageOptions::internal_default_instance(),
+    7700307, 7, false, false);
+  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
+    ::google::protobuf::MessageOptions::internal_default_instance(),
+    7700194, 6, false, false);
+  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
+    ::google::protobuf::MessageOptions::internal_default_instance(),
+    7698645, 15, false, false);
+  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
+    ::google::protobuf::MessageOptions::internal_default_instance(),
+    7685475, 16, false, false);
+  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
+    ::google::protobuf::MessageOptions::internal_default_instance(),
+    7675390, 2, false, false);
+  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
+    ::google::protobuf::MessageOptions::internal_default_instance(),
+    7673293, 1, false, false);
+  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
+    ::google::protobuf::MessageOptions::internal_default_instance(),
+    7673285, 9, false, false);
+  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
+    ::google::protobuf::MessageOptions::internal_default_instance(),
+    7673238, 12, false, false);
+  ::google::protobuf::internal::ExtensionSet::RegisterEnumExtension(
+    ::google::protobuf::MessageOptions::internal_default_instance(),
+    7673233, 14, false, false,
+    &::protobuf_unittest::DummyMessageContainingEnum_TestEnumType_IsValid);
+  ::google::protobuf::internal::ExtensionSet::RegisterMessageExtension(
+    ::google::protobuf::MessageOptions::internal_default_instance(),
+    7665967, 11, false, false,
+    ::protobuf_unittest::DummyMessageInvalidAsOptionType::internal_default_instance());
+  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
+    ::protobuf_unittest::ComplexOptionType1::internal_default_instance(),
+    7663707, 5, false, false);
+  ::google::protobuf::internal::ExtensionSet::RegisterMessageExtension(
+    ::protobuf_unittest::ComplexOptionType1::internal_default_instance(),
+    7663442, 11, false, false,
+    ::protobuf_unittest::ComplexOptionType3::internal_default_instance());
+  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
+    ::protobuf_unittest::ComplexOptionType2::internal_default_instance(),
+    7650927, 5, false, false);
+  ::google::protobuf::internal::ExtensionSet::RegisterMessageExtension(
+    ::protobuf_unittest::ComplexOptionType2::internal_default_instance(),
+    7649992, 11, false, false,
+    ::protobuf_unittest::ComplexOptionType1::internal_default_instance());
+  ::google::protobuf::internal::ExtensionSet::RegisterMessageExtension(
+    ::google::protobuf::MessageOptions::internal_default_instance(),
+    7646756, 11, false, false,
+    ::protobuf_unittest::ComplexOptionType1::internal_default_instance());
+  ::google::protobuf::internal::ExtensionSet::RegisterMessageExtension(
+    ::google::protobuf::MessageOptions::internal_default_instance(),
+    7636949, 11, false, false,
+    ::protobuf_unittest::ComplexOptionType2::internal_default_instance());
+  ::google::protobuf::internal::ExtensionSet::RegisterMessageExtension(
+    ::google::protobuf::MessageOptions::internal_default_instance(),
+    7636463, 11, false, false,
+    ::protobuf_unittest::ComplexOptionType3::internal_default_instance());
+  ::google::protobuf::internal::ExtensionSet::RegisterMessageExtension(
+    ::google::protobuf::MessageOptions::internal_default_instance(),
+    7595468, 10, false, false,
+    ::protobuf_unittest::ComplexOpt6::internal_default_instance());
+  TestMessageWithCustomOptions::default_instance_->InitAsDefaultInstance();
+  CustomOptionFooRequest::default_instance_->InitAsDefaultInstance();
+  CustomOptionFooResponse::default_instance_->InitAsDefaultInstance();
+  DummyMessageContainingEnum::default_instance_->InitAsDefaultInstance();
+  DummyMessageInvalidAsOptionType::default_instance_->InitAsDefaultInstance();
+  CustomOptionMinIntegerValues::default_instance_->InitAsDefaultInstance();
+  CustomOptionMaxIntegerValues::default_instance_->InitAsDefaultInstance();
+  CustomOptionOtherValues::default_instance_->InitAsDefaultInstance();
+  SettingRealsFromPositiveInts::default_instance_->InitAsDefaultInstance();
+  SettingRealsFromNegativeInts::default_instance_->InitAsDefaultInstance();
+  ComplexOptionType1::default_instance_->InitAsDefaultInstance();
+  ComplexOptionType2::default_instance_->InitAsDefaultInstance();
+  ComplexOptionType2_ComplexOptionType4::default_instance_->InitAsDefaultInstance();
+  ::google::protobuf::internal::ExtensionSet::RegisterMessageExtension(
+    ::google::protobuf::MessageOptions::internal_default_instance(),
+    7633546, 11, false, false,
+    ::protobuf_unittest::ComplexOptionType2_ComplexOptionType4::internal_default_instance());
+  ComplexOptionType3::default_instance_->InitAsDefaultInstance();
+  ComplexOptionType3_ComplexOptionType5::default_instance_->InitAsDefaultInstance();
+  ComplexOpt6::default_instance_->InitAsDefaultInstance();
+  VariousComplexOptions::default_instance_->InitAsDefaultInstance();
+  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto);
+}
+
+namespace {
+
+GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_InitDefaults_once_);
+// Set once the defaults are built, so that default_instance() and the
+// other callers on hot paths can skip the once.
+::google::protobuf::internal::Atomic32 protobuf_InitDefaults_done_ = 0;
+
+}  // namespace
+
+void protobuf_InitDefaults_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto() {
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) != 0) {
+    return;
+  }
+  ::google::protobuf::GoogleOnceInit(&protobuf_InitDefaults_once_,
+                 &protobuf_InitDefaults_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_impl);
+  ::google::protobuf::internal::Release_Store(
+      &protobuf_InitDefaults_done_, 1);
+}
+
 void protobuf_AddDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto() {
   static bool already_here = false;
   if (already_here) return;
@@ -535,153 +707,8 @@ void protobuf_AddDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto()
     "protobuf_unittest.ComplexOpt6B\t\360\350\301\035\352\255\300\345$", 4200);
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
     "google/protobuf/unittest_custom_options.proto", &protobuf_RegisterTypes);
-  TestMessageWithCustomOptions::default_instance_ = new TestMessageWithCustomOptions();
-  CustomOptionFooRequest::default_instance_ = new CustomOptionFooRequest();
-  CustomOptionFooResponse::default_instance_ = new CustomOptionFooResponse();
-  DummyMessageContainingEnum::default_instance_ = new DummyMessageContainingEnum();
-  DummyMessageInvalidAsOptionType::default_instance_ = new DummyMessageInvalidAsOptionType();
-  CustomOptionMinIntegerValues::default_instance_ = new CustomOptionMinIntegerValues();
-  CustomOptionMaxIntegerValues::default_instance_ = new CustomOptionMaxIntegerValues();
-  CustomOptionOtherValues::default_instance_ = new CustomOptionOtherValues();
-  SettingRealsFromPositiveInts::default_instance_ = new SettingRealsFromPositiveInts();
-  SettingRealsFromNegativeInts::default_instance_ = new SettingRealsFromNegativeInts();
-  ComplexOptionType1::default_instance_ = new ComplexOptionType1();
-  ComplexOptionType2::default_instance_ = new ComplexOptionType2();
-  ComplexOptionType2_ComplexOptionType4::default_instance_ = new ComplexOptionType2_ComplexOptionType4();
-  ComplexOptionType3::default_instance_ = new ComplexOptionType3();
-  ComplexOptionType3_ComplexOptionType5::default_instance_ = new ComplexOptionType3_ComplexOptionType5();
-  ComplexOpt6::default_instance_ = new ComplexOpt6();
-  VariousComplexOptions::default_instance_ = new VariousComplexOptions();
-  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::google::protobuf::FileOptions::default_instance(),
-    7736974, 4, false, false);
-  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::google::protobuf::MessageOptions::default_instance(),
-    7739036, 5, false, false);
-  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::google::protobuf::FieldOptions::default_instance(),
-    7740936, 6, false, false);
-  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::google::protobuf::FieldOptions::default_instance(),
-    7753913, 5, false, false);
-  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::google::protobuf::EnumOptions::default_instance(),
-    7753576, 15, false, false);
-  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::google::protobuf::EnumValueOptions::default_instance(),
-    1560678, 5, false, false);
-  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::google::protobuf::ServiceOptions::default_instance(),
-    7887650, 18, false, false);
-  ::google::protobuf::internal::ExtensionSet::RegisterEnumExtension(
-    &::google::protobuf::MethodOptions::default_instance(),
-    7890860, 14, false, false,
-    &protobuf_unittest::MethodOpt1_IsValid);
-  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::google::protobuf::MessageOptions::default_instance(),
-    7706090, 8, false, false);
-  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::google::protobuf::MessageOptions::default_instance(),
-    7705709, 5, false, false);
-  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::google::protobuf::MessageOptions::default_instance(),
-    7705542, 3, false, false);
-  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::google::protobuf::MessageOptions::default_instance(),
-    7704880, 13, false, false);
-  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::google::protobuf::MessageOptions::default_instance(),
-    7702367, 4, false, false);
-  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::google::protobuf::MessageOptions::default_instance(),
-    7701568, 17, false, false);
-  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::google::protobuf::MessageOptions::default_instance(),
-    7700863, 18, false, false);
-  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::google::protobuf::MessageOptions::default_instance(),
-    7700307, 7, false, false);
-  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::google::protobuf::MessageOptions::default_instance(),
-    7700194, 6, false, false);
-  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::google::protobuf::MessageOptions::default_instance(),
-    7698645, 15, false, false);
-  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::google::protobuf::MessageOptions::default_instance(),
-    7685475, 16, false, false);
-  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::google::protobuf::MessageOptions::default_instance(),
-    7675390, 2, false, false);
-  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::google::protobuf::MessageOptions::default_instance(),
-    7673293, 1, false, false);
-  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::google::protobuf::MessageOptions::default_instance(),
-    7673285, 9, false, false);
-  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::google::protobuf::MessageOptions::default_instance(),
-    7673238, 12, false, false);
-  ::google::protobuf::internal::ExtensionSet::RegisterEnumExtension(
-    &::google::protobuf::MessageOptions::default_instance(),
-    7673233, 14, false, false,
-    &::protobuf_unittest::DummyMessageContainingEnum_TestEnumType_IsValid);
-  ::google::protobuf::internal::ExtensionSet::RegisterMessageExtension(
-    &::google::protobuf::MessageOptions::default_instance(),
-    7665967, 11, false, false,
-    &::protobuf_unittest::DummyMessageInvalidAsOptionType::default_instance());
-  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::ComplexOptionType1::default_instance(),
-    7663707, 5, false, false);
-  ::google::protobuf::internal::ExtensionSet::RegisterMessageExtension(
-    &::protobuf_unittest::ComplexOptionType1::default_instance(),
-    7663442, 11, false, false,
-    &::protobuf_unittest::ComplexOptionType3::default_instance());
-  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::ComplexOptionType2::default_instance(),
-    7650927, 5, false, false);
-  ::google::protobuf::internal::ExtensionSet::RegisterMessageExtension(
-    &::protobuf_unittest::ComplexOptionType2::default_instance(),
-    7649992, 11, false, false,
-    &::protobuf_unittest::ComplexOptionType1::default_instance());
-  ::google::protobuf::internal::ExtensionSet::RegisterMessageExtension(
-    &::google::protobuf::MessageOptions::default_instance(),
-    7646756, 11, false, false,
-    &::protobuf_unittest::ComplexOptionType1::default_instance());
-  ::google::protobuf::internal::ExtensionSet::RegisterMessageExtension(
-    &::google::protobuf::MessageOptions::default_instance(),
-    7636949, 11, false, false,
-    &::protobuf_unittest::ComplexOptionType2::default_instance());
-  ::google::protobuf::internal::ExtensionSet::RegisterMessageExtension(
-    &::google::protobuf::MessageOptions::default_instance(),
-    7636463, 11, false, false,
-    &::protobuf_unittest::ComplexOptionType3::default_instance());
-  ::google::protobuf::internal::ExtensionSet::RegisterMessageExtension(
-    &::google::protobuf::MessageOptions::default_instance(),
-    7595468, 10, false, false,
-    &::protobuf_unittest::ComplexOpt6::default_instance());
-  TestMessageWithCustomOptions::default_instance_->InitAsDefaultInstance();
-  CustomOptionFooRequest::default_instance_->InitAsDefaultInstance();
-  CustomOptionFooResponse::default_instance_->InitAsDefaultInstance();
-  DummyMessageContainingEnum::default_instance_->InitAsDefaultInstance();
-  DummyMessageInvalidAsOptionType::default_instance_->InitAsDefaultInstance();
-  CustomOptionMinIntegerValues::default_instance_->InitAsDefaultInstance();
-  CustomOptionMaxIntegerValues::default_instance_->InitAsDefaultInstance();
-  CustomOptionOtherValues::default_instance_->InitAsDefaultInstance();
-  SettingRealsFromPositiveInts::default_instance_->InitAsDefaultInstance();
-  SettingRealsFromNegativeInts::default_instance_->InitAsDefaultInstance();
-  ComplexOptionType1::default_instance_->InitAsDefaultInstance();
-  ComplexOptionType2::default_instance_->InitAsDefaultInstance();
-  ComplexOptionType2_ComplexOptionType4::default_instance_->InitAsDefaultInstance();
-  ::google::protobuf::internal::ExtensionSet::RegisterMessageExtension(
-    &::google::protobuf::MessageOptions::default_instance(),
-    7633546, 11, false, false,
-    &::protobuf_unittest::ComplexOptionType2_ComplexOptionType4::default_instance());
-  ComplexOptionType3::default_instance_->InitAsDefaultInstance();
-  ComplexOptionType3_ComplexOptionType5::default_instance_->InitAsDefaultInstance();
-  ComplexOpt6::default_instance_->InitAsDefaultInstance();
-  VariousComplexOptions::default_instance_->InitAsDefaultInstance();
-  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto);
+  ::google::protobuf::internal::ExtensionSet::RegisterDeferredExtensions(
+    &protobuf_InitDefaults_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto);
 }
 
 // Force AddDescriptors() to be called at static initialization time.
@@ -767,9 +794,7 @@ void TestMessageWithCustomOptions::SharedDtor() {
 }
 
 void TestMessageWithCustomOptions::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* TestMessageWithCustomOptions::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -777,7 +802,11 @@ const ::google::protobuf::Descriptor* TestMessageWithCustomOptions::descriptor()
 }
 
 const TestMessageWithCustomOptions& TestMessageWithCustomOptions::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestMessageWithCustomOptions* TestMessageWithCustomOptions::default_instance_ = NULL;
@@ -889,9 +918,8 @@ int TestMessageWithCustomOptions::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -986,9 +1014,7 @@ void CustomOptionFooRequest::SharedDtor() {
 }
 
 void CustomOptionFooRequest::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* CustomOptionFooRequest::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -996,7 +1022,11 @@ const ::google::protobuf::Descriptor* CustomOptionFooRequest::descriptor() {
 }
 
 const CustomOptionFooRequest& CustomOptionFooRequest::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
+  }
+  return *default_instance_;
 }
 
 CustomOptionFooRequest* CustomOptionFooRequest::default_instance_ = NULL;
@@ -1051,9 +1081,8 @@ int CustomOptionFooRequest::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -1141,9 +1170,7 @@ void CustomOptionFooResponse::SharedDtor() {
 }
 
 void CustomOptionFooResponse::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* CustomOptionFooResponse::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -1151,7 +1178,11 @@ const ::google::protobuf::Descriptor* CustomOptionFooResponse::descriptor() {
 }
 
 const CustomOptionFooResponse& CustomOptionFooResponse::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
+  }
+  return *default_instance_;
 }
 
 CustomOptionFooResponse* CustomOptionFooResponse::default_instance_ = NULL;
@@ -1206,9 +1237,8 @@ int CustomOptionFooResponse::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -1317,9 +1347,7 @@ void DummyMessageContainingEnum::SharedDtor() {
 }
 
 void DummyMessageContainingEnum::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* DummyMessageContainingEnum::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -1327,7 +1355,11 @@ const ::google::protobuf::Descriptor* DummyMessageContainingEnum::descriptor() {
 }
 
 const DummyMessageContainingEnum& DummyMessageContainingEnum::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
+  }
+  return *default_instance_;
 }
 
 DummyMessageContainingEnum* DummyMessageContainingEnum::default_instance_ = NULL;
@@ -1382,9 +1414,8 @@ int DummyMessageContainingEnum::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -1472,9 +1503,7 @@ void DummyMessageInvalidAsOptionType::SharedDtor() {
 }
 
 void DummyMessageInvalidAsOptionType::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* DummyMessageInvalidAsOptionType::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -1482,7 +1511,11 @@ const ::google::protobuf::Descriptor* DummyMessageInvalidAsOptionType::descripto
 }
 
 const DummyMessageInvalidAsOptionType& DummyMessageInvalidAsOptionType::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
+  }
+  return *default_instance_;
 }
 
 DummyMessageInvalidAsOptionType* DummyMessageInvalidAsOptionType::default_instance_ = NULL;
@@ -1537,9 +1570,8 @@ int DummyMessageInvalidAsOptionType::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -1627,9 +1659,7 @@ void CustomOptionMinIntegerValues::SharedDtor() {
 }
 
 void CustomOptionMinIntegerValues::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* CustomOptionMinIntegerValues::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -1637,7 +1667,11 @@ const ::google::protobuf::Descriptor* CustomOptionMinIntegerValues::descriptor()
 }
 
 const CustomOptionMinIntegerValues& CustomOptionMinIntegerValues::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
+  }
+  return *default_instance_;
 }
 
 CustomOptionMinIntegerValues* CustomOptionMinIntegerValues::default_instance_ = NULL;
@@ -1692,9 +1726,8 @@ int CustomOptionMinIntegerValues::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -1782,9 +1815,7 @@ void CustomOptionMaxIntegerValues::SharedDtor() {
 }
 
 void CustomOptionMaxIntegerValues::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* CustomOptionMaxIntegerValues::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -1792,7 +1823,11 @@ const ::google::protobuf::Descriptor* CustomOptionMaxIntegerValues::descriptor()
 }
 
 const CustomOptionMaxIntegerValues& CustomOptionMaxIntegerValues::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
+  }
+  return *default_instance_;
 }
 
 CustomOptionMaxIntegerValues* CustomOptionMaxIntegerValues::default_instance_ = NULL;
@@ -1847,9 +1882,8 @@ int CustomOptionMaxIntegerValues::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -1937,9 +1971,7 @@ void CustomOptionOtherValues::SharedDtor() {
 }
 
 void CustomOptionOtherValues::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* CustomOptionOtherValues::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -1947,7 +1979,11 @@ const ::google::protobuf::Descriptor* CustomOptionOtherValues::descriptor() {
 }
 
 const CustomOptionOtherValues& CustomOptionOtherValues::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
+  }
+  return *default_instance_;
 }
 
 CustomOptionOtherValues* CustomOptionOtherValues::default_instance_ = NULL;
@@ -2002,9 +2038,8 @@ int CustomOptionOtherValues::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -2092,9 +2127,7 @@ void SettingRealsFromPositiveInts::SharedDtor() {
 }
 
 void SettingRealsFromPositiveInts::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* SettingRealsFromPositiveInts::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -2102,7 +2135,11 @@ const ::google::protobuf::Descriptor* SettingRealsFromPositiveInts::descriptor()
 }
 
 const SettingRealsFromPositiveInts& SettingRealsFromPositiveInts::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
+  }
+  return *default_instance_;
 }
 
 SettingRealsFromPositiveInts* SettingRealsFromPositiveInts::default_instance_ = NULL;
@@ -2157,9 +2194,8 @@ int SettingRealsFromPositiveInts::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -2247,9 +2283,7 @@ void SettingRealsFromNegativeInts::SharedDtor() {
 }
 
 void SettingRealsFromNegativeInts::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* SettingRealsFromNegativeInts::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -2257,7 +2291,11 @@ const ::google::protobuf::Descriptor* SettingRealsFromNegativeInts::descriptor()
 }
 
 const SettingRealsFromNegativeInts& SettingRealsFromNegativeInts::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
+  }
+  return *default_instance_;
 }
 
 SettingRealsFromNegativeInts* SettingRealsFromNegativeInts::default_instance_ = NULL;
@@ -2312,9 +2350,8 @@ int SettingRealsFromNegativeInts::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -2408,9 +2445,7 @@ void ComplexOptionType1::SharedDtor() {
 }
 
 void ComplexOptionType1::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* ComplexOptionType1::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -2418,7 +2453,11 @@ const ::google::protobuf::Descriptor* ComplexOptionType1::descriptor() {
 }
 
 const ComplexOptionType1& ComplexOptionType1::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
+  }
+  return *default_instance_;
 }
 
 ComplexOptionType1* ComplexOptionType1::default_instance_ = NULL;
@@ -2498,7 +2537,7 @@ bool ComplexOptionType1::MergePartialFromCodedStream(
           return true;
         }
         if ((800u <= tag)) {
-          DO_(_extensions_.ParseField(tag, input, default_instance_,
+          DO_(_extensions_.ParseField(tag, input, &default_instance(),
                                       mutable_unknown_fields()));
           continue;
         }
@@ -2600,9 +2639,8 @@ int ComplexOptionType1::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -2685,7 +2723,7 @@ const int ComplexOptionType2_ComplexOptionType4::kComplexOpt4FieldNumber;
 #endif
 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
     ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::ComplexOptionType2_ComplexOptionType4 >, 11, false >
-  ComplexOptionType2_ComplexOptionType4::complex_opt4(kComplexOpt4FieldNumber, ::protobuf_unittest::ComplexOptionType2_ComplexOptionType4::default_instance());
+  ComplexOptionType2_ComplexOptionType4::complex_opt4(kComplexOpt4FieldNumber);
 ComplexOptionType2_ComplexOptionType4::ComplexOptionType2_ComplexOptionType4()
   : ::google::protobuf::Message() {
   SharedCtor();
@@ -2716,9 +2754,7 @@ void ComplexOptionType2_ComplexOptionType4::SharedDtor() {
 }
 
 void ComplexOptionType2_ComplexOptionType4::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* ComplexOptionType2_ComplexOptionType4::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -2726,7 +2762,11 @@ const ::google::protobuf::Descriptor* ComplexOptionType2_ComplexOptionType4::des
 }
 
 const ComplexOptionType2_ComplexOptionType4& ComplexOptionType2_ComplexOptionType4::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
+  }
+  return *default_instance_;
 }
 
 ComplexOptionType2_ComplexOptionType4* ComplexOptionType2_ComplexOptionType4::default_instance_ = NULL;
@@ -2824,9 +2864,8 @@ int ComplexOptionType2_ComplexOptionType4::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -2901,8 +2940,10 @@ ComplexOptionType2::ComplexOptionType2()
 }
 
 void ComplexOptionType2::InitAsDefaultInstance() {
-  bar_ = const_cast< ::protobuf_unittest::ComplexOptionType1*>(&::protobuf_unittest::ComplexOptionType1::default_instance());
-  fred_ = const_cast< ::protobuf_unittest::ComplexOptionType2_ComplexOptionType4*>(&::protobuf_unittest::ComplexOptionType2_ComplexOptionType4::default_instance());
+  bar_ = const_cast< ::protobuf_unittest::ComplexOptionType1*>(
+      ::protobuf_unittest::ComplexOptionType1::internal_default_instance());
+  fred_ = const_cast< ::protobuf_unittest::ComplexOptionType2_ComplexOptionType4*>(
+      ::protobuf_unittest::ComplexOptionType2_ComplexOptionType4::internal_default_instance());
 }
 
 ComplexOptionType2::ComplexOptionType2(const ComplexOptionType2& from)
@@ -2931,9 +2972,7 @@ void ComplexOptionType2::SharedDtor() {
 }
 
 void ComplexOptionType2::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* ComplexOptionType2::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -2941,7 +2980,11 @@ const ::google::protobuf::Descriptor* ComplexOptionType2::descriptor() {
 }
 
 const ComplexOptionType2& ComplexOptionType2::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
+  }
+  return *default_instance_;
 }
 
 ComplexOptionType2* ComplexOptionType2::default_instance_ = NULL;
@@ -3021,7 +3064,7 @@ bool ComplexOptionType2::MergePartialFromCodedStream(
           return true;
         }
         if ((800u <= tag)) {
-          DO_(_extensions_.ParseField(tag, input, default_instance_,
+          DO_(_extensions_.ParseField(tag, input, &default_instance(),
                                       mutable_unknown_fields()));
           continue;
         }
@@ -3129,9 +3172,8 @@ int ComplexOptionType2::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -3242,9 +3284,7 @@ void ComplexOptionType3_ComplexOptionType5::SharedDtor() {
 }
 
 void ComplexOptionType3_ComplexOptionType5::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* ComplexOptionType3_ComplexOptionType5::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -3252,7 +3292,11 @@ const ::google::protobuf::Descriptor* ComplexOptionType3_ComplexOptionType5::des
 }
 
 const ComplexOptionType3_ComplexOptionType5& ComplexOptionType3_ComplexOptionType5::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
+  }
+  return *default_instance_;
 }
 
 ComplexOptionType3_ComplexOptionType5* ComplexOptionType3_ComplexOptionType5::default_instance_ = NULL;
@@ -3350,9 +3394,8 @@ int ComplexOptionType3_ComplexOptionType5::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -3426,7 +3469,8 @@ ComplexOptionType3::ComplexOptionType3()
 }
 
 void ComplexOptionType3::InitAsDefaultInstance() {
-  complexoptiontype5_ = const_cast< ::protobuf_unittest::ComplexOptionType3_ComplexOptionType5*>(&::protobuf_unittest::ComplexOptionType3_ComplexOptionType5::default_instance());
+  complexoptiontype5_ = const_cast< ::protobuf_unittest::ComplexOptionType3_ComplexOptionType5*>(
+      ::protobuf_unittest::ComplexOptionType3_ComplexOptionType5::internal_default_instance());
 }
 
 ComplexOptionType3::ComplexOptionType3(const ComplexOptionType3& from)
@@ -3453,9 +3497,7 @@ void ComplexOptionType3::SharedDtor() {
 }
 
 void ComplexOptionType3::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* ComplexOptionType3::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -3463,7 +3505,11 @@ const ::google::protobuf::Descriptor* ComplexOptionType3::descriptor() {
 }
 
 const ComplexOptionType3& ComplexOptionType3::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
+  }
+  return *default_instance_;
 }
 
 ComplexOptionType3* ComplexOptionType3::default_instance_ = NULL;
@@ -3598,9 +3644,8 @@ int ComplexOptionType3::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -3701,9 +3746,7 @@ void ComplexOpt6::SharedDtor() {
 }
 
 void ComplexOpt6::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* ComplexOpt6::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -3711,7 +3754,11 @@ const ::google::protobuf::Descriptor* ComplexOpt6::descriptor() {
 }
 
 const ComplexOpt6& ComplexOpt6::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
+  }
+  return *default_instance_;
 }
 
 ComplexOpt6* ComplexOpt6::default_instance_ = NULL;
@@ -3809,9 +3856,8 @@ int ComplexOpt6::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -3906,9 +3952,7 @@ void VariousComplexOptions::SharedDtor() {
 }
 
 void VariousComplexOptions::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* VariousComplexOptions::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -3916,7 +3960,11 @@ const ::google::protobuf::Descriptor* VariousComplexOptions::descriptor() {
 }
 
 const VariousComplexOptions& VariousComplexOptions::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
+  }
+  return *default_instance_;
 }
 
 VariousComplexOptions* VariousComplexOptions::default_instance_ = NULL;
@@ -3971,9 +4019,8 @@ int VariousComplexOptions::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -4186,31 +4233,31 @@ const ::std::string bytes_opt_default("");
   enum_opt(kEnumOptFieldNumber, static_cast< ::protobuf_unittest::DummyMessageContainingEnum_TestEnumType >(22));
 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
     ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::DummyMessageInvalidAsOptionType >, 11, false >
-  message_type_opt(kMessageTypeOptFieldNumber, ::protobuf_unittest::DummyMessageInvalidAsOptionType::default_instance());
+  message_type_opt(kMessageTypeOptFieldNumber);
 ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::ComplexOptionType1,
     ::google::protobuf::internal::PrimitiveTypeTraits< ::google::protobuf::int32 >, 5, false >
   quux(kQuuxFieldNumber, 0);
 ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::ComplexOptionType1,
     ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::ComplexOptionType3 >, 11, false >
-  corge(kCorgeFieldNumber, ::protobuf_unittest::ComplexOptionType3::default_instance());
+  corge(kCorgeFieldNumber);
 ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::ComplexOptionType2,
     ::google::protobuf::internal::PrimitiveTypeTraits< ::google::protobuf::int32 >, 5, false >
   grault(kGraultFieldNumber, 0);
 ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::ComplexOptionType2,
     ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::ComplexOptionType1 >, 11, false >
-  garply(kGarplyFieldNumber, ::protobuf_unittest::ComplexOptionType1::default_instance());
+  garply(kGarplyFieldNumber);
 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
     ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::ComplexOptionType1 >, 11, false >
-  complex_opt1(kComplexOpt1FieldNumber, ::protobuf_unittest::ComplexOptionType1::default_instance());
+  complex_opt1(kComplexOpt1FieldNumber);
 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
     ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::ComplexOptionType2 >, 11, false >
-  complex_opt2(kComplexOpt2FieldNumber, ::protobuf_unittest::ComplexOptionType2::default_instance());
+  complex_opt2(kComplexOpt2FieldNumber);
 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
     ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::ComplexOptionType3 >, 11, false >
-  complex_opt3(kComplexOpt3FieldNumber, ::protobuf_unittest::ComplexOptionType3::default_instance());
+  complex_opt3(kComplexOpt3FieldNumber);
 ::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
     ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::ComplexOpt6 >, 10, false >
-  complexopt6(kComplexopt6FieldNumber, ::protobuf_unittest::ComplexOpt6::default_instance());
+  complexopt6(kComplexopt6FieldNumber);
 
 // @@protoc_insertion_point(namespace_scope)
 
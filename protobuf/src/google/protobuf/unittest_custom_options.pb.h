@@ -31,6 +31,8 @@ namespace protobuf_unittest {
 
 // Internal implementation detail -- do not call these.
 void  protobuf_AddDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
+void  protobuf_InitDefaults_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
+void protobuf_InitDefaults_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_impl();
 void protobuf_AssignDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
 void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
 
@@ -134,6 +136,12 @@ class TestMessageWithCustomOptions : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const TestMessageWithCustomOptions& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestMessageWithCustomOptions* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestMessageWithCustomOptions* other);
   
   // implements Message ----------------------------------------------
@@ -152,7 +160,9 @@ class TestMessageWithCustomOptions : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -205,11 +215,11 @@ class TestMessageWithCustomOptions : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.TestMessageWithCustomOptions)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::std::string* field1_;
   static const ::std::string _default_field1_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
   
@@ -254,6 +264,12 @@ class CustomOptionFooRequest : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const CustomOptionFooRequest& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const CustomOptionFooRequest* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(CustomOptionFooRequest* other);
   
   // implements Message ----------------------------------------------
@@ -272,7 +288,9 @@ class CustomOptionFooRequest : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -288,9 +306,9 @@ class CustomOptionFooRequest : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.CustomOptionFooRequest)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
   
@@ -335,6 +353,12 @@ class CustomOptionFooResponse : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const CustomOptionFooResponse& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const CustomOptionFooResponse* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(CustomOptionFooResponse* other);
   
   // implements Message ----------------------------------------------
@@ -353,7 +377,9 @@ class CustomOptionFooResponse : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -369,9 +395,9 @@ class CustomOptionFooResponse : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.CustomOptionFooResponse)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
   
@@ -416,6 +442,12 @@ class DummyMessageContainingEnum : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const DummyMessageContainingEnum& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const DummyMessageContainingEnum* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(DummyMessageContainingEnum* other);
   
   // implements Message ----------------------------------------------
@@ -434,7 +466,9 @@ class DummyMessageContainingEnum : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -474,9 +508,9 @@ class DummyMessageContainingEnum : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.DummyMessageContainingEnum)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
   
@@ -521,6 +555,12 @@ class DummyMessageInvalidAsOptionType : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const DummyMessageInvalidAsOptionType& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const DummyMessageInvalidAsOptionType* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(DummyMessageInvalidAsOptionType* other);
   
   // implements Message ----------------------------------------------
@@ -539,7 +579,9 @@ class DummyMessageInvalidAsOptionType : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -555,9 +597,9 @@ class DummyMessageInvalidAsOptionType : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.DummyMessageInvalidAsOptionType)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
   
@@ -602,6 +644,12 @@ class CustomOptionMinIntegerValues : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const CustomOptionMinIntegerValues& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const CustomOptionMinIntegerValues* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(CustomOptionMinIntegerValues* other);
   
   // implements Message ----------------------------------------------
@@ -620,7 +668,9 @@ class CustomOptionMinIntegerValues : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -636,9 +686,9 @@ class CustomOptionMinIntegerValues : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.CustomOptionMinIntegerValues)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
   
@@ -683,6 +733,12 @@ class CustomOptionMaxIntegerValues : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const CustomOptionMaxIntegerValues& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const CustomOptionMaxIntegerValues* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(CustomOptionMaxIntegerValues* other);
   
   // implements Message ----------------------------------------------
@@ -701,7 +757,9 @@ class CustomOptionMaxIntegerValues : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -717,9 +775,9 @@ class CustomOptionMaxIntegerValues : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.CustomOptionMaxIntegerValues)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
   
@@ -764,6 +822,12 @@ class CustomOptionOtherValues : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const CustomOptionOtherValues& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const CustomOptionOtherValues* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(CustomOptionOtherValues* other);
   
   // implements Message ----------------------------------------------
@@ -782,7 +846,9 @@ class CustomOptionOtherValues : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -798,9 +864,9 @@ class CustomOptionOtherValues : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.CustomOptionOtherValues)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
   
@@ -845,6 +911,12 @@ class SettingRealsFromPositiveInts : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const SettingRealsFromPositiveInts& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const SettingRealsFromPositiveInts* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(SettingRealsFromPositiveInts* other);
   
   // implements Message ----------------------------------------------
@@ -863,7 +935,9 @@ class SettingRealsFromPositiveInts : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -879,9 +953,9 @@ class SettingRealsFromPositiveInts : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.SettingRealsFromPositiveInts)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
   
@@ -926,6 +1000,12 @@ class SettingRealsFromNegativeInts : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const SettingRealsFromNegativeInts& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const SettingRealsFromNegativeInts* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(SettingRealsFromNegativeInts* other);
   
   // implements Message ----------------------------------------------
@@ -944,7 +1024,9 @@ class SettingRealsFromNegativeInts : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -960,9 +1042,9 @@ class SettingRealsFromNegativeInts : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.SettingRealsFromNegativeInts)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
   
@@ -1007,6 +1089,12 @@ class ComplexOptionType1 : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const ComplexOptionType1& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const ComplexOptionType1* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(ComplexOptionType1* other);
   
   // implements Message ----------------------------------------------
@@ -1025,7 +1113,9 @@ class ComplexOptionType1 : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -1064,12 +1154,12 @@ class ComplexOptionType1 : public ::google::protobuf::Message {
  private:
   ::google::protobuf::internal::ExtensionSet _extensions_;
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::google::protobuf::int32 foo_;
   ::google::protobuf::int32 foo2_;
   ::google::protobuf::int32 foo3_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
   
@@ -1114,6 +1204,12 @@ class ComplexOptionType2_ComplexOptionType4 : public ::google::protobuf::Message
   static const ::google::protobuf::Descriptor* descriptor();
   static const ComplexOptionType2_ComplexOptionType4& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const ComplexOptionType2_ComplexOptionType4* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(ComplexOptionType2_ComplexOptionType4* other);
   
   // implements Message ----------------------------------------------
@@ -1132,7 +1228,9 @@ class ComplexOptionType2_ComplexOptionType4 : public ::google::protobuf::Message
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -1159,10 +1257,10 @@ class ComplexOptionType2_ComplexOptionType4 : public ::google::protobuf::Message
   // @@protoc_insertion_point(class_scope:protobuf_unittest.ComplexOptionType2.ComplexOptionType4)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::google::protobuf::int32 waldo_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
   
@@ -1207,6 +1305,12 @@ class ComplexOptionType2 : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const ComplexOptionType2& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const ComplexOptionType2* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(ComplexOptionType2* other);
   
   // implements Message ----------------------------------------------
@@ -1225,7 +1329,9 @@ class ComplexOptionType2 : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -1266,12 +1372,12 @@ class ComplexOptionType2 : public ::google::protobuf::Message {
  private:
   ::google::protobuf::internal::ExtensionSet _extensions_;
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::protobuf_unittest::ComplexOptionType1* bar_;
   ::google::protobuf::int32 baz_;
   ::protobuf_unittest::ComplexOptionType2_ComplexOptionType4* fred_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
   
@@ -1316,6 +1422,12 @@ class ComplexOptionType3_ComplexOptionType5 : public ::google::protobuf::Message
   static const ::google::protobuf::Descriptor* descriptor();
   static const ComplexOptionType3_ComplexOptionType5& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const ComplexOptionType3_ComplexOptionType5* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(ComplexOptionType3_ComplexOptionType5* other);
   
   // implements Message ----------------------------------------------
@@ -1334,7 +1446,9 @@ class ComplexOptionType3_ComplexOptionType5 : public ::google::protobuf::Message
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -1357,10 +1471,10 @@ class ComplexOptionType3_ComplexOptionType5 : public ::google::protobuf::Message
   // @@protoc_insertion_point(class_scope:protobuf_unittest.ComplexOptionType3.ComplexOptionType5)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::google::protobuf::int32 plugh_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
   
@@ -1405,6 +1519,12 @@ class ComplexOptionType3 : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const ComplexOptionType3& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const ComplexOptionType3* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(ComplexOptionType3* other);
   
   // implements Message ----------------------------------------------
@@ -1423,7 +1543,9 @@ class ComplexOptionType3 : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -1455,11 +1577,11 @@ class ComplexOptionType3 : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.ComplexOptionType3)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::google::protobuf::int32 qux_;
   ::protobuf_unittest::ComplexOptionType3_ComplexOptionType5* complexoptiontype5_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
   
@@ -1504,6 +1626,12 @@ class ComplexOpt6 : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const ComplexOpt6& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const ComplexOpt6* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(ComplexOpt6* other);
   
   // implements Message ----------------------------------------------
@@ -1522,7 +1650,9 @@ class ComplexOpt6 : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -1545,10 +1675,10 @@ class ComplexOpt6 : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.ComplexOpt6)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::google::protobuf::int32 xyzzy_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
   
@@ -1593,6 +1723,12 @@ class VariousComplexOptions : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const VariousComplexOptions& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const VariousComplexOptions* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(VariousComplexOptions* other);
   
   // implements Message ----------------------------------------------
@@ -1611,7 +1747,9 @@ class VariousComplexOptions : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -1627,9 +1765,9 @@ class VariousComplexOptions : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.VariousComplexOptions)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5fcustom_5foptions_2eproto();
   
@@ -2010,7 +2148,7 @@ inline void ComplexOptionType2::clear_bar() {
   _clear_bit(0);
 }
 inline const ::protobuf_unittest::ComplexOptionType1& ComplexOptionType2::bar() const {
-  return bar_ != NULL ? *bar_ : *default_instance_->bar_;
+  return bar_ != NULL ? *bar_ : ::protobuf_unittest::ComplexOptionType1::default_instance();
 }
 inline ::protobuf_unittest::ComplexOptionType1* ComplexOptionType2::mutable_bar() {
   _set_bit(0);
@@ -2043,7 +2181,7 @@ inline void ComplexOptionType2::clear_fred() {
   _clear_bit(2);
 }
 inline const ::protobuf_unittest::ComplexOptionType2_ComplexOptionType4& ComplexOptionType2::fred() const {
-  return fred_ != NULL ? *fred_ : *default_instance_->fred_;
+  return fred_ != NULL ? *fred_ : ::protobuf_unittest::ComplexOptionType2_ComplexOptionType4::default_instance();
 }
 inline ::protobuf_unittest::ComplexOptionType2_ComplexOptionType4* ComplexOptionType2::mutable_fred() {
   _set_bit(2);
@@ -2100,7 +2238,7 @@ inline void ComplexOptionType3::clear_complexoptiontype5() {
   _clear_bit(1);
 }
 inline const ::protobuf_unittest::ComplexOptionType3_ComplexOptionType5& ComplexOptionType3::complexoptiontype5() const {
-  return complexoptiontype5_ != NULL ? *complexoptiontype5_ : *default_instance_->complexoptiontype5_;
+  return complexoptiontype5_ != NULL ? *complexoptiontype5_ : ::protobuf_unittest::ComplexOptionType3_ComplexOptionType5::default_instance();
 }
 inline ::protobuf_unittest::ComplexOptionType3_ComplexOptionType5* ComplexOptionType3::mutable_complexoptiontype5() {
   _set_bit(1);
@@ -23,6 +23,7 @@ const ::google::protobuf::internal::GeneratedMessageReflection*
 
 void protobuf_AssignDesc_google_2fprotobuf_2funittest_5fembed_5foptimize_5ffor_2eproto() {
   protobuf_AddDesc_google_2fprotobuf_2funittest_5fembed_5foptimize_5ffor_2eproto();
+  protobuf_InitDefaults_google_2fprotobuf_2funittest_5fembed_5foptimize_5ffor_2eproto();
   const ::google::protobuf::FileDescriptor* file =
     ::google::protobuf::DescriptorPool::generated_pool()->FindFileByName(
       "google/protobuf/unittest_embed_optimize_for.proto");
@@ -66,6 +67,33 @@ void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5fembed_5foptimize_5ffor
   delete TestEmbedOptimizedForSize_reflection_;
 }
 
+void protobuf_InitDefaults_google_2fprotobuf_2funittest_5fembed_5foptimize_5ffor_2eproto_impl() {
+  ::protobuf_unittest::protobuf_InitDefaults_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto();
+  TestEmbedOptimizedForSize::default_instance_ = new TestEmbedOptimizedForSize();
+  TestEmbedOptimizedForSize::default_instance_->InitAsDefaultInstance();
+  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_google_2fprotobuf_2funittest_5fembed_5foptimize_5ffor_2eproto);
+}
+
+namespace {
+
+GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_InitDefaults_once_);
+// Set once the defaults are built, so that default_instance() and the
+// other callers on hot paths can skip the once.
+::google::protobuf::internal::Atomic32 protobuf_InitDefaults_done_ = 0;
+
+}  // namespace
+
+void protobuf_InitDefaults_google_2fprotobuf_2funittest_5fembed_5foptimize_5ffor_2eproto() {
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) != 0) {
+    return;
+  }
+  ::google::protobuf::GoogleOnceInit(&protobuf_InitDefaults_once_,
+                 &protobuf_InitDefaults_google_2fprotobuf_2funittest_5fembed_5foptimize_5ffor_2eproto_impl);
+  ::google::protobuf::internal::Release_Store(
+      &protobuf_InitDefaults_done_, 1);
+}
+
 void protobuf_AddDesc_google_2fprotobuf_2funittest_5fembed_5foptimize_5ffor_2eproto() {
   static bool already_here = false;
   if (already_here) return;
@@ -84,9 +112,6 @@ void protobuf_AddDesc_google_2fprotobuf_2funittest_5fembed_5foptimize_5ffor_2epr
     "\002H\001", 283);
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
     "google/protobuf/unittest_embed_optimize_for.proto", &protobuf_RegisterTypes);
-  TestEmbedOptimizedForSize::default_instance_ = new TestEmbedOptimizedForSize();
-  TestEmbedOptimizedForSize::default_instance_->InitAsDefaultInstance();
-  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_google_2fprotobuf_2funittest_5fembed_5foptimize_5ffor_2eproto);
 }
 
 // Force AddDescriptors() to be called at static initialization time.
@@ -110,7 +135,8 @@ TestEmbedOptimizedForSize::TestEmbedOptimizedForSize()
 }
 
 void TestEmbedOptimizedForSize::InitAsDefaultInstance() {
-  optional_message_ = const_cast< ::protobuf_unittest::TestOptimizedForSize*>(&::protobuf_unittest::TestOptimizedForSize::default_instance());
+  optional_message_ = const_cast< ::protobuf_unittest::TestOptimizedForSize*>(
+      ::protobuf_unittest::TestOptimizedForSize::internal_default_instance());
 }
 
 TestEmbedOptimizedForSize::TestEmbedOptimizedForSize(const TestEmbedOptimizedForSize& from)
@@ -136,9 +162,7 @@ void TestEmbedOptimizedForSize::SharedDtor() {
 }
 
 void TestEmbedOptimizedForSize::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* TestEmbedOptimizedForSize::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -146,7 +170,11 @@ const ::google::protobuf::Descriptor* TestEmbedOptimizedForSize::descriptor() {
 }
 
 const TestEmbedOptimizedForSize& TestEmbedOptimizedForSize::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_5fembed_5foptimize_5ffor_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5fembed_5foptimize_5ffor_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestEmbedOptimizedForSize* TestEmbedOptimizedForSize::default_instance_ = NULL;
@@ -284,9 +312,8 @@ int TestEmbedOptimizedForSize::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
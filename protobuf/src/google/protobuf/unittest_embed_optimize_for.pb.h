@@ -30,6 +30,8 @@ namespace protobuf_unittest {
 
 // Internal implementation detail -- do not call these.
 void  protobuf_AddDesc_google_2fprotobuf_2funittest_5fembed_5foptimize_5ffor_2eproto();
+void  protobuf_InitDefaults_google_2fprotobuf_2funittest_5fembed_5foptimize_5ffor_2eproto();
+void protobuf_InitDefaults_google_2fprotobuf_2funittest_5fembed_5foptimize_5ffor_2eproto_impl();
 void protobuf_AssignDesc_google_2fprotobuf_2funittest_5fembed_5foptimize_5ffor_2eproto();
 void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5fembed_5foptimize_5ffor_2eproto();
 
@@ -60,6 +62,12 @@ class TestEmbedOptimizedForSize : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const TestEmbedOptimizedForSize& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestEmbedOptimizedForSize* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestEmbedOptimizedForSize* other);
   
   // implements Message ----------------------------------------------
@@ -78,7 +86,9 @@ class TestEmbedOptimizedForSize : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -113,11 +123,11 @@ class TestEmbedOptimizedForSize : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.TestEmbedOptimizedForSize)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::protobuf_unittest::TestOptimizedForSize* optional_message_;
   ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestOptimizedForSize > repeated_message_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_5fembed_5foptimize_5ffor_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5fembed_5foptimize_5ffor_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5fembed_5foptimize_5ffor_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5fembed_5foptimize_5ffor_2eproto();
   
@@ -153,7 +163,7 @@ inline void TestEmbedOptimizedForSize::clear_optional_message() {
   _clear_bit(0);
 }
 inline const ::protobuf_unittest::TestOptimizedForSize& TestEmbedOptimizedForSize::optional_message() const {
-  return optional_message_ != NULL ? *optional_message_ : *default_instance_->optional_message_;
+  return optional_message_ != NULL ? *optional_message_ : ::protobuf_unittest::TestOptimizedForSize::default_instance();
 }
 inline ::protobuf_unittest::TestOptimizedForSize* TestEmbedOptimizedForSize::mutable_optional_message() {
   _set_bit(0);
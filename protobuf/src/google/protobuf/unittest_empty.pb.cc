@@ -18,6 +18,7 @@ namespace {
 
 void protobuf_AssignDesc_google_2fprotobuf_2funittest_5fempty_2eproto() {
   protobuf_AddDesc_google_2fprotobuf_2funittest_5fempty_2eproto();
+  protobuf_InitDefaults_google_2fprotobuf_2funittest_5fempty_2eproto();
   const ::google::protobuf::FileDescriptor* file =
     ::google::protobuf::DescriptorPool::generated_pool()->FindFileByName(
       "google/protobuf/unittest_empty.proto");
@@ -41,6 +42,30 @@ void protobuf_RegisterTypes(const ::std::string&) {
 void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5fempty_2eproto() {
 }
 
+void protobuf_InitDefaults_google_2fprotobuf_2funittest_5fempty_2eproto_impl() {
+  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_google_2fprotobuf_2funittest_5fempty_2eproto);
+}
+
+namespace {
+
+GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_InitDefaults_once_);
+// Set once the defaults are built, so that default_instance() and the
+// other callers on hot paths can skip the once.
+::google::protobuf::internal::Atomic32 protobuf_InitDefaults_done_ = 0;
+
+}  // namespace
+
+void protobuf_InitDefaults_google_2fprotobuf_2funittest_5fempty_2eproto() {
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) != 0) {
+    return;
+  }
+  ::google::protobuf::GoogleOnceInit(&protobuf_InitDefaults_once_,
+                 &protobuf_InitDefaults_google_2fprotobuf_2funittest_5fempty_2eproto_impl);
+  ::google::protobuf::internal::Release_Store(
+      &protobuf_InitDefaults_done_, 1);
+}
+
 void protobuf_AddDesc_google_2fprotobuf_2funittest_5fempty_2eproto() {
   static bool already_here = false;
   if (already_here) return;
@@ -51,7 +76,6 @@ void protobuf_AddDesc_google_2fprotobuf_2funittest_5fempty_2eproto() {
     "\n$google/protobuf/unittest_empty.proto", 38);
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
     "google/protobuf/unittest_empty.proto", &protobuf_RegisterTypes);
-  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_google_2fprotobuf_2funittest_5fempty_2eproto);
 }
 
 // Force AddDescriptors() to be called at static initialization time.
@@ -27,6 +27,8 @@
 
 // Internal implementation detail -- do not call these.
 void  protobuf_AddDesc_google_2fprotobuf_2funittest_5fempty_2eproto();
+void  protobuf_InitDefaults_google_2fprotobuf_2funittest_5fempty_2eproto();
+void protobuf_InitDefaults_google_2fprotobuf_2funittest_5fempty_2eproto_impl();
 void protobuf_AssignDesc_google_2fprotobuf_2funittest_5fempty_2eproto();
 void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5fempty_2eproto();
 
@@ -24,6 +24,7 @@ const ::google::protobuf::EnumDescriptor* ImportEnum_descriptor_ = NULL;
 
 void protobuf_AssignDesc_google_2fprotobuf_2funittest_5fimport_2eproto() {
   protobuf_AddDesc_google_2fprotobuf_2funittest_5fimport_2eproto();
+  protobuf_InitDefaults_google_2fprotobuf_2funittest_5fimport_2eproto();
   const ::google::protobuf::FileDescriptor* file =
     ::google::protobuf::DescriptorPool::generated_pool()->FindFileByName(
       "google/protobuf/unittest_import.proto");
@@ -67,6 +68,32 @@ void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5fimport_2eproto() {
   delete ImportMessage_reflection_;
 }
 
+void protobuf_InitDefaults_google_2fprotobuf_2funittest_5fimport_2eproto_impl() {
+  ImportMessage::default_instance_ = new ImportMessage();
+  ImportMessage::default_instance_->InitAsDefaultInstance();
+  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_google_2fprotobuf_2funittest_5fimport_2eproto);
+}
+
+namespace {
+
+GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_InitDefaults_once_);
+// Set once the defaults are built, so that default_instance() and the
+// other callers on hot paths can skip the once.
+::google::protobuf::internal::Atomic32 protobuf_InitDefaults_done_ = 0;
+
+}  // namespace
+
+void protobuf_InitDefaults_google_2fprotobuf_2funittest_5fimport_2eproto() {
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) != 0) {
+    return;
+  }
+  ::google::protobuf::GoogleOnceInit(&protobuf_InitDefaults_once_,
+                 &protobuf_InitDefaults_google_2fprotobuf_2funittest_5fimport_2eproto_impl);
+  ::google::protobuf::internal::Release_Store(
+      &protobuf_InitDefaults_done_, 1);
+}
+
 void protobuf_AddDesc_google_2fprotobuf_2funittest_5fimport_2eproto() {
   static bool already_here = false;
   if (already_here) return;
@@ -81,9 +108,6 @@ void protobuf_AddDesc_google_2fprotobuf_2funittest_5fimport_2eproto() {
     "om.google.protobuf.testH\001", 185);
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
     "google/protobuf/unittest_import.proto", &protobuf_RegisterTypes);
-  ImportMessage::default_instance_ = new ImportMessage();
-  ImportMessage::default_instance_->InitAsDefaultInstance();
-  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_google_2fprotobuf_2funittest_5fimport_2eproto);
 }
 
 // Force AddDescriptors() to be called at static initialization time.
@@ -145,9 +169,7 @@ void ImportMessage::SharedDtor() {
 }
 
 void ImportMessage::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* ImportMessage::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -155,7 +177,11 @@ const ::google::protobuf::Descriptor* ImportMessage::descriptor() {
 }
 
 const ImportMessage& ImportMessage::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_5fimport_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5fimport_2eproto();
+  }
+  return *default_instance_;
 }
 
 ImportMessage* ImportMessage::default_instance_ = NULL;
@@ -253,9 +279,8 @@ int ImportMessage::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -29,6 +29,8 @@ namespace protobuf_unittest_import {
 
 // Internal implementation detail -- do not call these.
 void  protobuf_AddDesc_google_2fprotobuf_2funittest_5fimport_2eproto();
+void  protobuf_InitDefaults_google_2fprotobuf_2funittest_5fimport_2eproto();
+void protobuf_InitDefaults_google_2fprotobuf_2funittest_5fimport_2eproto_impl();
 void protobuf_AssignDesc_google_2fprotobuf_2funittest_5fimport_2eproto();
 void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5fimport_2eproto();
 
@@ -79,6 +81,12 @@ class ImportMessage : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const ImportMessage& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const ImportMessage* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(ImportMessage* other);
   
   // implements Message ----------------------------------------------
@@ -97,7 +105,9 @@ class ImportMessage : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -120,10 +130,10 @@ class ImportMessage : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest_import.ImportMessage)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::google::protobuf::int32 d_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_5fimport_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5fimport_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5fimport_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5fimport_2eproto();
   
@@ -28,6 +28,8 @@ namespace protobuf_unittest_import {
 
 // Internal implementation detail -- do not call these.
 void  protobuf_AddDesc_google_2fprotobuf_2funittest_5fimport_5flite_2eproto();
+void  protobuf_InitDefaults_google_2fprotobuf_2funittest_5fimport_5flite_2eproto();
+void protobuf_InitDefaults_google_2fprotobuf_2funittest_5fimport_5flite_2eproto_impl();
 void protobuf_AssignDesc_google_2fprotobuf_2funittest_5fimport_5flite_2eproto();
 void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5fimport_5flite_2eproto();
 
@@ -59,6 +61,12 @@ class ImportMessageLite : public ::google::protobuf::MessageLite {
   
   static const ImportMessageLite& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const ImportMessageLite* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(ImportMessageLite* other);
   
   // implements Message ----------------------------------------------
@@ -75,7 +83,9 @@ class ImportMessageLite : public ::google::protobuf::MessageLite {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -97,10 +107,10 @@ class ImportMessageLite : public ::google::protobuf::MessageLite {
   
   // @@protoc_insertion_point(class_scope:protobuf_unittest_import.ImportMessageLite)
  private:
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::google::protobuf::int32 d_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_5fimport_5flite_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5fimport_5flite_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5fimport_5flite_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5fimport_5flite_2eproto();
   
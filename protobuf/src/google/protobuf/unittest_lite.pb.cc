@@ -24,13 +24,8 @@ void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5flite_2eproto() {
   delete TestDeprecatedLite::default_instance_;
 }
 
-void protobuf_AddDesc_google_2fprotobuf_2funittest_5flite_2eproto() {
-  static bool already_here = false;
-  if (already_here) return;
-  already_here = true;
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  ::protobuf_unittest_import::protobuf_AddDesc_google_2fprotobuf_2funittest_5fimport_5flite_2eproto();
+void protobuf_InitDefaults_google_2fprotobuf_2funittest_5flite_2eproto_impl() {
+  ::protobuf_unittest_import::protobuf_InitDefaults_google_2fprotobuf_2funittest_5fimport_5flite_2eproto();
   TestAllTypesLite::default_instance_ = new TestAllTypesLite();
   TestAllTypesLite_NestedMessage::default_instance_ = new TestAllTypesLite_NestedMessage();
   TestAllTypesLite_OptionalGroup::default_instance_ = new TestAllTypesLite_OptionalGroup();
@@ -44,267 +39,267 @@ void protobuf_AddDesc_google_2fprotobuf_2funittest_5flite_2eproto() {
   TestNestedExtensionLite::default_instance_ = new TestNestedExtensionLite();
   TestDeprecatedLite::default_instance_ = new TestDeprecatedLite();
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     1, 5, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     2, 3, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     3, 13, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     4, 4, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     5, 17, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     6, 18, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     7, 7, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     8, 6, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     9, 15, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     10, 16, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     11, 2, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     12, 1, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     13, 8, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     14, 9, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     15, 12, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterMessageExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     16, 10, false, false,
-    &::protobuf_unittest::OptionalGroup_extension_lite::default_instance());
+    ::protobuf_unittest::OptionalGroup_extension_lite::internal_default_instance());
   ::google::protobuf::internal::ExtensionSet::RegisterMessageExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     18, 11, false, false,
-    &::protobuf_unittest::TestAllTypesLite_NestedMessage::default_instance());
+    ::protobuf_unittest::TestAllTypesLite_NestedMessage::internal_default_instance());
   ::google::protobuf::internal::ExtensionSet::RegisterMessageExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     19, 11, false, false,
-    &::protobuf_unittest::ForeignMessageLite::default_instance());
+    ::protobuf_unittest::ForeignMessageLite::internal_default_instance());
   ::google::protobuf::internal::ExtensionSet::RegisterMessageExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     20, 11, false, false,
-    &::protobuf_unittest_import::ImportMessageLite::default_instance());
+    ::protobuf_unittest_import::ImportMessageLite::internal_default_instance());
   ::google::protobuf::internal::ExtensionSet::RegisterEnumExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     21, 14, false, false,
     &::protobuf_unittest::TestAllTypesLite_NestedEnum_IsValid);
   ::google::protobuf::internal::ExtensionSet::RegisterEnumExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     22, 14, false, false,
     &protobuf_unittest::ForeignEnumLite_IsValid);
   ::google::protobuf::internal::ExtensionSet::RegisterEnumExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     23, 14, false, false,
     &protobuf_unittest_import::ImportEnumLite_IsValid);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     24, 9, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     25, 9, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     31, 5, true, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     32, 3, true, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     33, 13, true, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     34, 4, true, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     35, 17, true, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     36, 18, true, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     37, 7, true, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     38, 6, true, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     39, 15, true, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     40, 16, true, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     41, 2, true, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     42, 1, true, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     43, 8, true, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     44, 9, true, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     45, 12, true, false);
   ::google::protobuf::internal::ExtensionSet::RegisterMessageExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     46, 10, true, false,
-    &::protobuf_unittest::RepeatedGroup_extension_lite::default_instance());
+    ::protobuf_unittest::RepeatedGroup_extension_lite::internal_default_instance());
   ::google::protobuf::internal::ExtensionSet::RegisterMessageExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     48, 11, true, false,
-    &::protobuf_unittest::TestAllTypesLite_NestedMessage::default_instance());
+    ::protobuf_unittest::TestAllTypesLite_NestedMessage::internal_default_instance());
   ::google::protobuf::internal::ExtensionSet::RegisterMessageExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     49, 11, true, false,
-    &::protobuf_unittest::ForeignMessageLite::default_instance());
+    ::protobuf_unittest::ForeignMessageLite::internal_default_instance());
   ::google::protobuf::internal::ExtensionSet::RegisterMessageExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     50, 11, true, false,
-    &::protobuf_unittest_import::ImportMessageLite::default_instance());
+    ::protobuf_unittest_import::ImportMessageLite::internal_default_instance());
   ::google::protobuf::internal::ExtensionSet::RegisterEnumExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     51, 14, true, false,
     &::protobuf_unittest::TestAllTypesLite_NestedEnum_IsValid);
   ::google::protobuf::internal::ExtensionSet::RegisterEnumExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     52, 14, true, false,
     &protobuf_unittest::ForeignEnumLite_IsValid);
   ::google::protobuf::internal::ExtensionSet::RegisterEnumExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     53, 14, true, false,
     &protobuf_unittest_import::ImportEnumLite_IsValid);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     54, 9, true, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     55, 9, true, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     61, 5, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     62, 3, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     63, 13, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     64, 4, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     65, 17, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     66, 18, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     67, 7, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     68, 6, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     69, 15, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     70, 16, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     71, 2, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     72, 1, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     73, 8, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     74, 9, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     75, 12, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterEnumExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     81, 14, false, false,
     &::protobuf_unittest::TestAllTypesLite_NestedEnum_IsValid);
   ::google::protobuf::internal::ExtensionSet::RegisterEnumExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     82, 14, false, false,
     &protobuf_unittest::ForeignEnumLite_IsValid);
   ::google::protobuf::internal::ExtensionSet::RegisterEnumExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     83, 14, false, false,
     &protobuf_unittest_import::ImportEnumLite_IsValid);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     84, 9, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     85, 9, false, false);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestPackedExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestPackedExtensionsLite::internal_default_instance(),
     90, 5, true, true);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestPackedExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestPackedExtensionsLite::internal_default_instance(),
     91, 3, true, true);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestPackedExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestPackedExtensionsLite::internal_default_instance(),
     92, 13, true, true);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestPackedExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestPackedExtensionsLite::internal_default_instance(),
     93, 4, true, true);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestPackedExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestPackedExtensionsLite::internal_default_instance(),
     94, 17, true, true);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestPackedExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestPackedExtensionsLite::internal_default_instance(),
     95, 18, true, true);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestPackedExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestPackedExtensionsLite::internal_default_instance(),
     96, 7, true, true);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestPackedExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestPackedExtensionsLite::internal_default_instance(),
     97, 6, true, true);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestPackedExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestPackedExtensionsLite::internal_default_instance(),
     98, 15, true, true);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestPackedExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestPackedExtensionsLite::internal_default_instance(),
     99, 16, true, true);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestPackedExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestPackedExtensionsLite::internal_default_instance(),
     100, 2, true, true);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestPackedExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestPackedExtensionsLite::internal_default_instance(),
     101, 1, true, true);
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestPackedExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestPackedExtensionsLite::internal_default_instance(),
     102, 8, true, true);
   ::google::protobuf::internal::ExtensionSet::RegisterEnumExtension(
-    &::protobuf_unittest::TestPackedExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestPackedExtensionsLite::internal_default_instance(),
     103, 14, true, true,
     &protobuf_unittest::ForeignEnumLite_IsValid);
   TestAllTypesLite::default_instance_->InitAsDefaultInstance();
@@ -319,12 +314,43 @@ void protobuf_AddDesc_google_2fprotobuf_2funittest_5flite_2eproto() {
   TestPackedExtensionsLite::default_instance_->InitAsDefaultInstance();
   TestNestedExtensionLite::default_instance_->InitAsDefaultInstance();
   ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestAllExtensionsLite::default_instance(),
+    ::protobuf_unittest::TestAllExtensionsLite::internal_default_instance(),
     12345, 5, false, false);
   TestDeprecatedLite::default_instance_->InitAsDefaultInstance();
   ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_google_2fprotobuf_2funittest_5flite_2eproto);
 }
 
+namespace {
+
+GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_InitDefaults_once_);
+// Set once the defaults are built, so that default_instance() and the
+// other callers on hot paths can skip the once.
+::google::protobuf::internal::Atomic32 protobuf_InitDefaults_done_ = 0;
+
+}  // namespace
+
+void protobuf_InitDefaults_google_2fprotobuf_2funittest_5flite_2eproto() {
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) != 0) {
+    return;
+  }
+  ::google::protobuf::GoogleOnceInit(&protobuf_InitDefaults_once_,
+                 &protobuf_InitDefaults_google_2fprotobuf_2funittest_5flite_2eproto_impl);
+  ::google::protobuf::internal::Release_Store(
+      &protobuf_InitDefaults_done_, 1);
+}
+
+void protobuf_AddDesc_google_2fprotobuf_2funittest_5flite_2eproto() {
+  static bool already_here = false;
+  if (already_here) return;
+  already_here = true;
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  ::protobuf_unittest_import::protobuf_AddDesc_google_2fprotobuf_2funittest_5fimport_5flite_2eproto();
+  ::google::protobuf::internal::ExtensionSet::RegisterDeferredExtensions(
+    &protobuf_InitDefaults_google_2fprotobuf_2funittest_5flite_2eproto);
+}
+
 // Force AddDescriptors() to be called at static initialization time.
 struct StaticDescriptorInitializer_google_2fprotobuf_2funittest_5flite_2eproto {
   StaticDescriptorInitializer_google_2fprotobuf_2funittest_5flite_2eproto() {
@@ -399,12 +425,14 @@ void TestAllTypesLite_NestedMessage::SharedDtor() {
 }
 
 void TestAllTypesLite_NestedMessage::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const TestAllTypesLite_NestedMessage& TestAllTypesLite_NestedMessage::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_5flite_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5flite_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestAllTypesLite_NestedMessage* TestAllTypesLite_NestedMessage::default_instance_ = NULL;
@@ -477,9 +505,8 @@ int TestAllTypesLite_NestedMessage::ByteSize() const {
     }
     
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -557,12 +584,14 @@ void TestAllTypesLite_OptionalGroup::SharedDtor() {
 }
 
 void TestAllTypesLite_OptionalGroup::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const TestAllTypesLite_OptionalGroup& TestAllTypesLite_OptionalGroup::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_5flite_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5flite_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestAllTypesLite_OptionalGroup* TestAllTypesLite_OptionalGroup::default_instance_ = NULL;
@@ -635,9 +664,8 @@ int TestAllTypesLite_OptionalGroup::ByteSize() const {
     }
     
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -715,12 +743,14 @@ void TestAllTypesLite_RepeatedGroup::SharedDtor() {
 }
 
 void TestAllTypesLite_RepeatedGroup::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const TestAllTypesLite_RepeatedGroup& TestAllTypesLite_RepeatedGroup::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_5flite_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5flite_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestAllTypesLite_RepeatedGroup* TestAllTypesLite_RepeatedGroup::default_instance_ = NULL;
@@ -793,9 +823,8 @@ int TestAllTypesLite_RepeatedGroup::ByteSize() const {
     }
     
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -841,11 +870,9 @@ void TestAllTypesLite_RepeatedGroup::Swap(TestAllTypesLite_RepeatedGroup* other)
 
 const ::std::string TestAllTypesLite::_default_optional_string_;
 const ::std::string TestAllTypesLite::_default_optional_bytes_;
-const ::std::string TestAllTypesLite::_default_optional_string_piece_;
 const ::std::string TestAllTypesLite::_default_optional_cord_;
 const ::std::string TestAllTypesLite::_default_default_string_("hello");
 const ::std::string TestAllTypesLite::_default_default_bytes_("world");
-const ::std::string TestAllTypesLite::_default_default_string_piece_("abc");
 const ::std::string TestAllTypesLite::_default_default_cord_("123");
 #ifndef _MSC_VER
 const int TestAllTypesLite::kOptionalInt32FieldNumber;
@@ -924,10 +951,14 @@ TestAllTypesLite::TestAllTypesLite()
 }
 
 void TestAllTypesLite::InitAsDefaultInstance() {
-  optionalgroup_ = const_cast< ::protobuf_unittest::TestAllTypesLite_OptionalGroup*>(&::protobuf_unittest::TestAllTypesLite_OptionalGroup::default_instance());
-  optional_nested_message_ = const_cast< ::protobuf_unittest::TestAllTypesLite_NestedMessage*>(&::protobuf_unittest::TestAllTypesLite_NestedMessage::default_instance());
-  optional_foreign_message_ = const_cast< ::protobuf_unittest::ForeignMessageLite*>(&::protobuf_unittest::ForeignMessageLite::default_instance());
-  optional_import_message_ = const_cast< ::protobuf_unittest_import::ImportMessageLite*>(&::protobuf_unittest_import::ImportMessageLite::default_instance());
+  optionalgroup_ = const_cast< ::protobuf_unittest::TestAllTypesLite_OptionalGroup*>(
+      ::protobuf_unittest::TestAllTypesLite_OptionalGroup::internal_default_instance());
+  optional_nested_message_ = const_cast< ::protobuf_unittest::TestAllTypesLite_NestedMessage*>(
+      ::protobuf_unittest::TestAllTypesLite_NestedMessage::internal_default_instance());
+  optional_foreign_message_ = const_cast< ::protobuf_unittest::ForeignMessageLite*>(
+      ::protobuf_unittest::ForeignMessageLite::internal_default_instance());
+  optional_import_message_ = const_cast< ::protobuf_unittest_import::ImportMessageLite*>(
+      ::protobuf_unittest_import::ImportMessageLite::internal_default_instance());
 }
 
 TestAllTypesLite::TestAllTypesLite(const TestAllTypesLite& from)
@@ -960,7 +991,6 @@ void TestAllTypesLite::SharedCtor() {
   optional_nested_enum_ = 1;
   optional_foreign_enum_ = 4;
   optional_import_enum_ = 7;
-  optional_string_piece_ = const_cast< ::std::string*>(&_default_optional_string_piece_);
   optional_cord_ = const_cast< ::std::string*>(&_default_optional_cord_);
   default_int32_ = 41;
   default_int64_ = GOOGLE_LONGLONG(42);
@@ -980,7 +1010,7 @@ void TestAllTypesLite::SharedCtor() {
   default_nested_enum_ = 2;
   default_foreign_enum_ = 5;
   default_import_enum_ = 8;
-  default_string_piece_ = const_cast< ::std::string*>(&_default_default_string_piece_);
+  default_string_piece_.SetAliased("abc", 3);
   default_cord_ = const_cast< ::std::string*>(&_default_default_cord_);
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
@@ -996,9 +1026,6 @@ void TestAllTypesLite::SharedDtor() {
   if (optional_bytes_ != &_default_optional_bytes_) {
     delete optional_bytes_;
   }
-  if (optional_string_piece_ != &_default_optional_string_piece_) {
-    delete optional_string_piece_;
-  }
   if (optional_cord_ != &_default_optional_cord_) {
     delete optional_cord_;
   }
@@ -1008,9 +1035,6 @@ void TestAllTypesLite::SharedDtor() {
   if (default_bytes_ != &_default_default_bytes_) {
     delete default_bytes_;
   }
-  if (default_string_piece_ != &_default_default_string_piece_) {
-    delete default_string_piece_;
-  }
   if (default_cord_ != &_default_default_cord_) {
     delete default_cord_;
   }
@@ -1023,12 +1047,14 @@ void TestAllTypesLite::SharedDtor() {
 }
 
 void TestAllTypesLite::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const TestAllTypesLite& TestAllTypesLite::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_5flite_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5flite_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestAllTypesLite* TestAllTypesLite::default_instance_ = NULL;
@@ -1082,9 +1108,7 @@ void TestAllTypesLite::Clear() {
     optional_foreign_enum_ = 4;
     optional_import_enum_ = 7;
     if (_has_bit(22)) {
-      if (optional_string_piece_ != &_default_optional_string_piece_) {
-        optional_string_piece_->clear();
-      }
+      optional_string_piece_.Clear();
     }
     if (_has_bit(23)) {
       if (optional_cord_ != &_default_optional_cord_) {
@@ -1124,9 +1148,7 @@ void TestAllTypesLite::Clear() {
     default_foreign_enum_ = 5;
     default_import_enum_ = 8;
     if (_has_bit(66)) {
-      if (default_string_piece_ != &_default_default_string_piece_) {
-        default_string_piece_->assign(_default_default_string_piece_);
-      }
+      default_string_piece_.SetAliased("abc", 3);
     }
     if (_has_bit(67)) {
       if (default_cord_ != &_default_default_cord_) {
@@ -1520,8 +1542,9 @@ bool TestAllTypesLite::MergePartialFromCodedStream(
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
             ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
          parse_optional_string_piece:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_optional_string_piece()));
+          _set_bit(22);
+          DO_(::google::protobuf::internal::WireFormatLite::ReadStringPiece(
+                input, &optional_string_piece_));
         } else {
           goto handle_uninterpreted;
         }
@@ -2005,8 +2028,8 @@ bool TestAllTypesLite::MergePartialFromCodedStream(
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
             ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
          parse_repeated_string_piece:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->add_repeated_string_piece()));
+          DO_(::google::protobuf::internal::WireFormatLite::ReadStringPiece(
+                input, repeated_string_piece_.Add()));
         } else {
           goto handle_uninterpreted;
         }
@@ -2328,8 +2351,9 @@ bool TestAllTypesLite::MergePartialFromCodedStream(
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
             ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
          parse_default_string_piece:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_default_string_piece()));
+          _set_bit(66);
+          DO_(::google::protobuf::internal::WireFormatLite::ReadStringPiece(
+                input, &default_string_piece_));
         } else {
           goto handle_uninterpreted;
         }
@@ -2489,7 +2513,7 @@ void TestAllTypesLite::SerializeWithCachedSizes(
   
   // optional string optional_string_piece = 24 [ctype = STRING_PIECE];
   if (_has_bit(22)) {
-    ::google::protobuf::internal::WireFormatLite::WriteString(
+    ::google::protobuf::internal::WireFormatLite::WriteStringPiece(
       24, this->optional_string_piece(), output);
   }
   
@@ -2633,7 +2657,7 @@ void TestAllTypesLite::SerializeWithCachedSizes(
   
   // repeated string repeated_string_piece = 54 [ctype = STRING_PIECE];
   for (int i = 0; i < this->repeated_string_piece_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteString(
+    ::google::protobuf::internal::WireFormatLite::WriteStringPiece(
       54, this->repeated_string_piece(i), output);
   }
   
@@ -2740,7 +2764,7 @@ void TestAllTypesLite::SerializeWithCachedSizes(
   
   // optional string default_string_piece = 84 [default = "abc", ctype = STRING_PIECE];
   if (_has_bit(66)) {
-    ::google::protobuf::internal::WireFormatLite::WriteString(
+    ::google::protobuf::internal::WireFormatLite::WriteStringPiece(
       84, this->default_string_piece(), output);
   }
   
@@ -2900,7 +2924,7 @@ int TestAllTypesLite::ByteSize() const {
     // optional string optional_string_piece = 24 [ctype = STRING_PIECE];
     if (has_optional_string_piece()) {
       total_size += 2 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
+        ::google::protobuf::internal::WireFormatLite::StringPieceSize(
           this->optional_string_piece());
     }
     
@@ -3029,7 +3053,7 @@ int TestAllTypesLite::ByteSize() const {
     // optional string default_string_piece = 84 [default = "abc", ctype = STRING_PIECE];
     if (has_default_string_piece()) {
       total_size += 2 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
+        ::google::protobuf::internal::WireFormatLite::StringPieceSize(
           this->default_string_piece());
     }
     
@@ -3229,7 +3253,7 @@ int TestAllTypesLite::ByteSize() const {
   // repeated string repeated_string_piece = 54 [ctype = STRING_PIECE];
   total_size += 2 * this->repeated_string_piece_size();
   for (int i = 0; i < this->repeated_string_piece_size(); i++) {
-    total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
+    total_size += ::google::protobuf::internal::WireFormatLite::StringPieceSize(
       this->repeated_string_piece(i));
   }
   
@@ -3240,9 +3264,8 @@ int TestAllTypesLite::ByteSize() const {
       this->repeated_cord(i));
   }
   
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -3349,7 +3372,7 @@ void TestAllTypesLite::MergeFrom(const TestAllTypesLite& from) {
       set_optional_import_enum(from.optional_import_enum());
     }
     if (from._has_bit(22)) {
-      set_optional_string_piece(from.optional_string_piece());
+      set_optional_string_piece(from.optional_string_piece().data(), from.optional_string_piece().size());
     }
     if (from._has_bit(23)) {
       set_optional_cord(from.optional_cord());
@@ -3415,7 +3438,7 @@ void TestAllTypesLite::MergeFrom(const TestAllTypesLite& from) {
       set_default_import_enum(from.default_import_enum());
     }
     if (from._has_bit(66)) {
-      set_default_string_piece(from.default_string_piece());
+      set_default_string_piece(from.default_string_piece().data(), from.default_string_piece().size());
     }
     if (from._has_bit(67)) {
       set_default_cord(from.default_cord());
@@ -3458,7 +3481,7 @@ void TestAllTypesLite::Swap(TestAllTypesLite* other) {
     std::swap(optional_nested_enum_, other->optional_nested_enum_);
     std::swap(optional_foreign_enum_, other->optional_foreign_enum_);
     std::swap(optional_import_enum_, other->optional_import_enum_);
-    std::swap(optional_string_piece_, other->optional_string_piece_);
+    optional_string_piece_.Swap(&other->optional_string_piece_);
     std::swap(optional_cord_, other->optional_cord_);
     repeated_int32_.Swap(&other->repeated_int32_);
     repeated_int64_.Swap(&other->repeated_int64_);
@@ -3502,7 +3525,7 @@ void TestAllTypesLite::Swap(TestAllTypesLite* other) {
     std::swap(default_nested_enum_, other->default_nested_enum_);
     std::swap(default_foreign_enum_, other->default_foreign_enum_);
     std::swap(default_import_enum_, other->default_import_enum_);
-    std::swap(default_string_piece_, other->default_string_piece_);
+    default_string_piece_.Swap(&other->default_string_piece_);
     std::swap(default_cord_, other->default_cord_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     std::swap(_has_bits_[1], other->_has_bits_[1]);
@@ -3552,12 +3575,14 @@ void ForeignMessageLite::SharedDtor() {
 }
 
 void ForeignMessageLite::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ForeignMessageLite& ForeignMessageLite::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_5flite_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5flite_2eproto();
+  }
+  return *default_instance_;
 }
 
 ForeignMessageLite* ForeignMessageLite::default_instance_ = NULL;
@@ -3630,9 +3655,8 @@ int ForeignMessageLite::ByteSize() const {
     }
     
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -3722,12 +3746,14 @@ void TestPackedTypesLite::SharedDtor() {
 }
 
 void TestPackedTypesLite::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const TestPackedTypesLite& TestPackedTypesLite::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_5flite_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5flite_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestPackedTypesLite* TestPackedTypesLite::default_instance_ = NULL;
@@ -4087,7 +4113,8 @@ void TestPackedTypesLite::SerializeWithCachedSizes(
   // repeated int32 packed_int32 = 90 [packed = true];
   if (this->packed_int32_size() > 0) {
     ::google::protobuf::internal::WireFormatLite::WriteTag(90, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
-    output->WriteVarint32(_packed_int32_cached_byte_size_);
+    output->WriteVarint32(
+        ::google::protobuf::internal::NoBarrier_Load(&_packed_int32_cached_byte_size_));
   }
   for (int i = 0; i < this->packed_int32_size(); i++) {
     ::google::protobuf::internal::WireFormatLite::WriteInt32NoTag(
@@ -4097,7 +4124,8 @@ void TestPackedTypesLite::SerializeWithCachedSizes(
   // repeated int64 packed_int64 = 91 [packed = true];
   if (this->packed_int64_size() > 0) {
     ::google::protobuf::internal::WireFormatLite::WriteTag(91, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
-    output->WriteVarint32(_packed_int64_cached_byte_size_);
+    output->WriteVarint32(
+        ::google::protobuf::internal::NoBarrier_Load(&_packed_int64_cached_byte_size_));
   }
   for (int i = 0; i < this->packed_int64_size(); i++) {
     ::google::protobuf::internal::WireFormatLite::WriteInt64NoTag(
@@ -4107,7 +4135,8 @@ void TestPackedTypesLite::SerializeWithCachedSizes(
   // repeated uint32 packed_uint32 = 92 [packed = true];
   if (this->packed_uint32_size() > 0) {
     ::google::protobuf::internal::WireFormatLite::WriteTag(92, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
-    output->WriteVarint32(_packed_uint32_cached_byte_size_);
+    output->WriteVarint32(
+        ::google::protobuf::internal::NoBarrier_Load(&_packed_uint32_cached_byte_size_));
   }
   for (int i = 0; i < this->packed_uint32_size(); i++) {
     ::google::protobuf::internal::WireFormatLite::WriteUInt32NoTag(
@@ -4117,7 +4146,8 @@ void TestPackedTypesLite::SerializeWithCachedSizes(
   // repeated uint64 packed_uint64 = 93 [packed = true];
   if (this->packed_uint64_size() > 0) {
     ::google::protobuf::internal::WireFormatLite::WriteTag(93, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
-    output->WriteVarint32(_packed_uint64_cached_byte_size_);
+    output->WriteVarint32(
+        ::google::protobuf::internal::NoBarrier_Load(&_packed_uint64_cached_byte_size_));
   }
   for (int i = 0; i < this->packed_uint64_size(); i++) {
     ::google::protobuf::internal::WireFormatLite::WriteUInt64NoTag(
@@ -4127,7 +4157,8 @@ void TestPackedTypesLite::SerializeWithCachedSizes(
   // repeated sint32 packed_sint32 = 94 [packed = true];
   if (this->packed_sint32_size() > 0) {
     ::google::protobuf::internal::WireFormatLite::WriteTag(94, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
-    output->WriteVarint32(_packed_sint32_cached_byte_size_);
+    output->WriteVarint32(
+        ::google::protobuf::internal::NoBarrier_Load(&_packed_sint32_cached_byte_size_));
   }
   for (int i = 0; i < this->packed_sint32_size(); i++) {
     ::google::protobuf::internal::WireFormatLite::WriteSInt32NoTag(
@@ -4137,7 +4168,8 @@ void TestPackedTypesLite::SerializeWithCachedSizes(
   // repeated sint64 packed_sint64 = 95 [packed = true];
   if (this->packed_sint64_size() > 0) {
     ::google::protobuf::internal::WireFormatLite::WriteTag(95, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
-    output->WriteVarint32(_packed_sint64_cached_byte_size_);
+    output->WriteVarint32(
+        ::google::protobuf::internal::NoBarrier_Load(&_packed_sint64_cached_byte_size_));
   }
   for (int i = 0; i < this->packed_sint64_size(); i++) {
     ::google::protobuf::internal::WireFormatLite::WriteSInt64NoTag(
@@ -4147,7 +4179,8 @@ void TestPackedTypesLite::SerializeWithCachedSizes(
   // repeated fixed32 packed_fixed32 = 96 [packed = true];
   if (this->packed_fixed32_size() > 0) {
     ::google::protobuf::internal::WireFormatLite::WriteTag(96, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
-    output->WriteVarint32(_packed_fixed32_cached_byte_size_);
+    output->WriteVarint32(
+        ::google::protobuf::internal::NoBarrier_Load(&_packed_fixed32_cached_byte_size_));
   }
   for (int i = 0; i < this->packed_fixed32_size(); i++) {
     ::google::protobuf::internal::WireFormatLite::WriteFixed32NoTag(
@@ -4157,7 +4190,8 @@ void TestPackedTypesLite::SerializeWithCachedSizes(
   // repeated fixed64 packed_fixed64 = 97 [packed = true];
   if (this->packed_fixed64_size() > 0) {
     ::google::protobuf::internal::WireFormatLite::WriteTag(97, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
-    output->WriteVarint32(_packed_fixed64_cached_byte_size_);
+    output->WriteVarint32(
+        ::google::protobuf::internal::NoBarrier_Load(&_packed_fixed64_cached_byte_size_));
   }
   for (int i = 0; i < this->packed_fixed64_size(); i++) {
     ::google::protobuf::internal::WireFormatLite::WriteFixed64NoTag(
@@ -4167,7 +4201,8 @@ void TestPackedTypesLite::SerializeWithCachedSizes(
   // repeated sfixed32 packed_sfixed32 = 98 [packed = true];
   if (this->packed_sfixed32_size() > 0) {
     ::google::protobuf::internal::WireFormatLite::WriteTag(98, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
-    output->WriteVarint32(_packed_sfixed32_cached_byte_size_);
+    output->WriteVarint32(
+        ::google::protobuf::internal::NoBarrier_Load(&_packed_sfixed32_cached_byte_size_));
   }
   for (int i = 0; i < this->packed_sfixed32_size(); i++) {
     ::google::protobuf::internal::WireFormatLite::WriteSFixed32NoTag(
@@ -4177,7 +4212,8 @@ void TestPackedTypesLite::SerializeWithCachedSizes(
   // repeated sfixed64 packed_sfixed64 = 99 [packed = true];
   if (this->packed_sfixed64_size() > 0) {
     ::google::protobuf::internal::WireFormatLite::WriteTag(99, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
-    output->WriteVarint32(_packed_sfixed64_cached_byte_size_);
+    output->WriteVarint32(
+        ::google::protobuf::internal::NoBarrier_Load(&_packed_sfixed64_cached_byte_size_));
   }
   for (int i = 0; i < this->packed_sfixed64_size(); i++) {
     ::google::protobuf::internal::WireFormatLite::WriteSFixed64NoTag(
@@ -4187,7 +4223,8 @@ void TestPackedTypesLite::SerializeWithCachedSizes(
   // repeated float packed_float = 100 [packed = true];
   if (this->packed_float_size() > 0) {
     ::google::protobuf::internal::WireFormatLite::WriteTag(100, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
-    output->WriteVarint32(_packed_float_cached_byte_size_);
+    output->WriteVarint32(
+        ::google::protobuf::internal::NoBarrier_Load(&_packed_float_cached_byte_size_));
   }
   for (int i = 0; i < this->packed_float_size(); i++) {
     ::google::protobuf::internal::WireFormatLite::WriteFloatNoTag(
@@ -4197,7 +4234,8 @@ void TestPackedTypesLite::SerializeWithCachedSizes(
   // repeated double packed_double = 101 [packed = true];
   if (this->packed_double_size() > 0) {
     ::google::protobuf::internal::WireFormatLite::WriteTag(101, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
-    output->WriteVarint32(_packed_double_cached_byte_size_);
+    output->WriteVarint32(
+        ::google::protobuf::internal::NoBarrier_Load(&_packed_double_cached_byte_size_));
   }
   for (int i = 0; i < this->packed_double_size(); i++) {
     ::google::protobuf::internal::WireFormatLite::WriteDoubleNoTag(
@@ -4207,7 +4245,8 @@ void TestPackedTypesLite::SerializeWithCachedSizes(
   // repeated bool packed_bool = 102 [packed = true];
   if (this->packed_bool_size() > 0) {
     ::google::protobuf::internal::WireFormatLite::WriteTag(102, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
-    output->WriteVarint32(_packed_bool_cached_byte_size_);
+    output->WriteVarint32(
+        ::google::protobuf::internal::NoBarrier_Load(&_packed_bool_cached_byte_size_));
   }
   for (int i = 0; i < this->packed_bool_size(); i++) {
     ::google::protobuf::internal::WireFormatLite::WriteBoolNoTag(
@@ -4220,7 +4259,8 @@ void TestPackedTypesLite::SerializeWithCachedSizes(
       103,
       ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
       output);
-    output->WriteVarint32(_packed_enum_cached_byte_size_);
+    output->WriteVarint32(
+        ::google::protobuf::internal::NoBarrier_Load(&_packed_enum_cached_byte_size_));
   }
   for (int i = 0; i < this->packed_enum_size(); i++) {
     ::google::protobuf::internal::WireFormatLite::WriteEnumNoTag(
@@ -4243,7 +4283,8 @@ int TestPackedTypesLite::ByteSize() const {
       total_size += 2 +
         ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
     }
-    _packed_int32_cached_byte_size_ = data_size;
+    ::google::protobuf::internal::NoBarrier_Store(
+        &_packed_int32_cached_byte_size_, data_size);
     total_size += data_size;
   }
   
@@ -4258,7 +4299,8 @@ int TestPackedTypesLite::ByteSize() const {
       total_size += 2 +
         ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
     }
-    _packed_int64_cached_byte_size_ = data_size;
+    ::google::protobuf::internal::NoBarrier_Store(
+        &_packed_int64_cached_byte_size_, data_size);
     total_size += data_size;
   }
   
@@ -4273,7 +4315,8 @@ int TestPackedTypesLite::ByteSize() const {
       total_size += 2 +
         ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
     }
-    _packed_uint32_cached_byte_size_ = data_size;
+    ::google::protobuf::internal::NoBarrier_Store(
+        &_packed_uint32_cached_byte_size_, data_size);
     total_size += data_size;
   }
   
@@ -4288,7 +4331,8 @@ int TestPackedTypesLite::ByteSize() const {
       total_size += 2 +
         ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
     }
-    _packed_uint64_cached_byte_size_ = data_size;
+    ::google::protobuf::internal::NoBarrier_Store(
+        &_packed_uint64_cached_byte_size_, data_size);
     total_size += data_size;
   }
   
@@ -4303,7 +4347,8 @@ int TestPackedTypesLite::ByteSize() const {
       total_size += 2 +
         ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
     }
-    _packed_sint32_cached_byte_size_ = data_size;
+    ::google::protobuf::internal::NoBarrier_Store(
+        &_packed_sint32_cached_byte_size_, data_size);
     total_size += data_size;
   }
   
@@ -4318,7 +4363,8 @@ int TestPackedTypesLite::ByteSize() const {
       total_size += 2 +
         ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
     }
-    _packed_sint64_cached_byte_size_ = data_size;
+    ::google::protobuf::internal::NoBarrier_Store(
+        &_packed_sint64_cached_byte_size_, data_size);
     total_size += data_size;
   }
   
@@ -4330,7 +4376,8 @@ int TestPackedTypesLite::ByteSize() const {
       total_size += 2 +
         ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
     }
-    _packed_fixed32_cached_byte_size_ = data_size;
+    ::google::protobuf::internal::NoBarrier_Store(
+        &_packed_fixed32_cached_byte_size_, data_size);
     total_size += data_size;
   }
   
@@ -4342,7 +4389,8 @@ int TestPackedTypesLite::ByteSize() const {
       total_size += 2 +
         ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
     }
-    _packed_fixed64_cached_byte_size_ = data_size;
+    ::google::protobuf::internal::NoBarrier_Store(
+        &_packed_fixed64_cached_byte_size_, data_size);
     total_size += data_size;
   }
   
@@ -4354,7 +4402,8 @@ int TestPackedTypesLite::ByteSize() const {
       total_size += 2 +
         ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
     }
-    _packed_sfixed32_cached_byte_size_ = data_size;
+    ::google::protobuf::internal::NoBarrier_Store(
+        &_packed_sfixed32_cached_byte_size_, data_size);
     total_size += data_size;
   }
   
@@ -4366,7 +4415,8 @@ int TestPackedTypesLite::ByteSize() const {
       total_size += 2 +
         ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
     }
-    _packed_sfixed64_cached_byte_size_ = data_size;
+    ::google::protobuf::internal::NoBarrier_Store(
+        &_packed_sfixed64_cached_byte_size_, data_size);
     total_size += data_size;
   }
   
@@ -4378,7 +4428,8 @@ int TestPackedTypesLite::ByteSize() const {
       total_size += 2 +
         ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
     }
-    _packed_float_cached_byte_size_ = data_size;
+    ::google::protobuf::internal::NoBarrier_Store(
+        &_packed_float_cached_byte_size_, data_size);
     total_size += data_size;
   }
   
@@ -4390,7 +4441,8 @@ int TestPackedTypesLite::ByteSize() const {
       total_size += 2 +
         ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
     }
-    _packed_double_cached_byte_size_ = data_size;
+    ::google::protobuf::internal::NoBarrier_Store(
+        &_packed_double_cached_byte_size_, data_size);
     total_size += data_size;
   }
   
@@ -4402,7 +4454,8 @@ int TestPackedTypesLite::ByteSize() const {
       total_size += 2 +
         ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
     }
-    _packed_bool_cached_byte_size_ = data_size;
+    ::google::protobuf::internal::NoBarrier_Store(
+        &_packed_bool_cached_byte_size_, data_size);
     total_size += data_size;
   }
   
@@ -4417,13 +4470,13 @@ int TestPackedTypesLite::ByteSize() const {
       total_size += 2 +
         ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
     }
-    _packed_enum_cached_byte_size_ = data_size;
+    ::google::protobuf::internal::NoBarrier_Store(
+        &_packed_enum_cached_byte_size_, data_size);
     total_size += data_size;
   }
   
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -4521,12 +4574,14 @@ void TestAllExtensionsLite::SharedDtor() {
 }
 
 void TestAllExtensionsLite::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const TestAllExtensionsLite& TestAllExtensionsLite::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_5flite_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5flite_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestAllExtensionsLite* TestAllExtensionsLite::default_instance_ = NULL;
@@ -4550,7 +4605,7 @@ bool TestAllExtensionsLite::MergePartialFromCodedStream(
       return true;
     }
     if ((8u <= tag)) {
-      DO_(_extensions_.ParseField(tag, input, default_instance_));
+      DO_(_extensions_.ParseField(tag, input, &default_instance()));
       continue;
     }
     DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
@@ -4572,9 +4627,8 @@ int TestAllExtensionsLite::ByteSize() const {
   
   total_size += _extensions_.ByteSize();
   
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -4648,12 +4702,14 @@ void OptionalGroup_extension_lite::SharedDtor() {
 }
 
 void OptionalGroup_extension_lite::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const OptionalGroup_extension_lite& OptionalGroup_extension_lite::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_5flite_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5flite_2eproto();
+  }
+  return *default_instance_;
 }
 
 OptionalGroup_extension_lite* OptionalGroup_extension_lite::default_instance_ = NULL;
@@ -4726,9 +4782,8 @@ int OptionalGroup_extension_lite::ByteSize() const {
     }
     
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -4806,12 +4861,14 @@ void RepeatedGroup_extension_lite::SharedDtor() {
 }
 
 void RepeatedGroup_extension_lite::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const RepeatedGroup_extension_lite& RepeatedGroup_extension_lite::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_5flite_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5flite_2eproto();
+  }
+  return *default_instance_;
 }
 
 RepeatedGroup_extension_lite* RepeatedGroup_extension_lite::default_instance_ = NULL;
@@ -4884,9 +4941,8 @@ int RepeatedGroup_extension_lite::ByteSize() const {
     }
     
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -4962,12 +5018,14 @@ void TestPackedExtensionsLite::SharedDtor() {
 }
 
 void TestPackedExtensionsLite::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const TestPackedExtensionsLite& TestPackedExtensionsLite::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_5flite_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5flite_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestPackedExtensionsLite* TestPackedExtensionsLite::default_instance_ = NULL;
@@ -4991,7 +5049,7 @@ bool TestPackedExtensionsLite::MergePartialFromCodedStream(
       return true;
     }
     if ((8u <= tag)) {
-      DO_(_extensions_.ParseField(tag, input, default_instance_));
+      DO_(_extensions_.ParseField(tag, input, &default_instance()));
       continue;
     }
     DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
@@ -5013,9 +5071,8 @@ int TestPackedExtensionsLite::ByteSize() const {
   
   total_size += _extensions_.ByteSize();
   
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -5093,12 +5150,14 @@ void TestNestedExtensionLite::SharedDtor() {
 }
 
 void TestNestedExtensionLite::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const TestNestedExtensionLite& TestNestedExtensionLite::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_5flite_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5flite_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestNestedExtensionLite* TestNestedExtensionLite::default_instance_ = NULL;
@@ -5133,9 +5192,8 @@ void TestNestedExtensionLite::SerializeWithCachedSizes(
 int TestNestedExtensionLite::ByteSize() const {
   int total_size = 0;
   
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -5206,12 +5264,14 @@ void TestDeprecatedLite::SharedDtor() {
 }
 
 void TestDeprecatedLite::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const TestDeprecatedLite& TestDeprecatedLite::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_5flite_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5flite_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestDeprecatedLite* TestDeprecatedLite::default_instance_ = NULL;
@@ -5284,9 +5344,8 @@ int TestDeprecatedLite::ByteSize() const {
     }
     
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -5376,16 +5435,16 @@ const ::std::string optional_bytes_extension_lite_default("");
   optional_bytes_extension_lite(kOptionalBytesExtensionLiteFieldNumber, optional_bytes_extension_lite_default);
 ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
     ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::OptionalGroup_extension_lite >, 10, false >
-  optionalgroup_extension_lite(kOptionalgroupExtensionLiteFieldNumber, ::protobuf_unittest::OptionalGroup_extension_lite::default_instance());
+  optionalgroup_extension_lite(kOptionalgroupExtensionLiteFieldNumber);
 ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
     ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::TestAllTypesLite_NestedMessage >, 11, false >
-  optional_nested_message_extension_lite(kOptionalNestedMessageExtensionLiteFieldNumber, ::protobuf_unittest::TestAllTypesLite_NestedMessage::default_instance());
+  optional_nested_message_extension_lite(kOptionalNestedMessageExtensionLiteFieldNumber);
 ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
     ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::ForeignMessageLite >, 11, false >
-  optional_foreign_message_extension_lite(kOptionalForeignMessageExtensionLiteFieldNumber, ::protobuf_unittest::ForeignMessageLite::default_instance());
+  optional_foreign_message_extension_lite(kOptionalForeignMessageExtensionLiteFieldNumber);
 ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
     ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest_import::ImportMessageLite >, 11, false >
-  optional_import_message_extension_lite(kOptionalImportMessageExtensionLiteFieldNumber, ::protobuf_unittest_import::ImportMessageLite::default_instance());
+  optional_import_message_extension_lite(kOptionalImportMessageExtensionLiteFieldNumber);
 ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
     ::google::protobuf::internal::EnumTypeTraits< ::protobuf_unittest::TestAllTypesLite_NestedEnum, ::protobuf_unittest::TestAllTypesLite_NestedEnum_IsValid>, 14, false >
   optional_nested_enum_extension_lite(kOptionalNestedEnumExtensionLiteFieldNumber, static_cast< ::protobuf_unittest::TestAllTypesLite_NestedEnum >(1));
@@ -5452,16 +5511,16 @@ const ::std::string repeated_bytes_extension_lite_default("");
   repeated_bytes_extension_lite(kRepeatedBytesExtensionLiteFieldNumber, repeated_bytes_extension_lite_default);
 ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
     ::google::protobuf::internal::RepeatedMessageTypeTraits< ::protobuf_unittest::RepeatedGroup_extension_lite >, 10, false >
-  repeatedgroup_extension_lite(kRepeatedgroupExtensionLiteFieldNumber, ::protobuf_unittest::RepeatedGroup_extension_lite::default_instance());
+  repeatedgroup_extension_lite(kRepeatedgroupExtensionLiteFieldNumber);
 ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
     ::google::protobuf::internal::RepeatedMessageTypeTraits< ::protobuf_unittest::TestAllTypesLite_NestedMessage >, 11, false >
-  repeated_nested_message_extension_lite(kRepeatedNestedMessageExtensionLiteFieldNumber, ::protobuf_unittest::TestAllTypesLite_NestedMessage::default_instance());
+  repeated_nested_message_extension_lite(kRepeatedNestedMessageExtensionLiteFieldNumber);
 ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
     ::google::protobuf::internal::RepeatedMessageTypeTraits< ::protobuf_unittest::ForeignMessageLite >, 11, false >
-  repeated_foreign_message_extension_lite(kRepeatedForeignMessageExtensionLiteFieldNumber, ::protobuf_unittest::ForeignMessageLite::default_instance());
+  repeated_foreign_message_extension_lite(kRepeatedForeignMessageExtensionLiteFieldNumber);
 ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
     ::google::protobuf::internal::RepeatedMessageTypeTraits< ::protobuf_unittest_import::ImportMessageLite >, 11, false >
-  repeated_import_message_extension_lite(kRepeatedImportMessageExtensionLiteFieldNumber, ::protobuf_unittest_import::ImportMessageLite::default_instance());
+  repeated_import_message_extension_lite(kRepeatedImportMessageExtensionLiteFieldNumber);
 ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
     ::google::protobuf::internal::RepeatedEnumTypeTraits< ::protobuf_unittest::TestAllTypesLite_NestedEnum, ::protobuf_unittest::TestAllTypesLite_NestedEnum_IsValid>, 14, false >
   repeated_nested_enum_extension_lite(kRepeatedNestedEnumExtensionLiteFieldNumber, static_cast< ::protobuf_unittest::TestAllTypesLite_NestedEnum >(1));
@@ -22,6 +22,7 @@
 #include <google/protobuf/generated_message_util.h>
 #include <google/protobuf/repeated_field.h>
 #include <google/protobuf/extension_set.h>
+#include <google/protobuf/string_piece_field.h>
 #include "google/protobuf/unittest_import_lite.pb.h"
 // @@protoc_insertion_point(includes)
 
@@ -29,6 +30,8 @@ namespace protobuf_unittest {
 
 // Internal implementation detail -- do not call these.
 void  protobuf_AddDesc_google_2fprotobuf_2funittest_5flite_2eproto();
+void  protobuf_InitDefaults_google_2fprotobuf_2funittest_5flite_2eproto();
+void protobuf_InitDefaults_google_2fprotobuf_2funittest_5flite_2eproto_impl();
 void protobuf_AssignDesc_google_2fprotobuf_2funittest_5flite_2eproto();
 void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5flite_2eproto();
 
@@ -81,6 +84,12 @@ class TestAllTypesLite_NestedMessage : public ::google::protobuf::MessageLite {
   
   static const TestAllTypesLite_NestedMessage& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestAllTypesLite_NestedMessage* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestAllTypesLite_NestedMessage* other);
   
   // implements Message ----------------------------------------------
@@ -97,7 +106,9 @@ class TestAllTypesLite_NestedMessage : public ::google::protobuf::MessageLite {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -119,10 +130,10 @@ class TestAllTypesLite_NestedMessage : public ::google::protobuf::MessageLite {
   
   // @@protoc_insertion_point(class_scope:protobuf_unittest.TestAllTypesLite.NestedMessage)
  private:
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::google::protobuf::int32 bb_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_5flite_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5flite_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5flite_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5flite_2eproto();
   
@@ -158,6 +169,12 @@ class TestAllTypesLite_OptionalGroup : public ::google::protobuf::MessageLite {
   
   static const TestAllTypesLite_OptionalGroup& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestAllTypesLite_OptionalGroup* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestAllTypesLite_OptionalGroup* other);
   
   // implements Message ----------------------------------------------
@@ -174,7 +191,9 @@ class TestAllTypesLite_OptionalGroup : public ::google::protobuf::MessageLite {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -196,10 +215,10 @@ class TestAllTypesLite_OptionalGroup : public ::google::protobuf::MessageLite {
   
   // @@protoc_insertion_point(class_scope:protobuf_unittest.TestAllTypesLite.OptionalGroup)
  private:
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::google::protobuf::int32 a_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_5flite_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5flite_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5flite_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5flite_2eproto();
   
@@ -235,6 +254,12 @@ class TestAllTypesLite_RepeatedGroup : public ::google::protobuf::MessageLite {
   
   static const TestAllTypesLite_RepeatedGroup& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestAllTypesLite_RepeatedGroup* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestAllTypesLite_RepeatedGroup* other);
   
   // implements Message ----------------------------------------------
@@ -251,7 +276,9 @@ class TestAllTypesLite_RepeatedGroup : public ::google::protobuf::MessageLite {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -273,10 +300,10 @@ class TestAllTypesLite_RepeatedGroup : public ::google::protobuf::MessageLite {
   
   // @@protoc_insertion_point(class_scope:protobuf_unittest.TestAllTypesLite.RepeatedGroup)
  private:
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::google::protobuf::int32 a_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_5flite_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5flite_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5flite_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5flite_2eproto();
   
@@ -312,6 +339,12 @@ class TestAllTypesLite : public ::google::protobuf::MessageLite {
   
   static const TestAllTypesLite& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestAllTypesLite* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestAllTypesLite* other);
   
   // implements Message ----------------------------------------------
@@ -328,7 +361,9 @@ class TestAllTypesLite : public ::google::protobuf::MessageLite {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -523,14 +558,11 @@ class TestAllTypesLite : public ::google::protobuf::MessageLite {
   inline bool has_optional_string_piece() const;
   inline void clear_optional_string_piece();
   static const int kOptionalStringPieceFieldNumber = 24;
- private:
-  // Hidden due to unknown ctype option.
-  inline const ::std::string& optional_string_piece() const;
+  inline const ::google::protobuf::internal::StringPieceField& optional_string_piece() const;
   inline void set_optional_string_piece(const ::std::string& value);
   inline void set_optional_string_piece(const char* value);
   inline void set_optional_string_piece(const char* value, size_t size);
   inline ::std::string* mutable_optional_string_piece();
- public:
   
   // optional string optional_cord = 25 [ctype = CORD];
   inline bool has_optional_cord() const;
@@ -815,9 +847,7 @@ class TestAllTypesLite : public ::google::protobuf::MessageLite {
   inline int repeated_string_piece_size() const;
   inline void clear_repeated_string_piece();
   static const int kRepeatedStringPieceFieldNumber = 54;
- private:
-  // Hidden due to unknown ctype option.
-  inline const ::std::string& repeated_string_piece(int index) const;
+  inline const ::google::protobuf::internal::StringPieceField& repeated_string_piece(int index) const;
   inline ::std::string* mutable_repeated_string_piece(int index);
   inline void set_repeated_string_piece(int index, const ::std::string& value);
   inline void set_repeated_string_piece(int index, const char* value);
@@ -826,9 +856,8 @@ class TestAllTypesLite : public ::google::protobuf::MessageLite {
   inline void add_repeated_string_piece(const ::std::string& value);
   inline void add_repeated_string_piece(const char* value);
   inline void add_repeated_string_piece(const char* value, size_t size);
-  inline const ::google::protobuf::RepeatedPtrField< ::std::string>& repeated_string_piece() const;
-  inline ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_repeated_string_piece();
- public:
+  inline const ::google::protobuf::RepeatedPtrField< ::google::protobuf::internal::StringPieceField>& repeated_string_piece() const;
+  inline ::google::protobuf::RepeatedPtrField< ::google::protobuf::internal::StringPieceField>* mutable_repeated_string_piece();
   
   // repeated string repeated_cord = 55 [ctype = CORD];
   inline int repeated_cord_size() const;
@@ -985,14 +1014,11 @@ class TestAllTypesLite : public ::google::protobuf::MessageLite {
   inline bool has_default_string_piece() const;
   inline void clear_default_string_piece();
   static const int kDefaultStringPieceFieldNumber = 84;
- private:
-  // Hidden due to unknown ctype option.
-  inline const ::std::string& default_string_piece() const;
+  inline const ::google::protobuf::internal::StringPieceField& default_string_piece() const;
   inline void set_default_string_piece(const ::std::string& value);
   inline void set_default_string_piece(const char* value);
   inline void set_default_string_piece(const char* value, size_t size);
   inline ::std::string* mutable_default_string_piece();
- public:
   
   // optional string default_cord = 85 [default = "123", ctype = CORD];
   inline bool has_default_cord() const;
@@ -1009,7 +1035,7 @@ class TestAllTypesLite : public ::google::protobuf::MessageLite {
   
   // @@protoc_insertion_point(class_scope:protobuf_unittest.TestAllTypesLite)
  private:
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::google::protobuf::int32 optional_int32_;
   ::google::protobuf::int64 optional_int64_;
@@ -1035,8 +1061,7 @@ class TestAllTypesLite : public ::google::protobuf::MessageLite {
   int optional_nested_enum_;
   int optional_foreign_enum_;
   int optional_import_enum_;
-  ::std::string* optional_string_piece_;
-  static const ::std::string _default_optional_string_piece_;
+  ::google::protobuf::internal::StringPieceField optional_string_piece_;
   ::std::string* optional_cord_;
   static const ::std::string _default_optional_cord_;
   ::google::protobuf::RepeatedField< ::google::protobuf::int32 > repeated_int32_;
@@ -1061,7 +1086,7 @@ class TestAllTypesLite : public ::google::protobuf::MessageLite {
   ::google::protobuf::RepeatedField<int> repeated_nested_enum_;
   ::google::protobuf::RepeatedField<int> repeated_foreign_enum_;
   ::google::protobuf::RepeatedField<int> repeated_import_enum_;
-  ::google::protobuf::RepeatedPtrField< ::std::string> repeated_string_piece_;
+  ::google::protobuf::RepeatedPtrField< ::google::protobuf::internal::StringPieceField> repeated_string_piece_;
   ::google::protobuf::RepeatedPtrField< ::std::string> repeated_cord_;
   ::google::protobuf::int32 default_int32_;
   ::google::protobuf::int64 default_int64_;
@@ -1083,11 +1108,10 @@ class TestAllTypesLite : public ::google::protobuf::MessageLite {
   int default_nested_enum_;
   int default_foreign_enum_;
   int default_import_enum_;
-  ::std::string* default_string_piece_;
-  static const ::std::string _default_default_string_piece_;
+  ::google::protobuf::internal::StringPieceField default_string_piece_;
   ::std::string* default_cord_;
   static const ::std::string _default_default_cord_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_5flite_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5flite_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5flite_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5flite_2eproto();
   
@@ -1123,6 +1147,12 @@ class ForeignMessageLite : public ::google::protobuf::MessageLite {
   
   static const ForeignMessageLite& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const ForeignMessageLite* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(ForeignMessageLite* other);
   
   // implements Message ----------------------------------------------
@@ -1139,7 +1169,9 @@ class ForeignMessageLite : public ::google::protobuf::MessageLite {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -1161,10 +1193,10 @@ class ForeignMessageLite : public ::google::protobuf::MessageLite {
   
   // @@protoc_insertion_point(class_scope:protobuf_unittest.ForeignMessageLite)
  private:
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::google::protobuf::int32 c_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_5flite_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5flite_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5flite_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5flite_2eproto();
   
@@ -1200,6 +1232,12 @@ class TestPackedTypesLite : public ::google::protobuf::MessageLite {
   
   static const TestPackedTypesLite& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestPackedTypesLite* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestPackedTypesLite* other);
   
   // implements Message ----------------------------------------------
@@ -1216,7 +1254,9 @@ class TestPackedTypesLite : public ::google::protobuf::MessageLite {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -1397,37 +1437,37 @@ class TestPackedTypesLite : public ::google::protobuf::MessageLite {
   
   // @@protoc_insertion_point(class_scope:protobuf_unittest.TestPackedTypesLite)
  private:
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::google::protobuf::RepeatedField< ::google::protobuf::int32 > packed_int32_;
-  mutable int _packed_int32_cached_byte_size_;
+  mutable ::google::protobuf::internal::Atomic32 _packed_int32_cached_byte_size_;
   ::google::protobuf::RepeatedField< ::google::protobuf::int64 > packed_int64_;
-  mutable int _packed_int64_cached_byte_size_;
+  mutable ::google::protobuf::internal::Atomic32 _packed_int64_cached_byte_size_;
   ::google::protobuf::RepeatedField< ::google::protobuf::uint32 > packed_uint32_;
-  mutable int _packed_uint32_cached_byte_size_;
+  mutable ::google::protobuf::internal::Atomic32 _packed_uint32_cached_byte_size_;
   ::google::protobuf::RepeatedField< ::google::protobuf::uint64 > packed_uint64_;
-  mutable int _packed_uint64_cached_byte_size_;
+  mutable ::google::protobuf::internal::Atomic32 _packed_uint64_cached_byte_size_;
   ::google::protobuf::RepeatedField< ::google::protobuf::int32 > packed_sint32_;
-  mutable int _packed_sint32_cached_byte_size_;
+  mutable ::google::protobuf::internal::Atomic32 _packed_sint32_cached_byte_size_;
   ::google::protobuf::RepeatedField< ::google::protobuf::int64 > packed_sint64_;
-  mutable int _packed_sint64_cached_byte_size_;
+  mutable ::google::protobuf::internal::Atomic32 _packed_sint64_cached_byte_size_;
   ::google::protobuf::RepeatedField< ::google::protobuf::uint32 > packed_fixed32_;
-  mutable int _packed_fixed32_cached_byte_size_;
+  mutable ::google::protobuf::internal::Atomic32 _packed_fixed32_cached_byte_size_;
   ::google::protobuf::RepeatedField< ::google::protobuf::uint64 > packed_fixed64_;
-  mutable int _packed_fixed64_cached_byte_size_;
+  mutable ::google::protobuf::internal::Atomic32 _packed_fixed64_cached_byte_size_;
   ::google::protobuf::RepeatedField< ::google::protobuf::int32 > packed_sfixed32_;
-  mutable int _packed_sfixed32_cached_byte_size_;
+  mutable ::google::protobuf::internal::Atomic32 _packed_sfixed32_cached_byte_size_;
   ::google::protobuf::RepeatedField< ::google::protobuf::int64 > packed_sfixed64_;
-  mutable int _packed_sfixed64_cached_byte_size_;
+  mutable ::google::protobuf::internal::Atomic32 _packed_sfixed64_cached_byte_size_;
   ::google::protobuf::RepeatedField< float > packed_float_;
-  mutable int _packed_float_cached_byte_size_;
+  mutable ::google::protobuf::internal::Atomic32 _packed_float_cached_byte_size_;
   ::google::protobuf::RepeatedField< double > packed_double_;
-  mutable int _packed_double_cached_byte_size_;
+  mutable ::google::protobuf::internal::Atomic32 _packed_double_cached_byte_size_;
   ::google::protobuf::RepeatedField< bool > packed_bool_;
-  mutable int _packed_bool_cached_byte_size_;
+  mutable ::google::protobuf::internal::Atomic32 _packed_bool_cached_byte_size_;
   ::google::protobuf::RepeatedField<int> packed_enum_;
-  mutable int _packed_enum_cached_byte_size_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_5flite_2eproto();
+  mutable ::google::protobuf::internal::Atomic32 _packed_enum_cached_byte_size_;
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5flite_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5flite_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5flite_2eproto();
   
@@ -1463,6 +1503,12 @@ class TestAllExtensionsLite : public ::google::protobuf::MessageLite {
   
   static const TestAllExtensionsLite& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestAllExtensionsLite* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestAllExtensionsLite* other);
   
   // implements Message ----------------------------------------------
@@ -1479,7 +1525,9 @@ class TestAllExtensionsLite : public ::google::protobuf::MessageLite {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -1496,9 +1544,9 @@ class TestAllExtensionsLite : public ::google::protobuf::MessageLite {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.TestAllExtensionsLite)
  private:
   ::google::protobuf::internal::ExtensionSet _extensions_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_5flite_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5flite_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5flite_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5flite_2eproto();
   
@@ -1534,6 +1582,12 @@ class OptionalGroup_extension_lite : public ::google::protobuf::MessageLite {
   
   static const OptionalGroup_extension_lite& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const OptionalGroup_extension_lite* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(OptionalGroup_extension_lite* other);
   
   // implements Message ----------------------------------------------
@@ -1550,7 +1604,9 @@ class OptionalGroup_extension_lite : public ::google::protobuf::MessageLite {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -1572,10 +1628,10 @@ class OptionalGroup_extension_lite : public ::google::protobuf::MessageLite {
   
   // @@protoc_insertion_point(class_scope:protobuf_unittest.OptionalGroup_extension_lite)
  private:
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::google::protobuf::int32 a_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_5flite_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5flite_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5flite_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5flite_2eproto();
   
@@ -1611,6 +1667,12 @@ class RepeatedGroup_extension_lite : public ::google::protobuf::MessageLite {
   
   static const RepeatedGroup_extension_lite& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const RepeatedGroup_extension_lite* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(RepeatedGroup_extension_lite* other);
   
   // implements Message ----------------------------------------------
@@ -1627,7 +1689,9 @@ class RepeatedGroup_extension_lite : public ::google::protobuf::MessageLite {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -1649,10 +1713,10 @@ class RepeatedGroup_extension_lite : public ::google::protobuf::MessageLite {
   
   // @@protoc_insertion_point(class_scope:protobuf_unittest.RepeatedGroup_extension_lite)
  private:
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::google::protobuf::int32 a_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_5flite_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5flite_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5flite_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5flite_2eproto();
   
@@ -1688,6 +1752,12 @@ class TestPackedExtensionsLite : public ::google::protobuf::MessageLite {
   
   static const TestPackedExtensionsLite& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestPackedExtensionsLite* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestPackedExtensionsLite* other);
   
   // implements Message ----------------------------------------------
@@ -1704,7 +1774,9 @@ class TestPackedExtensionsLite : public ::google::protobuf::MessageLite {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -1721,9 +1793,9 @@ class TestPackedExtensionsLite : public ::google::protobuf::MessageLite {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.TestPackedExtensionsLite)
  private:
   ::google::protobuf::internal::ExtensionSet _extensions_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_5flite_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5flite_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5flite_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5flite_2eproto();
   
@@ -1759,6 +1831,12 @@ class TestNestedExtensionLite : public ::google::protobuf::MessageLite {
   
   static const TestNestedExtensionLite& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestNestedExtensionLite* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestNestedExtensionLite* other);
   
   // implements Message ----------------------------------------------
@@ -1775,7 +1853,9 @@ class TestNestedExtensionLite : public ::google::protobuf::MessageLite {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -1794,9 +1874,9 @@ class TestNestedExtensionLite : public ::google::protobuf::MessageLite {
     nested_extension;
   // @@protoc_insertion_point(class_scope:protobuf_unittest.TestNestedExtensionLite)
  private:
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_5flite_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5flite_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5flite_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5flite_2eproto();
   
@@ -1832,6 +1912,12 @@ class TestDeprecatedLite : public ::google::protobuf::MessageLite {
   
   static const TestDeprecatedLite& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestDeprecatedLite* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestDeprecatedLite* other);
   
   // implements Message ----------------------------------------------
@@ -1848,7 +1934,9 @@ class TestDeprecatedLite : public ::google::protobuf::MessageLite {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -1870,10 +1958,10 @@ class TestDeprecatedLite : public ::google::protobuf::MessageLite {
   
   // @@protoc_insertion_point(class_scope:protobuf_unittest.TestDeprecatedLite)
  private:
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::google::protobuf::int32 deprecated_field_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_5flite_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5flite_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5flite_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5flite_2eproto();
   
@@ -2589,7 +2677,7 @@ inline void TestAllTypesLite::clear_optionalgroup() {
   _clear_bit(15);
 }
 inline const ::protobuf_unittest::TestAllTypesLite_OptionalGroup& TestAllTypesLite::optionalgroup() const {
-  return optionalgroup_ != NULL ? *optionalgroup_ : *default_instance_->optionalgroup_;
+  return optionalgroup_ != NULL ? *optionalgroup_ : ::protobuf_unittest::TestAllTypesLite_OptionalGroup::default_instance();
 }
 inline ::protobuf_unittest::TestAllTypesLite_OptionalGroup* TestAllTypesLite::mutable_optionalgroup() {
   _set_bit(15);
@@ -2606,7 +2694,7 @@ inline void TestAllTypesLite::clear_optional_nested_message() {
   _clear_bit(16);
 }
 inline const ::protobuf_unittest::TestAllTypesLite_NestedMessage& TestAllTypesLite::optional_nested_message() const {
-  return optional_nested_message_ != NULL ? *optional_nested_message_ : *default_instance_->optional_nested_message_;
+  return optional_nested_message_ != NULL ? *optional_nested_message_ : ::protobuf_unittest::TestAllTypesLite_NestedMessage::default_instance();
 }
 inline ::protobuf_unittest::TestAllTypesLite_NestedMessage* TestAllTypesLite::mutable_optional_nested_message() {
   _set_bit(16);
@@ -2623,7 +2711,7 @@ inline void TestAllTypesLite::clear_optional_foreign_message() {
   _clear_bit(17);
 }
 inline const ::protobuf_unittest::ForeignMessageLite& TestAllTypesLite::optional_foreign_message() const {
-  return optional_foreign_message_ != NULL ? *optional_foreign_message_ : *default_instance_->optional_foreign_message_;
+  return optional_foreign_message_ != NULL ? *optional_foreign_message_ : ::protobuf_unittest::ForeignMessageLite::default_instance();
 }
 inline ::protobuf_unittest::ForeignMessageLite* TestAllTypesLite::mutable_optional_foreign_message() {
   _set_bit(17);
@@ -2640,7 +2728,7 @@ inline void TestAllTypesLite::clear_optional_import_message() {
   _clear_bit(18);
 }
 inline const ::protobuf_unittest_import::ImportMessageLite& TestAllTypesLite::optional_import_message() const {
-  return optional_import_message_ != NULL ? *optional_import_message_ : *default_instance_->optional_import_message_;
+  return optional_import_message_ != NULL ? *optional_import_message_ : ::protobuf_unittest_import::ImportMessageLite::default_instance();
 }
 inline ::protobuf_unittest_import::ImportMessageLite* TestAllTypesLite::mutable_optional_import_message() {
   _set_bit(18);
@@ -2704,41 +2792,27 @@ inline bool TestAllTypesLite::has_optional_string_piece() const {
   return _has_bit(22);
 }
 inline void TestAllTypesLite::clear_optional_string_piece() {
-  if (optional_string_piece_ != &_default_optional_string_piece_) {
-    optional_string_piece_->clear();
-  }
+  optional_string_piece_.Clear();
   _clear_bit(22);
 }
-inline const ::std::string& TestAllTypesLite::optional_string_piece() const {
-  return *optional_string_piece_;
+inline const ::google::protobuf::internal::StringPieceField& TestAllTypesLite::optional_string_piece() const {
+  return optional_string_piece_;
 }
 inline void TestAllTypesLite::set_optional_string_piece(const ::std::string& value) {
   _set_bit(22);
-  if (optional_string_piece_ == &_default_optional_string_piece_) {
-    optional_string_piece_ = new ::std::string;
-  }
-  optional_string_piece_->assign(value);
+  optional_string_piece_.CopyFrom(value.data(), value.size());
 }
 inline void TestAllTypesLite::set_optional_string_piece(const char* value) {
   _set_bit(22);
-  if (optional_string_piece_ == &_default_optional_string_piece_) {
-    optional_string_piece_ = new ::std::string;
-  }
-  optional_string_piece_->assign(value);
+  optional_string_piece_.CopyFrom(value, strlen(value));
 }
 inline void TestAllTypesLite::set_optional_string_piece(const char* value, size_t size) {
   _set_bit(22);
-  if (optional_string_piece_ == &_default_optional_string_piece_) {
-    optional_string_piece_ = new ::std::string;
-  }
-  optional_string_piece_->assign(reinterpret_cast<const char*>(value), size);
+  optional_string_piece_.CopyFrom(reinterpret_cast<const char*>(value), size);
 }
 inline ::std::string* TestAllTypesLite::mutable_optional_string_piece() {
   _set_bit(22);
-  if (optional_string_piece_ == &_default_optional_string_piece_) {
-    optional_string_piece_ = new ::std::string;
-  }
-  return optional_string_piece_;
+  return optional_string_piece_.Mutable();
 }
 
 // optional string optional_cord = 25 [ctype = CORD];
@@ -3384,39 +3458,39 @@ inline int TestAllTypesLite::repeated_string_piece_size() const {
 inline void TestAllTypesLite::clear_repeated_string_piece() {
   repeated_string_piece_.Clear();
 }
-inline const ::std::string& TestAllTypesLite::repeated_string_piece(int index) const {
+inline const ::google::protobuf::internal::StringPieceField& TestAllTypesLite::repeated_string_piece(int index) const {
   return repeated_string_piece_.Get(index);
 }
 inline ::std::string* TestAllTypesLite::mutable_repeated_string_piece(int index) {
-  return repeated_string_piece_.Mutable(index);
+  return repeated_string_piece_.Mutable(index)->Mutable();
 }
 inline void TestAllTypesLite::set_repeated_string_piece(int index, const ::std::string& value) {
-  repeated_string_piece_.Mutable(index)->assign(value);
+  repeated_string_piece_.Mutable(index)->CopyFrom(value.data(), value.size());
 }
 inline void TestAllTypesLite::set_repeated_string_piece(int index, const char* value) {
-  repeated_string_piece_.Mutable(index)->assign(value);
+  repeated_string_piece_.Mutable(index)->CopyFrom(value, strlen(value));
 }
 inline void TestAllTypesLite::set_repeated_string_piece(int index, const char* value, size_t size) {
-  repeated_string_piece_.Mutable(index)->assign(
+  repeated_string_piece_.Mutable(index)->CopyFrom(
     reinterpret_cast<const char*>(value), size);
 }
 inline ::std::string* TestAllTypesLite::add_repeated_string_piece() {
-  return repeated_string_piece_.Add();
+  return repeated_string_piece_.Add()->Mutable();
 }
 inline void TestAllTypesLite::add_repeated_string_piece(const ::std::string& value) {
-  repeated_string_piece_.Add()->assign(value);
+  repeated_string_piece_.Add()->CopyFrom(value.data(), value.size());
 }
 inline void TestAllTypesLite::add_repeated_string_piece(const char* value) {
-  repeated_string_piece_.Add()->assign(value);
+  repeated_string_piece_.Add()->CopyFrom(value, strlen(value));
 }
 inline void TestAllTypesLite::add_repeated_string_piece(const char* value, size_t size) {
-  repeated_string_piece_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  repeated_string_piece_.Add()->CopyFrom(reinterpret_cast<const char*>(value), size);
 }
-inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+inline const ::google::protobuf::RepeatedPtrField< ::google::protobuf::internal::StringPieceField>&
 TestAllTypesLite::repeated_string_piece() const {
   return repeated_string_piece_;
 }
-inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+inline ::google::protobuf::RepeatedPtrField< ::google::protobuf::internal::StringPieceField>*
 TestAllTypesLite::mutable_repeated_string_piece() {
   return &repeated_string_piece_;
 }
@@ -3813,41 +3887,27 @@ inline bool TestAllTypesLite::has_default_string_piece() const {
   return _has_bit(66);
 }
 inline void TestAllTypesLite::clear_default_string_piece() {
-  if (default_string_piece_ != &_default_default_string_piece_) {
-    default_string_piece_->assign(_default_default_string_piece_);
-  }
+  default_string_piece_.SetAliased("abc", 3);
   _clear_bit(66);
 }
-inline const ::std::string& TestAllTypesLite::default_string_piece() const {
-  return *default_string_piece_;
+inline const ::google::protobuf::internal::StringPieceField& TestAllTypesLite::default_string_piece() const {
+  return default_string_piece_;
 }
 inline void TestAllTypesLite::set_default_string_piece(const ::std::string& value) {
   _set_bit(66);
-  if (default_string_piece_ == &_default_default_string_piece_) {
-    default_string_piece_ = new ::std::string;
-  }
-  default_string_piece_->assign(value);
+  default_string_piece_.CopyFrom(value.data(), value.size());
 }
 inline void TestAllTypesLite::set_default_string_piece(const char* value) {
   _set_bit(66);
-  if (default_string_piece_ == &_default_default_string_piece_) {
-    default_string_piece_ = new ::std::string;
-  }
-  default_string_piece_->assign(value);
+  default_string_piece_.CopyFrom(value, strlen(value));
 }
 inline void TestAllTypesLite::set_default_string_piece(const char* value, size_t size) {
   _set_bit(66);
-  if (default_string_piece_ == &_default_default_string_piece_) {
-    default_string_piece_ = new ::std::string;
-  }
-  default_string_piece_->assign(reinterpret_cast<const char*>(value), size);
+  default_string_piece_.CopyFrom(reinterpret_cast<const char*>(value), size);
 }
 inline ::std::string* TestAllTypesLite::mutable_default_string_piece() {
   _set_bit(66);
-  if (default_string_piece_ == &_default_default_string_piece_) {
-    default_string_piece_ = new ::std::string(_default_default_string_piece_);
-  }
-  return default_string_piece_;
+  return default_string_piece_.Mutable();
 }
 
 // optional string default_cord = 85 [default = "123", ctype = CORD];
@@ -13,6 +13,33 @@ void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5flite_5fimports_5fnonli
   delete TestLiteImportsNonlite::default_instance_;
 }
 
+void protobuf_InitDefaults_google_2fprotobuf_2funittest_5flite_5fimports_5fnonlite_2eproto_impl() {
+  ::protobuf_unittest::protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto();
+  TestLiteImportsNonlite::default_instance_ = new TestLiteImportsNonlite();
+  TestLiteImportsNonlite::default_instance_->InitAsDefaultInstance();
+  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_google_2fprotobuf_2funittest_5flite_5fimports_5fnonlite_2eproto);
+}
+
+namespace {
+
+GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_InitDefaults_once_);
+// Set once the defaults are built, so that default_instance() and the
+// other callers on hot paths can skip the once.
+::google::protobuf::internal::Atomic32 protobuf_InitDefaults_done_ = 0;
+
+}  // namespace
+
+void protobuf_InitDefaults_google_2fprotobuf_2funittest_5flite_5fimports_5fnonlite_2eproto() {
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) != 0) {
+    return;
+  }
+  ::google::protobuf::GoogleOnceInit(&protobuf_InitDefaults_once_,
+                 &protobuf_InitDefaults_google_2fprotobuf_2funittest_5flite_5fimports_5fnonlite_2eproto_impl);
+  ::google::protobuf::internal::Release_Store(
+      &protobuf_InitDefaults_done_, 1);
+}
+
 void protobuf_AddDesc_google_2fprotobuf_2funittest_5flite_5fimports_5fnonlite_2eproto() {
   static bool already_here = false;
   if (already_here) return;
@@ -20,9 +47,6 @@ void protobuf_AddDesc_google_2fprotobuf_2funittest_5flite_5fimports_5fnonlite_2e
   GOOGLE_PROTOBUF_VERIFY_VERSION;
 
   ::protobuf_unittest::protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();
-  TestLiteImportsNonlite::default_instance_ = new TestLiteImportsNonlite();
-  TestLiteImportsNonlite::default_instance_->InitAsDefaultInstance();
-  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_google_2fprotobuf_2funittest_5flite_5fimports_5fnonlite_2eproto);
 }
 
 // Force AddDescriptors() to be called at static initialization time.
@@ -45,7 +69,8 @@ TestLiteImportsNonlite::TestLiteImportsNonlite()
 }
 
 void TestLiteImportsNonlite::InitAsDefaultInstance() {
-  message_ = const_cast< ::protobuf_unittest::TestAllTypes*>(&::protobuf_unittest::TestAllTypes::default_instance());
+  message_ = const_cast< ::protobuf_unittest::TestAllTypes*>(
+      ::protobuf_unittest::TestAllTypes::internal_default_instance());
 }
 
 TestLiteImportsNonlite::TestLiteImportsNonlite(const TestLiteImportsNonlite& from)
@@ -71,12 +96,14 @@ void TestLiteImportsNonlite::SharedDtor() {
 }
 
 void TestLiteImportsNonlite::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const TestLiteImportsNonlite& TestLiteImportsNonlite::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_5flite_5fimports_5fnonlite_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5flite_5fimports_5fnonlite_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestLiteImportsNonlite* TestLiteImportsNonlite::default_instance_ = NULL;
@@ -150,9 +177,8 @@ int TestLiteImportsNonlite::ByteSize() const {
     }
     
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
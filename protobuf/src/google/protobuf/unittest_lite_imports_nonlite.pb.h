@@ -29,6 +29,8 @@ namespace protobuf_unittest {
 
 // Internal implementation detail -- do not call these.
 void  protobuf_AddDesc_google_2fprotobuf_2funittest_5flite_5fimports_5fnonlite_2eproto();
+void  protobuf_InitDefaults_google_2fprotobuf_2funittest_5flite_5fimports_5fnonlite_2eproto();
+void protobuf_InitDefaults_google_2fprotobuf_2funittest_5flite_5fimports_5fnonlite_2eproto_impl();
 void protobuf_AssignDesc_google_2fprotobuf_2funittest_5flite_5fimports_5fnonlite_2eproto();
 void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5flite_5fimports_5fnonlite_2eproto();
 
@@ -50,6 +52,12 @@ class TestLiteImportsNonlite : public ::google::protobuf::MessageLite {
   
   static const TestLiteImportsNonlite& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestLiteImportsNonlite* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestLiteImportsNonlite* other);
   
   // implements Message ----------------------------------------------
@@ -66,7 +74,9 @@ class TestLiteImportsNonlite : public ::google::protobuf::MessageLite {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -88,10 +98,10 @@ class TestLiteImportsNonlite : public ::google::protobuf::MessageLite {
   
   // @@protoc_insertion_point(class_scope:protobuf_unittest.TestLiteImportsNonlite)
  private:
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::protobuf_unittest::TestAllTypes* message_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_5flite_5fimports_5fnonlite_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5flite_5fimports_5fnonlite_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5flite_5fimports_5fnonlite_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5flite_5fimports_5fnonlite_2eproto();
   
@@ -127,7 +137,7 @@ inline void TestLiteImportsNonlite::clear_message() {
   _clear_bit(0);
 }
 inline const ::protobuf_unittest::TestAllTypes& TestLiteImportsNonlite::message() const {
-  return message_ != NULL ? *message_ : *default_instance_->message_;
+  return message_ != NULL ? *message_ : ::protobuf_unittest::TestAllTypes::default_instance();
 }
 inline ::protobuf_unittest::TestAllTypes* TestLiteImportsNonlite::mutable_message() {
   _set_bit(0);
@@ -38,6 +38,7 @@ const ::google::protobuf::internal::GeneratedMessageReflection*
 
 void protobuf_AssignDesc_google_2fprotobuf_2funittest_5fmset_2eproto() {
   protobuf_AddDesc_google_2fprotobuf_2funittest_5fmset_2eproto();
+  protobuf_InitDefaults_google_2fprotobuf_2funittest_5fmset_2eproto();
   const ::google::protobuf::FileDescriptor* file =
     ::google::protobuf::DescriptorPool::generated_pool()->FindFileByName(
       "google/protobuf/unittest_mset.proto");
@@ -175,6 +176,50 @@ void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5fmset_2eproto() {
   delete RawMessageSet_Item_reflection_;
 }
 
+void protobuf_InitDefaults_google_2fprotobuf_2funittest_5fmset_2eproto_impl() {
+  TestMessageSet::default_instance_ = new TestMessageSet();
+  TestMessageSetContainer::default_instance_ = new TestMessageSetContainer();
+  TestMessageSetExtension1::default_instance_ = new TestMessageSetExtension1();
+  TestMessageSetExtension2::default_instance_ = new TestMessageSetExtension2();
+  RawMessageSet::default_instance_ = new RawMessageSet();
+  RawMessageSet_Item::default_instance_ = new RawMessageSet_Item();
+  TestMessageSet::default_instance_->InitAsDefaultInstance();
+  TestMessageSetContainer::default_instance_->InitAsDefaultInstance();
+  TestMessageSetExtension1::default_instance_->InitAsDefaultInstance();
+  ::google::protobuf::internal::ExtensionSet::RegisterMessageExtension(
+    ::protobuf_unittest::TestMessageSet::internal_default_instance(),
+    1545008, 11, false, false,
+    ::protobuf_unittest::TestMessageSetExtension1::internal_default_instance());
+  TestMessageSetExtension2::default_instance_->InitAsDefaultInstance();
+  ::google::protobuf::internal::ExtensionSet::RegisterMessageExtension(
+    ::protobuf_unittest::TestMessageSet::internal_default_instance(),
+    1547769, 11, false, false,
+    ::protobuf_unittest::TestMessageSetExtension2::internal_default_instance());
+  RawMessageSet::default_instance_->InitAsDefaultInstance();
+  RawMessageSet_Item::default_instance_->InitAsDefaultInstance();
+  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_google_2fprotobuf_2funittest_5fmset_2eproto);
+}
+
+namespace {
+
+GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_InitDefaults_once_);
+// Set once the defaults are built, so that default_instance() and the
+// other callers on hot paths can skip the once.
+::google::protobuf::internal::Atomic32 protobuf_InitDefaults_done_ = 0;
+
+}  // namespace
+
+void protobuf_InitDefaults_google_2fprotobuf_2funittest_5fmset_2eproto() {
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) != 0) {
+    return;
+  }
+  ::google::protobuf::GoogleOnceInit(&protobuf_InitDefaults_once_,
+                 &protobuf_InitDefaults_google_2fprotobuf_2funittest_5fmset_2eproto_impl);
+  ::google::protobuf::internal::Release_Store(
+      &protobuf_InitDefaults_done_, 1);
+}
+
 void protobuf_AddDesc_google_2fprotobuf_2funittest_5fmset_2eproto() {
   static bool already_here = false;
   if (already_here) return;
@@ -199,27 +244,8 @@ void protobuf_AddDesc_google_2fprotobuf_2funittest_5fmset_2eproto() {
     "\007type_id\030\002 \002(\005\022\017\n\007message\030\003 \002(\014B\002H\001", 595);
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
     "google/protobuf/unittest_mset.proto", &protobuf_RegisterTypes);
-  TestMessageSet::default_instance_ = new TestMessageSet();
-  TestMessageSetContainer::default_instance_ = new TestMessageSetContainer();
-  TestMessageSetExtension1::default_instance_ = new TestMessageSetExtension1();
-  TestMessageSetExtension2::default_instance_ = new TestMessageSetExtension2();
-  RawMessageSet::default_instance_ = new RawMessageSet();
-  RawMessageSet_Item::default_instance_ = new RawMessageSet_Item();
-  TestMessageSet::default_instance_->InitAsDefaultInstance();
-  TestMessageSetContainer::default_instance_->InitAsDefaultInstance();
-  TestMessageSetExtension1::default_instance_->InitAsDefaultInstance();
-  ::google::protobuf::internal::ExtensionSet::RegisterMessageExtension(
-    &::protobuf_unittest::TestMessageSet::default_instance(),
-    1545008, 11, false, false,
-    &::protobuf_unittest::TestMessageSetExtension1::default_instance());
-  TestMessageSetExtension2::default_instance_->InitAsDefaultInstance();
-  ::google::protobuf::internal::ExtensionSet::RegisterMessageExtension(
-    &::protobuf_unittest::TestMessageSet::default_instance(),
-    1547769, 11, false, false,
-    &::protobuf_unittest::TestMessageSetExtension2::default_instance());
-  RawMessageSet::default_instance_->InitAsDefaultInstance();
-  RawMessageSet_Item::default_instance_->InitAsDefaultInstance();
-  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_google_2fprotobuf_2funittest_5fmset_2eproto);
+  ::google::protobuf::internal::ExtensionSet::RegisterDeferredExtensions(
+    &protobuf_InitDefaults_google_2fprotobuf_2funittest_5fmset_2eproto);
 }
 
 // Force AddDescriptors() to be called at static initialization time.
@@ -264,9 +290,7 @@ void TestMessageSet::SharedDtor() {
 }
 
 void TestMessageSet::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* TestMessageSet::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -274,7 +298,11 @@ const ::google::protobuf::Descriptor* TestMessageSet::descriptor() {
 }
 
 const TestMessageSet& TestMessageSet::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_5fmset_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5fmset_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestMessageSet* TestMessageSet::default_instance_ = NULL;
@@ -291,7 +319,7 @@ void TestMessageSet::Clear() {
 
 bool TestMessageSet::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
-  return _extensions_.ParseMessageSet(input, default_instance_,
+  return _extensions_.ParseMessageSet(input, &default_instance(),
                                       mutable_unknown_fields());
 }
 
@@ -316,9 +344,8 @@ int TestMessageSet::ByteSize() const {
   int total_size = _extensions_.MessageSetByteSize();
   total_size += ::google::protobuf::internal::WireFormat::
       ComputeUnknownMessageSetItemsSize(unknown_fields());
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -387,7 +414,8 @@ TestMessageSetContainer::TestMessageSetContainer()
 }
 
 void TestMessageSetContainer::InitAsDefaultInstance() {
-  message_set_ = const_cast< ::protobuf_unittest::TestMessageSet*>(&::protobuf_unittest::TestMessageSet::default_instance());
+  message_set_ = const_cast< ::protobuf_unittest::TestMessageSet*>(
+      ::protobuf_unittest::TestMessageSet::internal_default_instance());
 }
 
 TestMessageSetContainer::TestMessageSetContainer(const TestMessageSetContainer& from)
@@ -413,9 +441,7 @@ void TestMessageSetContainer::SharedDtor() {
 }
 
 void TestMessageSetContainer::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* TestMessageSetContainer::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -423,7 +449,11 @@ const ::google::protobuf::Descriptor* TestMessageSetContainer::descriptor() {
 }
 
 const TestMessageSetContainer& TestMessageSetContainer::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_5fmset_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5fmset_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestMessageSetContainer* TestMessageSetContainer::default_instance_ = NULL;
@@ -524,9 +554,8 @@ int TestMessageSetContainer::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -601,7 +630,7 @@ const int TestMessageSetExtension1::kMessageSetExtensionFieldNumber;
 #endif
 ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestMessageSet,
     ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::TestMessageSetExtension1 >, 11, false >
-  TestMessageSetExtension1::message_set_extension(kMessageSetExtensionFieldNumber, ::protobuf_unittest::TestMessageSetExtension1::default_instance());
+  TestMessageSetExtension1::message_set_extension(kMessageSetExtensionFieldNumber);
 TestMessageSetExtension1::TestMessageSetExtension1()
   : ::google::protobuf::Message() {
   SharedCtor();
@@ -632,9 +661,7 @@ void TestMessageSetExtension1::SharedDtor() {
 }
 
 void TestMessageSetExtension1::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* TestMessageSetExtension1::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -642,7 +669,11 @@ const ::google::protobuf::Descriptor* TestMessageSetExtension1::descriptor() {
 }
 
 const TestMessageSetExtension1& TestMessageSetExtension1::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_5fmset_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5fmset_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestMessageSetExtension1* TestMessageSetExtension1::default_instance_ = NULL;
@@ -740,9 +771,8 @@ int TestMessageSetExtension1::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -815,7 +845,7 @@ const int TestMessageSetExtension2::kMessageSetExtensionFieldNumber;
 #endif
 ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestMessageSet,
     ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::TestMessageSetExtension2 >, 11, false >
-  TestMessageSetExtension2::message_set_extension(kMessageSetExtensionFieldNumber, ::protobuf_unittest::TestMessageSetExtension2::default_instance());
+  TestMessageSetExtension2::message_set_extension(kMessageSetExtensionFieldNumber);
 TestMessageSetExtension2::TestMessageSetExtension2()
   : ::google::protobuf::Message() {
   SharedCtor();
@@ -849,9 +879,7 @@ void TestMessageSetExtension2::SharedDtor() {
 }
 
 void TestMessageSetExtension2::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* TestMessageSetExtension2::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -859,7 +887,11 @@ const ::google::protobuf::Descriptor* TestMessageSetExtension2::descriptor() {
 }
 
 const TestMessageSetExtension2& TestMessageSetExtension2::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_5fmset_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5fmset_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestMessageSetExtension2* TestMessageSetExtension2::default_instance_ = NULL;
@@ -971,9 +1003,8 @@ int TestMessageSetExtension2::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -1076,9 +1107,7 @@ void RawMessageSet_Item::SharedDtor() {
 }
 
 void RawMessageSet_Item::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* RawMessageSet_Item::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -1086,7 +1115,11 @@ const ::google::protobuf::Descriptor* RawMessageSet_Item::descriptor() {
 }
 
 const RawMessageSet_Item& RawMessageSet_Item::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_5fmset_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5fmset_2eproto();
+  }
+  return *default_instance_;
 }
 
 RawMessageSet_Item* RawMessageSet_Item::default_instance_ = NULL;
@@ -1223,9 +1256,8 @@ int RawMessageSet_Item::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -1326,9 +1358,7 @@ void RawMessageSet::SharedDtor() {
 }
 
 void RawMessageSet::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* RawMessageSet::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -1336,7 +1366,11 @@ const ::google::protobuf::Descriptor* RawMessageSet::descriptor() {
 }
 
 const RawMessageSet& RawMessageSet::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_5fmset_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5fmset_2eproto();
+  }
+  return *default_instance_;
 }
 
 RawMessageSet* RawMessageSet::default_instance_ = NULL;
@@ -1434,9 +1468,8 @@ int RawMessageSet::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -29,6 +29,8 @@ namespace protobuf_unittest {
 
 // Internal implementation detail -- do not call these.
 void  protobuf_AddDesc_google_2fprotobuf_2funittest_5fmset_2eproto();
+void  protobuf_InitDefaults_google_2fprotobuf_2funittest_5fmset_2eproto();
+void protobuf_InitDefaults_google_2fprotobuf_2funittest_5fmset_2eproto_impl();
 void protobuf_AssignDesc_google_2fprotobuf_2funittest_5fmset_2eproto();
 void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5fmset_2eproto();
 
@@ -64,6 +66,12 @@ class TestMessageSet : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const TestMessageSet& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestMessageSet* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestMessageSet* other);
   
   // implements Message ----------------------------------------------
@@ -82,7 +90,9 @@ class TestMessageSet : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -100,9 +110,9 @@ class TestMessageSet : public ::google::protobuf::Message {
  private:
   ::google::protobuf::internal::ExtensionSet _extensions_;
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_5fmset_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5fmset_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5fmset_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5fmset_2eproto();
   
@@ -147,6 +157,12 @@ class TestMessageSetContainer : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const TestMessageSetContainer& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestMessageSetContainer* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestMessageSetContainer* other);
   
   // implements Message ----------------------------------------------
@@ -165,7 +181,9 @@ class TestMessageSetContainer : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -188,10 +206,10 @@ class TestMessageSetContainer : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.TestMessageSetContainer)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::protobuf_unittest::TestMessageSet* message_set_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_5fmset_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5fmset_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5fmset_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5fmset_2eproto();
   
@@ -236,6 +254,12 @@ class TestMessageSetExtension1 : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const TestMessageSetExtension1& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestMessageSetExtension1* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestMessageSetExtension1* other);
   
   // implements Message ----------------------------------------------
@@ -254,7 +278,9 @@ class TestMessageSetExtension1 : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -281,10 +307,10 @@ class TestMessageSetExtension1 : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.TestMessageSetExtension1)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::google::protobuf::int32 i_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_5fmset_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5fmset_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5fmset_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5fmset_2eproto();
   
@@ -329,6 +355,12 @@ class TestMessageSetExtension2 : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const TestMessageSetExtension2& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestMessageSetExtension2* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestMessageSetExtension2* other);
   
   // implements Message ----------------------------------------------
@@ -347,7 +379,9 @@ class TestMessageSetExtension2 : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -377,11 +411,11 @@ class TestMessageSetExtension2 : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.TestMessageSetExtension2)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::std::string* str_;
   static const ::std::string _default_str_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_5fmset_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5fmset_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5fmset_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5fmset_2eproto();
   
@@ -426,6 +460,12 @@ class RawMessageSet_Item : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const RawMessageSet_Item& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const RawMessageSet_Item* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(RawMessageSet_Item* other);
   
   // implements Message ----------------------------------------------
@@ -444,7 +484,9 @@ class RawMessageSet_Item : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -477,12 +519,12 @@ class RawMessageSet_Item : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.RawMessageSet.Item)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::google::protobuf::int32 type_id_;
   ::std::string* message_;
   static const ::std::string _default_message_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_5fmset_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5fmset_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5fmset_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5fmset_2eproto();
   
@@ -527,6 +569,12 @@ class RawMessageSet : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const RawMessageSet& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const RawMessageSet* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(RawMessageSet* other);
   
   // implements Message ----------------------------------------------
@@ -545,7 +593,9 @@ class RawMessageSet : public ::google::protobuf::Message {
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
   ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -575,10 +625,10 @@ class RawMessageSet : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.RawMessageSet)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::RawMessageSet_Item > item_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_5fmset_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5fmset_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5fmset_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5fmset_2eproto();
   
@@ -618,7 +668,7 @@ inline void TestMessageSetContainer::clear_message_set() {
   _clear_bit(0);
 }
 inline const ::protobuf_unittest::TestMessageSet& TestMessageSetContainer::message_set() const {
-  return message_set_ != NULL ? *message_set_ : *default_instance_->message_set_;
+  return message_set_ != NULL ? *message_set_ : ::protobuf_unittest::TestMessageSet::default_instance();
 }
 inline ::protobuf_unittest::TestMessageSet* TestMessageSetContainer::mutable_message_set() {
   _set_bit(0);
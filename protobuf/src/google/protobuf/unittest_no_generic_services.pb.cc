@@ -26,6 +26,7 @@ const ::google::protobuf::EnumDescriptor* TestEnum_descriptor_ = NULL;
 
 void protobuf_AssignDesc_google_2fprotobuf_2funittest_5fno_5fgeneric_5fservices_2eproto() {
   protobuf_AddDesc_google_2fprotobuf_2funittest_5fno_5fgeneric_5fservices_2eproto();
+  protobuf_InitDefaults_google_2fprotobuf_2funittest_5fno_5fgeneric_5fservices_2eproto();
   const ::google::protobuf::FileDescriptor* file =
     ::google::protobuf::DescriptorPool::generated_pool()->FindFileByName(
       "google/protobuf/unittest_no_generic_services.proto");
@@ -69,6 +70,35 @@ void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5fno_5fgeneric_5fservice
   delete TestMessage_reflection_;
 }
 
+void protobuf_InitDefaults_google_2fprotobuf_2funittest_5fno_5fgeneric_5fservices_2eproto_impl() {
+  TestMessage::default_instance_ = new TestMessage();
+  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
+    ::google::protobuf::no_generic_services_test::TestMessage::internal_default_instance(),
+    1000, 5, false, false);
+  TestMessage::default_instance_->InitAsDefaultInstance();
+  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_google_2fprotobuf_2funittest_5fno_5fgeneric_5fservices_2eproto);
+}
+
+namespace {
+
+GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_InitDefaults_once_);
+// Set once the defaults are built, so that default_instance() and the
+// other callers on hot paths can skip the once.
+::google::protobuf::internal::Atomic32 protobuf_InitDefaults_done_ = 0;
+
+}  // namespace
+
+void protobuf_InitDefaults_google_2fprotobuf_2funittest_5fno_5fgeneric_5fservices_2eproto() {
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) != 0) {
+    return;
+  }
+  ::google::protobuf::GoogleOnceInit(&protobuf_InitDefaults_once_,
+                 &protobuf_InitDefaults_google_2fprotobuf_2funittest_5fno_5fgeneric_5fservices_2eproto_impl);
+  ::google::protobuf::internal::Release_Store(
+      &protobuf_InitDefaults_done_, 1);
+}
+
 void protobuf_AddDesc_google_2fprotobuf_2funittest_5fno_5fgeneric_5fservices_2eproto() {
   static bool already_here = false;
   if (already_here) return;
@@ -88,12 +118,8 @@ void protobuf_AddDesc_google_2fprotobuf_2funittest_5fno_5fgeneric_5fservices_2ep
     "\007 \001(\005B\t\200\001\000\210\001\000\220\001\000", 376);
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
     "google/protobuf/unittest_no_generic_services.proto", &protobuf_RegisterTypes);
-  TestMessage::default_instance_ = new TestMessage();
-  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::google::protobuf::no_generic_services_test::TestMessage::default_instance(),
-    1000, 5, false, false);
-  TestMessage::default_instance_->InitAsDefaultInstance();
-  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_google_2fprotobuf_2funittest_5fno_5fgeneric_5fservices_2eproto);
+  ::google::protobuf::internal::ExtensionSet::RegisterDeferredExtensions(
+    &protobuf_InitDefaults_google_2fprotobuf_2funittest_5fno_5fgeneric_5fservices_2eproto);
 }
 
 // Force AddDescriptors() to be called at static initialization time.
@@ -153,9 +179,7 @@ void TestMessage::SharedDtor() {
 }
 
 void TestMessage::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* TestMessage::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -163,7 +187,11 @@ const ::google::protobuf::Descriptor* TestMessage::descriptor() {
 }
 
 const TestMessage& TestMessage::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_5fno_5fgeneric_5fservices_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5fno_5fgeneric_5fservices_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestMessage* TestMessage::default_instance_ = NULL;
@@ -209,7 +237,7 @@ bool TestMessage::MergePartialFromCodedStream(
           return true;
         }
         if ((8000u <= tag)) {
-          DO_(_extensions_.ParseField(tag, input, default_instance_,
+          DO_(_extensions_.ParseField(tag, input, &default_instance(),
                                       mutable_unknown_fields()));
           continue;
         }
@@ -277,9 +305,8 @@ int TestMessage::ByteSize() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
   return total_size;
 }
 
@@ -29,6 +29,7 @@ const ::google::protobuf::internal::GeneratedMessageReflection*
 
 void protobuf_AssignDesc_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto() {
   protobuf_AddDesc_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto();
+  protobuf_InitDefaults_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto();
   const ::google::protobuf::FileDescriptor* file =
     ::google::protobuf::DescriptorPool::generated_pool()->FindFileByName(
       "google/protobuf/unittest_optimize_for.proto");
@@ -110,6 +111,44 @@ void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto
   delete TestOptionalOptimizedForSize_reflection_;
 }
 
+void protobuf_InitDefaults_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto_impl() {
+  ::protobuf_unittest::protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto();
+  TestOptimizedForSize::default_instance_ = new TestOptimizedForSize();
+  TestRequiredOptimizedForSize::default_instance_ = new TestRequiredOptimizedForSize();
+  TestOptionalOptimizedForSize::default_instance_ = new TestOptionalOptimizedForSize();
+  TestOptimizedForSize::default_instance_->InitAsDefaultInstance();
+  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
+    ::protobuf_unittest::TestOptimizedForSize::internal_default_instance(),
+    1234, 5, false, false);
+  ::google::protobuf::internal::ExtensionSet::RegisterMessageExtension(
+    ::protobuf_unittest::TestOptimizedForSize::internal_default_instance(),
+    1235, 11, false, false,
+    ::protobuf_unittest::TestRequiredOptimizedForSize::internal_default_instance());
+  TestRequiredOptimizedForSize::default_instance_->InitAsDefaultInstance();
+  TestOptionalOptimizedForSize::default_instance_->InitAsDefaultInstance();
+  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto);
+}
+
+namespace {
+
+GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_InitDefaults_once_);
+// Set once the defaults are built, so that default_instance() and the
+// other callers on hot paths can skip the once.
+::google::protobuf::internal::Atomic32 protobuf_InitDefaults_done_ = 0;
+
+}  // namespace
+
+void protobuf_InitDefaults_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto() {
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) != 0) {
+    return;
+  }
+  ::google::protobuf::GoogleOnceInit(&protobuf_InitDefaults_once_,
+                 &protobuf_InitDefaults_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto_impl);
+  ::google::protobuf::internal::Release_Store(
+      &protobuf_InitDefaults_done_, 1);
+}
+
 void protobuf_AddDesc_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto() {
   static bool already_here = false;
   if (already_here) return;
@@ -133,20 +172,8 @@ void protobuf_AddDesc_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto() {
     "TestRequiredOptimizedForSizeB\002H\002", 512);
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
     "google/protobuf/unittest_optimize_for.proto", &protobuf_RegisterTypes);
-  TestOptimizedForSize::default_instance_ = new TestOptimizedForSize();
-  TestRequiredOptimizedForSize::default_instance_ = new TestRequiredOptimizedForSize();
-  TestOptionalOptimizedForSize::default_instance_ = new TestOptionalOptimizedForSize();
-  TestOptimizedForSize::default_instance_->InitAsDefaultInstance();
-  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
-    &::protobuf_unittest::TestOptimizedForSize::default_instance(),
-    1234, 5, false, false);
-  ::google::protobuf::internal::ExtensionSet::RegisterMessageExtension(
-    &::protobuf_unittest::TestOptimizedForSize::default_instance(),
-    1235, 11, false, false,
-    &::protobuf_unittest::TestRequiredOptimizedForSize::default_instance());
-  TestRequiredOptimizedForSize::default_instance_->InitAsDefaultInstance();
-  TestOptionalOptimizedForSize::default_instance_->InitAsDefaultInstance();
-  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto);
+  ::google::protobuf::internal::ExtensionSet::RegisterDeferredExtensions(
+    &protobuf_InitDefaults_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto);
 }
 
 // Force AddDescriptors() to be called at static initialization time.
@@ -175,14 +202,15 @@ const int TestOptimizedForSize::kTestExtension2FieldNumber;
 #endif
 ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestOptimizedForSize,
     ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::TestRequiredOptimizedForSize >, 11, false >
-  TestOptimizedForSize::test_extension2(kTestExtension2FieldNumber, ::protobuf_unittest::TestRequiredOptimizedForSize::default_instance());
+  TestOptimizedForSize::test_extension2(kTestExtension2FieldNumber);
 TestOptimizedForSize::TestOptimizedForSize()
   : ::google::protobuf::Message() {
   SharedCtor();
 }
 
 void TestOptimizedForSize::InitAsDefaultInstance() {
-  msg_ = const_cast< ::protobuf_unittest::ForeignMessage*>(&::protobuf_unittest::ForeignMessage::default_instance());
+  msg_ = const_cast< ::protobuf_unittest::ForeignMessage*>(
+      ::protobuf_unittest::ForeignMessage::internal_default_instance());
 }
 
 TestOptimizedForSize::TestOptimizedForSize(const TestOptimizedForSize& from)
@@ -209,9 +237,7 @@ void TestOptimizedForSize::SharedDtor() {
 }
 
 void TestOptimizedForSize::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* TestOptimizedForSize::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -219,7 +245,11 @@ const ::google::protobuf::Descriptor* TestOptimizedForSize::descriptor() {
 }
 
 const TestOptimizedForSize& TestOptimizedForSize::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestOptimizedForSize* TestOptimizedForSize::default_instance_ = NULL;
@@ -278,9 +308,7 @@ void TestRequiredOptimizedForSize::SharedDtor() {
 }
 
 void TestRequiredOptimizedForSize::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* TestRequiredOptimizedForSize::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -288,7 +316,11 @@ const ::google::protobuf::Descriptor* TestRequiredOptimizedForSize::descriptor()
 }
 
 const TestRequiredOptimizedForSize& TestRequiredOptimizedForSize::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestRequiredOptimizedForSize* TestRequiredOptimizedForSize::default_instance_ = NULL;
@@ -323,7 +355,8 @@ TestOptionalOptimizedForSize::TestOptionalOptimizedForSize()
 }
 
 void TestOptionalOptimizedForSize::InitAsDefaultInstance() {
-  o_ = const_cast< ::protobuf_unittest::TestRequiredOptimizedForSize*>(&::protobuf_unittest::TestRequiredOptimizedForSize::default_instance());
+  o_ = const_cast< ::protobuf_unittest::TestRequiredOptimizedForSize*>(
+      ::protobuf_unittest::TestRequiredOptimizedForSize::internal_default_instance());
 }
 
 TestOptionalOptimizedForSize::TestOptionalOptimizedForSize(const TestOptionalOptimizedForSize& from)
@@ -349,9 +382,7 @@ void TestOptionalOptimizedForSize::SharedDtor() {
 }
 
 void TestOptionalOptimizedForSize::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
 }
 const ::google::protobuf::Descriptor* TestOptionalOptimizedForSize::descriptor() {
   protobuf_AssignDescriptorsOnce();
@@ -359,7 +390,11 @@ const ::google::protobuf::Descriptor* TestOptionalOptimizedForSize::descriptor()
 }
 
 const TestOptionalOptimizedForSize& TestOptionalOptimizedForSize::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto();  return *default_instance_;
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto();
+  }
+  return *default_instance_;
 }
 
 TestOptionalOptimizedForSize* TestOptionalOptimizedForSize::default_instance_ = NULL;
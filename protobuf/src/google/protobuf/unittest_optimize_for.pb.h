@@ -30,6 +30,8 @@ namespace protobuf_unittest {
 
 // Internal implementation detail -- do not call these.
 void  protobuf_AddDesc_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto();
+void  protobuf_InitDefaults_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto();
+void protobuf_InitDefaults_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto_impl();
 void protobuf_AssignDesc_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto();
 void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto();
 
@@ -62,12 +64,20 @@ class TestOptimizedForSize : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const TestOptimizedForSize& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestOptimizedForSize* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestOptimizedForSize* other);
   
   // implements Message ----------------------------------------------
   
   TestOptimizedForSize* New() const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -107,11 +117,11 @@ class TestOptimizedForSize : public ::google::protobuf::Message {
  private:
   ::google::protobuf::internal::ExtensionSet _extensions_;
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::google::protobuf::int32 i_;
   ::protobuf_unittest::ForeignMessage* msg_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto();
   
@@ -156,12 +166,20 @@ class TestRequiredOptimizedForSize : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const TestRequiredOptimizedForSize& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestRequiredOptimizedForSize* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestRequiredOptimizedForSize* other);
   
   // implements Message ----------------------------------------------
   
   TestRequiredOptimizedForSize* New() const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -184,10 +202,10 @@ class TestRequiredOptimizedForSize : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.TestRequiredOptimizedForSize)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::google::protobuf::int32 x_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto();
   
@@ -232,12 +250,20 @@ class TestOptionalOptimizedForSize : public ::google::protobuf::Message {
   static const ::google::protobuf::Descriptor* descriptor();
   static const TestOptionalOptimizedForSize& default_instance();
   
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestOptionalOptimizedForSize* internal_default_instance() {
+    return default_instance_;
+  }
+  
   void Swap(TestOptionalOptimizedForSize* other);
   
   // implements Message ----------------------------------------------
   
   TestOptionalOptimizedForSize* New() const;
-  int GetCachedSize() const { return _cached_size_; }
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
   private:
   void SharedCtor();
   void SharedDtor();
@@ -260,10 +286,10 @@ class TestOptionalOptimizedForSize : public ::google::protobuf::Message {
   // @@protoc_insertion_point(class_scope:protobuf_unittest.TestOptionalOptimizedForSize)
  private:
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
   
   ::protobuf_unittest::TestRequiredOptimizedForSize* o_;
-  friend void  protobuf_AddDesc_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto();
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto_impl();
   friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto();
   friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto();
   
@@ -315,7 +341,7 @@ inline void TestOptimizedForSize::clear_msg() {
   _clear_bit(1);
 }
 inline const ::protobuf_unittest::ForeignMessage& TestOptimizedForSize::msg() const {
-  return msg_ != NULL ? *msg_ : *default_instance_->msg_;
+  return msg_ != NULL ? *msg_ : ::protobuf_unittest::ForeignMessage::default_instance();
 }
 inline ::protobuf_unittest::ForeignMessage* TestOptimizedForSize::mutable_msg() {
   _set_bit(1);
@@ -356,7 +382,7 @@ inline void TestOptionalOptimizedForSize::clear_o() {
   _clear_bit(0);
 }
 inline const ::protobuf_unittest::TestRequiredOptimizedForSize& TestOptionalOptimizedForSize::o() const {
-  return o_ != NULL ? *o_ : *default_instance_->o_;
+  return o_ != NULL ? *o_ : ::protobuf_unittest::TestRequiredOptimizedForSize::default_instance();
 }
 inline ::protobuf_unittest::TestRequiredOptimizedForSize* TestOptionalOptimizedForSize::mutable_o() {
   _set_bit(0);
@@ -0,0 +1,440 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+
+#define INTERNAL_SUPPRESS_PROTOBUF_FIELD_DEPRECATION
+#include "google/protobuf/unittest_raw_unknown_fields.pb.h"
+#include <google/protobuf/stubs/once.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+
+namespace protobuf_unittest {
+
+namespace {
+
+const ::google::protobuf::Descriptor* TestRawUnknownFields_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  TestRawUnknownFields_reflection_ = NULL;
+
+}  // namespace
+
+
+void protobuf_AssignDesc_google_2fprotobuf_2funittest_5fraw_5funknown_5ffields_2eproto() {
+  protobuf_AddDesc_google_2fprotobuf_2funittest_5fraw_5funknown_5ffields_2eproto();
+  protobuf_InitDefaults_google_2fprotobuf_2funittest_5fraw_5funknown_5ffields_2eproto();
+  const ::google::protobuf::FileDescriptor* file =
+    ::google::protobuf::DescriptorPool::generated_pool()->FindFileByName(
+      "google/protobuf/unittest_raw_unknown_fields.proto");
+  GOOGLE_CHECK(file != NULL);
+  TestRawUnknownFields_descriptor_ = file->message_type(0);
+  static const int TestRawUnknownFields_offsets_[3] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestRawUnknownFields, optional_int32_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestRawUnknownFields, optional_string_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestRawUnknownFields, repeated_int32_),
+  };
+  TestRawUnknownFields_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      TestRawUnknownFields_descriptor_,
+      TestRawUnknownFields::default_instance_,
+      TestRawUnknownFields_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestRawUnknownFields, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestRawUnknownFields, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(TestRawUnknownFields));
+}
+
+namespace {
+
+GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_AssignDescriptors_once_);
+inline void protobuf_AssignDescriptorsOnce() {
+  ::google::protobuf::GoogleOnceInit(&protobuf_AssignDescriptors_once_,
+                 &protobuf_AssignDesc_google_2fprotobuf_2funittest_5fraw_5funknown_5ffields_2eproto);
+}
+
+void protobuf_RegisterTypes(const ::std::string&) {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    TestRawUnknownFields_descriptor_, &TestRawUnknownFields::default_instance());
+}
+
+}  // namespace
+
+void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5fraw_5funknown_5ffields_2eproto() {
+  delete TestRawUnknownFields::default_instance_;
+  delete TestRawUnknownFields_reflection_;
+}
+
+void protobuf_InitDefaults_google_2fprotobuf_2funittest_5fraw_5funknown_5ffields_2eproto_impl() {
+  TestRawUnknownFields::default_instance_ = new TestRawUnknownFields();
+  TestRawUnknownFields::default_instance_->InitAsDefaultInstance();
+  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_google_2fprotobuf_2funittest_5fraw_5funknown_5ffields_2eproto);
+}
+
+namespace {
+
+GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_InitDefaults_once_);
+// Set once the defaults are built, so that default_instance() and the
+// other callers on hot paths can skip the once.
+::google::protobuf::internal::Atomic32 protobuf_InitDefaults_done_ = 0;
+
+}  // namespace
+
+void protobuf_InitDefaults_google_2fprotobuf_2funittest_5fraw_5funknown_5ffields_2eproto() {
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) != 0) {
+    return;
+  }
+  ::google::protobuf::GoogleOnceInit(&protobuf_InitDefaults_once_,
+                 &protobuf_InitDefaults_google_2fprotobuf_2funittest_5fraw_5funknown_5ffields_2eproto_impl);
+  ::google::protobuf::internal::Release_Store(
+      &protobuf_InitDefaults_done_, 1);
+}
+
+void protobuf_AddDesc_google_2fprotobuf_2funittest_5fraw_5funknown_5ffields_2eproto() {
+  static bool already_here = false;
+  if (already_here) return;
+  already_here = true;
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
+    "\n1google/protobuf/unittest_raw_unknown_f"
+    "ields.proto\022\021protobuf_unittest\"_\n\024TestRa"
+    "wUnknownFields\022\026\n\016optional_int32\030\001 \001(\005\022\027"
+    "\n\017optional_string\030\016 \001(\t\022\026\n\016repeated_int3"
+    "2\030\037 \003(\005B\003\210\002\001", 172);
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
+    "google/protobuf/unittest_raw_unknown_fields.proto", &protobuf_RegisterTypes);
+}
+
+// Force AddDescriptors() to be called at static initialization time.
+struct StaticDescriptorInitializer_google_2fprotobuf_2funittest_5fraw_5funknown_5ffields_2eproto {
+  StaticDescriptorInitializer_google_2fprotobuf_2funittest_5fraw_5funknown_5ffields_2eproto() {
+    protobuf_AddDesc_google_2fprotobuf_2funittest_5fraw_5funknown_5ffields_2eproto();
+  }
+} static_descriptor_initializer_google_2fprotobuf_2funittest_5fraw_5funknown_5ffields_2eproto_;
+
+
+// ===================================================================
+
+const ::std::string TestRawUnknownFields::_default_optional_string_;
+#ifndef _MSC_VER
+const int TestRawUnknownFields::kOptionalInt32FieldNumber;
+const int TestRawUnknownFields::kOptionalStringFieldNumber;
+const int TestRawUnknownFields::kRepeatedInt32FieldNumber;
+#endif  // !_MSC_VER
+
+TestRawUnknownFields::TestRawUnknownFields()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+}
+
+void TestRawUnknownFields::InitAsDefaultInstance() {
+}
+
+TestRawUnknownFields::TestRawUnknownFields(const TestRawUnknownFields& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void TestRawUnknownFields::SharedCtor() {
+  _cached_size_ = 0;
+  optional_int32_ = 0;
+  optional_string_ = const_cast< ::std::string*>(&_default_optional_string_);
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  _unknown_fields_.set_raw_storage(true);
+}
+
+TestRawUnknownFields::~TestRawUnknownFields() {
+  SharedDtor();
+}
+
+void TestRawUnknownFields::SharedDtor() {
+  if (optional_string_ != &_default_optional_string_) {
+    delete optional_string_;
+  }
+  if (this != default_instance_) {
+  }
+}
+
+void TestRawUnknownFields::SetCachedSize(int size) const {
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
+}
+const ::google::protobuf::Descriptor* TestRawUnknownFields::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return TestRawUnknownFields_descriptor_;
+}
+
+const TestRawUnknownFields& TestRawUnknownFields::default_instance() {
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5fraw_5funknown_5ffields_2eproto();
+  }
+  return *default_instance_;
+}
+
+TestRawUnknownFields* TestRawUnknownFields::default_instance_ = NULL;
+
+TestRawUnknownFields* TestRawUnknownFields::New() const {
+  return new TestRawUnknownFields;
+}
+
+void TestRawUnknownFields::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    optional_int32_ = 0;
+    if (_has_bit(1)) {
+      if (optional_string_ != &_default_optional_string_) {
+        optional_string_->clear();
+      }
+    }
+  }
+  repeated_int32_.Clear();
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool TestRawUnknownFields::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
+  ::google::protobuf::uint32 tag;
+  while ((tag = input->ReadTag()) != 0) {
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional int32 optional_int32 = 1;
+      case 1: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &optional_int32_)));
+          _set_bit(0);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(114)) goto parse_optional_string;
+        break;
+      }
+      
+      // optional string optional_string = 14;
+      case 14: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_optional_string:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_optional_string()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+            this->optional_string().data(), this->optional_string().length(),
+            ::google::protobuf::internal::WireFormat::PARSE);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(248)) goto parse_repeated_int32;
+        break;
+      }
+      
+      // repeated int32 repeated_int32 = 31;
+      case 31: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_repeated_int32:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 2, 248, input, this->mutable_repeated_int32())));
+        } else if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag)
+                   == ::google::protobuf::internal::WireFormatLite::
+                      WIRETYPE_LENGTH_DELIMITED) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitiveNoInline<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, this->mutable_repeated_int32())));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(248)) goto parse_repeated_int32;
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+      
+      default: {
+      handle_uninterpreted:
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+  return true;
+#undef DO_
+}
+
+void TestRawUnknownFields::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // optional int32 optional_int32 = 1;
+  if (_has_bit(0)) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->optional_int32(), output);
+  }
+  
+  // optional string optional_string = 14;
+  if (_has_bit(1)) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->optional_string().data(), this->optional_string().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      14, this->optional_string(), output);
+  }
+  
+  // repeated int32 repeated_int32 = 31;
+  for (int i = 0; i < this->repeated_int32_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(
+      31, this->repeated_int32(i), output);
+  }
+  
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google::protobuf::uint8* TestRawUnknownFields::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // optional int32 optional_int32 = 1;
+  if (_has_bit(0)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->optional_int32(), target);
+  }
+  
+  // optional string optional_string = 14;
+  if (_has_bit(1)) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->optional_string().data(), this->optional_string().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        14, this->optional_string(), target);
+  }
+  
+  // repeated int32 repeated_int32 = 31;
+  for (int i = 0; i < this->repeated_int32_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteInt32ToArray(31, this->repeated_int32(i), target);
+  }
+  
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int TestRawUnknownFields::ByteSize() const {
+  int total_size = 0;
+  
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // optional int32 optional_int32 = 1;
+    if (has_optional_int32()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->optional_int32());
+    }
+    
+    // optional string optional_string = 14;
+    if (has_optional_string()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->optional_string());
+    }
+    
+  }
+  // repeated int32 repeated_int32 = 31;
+  {
+    int data_size = 0;
+    for (int i = 0; i < this->repeated_int32_size(); i++) {
+      data_size += ::google::protobuf::internal::WireFormatLite::
+        Int32Size(this->repeated_int32(i));
+    }
+    total_size += 2 * this->repeated_int32_size() + data_size;
+  }
+  
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
+  return total_size;
+}
+
+void TestRawUnknownFields::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const TestRawUnknownFields* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const TestRawUnknownFields*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void TestRawUnknownFields::MergeFrom(const TestRawUnknownFields& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  repeated_int32_.MergeFrom(from.repeated_int32_);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from._has_bit(0)) {
+      set_optional_int32(from.optional_int32());
+    }
+    if (from._has_bit(1)) {
+      set_optional_string(from.optional_string());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void TestRawUnknownFields::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void TestRawUnknownFields::CopyFrom(const TestRawUnknownFields& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestRawUnknownFields::IsInitialized() const {
+  
+  return true;
+}
+
+void TestRawUnknownFields::Swap(TestRawUnknownFields* other) {
+  if (other != this) {
+    std::swap(optional_int32_, other->optional_int32_);
+    std::swap(optional_string_, other->optional_string_);
+    repeated_int32_.Swap(&other->repeated_int32_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata TestRawUnknownFields::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = TestRawUnknownFields_descriptor_;
+  metadata.reflection = TestRawUnknownFields_reflection_;
+  return metadata;
+}
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace protobuf_unittest
+
+// @@protoc_insertion_point(global_scope)
@@ -0,0 +1,267 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/unittest_raw_unknown_fields.proto
+
+#ifndef PROTOBUF_google_2fprotobuf_2funittest_5fraw_5funknown_5ffields_2eproto__INCLUDED
+#define PROTOBUF_google_2fprotobuf_2funittest_5fraw_5funknown_5ffields_2eproto__INCLUDED
+
+#include <string>
+
+#include <google/protobuf/stubs/common.h>
+
+#if GOOGLE_PROTOBUF_VERSION < 2003000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers.  Please update
+#error your headers.
+#endif
+#if 2003000 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers.  Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/repeated_field.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/generated_message_reflection.h>
+// @@protoc_insertion_point(includes)
+
+namespace protobuf_unittest {
+
+// Internal implementation detail -- do not call these.
+void  protobuf_AddDesc_google_2fprotobuf_2funittest_5fraw_5funknown_5ffields_2eproto();
+void  protobuf_InitDefaults_google_2fprotobuf_2funittest_5fraw_5funknown_5ffields_2eproto();
+void protobuf_InitDefaults_google_2fprotobuf_2funittest_5fraw_5funknown_5ffields_2eproto_impl();
+void protobuf_AssignDesc_google_2fprotobuf_2funittest_5fraw_5funknown_5ffields_2eproto();
+void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5fraw_5funknown_5ffields_2eproto();
+
+class TestRawUnknownFields;
+
+// ===================================================================
+
+class TestRawUnknownFields : public ::google::protobuf::Message {
+ public:
+  TestRawUnknownFields();
+  virtual ~TestRawUnknownFields();
+  
+  TestRawUnknownFields(const TestRawUnknownFields& from);
+  
+  inline TestRawUnknownFields& operator=(const TestRawUnknownFields& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+  
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+  
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const TestRawUnknownFields& default_instance();
+  
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestRawUnknownFields* internal_default_instance() {
+    return default_instance_;
+  }
+  
+  void Swap(TestRawUnknownFields* other);
+  
+  // implements Message ----------------------------------------------
+  
+  TestRawUnknownFields* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const TestRawUnknownFields& from);
+  void MergeFrom(const TestRawUnknownFields& from);
+  void Clear();
+  bool IsInitialized() const;
+  
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+  
+  ::google::protobuf::Metadata GetMetadata() const;
+  
+  // nested types ----------------------------------------------------
+  
+  // accessors -------------------------------------------------------
+  
+  // optional int32 optional_int32 = 1;
+  inline bool has_optional_int32() const;
+  inline void clear_optional_int32();
+  static const int kOptionalInt32FieldNumber = 1;
+  inline ::google::protobuf::int32 optional_int32() const;
+  inline void set_optional_int32(::google::protobuf::int32 value);
+  
+  // optional string optional_string = 14;
+  inline bool has_optional_string() const;
+  inline void clear_optional_string();
+  static const int kOptionalStringFieldNumber = 14;
+  inline const ::std::string& optional_string() const;
+  inline void set_optional_string(const ::std::string& value);
+  inline void set_optional_string(const char* value);
+  inline void set_optional_string(const char* value, size_t size);
+  inline ::std::string* mutable_optional_string();
+  
+  // repeated int32 repeated_int32 = 31;
+  inline int repeated_int32_size() const;
+  inline void clear_repeated_int32();
+  static const int kRepeatedInt32FieldNumber = 31;
+  inline ::google::protobuf::int32 repeated_int32(int index) const;
+  inline void set_repeated_int32(int index, ::google::protobuf::int32 value);
+  inline void add_repeated_int32(::google::protobuf::int32 value);
+  inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+      repeated_int32() const;
+  inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+      mutable_repeated_int32();
+  
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestRawUnknownFields)
+ private:
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
+  
+  ::google::protobuf::int32 optional_int32_;
+  ::std::string* optional_string_;
+  static const ::std::string _default_optional_string_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int32 > repeated_int32_;
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5fraw_5funknown_5ffields_2eproto_impl();
+  friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5fraw_5funknown_5ffields_2eproto();
+  friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5fraw_5funknown_5ffields_2eproto();
+  
+  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
+  
+  // WHY DOES & HAVE LOWER PRECEDENCE THAN != !?
+  inline bool _has_bit(int index) const {
+    return (_has_bits_[index / 32] & (1u << (index % 32))) != 0;
+  }
+  inline void _set_bit(int index) {
+    _has_bits_[index / 32] |= (1u << (index % 32));
+  }
+  inline void _clear_bit(int index) {
+    _has_bits_[index / 32] &= ~(1u << (index % 32));
+  }
+  
+  void InitAsDefaultInstance();
+  static TestRawUnknownFields* default_instance_;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+// TestRawUnknownFields
+
+// optional int32 optional_int32 = 1;
+inline bool TestRawUnknownFields::has_optional_int32() const {
+  return _has_bit(0);
+}
+inline void TestRawUnknownFields::clear_optional_int32() {
+  optional_int32_ = 0;
+  _clear_bit(0);
+}
+inline ::google::protobuf::int32 TestRawUnknownFields::optional_int32() const {
+  return optional_int32_;
+}
+inline void TestRawUnknownFields::set_optional_int32(::google::protobuf::int32 value) {
+  _set_bit(0);
+  optional_int32_ = value;
+}
+
+// optional string optional_string = 14;
+inline bool TestRawUnknownFields::has_optional_string() const {
+  return _has_bit(1);
+}
+inline void TestRawUnknownFields::clear_optional_string() {
+  if (optional_string_ != &_default_optional_string_) {
+    optional_string_->clear();
+  }
+  _clear_bit(1);
+}
+inline const ::std::string& TestRawUnknownFields::optional_string() const {
+  return *optional_string_;
+}
+inline void TestRawUnknownFields::set_optional_string(const ::std::string& value) {
+  _set_bit(1);
+  if (optional_string_ == &_default_optional_string_) {
+    optional_string_ = new ::std::string;
+  }
+  optional_string_->assign(value);
+}
+inline void TestRawUnknownFields::set_optional_string(const char* value) {
+  _set_bit(1);
+  if (optional_string_ == &_default_optional_string_) {
+    optional_string_ = new ::std::string;
+  }
+  optional_string_->assign(value);
+}
+inline void TestRawUnknownFields::set_optional_string(const char* value, size_t size) {
+  _set_bit(1);
+  if (optional_string_ == &_default_optional_string_) {
+    optional_string_ = new ::std::string;
+  }
+  optional_string_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* TestRawUnknownFields::mutable_optional_string() {
+  _set_bit(1);
+  if (optional_string_ == &_default_optional_string_) {
+    optional_string_ = new ::std::string;
+  }
+  return optional_string_;
+}
+
+// repeated int32 repeated_int32 = 31;
+inline int TestRawUnknownFields::repeated_int32_size() const {
+  return repeated_int32_.size();
+}
+inline void TestRawUnknownFields::clear_repeated_int32() {
+  repeated_int32_.Clear();
+}
+inline ::google::protobuf::int32 TestRawUnknownFields::repeated_int32(int index) const {
+  return repeated_int32_.Get(index);
+}
+inline void TestRawUnknownFields::set_repeated_int32(int index, ::google::protobuf::int32 value) {
+  repeated_int32_.Set(index, value);
+}
+inline void TestRawUnknownFields::add_repeated_int32(::google::protobuf::int32 value) {
+  repeated_int32_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+TestRawUnknownFields::repeated_int32() const {
+  return repeated_int32_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+TestRawUnknownFields::mutable_repeated_int32() {
+  return &repeated_int32_;
+}
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace protobuf_unittest
+
+#ifndef SWIG
+namespace google {
+namespace protobuf {
+
+
+}  // namespace google
+}  // namespace protobuf
+#endif  // SWIG
+
+// @@protoc_insertion_point(global_scope)
+
+#endif  // PROTOBUF_google_2fprotobuf_2funittest_5fraw_5funknown_5ffields_2eproto__INCLUDED
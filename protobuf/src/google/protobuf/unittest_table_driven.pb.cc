@@ -0,0 +1,5747 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+
+#define INTERNAL_SUPPRESS_PROTOBUF_FIELD_DEPRECATION
+#include "google/protobuf/unittest_table_driven.pb.h"
+#include <google/protobuf/stubs/once.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+#include <google/protobuf/generated_message_table_driven.h>
+// @@protoc_insertion_point(includes)
+
+namespace protobuf_unittest {
+
+namespace {
+
+const ::google::protobuf::Descriptor* TestTableDrivenAllTypes_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  TestTableDrivenAllTypes_reflection_ = NULL;
+const ::google::protobuf::Descriptor* TestTableDrivenAllTypes_NestedMessage_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  TestTableDrivenAllTypes_NestedMessage_reflection_ = NULL;
+const ::google::protobuf::Descriptor* TestTableDrivenAllTypes_OptionalGroup_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  TestTableDrivenAllTypes_OptionalGroup_reflection_ = NULL;
+const ::google::protobuf::Descriptor* TestTableDrivenAllTypes_RepeatedGroup_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  TestTableDrivenAllTypes_RepeatedGroup_reflection_ = NULL;
+const ::google::protobuf::EnumDescriptor* TestTableDrivenAllTypes_NestedEnum_descriptor_ = NULL;
+const ::google::protobuf::Descriptor* TestTableDrivenPackedTypes_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  TestTableDrivenPackedTypes_reflection_ = NULL;
+const ::google::protobuf::Descriptor* TestTableDrivenUnpackedTypes_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  TestTableDrivenUnpackedTypes_reflection_ = NULL;
+const ::google::protobuf::Descriptor* TestTableDrivenLazyMessage_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  TestTableDrivenLazyMessage_reflection_ = NULL;
+const ::google::protobuf::Descriptor* TestTableDrivenSparse_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  TestTableDrivenSparse_reflection_ = NULL;
+
+}  // namespace
+
+
+namespace {
+
+const ::google::protobuf::internal::ParseTable* TestTableDrivenAllTypes_parse_table_ = NULL;
+const ::google::protobuf::internal::ParseTable* TestTableDrivenAllTypes_NestedMessage_parse_table_ = NULL;
+const ::google::protobuf::internal::ParseTable* TestTableDrivenAllTypes_OptionalGroup_parse_table_ = NULL;
+const ::google::protobuf::internal::ParseTable* TestTableDrivenAllTypes_RepeatedGroup_parse_table_ = NULL;
+const ::google::protobuf::internal::ParseTable* TestTableDrivenPackedTypes_parse_table_ = NULL;
+const ::google::protobuf::internal::ParseTable* TestTableDrivenUnpackedTypes_parse_table_ = NULL;
+const ::google::protobuf::internal::ParseTable* TestTableDrivenLazyMessage_parse_table_ = NULL;
+const ::google::protobuf::internal::ParseTable* TestTableDrivenSparse_parse_table_ = NULL;
+
+}  // namespace
+
+
+void protobuf_AssignDesc_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto() {
+  protobuf_AddDesc_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto();
+  protobuf_InitDefaults_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto();
+  const ::google::protobuf::FileDescriptor* file =
+    ::google::protobuf::DescriptorPool::generated_pool()->FindFileByName(
+      "google/protobuf/unittest_table_driven.proto");
+  GOOGLE_CHECK(file != NULL);
+  TestTableDrivenAllTypes_descriptor_ = file->message_type(0);
+  static const int TestTableDrivenAllTypes_offsets_[68] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, optional_int32_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, optional_int64_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, optional_uint32_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, optional_uint64_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, optional_sint32_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, optional_sint64_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, optional_fixed32_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, optional_fixed64_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, optional_sfixed32_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, optional_sfixed64_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, optional_float_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, optional_double_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, optional_bool_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, optional_string_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, optional_bytes_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, optionalgroup_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, optional_nested_message_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, optional_foreign_message_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, optional_import_message_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, optional_nested_enum_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, optional_foreign_enum_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, optional_import_enum_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, optional_string_piece_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, optional_cord_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, repeated_int32_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, repeated_int64_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, repeated_uint32_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, repeated_uint64_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, repeated_sint32_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, repeated_sint64_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, repeated_fixed32_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, repeated_fixed64_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, repeated_sfixed32_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, repeated_sfixed64_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, repeated_float_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, repeated_double_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, repeated_bool_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, repeated_string_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, repeated_bytes_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, repeatedgroup_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, repeated_nested_message_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, repeated_foreign_message_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, repeated_import_message_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, repeated_nested_enum_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, repeated_foreign_enum_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, repeated_import_enum_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, repeated_string_piece_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, repeated_cord_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, default_int32_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, default_int64_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, default_uint32_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, default_uint64_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, default_sint32_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, default_sint64_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, default_fixed32_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, default_fixed64_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, default_sfixed32_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, default_sfixed64_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, default_float_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, default_double_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, default_bool_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, default_string_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, default_bytes_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, default_nested_enum_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, default_foreign_enum_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, default_import_enum_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, default_string_piece_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, default_cord_),
+  };
+  TestTableDrivenAllTypes_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      TestTableDrivenAllTypes_descriptor_,
+      TestTableDrivenAllTypes::default_instance_,
+      TestTableDrivenAllTypes_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(TestTableDrivenAllTypes));
+  TestTableDrivenAllTypes_NestedMessage_descriptor_ = TestTableDrivenAllTypes_descriptor_->nested_type(0);
+  static const int TestTableDrivenAllTypes_NestedMessage_offsets_[1] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes_NestedMessage, bb_),
+  };
+  TestTableDrivenAllTypes_NestedMessage_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      TestTableDrivenAllTypes_NestedMessage_descriptor_,
+      TestTableDrivenAllTypes_NestedMessage::default_instance_,
+      TestTableDrivenAllTypes_NestedMessage_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes_NestedMessage, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes_NestedMessage, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(TestTableDrivenAllTypes_NestedMessage));
+  TestTableDrivenAllTypes_OptionalGroup_descriptor_ = TestTableDrivenAllTypes_descriptor_->nested_type(1);
+  static const int TestTableDrivenAllTypes_OptionalGroup_offsets_[1] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes_OptionalGroup, a_),
+  };
+  TestTableDrivenAllTypes_OptionalGroup_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      TestTableDrivenAllTypes_OptionalGroup_descriptor_,
+      TestTableDrivenAllTypes_OptionalGroup::default_instance_,
+      TestTableDrivenAllTypes_OptionalGroup_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes_OptionalGroup, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes_OptionalGroup, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(TestTableDrivenAllTypes_OptionalGroup));
+  TestTableDrivenAllTypes_RepeatedGroup_descriptor_ = TestTableDrivenAllTypes_descriptor_->nested_type(2);
+  static const int TestTableDrivenAllTypes_RepeatedGroup_offsets_[1] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes_RepeatedGroup, a_),
+  };
+  TestTableDrivenAllTypes_RepeatedGroup_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      TestTableDrivenAllTypes_RepeatedGroup_descriptor_,
+      TestTableDrivenAllTypes_RepeatedGroup::default_instance_,
+      TestTableDrivenAllTypes_RepeatedGroup_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes_RepeatedGroup, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes_RepeatedGroup, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(TestTableDrivenAllTypes_RepeatedGroup));
+  TestTableDrivenAllTypes_NestedEnum_descriptor_ = TestTableDrivenAllTypes_descriptor_->enum_type(0);
+  TestTableDrivenPackedTypes_descriptor_ = file->message_type(1);
+  static const int TestTableDrivenPackedTypes_offsets_[14] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenPackedTypes, packed_int32_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenPackedTypes, packed_int64_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenPackedTypes, packed_uint32_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenPackedTypes, packed_uint64_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenPackedTypes, packed_sint32_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenPackedTypes, packed_sint64_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenPackedTypes, packed_fixed32_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenPackedTypes, packed_fixed64_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenPackedTypes, packed_sfixed32_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenPackedTypes, packed_sfixed64_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenPackedTypes, packed_float_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenPackedTypes, packed_double_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenPackedTypes, packed_bool_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenPackedTypes, packed_enum_),
+  };
+  TestTableDrivenPackedTypes_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      TestTableDrivenPackedTypes_descriptor_,
+      TestTableDrivenPackedTypes::default_instance_,
+      TestTableDrivenPackedTypes_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenPackedTypes, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenPackedTypes, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(TestTableDrivenPackedTypes));
+  TestTableDrivenUnpackedTypes_descriptor_ = file->message_type(2);
+  static const int TestTableDrivenUnpackedTypes_offsets_[14] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenUnpackedTypes, unpacked_int32_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenUnpackedTypes, unpacked_int64_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenUnpackedTypes, unpacked_uint32_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenUnpackedTypes, unpacked_uint64_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenUnpackedTypes, unpacked_sint32_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenUnpackedTypes, unpacked_sint64_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenUnpackedTypes, unpacked_fixed32_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenUnpackedTypes, unpacked_fixed64_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenUnpackedTypes, unpacked_sfixed32_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenUnpackedTypes, unpacked_sfixed64_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenUnpackedTypes, unpacked_float_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenUnpackedTypes, unpacked_double_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenUnpackedTypes, unpacked_bool_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenUnpackedTypes, unpacked_enum_),
+  };
+  TestTableDrivenUnpackedTypes_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      TestTableDrivenUnpackedTypes_descriptor_,
+      TestTableDrivenUnpackedTypes::default_instance_,
+      TestTableDrivenUnpackedTypes_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenUnpackedTypes, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenUnpackedTypes, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(TestTableDrivenUnpackedTypes));
+  TestTableDrivenLazyMessage_descriptor_ = file->message_type(3);
+  static const int TestTableDrivenLazyMessage_offsets_[4] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenLazyMessage, id_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenLazyMessage, lazy_child_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenLazyMessage, eager_child_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenLazyMessage, lazy_required_),
+  };
+  TestTableDrivenLazyMessage_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      TestTableDrivenLazyMessage_descriptor_,
+      TestTableDrivenLazyMessage::default_instance_,
+      TestTableDrivenLazyMessage_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenLazyMessage, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenLazyMessage, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(TestTableDrivenLazyMessage));
+  TestTableDrivenSparse_descriptor_ = file->message_type(4);
+  static const int TestTableDrivenSparse_offsets_[3] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenSparse, optional_int32_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenSparse, optional_string_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenSparse, repeated_int32_),
+  };
+  TestTableDrivenSparse_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      TestTableDrivenSparse_descriptor_,
+      TestTableDrivenSparse::default_instance_,
+      TestTableDrivenSparse_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenSparse, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenSparse, _unknown_fields_),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenSparse, _extensions_),
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(TestTableDrivenSparse));
+}
+
+namespace {
+
+GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_AssignDescriptors_once_);
+inline void protobuf_AssignDescriptorsOnce() {
+  ::google::protobuf::GoogleOnceInit(&protobuf_AssignDescriptors_once_,
+                 &protobuf_AssignDesc_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto);
+}
+
+void protobuf_RegisterTypes(const ::std::string&) {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    TestTableDrivenAllTypes_descriptor_, &TestTableDrivenAllTypes::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    TestTableDrivenAllTypes_NestedMessage_descriptor_, &TestTableDrivenAllTypes_NestedMessage::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    TestTableDrivenAllTypes_OptionalGroup_descriptor_, &TestTableDrivenAllTypes_OptionalGroup::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    TestTableDrivenAllTypes_RepeatedGroup_descriptor_, &TestTableDrivenAllTypes_RepeatedGroup::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    TestTableDrivenPackedTypes_descriptor_, &TestTableDrivenPackedTypes::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    TestTableDrivenUnpackedTypes_descriptor_, &TestTableDrivenUnpackedTypes::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    TestTableDrivenLazyMessage_descriptor_, &TestTableDrivenLazyMessage::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    TestTableDrivenSparse_descriptor_, &TestTableDrivenSparse::default_instance());
+}
+
+}  // namespace
+
+void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto() {
+  delete TestTableDrivenAllTypes::default_instance_;
+  delete TestTableDrivenAllTypes_reflection_;
+  delete TestTableDrivenAllTypes_NestedMessage::default_instance_;
+  delete TestTableDrivenAllTypes_NestedMessage_reflection_;
+  delete TestTableDrivenAllTypes_OptionalGroup::default_instance_;
+  delete TestTableDrivenAllTypes_OptionalGroup_reflection_;
+  delete TestTableDrivenAllTypes_RepeatedGroup::default_instance_;
+  delete TestTableDrivenAllTypes_RepeatedGroup_reflection_;
+  delete TestTableDrivenPackedTypes::default_instance_;
+  delete TestTableDrivenPackedTypes_reflection_;
+  delete TestTableDrivenUnpackedTypes::default_instance_;
+  delete TestTableDrivenUnpackedTypes_reflection_;
+  delete TestTableDrivenLazyMessage::default_instance_;
+  delete TestTableDrivenLazyMessage_reflection_;
+  delete TestTableDrivenSparse::default_instance_;
+  delete TestTableDrivenSparse_reflection_;
+}
+
+void protobuf_InitDefaults_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto_impl() {
+  ::protobuf_unittest::protobuf_InitDefaults_google_2fprotobuf_2funittest_2eproto();
+  ::protobuf_unittest_import::protobuf_InitDefaults_google_2fprotobuf_2funittest_5fimport_2eproto();
+  TestTableDrivenAllTypes::default_instance_ = new TestTableDrivenAllTypes();
+  TestTableDrivenAllTypes_NestedMessage::default_instance_ = new TestTableDrivenAllTypes_NestedMessage();
+  TestTableDrivenAllTypes_OptionalGroup::default_instance_ = new TestTableDrivenAllTypes_OptionalGroup();
+  TestTableDrivenAllTypes_RepeatedGroup::default_instance_ = new TestTableDrivenAllTypes_RepeatedGroup();
+  TestTableDrivenPackedTypes::default_instance_ = new TestTableDrivenPackedTypes();
+  TestTableDrivenUnpackedTypes::default_instance_ = new TestTableDrivenUnpackedTypes();
+  TestTableDrivenLazyMessage::default_instance_ = new TestTableDrivenLazyMessage();
+  TestTableDrivenSparse::default_instance_ = new TestTableDrivenSparse();
+  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
+    ::protobuf_unittest::TestTableDrivenSparse::internal_default_instance(),
+    1000, 5, false, false);
+  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
+    ::protobuf_unittest::TestTableDrivenSparse::internal_default_instance(),
+    1001, 9, true, false);
+  ::google::protobuf::internal::ExtensionSet::RegisterMessageExtension(
+    ::protobuf_unittest::TestTableDrivenSparse::internal_default_instance(),
+    1002, 11, false, false,
+    ::protobuf_unittest::TestTableDrivenSparse::internal_default_instance());
+  TestTableDrivenAllTypes::default_instance_->InitAsDefaultInstance();
+  TestTableDrivenAllTypes_NestedMessage::default_instance_->InitAsDefaultInstance();
+  TestTableDrivenAllTypes_OptionalGroup::default_instance_->InitAsDefaultInstance();
+  TestTableDrivenAllTypes_RepeatedGroup::default_instance_->InitAsDefaultInstance();
+  TestTableDrivenPackedTypes::default_instance_->InitAsDefaultInstance();
+  TestTableDrivenUnpackedTypes::default_instance_->InitAsDefaultInstance();
+  TestTableDrivenLazyMessage::default_instance_->InitAsDefaultInstance();
+  TestTableDrivenSparse::default_instance_->InitAsDefaultInstance();
+  static const ::google::protobuf::internal::ParseTableField
+      TestTableDrivenAllTypes_parse_table_fields_[] = {
+    { 8u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, optional_int32_),
+      0, ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 16u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, optional_int64_),
+      1, ::google::protobuf::internal::WireFormatLite::TYPE_INT64,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 24u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, optional_uint32_),
+      2, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 32u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, optional_uint64_),
+      3, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 40u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, optional_sint32_),
+      4, ::google::protobuf::internal::WireFormatLite::TYPE_SINT32,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 48u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, optional_sint64_),
+      5, ::google::protobuf::internal::WireFormatLite::TYPE_SINT64,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 61u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, optional_fixed32_),
+      6, ::google::protobuf::internal::WireFormatLite::TYPE_FIXED32,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 65u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, optional_fixed64_),
+      7, ::google::protobuf::internal::WireFormatLite::TYPE_FIXED64,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 77u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, optional_sfixed32_),
+      8, ::google::protobuf::internal::WireFormatLite::TYPE_SFIXED32,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 81u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, optional_sfixed64_),
+      9, ::google::protobuf::internal::WireFormatLite::TYPE_SFIXED64,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 93u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, optional_float_),
+      10, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 97u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, optional_double_),
+      11, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 104u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, optional_bool_),
+      12, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 114u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, optional_string_),
+      13, ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+      false, false, true, false, false,
+      &TestTableDrivenAllTypes::_default_optional_string_, NULL, NULL,
+      NULL, NULL },
+    { 122u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, optional_bytes_),
+      14, ::google::protobuf::internal::WireFormatLite::TYPE_BYTES,
+      false, false, false, false, false,
+      &TestTableDrivenAllTypes::_default_optional_bytes_, NULL, NULL,
+      NULL, NULL },
+    { 131u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, optionalgroup_),
+      15, ::google::protobuf::internal::WireFormatLite::TYPE_GROUP,
+      false, false, false, false, false,
+      NULL, ::protobuf_unittest::TestTableDrivenAllTypes_OptionalGroup::internal_default_instance(), NULL,
+      NULL, NULL },
+    { 146u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, optional_nested_message_),
+      16, ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE,
+      false, false, false, false, false,
+      NULL, ::protobuf_unittest::TestTableDrivenAllTypes_NestedMessage::internal_default_instance(), NULL,
+      NULL, NULL },
+    { 154u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, optional_foreign_message_),
+      17, ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE,
+      false, false, false, false, false,
+      NULL, ::protobuf_unittest::ForeignMessage::internal_default_instance(), NULL,
+      NULL, NULL },
+    { 162u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, optional_import_message_),
+      18, ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE,
+      false, false, false, false, false,
+      NULL, ::protobuf_unittest_import::ImportMessage::internal_default_instance(), NULL,
+      NULL, NULL },
+    { 168u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, optional_nested_enum_),
+      19, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM,
+      false, false, false, false, false,
+      NULL, NULL, &::protobuf_unittest::TestTableDrivenAllTypes_NestedEnum_IsValid,
+      NULL, NULL },
+    { 176u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, optional_foreign_enum_),
+      20, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM,
+      false, false, false, false, false,
+      NULL, NULL, &protobuf_unittest::ForeignEnum_IsValid,
+      NULL, NULL },
+    { 184u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, optional_import_enum_),
+      21, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM,
+      false, false, false, false, false,
+      NULL, NULL, &protobuf_unittest_import::ImportEnum_IsValid,
+      NULL, NULL },
+    { 194u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, optional_string_piece_),
+      22, ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+      false, false, true, true, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 202u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, optional_cord_),
+      23, ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+      false, false, true, false, false,
+      &TestTableDrivenAllTypes::_default_optional_cord_, NULL, NULL,
+      NULL, NULL },
+    { 248u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, repeated_int32_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      true, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 256u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, repeated_int64_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_INT64,
+      true, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 264u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, repeated_uint32_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32,
+      true, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 272u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, repeated_uint64_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64,
+      true, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 280u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, repeated_sint32_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_SINT32,
+      true, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 288u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, repeated_sint64_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_SINT64,
+      true, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 301u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, repeated_fixed32_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_FIXED32,
+      true, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 305u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, repeated_fixed64_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_FIXED64,
+      true, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 317u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, repeated_sfixed32_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_SFIXED32,
+      true, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 321u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, repeated_sfixed64_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_SFIXED64,
+      true, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 333u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, repeated_float_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT,
+      true, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 337u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, repeated_double_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE,
+      true, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 344u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, repeated_bool_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL,
+      true, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 354u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, repeated_string_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+      true, false, true, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 362u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, repeated_bytes_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_BYTES,
+      true, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 371u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, repeatedgroup_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_GROUP,
+      true, false, false, false, false,
+      NULL, ::protobuf_unittest::TestTableDrivenAllTypes_RepeatedGroup::internal_default_instance(), NULL,
+      NULL, NULL },
+    { 386u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, repeated_nested_message_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE,
+      true, false, false, false, false,
+      NULL, ::protobuf_unittest::TestTableDrivenAllTypes_NestedMessage::internal_default_instance(), NULL,
+      NULL, NULL },
+    { 394u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, repeated_foreign_message_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE,
+      true, false, false, false, false,
+      NULL, ::protobuf_unittest::ForeignMessage::internal_default_instance(), NULL,
+      NULL, NULL },
+    { 402u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, repeated_import_message_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE,
+      true, false, false, false, false,
+      NULL, ::protobuf_unittest_import::ImportMessage::internal_default_instance(), NULL,
+      NULL, NULL },
+    { 408u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, repeated_nested_enum_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM,
+      true, false, false, false, false,
+      NULL, NULL, &::protobuf_unittest::TestTableDrivenAllTypes_NestedEnum_IsValid,
+      NULL, NULL },
+    { 416u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, repeated_foreign_enum_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM,
+      true, false, false, false, false,
+      NULL, NULL, &protobuf_unittest::ForeignEnum_IsValid,
+      NULL, NULL },
+    { 424u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, repeated_import_enum_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM,
+      true, false, false, false, false,
+      NULL, NULL, &protobuf_unittest_import::ImportEnum_IsValid,
+      NULL, NULL },
+    { 434u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, repeated_string_piece_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+      true, false, true, true, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 442u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, repeated_cord_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+      true, false, true, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 488u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, default_int32_),
+      48, ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 496u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, default_int64_),
+      49, ::google::protobuf::internal::WireFormatLite::TYPE_INT64,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 504u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, default_uint32_),
+      50, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 512u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, default_uint64_),
+      51, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 520u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, default_sint32_),
+      52, ::google::protobuf::internal::WireFormatLite::TYPE_SINT32,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 528u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, default_sint64_),
+      53, ::google::protobuf::internal::WireFormatLite::TYPE_SINT64,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 541u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, default_fixed32_),
+      54, ::google::protobuf::internal::WireFormatLite::TYPE_FIXED32,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 545u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, default_fixed64_),
+      55, ::google::protobuf::internal::WireFormatLite::TYPE_FIXED64,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 557u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, default_sfixed32_),
+      56, ::google::protobuf::internal::WireFormatLite::TYPE_SFIXED32,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 561u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, default_sfixed64_),
+      57, ::google::protobuf::internal::WireFormatLite::TYPE_SFIXED64,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 573u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, default_float_),
+      58, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 577u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, default_double_),
+      59, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 584u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, default_bool_),
+      60, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 594u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, default_string_),
+      61, ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+      false, false, true, false, false,
+      &TestTableDrivenAllTypes::_default_default_string_, NULL, NULL,
+      NULL, NULL },
+    { 602u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, default_bytes_),
+      62, ::google::protobuf::internal::WireFormatLite::TYPE_BYTES,
+      false, false, false, false, false,
+      &TestTableDrivenAllTypes::_default_default_bytes_, NULL, NULL,
+      NULL, NULL },
+    { 648u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, default_nested_enum_),
+      63, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM,
+      false, false, false, false, false,
+      NULL, NULL, &::protobuf_unittest::TestTableDrivenAllTypes_NestedEnum_IsValid,
+      NULL, NULL },
+    { 656u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, default_foreign_enum_),
+      64, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM,
+      false, false, false, false, false,
+      NULL, NULL, &protobuf_unittest::ForeignEnum_IsValid,
+      NULL, NULL },
+    { 664u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, default_import_enum_),
+      65, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM,
+      false, false, false, false, false,
+      NULL, NULL, &protobuf_unittest_import::ImportEnum_IsValid,
+      NULL, NULL },
+    { 674u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, default_string_piece_),
+      66, ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+      false, false, true, true, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 682u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, default_cord_),
+      67, ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+      false, false, true, false, false,
+      &TestTableDrivenAllTypes::_default_default_cord_, NULL, NULL,
+      NULL, NULL },
+  };
+  static const ::google::protobuf::internal::ParseTable TestTableDrivenAllTypes_parse_table = {
+    TestTableDrivenAllTypes_parse_table_fields_, 68,
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, _has_bits_[0]),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes, _unknown_fields_),
+    -1,
+    NULL, 0,
+    TestTableDrivenAllTypes::default_instance_,
+  };
+  TestTableDrivenAllTypes_parse_table_ = &TestTableDrivenAllTypes_parse_table;
+  static const ::google::protobuf::internal::ParseTableField
+      TestTableDrivenAllTypes_NestedMessage_parse_table_fields_[] = {
+    { 8u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes_NestedMessage, bb_),
+      0, ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+  };
+  static const ::google::protobuf::internal::ParseTable TestTableDrivenAllTypes_NestedMessage_parse_table = {
+    TestTableDrivenAllTypes_NestedMessage_parse_table_fields_, 1,
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes_NestedMessage, _has_bits_[0]),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes_NestedMessage, _unknown_fields_),
+    -1,
+    NULL, 0,
+    TestTableDrivenAllTypes_NestedMessage::default_instance_,
+  };
+  TestTableDrivenAllTypes_NestedMessage_parse_table_ = &TestTableDrivenAllTypes_NestedMessage_parse_table;
+  static const ::google::protobuf::internal::ParseTableField
+      TestTableDrivenAllTypes_OptionalGroup_parse_table_fields_[] = {
+    { 136u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes_OptionalGroup, a_),
+      0, ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+  };
+  static const ::google::protobuf::internal::ParseTable TestTableDrivenAllTypes_OptionalGroup_parse_table = {
+    TestTableDrivenAllTypes_OptionalGroup_parse_table_fields_, 1,
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes_OptionalGroup, _has_bits_[0]),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes_OptionalGroup, _unknown_fields_),
+    -1,
+    NULL, 0,
+    TestTableDrivenAllTypes_OptionalGroup::default_instance_,
+  };
+  TestTableDrivenAllTypes_OptionalGroup_parse_table_ = &TestTableDrivenAllTypes_OptionalGroup_parse_table;
+  static const ::google::protobuf::internal::ParseTableField
+      TestTableDrivenAllTypes_RepeatedGroup_parse_table_fields_[] = {
+    { 376u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes_RepeatedGroup, a_),
+      0, ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+  };
+  static const ::google::protobuf::internal::ParseTable TestTableDrivenAllTypes_RepeatedGroup_parse_table = {
+    TestTableDrivenAllTypes_RepeatedGroup_parse_table_fields_, 1,
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes_RepeatedGroup, _has_bits_[0]),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypes_RepeatedGroup, _unknown_fields_),
+    -1,
+    NULL, 0,
+    TestTableDrivenAllTypes_RepeatedGroup::default_instance_,
+  };
+  TestTableDrivenAllTypes_RepeatedGroup_parse_table_ = &TestTableDrivenAllTypes_RepeatedGroup_parse_table;
+  static const ::google::protobuf::internal::ParseTableField
+      TestTableDrivenPackedTypes_parse_table_fields_[] = {
+    { 722u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenPackedTypes, packed_int32_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      true, true, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 730u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenPackedTypes, packed_int64_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_INT64,
+      true, true, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 738u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenPackedTypes, packed_uint32_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32,
+      true, true, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 746u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenPackedTypes, packed_uint64_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64,
+      true, true, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 754u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenPackedTypes, packed_sint32_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_SINT32,
+      true, true, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 762u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenPackedTypes, packed_sint64_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_SINT64,
+      true, true, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 770u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenPackedTypes, packed_fixed32_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_FIXED32,
+      true, true, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 778u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenPackedTypes, packed_fixed64_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_FIXED64,
+      true, true, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 786u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenPackedTypes, packed_sfixed32_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_SFIXED32,
+      true, true, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 794u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenPackedTypes, packed_sfixed64_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_SFIXED64,
+      true, true, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 802u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenPackedTypes, packed_float_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT,
+      true, true, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 810u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenPackedTypes, packed_double_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE,
+      true, true, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 818u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenPackedTypes, packed_bool_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL,
+      true, true, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 826u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenPackedTypes, packed_enum_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM,
+      true, true, false, false, false,
+      NULL, NULL, &protobuf_unittest::ForeignEnum_IsValid,
+      NULL, NULL },
+  };
+  static const ::google::protobuf::internal::ParseTable TestTableDrivenPackedTypes_parse_table = {
+    TestTableDrivenPackedTypes_parse_table_fields_, 14,
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenPackedTypes, _has_bits_[0]),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenPackedTypes, _unknown_fields_),
+    -1,
+    NULL, 0,
+    TestTableDrivenPackedTypes::default_instance_,
+  };
+  TestTableDrivenPackedTypes_parse_table_ = &TestTableDrivenPackedTypes_parse_table;
+  static const ::google::protobuf::internal::ParseTableField
+      TestTableDrivenUnpackedTypes_parse_table_fields_[] = {
+    { 720u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenUnpackedTypes, unpacked_int32_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      true, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 728u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenUnpackedTypes, unpacked_int64_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_INT64,
+      true, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 736u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenUnpackedTypes, unpacked_uint32_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32,
+      true, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 744u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenUnpackedTypes, unpacked_uint64_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64,
+      true, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 752u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenUnpackedTypes, unpacked_sint32_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_SINT32,
+      true, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 760u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenUnpackedTypes, unpacked_sint64_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_SINT64,
+      true, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 773u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenUnpackedTypes, unpacked_fixed32_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_FIXED32,
+      true, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 777u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenUnpackedTypes, unpacked_fixed64_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_FIXED64,
+      true, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 789u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenUnpackedTypes, unpacked_sfixed32_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_SFIXED32,
+      true, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 793u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenUnpackedTypes, unpacked_sfixed64_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_SFIXED64,
+      true, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 805u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenUnpackedTypes, unpacked_float_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT,
+      true, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 809u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenUnpackedTypes, unpacked_double_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE,
+      true, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 816u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenUnpackedTypes, unpacked_bool_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL,
+      true, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 824u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenUnpackedTypes, unpacked_enum_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM,
+      true, false, false, false, false,
+      NULL, NULL, &protobuf_unittest::ForeignEnum_IsValid,
+      NULL, NULL },
+  };
+  static const ::google::protobuf::internal::ParseTable TestTableDrivenUnpackedTypes_parse_table = {
+    TestTableDrivenUnpackedTypes_parse_table_fields_, 14,
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenUnpackedTypes, _has_bits_[0]),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenUnpackedTypes, _unknown_fields_),
+    -1,
+    NULL, 0,
+    TestTableDrivenUnpackedTypes::default_instance_,
+  };
+  TestTableDrivenUnpackedTypes_parse_table_ = &TestTableDrivenUnpackedTypes_parse_table;
+  static const ::google::protobuf::internal::ParseTableField
+      TestTableDrivenLazyMessage_parse_table_fields_[] = {
+    { 8u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenLazyMessage, id_),
+      0, ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 18u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenLazyMessage, lazy_child_),
+      1, ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE,
+      false, false, false, false, true,
+      NULL, ::protobuf_unittest::TestAllTypes::internal_default_instance(), NULL,
+      NULL, NULL },
+    { 26u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenLazyMessage, eager_child_),
+      2, ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE,
+      false, false, false, false, false,
+      NULL, ::protobuf_unittest::TestAllTypes::internal_default_instance(), NULL,
+      NULL, NULL },
+    { 34u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenLazyMessage, lazy_required_),
+      3, ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE,
+      false, false, false, false, true,
+      NULL, ::protobuf_unittest::TestRequired::internal_default_instance(), NULL,
+      NULL, NULL },
+  };
+  static const ::google::protobuf::internal::ParseTable TestTableDrivenLazyMessage_parse_table = {
+    TestTableDrivenLazyMessage_parse_table_fields_, 4,
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenLazyMessage, _has_bits_[0]),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenLazyMessage, _unknown_fields_),
+    -1,
+    NULL, 0,
+    TestTableDrivenLazyMessage::default_instance_,
+  };
+  TestTableDrivenLazyMessage_parse_table_ = &TestTableDrivenLazyMessage_parse_table;
+  static const ::google::protobuf::internal::ParseTableField
+      TestTableDrivenSparse_parse_table_fields_[] = {
+    { 8u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenSparse, optional_int32_),
+      0, ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 114u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenSparse, optional_string_),
+      1, ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+      false, false, true, false, false,
+      &TestTableDrivenSparse::_default_optional_string_, NULL, NULL,
+      NULL, NULL },
+    { 248u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenSparse, repeated_int32_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      true, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+  };
+  static const int TestTableDrivenSparse_parse_table_extension_ranges_[] = {
+    1000, 536870912,
+  };
+  static const ::google::protobuf::internal::ParseTable TestTableDrivenSparse_parse_table = {
+    TestTableDrivenSparse_parse_table_fields_, 3,
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenSparse, _has_bits_[0]),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenSparse, _unknown_fields_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenSparse, _extensions_),
+    TestTableDrivenSparse_parse_table_extension_ranges_, 1,
+    TestTableDrivenSparse::default_instance_,
+  };
+  TestTableDrivenSparse_parse_table_ = &TestTableDrivenSparse_parse_table;
+  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto);
+}
+
+namespace {
+
+GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_InitDefaults_once_);
+// Set once the defaults are built, so that default_instance() and the
+// other callers on hot paths can skip the once.
+::google::protobuf::internal::Atomic32 protobuf_InitDefaults_done_ = 0;
+
+}  // namespace
+
+void protobuf_InitDefaults_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto() {
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) != 0) {
+    return;
+  }
+  ::google::protobuf::GoogleOnceInit(&protobuf_InitDefaults_once_,
+                 &protobuf_InitDefaults_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto_impl);
+  ::google::protobuf::internal::Release_Store(
+      &protobuf_InitDefaults_done_, 1);
+}
+
+void protobuf_AddDesc_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto() {
+  static bool already_here = false;
+  if (already_here) return;
+  already_here = true;
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  ::protobuf_unittest::protobuf_AddDesc_google_2fprotobuf_2funittest_2eproto();
+  ::protobuf_unittest_import::protobuf_AddDesc_google_2fprotobuf_2funittest_5fimport_2eproto();
+  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
+    "\n+google/protobuf/unittest_table_driven."
+    "proto\022\021protobuf_unittest\032\036google/protobu"
+    "f/unittest.proto\032%google/protobuf/unitte"
+    "st_import.proto\"\223\026\n\027TestTableDrivenAllTy"
+    "pes\022\026\n\016optional_int32\030\001 \001(\005\022\026\n\016optional_"
+    "int64\030\002 \001(\003\022\027\n\017optional_uint32\030\003 \001(\r\022\027\n\017"
+    "optional_uint64\030\004 \001(\004\022\027\n\017optional_sint32"
+    "\030\005 \001(\021\022\027\n\017optional_sint64\030\006 \001(\022\022\030\n\020optio"
+    "nal_fixed32\030\007 \001(\007\022\030\n\020optional_fixed64\030\010 "
+    "\001(\006\022\031\n\021optional_sfixed32\030\t \001(\017\022\031\n\021option"
+    "al_sfixed64\030\n \001(\020\022\026\n\016optional_float\030\013 \001("
+    "\002\022\027\n\017optional_double\030\014 \001(\001\022\025\n\roptional_b"
+    "ool\030\r \001(\010\022\027\n\017optional_string\030\016 \001(\t\022\026\n\016op"
+    "tional_bytes\030\017 \001(\014\022O\n\roptionalgroup\030\020 \001("
+    "\n28.protobuf_unittest.TestTableDrivenAll"
+    "Types.OptionalGroup\022Y\n\027optional_nested_m"
+    "essage\030\022 \001(\01328.protobuf_unittest.TestTab"
+    "leDrivenAllTypes.NestedMessage\022C\n\030option"
+    "al_foreign_message\030\023 \001(\0132!.protobuf_unit"
+    "test.ForeignMessage\022H\n\027optional_import_m"
+    "essage\030\024 \001(\0132\'.protobuf_unittest_import."
+    "ImportMessage\022S\n\024optional_nested_enum\030\025 "
+    "\001(\01625.protobuf_unittest.TestTableDrivenA"
+    "llTypes.NestedEnum\022=\n\025optional_foreign_e"
+    "num\030\026 \001(\0162\036.protobuf_unittest.ForeignEnu"
+    "m\022B\n\024optional_import_enum\030\027 \001(\0162$.protob"
+    "uf_unittest_import.ImportEnum\022!\n\025optiona"
+    "l_string_piece\030\030 \001(\tB\002\010\002\022\031\n\roptional_cor"
+    "d\030\031 \001(\tB\002\010\001\022\026\n\016repeated_int32\030\037 \003(\005\022\026\n\016r"
+    "epeated_int64\030  \003(\003\022\027\n\017repeated_uint32\030!"
+    " \003(\r\022\027\n\017repeated_uint64\030\" \003(\004\022\027\n\017repeate"
+    "d_sint32\030# \003(\021\022\027\n\017repeated_sint64\030$ \003(\022\022"
+    "\030\n\020repeated_fixed32\030% \003(\007\022\030\n\020repeated_fi"
+    "xed64\030& \003(\006\022\031\n\021repeated_sfixed32\030\' \003(\017\022\031"
+    "\n\021repeated_sfixed64\030( \003(\020\022\026\n\016repeated_fl"
+    "oat\030) \003(\002\022\027\n\017repeated_double\030* \003(\001\022\025\n\rre"
+    "peated_bool\030+ \003(\010\022\027\n\017repeated_string\030, \003"
+    "(\t\022\026\n\016repeated_bytes\030- \003(\014\022O\n\rrepeatedgr"
+    "oup\030. \003(\n28.protobuf_unittest.TestTableD"
+    "rivenAllTypes.RepeatedGroup\022Y\n\027repeated_"
+    "nested_message\0300 \003(\01328.protobuf_unittest"
+    ".TestTableDrivenAllTypes.NestedMessage\022C"
+    "\n\030repeated_foreign_message\0301 \003(\0132!.proto"
+    "buf_unittest.ForeignMessage\022H\n\027repeated_"
+    "import_message\0302 \003(\0132\'.protobuf_unittest"
+    "_import.ImportMessage\022S\n\024repeated_nested"
+    "_enum\0303 \003(\01625.protobuf_unittest.TestTabl"
+    "eDrivenAllTypes.NestedEnum\022=\n\025repeated_f"
+    "oreign_enum\0304 \003(\0162\036.protobuf_unittest.Fo"
+    "reignEnum\022B\n\024repeated_import_enum\0305 \003(\0162"
+    "$.protobuf_unittest_import.ImportEnum\022!\n"
+    "\025repeated_string_piece\0306 \003(\tB\002\010\002\022\031\n\rrepe"
+    "ated_cord\0307 \003(\tB\002\010\001\022\031\n\rdefault_int32\030= \001"
+    "(\005:\00241\022\031\n\rdefault_int64\030> \001(\003:\00242\022\032\n\016def"
+    "ault_uint32\030? \001(\r:\00243\022\032\n\016default_uint64\030"
+    "@ \001(\004:\00244\022\033\n\016default_sint32\030A \001(\021:\003-45\022\032"
+    "\n\016default_sint64\030B \001(\022:\00246\022\033\n\017default_fi"
+    "xed32\030C \001(\007:\00247\022\033\n\017default_fixed64\030D \001(\006"
+    ":\00248\022\034\n\020default_sfixed32\030E \001(\017:\00249\022\035\n\020de"
+    "fault_sfixed64\030F \001(\020:\003-50\022\033\n\rdefault_flo"
+    "at\030G \001(\002:\00451.5\022\035\n\016default_double\030H \001(\001:\005"
+    "52000\022\032\n\014default_bool\030I \001(\010:\004true\022\035\n\016def"
+    "ault_string\030J \001(\t:\005hello\022\034\n\rdefault_byte"
+    "s\030K \001(\014:\005world\022W\n\023default_nested_enum\030Q "
+    "\001(\01625.protobuf_unittest.TestTableDrivenA"
+    "llTypes.NestedEnum:\003BAR\022I\n\024default_forei"
+    "gn_enum\030R \001(\0162\036.protobuf_unittest.Foreig"
+    "nEnum:\013FOREIGN_BAR\022M\n\023default_import_enu"
+    "m\030S \001(\0162$.protobuf_unittest_import.Impor"
+    "tEnum:\nIMPORT_BAR\022%\n\024default_string_piec"
+    "e\030T \001(\t:\003abcB\002\010\002\022\035\n\014default_cord\030U \001(\t:\003"
+    "123B\002\010\001\032\033\n\rNestedMessage\022\n\n\002bb\030\001 \001(\005\032\032\n\r"
+    "OptionalGroup\022\t\n\001a\030\021 \001(\005\032\032\n\rRepeatedGrou"
+    "p\022\t\n\001a\030/ \001(\005\"\'\n\nNestedEnum\022\007\n\003FOO\020\001\022\007\n\003B"
+    "AR\020\002\022\007\n\003BAZ\020\003\"\265\003\n\032TestTableDrivenPackedT"
+    "ypes\022\030\n\014packed_int32\030Z \003(\005B\002\020\001\022\030\n\014packed"
+    "_int64\030[ \003(\003B\002\020\001\022\031\n\rpacked_uint32\030\\ \003(\rB"
+    "\002\020\001\022\031\n\rpacked_uint64\030] \003(\004B\002\020\001\022\031\n\rpacked"
+    "_sint32\030^ \003(\021B\002\020\001\022\031\n\rpacked_sint64\030_ \003(\022"
+    "B\002\020\001\022\032\n\016packed_fixed32\030` \003(\007B\002\020\001\022\032\n\016pack"
+    "ed_fixed64\030a \003(\006B\002\020\001\022\033\n\017packed_sfixed32\030"
+    "b \003(\017B\002\020\001\022\033\n\017packed_sfixed64\030c \003(\020B\002\020\001\022\030"
+    "\n\014packed_float\030d \003(\002B\002\020\001\022\031\n\rpacked_doubl"
+    "e\030e \003(\001B\002\020\001\022\027\n\013packed_bool\030f \003(\010B\002\020\001\0227\n\013"
+    "packed_enum\030g \003(\0162\036.protobuf_unittest.Fo"
+    "reignEnumB\002\020\001\"\323\003\n\034TestTableDrivenUnpacke"
+    "dTypes\022\032\n\016unpacked_int32\030Z \003(\005B\002\020\000\022\032\n\016un"
+    "packed_int64\030[ \003(\003B\002\020\000\022\033\n\017unpacked_uint3"
+    "2\030\\ \003(\rB\002\020\000\022\033\n\017unpacked_uint64\030] \003(\004B\002\020\000"
+    "\022\033\n\017unpacked_sint32\030^ \003(\021B\002\020\000\022\033\n\017unpacke"
+    "d_sint64\030_ \003(\022B\002\020\000\022\034\n\020unpacked_fixed32\030`"
+    " \003(\007B\002\020\000\022\034\n\020unpacked_fixed64\030a \003(\006B\002\020\000\022\035"
+    "\n\021unpacked_sfixed32\030b \003(\017B\002\020\000\022\035\n\021unpacke"
+    "d_sfixed64\030c \003(\020B\002\020\000\022\032\n\016unpacked_float\030d"
+    " \003(\002B\002\020\000\022\033\n\017unpacked_double\030e \003(\001B\002\020\000\022\031\n"
+    "\runpacked_bool\030f \003(\010B\002\020\000\0229\n\runpacked_enu"
+    "m\030g \003(\0162\036.protobuf_unittest.ForeignEnumB"
+    "\002\020\000\"\323\001\n\032TestTableDrivenLazyMessage\022\n\n\002id"
+    "\030\001 \001(\005\0227\n\nlazy_child\030\002 \001(\0132\037.protobuf_un"
+    "ittest.TestAllTypesB\002(\001\0224\n\013eager_child\030\003"
+    " \001(\0132\037.protobuf_unittest.TestAllTypes\022:\n"
+    "\rlazy_required\030\004 \001(\0132\037.protobuf_unittest"
+    ".TestRequiredB\002(\001\"k\n\025TestTableDrivenSpar"
+    "se\022\026\n\016optional_int32\030\001 \001(\005\022\027\n\017optional_s"
+    "tring\030\016 \001(\t\022\026\n\016repeated_int32\030\037 \003(\005*\t\010\350\007"
+    "\020\200\200\200\200\002:I\n\026sparse_int32_extension\022(.proto"
+    "buf_unittest.TestTableDrivenSparse\030\350\007 \001("
+    "\005:J\n\027sparse_string_extension\022(.protobuf_"
+    "unittest.TestTableDrivenSparse\030\351\007 \003(\t:u\n"
+    "\030sparse_message_extension\022(.protobuf_uni"
+    "ttest.TestTableDrivenSparse\030\352\007 \001(\0132(.pro"
+    "tobuf_unittest.TestTableDrivenSparseB\006\370\001"
+    "\001\200\002\001", 4484);
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
+    "google/protobuf/unittest_table_driven.proto", &protobuf_RegisterTypes);
+  ::google::protobuf::internal::ExtensionSet::RegisterDeferredExtensions(
+    &protobuf_InitDefaults_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto);
+}
+
+// Force AddDescriptors() to be called at static initialization time.
+struct StaticDescriptorInitializer_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto {
+  StaticDescriptorInitializer_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto() {
+    protobuf_AddDesc_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto();
+  }
+} static_descriptor_initializer_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto_;
+
+
+// ===================================================================
+
+const ::google::protobuf::EnumDescriptor* TestTableDrivenAllTypes_NestedEnum_descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return TestTableDrivenAllTypes_NestedEnum_descriptor_;
+}
+bool TestTableDrivenAllTypes_NestedEnum_IsValid(int value) {
+  switch(value) {
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#ifndef _MSC_VER
+const TestTableDrivenAllTypes_NestedEnum TestTableDrivenAllTypes::FOO;
+const TestTableDrivenAllTypes_NestedEnum TestTableDrivenAllTypes::BAR;
+const TestTableDrivenAllTypes_NestedEnum TestTableDrivenAllTypes::BAZ;
+const TestTableDrivenAllTypes_NestedEnum TestTableDrivenAllTypes::NestedEnum_MIN;
+const TestTableDrivenAllTypes_NestedEnum TestTableDrivenAllTypes::NestedEnum_MAX;
+const int TestTableDrivenAllTypes::NestedEnum_ARRAYSIZE;
+#endif  // _MSC_VER
+#ifndef _MSC_VER
+const int TestTableDrivenAllTypes_NestedMessage::kBbFieldNumber;
+#endif  // !_MSC_VER
+
+TestTableDrivenAllTypes_NestedMessage::TestTableDrivenAllTypes_NestedMessage()
+  : ::google::protobuf::Message(),
+    _arena_(NULL) {
+  SharedCtor();
+}
+
+TestTableDrivenAllTypes_NestedMessage::TestTableDrivenAllTypes_NestedMessage(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+    _arena_(arena) {
+  SharedCtor();
+}
+
+void TestTableDrivenAllTypes_NestedMessage::InitAsDefaultInstance() {
+}
+
+TestTableDrivenAllTypes_NestedMessage::TestTableDrivenAllTypes_NestedMessage(const TestTableDrivenAllTypes_NestedMessage& from)
+  : ::google::protobuf::Message(),
+    _arena_(NULL) {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void TestTableDrivenAllTypes_NestedMessage::SharedCtor() {
+  _cached_size_ = 0;
+  bb_ = 0;
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+TestTableDrivenAllTypes_NestedMessage::~TestTableDrivenAllTypes_NestedMessage() {
+  SharedDtor();
+}
+
+void TestTableDrivenAllTypes_NestedMessage::SharedDtor() {
+  if (_arena_ != NULL) return;
+  if (this != default_instance_) {
+  }
+}
+
+void TestTableDrivenAllTypes_NestedMessage::SetCachedSize(int size) const {
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
+}
+const ::google::protobuf::Descriptor* TestTableDrivenAllTypes_NestedMessage::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return TestTableDrivenAllTypes_NestedMessage_descriptor_;
+}
+
+const TestTableDrivenAllTypes_NestedMessage& TestTableDrivenAllTypes_NestedMessage::default_instance() {
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto();
+  }
+  return *default_instance_;
+}
+
+TestTableDrivenAllTypes_NestedMessage* TestTableDrivenAllTypes_NestedMessage::default_instance_ = NULL;
+
+TestTableDrivenAllTypes_NestedMessage* TestTableDrivenAllTypes_NestedMessage::New() const {
+  return new TestTableDrivenAllTypes_NestedMessage;
+}
+
+TestTableDrivenAllTypes_NestedMessage* TestTableDrivenAllTypes_NestedMessage::NewOnArena(
+    ::google::protobuf::Arena* arena) const {
+  return ::google::protobuf::Arena::CreateMessage<TestTableDrivenAllTypes_NestedMessage>(arena);
+}
+
+void TestTableDrivenAllTypes_NestedMessage::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    bb_ = 0;
+  }
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool TestTableDrivenAllTypes_NestedMessage::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto();
+  }
+  return ::google::protobuf::internal::MergePartialFromCodedStream(
+      this, *TestTableDrivenAllTypes_NestedMessage_parse_table_, input);
+}
+
+void TestTableDrivenAllTypes_NestedMessage::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // optional int32 bb = 1;
+  if (_has_bit(0)) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->bb(), output);
+  }
+  
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google::protobuf::uint8* TestTableDrivenAllTypes_NestedMessage::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // optional int32 bb = 1;
+  if (_has_bit(0)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->bb(), target);
+  }
+  
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int TestTableDrivenAllTypes_NestedMessage::ByteSize() const {
+  int total_size = 0;
+  
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // optional int32 bb = 1;
+    if (has_bb()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->bb());
+    }
+    
+  }
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
+  return total_size;
+}
+
+void TestTableDrivenAllTypes_NestedMessage::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const TestTableDrivenAllTypes_NestedMessage* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const TestTableDrivenAllTypes_NestedMessage*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void TestTableDrivenAllTypes_NestedMessage::MergeFrom(const TestTableDrivenAllTypes_NestedMessage& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from._has_bit(0)) {
+      set_bb(from.bb());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void TestTableDrivenAllTypes_NestedMessage::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void TestTableDrivenAllTypes_NestedMessage::CopyFrom(const TestTableDrivenAllTypes_NestedMessage& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestTableDrivenAllTypes_NestedMessage::IsInitialized() const {
+  
+  return true;
+}
+
+void TestTableDrivenAllTypes_NestedMessage::Swap(TestTableDrivenAllTypes_NestedMessage* other) {
+  if (other != this) {
+    if (GetArena() != other->GetArena()) {
+      TestTableDrivenAllTypes_NestedMessage temp;
+      temp.MergeFrom(*this);
+      CopyFrom(*other);
+      other->CopyFrom(temp);
+      return;
+    }
+    std::swap(bb_, other->bb_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata TestTableDrivenAllTypes_NestedMessage::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = TestTableDrivenAllTypes_NestedMessage_descriptor_;
+  metadata.reflection = TestTableDrivenAllTypes_NestedMessage_reflection_;
+  return metadata;
+}
+
+
+// -------------------------------------------------------------------
+
+#ifndef _MSC_VER
+const int TestTableDrivenAllTypes_OptionalGroup::kAFieldNumber;
+#endif  // !_MSC_VER
+
+TestTableDrivenAllTypes_OptionalGroup::TestTableDrivenAllTypes_OptionalGroup()
+  : ::google::protobuf::Message(),
+    _arena_(NULL) {
+  SharedCtor();
+}
+
+TestTableDrivenAllTypes_OptionalGroup::TestTableDrivenAllTypes_OptionalGroup(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+    _arena_(arena) {
+  SharedCtor();
+}
+
+void TestTableDrivenAllTypes_OptionalGroup::InitAsDefaultInstance() {
+}
+
+TestTableDrivenAllTypes_OptionalGroup::TestTableDrivenAllTypes_OptionalGroup(const TestTableDrivenAllTypes_OptionalGroup& from)
+  : ::google::protobuf::Message(),
+    _arena_(NULL) {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void TestTableDrivenAllTypes_OptionalGroup::SharedCtor() {
+  _cached_size_ = 0;
+  a_ = 0;
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+TestTableDrivenAllTypes_OptionalGroup::~TestTableDrivenAllTypes_OptionalGroup() {
+  SharedDtor();
+}
+
+void TestTableDrivenAllTypes_OptionalGroup::SharedDtor() {
+  if (_arena_ != NULL) return;
+  if (this != default_instance_) {
+  }
+}
+
+void TestTableDrivenAllTypes_OptionalGroup::SetCachedSize(int size) const {
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
+}
+const ::google::protobuf::Descriptor* TestTableDrivenAllTypes_OptionalGroup::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return TestTableDrivenAllTypes_OptionalGroup_descriptor_;
+}
+
+const TestTableDrivenAllTypes_OptionalGroup& TestTableDrivenAllTypes_OptionalGroup::default_instance() {
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto();
+  }
+  return *default_instance_;
+}
+
+TestTableDrivenAllTypes_OptionalGroup* TestTableDrivenAllTypes_OptionalGroup::default_instance_ = NULL;
+
+TestTableDrivenAllTypes_OptionalGroup* TestTableDrivenAllTypes_OptionalGroup::New() const {
+  return new TestTableDrivenAllTypes_OptionalGroup;
+}
+
+TestTableDrivenAllTypes_OptionalGroup* TestTableDrivenAllTypes_OptionalGroup::NewOnArena(
+    ::google::protobuf::Arena* arena) const {
+  return ::google::protobuf::Arena::CreateMessage<TestTableDrivenAllTypes_OptionalGroup>(arena);
+}
+
+void TestTableDrivenAllTypes_OptionalGroup::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    a_ = 0;
+  }
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool TestTableDrivenAllTypes_OptionalGroup::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto();
+  }
+  return ::google::protobuf::internal::MergePartialFromCodedStream(
+      this, *TestTableDrivenAllTypes_OptionalGroup_parse_table_, input);
+}
+
+void TestTableDrivenAllTypes_OptionalGroup::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // optional int32 a = 17;
+  if (_has_bit(0)) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(17, this->a(), output);
+  }
+  
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google::protobuf::uint8* TestTableDrivenAllTypes_OptionalGroup::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // optional int32 a = 17;
+  if (_has_bit(0)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(17, this->a(), target);
+  }
+  
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int TestTableDrivenAllTypes_OptionalGroup::ByteSize() const {
+  int total_size = 0;
+  
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // optional int32 a = 17;
+    if (has_a()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->a());
+    }
+    
+  }
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
+  return total_size;
+}
+
+void TestTableDrivenAllTypes_OptionalGroup::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const TestTableDrivenAllTypes_OptionalGroup* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const TestTableDrivenAllTypes_OptionalGroup*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void TestTableDrivenAllTypes_OptionalGroup::MergeFrom(const TestTableDrivenAllTypes_OptionalGroup& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from._has_bit(0)) {
+      set_a(from.a());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void TestTableDrivenAllTypes_OptionalGroup::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void TestTableDrivenAllTypes_OptionalGroup::CopyFrom(const TestTableDrivenAllTypes_OptionalGroup& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestTableDrivenAllTypes_OptionalGroup::IsInitialized() const {
+  
+  return true;
+}
+
+void TestTableDrivenAllTypes_OptionalGroup::Swap(TestTableDrivenAllTypes_OptionalGroup* other) {
+  if (other != this) {
+    if (GetArena() != other->GetArena()) {
+      TestTableDrivenAllTypes_OptionalGroup temp;
+      temp.MergeFrom(*this);
+      CopyFrom(*other);
+      other->CopyFrom(temp);
+      return;
+    }
+    std::swap(a_, other->a_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata TestTableDrivenAllTypes_OptionalGroup::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = TestTableDrivenAllTypes_OptionalGroup_descriptor_;
+  metadata.reflection = TestTableDrivenAllTypes_OptionalGroup_reflection_;
+  return metadata;
+}
+
+
+// -------------------------------------------------------------------
+
+#ifndef _MSC_VER
+const int TestTableDrivenAllTypes_RepeatedGroup::kAFieldNumber;
+#endif  // !_MSC_VER
+
+TestTableDrivenAllTypes_RepeatedGroup::TestTableDrivenAllTypes_RepeatedGroup()
+  : ::google::protobuf::Message(),
+    _arena_(NULL) {
+  SharedCtor();
+}
+
+TestTableDrivenAllTypes_RepeatedGroup::TestTableDrivenAllTypes_RepeatedGroup(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+    _arena_(arena) {
+  SharedCtor();
+}
+
+void TestTableDrivenAllTypes_RepeatedGroup::InitAsDefaultInstance() {
+}
+
+TestTableDrivenAllTypes_RepeatedGroup::TestTableDrivenAllTypes_RepeatedGroup(const TestTableDrivenAllTypes_RepeatedGroup& from)
+  : ::google::protobuf::Message(),
+    _arena_(NULL) {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void TestTableDrivenAllTypes_RepeatedGroup::SharedCtor() {
+  _cached_size_ = 0;
+  a_ = 0;
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+TestTableDrivenAllTypes_RepeatedGroup::~TestTableDrivenAllTypes_RepeatedGroup() {
+  SharedDtor();
+}
+
+void TestTableDrivenAllTypes_RepeatedGroup::SharedDtor() {
+  if (_arena_ != NULL) return;
+  if (this != default_instance_) {
+  }
+}
+
+void TestTableDrivenAllTypes_RepeatedGroup::SetCachedSize(int size) const {
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
+}
+const ::google::protobuf::Descriptor* TestTableDrivenAllTypes_RepeatedGroup::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return TestTableDrivenAllTypes_RepeatedGroup_descriptor_;
+}
+
+const TestTableDrivenAllTypes_RepeatedGroup& TestTableDrivenAllTypes_RepeatedGroup::default_instance() {
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto();
+  }
+  return *default_instance_;
+}
+
+TestTableDrivenAllTypes_RepeatedGroup* TestTableDrivenAllTypes_RepeatedGroup::default_instance_ = NULL;
+
+TestTableDrivenAllTypes_RepeatedGroup* TestTableDrivenAllTypes_RepeatedGroup::New() const {
+  return new TestTableDrivenAllTypes_RepeatedGroup;
+}
+
+TestTableDrivenAllTypes_RepeatedGroup* TestTableDrivenAllTypes_RepeatedGroup::NewOnArena(
+    ::google::protobuf::Arena* arena) const {
+  return ::google::protobuf::Arena::CreateMessage<TestTableDrivenAllTypes_RepeatedGroup>(arena);
+}
+
+void TestTableDrivenAllTypes_RepeatedGroup::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    a_ = 0;
+  }
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool TestTableDrivenAllTypes_RepeatedGroup::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto();
+  }
+  return ::google::protobuf::internal::MergePartialFromCodedStream(
+      this, *TestTableDrivenAllTypes_RepeatedGroup_parse_table_, input);
+}
+
+void TestTableDrivenAllTypes_RepeatedGroup::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // optional int32 a = 47;
+  if (_has_bit(0)) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(47, this->a(), output);
+  }
+  
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google::protobuf::uint8* TestTableDrivenAllTypes_RepeatedGroup::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // optional int32 a = 47;
+  if (_has_bit(0)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(47, this->a(), target);
+  }
+  
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int TestTableDrivenAllTypes_RepeatedGroup::ByteSize() const {
+  int total_size = 0;
+  
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // optional int32 a = 47;
+    if (has_a()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->a());
+    }
+    
+  }
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
+  return total_size;
+}
+
+void TestTableDrivenAllTypes_RepeatedGroup::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const TestTableDrivenAllTypes_RepeatedGroup* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const TestTableDrivenAllTypes_RepeatedGroup*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void TestTableDrivenAllTypes_RepeatedGroup::MergeFrom(const TestTableDrivenAllTypes_RepeatedGroup& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from._has_bit(0)) {
+      set_a(from.a());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void TestTableDrivenAllTypes_RepeatedGroup::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void TestTableDrivenAllTypes_RepeatedGroup::CopyFrom(const TestTableDrivenAllTypes_RepeatedGroup& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestTableDrivenAllTypes_RepeatedGroup::IsInitialized() const {
+  
+  return true;
+}
+
+void TestTableDrivenAllTypes_RepeatedGroup::Swap(TestTableDrivenAllTypes_RepeatedGroup* other) {
+  if (other != this) {
+    if (GetArena() != other->GetArena()) {
+      TestTableDrivenAllTypes_RepeatedGroup temp;
+      temp.MergeFrom(*this);
+      CopyFrom(*other);
+      other->CopyFrom(temp);
+      return;
+    }
+    std::swap(a_, other->a_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata TestTableDrivenAllTypes_RepeatedGroup::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = TestTableDrivenAllTypes_RepeatedGroup_descriptor_;
+  metadata.reflection = TestTableDrivenAllTypes_RepeatedGroup_reflection_;
+  return metadata;
+}
+
+
+// -------------------------------------------------------------------
+
+const ::std::string TestTableDrivenAllTypes::_default_optional_string_;
+const ::std::string TestTableDrivenAllTypes::_default_optional_bytes_;
+const ::std::string TestTableDrivenAllTypes::_default_optional_cord_;
+const ::std::string TestTableDrivenAllTypes::_default_default_string_("hello");
+const ::std::string TestTableDrivenAllTypes::_default_default_bytes_("world");
+const ::std::string TestTableDrivenAllTypes::_default_default_cord_("123");
+#ifndef _MSC_VER
+const int TestTableDrivenAllTypes::kOptionalInt32FieldNumber;
+const int TestTableDrivenAllTypes::kOptionalInt64FieldNumber;
+const int TestTableDrivenAllTypes::kOptionalUint32FieldNumber;
+const int TestTableDrivenAllTypes::kOptionalUint64FieldNumber;
+const int TestTableDrivenAllTypes::kOptionalSint32FieldNumber;
+const int TestTableDrivenAllTypes::kOptionalSint64FieldNumber;
+const int TestTableDrivenAllTypes::kOptionalFixed32FieldNumber;
+const int TestTableDrivenAllTypes::kOptionalFixed64FieldNumber;
+const int TestTableDrivenAllTypes::kOptionalSfixed32FieldNumber;
+const int TestTableDrivenAllTypes::kOptionalSfixed64FieldNumber;
+const int TestTableDrivenAllTypes::kOptionalFloatFieldNumber;
+const int TestTableDrivenAllTypes::kOptionalDoubleFieldNumber;
+const int TestTableDrivenAllTypes::kOptionalBoolFieldNumber;
+const int TestTableDrivenAllTypes::kOptionalStringFieldNumber;
+const int TestTableDrivenAllTypes::kOptionalBytesFieldNumber;
+const int TestTableDrivenAllTypes::kOptionalgroupFieldNumber;
+const int TestTableDrivenAllTypes::kOptionalNestedMessageFieldNumber;
+const int TestTableDrivenAllTypes::kOptionalForeignMessageFieldNumber;
+const int TestTableDrivenAllTypes::kOptionalImportMessageFieldNumber;
+const int TestTableDrivenAllTypes::kOptionalNestedEnumFieldNumber;
+const int TestTableDrivenAllTypes::kOptionalForeignEnumFieldNumber;
+const int TestTableDrivenAllTypes::kOptionalImportEnumFieldNumber;
+const int TestTableDrivenAllTypes::kOptionalStringPieceFieldNumber;
+const int TestTableDrivenAllTypes::kOptionalCordFieldNumber;
+const int TestTableDrivenAllTypes::kRepeatedInt32FieldNumber;
+const int TestTableDrivenAllTypes::kRepeatedInt64FieldNumber;
+const int TestTableDrivenAllTypes::kRepeatedUint32FieldNumber;
+const int TestTableDrivenAllTypes::kRepeatedUint64FieldNumber;
+const int TestTableDrivenAllTypes::kRepeatedSint32FieldNumber;
+const int TestTableDrivenAllTypes::kRepeatedSint64FieldNumber;
+const int TestTableDrivenAllTypes::kRepeatedFixed32FieldNumber;
+const int TestTableDrivenAllTypes::kRepeatedFixed64FieldNumber;
+const int TestTableDrivenAllTypes::kRepeatedSfixed32FieldNumber;
+const int TestTableDrivenAllTypes::kRepeatedSfixed64FieldNumber;
+const int TestTableDrivenAllTypes::kRepeatedFloatFieldNumber;
+const int TestTableDrivenAllTypes::kRepeatedDoubleFieldNumber;
+const int TestTableDrivenAllTypes::kRepeatedBoolFieldNumber;
+const int TestTableDrivenAllTypes::kRepeatedStringFieldNumber;
+const int TestTableDrivenAllTypes::kRepeatedBytesFieldNumber;
+const int TestTableDrivenAllTypes::kRepeatedgroupFieldNumber;
+const int TestTableDrivenAllTypes::kRepeatedNestedMessageFieldNumber;
+const int TestTableDrivenAllTypes::kRepeatedForeignMessageFieldNumber;
+const int TestTableDrivenAllTypes::kRepeatedImportMessageFieldNumber;
+const int TestTableDrivenAllTypes::kRepeatedNestedEnumFieldNumber;
+const int TestTableDrivenAllTypes::kRepeatedForeignEnumFieldNumber;
+const int TestTableDrivenAllTypes::kRepeatedImportEnumFieldNumber;
+const int TestTableDrivenAllTypes::kRepeatedStringPieceFieldNumber;
+const int TestTableDrivenAllTypes::kRepeatedCordFieldNumber;
+const int TestTableDrivenAllTypes::kDefaultInt32FieldNumber;
+const int TestTableDrivenAllTypes::kDefaultInt64FieldNumber;
+const int TestTableDrivenAllTypes::kDefaultUint32FieldNumber;
+const int TestTableDrivenAllTypes::kDefaultUint64FieldNumber;
+const int TestTableDrivenAllTypes::kDefaultSint32FieldNumber;
+const int TestTableDrivenAllTypes::kDefaultSint64FieldNumber;
+const int TestTableDrivenAllTypes::kDefaultFixed32FieldNumber;
+const int TestTableDrivenAllTypes::kDefaultFixed64FieldNumber;
+const int TestTableDrivenAllTypes::kDefaultSfixed32FieldNumber;
+const int TestTableDrivenAllTypes::kDefaultSfixed64FieldNumber;
+const int TestTableDrivenAllTypes::kDefaultFloatFieldNumber;
+const int TestTableDrivenAllTypes::kDefaultDoubleFieldNumber;
+const int TestTableDrivenAllTypes::kDefaultBoolFieldNumber;
+const int TestTableDrivenAllTypes::kDefaultStringFieldNumber;
+const int TestTableDrivenAllTypes::kDefaultBytesFieldNumber;
+const int TestTableDrivenAllTypes::kDefaultNestedEnumFieldNumber;
+const int TestTableDrivenAllTypes::kDefaultForeignEnumFieldNumber;
+const int TestTableDrivenAllTypes::kDefaultImportEnumFieldNumber;
+const int TestTableDrivenAllTypes::kDefaultStringPieceFieldNumber;
+const int TestTableDrivenAllTypes::kDefaultCordFieldNumber;
+#endif  // !_MSC_VER
+
+TestTableDrivenAllTypes::TestTableDrivenAllTypes()
+  : ::google::protobuf::Message(),
+    _arena_(NULL) {
+  SharedCtor();
+}
+
+TestTableDrivenAllTypes::TestTableDrivenAllTypes(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+    _arena_(arena),
+    repeated_int32_(arena),
+    repeated_int64_(arena),
+    repeated_uint32_(arena),
+    repeated_uint64_(arena),
+    repeated_sint32_(arena),
+    repeated_sint64_(arena),
+    repeated_fixed32_(arena),
+    repeated_fixed64_(arena),
+    repeated_sfixed32_(arena),
+    repeated_sfixed64_(arena),
+    repeated_float_(arena),
+    repeated_double_(arena),
+    repeated_bool_(arena),
+    repeated_string_(arena),
+    repeated_bytes_(arena),
+    repeatedgroup_(arena),
+    repeated_nested_message_(arena),
+    repeated_foreign_message_(arena),
+    repeated_import_message_(arena),
+    repeated_nested_enum_(arena),
+    repeated_foreign_enum_(arena),
+    repeated_import_enum_(arena),
+    repeated_string_piece_(arena),
+    repeated_cord_(arena) {
+  SharedCtor();
+}
+
+void TestTableDrivenAllTypes::InitAsDefaultInstance() {
+  optionalgroup_ = const_cast< ::protobuf_unittest::TestTableDrivenAllTypes_OptionalGroup*>(
+      ::protobuf_unittest::TestTableDrivenAllTypes_OptionalGroup::internal_default_instance());
+  optional_nested_message_ = const_cast< ::protobuf_unittest::TestTableDrivenAllTypes_NestedMessage*>(
+      ::protobuf_unittest::TestTableDrivenAllTypes_NestedMessage::internal_default_instance());
+  optional_foreign_message_ = const_cast< ::protobuf_unittest::ForeignMessage*>(
+      ::protobuf_unittest::ForeignMessage::internal_default_instance());
+  optional_import_message_ = const_cast< ::protobuf_unittest_import::ImportMessage*>(
+      ::protobuf_unittest_import::ImportMessage::internal_default_instance());
+}
+
+TestTableDrivenAllTypes::TestTableDrivenAllTypes(const TestTableDrivenAllTypes& from)
+  : ::google::protobuf::Message(),
+    _arena_(NULL) {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void TestTableDrivenAllTypes::SharedCtor() {
+  _cached_size_ = 0;
+  optional_int32_ = 0;
+  optional_int64_ = GOOGLE_LONGLONG(0);
+  optional_uint32_ = 0u;
+  optional_uint64_ = GOOGLE_ULONGLONG(0);
+  optional_sint32_ = 0;
+  optional_sint64_ = GOOGLE_LONGLONG(0);
+  optional_fixed32_ = 0u;
+  optional_fixed64_ = GOOGLE_ULONGLONG(0);
+  optional_sfixed32_ = 0;
+  optional_sfixed64_ = GOOGLE_LONGLONG(0);
+  optional_float_ = 0;
+  optional_double_ = 0;
+  optional_bool_ = false;
+  optional_string_ = const_cast< ::std::string*>(&_default_optional_string_);
+  optional_bytes_ = const_cast< ::std::string*>(&_default_optional_bytes_);
+  optionalgroup_ = NULL;
+  optional_nested_message_ = NULL;
+  optional_foreign_message_ = NULL;
+  optional_import_message_ = NULL;
+  optional_nested_enum_ = 1;
+  optional_foreign_enum_ = 4;
+  optional_import_enum_ = 7;
+  optional_cord_ = const_cast< ::std::string*>(&_default_optional_cord_);
+  default_int32_ = 41;
+  default_int64_ = GOOGLE_LONGLONG(42);
+  default_uint32_ = 43u;
+  default_uint64_ = GOOGLE_ULONGLONG(44);
+  default_sint32_ = -45;
+  default_sint64_ = GOOGLE_LONGLONG(46);
+  default_fixed32_ = 47u;
+  default_fixed64_ = GOOGLE_ULONGLONG(48);
+  default_sfixed32_ = 49;
+  default_sfixed64_ = GOOGLE_LONGLONG(-50);
+  default_float_ = 51.5f;
+  default_double_ = 52000;
+  default_bool_ = true;
+  default_string_ = const_cast< ::std::string*>(&_default_default_string_);
+  default_bytes_ = const_cast< ::std::string*>(&_default_default_bytes_);
+  default_nested_enum_ = 2;
+  default_foreign_enum_ = 5;
+  default_import_enum_ = 8;
+  default_string_piece_.SetAliased("abc", 3);
+  default_cord_ = const_cast< ::std::string*>(&_default_default_cord_);
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+TestTableDrivenAllTypes::~TestTableDrivenAllTypes() {
+  SharedDtor();
+}
+
+void TestTableDrivenAllTypes::SharedDtor() {
+  if (_arena_ != NULL) return;
+  if (optional_string_ != &_default_optional_string_) {
+    delete optional_string_;
+  }
+  if (optional_bytes_ != &_default_optional_bytes_) {
+    delete optional_bytes_;
+  }
+  if (optional_cord_ != &_default_optional_cord_) {
+    delete optional_cord_;
+  }
+  if (default_string_ != &_default_default_string_) {
+    delete default_string_;
+  }
+  if (default_bytes_ != &_default_default_bytes_) {
+    delete default_bytes_;
+  }
+  if (default_cord_ != &_default_default_cord_) {
+    delete default_cord_;
+  }
+  if (this != default_instance_) {
+    delete optionalgroup_;
+    delete optional_nested_message_;
+    delete optional_foreign_message_;
+    delete optional_import_message_;
+  }
+}
+
+void TestTableDrivenAllTypes::SetCachedSize(int size) const {
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
+}
+const ::google::protobuf::Descriptor* TestTableDrivenAllTypes::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return TestTableDrivenAllTypes_descriptor_;
+}
+
+const TestTableDrivenAllTypes& TestTableDrivenAllTypes::default_instance() {
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto();
+  }
+  return *default_instance_;
+}
+
+TestTableDrivenAllTypes* TestTableDrivenAllTypes::default_instance_ = NULL;
+
+TestTableDrivenAllTypes* TestTableDrivenAllTypes::New() const {
+  return new TestTableDrivenAllTypes;
+}
+
+TestTableDrivenAllTypes* TestTableDrivenAllTypes::NewOnArena(
+    ::google::protobuf::Arena* arena) const {
+  return ::google::protobuf::Arena::CreateMessage<TestTableDrivenAllTypes>(arena);
+}
+
+void TestTableDrivenAllTypes::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    optional_int32_ = 0;
+    optional_int64_ = GOOGLE_LONGLONG(0);
+    optional_uint32_ = 0u;
+    optional_uint64_ = GOOGLE_ULONGLONG(0);
+    optional_sint32_ = 0;
+    optional_sint64_ = GOOGLE_LONGLONG(0);
+    optional_fixed32_ = 0u;
+    optional_fixed64_ = GOOGLE_ULONGLONG(0);
+  }
+  if (_has_bits_[8 / 32] & (0xffu << (8 % 32))) {
+    optional_sfixed32_ = 0;
+    optional_sfixed64_ = GOOGLE_LONGLONG(0);
+    optional_float_ = 0;
+    optional_double_ = 0;
+    optional_bool_ = false;
+    if (_has_bit(13)) {
+      if (optional_string_ != &_default_optional_string_) {
+        optional_string_->clear();
+      }
+    }
+    if (_has_bit(14)) {
+      if (optional_bytes_ != &_default_optional_bytes_) {
+        optional_bytes_->clear();
+      }
+    }
+    if (_has_bit(15)) {
+      if (optionalgroup_ != NULL) optionalgroup_->::protobuf_unittest::TestTableDrivenAllTypes_OptionalGroup::Clear();
+    }
+  }
+  if (_has_bits_[16 / 32] & (0xffu << (16 % 32))) {
+    if (_has_bit(16)) {
+      if (optional_nested_message_ != NULL) optional_nested_message_->::protobuf_unittest::TestTableDrivenAllTypes_NestedMessage::Clear();
+    }
+    if (_has_bit(17)) {
+      if (optional_foreign_message_ != NULL) optional_foreign_message_->::protobuf_unittest::ForeignMessage::Clear();
+    }
+    if (_has_bit(18)) {
+      if (optional_import_message_ != NULL) optional_import_message_->::protobuf_unittest_import::ImportMessage::Clear();
+    }
+    optional_nested_enum_ = 1;
+    optional_foreign_enum_ = 4;
+    optional_import_enum_ = 7;
+    if (_has_bit(22)) {
+      optional_string_piece_.Clear();
+    }
+    if (_has_bit(23)) {
+      if (optional_cord_ != &_default_optional_cord_) {
+        optional_cord_->clear();
+      }
+    }
+  }
+  if (_has_bits_[48 / 32] & (0xffu << (48 % 32))) {
+    default_int32_ = 41;
+    default_int64_ = GOOGLE_LONGLONG(42);
+    default_uint32_ = 43u;
+    default_uint64_ = GOOGLE_ULONGLONG(44);
+    default_sint32_ = -45;
+    default_sint64_ = GOOGLE_LONGLONG(46);
+    default_fixed32_ = 47u;
+    default_fixed64_ = GOOGLE_ULONGLONG(48);
+  }
+  if (_has_bits_[56 / 32] & (0xffu << (56 % 32))) {
+    default_sfixed32_ = 49;
+    default_sfixed64_ = GOOGLE_LONGLONG(-50);
+    default_float_ = 51.5f;
+    default_double_ = 52000;
+    default_bool_ = true;
+    if (_has_bit(61)) {
+      if (default_string_ != &_default_default_string_) {
+        default_string_->assign(_default_default_string_);
+      }
+    }
+    if (_has_bit(62)) {
+      if (default_bytes_ != &_default_default_bytes_) {
+        default_bytes_->assign(_default_default_bytes_);
+      }
+    }
+    default_nested_enum_ = 2;
+  }
+  if (_has_bits_[64 / 32] & (0xffu << (64 % 32))) {
+    default_foreign_enum_ = 5;
+    default_import_enum_ = 8;
+    if (_has_bit(66)) {
+      default_string_piece_.SetAliased("abc", 3);
+    }
+    if (_has_bit(67)) {
+      if (default_cord_ != &_default_default_cord_) {
+        default_cord_->assign(_default_default_cord_);
+      }
+    }
+  }
+  repeated_int32_.Clear();
+  repeated_int64_.Clear();
+  repeated_uint32_.Clear();
+  repeated_uint64_.Clear();
+  repeated_sint32_.Clear();
+  repeated_sint64_.Clear();
+  repeated_fixed32_.Clear();
+  repeated_fixed64_.Clear();
+  repeated_sfixed32_.Clear();
+  repeated_sfixed64_.Clear();
+  repeated_float_.Clear();
+  repeated_double_.Clear();
+  repeated_bool_.Clear();
+  repeated_string_.Clear();
+  repeated_bytes_.Clear();
+  repeatedgroup_.Clear();
+  repeated_nested_message_.Clear();
+  repeated_foreign_message_.Clear();
+  repeated_import_message_.Clear();
+  repeated_nested_enum_.Clear();
+  repeated_foreign_enum_.Clear();
+  repeated_import_enum_.Clear();
+  repeated_string_piece_.Clear();
+  repeated_cord_.Clear();
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool TestTableDrivenAllTypes::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto();
+  }
+  return ::google::protobuf::internal::MergePartialFromCodedStream(
+      this, *TestTableDrivenAllTypes_parse_table_, input);
+}
+
+void TestTableDrivenAllTypes::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // optional int32 optional_int32 = 1;
+  if (_has_bit(0)) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->optional_int32(), output);
+  }
+  
+  // optional int64 optional_int64 = 2;
+  if (_has_bit(1)) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt64(2, this->optional_int64(), output);
+  }
+  
+  // optional uint32 optional_uint32 = 3;
+  if (_has_bit(2)) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(3, this->optional_uint32(), output);
+  }
+  
+  // optional uint64 optional_uint64 = 4;
+  if (_has_bit(3)) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(4, this->optional_uint64(), output);
+  }
+  
+  // optional sint32 optional_sint32 = 5;
+  if (_has_bit(4)) {
+    ::google::protobuf::internal::WireFormatLite::WriteSInt32(5, this->optional_sint32(), output);
+  }
+  
+  // optional sint64 optional_sint64 = 6;
+  if (_has_bit(5)) {
+    ::google::protobuf::internal::WireFormatLite::WriteSInt64(6, this->optional_sint64(), output);
+  }
+  
+  // optional fixed32 optional_fixed32 = 7;
+  if (_has_bit(6)) {
+    ::google::protobuf::internal::WireFormatLite::WriteFixed32(7, this->optional_fixed32(), output);
+  }
+  
+  // optional fixed64 optional_fixed64 = 8;
+  if (_has_bit(7)) {
+    ::google::protobuf::internal::WireFormatLite::WriteFixed64(8, this->optional_fixed64(), output);
+  }
+  
+  // optional sfixed32 optional_sfixed32 = 9;
+  if (_has_bit(8)) {
+    ::google::protobuf::internal::WireFormatLite::WriteSFixed32(9, this->optional_sfixed32(), output);
+  }
+  
+  // optional sfixed64 optional_sfixed64 = 10;
+  if (_has_bit(9)) {
+    ::google::protobuf::internal::WireFormatLite::WriteSFixed64(10, this->optional_sfixed64(), output);
+  }
+  
+  // optional float optional_float = 11;
+  if (_has_bit(10)) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(11, this->optional_float(), output);
+  }
+  
+  // optional double optional_double = 12;
+  if (_has_bit(11)) {
+    ::google::protobuf::internal::WireFormatLite::WriteDouble(12, this->optional_double(), output);
+  }
+  
+  // optional bool optional_bool = 13;
+  if (_has_bit(12)) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(13, this->optional_bool(), output);
+  }
+  
+  // optional string optional_string = 14;
+  if (_has_bit(13)) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->optional_string().data(), this->optional_string().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      14, this->optional_string(), output);
+  }
+  
+  // optional bytes optional_bytes = 15;
+  if (_has_bit(14)) {
+    ::google::protobuf::internal::WireFormatLite::WriteBytes(
+      15, this->optional_bytes(), output);
+  }
+  
+  // optional group OptionalGroup = 16 {
+  if (_has_bit(15)) {
+    ::google::protobuf::internal::WireFormatLite::WriteGroupMaybeToArray(
+      16, this->optionalgroup(), output);
+  }
+  
+  // optional .protobuf_unittest.TestTableDrivenAllTypes.NestedMessage optional_nested_message = 18;
+  if (_has_bit(16)) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      18, this->optional_nested_message(), output);
+  }
+  
+  // optional .protobuf_unittest.ForeignMessage optional_foreign_message = 19;
+  if (_has_bit(17)) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      19, this->optional_foreign_message(), output);
+  }
+  
+  // optional .protobuf_unittest_import.ImportMessage optional_import_message = 20;
+  if (_has_bit(18)) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      20, this->optional_import_message(), output);
+  }
+  
+  // optional .protobuf_unittest.TestTableDrivenAllTypes.NestedEnum optional_nested_enum = 21;
+  if (_has_bit(19)) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      21, this->optional_nested_enum(), output);
+  }
+  
+  // optional .protobuf_unittest.ForeignEnum optional_foreign_enum = 22;
+  if (_has_bit(20)) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      22, this->optional_foreign_enum(), output);
+  }
+  
+  // optional .protobuf_unittest_import.ImportEnum optional_import_enum = 23;
+  if (_has_bit(21)) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      23, this->optional_import_enum(), output);
+  }
+  
+  // optional string optional_string_piece = 24 [ctype = STRING_PIECE];
+  if (_has_bit(22)) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->optional_string_piece().data(), this->optional_string_piece().size(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    ::google::protobuf::internal::WireFormatLite::WriteStringPiece(
+      24, this->optional_string_piece(), output);
+  }
+  
+  // optional string optional_cord = 25 [ctype = CORD];
+  if (_has_bit(23)) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->optional_cord().data(), this->optional_cord().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      25, this->optional_cord(), output);
+  }
+  
+  // repeated int32 repeated_int32 = 31;
+  for (int i = 0; i < this->repeated_int32_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(
+      31, this->repeated_int32(i), output);
+  }
+  
+  // repeated int64 repeated_int64 = 32;
+  for (int i = 0; i < this->repeated_int64_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt64(
+      32, this->repeated_int64(i), output);
+  }
+  
+  // repeated uint32 repeated_uint32 = 33;
+  for (int i = 0; i < this->repeated_uint32_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(
+      33, this->repeated_uint32(i), output);
+  }
+  
+  // repeated uint64 repeated_uint64 = 34;
+  for (int i = 0; i < this->repeated_uint64_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(
+      34, this->repeated_uint64(i), output);
+  }
+  
+  // repeated sint32 repeated_sint32 = 35;
+  for (int i = 0; i < this->repeated_sint32_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteSInt32(
+      35, this->repeated_sint32(i), output);
+  }
+  
+  // repeated sint64 repeated_sint64 = 36;
+  for (int i = 0; i < this->repeated_sint64_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteSInt64(
+      36, this->repeated_sint64(i), output);
+  }
+  
+  // repeated fixed32 repeated_fixed32 = 37;
+  for (int i = 0; i < this->repeated_fixed32_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteFixed32(
+      37, this->repeated_fixed32(i), output);
+  }
+  
+  // repeated fixed64 repeated_fixed64 = 38;
+  for (int i = 0; i < this->repeated_fixed64_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteFixed64(
+      38, this->repeated_fixed64(i), output);
+  }
+  
+  // repeated sfixed32 repeated_sfixed32 = 39;
+  for (int i = 0; i < this->repeated_sfixed32_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteSFixed32(
+      39, this->repeated_sfixed32(i), output);
+  }
+  
+  // repeated sfixed64 repeated_sfixed64 = 40;
+  for (int i = 0; i < this->repeated_sfixed64_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteSFixed64(
+      40, this->repeated_sfixed64(i), output);
+  }
+  
+  // repeated float repeated_float = 41;
+  for (int i = 0; i < this->repeated_float_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(
+      41, this->repeated_float(i), output);
+  }
+  
+  // repeated double repeated_double = 42;
+  for (int i = 0; i < this->repeated_double_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteDouble(
+      42, this->repeated_double(i), output);
+  }
+  
+  // repeated bool repeated_bool = 43;
+  for (int i = 0; i < this->repeated_bool_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(
+      43, this->repeated_bool(i), output);
+  }
+  
+  // repeated string repeated_string = 44;
+  for (int i = 0; i < this->repeated_string_size(); i++) {
+  ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+    this->repeated_string(i).data(), this->repeated_string(i).length(),
+    ::google::protobuf::internal::WireFormat::SERIALIZE);
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      44, this->repeated_string(i), output);
+  }
+  
+  // repeated bytes repeated_bytes = 45;
+  for (int i = 0; i < this->repeated_bytes_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteBytes(
+      45, this->repeated_bytes(i), output);
+  }
+  
+  // repeated group RepeatedGroup = 46 {
+  for (int i = 0; i < this->repeatedgroup_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteGroupMaybeToArray(
+      46, this->repeatedgroup(i), output);
+  }
+  
+  // repeated .protobuf_unittest.TestTableDrivenAllTypes.NestedMessage repeated_nested_message = 48;
+  for (int i = 0; i < this->repeated_nested_message_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      48, this->repeated_nested_message(i), output);
+  }
+  
+  // repeated .protobuf_unittest.ForeignMessage repeated_foreign_message = 49;
+  for (int i = 0; i < this->repeated_foreign_message_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      49, this->repeated_foreign_message(i), output);
+  }
+  
+  // repeated .protobuf_unittest_import.ImportMessage repeated_import_message = 50;
+  for (int i = 0; i < this->repeated_import_message_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      50, this->repeated_import_message(i), output);
+  }
+  
+  // repeated .protobuf_unittest.TestTableDrivenAllTypes.NestedEnum repeated_nested_enum = 51;
+  for (int i = 0; i < this->repeated_nested_enum_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      51, this->repeated_nested_enum(i), output);
+  }
+  
+  // repeated .protobuf_unittest.ForeignEnum repeated_foreign_enum = 52;
+  for (int i = 0; i < this->repeated_foreign_enum_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      52, this->repeated_foreign_enum(i), output);
+  }
+  
+  // repeated .protobuf_unittest_import.ImportEnum repeated_import_enum = 53;
+  for (int i = 0; i < this->repeated_import_enum_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      53, this->repeated_import_enum(i), output);
+  }
+  
+  // repeated string repeated_string_piece = 54 [ctype = STRING_PIECE];
+  for (int i = 0; i < this->repeated_string_piece_size(); i++) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->repeated_string_piece(i).data(), this->repeated_string_piece(i).size(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    ::google::protobuf::internal::WireFormatLite::WriteStringPiece(
+      54, this->repeated_string_piece(i), output);
+  }
+  
+  // repeated string repeated_cord = 55 [ctype = CORD];
+  for (int i = 0; i < this->repeated_cord_size(); i++) {
+  ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+    this->repeated_cord(i).data(), this->repeated_cord(i).length(),
+    ::google::protobuf::internal::WireFormat::SERIALIZE);
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      55, this->repeated_cord(i), output);
+  }
+  
+  // optional int32 default_int32 = 61 [default = 41];
+  if (_has_bit(48)) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(61, this->default_int32(), output);
+  }
+  
+  // optional int64 default_int64 = 62 [default = 42];
+  if (_has_bit(49)) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt64(62, this->default_int64(), output);
+  }
+  
+  // optional uint32 default_uint32 = 63 [default = 43];
+  if (_has_bit(50)) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(63, this->default_uint32(), output);
+  }
+  
+  // optional uint64 default_uint64 = 64 [default = 44];
+  if (_has_bit(51)) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(64, this->default_uint64(), output);
+  }
+  
+  // optional sint32 default_sint32 = 65 [default = -45];
+  if (_has_bit(52)) {
+    ::google::protobuf::internal::WireFormatLite::WriteSInt32(65, this->default_sint32(), output);
+  }
+  
+  // optional sint64 default_sint64 = 66 [default = 46];
+  if (_has_bit(53)) {
+    ::google::protobuf::internal::WireFormatLite::WriteSInt64(66, this->default_sint64(), output);
+  }
+  
+  // optional fixed32 default_fixed32 = 67 [default = 47];
+  if (_has_bit(54)) {
+    ::google::protobuf::internal::WireFormatLite::WriteFixed32(67, this->default_fixed32(), output);
+  }
+  
+  // optional fixed64 default_fixed64 = 68 [default = 48];
+  if (_has_bit(55)) {
+    ::google::protobuf::internal::WireFormatLite::WriteFixed64(68, this->default_fixed64(), output);
+  }
+  
+  // optional sfixed32 default_sfixed32 = 69 [default = 49];
+  if (_has_bit(56)) {
+    ::google::protobuf::internal::WireFormatLite::WriteSFixed32(69, this->default_sfixed32(), output);
+  }
+  
+  // optional sfixed64 default_sfixed64 = 70 [default = -50];
+  if (_has_bit(57)) {
+    ::google::protobuf::internal::WireFormatLite::WriteSFixed64(70, this->default_sfixed64(), output);
+  }
+  
+  // optional float default_float = 71 [default = 51.5];
+  if (_has_bit(58)) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(71, this->default_float(), output);
+  }
+  
+  // optional double default_double = 72 [default = 52000];
+  if (_has_bit(59)) {
+    ::google::protobuf::internal::WireFormatLite::WriteDouble(72, this->default_double(), output);
+  }
+  
+  // optional bool default_bool = 73 [default = true];
+  if (_has_bit(60)) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(73, this->default_bool(), output);
+  }
+  
+  // optional string default_string = 74 [default = "hello"];
+  if (_has_bit(61)) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->default_string().data(), this->default_string().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      74, this->default_string(), output);
+  }
+  
+  // optional bytes default_bytes = 75 [default = "world"];
+  if (_has_bit(62)) {
+    ::google::protobuf::internal::WireFormatLite::WriteBytes(
+      75, this->default_bytes(), output);
+  }
+  
+  // optional .protobuf_unittest.TestTableDrivenAllTypes.NestedEnum default_nested_enum = 81 [default = BAR];
+  if (_has_bit(63)) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      81, this->default_nested_enum(), output);
+  }
+  
+  // optional .protobuf_unittest.ForeignEnum default_foreign_enum = 82 [default = FOREIGN_BAR];
+  if (_has_bit(64)) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      82, this->default_foreign_enum(), output);
+  }
+  
+  // optional .protobuf_unittest_import.ImportEnum default_import_enum = 83 [default = IMPORT_BAR];
+  if (_has_bit(65)) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      83, this->default_import_enum(), output);
+  }
+  
+  // optional string default_string_piece = 84 [default = "abc", ctype = STRING_PIECE];
+  if (_has_bit(66)) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->default_string_piece().data(), this->default_string_piece().size(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    ::google::protobuf::internal::WireFormatLite::WriteStringPiece(
+      84, this->default_string_piece(), output);
+  }
+  
+  // optional string default_cord = 85 [default = "123", ctype = CORD];
+  if (_has_bit(67)) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->default_cord().data(), this->default_cord().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      85, this->default_cord(), output);
+  }
+  
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google::protobuf::uint8* TestTableDrivenAllTypes::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // optional int32 optional_int32 = 1;
+  if (_has_bit(0)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->optional_int32(), target);
+  }
+  
+  // optional int64 optional_int64 = 2;
+  if (_has_bit(1)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(2, this->optional_int64(), target);
+  }
+  
+  // optional uint32 optional_uint32 = 3;
+  if (_has_bit(2)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(3, this->optional_uint32(), target);
+  }
+  
+  // optional uint64 optional_uint64 = 4;
+  if (_has_bit(3)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(4, this->optional_uint64(), target);
+  }
+  
+  // optional sint32 optional_sint32 = 5;
+  if (_has_bit(4)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteSInt32ToArray(5, this->optional_sint32(), target);
+  }
+  
+  // optional sint64 optional_sint64 = 6;
+  if (_has_bit(5)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteSInt64ToArray(6, this->optional_sint64(), target);
+  }
+  
+  // optional fixed32 optional_fixed32 = 7;
+  if (_has_bit(6)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFixed32ToArray(7, this->optional_fixed32(), target);
+  }
+  
+  // optional fixed64 optional_fixed64 = 8;
+  if (_has_bit(7)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFixed64ToArray(8, this->optional_fixed64(), target);
+  }
+  
+  // optional sfixed32 optional_sfixed32 = 9;
+  if (_has_bit(8)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteSFixed32ToArray(9, this->optional_sfixed32(), target);
+  }
+  
+  // optional sfixed64 optional_sfixed64 = 10;
+  if (_has_bit(9)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteSFixed64ToArray(10, this->optional_sfixed64(), target);
+  }
+  
+  // optional float optional_float = 11;
+  if (_has_bit(10)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(11, this->optional_float(), target);
+  }
+  
+  // optional double optional_double = 12;
+  if (_has_bit(11)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(12, this->optional_double(), target);
+  }
+  
+  // optional bool optional_bool = 13;
+  if (_has_bit(12)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(13, this->optional_bool(), target);
+  }
+  
+  // optional string optional_string = 14;
+  if (_has_bit(13)) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->optional_string().data(), this->optional_string().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        14, this->optional_string(), target);
+  }
+  
+  // optional bytes optional_bytes = 15;
+  if (_has_bit(14)) {
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
+        15, this->optional_bytes(), target);
+  }
+  
+  // optional group OptionalGroup = 16 {
+  if (_has_bit(15)) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteGroupNoVirtualToArray(
+        16, this->optionalgroup(), target);
+  }
+  
+  // optional .protobuf_unittest.TestTableDrivenAllTypes.NestedMessage optional_nested_message = 18;
+  if (_has_bit(16)) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        18, this->optional_nested_message(), target);
+  }
+  
+  // optional .protobuf_unittest.ForeignMessage optional_foreign_message = 19;
+  if (_has_bit(17)) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        19, this->optional_foreign_message(), target);
+  }
+  
+  // optional .protobuf_unittest_import.ImportMessage optional_import_message = 20;
+  if (_has_bit(18)) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        20, this->optional_import_message(), target);
+  }
+  
+  // optional .protobuf_unittest.TestTableDrivenAllTypes.NestedEnum optional_nested_enum = 21;
+  if (_has_bit(19)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      21, this->optional_nested_enum(), target);
+  }
+  
+  // optional .protobuf_unittest.ForeignEnum optional_foreign_enum = 22;
+  if (_has_bit(20)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      22, this->optional_foreign_enum(), target);
+  }
+  
+  // optional .protobuf_unittest_import.ImportEnum optional_import_enum = 23;
+  if (_has_bit(21)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      23, this->optional_import_enum(), target);
+  }
+  
+  // optional string optional_string_piece = 24 [ctype = STRING_PIECE];
+  if (_has_bit(22)) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->optional_string_piece().data(), this->optional_string_piece().size(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringPieceToArray(
+        24, this->optional_string_piece(), target);
+  }
+  
+  // optional string optional_cord = 25 [ctype = CORD];
+  if (_has_bit(23)) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->optional_cord().data(), this->optional_cord().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        25, this->optional_cord(), target);
+  }
+  
+  // repeated int32 repeated_int32 = 31;
+  for (int i = 0; i < this->repeated_int32_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteInt32ToArray(31, this->repeated_int32(i), target);
+  }
+  
+  // repeated int64 repeated_int64 = 32;
+  for (int i = 0; i < this->repeated_int64_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteInt64ToArray(32, this->repeated_int64(i), target);
+  }
+  
+  // repeated uint32 repeated_uint32 = 33;
+  for (int i = 0; i < this->repeated_uint32_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteUInt32ToArray(33, this->repeated_uint32(i), target);
+  }
+  
+  // repeated uint64 repeated_uint64 = 34;
+  for (int i = 0; i < this->repeated_uint64_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteUInt64ToArray(34, this->repeated_uint64(i), target);
+  }
+  
+  // repeated sint32 repeated_sint32 = 35;
+  for (int i = 0; i < this->repeated_sint32_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteSInt32ToArray(35, this->repeated_sint32(i), target);
+  }
+  
+  // repeated sint64 repeated_sint64 = 36;
+  for (int i = 0; i < this->repeated_sint64_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteSInt64ToArray(36, this->repeated_sint64(i), target);
+  }
+  
+  // repeated fixed32 repeated_fixed32 = 37;
+  for (int i = 0; i < this->repeated_fixed32_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteFixed32ToArray(37, this->repeated_fixed32(i), target);
+  }
+  
+  // repeated fixed64 repeated_fixed64 = 38;
+  for (int i = 0; i < this->repeated_fixed64_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteFixed64ToArray(38, this->repeated_fixed64(i), target);
+  }
+  
+  // repeated sfixed32 repeated_sfixed32 = 39;
+  for (int i = 0; i < this->repeated_sfixed32_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteSFixed32ToArray(39, this->repeated_sfixed32(i), target);
+  }
+  
+  // repeated sfixed64 repeated_sfixed64 = 40;
+  for (int i = 0; i < this->repeated_sfixed64_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteSFixed64ToArray(40, this->repeated_sfixed64(i), target);
+  }
+  
+  // repeated float repeated_float = 41;
+  for (int i = 0; i < this->repeated_float_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteFloatToArray(41, this->repeated_float(i), target);
+  }
+  
+  // repeated double repeated_double = 42;
+  for (int i = 0; i < this->repeated_double_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteDoubleToArray(42, this->repeated_double(i), target);
+  }
+  
+  // repeated bool repeated_bool = 43;
+  for (int i = 0; i < this->repeated_bool_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteBoolToArray(43, this->repeated_bool(i), target);
+  }
+  
+  // repeated string repeated_string = 44;
+  for (int i = 0; i < this->repeated_string_size(); i++) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->repeated_string(i).data(), this->repeated_string(i).length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteStringToArray(44, this->repeated_string(i), target);
+  }
+  
+  // repeated bytes repeated_bytes = 45;
+  for (int i = 0; i < this->repeated_bytes_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteBytesToArray(45, this->repeated_bytes(i), target);
+  }
+  
+  // repeated group RepeatedGroup = 46 {
+  for (int i = 0; i < this->repeatedgroup_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteGroupNoVirtualToArray(
+        46, this->repeatedgroup(i), target);
+  }
+  
+  // repeated .protobuf_unittest.TestTableDrivenAllTypes.NestedMessage repeated_nested_message = 48;
+  for (int i = 0; i < this->repeated_nested_message_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        48, this->repeated_nested_message(i), target);
+  }
+  
+  // repeated .protobuf_unittest.ForeignMessage repeated_foreign_message = 49;
+  for (int i = 0; i < this->repeated_foreign_message_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        49, this->repeated_foreign_message(i), target);
+  }
+  
+  // repeated .protobuf_unittest_import.ImportMessage repeated_import_message = 50;
+  for (int i = 0; i < this->repeated_import_message_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        50, this->repeated_import_message(i), target);
+  }
+  
+  // repeated .protobuf_unittest.TestTableDrivenAllTypes.NestedEnum repeated_nested_enum = 51;
+  for (int i = 0; i < this->repeated_nested_enum_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      51, this->repeated_nested_enum(i), target);
+  }
+  
+  // repeated .protobuf_unittest.ForeignEnum repeated_foreign_enum = 52;
+  for (int i = 0; i < this->repeated_foreign_enum_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      52, this->repeated_foreign_enum(i), target);
+  }
+  
+  // repeated .protobuf_unittest_import.ImportEnum repeated_import_enum = 53;
+  for (int i = 0; i < this->repeated_import_enum_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      53, this->repeated_import_enum(i), target);
+  }
+  
+  // repeated string repeated_string_piece = 54 [ctype = STRING_PIECE];
+  for (int i = 0; i < this->repeated_string_piece_size(); i++) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->repeated_string_piece(i).data(), this->repeated_string_piece(i).size(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteStringPieceToArray(54, this->repeated_string_piece(i), target);
+  }
+  
+  // repeated string repeated_cord = 55 [ctype = CORD];
+  for (int i = 0; i < this->repeated_cord_size(); i++) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->repeated_cord(i).data(), this->repeated_cord(i).length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteStringToArray(55, this->repeated_cord(i), target);
+  }
+  
+  // optional int32 default_int32 = 61 [default = 41];
+  if (_has_bit(48)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(61, this->default_int32(), target);
+  }
+  
+  // optional int64 default_int64 = 62 [default = 42];
+  if (_has_bit(49)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(62, this->default_int64(), target);
+  }
+  
+  // optional uint32 default_uint32 = 63 [default = 43];
+  if (_has_bit(50)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(63, this->default_uint32(), target);
+  }
+  
+  // optional uint64 default_uint64 = 64 [default = 44];
+  if (_has_bit(51)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(64, this->default_uint64(), target);
+  }
+  
+  // optional sint32 default_sint32 = 65 [default = -45];
+  if (_has_bit(52)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteSInt32ToArray(65, this->default_sint32(), target);
+  }
+  
+  // optional sint64 default_sint64 = 66 [default = 46];
+  if (_has_bit(53)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteSInt64ToArray(66, this->default_sint64(), target);
+  }
+  
+  // optional fixed32 default_fixed32 = 67 [default = 47];
+  if (_has_bit(54)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFixed32ToArray(67, this->default_fixed32(), target);
+  }
+  
+  // optional fixed64 default_fixed64 = 68 [default = 48];
+  if (_has_bit(55)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFixed64ToArray(68, this->default_fixed64(), target);
+  }
+  
+  // optional sfixed32 default_sfixed32 = 69 [default = 49];
+  if (_has_bit(56)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteSFixed32ToArray(69, this->default_sfixed32(), target);
+  }
+  
+  // optional sfixed64 default_sfixed64 = 70 [default = -50];
+  if (_has_bit(57)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteSFixed64ToArray(70, this->default_sfixed64(), target);
+  }
+  
+  // optional float default_float = 71 [default = 51.5];
+  if (_has_bit(58)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(71, this->default_float(), target);
+  }
+  
+  // optional double default_double = 72 [default = 52000];
+  if (_has_bit(59)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(72, this->default_double(), target);
+  }
+  
+  // optional bool default_bool = 73 [default = true];
+  if (_has_bit(60)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(73, this->default_bool(), target);
+  }
+  
+  // optional string default_string = 74 [default = "hello"];
+  if (_has_bit(61)) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->default_string().data(), this->default_string().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        74, this->default_string(), target);
+  }
+  
+  // optional bytes default_bytes = 75 [default = "world"];
+  if (_has_bit(62)) {
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
+        75, this->default_bytes(), target);
+  }
+  
+  // optional .protobuf_unittest.TestTableDrivenAllTypes.NestedEnum default_nested_enum = 81 [default = BAR];
+  if (_has_bit(63)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      81, this->default_nested_enum(), target);
+  }
+  
+  // optional .protobuf_unittest.ForeignEnum default_foreign_enum = 82 [default = FOREIGN_BAR];
+  if (_has_bit(64)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      82, this->default_foreign_enum(), target);
+  }
+  
+  // optional .protobuf_unittest_import.ImportEnum default_import_enum = 83 [default = IMPORT_BAR];
+  if (_has_bit(65)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      83, this->default_import_enum(), target);
+  }
+  
+  // optional string default_string_piece = 84 [default = "abc", ctype = STRING_PIECE];
+  if (_has_bit(66)) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->default_string_piece().data(), this->default_string_piece().size(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringPieceToArray(
+        84, this->default_string_piece(), target);
+  }
+  
+  // optional string default_cord = 85 [default = "123", ctype = CORD];
+  if (_has_bit(67)) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->default_cord().data(), this->default_cord().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        85, this->default_cord(), target);
+  }
+  
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int TestTableDrivenAllTypes::ByteSize() const {
+  int total_size = 0;
+  
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // optional int32 optional_int32 = 1;
+    if (has_optional_int32()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->optional_int32());
+    }
+    
+    // optional int64 optional_int64 = 2;
+    if (has_optional_int64()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int64Size(
+          this->optional_int64());
+    }
+    
+    // optional uint32 optional_uint32 = 3;
+    if (has_optional_uint32()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->optional_uint32());
+    }
+    
+    // optional uint64 optional_uint64 = 4;
+    if (has_optional_uint64()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->optional_uint64());
+    }
+    
+    // optional sint32 optional_sint32 = 5;
+    if (has_optional_sint32()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::SInt32Size(
+          this->optional_sint32());
+    }
+    
+    // optional sint64 optional_sint64 = 6;
+    if (has_optional_sint64()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::SInt64Size(
+          this->optional_sint64());
+    }
+    
+    // optional fixed32 optional_fixed32 = 7;
+    if (has_optional_fixed32()) {
+      total_size += 1 + 4;
+    }
+    
+    // optional fixed64 optional_fixed64 = 8;
+    if (has_optional_fixed64()) {
+      total_size += 1 + 8;
+    }
+    
+  }
+  if (_has_bits_[8 / 32] & (0xffu << (8 % 32))) {
+    // optional sfixed32 optional_sfixed32 = 9;
+    if (has_optional_sfixed32()) {
+      total_size += 1 + 4;
+    }
+    
+    // optional sfixed64 optional_sfixed64 = 10;
+    if (has_optional_sfixed64()) {
+      total_size += 1 + 8;
+    }
+    
+    // optional float optional_float = 11;
+    if (has_optional_float()) {
+      total_size += 1 + 4;
+    }
+    
+    // optional double optional_double = 12;
+    if (has_optional_double()) {
+      total_size += 1 + 8;
+    }
+    
+    // optional bool optional_bool = 13;
+    if (has_optional_bool()) {
+      total_size += 1 + 1;
+    }
+    
+    // optional string optional_string = 14;
+    if (has_optional_string()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->optional_string());
+    }
+    
+    // optional bytes optional_bytes = 15;
+    if (has_optional_bytes()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::BytesSize(
+          this->optional_bytes());
+    }
+    
+    // optional group OptionalGroup = 16 {
+    if (has_optionalgroup()) {
+      total_size += 4 +
+        ::google::protobuf::internal::WireFormatLite::GroupSizeNoVirtual(
+          this->optionalgroup());
+    }
+    
+  }
+  if (_has_bits_[16 / 32] & (0xffu << (16 % 32))) {
+    // optional .protobuf_unittest.TestTableDrivenAllTypes.NestedMessage optional_nested_message = 18;
+    if (has_optional_nested_message()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->optional_nested_message());
+    }
+    
+    // optional .protobuf_unittest.ForeignMessage optional_foreign_message = 19;
+    if (has_optional_foreign_message()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->optional_foreign_message());
+    }
+    
+    // optional .protobuf_unittest_import.ImportMessage optional_import_message = 20;
+    if (has_optional_import_message()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->optional_import_message());
+    }
+    
+    // optional .protobuf_unittest.TestTableDrivenAllTypes.NestedEnum optional_nested_enum = 21;
+    if (has_optional_nested_enum()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::EnumSize(this->optional_nested_enum());
+    }
+    
+    // optional .protobuf_unittest.ForeignEnum optional_foreign_enum = 22;
+    if (has_optional_foreign_enum()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::EnumSize(this->optional_foreign_enum());
+    }
+    
+    // optional .protobuf_unittest_import.ImportEnum optional_import_enum = 23;
+    if (has_optional_import_enum()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::EnumSize(this->optional_import_enum());
+    }
+    
+    // optional string optional_string_piece = 24 [ctype = STRING_PIECE];
+    if (has_optional_string_piece()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::StringPieceSize(
+          this->optional_string_piece());
+    }
+    
+    // optional string optional_cord = 25 [ctype = CORD];
+    if (has_optional_cord()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->optional_cord());
+    }
+    
+  }
+  if (_has_bits_[48 / 32] & (0xffu << (48 % 32))) {
+    // optional int32 default_int32 = 61 [default = 41];
+    if (has_default_int32()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->default_int32());
+    }
+    
+    // optional int64 default_int64 = 62 [default = 42];
+    if (has_default_int64()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::Int64Size(
+          this->default_int64());
+    }
+    
+    // optional uint32 default_uint32 = 63 [default = 43];
+    if (has_default_uint32()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->default_uint32());
+    }
+    
+    // optional uint64 default_uint64 = 64 [default = 44];
+    if (has_default_uint64()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->default_uint64());
+    }
+    
+    // optional sint32 default_sint32 = 65 [default = -45];
+    if (has_default_sint32()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::SInt32Size(
+          this->default_sint32());
+    }
+    
+    // optional sint64 default_sint64 = 66 [default = 46];
+    if (has_default_sint64()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::SInt64Size(
+          this->default_sint64());
+    }
+    
+    // optional fixed32 default_fixed32 = 67 [default = 47];
+    if (has_default_fixed32()) {
+      total_size += 2 + 4;
+    }
+    
+    // optional fixed64 default_fixed64 = 68 [default = 48];
+    if (has_default_fixed64()) {
+      total_size += 2 + 8;
+    }
+    
+  }
+  if (_has_bits_[56 / 32] & (0xffu << (56 % 32))) {
+    // optional sfixed32 default_sfixed32 = 69 [default = 49];
+    if (has_default_sfixed32()) {
+      total_size += 2 + 4;
+    }
+    
+    // optional sfixed64 default_sfixed64 = 70 [default = -50];
+    if (has_default_sfixed64()) {
+      total_size += 2 + 8;
+    }
+    
+    // optional float default_float = 71 [default = 51.5];
+    if (has_default_float()) {
+      total_size += 2 + 4;
+    }
+    
+    // optional double default_double = 72 [default = 52000];
+    if (has_default_double()) {
+      total_size += 2 + 8;
+    }
+    
+    // optional bool default_bool = 73 [default = true];
+    if (has_default_bool()) {
+      total_size += 2 + 1;
+    }
+    
+    // optional string default_string = 74 [default = "hello"];
+    if (has_default_string()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->default_string());
+    }
+    
+    // optional bytes default_bytes = 75 [default = "world"];
+    if (has_default_bytes()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::BytesSize(
+          this->default_bytes());
+    }
+    
+    // optional .protobuf_unittest.TestTableDrivenAllTypes.NestedEnum default_nested_enum = 81 [default = BAR];
+    if (has_default_nested_enum()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::EnumSize(this->default_nested_enum());
+    }
+    
+  }
+  if (_has_bits_[64 / 32] & (0xffu << (64 % 32))) {
+    // optional .protobuf_unittest.ForeignEnum default_foreign_enum = 82 [default = FOREIGN_BAR];
+    if (has_default_foreign_enum()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::EnumSize(this->default_foreign_enum());
+    }
+    
+    // optional .protobuf_unittest_import.ImportEnum default_import_enum = 83 [default = IMPORT_BAR];
+    if (has_default_import_enum()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::EnumSize(this->default_import_enum());
+    }
+    
+    // optional string default_string_piece = 84 [default = "abc", ctype = STRING_PIECE];
+    if (has_default_string_piece()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::StringPieceSize(
+          this->default_string_piece());
+    }
+    
+    // optional string default_cord = 85 [default = "123", ctype = CORD];
+    if (has_default_cord()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->default_cord());
+    }
+    
+  }
+  // repeated int32 repeated_int32 = 31;
+  {
+    int data_size = 0;
+    for (int i = 0; i < this->repeated_int32_size(); i++) {
+      data_size += ::google::protobuf::internal::WireFormatLite::
+        Int32Size(this->repeated_int32(i));
+    }
+    total_size += 2 * this->repeated_int32_size() + data_size;
+  }
+  
+  // repeated int64 repeated_int64 = 32;
+  {
+    int data_size = 0;
+    for (int i = 0; i < this->repeated_int64_size(); i++) {
+      data_size += ::google::protobuf::internal::WireFormatLite::
+        Int64Size(this->repeated_int64(i));
+    }
+    total_size += 2 * this->repeated_int64_size() + data_size;
+  }
+  
+  // repeated uint32 repeated_uint32 = 33;
+  {
+    int data_size = 0;
+    for (int i = 0; i < this->repeated_uint32_size(); i++) {
+      data_size += ::google::protobuf::internal::WireFormatLite::
+        UInt32Size(this->repeated_uint32(i));
+    }
+    total_size += 2 * this->repeated_uint32_size() + data_size;
+  }
+  
+  // repeated uint64 repeated_uint64 = 34;
+  {
+    int data_size = 0;
+    for (int i = 0; i < this->repeated_uint64_size(); i++) {
+      data_size += ::google::protobuf::internal::WireFormatLite::
+        UInt64Size(this->repeated_uint64(i));
+    }
+    total_size += 2 * this->repeated_uint64_size() + data_size;
+  }
+  
+  // repeated sint32 repeated_sint32 = 35;
+  {
+    int data_size = 0;
+    for (int i = 0; i < this->repeated_sint32_size(); i++) {
+      data_size += ::google::protobuf::internal::WireFormatLite::
+        SInt32Size(this->repeated_sint32(i));
+    }
+    total_size += 2 * this->repeated_sint32_size() + data_size;
+  }
+  
+  // repeated sint64 repeated_sint64 = 36;
+  {
+    int data_size = 0;
+    for (int i = 0; i < this->repeated_sint64_size(); i++) {
+      data_size += ::google::protobuf::internal::WireFormatLite::
+        SInt64Size(this->repeated_sint64(i));
+    }
+    total_size += 2 * this->repeated_sint64_size() + data_size;
+  }
+  
+  // repeated fixed32 repeated_fixed32 = 37;
+  {
+    int data_size = 0;
+    data_size = 4 * this->repeated_fixed32_size();
+    total_size += 2 * this->repeated_fixed32_size() + data_size;
+  }
+  
+  // repeated fixed64 repeated_fixed64 = 38;
+  {
+    int data_size = 0;
+    data_size = 8 * this->repeated_fixed64_size();
+    total_size += 2 * this->repeated_fixed64_size() + data_size;
+  }
+  
+  // repeated sfixed32 repeated_sfixed32 = 39;
+  {
+    int data_size = 0;
+    data_size = 4 * this->repeated_sfixed32_size();
+    total_size += 2 * this->repeated_sfixed32_size() + data_size;
+  }
+  
+  // repeated sfixed64 repeated_sfixed64 = 40;
+  {
+    int data_size = 0;
+    data_size = 8 * this->repeated_sfixed64_size();
+    total_size += 2 * this->repeated_sfixed64_size() + data_size;
+  }
+  
+  // repeated float repeated_float = 41;
+  {
+    int data_size = 0;
+    data_size = 4 * this->repeated_float_size();
+    total_size += 2 * this->repeated_float_size() + data_size;
+  }
+  
+  // repeated double repeated_double = 42;
+  {
+    int data_size = 0;
+    data_size = 8 * this->repeated_double_size();
+    total_size += 2 * this->repeated_double_size() + data_size;
+  }
+  
+  // repeated bool repeated_bool = 43;
+  {
+    int data_size = 0;
+    data_size = 1 * this->repeated_bool_size();
+    total_size += 2 * this->repeated_bool_size() + data_size;
+  }
+  
+  // repeated string repeated_string = 44;
+  total_size += 2 * this->repeated_string_size();
+  for (int i = 0; i < this->repeated_string_size(); i++) {
+    total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
+      this->repeated_string(i));
+  }
+  
+  // repeated bytes repeated_bytes = 45;
+  total_size += 2 * this->repeated_bytes_size();
+  for (int i = 0; i < this->repeated_bytes_size(); i++) {
+    total_size += ::google::protobuf::internal::WireFormatLite::BytesSize(
+      this->repeated_bytes(i));
+  }
+  
+  // repeated group RepeatedGroup = 46 {
+  total_size += 4 * this->repeatedgroup_size();
+  for (int i = 0; i < this->repeatedgroup_size(); i++) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::GroupSizeNoVirtual(
+        this->repeatedgroup(i));
+  }
+  
+  // repeated .protobuf_unittest.TestTableDrivenAllTypes.NestedMessage repeated_nested_message = 48;
+  total_size += 2 * this->repeated_nested_message_size();
+  for (int i = 0; i < this->repeated_nested_message_size(); i++) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        this->repeated_nested_message(i));
+  }
+  
+  // repeated .protobuf_unittest.ForeignMessage repeated_foreign_message = 49;
+  total_size += 2 * this->repeated_foreign_message_size();
+  for (int i = 0; i < this->repeated_foreign_message_size(); i++) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        this->repeated_foreign_message(i));
+  }
+  
+  // repeated .protobuf_unittest_import.ImportMessage repeated_import_message = 50;
+  total_size += 2 * this->repeated_import_message_size();
+  for (int i = 0; i < this->repeated_import_message_size(); i++) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        this->repeated_import_message(i));
+  }
+  
+  // repeated .protobuf_unittest.TestTableDrivenAllTypes.NestedEnum repeated_nested_enum = 51;
+  {
+    int data_size = 0;
+    for (int i = 0; i < this->repeated_nested_enum_size(); i++) {
+      data_size += ::google::protobuf::internal::WireFormatLite::EnumSize(
+        this->repeated_nested_enum(i));
+    }
+    total_size += 2 * this->repeated_nested_enum_size() + data_size;
+  }
+  
+  // repeated .protobuf_unittest.ForeignEnum repeated_foreign_enum = 52;
+  {
+    int data_size = 0;
+    for (int i = 0; i < this->repeated_foreign_enum_size(); i++) {
+      data_size += ::google::protobuf::internal::WireFormatLite::EnumSize(
+        this->repeated_foreign_enum(i));
+    }
+    total_size += 2 * this->repeated_foreign_enum_size() + data_size;
+  }
+  
+  // repeated .protobuf_unittest_import.ImportEnum repeated_import_enum = 53;
+  {
+    int data_size = 0;
+    for (int i = 0; i < this->repeated_import_enum_size(); i++) {
+      data_size += ::google::protobuf::internal::WireFormatLite::EnumSize(
+        this->repeated_import_enum(i));
+    }
+    total_size += 2 * this->repeated_import_enum_size() + data_size;
+  }
+  
+  // repeated string repeated_string_piece = 54 [ctype = STRING_PIECE];
+  total_size += 2 * this->repeated_string_piece_size();
+  for (int i = 0; i < this->repeated_string_piece_size(); i++) {
+    total_size += ::google::protobuf::internal::WireFormatLite::StringPieceSize(
+      this->repeated_string_piece(i));
+  }
+  
+  // repeated string repeated_cord = 55 [ctype = CORD];
+  total_size += 2 * this->repeated_cord_size();
+  for (int i = 0; i < this->repeated_cord_size(); i++) {
+    total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
+      this->repeated_cord(i));
+  }
+  
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
+  return total_size;
+}
+
+void TestTableDrivenAllTypes::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const TestTableDrivenAllTypes* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const TestTableDrivenAllTypes*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void TestTableDrivenAllTypes::MergeFrom(const TestTableDrivenAllTypes& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  repeated_int32_.MergeFrom(from.repeated_int32_);
+  repeated_int64_.MergeFrom(from.repeated_int64_);
+  repeated_uint32_.MergeFrom(from.repeated_uint32_);
+  repeated_uint64_.MergeFrom(from.repeated_uint64_);
+  repeated_sint32_.MergeFrom(from.repeated_sint32_);
+  repeated_sint64_.MergeFrom(from.repeated_sint64_);
+  repeated_fixed32_.MergeFrom(from.repeated_fixed32_);
+  repeated_fixed64_.MergeFrom(from.repeated_fixed64_);
+  repeated_sfixed32_.MergeFrom(from.repeated_sfixed32_);
+  repeated_sfixed64_.MergeFrom(from.repeated_sfixed64_);
+  repeated_float_.MergeFrom(from.repeated_float_);
+  repeated_double_.MergeFrom(from.repeated_double_);
+  repeated_bool_.MergeFrom(from.repeated_bool_);
+  repeated_string_.MergeFrom(from.repeated_string_);
+  repeated_bytes_.MergeFrom(from.repeated_bytes_);
+  repeatedgroup_.MergeFrom(from.repeatedgroup_);
+  repeated_nested_message_.MergeFrom(from.repeated_nested_message_);
+  repeated_foreign_message_.MergeFrom(from.repeated_foreign_message_);
+  repeated_import_message_.MergeFrom(from.repeated_import_message_);
+  repeated_nested_enum_.MergeFrom(from.repeated_nested_enum_);
+  repeated_foreign_enum_.MergeFrom(from.repeated_foreign_enum_);
+  repeated_import_enum_.MergeFrom(from.repeated_import_enum_);
+  repeated_string_piece_.MergeFrom(from.repeated_string_piece_);
+  repeated_cord_.MergeFrom(from.repeated_cord_);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from._has_bit(0)) {
+      set_optional_int32(from.optional_int32());
+    }
+    if (from._has_bit(1)) {
+      set_optional_int64(from.optional_int64());
+    }
+    if (from._has_bit(2)) {
+      set_optional_uint32(from.optional_uint32());
+    }
+    if (from._has_bit(3)) {
+      set_optional_uint64(from.optional_uint64());
+    }
+    if (from._has_bit(4)) {
+      set_optional_sint32(from.optional_sint32());
+    }
+    if (from._has_bit(5)) {
+      set_optional_sint64(from.optional_sint64());
+    }
+    if (from._has_bit(6)) {
+      set_optional_fixed32(from.optional_fixed32());
+    }
+    if (from._has_bit(7)) {
+      set_optional_fixed64(from.optional_fixed64());
+    }
+  }
+  if (from._has_bits_[8 / 32] & (0xffu << (8 % 32))) {
+    if (from._has_bit(8)) {
+      set_optional_sfixed32(from.optional_sfixed32());
+    }
+    if (from._has_bit(9)) {
+      set_optional_sfixed64(from.optional_sfixed64());
+    }
+    if (from._has_bit(10)) {
+      set_optional_float(from.optional_float());
+    }
+    if (from._has_bit(11)) {
+      set_optional_double(from.optional_double());
+    }
+    if (from._has_bit(12)) {
+      set_optional_bool(from.optional_bool());
+    }
+    if (from._has_bit(13)) {
+      set_optional_string(from.optional_string());
+    }
+    if (from._has_bit(14)) {
+      set_optional_bytes(from.optional_bytes());
+    }
+    if (from._has_bit(15)) {
+      mutable_optionalgroup()->::protobuf_unittest::TestTableDrivenAllTypes_OptionalGroup::MergeFrom(from.optionalgroup());
+    }
+  }
+  if (from._has_bits_[16 / 32] & (0xffu << (16 % 32))) {
+    if (from._has_bit(16)) {
+      mutable_optional_nested_message()->::protobuf_unittest::TestTableDrivenAllTypes_NestedMessage::MergeFrom(from.optional_nested_message());
+    }
+    if (from._has_bit(17)) {
+      mutable_optional_foreign_message()->::protobuf_unittest::ForeignMessage::MergeFrom(from.optional_foreign_message());
+    }
+    if (from._has_bit(18)) {
+      mutable_optional_import_message()->::protobuf_unittest_import::ImportMessage::MergeFrom(from.optional_import_message());
+    }
+    if (from._has_bit(19)) {
+      set_optional_nested_enum(from.optional_nested_enum());
+    }
+    if (from._has_bit(20)) {
+      set_optional_foreign_enum(from.optional_foreign_enum());
+    }
+    if (from._has_bit(21)) {
+      set_optional_import_enum(from.optional_import_enum());
+    }
+    if (from._has_bit(22)) {
+      set_optional_string_piece(from.optional_string_piece().data(), from.optional_string_piece().size());
+    }
+    if (from._has_bit(23)) {
+      set_optional_cord(from.optional_cord());
+    }
+  }
+  if (from._has_bits_[48 / 32] & (0xffu << (48 % 32))) {
+    if (from._has_bit(48)) {
+      set_default_int32(from.default_int32());
+    }
+    if (from._has_bit(49)) {
+      set_default_int64(from.default_int64());
+    }
+    if (from._has_bit(50)) {
+      set_default_uint32(from.default_uint32());
+    }
+    if (from._has_bit(51)) {
+      set_default_uint64(from.default_uint64());
+    }
+    if (from._has_bit(52)) {
+      set_default_sint32(from.default_sint32());
+    }
+    if (from._has_bit(53)) {
+      set_default_sint64(from.default_sint64());
+    }
+    if (from._has_bit(54)) {
+      set_default_fixed32(from.default_fixed32());
+    }
+    if (from._has_bit(55)) {
+      set_default_fixed64(from.default_fixed64());
+    }
+  }
+  if (from._has_bits_[56 / 32] & (0xffu << (56 % 32))) {
+    if (from._has_bit(56)) {
+      set_default_sfixed32(from.default_sfixed32());
+    }
+    if (from._has_bit(57)) {
+      set_default_sfixed64(from.default_sfixed64());
+    }
+    if (from._has_bit(58)) {
+      set_default_float(from.default_float());
+    }
+    if (from._has_bit(59)) {
+      set_default_double(from.default_double());
+    }
+    if (from._has_bit(60)) {
+      set_default_bool(from.default_bool());
+    }
+    if (from._has_bit(61)) {
+      set_default_string(from.default_string());
+    }
+    if (from._has_bit(62)) {
+      set_default_bytes(from.default_bytes());
+    }
+    if (from._has_bit(63)) {
+      set_default_nested_enum(from.default_nested_enum());
+    }
+  }
+  if (from._has_bits_[64 / 32] & (0xffu << (64 % 32))) {
+    if (from._has_bit(64)) {
+      set_default_foreign_enum(from.default_foreign_enum());
+    }
+    if (from._has_bit(65)) {
+      set_default_import_enum(from.default_import_enum());
+    }
+    if (from._has_bit(66)) {
+      set_default_string_piece(from.default_string_piece().data(), from.default_string_piece().size());
+    }
+    if (from._has_bit(67)) {
+      set_default_cord(from.default_cord());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void TestTableDrivenAllTypes::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void TestTableDrivenAllTypes::CopyFrom(const TestTableDrivenAllTypes& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestTableDrivenAllTypes::IsInitialized() const {
+  
+  return true;
+}
+
+void TestTableDrivenAllTypes::Swap(TestTableDrivenAllTypes* other) {
+  if (other != this) {
+    if (GetArena() != other->GetArena()) {
+      TestTableDrivenAllTypes temp;
+      temp.MergeFrom(*this);
+      CopyFrom(*other);
+      other->CopyFrom(temp);
+      return;
+    }
+    std::swap(optional_int32_, other->optional_int32_);
+    std::swap(optional_int64_, other->optional_int64_);
+    std::swap(optional_uint32_, other->optional_uint32_);
+    std::swap(optional_uint64_, other->optional_uint64_);
+    std::swap(optional_sint32_, other->optional_sint32_);
+    std::swap(optional_sint64_, other->optional_sint64_);
+    std::swap(optional_fixed32_, other->optional_fixed32_);
+    std::swap(optional_fixed64_, other->optional_fixed64_);
+    std::swap(optional_sfixed32_, other->optional_sfixed32_);
+    std::swap(optional_sfixed64_, other->optional_sfixed64_);
+    std::swap(optional_float_, other->optional_float_);
+    std::swap(optional_double_, other->optional_double_);
+    std::swap(optional_bool_, other->optional_bool_);
+    std::swap(optional_string_, other->optional_string_);
+    std::swap(optional_bytes_, other->optional_bytes_);
+    std::swap(optionalgroup_, other->optionalgroup_);
+    std::swap(optional_nested_message_, other->optional_nested_message_);
+    std::swap(optional_foreign_message_, other->optional_foreign_message_);
+    std::swap(optional_import_message_, other->optional_import_message_);
+    std::swap(optional_nested_enum_, other->optional_nested_enum_);
+    std::swap(optional_foreign_enum_, other->optional_foreign_enum_);
+    std::swap(optional_import_enum_, other->optional_import_enum_);
+    optional_string_piece_.Swap(&other->optional_string_piece_);
+    std::swap(optional_cord_, other->optional_cord_);
+    repeated_int32_.Swap(&other->repeated_int32_);
+    repeated_int64_.Swap(&other->repeated_int64_);
+    repeated_uint32_.Swap(&other->repeated_uint32_);
+    repeated_uint64_.Swap(&other->repeated_uint64_);
+    repeated_sint32_.Swap(&other->repeated_sint32_);
+    repeated_sint64_.Swap(&other->repeated_sint64_);
+    repeated_fixed32_.Swap(&other->repeated_fixed32_);
+    repeated_fixed64_.Swap(&other->repeated_fixed64_);
+    repeated_sfixed32_.Swap(&other->repeated_sfixed32_);
+    repeated_sfixed64_.Swap(&other->repeated_sfixed64_);
+    repeated_float_.Swap(&other->repeated_float_);
+    repeated_double_.Swap(&other->repeated_double_);
+    repeated_bool_.Swap(&other->repeated_bool_);
+    repeated_string_.Swap(&other->repeated_string_);
+    repeated_bytes_.Swap(&other->repeated_bytes_);
+    repeatedgroup_.Swap(&other->repeatedgroup_);
+    repeated_nested_message_.Swap(&other->repeated_nested_message_);
+    repeated_foreign_message_.Swap(&other->repeated_foreign_message_);
+    repeated_import_message_.Swap(&other->repeated_import_message_);
+    repeated_nested_enum_.Swap(&other->repeated_nested_enum_);
+    repeated_foreign_enum_.Swap(&other->repeated_foreign_enum_);
+    repeated_import_enum_.Swap(&other->repeated_import_enum_);
+    repeated_string_piece_.Swap(&other->repeated_string_piece_);
+    repeated_cord_.Swap(&other->repeated_cord_);
+    std::swap(default_int32_, other->default_int32_);
+    std::swap(default_int64_, other->default_int64_);
+    std::swap(default_uint32_, other->default_uint32_);
+    std::swap(default_uint64_, other->default_uint64_);
+    std::swap(default_sint32_, other->default_sint32_);
+    std::swap(default_sint64_, other->default_sint64_);
+    std::swap(default_fixed32_, other->default_fixed32_);
+    std::swap(default_fixed64_, other->default_fixed64_);
+    std::swap(default_sfixed32_, other->default_sfixed32_);
+    std::swap(default_sfixed64_, other->default_sfixed64_);
+    std::swap(default_float_, other->default_float_);
+    std::swap(default_double_, other->default_double_);
+    std::swap(default_bool_, other->default_bool_);
+    std::swap(default_string_, other->default_string_);
+    std::swap(default_bytes_, other->default_bytes_);
+    std::swap(default_nested_enum_, other->default_nested_enum_);
+    std::swap(default_foreign_enum_, other->default_foreign_enum_);
+    std::swap(default_import_enum_, other->default_import_enum_);
+    default_string_piece_.Swap(&other->default_string_piece_);
+    std::swap(default_cord_, other->default_cord_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    std::swap(_has_bits_[1], other->_has_bits_[1]);
+    std::swap(_has_bits_[2], other->_has_bits_[2]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata TestTableDrivenAllTypes::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = TestTableDrivenAllTypes_descriptor_;
+  metadata.reflection = TestTableDrivenAllTypes_reflection_;
+  return metadata;
+}
+
+
+// ===================================================================
+
+#ifndef _MSC_VER
+const int TestTableDrivenPackedTypes::kPackedInt32FieldNumber;
+const int TestTableDrivenPackedTypes::kPackedInt64FieldNumber;
+const int TestTableDrivenPackedTypes::kPackedUint32FieldNumber;
+const int TestTableDrivenPackedTypes::kPackedUint64FieldNumber;
+const int TestTableDrivenPackedTypes::kPackedSint32FieldNumber;
+const int TestTableDrivenPackedTypes::kPackedSint64FieldNumber;
+const int TestTableDrivenPackedTypes::kPackedFixed32FieldNumber;
+const int TestTableDrivenPackedTypes::kPackedFixed64FieldNumber;
+const int TestTableDrivenPackedTypes::kPackedSfixed32FieldNumber;
+const int TestTableDrivenPackedTypes::kPackedSfixed64FieldNumber;
+const int TestTableDrivenPackedTypes::kPackedFloatFieldNumber;
+const int TestTableDrivenPackedTypes::kPackedDoubleFieldNumber;
+const int TestTableDrivenPackedTypes::kPackedBoolFieldNumber;
+const int TestTableDrivenPackedTypes::kPackedEnumFieldNumber;
+#endif  // !_MSC_VER
+
+TestTableDrivenPackedTypes::TestTableDrivenPackedTypes()
+  : ::google::protobuf::Message(),
+    _arena_(NULL) {
+  SharedCtor();
+}
+
+TestTableDrivenPackedTypes::TestTableDrivenPackedTypes(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+    _arena_(arena),
+    packed_int32_(arena),
+    packed_int64_(arena),
+    packed_uint32_(arena),
+    packed_uint64_(arena),
+    packed_sint32_(arena),
+    packed_sint64_(arena),
+    packed_fixed32_(arena),
+    packed_fixed64_(arena),
+    packed_sfixed32_(arena),
+    packed_sfixed64_(arena),
+    packed_float_(arena),
+    packed_double_(arena),
+    packed_bool_(arena),
+    packed_enum_(arena) {
+  SharedCtor();
+}
+
+void TestTableDrivenPackedTypes::InitAsDefaultInstance() {
+}
+
+TestTableDrivenPackedTypes::TestTableDrivenPackedTypes(const TestTableDrivenPackedTypes& from)
+  : ::google::protobuf::Message(),
+    _arena_(NULL) {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void TestTableDrivenPackedTypes::SharedCtor() {
+  _cached_size_ = 0;
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+TestTableDrivenPackedTypes::~TestTableDrivenPackedTypes() {
+  SharedDtor();
+}
+
+void TestTableDrivenPackedTypes::SharedDtor() {
+  if (_arena_ != NULL) return;
+  if (this != default_instance_) {
+  }
+}
+
+void TestTableDrivenPackedTypes::SetCachedSize(int size) const {
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
+}
+const ::google::protobuf::Descriptor* TestTableDrivenPackedTypes::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return TestTableDrivenPackedTypes_descriptor_;
+}
+
+const TestTableDrivenPackedTypes& TestTableDrivenPackedTypes::default_instance() {
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto();
+  }
+  return *default_instance_;
+}
+
+TestTableDrivenPackedTypes* TestTableDrivenPackedTypes::default_instance_ = NULL;
+
+TestTableDrivenPackedTypes* TestTableDrivenPackedTypes::New() const {
+  return new TestTableDrivenPackedTypes;
+}
+
+TestTableDrivenPackedTypes* TestTableDrivenPackedTypes::NewOnArena(
+    ::google::protobuf::Arena* arena) const {
+  return ::google::protobuf::Arena::CreateMessage<TestTableDrivenPackedTypes>(arena);
+}
+
+void TestTableDrivenPackedTypes::Clear() {
+  packed_int32_.Clear();
+  packed_int64_.Clear();
+  packed_uint32_.Clear();
+  packed_uint64_.Clear();
+  packed_sint32_.Clear();
+  packed_sint64_.Clear();
+  packed_fixed32_.Clear();
+  packed_fixed64_.Clear();
+  packed_sfixed32_.Clear();
+  packed_sfixed64_.Clear();
+  packed_float_.Clear();
+  packed_double_.Clear();
+  packed_bool_.Clear();
+  packed_enum_.Clear();
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool TestTableDrivenPackedTypes::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto();
+  }
+  return ::google::protobuf::internal::MergePartialFromCodedStream(
+      this, *TestTableDrivenPackedTypes_parse_table_, input);
+}
+
+void TestTableDrivenPackedTypes::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // repeated int32 packed_int32 = 90 [packed = true];
+  if (this->packed_int32_size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(90, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(
+        ::google::protobuf::internal::NoBarrier_Load(&_packed_int32_cached_byte_size_));
+  }
+  for (int i = 0; i < this->packed_int32_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32NoTag(
+      this->packed_int32(i), output);
+  }
+  
+  // repeated int64 packed_int64 = 91 [packed = true];
+  if (this->packed_int64_size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(91, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(
+        ::google::protobuf::internal::NoBarrier_Load(&_packed_int64_cached_byte_size_));
+  }
+  for (int i = 0; i < this->packed_int64_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt64NoTag(
+      this->packed_int64(i), output);
+  }
+  
+  // repeated uint32 packed_uint32 = 92 [packed = true];
+  if (this->packed_uint32_size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(92, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(
+        ::google::protobuf::internal::NoBarrier_Load(&_packed_uint32_cached_byte_size_));
+  }
+  for (int i = 0; i < this->packed_uint32_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32NoTag(
+      this->packed_uint32(i), output);
+  }
+  
+  // repeated uint64 packed_uint64 = 93 [packed = true];
+  if (this->packed_uint64_size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(93, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(
+        ::google::protobuf::internal::NoBarrier_Load(&_packed_uint64_cached_byte_size_));
+  }
+  for (int i = 0; i < this->packed_uint64_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64NoTag(
+      this->packed_uint64(i), output);
+  }
+  
+  // repeated sint32 packed_sint32 = 94 [packed = true];
+  if (this->packed_sint32_size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(94, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(
+        ::google::protobuf::internal::NoBarrier_Load(&_packed_sint32_cached_byte_size_));
+  }
+  for (int i = 0; i < this->packed_sint32_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteSInt32NoTag(
+      this->packed_sint32(i), output);
+  }
+  
+  // repeated sint64 packed_sint64 = 95 [packed = true];
+  if (this->packed_sint64_size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(95, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(
+        ::google::protobuf::internal::NoBarrier_Load(&_packed_sint64_cached_byte_size_));
+  }
+  for (int i = 0; i < this->packed_sint64_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteSInt64NoTag(
+      this->packed_sint64(i), output);
+  }
+  
+  // repeated fixed32 packed_fixed32 = 96 [packed = true];
+  if (this->packed_fixed32_size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(96, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(
+        ::google::protobuf::internal::NoBarrier_Load(&_packed_fixed32_cached_byte_size_));
+  }
+  for (int i = 0; i < this->packed_fixed32_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteFixed32NoTag(
+      this->packed_fixed32(i), output);
+  }
+  
+  // repeated fixed64 packed_fixed64 = 97 [packed = true];
+  if (this->packed_fixed64_size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(97, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(
+        ::google::protobuf::internal::NoBarrier_Load(&_packed_fixed64_cached_byte_size_));
+  }
+  for (int i = 0; i < this->packed_fixed64_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteFixed64NoTag(
+      this->packed_fixed64(i), output);
+  }
+  
+  // repeated sfixed32 packed_sfixed32 = 98 [packed = true];
+  if (this->packed_sfixed32_size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(98, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(
+        ::google::protobuf::internal::NoBarrier_Load(&_packed_sfixed32_cached_byte_size_));
+  }
+  for (int i = 0; i < this->packed_sfixed32_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteSFixed32NoTag(
+      this->packed_sfixed32(i), output);
+  }
+  
+  // repeated sfixed64 packed_sfixed64 = 99 [packed = true];
+  if (this->packed_sfixed64_size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(99, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(
+        ::google::protobuf::internal::NoBarrier_Load(&_packed_sfixed64_cached_byte_size_));
+  }
+  for (int i = 0; i < this->packed_sfixed64_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteSFixed64NoTag(
+      this->packed_sfixed64(i), output);
+  }
+  
+  // repeated float packed_float = 100 [packed = true];
+  if (this->packed_float_size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(100, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(
+        ::google::protobuf::internal::NoBarrier_Load(&_packed_float_cached_byte_size_));
+  }
+  for (int i = 0; i < this->packed_float_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloatNoTag(
+      this->packed_float(i), output);
+  }
+  
+  // repeated double packed_double = 101 [packed = true];
+  if (this->packed_double_size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(101, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(
+        ::google::protobuf::internal::NoBarrier_Load(&_packed_double_cached_byte_size_));
+  }
+  for (int i = 0; i < this->packed_double_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteDoubleNoTag(
+      this->packed_double(i), output);
+  }
+  
+  // repeated bool packed_bool = 102 [packed = true];
+  if (this->packed_bool_size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(102, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(
+        ::google::protobuf::internal::NoBarrier_Load(&_packed_bool_cached_byte_size_));
+  }
+  for (int i = 0; i < this->packed_bool_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteBoolNoTag(
+      this->packed_bool(i), output);
+  }
+  
+  // repeated .protobuf_unittest.ForeignEnum packed_enum = 103 [packed = true];
+  if (this->packed_enum_size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(
+      103,
+      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      output);
+    output->WriteVarint32(
+        ::google::protobuf::internal::NoBarrier_Load(&_packed_enum_cached_byte_size_));
+  }
+  for (int i = 0; i < this->packed_enum_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnumNoTag(
+      this->packed_enum(i), output);
+  }
+  
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google::protobuf::uint8* TestTableDrivenPackedTypes::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // repeated int32 packed_int32 = 90 [packed = true];
+  if (this->packed_int32_size() > 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
+      90,
+      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
+      ::google::protobuf::internal::NoBarrier_Load(&_packed_int32_cached_byte_size_),
+      target);
+  }
+  for (int i = 0; i < this->packed_int32_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteInt32NoTagToArray(this->packed_int32(i), target);
+  }
+  
+  // repeated int64 packed_int64 = 91 [packed = true];
+  if (this->packed_int64_size() > 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
+      91,
+      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
+      ::google::protobuf::internal::NoBarrier_Load(&_packed_int64_cached_byte_size_),
+      target);
+  }
+  for (int i = 0; i < this->packed_int64_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteInt64NoTagToArray(this->packed_int64(i), target);
+  }
+  
+  // repeated uint32 packed_uint32 = 92 [packed = true];
+  if (this->packed_uint32_size() > 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
+      92,
+      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
+      ::google::protobuf::internal::NoBarrier_Load(&_packed_uint32_cached_byte_size_),
+      target);
+  }
+  for (int i = 0; i < this->packed_uint32_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteUInt32NoTagToArray(this->packed_uint32(i), target);
+  }
+  
+  // repeated uint64 packed_uint64 = 93 [packed = true];
+  if (this->packed_uint64_size() > 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
+      93,
+      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
+      ::google::protobuf::internal::NoBarrier_Load(&_packed_uint64_cached_byte_size_),
+      target);
+  }
+  for (int i = 0; i < this->packed_uint64_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteUInt64NoTagToArray(this->packed_uint64(i), target);
+  }
+  
+  // repeated sint32 packed_sint32 = 94 [packed = true];
+  if (this->packed_sint32_size() > 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
+      94,
+      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
+      ::google::protobuf::internal::NoBarrier_Load(&_packed_sint32_cached_byte_size_),
+      target);
+  }
+  for (int i = 0; i < this->packed_sint32_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteSInt32NoTagToArray(this->packed_sint32(i), target);
+  }
+  
+  // repeated sint64 packed_sint64 = 95 [packed = true];
+  if (this->packed_sint64_size() > 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
+      95,
+      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
+      ::google::protobuf::internal::NoBarrier_Load(&_packed_sint64_cached_byte_size_),
+      target);
+  }
+  for (int i = 0; i < this->packed_sint64_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteSInt64NoTagToArray(this->packed_sint64(i), target);
+  }
+  
+  // repeated fixed32 packed_fixed32 = 96 [packed = true];
+  if (this->packed_fixed32_size() > 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
+      96,
+      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
+      ::google::protobuf::internal::NoBarrier_Load(&_packed_fixed32_cached_byte_size_),
+      target);
+  }
+  for (int i = 0; i < this->packed_fixed32_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteFixed32NoTagToArray(this->packed_fixed32(i), target);
+  }
+  
+  // repeated fixed64 packed_fixed64 = 97 [packed = true];
+  if (this->packed_fixed64_size() > 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
+      97,
+      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
+      ::google::protobuf::internal::NoBarrier_Load(&_packed_fixed64_cached_byte_size_),
+      target);
+  }
+  for (int i = 0; i < this->packed_fixed64_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteFixed64NoTagToArray(this->packed_fixed64(i), target);
+  }
+  
+  // repeated sfixed32 packed_sfixed32 = 98 [packed = true];
+  if (this->packed_sfixed32_size() > 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
+      98,
+      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
+      ::google::protobuf::internal::NoBarrier_Load(&_packed_sfixed32_cached_byte_size_),
+      target);
+  }
+  for (int i = 0; i < this->packed_sfixed32_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteSFixed32NoTagToArray(this->packed_sfixed32(i), target);
+  }
+  
+  // repeated sfixed64 packed_sfixed64 = 99 [packed = true];
+  if (this->packed_sfixed64_size() > 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
+      99,
+      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
+      ::google::protobuf::internal::NoBarrier_Load(&_packed_sfixed64_cached_byte_size_),
+      target);
+  }
+  for (int i = 0; i < this->packed_sfixed64_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteSFixed64NoTagToArray(this->packed_sfixed64(i), target);
+  }
+  
+  // repeated float packed_float = 100 [packed = true];
+  if (this->packed_float_size() > 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
+      100,
+      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
+      ::google::protobuf::internal::NoBarrier_Load(&_packed_float_cached_byte_size_),
+      target);
+  }
+  for (int i = 0; i < this->packed_float_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteFloatNoTagToArray(this->packed_float(i), target);
+  }
+  
+  // repeated double packed_double = 101 [packed = true];
+  if (this->packed_double_size() > 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
+      101,
+      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
+      ::google::protobuf::internal::NoBarrier_Load(&_packed_double_cached_byte_size_),
+      target);
+  }
+  for (int i = 0; i < this->packed_double_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteDoubleNoTagToArray(this->packed_double(i), target);
+  }
+  
+  // repeated bool packed_bool = 102 [packed = true];
+  if (this->packed_bool_size() > 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
+      102,
+      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
+      ::google::protobuf::internal::NoBarrier_Load(&_packed_bool_cached_byte_size_),
+      target);
+  }
+  for (int i = 0; i < this->packed_bool_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteBoolNoTagToArray(this->packed_bool(i), target);
+  }
+  
+  // repeated .protobuf_unittest.ForeignEnum packed_enum = 103 [packed = true];
+  if (this->packed_enum_size() > 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
+      103,
+      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(    ::google::protobuf::internal::NoBarrier_Load(&_packed_enum_cached_byte_size_),
+      target);
+  }
+  for (int i = 0; i < this->packed_enum_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumNoTagToArray(
+      this->packed_enum(i), target);
+  }
+  
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int TestTableDrivenPackedTypes::ByteSize() const {
+  int total_size = 0;
+  
+  // repeated int32 packed_int32 = 90 [packed = true];
+  {
+    int data_size = 0;
+    for (int i = 0; i < this->packed_int32_size(); i++) {
+      data_size += ::google::protobuf::internal::WireFormatLite::
+        Int32Size(this->packed_int32(i));
+    }
+    if (data_size > 0) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
+    }
+    ::google::protobuf::internal::NoBarrier_Store(
+        &_packed_int32_cached_byte_size_, data_size);
+    total_size += data_size;
+  }
+  
+  // repeated int64 packed_int64 = 91 [packed = true];
+  {
+    int data_size = 0;
+    for (int i = 0; i < this->packed_int64_size(); i++) {
+      data_size += ::google::protobuf::internal::WireFormatLite::
+        Int64Size(this->packed_int64(i));
+    }
+    if (data_size > 0) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
+    }
+    ::google::protobuf::internal::NoBarrier_Store(
+        &_packed_int64_cached_byte_size_, data_size);
+    total_size += data_size;
+  }
+  
+  // repeated uint32 packed_uint32 = 92 [packed = true];
+  {
+    int data_size = 0;
+    for (int i = 0; i < this->packed_uint32_size(); i++) {
+      data_size += ::google::protobuf::internal::WireFormatLite::
+        UInt32Size(this->packed_uint32(i));
+    }
+    if (data_size > 0) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
+    }
+    ::google::protobuf::internal::NoBarrier_Store(
+        &_packed_uint32_cached_byte_size_, data_size);
+    total_size += data_size;
+  }
+  
+  // repeated uint64 packed_uint64 = 93 [packed = true];
+  {
+    int data_size = 0;
+    for (int i = 0; i < this->packed_uint64_size(); i++) {
+      data_size += ::google::protobuf::internal::WireFormatLite::
+        UInt64Size(this->packed_uint64(i));
+    }
+    if (data_size > 0) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
+    }
+    ::google::protobuf::internal::NoBarrier_Store(
+        &_packed_uint64_cached_byte_size_, data_size);
+    total_size += data_size;
+  }
+  
+  // repeated sint32 packed_sint32 = 94 [packed = true];
+  {
+    int data_size = 0;
+    for (int i = 0; i < this->packed_sint32_size(); i++) {
+      data_size += ::google::protobuf::internal::WireFormatLite::
+        SInt32Size(this->packed_sint32(i));
+    }
+    if (data_size > 0) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
+    }
+    ::google::protobuf::internal::NoBarrier_Store(
+        &_packed_sint32_cached_byte_size_, data_size);
+    total_size += data_size;
+  }
+  
+  // repeated sint64 packed_sint64 = 95 [packed = true];
+  {
+    int data_size = 0;
+    for (int i = 0; i < this->packed_sint64_size(); i++) {
+      data_size += ::google::protobuf::internal::WireFormatLite::
+        SInt64Size(this->packed_sint64(i));
+    }
+    if (data_size > 0) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
+    }
+    ::google::protobuf::internal::NoBarrier_Store(
+        &_packed_sint64_cached_byte_size_, data_size);
+    total_size += data_size;
+  }
+  
+  // repeated fixed32 packed_fixed32 = 96 [packed = true];
+  {
+    int data_size = 0;
+    data_size = 4 * this->packed_fixed32_size();
+    if (data_size > 0) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
+    }
+    ::google::protobuf::internal::NoBarrier_Store(
+        &_packed_fixed32_cached_byte_size_, data_size);
+    total_size += data_size;
+  }
+  
+  // repeated fixed64 packed_fixed64 = 97 [packed = true];
+  {
+    int data_size = 0;
+    data_size = 8 * this->packed_fixed64_size();
+    if (data_size > 0) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
+    }
+    ::google::protobuf::internal::NoBarrier_Store(
+        &_packed_fixed64_cached_byte_size_, data_size);
+    total_size += data_size;
+  }
+  
+  // repeated sfixed32 packed_sfixed32 = 98 [packed = true];
+  {
+    int data_size = 0;
+    data_size = 4 * this->packed_sfixed32_size();
+    if (data_size > 0) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
+    }
+    ::google::protobuf::internal::NoBarrier_Store(
+        &_packed_sfixed32_cached_byte_size_, data_size);
+    total_size += data_size;
+  }
+  
+  // repeated sfixed64 packed_sfixed64 = 99 [packed = true];
+  {
+    int data_size = 0;
+    data_size = 8 * this->packed_sfixed64_size();
+    if (data_size > 0) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
+    }
+    ::google::protobuf::internal::NoBarrier_Store(
+        &_packed_sfixed64_cached_byte_size_, data_size);
+    total_size += data_size;
+  }
+  
+  // repeated float packed_float = 100 [packed = true];
+  {
+    int data_size = 0;
+    data_size = 4 * this->packed_float_size();
+    if (data_size > 0) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
+    }
+    ::google::protobuf::internal::NoBarrier_Store(
+        &_packed_float_cached_byte_size_, data_size);
+    total_size += data_size;
+  }
+  
+  // repeated double packed_double = 101 [packed = true];
+  {
+    int data_size = 0;
+    data_size = 8 * this->packed_double_size();
+    if (data_size > 0) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
+    }
+    ::google::protobuf::internal::NoBarrier_Store(
+        &_packed_double_cached_byte_size_, data_size);
+    total_size += data_size;
+  }
+  
+  // repeated bool packed_bool = 102 [packed = true];
+  {
+    int data_size = 0;
+    data_size = 1 * this->packed_bool_size();
+    if (data_size > 0) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
+    }
+    ::google::protobuf::internal::NoBarrier_Store(
+        &_packed_bool_cached_byte_size_, data_size);
+    total_size += data_size;
+  }
+  
+  // repeated .protobuf_unittest.ForeignEnum packed_enum = 103 [packed = true];
+  {
+    int data_size = 0;
+    for (int i = 0; i < this->packed_enum_size(); i++) {
+      data_size += ::google::protobuf::internal::WireFormatLite::EnumSize(
+        this->packed_enum(i));
+    }
+    if (data_size > 0) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
+    }
+    ::google::protobuf::internal::NoBarrier_Store(
+        &_packed_enum_cached_byte_size_, data_size);
+    total_size += data_size;
+  }
+  
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
+  return total_size;
+}
+
+void TestTableDrivenPackedTypes::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const TestTableDrivenPackedTypes* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const TestTableDrivenPackedTypes*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void TestTableDrivenPackedTypes::MergeFrom(const TestTableDrivenPackedTypes& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  packed_int32_.MergeFrom(from.packed_int32_);
+  packed_int64_.MergeFrom(from.packed_int64_);
+  packed_uint32_.MergeFrom(from.packed_uint32_);
+  packed_uint64_.MergeFrom(from.packed_uint64_);
+  packed_sint32_.MergeFrom(from.packed_sint32_);
+  packed_sint64_.MergeFrom(from.packed_sint64_);
+  packed_fixed32_.MergeFrom(from.packed_fixed32_);
+  packed_fixed64_.MergeFrom(from.packed_fixed64_);
+  packed_sfixed32_.MergeFrom(from.packed_sfixed32_);
+  packed_sfixed64_.MergeFrom(from.packed_sfixed64_);
+  packed_float_.MergeFrom(from.packed_float_);
+  packed_double_.MergeFrom(from.packed_double_);
+  packed_bool_.MergeFrom(from.packed_bool_);
+  packed_enum_.MergeFrom(from.packed_enum_);
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void TestTableDrivenPackedTypes::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void TestTableDrivenPackedTypes::CopyFrom(const TestTableDrivenPackedTypes& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestTableDrivenPackedTypes::IsInitialized() const {
+  
+  return true;
+}
+
+void TestTableDrivenPackedTypes::Swap(TestTableDrivenPackedTypes* other) {
+  if (other != this) {
+    if (GetArena() != other->GetArena()) {
+      TestTableDrivenPackedTypes temp;
+      temp.MergeFrom(*this);
+      CopyFrom(*other);
+      other->CopyFrom(temp);
+      return;
+    }
+    packed_int32_.Swap(&other->packed_int32_);
+    packed_int64_.Swap(&other->packed_int64_);
+    packed_uint32_.Swap(&other->packed_uint32_);
+    packed_uint64_.Swap(&other->packed_uint64_);
+    packed_sint32_.Swap(&other->packed_sint32_);
+    packed_sint64_.Swap(&other->packed_sint64_);
+    packed_fixed32_.Swap(&other->packed_fixed32_);
+    packed_fixed64_.Swap(&other->packed_fixed64_);
+    packed_sfixed32_.Swap(&other->packed_sfixed32_);
+    packed_sfixed64_.Swap(&other->packed_sfixed64_);
+    packed_float_.Swap(&other->packed_float_);
+    packed_double_.Swap(&other->packed_double_);
+    packed_bool_.Swap(&other->packed_bool_);
+    packed_enum_.Swap(&other->packed_enum_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata TestTableDrivenPackedTypes::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = TestTableDrivenPackedTypes_descriptor_;
+  metadata.reflection = TestTableDrivenPackedTypes_reflection_;
+  return metadata;
+}
+
+
+// ===================================================================
+
+#ifndef _MSC_VER
+const int TestTableDrivenUnpackedTypes::kUnpackedInt32FieldNumber;
+const int TestTableDrivenUnpackedTypes::kUnpackedInt64FieldNumber;
+const int TestTableDrivenUnpackedTypes::kUnpackedUint32FieldNumber;
+const int TestTableDrivenUnpackedTypes::kUnpackedUint64FieldNumber;
+const int TestTableDrivenUnpackedTypes::kUnpackedSint32FieldNumber;
+const int TestTableDrivenUnpackedTypes::kUnpackedSint64FieldNumber;
+const int TestTableDrivenUnpackedTypes::kUnpackedFixed32FieldNumber;
+const int TestTableDrivenUnpackedTypes::kUnpackedFixed64FieldNumber;
+const int TestTableDrivenUnpackedTypes::kUnpackedSfixed32FieldNumber;
+const int TestTableDrivenUnpackedTypes::kUnpackedSfixed64FieldNumber;
+const int TestTableDrivenUnpackedTypes::kUnpackedFloatFieldNumber;
+const int TestTableDrivenUnpackedTypes::kUnpackedDoubleFieldNumber;
+const int TestTableDrivenUnpackedTypes::kUnpackedBoolFieldNumber;
+const int TestTableDrivenUnpackedTypes::kUnpackedEnumFieldNumber;
+#endif  // !_MSC_VER
+
+TestTableDrivenUnpackedTypes::TestTableDrivenUnpackedTypes()
+  : ::google::protobuf::Message(),
+    _arena_(NULL) {
+  SharedCtor();
+}
+
+TestTableDrivenUnpackedTypes::TestTableDrivenUnpackedTypes(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+    _arena_(arena),
+    unpacked_int32_(arena),
+    unpacked_int64_(arena),
+    unpacked_uint32_(arena),
+    unpacked_uint64_(arena),
+    unpacked_sint32_(arena),
+    unpacked_sint64_(arena),
+    unpacked_fixed32_(arena),
+    unpacked_fixed64_(arena),
+    unpacked_sfixed32_(arena),
+    unpacked_sfixed64_(arena),
+    unpacked_float_(arena),
+    unpacked_double_(arena),
+    unpacked_bool_(arena),
+    unpacked_enum_(arena) {
+  SharedCtor();
+}
+
+void TestTableDrivenUnpackedTypes::InitAsDefaultInstance() {
+}
+
+TestTableDrivenUnpackedTypes::TestTableDrivenUnpackedTypes(const TestTableDrivenUnpackedTypes& from)
+  : ::google::protobuf::Message(),
+    _arena_(NULL) {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void TestTableDrivenUnpackedTypes::SharedCtor() {
+  _cached_size_ = 0;
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+TestTableDrivenUnpackedTypes::~TestTableDrivenUnpackedTypes() {
+  SharedDtor();
+}
+
+void TestTableDrivenUnpackedTypes::SharedDtor() {
+  if (_arena_ != NULL) return;
+  if (this != default_instance_) {
+  }
+}
+
+void TestTableDrivenUnpackedTypes::SetCachedSize(int size) const {
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
+}
+const ::google::protobuf::Descriptor* TestTableDrivenUnpackedTypes::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return TestTableDrivenUnpackedTypes_descriptor_;
+}
+
+const TestTableDrivenUnpackedTypes& TestTableDrivenUnpackedTypes::default_instance() {
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto();
+  }
+  return *default_instance_;
+}
+
+TestTableDrivenUnpackedTypes* TestTableDrivenUnpackedTypes::default_instance_ = NULL;
+
+TestTableDrivenUnpackedTypes* TestTableDrivenUnpackedTypes::New() const {
+  return new TestTableDrivenUnpackedTypes;
+}
+
+TestTableDrivenUnpackedTypes* TestTableDrivenUnpackedTypes::NewOnArena(
+    ::google::protobuf::Arena* arena) const {
+  return ::google::protobuf::Arena::CreateMessage<TestTableDrivenUnpackedTypes>(arena);
+}
+
+void TestTableDrivenUnpackedTypes::Clear() {
+  unpacked_int32_.Clear();
+  unpacked_int64_.Clear();
+  unpacked_uint32_.Clear();
+  unpacked_uint64_.Clear();
+  unpacked_sint32_.Clear();
+  unpacked_sint64_.Clear();
+  unpacked_fixed32_.Clear();
+  unpacked_fixed64_.Clear();
+  unpacked_sfixed32_.Clear();
+  unpacked_sfixed64_.Clear();
+  unpacked_float_.Clear();
+  unpacked_double_.Clear();
+  unpacked_bool_.Clear();
+  unpacked_enum_.Clear();
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool TestTableDrivenUnpackedTypes::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto();
+  }
+  return ::google::protobuf::internal::MergePartialFromCodedStream(
+      this, *TestTableDrivenUnpackedTypes_parse_table_, input);
+}
+
+void TestTableDrivenUnpackedTypes::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // repeated int32 unpacked_int32 = 90 [packed = false];
+  for (int i = 0; i < this->unpacked_int32_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(
+      90, this->unpacked_int32(i), output);
+  }
+  
+  // repeated int64 unpacked_int64 = 91 [packed = false];
+  for (int i = 0; i < this->unpacked_int64_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt64(
+      91, this->unpacked_int64(i), output);
+  }
+  
+  // repeated uint32 unpacked_uint32 = 92 [packed = false];
+  for (int i = 0; i < this->unpacked_uint32_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(
+      92, this->unpacked_uint32(i), output);
+  }
+  
+  // repeated uint64 unpacked_uint64 = 93 [packed = false];
+  for (int i = 0; i < this->unpacked_uint64_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(
+      93, this->unpacked_uint64(i), output);
+  }
+  
+  // repeated sint32 unpacked_sint32 = 94 [packed = false];
+  for (int i = 0; i < this->unpacked_sint32_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteSInt32(
+      94, this->unpacked_sint32(i), output);
+  }
+  
+  // repeated sint64 unpacked_sint64 = 95 [packed = false];
+  for (int i = 0; i < this->unpacked_sint64_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteSInt64(
+      95, this->unpacked_sint64(i), output);
+  }
+  
+  // repeated fixed32 unpacked_fixed32 = 96 [packed = false];
+  for (int i = 0; i < this->unpacked_fixed32_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteFixed32(
+      96, this->unpacked_fixed32(i), output);
+  }
+  
+  // repeated fixed64 unpacked_fixed64 = 97 [packed = false];
+  for (int i = 0; i < this->unpacked_fixed64_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteFixed64(
+      97, this->unpacked_fixed64(i), output);
+  }
+  
+  // repeated sfixed32 unpacked_sfixed32 = 98 [packed = false];
+  for (int i = 0; i < this->unpacked_sfixed32_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteSFixed32(
+      98, this->unpacked_sfixed32(i), output);
+  }
+  
+  // repeated sfixed64 unpacked_sfixed64 = 99 [packed = false];
+  for (int i = 0; i < this->unpacked_sfixed64_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteSFixed64(
+      99, this->unpacked_sfixed64(i), output);
+  }
+  
+  // repeated float unpacked_float = 100 [packed = false];
+  for (int i = 0; i < this->unpacked_float_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(
+      100, this->unpacked_float(i), output);
+  }
+  
+  // repeated double unpacked_double = 101 [packed = false];
+  for (int i = 0; i < this->unpacked_double_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteDouble(
+      101, this->unpacked_double(i), output);
+  }
+  
+  // repeated bool unpacked_bool = 102 [packed = false];
+  for (int i = 0; i < this->unpacked_bool_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(
+      102, this->unpacked_bool(i), output);
+  }
+  
+  // repeated .protobuf_unittest.ForeignEnum unpacked_enum = 103 [packed = false];
+  for (int i = 0; i < this->unpacked_enum_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      103, this->unpacked_enum(i), output);
+  }
+  
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google::protobuf::uint8* TestTableDrivenUnpackedTypes::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // repeated int32 unpacked_int32 = 90 [packed = false];
+  for (int i = 0; i < this->unpacked_int32_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteInt32ToArray(90, this->unpacked_int32(i), target);
+  }
+  
+  // repeated int64 unpacked_int64 = 91 [packed = false];
+  for (int i = 0; i < this->unpacked_int64_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteInt64ToArray(91, this->unpacked_int64(i), target);
+  }
+  
+  // repeated uint32 unpacked_uint32 = 92 [packed = false];
+  for (int i = 0; i < this->unpacked_uint32_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteUInt32ToArray(92, this->unpacked_uint32(i), target);
+  }
+  
+  // repeated uint64 unpacked_uint64 = 93 [packed = false];
+  for (int i = 0; i < this->unpacked_uint64_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteUInt64ToArray(93, this->unpacked_uint64(i), target);
+  }
+  
+  // repeated sint32 unpacked_sint32 = 94 [packed = false];
+  for (int i = 0; i < this->unpacked_sint32_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteSInt32ToArray(94, this->unpacked_sint32(i), target);
+  }
+  
+  // repeated sint64 unpacked_sint64 = 95 [packed = false];
+  for (int i = 0; i < this->unpacked_sint64_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteSInt64ToArray(95, this->unpacked_sint64(i), target);
+  }
+  
+  // repeated fixed32 unpacked_fixed32 = 96 [packed = false];
+  for (int i = 0; i < this->unpacked_fixed32_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteFixed32ToArray(96, this->unpacked_fixed32(i), target);
+  }
+  
+  // repeated fixed64 unpacked_fixed64 = 97 [packed = false];
+  for (int i = 0; i < this->unpacked_fixed64_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteFixed64ToArray(97, this->unpacked_fixed64(i), target);
+  }
+  
+  // repeated sfixed32 unpacked_sfixed32 = 98 [packed = false];
+  for (int i = 0; i < this->unpacked_sfixed32_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteSFixed32ToArray(98, this->unpacked_sfixed32(i), target);
+  }
+  
+  // repeated sfixed64 unpacked_sfixed64 = 99 [packed = false];
+  for (int i = 0; i < this->unpacked_sfixed64_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteSFixed64ToArray(99, this->unpacked_sfixed64(i), target);
+  }
+  
+  // repeated float unpacked_float = 100 [packed = false];
+  for (int i = 0; i < this->unpacked_float_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteFloatToArray(100, this->unpacked_float(i), target);
+  }
+  
+  // repeated double unpacked_double = 101 [packed = false];
+  for (int i = 0; i < this->unpacked_double_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteDoubleToArray(101, this->unpacked_double(i), target);
+  }
+  
+  // repeated bool unpacked_bool = 102 [packed = false];
+  for (int i = 0; i < this->unpacked_bool_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteBoolToArray(102, this->unpacked_bool(i), target);
+  }
+  
+  // repeated .protobuf_unittest.ForeignEnum unpacked_enum = 103 [packed = false];
+  for (int i = 0; i < this->unpacked_enum_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      103, this->unpacked_enum(i), target);
+  }
+  
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int TestTableDrivenUnpackedTypes::ByteSize() const {
+  int total_size = 0;
+  
+  // repeated int32 unpacked_int32 = 90 [packed = false];
+  {
+    int data_size = 0;
+    for (int i = 0; i < this->unpacked_int32_size(); i++) {
+      data_size += ::google::protobuf::internal::WireFormatLite::
+        Int32Size(this->unpacked_int32(i));
+    }
+    total_size += 2 * this->unpacked_int32_size() + data_size;
+  }
+  
+  // repeated int64 unpacked_int64 = 91 [packed = false];
+  {
+    int data_size = 0;
+    for (int i = 0; i < this->unpacked_int64_size(); i++) {
+      data_size += ::google::protobuf::internal::WireFormatLite::
+        Int64Size(this->unpacked_int64(i));
+    }
+    total_size += 2 * this->unpacked_int64_size() + data_size;
+  }
+  
+  // repeated uint32 unpacked_uint32 = 92 [packed = false];
+  {
+    int data_size = 0;
+    for (int i = 0; i < this->unpacked_uint32_size(); i++) {
+      data_size += ::google::protobuf::internal::WireFormatLite::
+        UInt32Size(this->unpacked_uint32(i));
+    }
+    total_size += 2 * this->unpacked_uint32_size() + data_size;
+  }
+  
+  // repeated uint64 unpacked_uint64 = 93 [packed = false];
+  {
+    int data_size = 0;
+    for (int i = 0; i < this->unpacked_uint64_size(); i++) {
+      data_size += ::google::protobuf::internal::WireFormatLite::
+        UInt64Size(this->unpacked_uint64(i));
+    }
+    total_size += 2 * this->unpacked_uint64_size() + data_size;
+  }
+  
+  // repeated sint32 unpacked_sint32 = 94 [packed = false];
+  {
+    int data_size = 0;
+    for (int i = 0; i < this->unpacked_sint32_size(); i++) {
+      data_size += ::google::protobuf::internal::WireFormatLite::
+        SInt32Size(this->unpacked_sint32(i));
+    }
+    total_size += 2 * this->unpacked_sint32_size() + data_size;
+  }
+  
+  // repeated sint64 unpacked_sint64 = 95 [packed = false];
+  {
+    int data_size = 0;
+    for (int i = 0; i < this->unpacked_sint64_size(); i++) {
+      data_size += ::google::protobuf::internal::WireFormatLite::
+        SInt64Size(this->unpacked_sint64(i));
+    }
+    total_size += 2 * this->unpacked_sint64_size() + data_size;
+  }
+  
+  // repeated fixed32 unpacked_fixed32 = 96 [packed = false];
+  {
+    int data_size = 0;
+    data_size = 4 * this->unpacked_fixed32_size();
+    total_size += 2 * this->unpacked_fixed32_size() + data_size;
+  }
+  
+  // repeated fixed64 unpacked_fixed64 = 97 [packed = false];
+  {
+    int data_size = 0;
+    data_size = 8 * this->unpacked_fixed64_size();
+    total_size += 2 * this->unpacked_fixed64_size() + data_size;
+  }
+  
+  // repeated sfixed32 unpacked_sfixed32 = 98 [packed = false];
+  {
+    int data_size = 0;
+    data_size = 4 * this->unpacked_sfixed32_size();
+    total_size += 2 * this->unpacked_sfixed32_size() + data_size;
+  }
+  
+  // repeated sfixed64 unpacked_sfixed64 = 99 [packed = false];
+  {
+    int data_size = 0;
+    data_size = 8 * this->unpacked_sfixed64_size();
+    total_size += 2 * this->unpacked_sfixed64_size() + data_size;
+  }
+  
+  // repeated float unpacked_float = 100 [packed = false];
+  {
+    int data_size = 0;
+    data_size = 4 * this->unpacked_float_size();
+    total_size += 2 * this->unpacked_float_size() + data_size;
+  }
+  
+  // repeated double unpacked_double = 101 [packed = false];
+  {
+    int data_size = 0;
+    data_size = 8 * this->unpacked_double_size();
+    total_size += 2 * this->unpacked_double_size() + data_size;
+  }
+  
+  // repeated bool unpacked_bool = 102 [packed = false];
+  {
+    int data_size = 0;
+    data_size = 1 * this->unpacked_bool_size();
+    total_size += 2 * this->unpacked_bool_size() + data_size;
+  }
+  
+  // repeated .protobuf_unittest.ForeignEnum unpacked_enum = 103 [packed = false];
+  {
+    int data_size = 0;
+    for (int i = 0; i < this->unpacked_enum_size(); i++) {
+      data_size += ::google::protobuf::internal::WireFormatLite::EnumSize(
+        this->unpacked_enum(i));
+    }
+    total_size += 2 * this->unpacked_enum_size() + data_size;
+  }
+  
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
+  return total_size;
+}
+
+void TestTableDrivenUnpackedTypes::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const TestTableDrivenUnpackedTypes* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const TestTableDrivenUnpackedTypes*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void TestTableDrivenUnpackedTypes::MergeFrom(const TestTableDrivenUnpackedTypes& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  unpacked_int32_.MergeFrom(from.unpacked_int32_);
+  unpacked_int64_.MergeFrom(from.unpacked_int64_);
+  unpacked_uint32_.MergeFrom(from.unpacked_uint32_);
+  unpacked_uint64_.MergeFrom(from.unpacked_uint64_);
+  unpacked_sint32_.MergeFrom(from.unpacked_sint32_);
+  unpacked_sint64_.MergeFrom(from.unpacked_sint64_);
+  unpacked_fixed32_.MergeFrom(from.unpacked_fixed32_);
+  unpacked_fixed64_.MergeFrom(from.unpacked_fixed64_);
+  unpacked_sfixed32_.MergeFrom(from.unpacked_sfixed32_);
+  unpacked_sfixed64_.MergeFrom(from.unpacked_sfixed64_);
+  unpacked_float_.MergeFrom(from.unpacked_float_);
+  unpacked_double_.MergeFrom(from.unpacked_double_);
+  unpacked_bool_.MergeFrom(from.unpacked_bool_);
+  unpacked_enum_.MergeFrom(from.unpacked_enum_);
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void TestTableDrivenUnpackedTypes::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void TestTableDrivenUnpackedTypes::CopyFrom(const TestTableDrivenUnpackedTypes& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestTableDrivenUnpackedTypes::IsInitialized() const {
+  
+  return true;
+}
+
+void TestTableDrivenUnpackedTypes::Swap(TestTableDrivenUnpackedTypes* other) {
+  if (other != this) {
+    if (GetArena() != other->GetArena()) {
+      TestTableDrivenUnpackedTypes temp;
+      temp.MergeFrom(*this);
+      CopyFrom(*other);
+      other->CopyFrom(temp);
+      return;
+    }
+    unpacked_int32_.Swap(&other->unpacked_int32_);
+    unpacked_int64_.Swap(&other->unpacked_int64_);
+    unpacked_uint32_.Swap(&other->unpacked_uint32_);
+    unpacked_uint64_.Swap(&other->unpacked_uint64_);
+    unpacked_sint32_.Swap(&other->unpacked_sint32_);
+    unpacked_sint64_.Swap(&other->unpacked_sint64_);
+    unpacked_fixed32_.Swap(&other->unpacked_fixed32_);
+    unpacked_fixed64_.Swap(&other->unpacked_fixed64_);
+    unpacked_sfixed32_.Swap(&other->unpacked_sfixed32_);
+    unpacked_sfixed64_.Swap(&other->unpacked_sfixed64_);
+    unpacked_float_.Swap(&other->unpacked_float_);
+    unpacked_double_.Swap(&other->unpacked_double_);
+    unpacked_bool_.Swap(&other->unpacked_bool_);
+    unpacked_enum_.Swap(&other->unpacked_enum_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata TestTableDrivenUnpackedTypes::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = TestTableDrivenUnpackedTypes_descriptor_;
+  metadata.reflection = TestTableDrivenUnpackedTypes_reflection_;
+  return metadata;
+}
+
+
+// ===================================================================
+
+#ifndef _MSC_VER
+const int TestTableDrivenLazyMessage::kIdFieldNumber;
+const int TestTableDrivenLazyMessage::kLazyChildFieldNumber;
+const int TestTableDrivenLazyMessage::kEagerChildFieldNumber;
+const int TestTableDrivenLazyMessage::kLazyRequiredFieldNumber;
+#endif  // !_MSC_VER
+
+TestTableDrivenLazyMessage::TestTableDrivenLazyMessage()
+  : ::google::protobuf::Message(),
+    _arena_(NULL) {
+  SharedCtor();
+}
+
+TestTableDrivenLazyMessage::TestTableDrivenLazyMessage(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+    _arena_(arena) {
+  SharedCtor();
+}
+
+void TestTableDrivenLazyMessage::InitAsDefaultInstance() {
+  eager_child_ = const_cast< ::protobuf_unittest::TestAllTypes*>(
+      ::protobuf_unittest::TestAllTypes::internal_default_instance());
+}
+
+TestTableDrivenLazyMessage::TestTableDrivenLazyMessage(const TestTableDrivenLazyMessage& from)
+  : ::google::protobuf::Message(),
+    _arena_(NULL) {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void TestTableDrivenLazyMessage::SharedCtor() {
+  _cached_size_ = 0;
+  id_ = 0;
+  eager_child_ = NULL;
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+TestTableDrivenLazyMessage::~TestTableDrivenLazyMessage() {
+  SharedDtor();
+}
+
+void TestTableDrivenLazyMessage::SharedDtor() {
+  if (_arena_ != NULL) return;
+  if (this != default_instance_) {
+    delete eager_child_;
+  }
+}
+
+void TestTableDrivenLazyMessage::SetCachedSize(int size) const {
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
+}
+const ::google::protobuf::Descriptor* TestTableDrivenLazyMessage::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return TestTableDrivenLazyMessage_descriptor_;
+}
+
+const TestTableDrivenLazyMessage& TestTableDrivenLazyMessage::default_instance() {
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto();
+  }
+  return *default_instance_;
+}
+
+TestTableDrivenLazyMessage* TestTableDrivenLazyMessage::default_instance_ = NULL;
+
+TestTableDrivenLazyMessage* TestTableDrivenLazyMessage::New() const {
+  return new TestTableDrivenLazyMessage;
+}
+
+TestTableDrivenLazyMessage* TestTableDrivenLazyMessage::NewOnArena(
+    ::google::protobuf::Arena* arena) const {
+  return ::google::protobuf::Arena::CreateMessage<TestTableDrivenLazyMessage>(arena);
+}
+
+void TestTableDrivenLazyMessage::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    id_ = 0;
+    if (_has_bit(1)) {
+      lazy_child_.Clear();
+    }
+    if (_has_bit(2)) {
+      if (eager_child_ != NULL) eager_child_->::protobuf_unittest::TestAllTypes::Clear();
+    }
+    if (_has_bit(3)) {
+      lazy_required_.Clear();
+    }
+  }
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool TestTableDrivenLazyMessage::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto();
+  }
+  return ::google::protobuf::internal::MergePartialFromCodedStream(
+      this, *TestTableDrivenLazyMessage_parse_table_, input);
+}
+
+void TestTableDrivenLazyMessage::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // optional int32 id = 1;
+  if (_has_bit(0)) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->id(), output);
+  }
+  
+  // optional .protobuf_unittest.TestAllTypes lazy_child = 2 [lazy = true];
+  if (_has_bit(1)) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(
+      2,
+      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      output);
+    lazy_child_.SerializeWithCachedSizes(output);
+  }
+  
+  // optional .protobuf_unittest.TestAllTypes eager_child = 3;
+  if (_has_bit(2)) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      3, this->eager_child(), output);
+  }
+  
+  // optional .protobuf_unittest.TestRequired lazy_required = 4 [lazy = true];
+  if (_has_bit(3)) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(
+      4,
+      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      output);
+    lazy_required_.SerializeWithCachedSizes(output);
+  }
+  
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google::protobuf::uint8* TestTableDrivenLazyMessage::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // optional int32 id = 1;
+  if (_has_bit(0)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->id(), target);
+  }
+  
+  // optional .protobuf_unittest.TestAllTypes lazy_child = 2 [lazy = true];
+  if (_has_bit(1)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
+      2,
+      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = lazy_child_.SerializeWithCachedSizesToArray(target);
+  }
+  
+  // optional .protobuf_unittest.TestAllTypes eager_child = 3;
+  if (_has_bit(2)) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        3, this->eager_child(), target);
+  }
+  
+  // optional .protobuf_unittest.TestRequired lazy_required = 4 [lazy = true];
+  if (_has_bit(3)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
+      4,
+      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = lazy_required_.SerializeWithCachedSizesToArray(target);
+  }
+  
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int TestTableDrivenLazyMessage::ByteSize() const {
+  int total_size = 0;
+  
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // optional int32 id = 1;
+    if (has_id()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->id());
+    }
+    
+    // optional .protobuf_unittest.TestAllTypes lazy_child = 2 [lazy = true];
+    if (has_lazy_child()) {
+      {
+        int size = lazy_child_.ByteSize();
+        total_size += 1 +
+          ::google::protobuf::io::CodedOutputStream::VarintSize32(size) + size;
+      }
+    }
+    
+    // optional .protobuf_unittest.TestAllTypes eager_child = 3;
+    if (has_eager_child()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->eager_child());
+    }
+    
+    // optional .protobuf_unittest.TestRequired lazy_required = 4 [lazy = true];
+    if (has_lazy_required()) {
+      {
+        int size = lazy_required_.ByteSize();
+        total_size += 1 +
+          ::google::protobuf::io::CodedOutputStream::VarintSize32(size) + size;
+      }
+    }
+    
+  }
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
+  return total_size;
+}
+
+void TestTableDrivenLazyMessage::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const TestTableDrivenLazyMessage* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const TestTableDrivenLazyMessage*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void TestTableDrivenLazyMessage::MergeFrom(const TestTableDrivenLazyMessage& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from._has_bit(0)) {
+      set_id(from.id());
+    }
+    if (from._has_bit(1)) {
+      _set_bit(1);
+      lazy_child_.MergeFrom(from.lazy_child_, ::protobuf_unittest::TestAllTypes::default_instance());
+    }
+    if (from._has_bit(2)) {
+      mutable_eager_child()->::protobuf_unittest::TestAllTypes::MergeFrom(from.eager_child());
+    }
+    if (from._has_bit(3)) {
+      _set_bit(3);
+      lazy_required_.MergeFrom(from.lazy_required_, ::protobuf_unittest::TestRequired::default_instance());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void TestTableDrivenLazyMessage::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void TestTableDrivenLazyMessage::CopyFrom(const TestTableDrivenLazyMessage& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestTableDrivenLazyMessage::IsInitialized() const {
+  
+  if (has_lazy_required()) {
+    if (!lazy_required_.IsInitialized()) return false;
+  }
+  return true;
+}
+
+void TestTableDrivenLazyMessage::Swap(TestTableDrivenLazyMessage* other) {
+  if (other != this) {
+    if (GetArena() != other->GetArena()) {
+      TestTableDrivenLazyMessage temp;
+      temp.MergeFrom(*this);
+      CopyFrom(*other);
+      other->CopyFrom(temp);
+      return;
+    }
+    std::swap(id_, other->id_);
+    lazy_child_.Swap(&other->lazy_child_);
+    std::swap(eager_child_, other->eager_child_);
+    lazy_required_.Swap(&other->lazy_required_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata TestTableDrivenLazyMessage::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = TestTableDrivenLazyMessage_descriptor_;
+  metadata.reflection = TestTableDrivenLazyMessage_reflection_;
+  return metadata;
+}
+
+
+// ===================================================================
+
+const ::std::string TestTableDrivenSparse::_default_optional_string_;
+#ifndef _MSC_VER
+const int TestTableDrivenSparse::kOptionalInt32FieldNumber;
+const int TestTableDrivenSparse::kOptionalStringFieldNumber;
+const int TestTableDrivenSparse::kRepeatedInt32FieldNumber;
+#endif  // !_MSC_VER
+
+TestTableDrivenSparse::TestTableDrivenSparse()
+  : ::google::protobuf::Message(),
+    _arena_(NULL) {
+  SharedCtor();
+}
+
+TestTableDrivenSparse::TestTableDrivenSparse(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+    _arena_(arena),
+    repeated_int32_(arena) {
+  SharedCtor();
+}
+
+void TestTableDrivenSparse::InitAsDefaultInstance() {
+}
+
+TestTableDrivenSparse::TestTableDrivenSparse(const TestTableDrivenSparse& from)
+  : ::google::protobuf::Message(),
+    _arena_(NULL) {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void TestTableDrivenSparse::SharedCtor() {
+  _cached_size_ = 0;
+  optional_int32_ = 0;
+  optional_string_ = const_cast< ::std::string*>(&_default_optional_string_);
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+TestTableDrivenSparse::~TestTableDrivenSparse() {
+  SharedDtor();
+}
+
+void TestTableDrivenSparse::SharedDtor() {
+  if (_arena_ != NULL) return;
+  if (optional_string_ != &_default_optional_string_) {
+    delete optional_string_;
+  }
+  if (this != default_instance_) {
+  }
+}
+
+void TestTableDrivenSparse::SetCachedSize(int size) const {
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
+}
+const ::google::protobuf::Descriptor* TestTableDrivenSparse::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return TestTableDrivenSparse_descriptor_;
+}
+
+const TestTableDrivenSparse& TestTableDrivenSparse::default_instance() {
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto();
+  }
+  return *default_instance_;
+}
+
+TestTableDrivenSparse* TestTableDrivenSparse::default_instance_ = NULL;
+
+TestTableDrivenSparse* TestTableDrivenSparse::New() const {
+  return new TestTableDrivenSparse;
+}
+
+TestTableDrivenSparse* TestTableDrivenSparse::NewOnArena(
+    ::google::protobuf::Arena* arena) const {
+  return ::google::protobuf::Arena::CreateMessage<TestTableDrivenSparse>(arena);
+}
+
+void TestTableDrivenSparse::Clear() {
+  _extensions_.Clear();
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    optional_int32_ = 0;
+    if (_has_bit(1)) {
+      if (optional_string_ != &_default_optional_string_) {
+        optional_string_->clear();
+      }
+    }
+  }
+  repeated_int32_.Clear();
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool TestTableDrivenSparse::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto();
+  }
+  return ::google::protobuf::internal::MergePartialFromCodedStream(
+      this, *TestTableDrivenSparse_parse_table_, input);
+}
+
+void TestTableDrivenSparse::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // optional int32 optional_int32 = 1;
+  if (_has_bit(0)) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->optional_int32(), output);
+  }
+  
+  // optional string optional_string = 14;
+  if (_has_bit(1)) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->optional_string().data(), this->optional_string().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      14, this->optional_string(), output);
+  }
+  
+  // repeated int32 repeated_int32 = 31;
+  for (int i = 0; i < this->repeated_int32_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(
+      31, this->repeated_int32(i), output);
+  }
+  
+  // Extension range [1000, 536870912)
+  _extensions_.SerializeWithCachedSizes(
+      1000, 536870912, output);
+  
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google::protobuf::uint8* TestTableDrivenSparse::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // optional int32 optional_int32 = 1;
+  if (_has_bit(0)) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->optional_int32(), target);
+  }
+  
+  // optional string optional_string = 14;
+  if (_has_bit(1)) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->optional_string().data(), this->optional_string().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        14, this->optional_string(), target);
+  }
+  
+  // repeated int32 repeated_int32 = 31;
+  for (int i = 0; i < this->repeated_int32_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteInt32ToArray(31, this->repeated_int32(i), target);
+  }
+  
+  // Extension range [1000, 536870912)
+  target = _extensions_.SerializeWithCachedSizesToArray(
+      1000, 536870912, target);
+  
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int TestTableDrivenSparse::ByteSize() const {
+  int total_size = 0;
+  
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // optional int32 optional_int32 = 1;
+    if (has_optional_int32()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->optional_int32());
+    }
+    
+    // optional string optional_string = 14;
+    if (has_optional_string()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->optional_string());
+    }
+    
+  }
+  // repeated int32 repeated_int32 = 31;
+  {
+    int data_size = 0;
+    for (int i = 0; i < this->repeated_int32_size(); i++) {
+      data_size += ::google::protobuf::internal::WireFormatLite::
+        Int32Size(this->repeated_int32(i));
+    }
+    total_size += 2 * this->repeated_int32_size() + data_size;
+  }
+  
+  total_size += _extensions_.ByteSize();
+  
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
+  return total_size;
+}
+
+void TestTableDrivenSparse::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const TestTableDrivenSparse* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const TestTableDrivenSparse*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void TestTableDrivenSparse::MergeFrom(const TestTableDrivenSparse& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  repeated_int32_.MergeFrom(from.repeated_int32_);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from._has_bit(0)) {
+      set_optional_int32(from.optional_int32());
+    }
+    if (from._has_bit(1)) {
+      set_optional_string(from.optional_string());
+    }
+  }
+  _extensions_.MergeFrom(from._extensions_);
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void TestTableDrivenSparse::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void TestTableDrivenSparse::CopyFrom(const TestTableDrivenSparse& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestTableDrivenSparse::IsInitialized() const {
+  
+  
+  if (!_extensions_.IsInitialized()) return false;  return true;
+}
+
+void TestTableDrivenSparse::Swap(TestTableDrivenSparse* other) {
+  if (other != this) {
+    if (GetArena() != other->GetArena()) {
+      TestTableDrivenSparse temp;
+      temp.MergeFrom(*this);
+      CopyFrom(*other);
+      other->CopyFrom(temp);
+      return;
+    }
+    std::swap(optional_int32_, other->optional_int32_);
+    std::swap(optional_string_, other->optional_string_);
+    repeated_int32_.Swap(&other->repeated_int32_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+    _extensions_.Swap(&other->_extensions_);
+  }
+}
+
+::google::protobuf::Metadata TestTableDrivenSparse::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = TestTableDrivenSparse_descriptor_;
+  metadata.reflection = TestTableDrivenSparse_reflection_;
+  return metadata;
+}
+
+::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestTableDrivenSparse,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::google::protobuf::int32 >, 5, false >
+  sparse_int32_extension(kSparseInt32ExtensionFieldNumber, 0);
+const ::std::string sparse_string_extension_default("");
+::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestTableDrivenSparse,
+    ::google::protobuf::internal::RepeatedStringTypeTraits, 9, false >
+  sparse_string_extension(kSparseStringExtensionFieldNumber, sparse_string_extension_default);
+::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestTableDrivenSparse,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::TestTableDrivenSparse >, 11, false >
+  sparse_message_extension(kSparseMessageExtensionFieldNumber);
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace protobuf_unittest
+
+// @@protoc_insertion_point(global_scope)
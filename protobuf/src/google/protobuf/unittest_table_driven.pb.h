@@ -0,0 +1,4596 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/unittest_table_driven.proto
+
+#ifndef PROTOBUF_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto__INCLUDED
+#define PROTOBUF_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto__INCLUDED
+
+#include <string>
+
+#include <google/protobuf/stubs/common.h>
+
+#if GOOGLE_PROTOBUF_VERSION < 2003000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers.  Please update
+#error your headers.
+#endif
+#if 2003000 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers.  Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/repeated_field.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/string_piece_field.h>
+#include <google/protobuf/lazy_field.h>
+#include "google/protobuf/unittest.pb.h"
+#include "google/protobuf/unittest_import.pb.h"
+// @@protoc_insertion_point(includes)
+
+namespace protobuf_unittest {
+
+// Internal implementation detail -- do not call these.
+void  protobuf_AddDesc_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto();
+void  protobuf_InitDefaults_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto();
+void protobuf_InitDefaults_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto_impl();
+void protobuf_AssignDesc_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto();
+void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto();
+
+class TestTableDrivenAllTypes;
+class TestTableDrivenAllTypes_NestedMessage;
+class TestTableDrivenAllTypes_OptionalGroup;
+class TestTableDrivenAllTypes_RepeatedGroup;
+class TestTableDrivenPackedTypes;
+class TestTableDrivenUnpackedTypes;
+class TestTableDrivenLazyMessage;
+class TestTableDrivenSparse;
+
+enum TestTableDrivenAllTypes_NestedEnum {
+  TestTableDrivenAllTypes_NestedEnum_FOO = 1,
+  TestTableDrivenAllTypes_NestedEnum_BAR = 2,
+  TestTableDrivenAllTypes_NestedEnum_BAZ = 3
+};
+bool TestTableDrivenAllTypes_NestedEnum_IsValid(int value);
+const TestTableDrivenAllTypes_NestedEnum TestTableDrivenAllTypes_NestedEnum_NestedEnum_MIN = TestTableDrivenAllTypes_NestedEnum_FOO;
+const TestTableDrivenAllTypes_NestedEnum TestTableDrivenAllTypes_NestedEnum_NestedEnum_MAX = TestTableDrivenAllTypes_NestedEnum_BAZ;
+const int TestTableDrivenAllTypes_NestedEnum_NestedEnum_ARRAYSIZE = TestTableDrivenAllTypes_NestedEnum_NestedEnum_MAX + 1;
+
+const ::google::protobuf::EnumDescriptor* TestTableDrivenAllTypes_NestedEnum_descriptor();
+inline const ::std::string& TestTableDrivenAllTypes_NestedEnum_Name(TestTableDrivenAllTypes_NestedEnum value) {
+  return ::google::protobuf::internal::NameOfEnum(
+    TestTableDrivenAllTypes_NestedEnum_descriptor(), value);
+}
+inline bool TestTableDrivenAllTypes_NestedEnum_Parse(
+    const ::std::string& name, TestTableDrivenAllTypes_NestedEnum* value) {
+  return ::google::protobuf::internal::ParseNamedEnum<TestTableDrivenAllTypes_NestedEnum>(
+    TestTableDrivenAllTypes_NestedEnum_descriptor(), name, value);
+}
+// ===================================================================
+
+class TestTableDrivenAllTypes_NestedMessage : public ::google::protobuf::Message {
+ public:
+  TestTableDrivenAllTypes_NestedMessage();
+  virtual ~TestTableDrivenAllTypes_NestedMessage();
+  
+  TestTableDrivenAllTypes_NestedMessage(const TestTableDrivenAllTypes_NestedMessage& from);
+  
+  inline TestTableDrivenAllTypes_NestedMessage& operator=(const TestTableDrivenAllTypes_NestedMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  
+  explicit TestTableDrivenAllTypes_NestedMessage(::google::protobuf::Arena* arena);
+  inline ::google::protobuf::Arena* GetArena() const { return _arena_; }
+  TestTableDrivenAllTypes_NestedMessage* NewOnArena(::google::protobuf::Arena* arena) const;
+  // Tells Arena::CreateMessage() to use the constructor above.
+  typedef void InternalArenaConstructable_;
+  
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+  
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+  
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const TestTableDrivenAllTypes_NestedMessage& default_instance();
+  
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestTableDrivenAllTypes_NestedMessage* internal_default_instance() {
+    return default_instance_;
+  }
+  
+  void Swap(TestTableDrivenAllTypes_NestedMessage* other);
+  
+  // implements Message ----------------------------------------------
+  
+  TestTableDrivenAllTypes_NestedMessage* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const TestTableDrivenAllTypes_NestedMessage& from);
+  void MergeFrom(const TestTableDrivenAllTypes_NestedMessage& from);
+  void Clear();
+  bool IsInitialized() const;
+  
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+  
+  ::google::protobuf::Metadata GetMetadata() const;
+  
+  // nested types ----------------------------------------------------
+  
+  // accessors -------------------------------------------------------
+  
+  // optional int32 bb = 1;
+  inline bool has_bb() const;
+  inline void clear_bb();
+  static const int kBbFieldNumber = 1;
+  inline ::google::protobuf::int32 bb() const;
+  inline void set_bb(::google::protobuf::int32 value);
+  
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestTableDrivenAllTypes.NestedMessage)
+ private:
+  ::google::protobuf::Arena* _arena_;
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
+  
+  ::google::protobuf::int32 bb_;
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto_impl();
+  friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto();
+  friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto();
+  
+  ::google::protobuf::uint32 _has_bits_[(1 + 31) / 32];
+  
+  // WHY DOES & HAVE LOWER PRECEDENCE THAN != !?
+  inline bool _has_bit(int index) const {
+    return (_has_bits_[index / 32] & (1u << (index % 32))) != 0;
+  }
+  inline void _set_bit(int index) {
+    _has_bits_[index / 32] |= (1u << (index % 32));
+  }
+  inline void _clear_bit(int index) {
+    _has_bits_[index / 32] &= ~(1u << (index % 32));
+  }
+  
+  void InitAsDefaultInstance();
+  static TestTableDrivenAllTypes_NestedMessage* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class TestTableDrivenAllTypes_OptionalGroup : public ::google::protobuf::Message {
+ public:
+  TestTableDrivenAllTypes_OptionalGroup();
+  virtual ~TestTableDrivenAllTypes_OptionalGroup();
+  
+  TestTableDrivenAllTypes_OptionalGroup(const TestTableDrivenAllTypes_OptionalGroup& from);
+  
+  inline TestTableDrivenAllTypes_OptionalGroup& operator=(const TestTableDrivenAllTypes_OptionalGroup& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  
+  explicit TestTableDrivenAllTypes_OptionalGroup(::google::protobuf::Arena* arena);
+  inline ::google::protobuf::Arena* GetArena() const { return _arena_; }
+  TestTableDrivenAllTypes_OptionalGroup* NewOnArena(::google::protobuf::Arena* arena) const;
+  // Tells Arena::CreateMessage() to use the constructor above.
+  typedef void InternalArenaConstructable_;
+  
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+  
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+  
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const TestTableDrivenAllTypes_OptionalGroup& default_instance();
+  
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestTableDrivenAllTypes_OptionalGroup* internal_default_instance() {
+    return default_instance_;
+  }
+  
+  void Swap(TestTableDrivenAllTypes_OptionalGroup* other);
+  
+  // implements Message ----------------------------------------------
+  
+  TestTableDrivenAllTypes_OptionalGroup* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const TestTableDrivenAllTypes_OptionalGroup& from);
+  void MergeFrom(const TestTableDrivenAllTypes_OptionalGroup& from);
+  void Clear();
+  bool IsInitialized() const;
+  
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+  
+  ::google::protobuf::Metadata GetMetadata() const;
+  
+  // nested types ----------------------------------------------------
+  
+  // accessors -------------------------------------------------------
+  
+  // optional int32 a = 17;
+  inline bool has_a() const;
+  inline void clear_a();
+  static const int kAFieldNumber = 17;
+  inline ::google::protobuf::int32 a() const;
+  inline void set_a(::google::protobuf::int32 value);
+  
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestTableDrivenAllTypes.OptionalGroup)
+ private:
+  ::google::protobuf::Arena* _arena_;
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
+  
+  ::google::protobuf::int32 a_;
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto_impl();
+  friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto();
+  friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto();
+  
+  ::google::protobuf::uint32 _has_bits_[(1 + 31) / 32];
+  
+  // WHY DOES & HAVE LOWER PRECEDENCE THAN != !?
+  inline bool _has_bit(int index) const {
+    return (_has_bits_[index / 32] & (1u << (index % 32))) != 0;
+  }
+  inline void _set_bit(int index) {
+    _has_bits_[index / 32] |= (1u << (index % 32));
+  }
+  inline void _clear_bit(int index) {
+    _has_bits_[index / 32] &= ~(1u << (index % 32));
+  }
+  
+  void InitAsDefaultInstance();
+  static TestTableDrivenAllTypes_OptionalGroup* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class TestTableDrivenAllTypes_RepeatedGroup : public ::google::protobuf::Message {
+ public:
+  TestTableDrivenAllTypes_RepeatedGroup();
+  virtual ~TestTableDrivenAllTypes_RepeatedGroup();
+  
+  TestTableDrivenAllTypes_RepeatedGroup(const TestTableDrivenAllTypes_RepeatedGroup& from);
+  
+  inline TestTableDrivenAllTypes_RepeatedGroup& operator=(const TestTableDrivenAllTypes_RepeatedGroup& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  
+  explicit TestTableDrivenAllTypes_RepeatedGroup(::google::protobuf::Arena* arena);
+  inline ::google::protobuf::Arena* GetArena() const { return _arena_; }
+  TestTableDrivenAllTypes_RepeatedGroup* NewOnArena(::google::protobuf::Arena* arena) const;
+  // Tells Arena::CreateMessage() to use the constructor above.
+  typedef void InternalArenaConstructable_;
+  
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+  
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+  
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const TestTableDrivenAllTypes_RepeatedGroup& default_instance();
+  
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestTableDrivenAllTypes_RepeatedGroup* internal_default_instance() {
+    return default_instance_;
+  }
+  
+  void Swap(TestTableDrivenAllTypes_RepeatedGroup* other);
+  
+  // implements Message ----------------------------------------------
+  
+  TestTableDrivenAllTypes_RepeatedGroup* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const TestTableDrivenAllTypes_RepeatedGroup& from);
+  void MergeFrom(const TestTableDrivenAllTypes_RepeatedGroup& from);
+  void Clear();
+  bool IsInitialized() const;
+  
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+  
+  ::google::protobuf::Metadata GetMetadata() const;
+  
+  // nested types ----------------------------------------------------
+  
+  // accessors -------------------------------------------------------
+  
+  // optional int32 a = 47;
+  inline bool has_a() const;
+  inline void clear_a();
+  static const int kAFieldNumber = 47;
+  inline ::google::protobuf::int32 a() const;
+  inline void set_a(::google::protobuf::int32 value);
+  
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestTableDrivenAllTypes.RepeatedGroup)
+ private:
+  ::google::protobuf::Arena* _arena_;
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
+  
+  ::google::protobuf::int32 a_;
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto_impl();
+  friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto();
+  friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto();
+  
+  ::google::protobuf::uint32 _has_bits_[(1 + 31) / 32];
+  
+  // WHY DOES & HAVE LOWER PRECEDENCE THAN != !?
+  inline bool _has_bit(int index) const {
+    return (_has_bits_[index / 32] & (1u << (index % 32))) != 0;
+  }
+  inline void _set_bit(int index) {
+    _has_bits_[index / 32] |= (1u << (index % 32));
+  }
+  inline void _clear_bit(int index) {
+    _has_bits_[index / 32] &= ~(1u << (index % 32));
+  }
+  
+  void InitAsDefaultInstance();
+  static TestTableDrivenAllTypes_RepeatedGroup* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class TestTableDrivenAllTypes : public ::google::protobuf::Message {
+ public:
+  TestTableDrivenAllTypes();
+  virtual ~TestTableDrivenAllTypes();
+  
+  TestTableDrivenAllTypes(const TestTableDrivenAllTypes& from);
+  
+  inline TestTableDrivenAllTypes& operator=(const TestTableDrivenAllTypes& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  
+  explicit TestTableDrivenAllTypes(::google::protobuf::Arena* arena);
+  inline ::google::protobuf::Arena* GetArena() const { return _arena_; }
+  TestTableDrivenAllTypes* NewOnArena(::google::protobuf::Arena* arena) const;
+  // Tells Arena::CreateMessage() to use the constructor above.
+  typedef void InternalArenaConstructable_;
+  
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+  
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+  
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const TestTableDrivenAllTypes& default_instance();
+  
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestTableDrivenAllTypes* internal_default_instance() {
+    return default_instance_;
+  }
+  
+  void Swap(TestTableDrivenAllTypes* other);
+  
+  // implements Message ----------------------------------------------
+  
+  TestTableDrivenAllTypes* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const TestTableDrivenAllTypes& from);
+  void MergeFrom(const TestTableDrivenAllTypes& from);
+  void Clear();
+  bool IsInitialized() const;
+  
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+  
+  ::google::protobuf::Metadata GetMetadata() const;
+  
+  // nested types ----------------------------------------------------
+  
+  typedef TestTableDrivenAllTypes_NestedMessage NestedMessage;
+  typedef TestTableDrivenAllTypes_OptionalGroup OptionalGroup;
+  typedef TestTableDrivenAllTypes_RepeatedGroup RepeatedGroup;
+  
+  typedef TestTableDrivenAllTypes_NestedEnum NestedEnum;
+  static const NestedEnum FOO = TestTableDrivenAllTypes_NestedEnum_FOO;
+  static const NestedEnum BAR = TestTableDrivenAllTypes_NestedEnum_BAR;
+  static const NestedEnum BAZ = TestTableDrivenAllTypes_NestedEnum_BAZ;
+  static inline bool NestedEnum_IsValid(int value) {
+    return TestTableDrivenAllTypes_NestedEnum_IsValid(value);
+  }
+  static const NestedEnum NestedEnum_MIN =
+    TestTableDrivenAllTypes_NestedEnum_NestedEnum_MIN;
+  static const NestedEnum NestedEnum_MAX =
+    TestTableDrivenAllTypes_NestedEnum_NestedEnum_MAX;
+  static const int NestedEnum_ARRAYSIZE =
+    TestTableDrivenAllTypes_NestedEnum_NestedEnum_ARRAYSIZE;
+  static inline const ::google::protobuf::EnumDescriptor*
+  NestedEnum_descriptor() {
+    return TestTableDrivenAllTypes_NestedEnum_descriptor();
+  }
+  static inline const ::std::string& NestedEnum_Name(NestedEnum value) {
+    return TestTableDrivenAllTypes_NestedEnum_Name(value);
+  }
+  static inline bool NestedEnum_Parse(const ::std::string& name,
+      NestedEnum* value) {
+    return TestTableDrivenAllTypes_NestedEnum_Parse(name, value);
+  }
+  
+  // accessors -------------------------------------------------------
+  
+  // optional int32 optional_int32 = 1;
+  inline bool has_optional_int32() const;
+  inline void clear_optional_int32();
+  static const int kOptionalInt32FieldNumber = 1;
+  inline ::google::protobuf::int32 optional_int32() const;
+  inline void set_optional_int32(::google::protobuf::int32 value);
+  
+  // optional int64 optional_int64 = 2;
+  inline bool has_optional_int64() const;
+  inline void clear_optional_int64();
+  static const int kOptionalInt64FieldNumber = 2;
+  inline ::google::protobuf::int64 optional_int64() const;
+  inline void set_optional_int64(::google::protobuf::int64 value);
+  
+  // optional uint32 optional_uint32 = 3;
+  inline bool has_optional_uint32() const;
+  inline void clear_optional_uint32();
+  static const int kOptionalUint32FieldNumber = 3;
+  inline ::google::protobuf::uint32 optional_uint32() const;
+  inline void set_optional_uint32(::google::protobuf::uint32 value);
+  
+  // optional uint64 optional_uint64 = 4;
+  inline bool has_optional_uint64() const;
+  inline void clear_optional_uint64();
+  static const int kOptionalUint64FieldNumber = 4;
+  inline ::google::protobuf::uint64 optional_uint64() const;
+  inline void set_optional_uint64(::google::protobuf::uint64 value);
+  
+  // optional sint32 optional_sint32 = 5;
+  inline bool has_optional_sint32() const;
+  inline void clear_optional_sint32();
+  static const int kOptionalSint32FieldNumber = 5;
+  inline ::google::protobuf::int32 optional_sint32() const;
+  inline void set_optional_sint32(::google::protobuf::int32 value);
+  
+  // optional sint64 optional_sint64 = 6;
+  inline bool has_optional_sint64() const;
+  inline void clear_optional_sint64();
+  static const int kOptionalSint64FieldNumber = 6;
+  inline ::google::protobuf::int64 optional_sint64() const;
+  inline void set_optional_sint64(::google::protobuf::int64 value);
+  
+  // optional fixed32 optional_fixed32 = 7;
+  inline bool has_optional_fixed32() const;
+  inline void clear_optional_fixed32();
+  static const int kOptionalFixed32FieldNumber = 7;
+  inline ::google::protobuf::uint32 optional_fixed32() const;
+  inline void set_optional_fixed32(::google::protobuf::uint32 value);
+  
+  // optional fixed64 optional_fixed64 = 8;
+  inline bool has_optional_fixed64() const;
+  inline void clear_optional_fixed64();
+  static const int kOptionalFixed64FieldNumber = 8;
+  inline ::google::protobuf::uint64 optional_fixed64() const;
+  inline void set_optional_fixed64(::google::protobuf::uint64 value);
+  
+  // optional sfixed32 optional_sfixed32 = 9;
+  inline bool has_optional_sfixed32() const;
+  inline void clear_optional_sfixed32();
+  static const int kOptionalSfixed32FieldNumber = 9;
+  inline ::google::protobuf::int32 optional_sfixed32() const;
+  inline void set_optional_sfixed32(::google::protobuf::int32 value);
+  
+  // optional sfixed64 optional_sfixed64 = 10;
+  inline bool has_optional_sfixed64() const;
+  inline void clear_optional_sfixed64();
+  static const int kOptionalSfixed64FieldNumber = 10;
+  inline ::google::protobuf::int64 optional_sfixed64() const;
+  inline void set_optional_sfixed64(::google::protobuf::int64 value);
+  
+  // optional float optional_float = 11;
+  inline bool has_optional_float() const;
+  inline void clear_optional_float();
+  static const int kOptionalFloatFieldNumber = 11;
+  inline float optional_float() const;
+  inline void set_optional_float(float value);
+  
+  // optional double optional_double = 12;
+  inline bool has_optional_double() const;
+  inline void clear_optional_double();
+  static const int kOptionalDoubleFieldNumber = 12;
+  inline double optional_double() const;
+  inline void set_optional_double(double value);
+  
+  // optional bool optional_bool = 13;
+  inline bool has_optional_bool() const;
+  inline void clear_optional_bool();
+  static const int kOptionalBoolFieldNumber = 13;
+  inline bool optional_bool() const;
+  inline void set_optional_bool(bool value);
+  
+  // optional string optional_string = 14;
+  inline bool has_optional_string() const;
+  inline void clear_optional_string();
+  static const int kOptionalStringFieldNumber = 14;
+  inline const ::std::string& optional_string() const;
+  inline void set_optional_string(const ::std::string& value);
+  inline void set_optional_string(const char* value);
+  inline void set_optional_string(const char* value, size_t size);
+  inline ::std::string* mutable_optional_string();
+  
+  // optional bytes optional_bytes = 15;
+  inline bool has_optional_bytes() const;
+  inline void clear_optional_bytes();
+  static const int kOptionalBytesFieldNumber = 15;
+  inline const ::std::string& optional_bytes() const;
+  inline void set_optional_bytes(const ::std::string& value);
+  inline void set_optional_bytes(const char* value);
+  inline void set_optional_bytes(const void* value, size_t size);
+  inline ::std::string* mutable_optional_bytes();
+  
+  // optional group OptionalGroup = 16 {
+  inline bool has_optionalgroup() const;
+  inline void clear_optionalgroup();
+  static const int kOptionalgroupFieldNumber = 16;
+  inline const ::protobuf_unittest::TestTableDrivenAllTypes_OptionalGroup& optionalgroup() const;
+  inline ::protobuf_unittest::TestTableDrivenAllTypes_OptionalGroup* mutable_optionalgroup();
+  
+  // optional .protobuf_unittest.TestTableDrivenAllTypes.NestedMessage optional_nested_message = 18;
+  inline bool has_optional_nested_message() const;
+  inline void clear_optional_nested_message();
+  static const int kOptionalNestedMessageFieldNumber = 18;
+  inline const ::protobuf_unittest::TestTableDrivenAllTypes_NestedMessage& optional_nested_message() const;
+  inline ::protobuf_unittest::TestTableDrivenAllTypes_NestedMessage* mutable_optional_nested_message();
+  
+  // optional .protobuf_unittest.ForeignMessage optional_foreign_message = 19;
+  inline bool has_optional_foreign_message() const;
+  inline void clear_optional_foreign_message();
+  static const int kOptionalForeignMessageFieldNumber = 19;
+  inline const ::protobuf_unittest::ForeignMessage& optional_foreign_message() const;
+  inline ::protobuf_unittest::ForeignMessage* mutable_optional_foreign_message();
+  
+  // optional .protobuf_unittest_import.ImportMessage optional_import_message = 20;
+  inline bool has_optional_import_message() const;
+  inline void clear_optional_import_message();
+  static const int kOptionalImportMessageFieldNumber = 20;
+  inline const ::protobuf_unittest_import::ImportMessage& optional_import_message() const;
+  inline ::protobuf_unittest_import::ImportMessage* mutable_optional_import_message();
+  
+  // optional .protobuf_unittest.TestTableDrivenAllTypes.NestedEnum optional_nested_enum = 21;
+  inline bool has_optional_nested_enum() const;
+  inline void clear_optional_nested_enum();
+  static const int kOptionalNestedEnumFieldNumber = 21;
+  inline ::protobuf_unittest::TestTableDrivenAllTypes_NestedEnum optional_nested_enum() const;
+  inline void set_optional_nested_enum(::protobuf_unittest::TestTableDrivenAllTypes_NestedEnum value);
+  
+  // optional .protobuf_unittest.ForeignEnum optional_foreign_enum = 22;
+  inline bool has_optional_foreign_enum() const;
+  inline void clear_optional_foreign_enum();
+  static const int kOptionalForeignEnumFieldNumber = 22;
+  inline protobuf_unittest::ForeignEnum optional_foreign_enum() const;
+  inline void set_optional_foreign_enum(protobuf_unittest::ForeignEnum value);
+  
+  // optional .protobuf_unittest_import.ImportEnum optional_import_enum = 23;
+  inline bool has_optional_import_enum() const;
+  inline void clear_optional_import_enum();
+  static const int kOptionalImportEnumFieldNumber = 23;
+  inline protobuf_unittest_import::ImportEnum optional_import_enum() const;
+  inline void set_optional_import_enum(protobuf_unittest_import::ImportEnum value);
+  
+  // optional string optional_string_piece = 24 [ctype = STRING_PIECE];
+  inline bool has_optional_string_piece() const;
+  inline void clear_optional_string_piece();
+  static const int kOptionalStringPieceFieldNumber = 24;
+  inline const ::google::protobuf::internal::StringPieceField& optional_string_piece() const;
+  inline void set_optional_string_piece(const ::std::string& value);
+  inline void set_optional_string_piece(const char* value);
+  inline void set_optional_string_piece(const char* value, size_t size);
+  inline ::std::string* mutable_optional_string_piece();
+  
+  // optional string optional_cord = 25 [ctype = CORD];
+  inline bool has_optional_cord() const;
+  inline void clear_optional_cord();
+  static const int kOptionalCordFieldNumber = 25;
+ private:
+  // Hidden due to unknown ctype option.
+  inline const ::std::string& optional_cord() const;
+  inline void set_optional_cord(const ::std::string& value);
+  inline void set_optional_cord(const char* value);
+  inline void set_optional_cord(const char* value, size_t size);
+  inline ::std::string* mutable_optional_cord();
+ public:
+  
+  // repeated int32 repeated_int32 = 31;
+  inline int repeated_int32_size() const;
+  inline void clear_repeated_int32();
+  static const int kRepeatedInt32FieldNumber = 31;
+  inline ::google::protobuf::int32 repeated_int32(int index) const;
+  inline void set_repeated_int32(int index, ::google::protobuf::int32 value);
+  inline void add_repeated_int32(::google::protobuf::int32 value);
+  inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+      repeated_int32() const;
+  inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+      mutable_repeated_int32();
+  
+  // repeated int64 repeated_int64 = 32;
+  inline int repeated_int64_size() const;
+  inline void clear_repeated_int64();
+  static const int kRepeatedInt64FieldNumber = 32;
+  inline ::google::protobuf::int64 repeated_int64(int index) const;
+  inline void set_repeated_int64(int index, ::google::protobuf::int64 value);
+  inline void add_repeated_int64(::google::protobuf::int64 value);
+  inline const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
+      repeated_int64() const;
+  inline ::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
+      mutable_repeated_int64();
+  
+  // repeated uint32 repeated_uint32 = 33;
+  inline int repeated_uint32_size() const;
+  inline void clear_repeated_uint32();
+  static const int kRepeatedUint32FieldNumber = 33;
+  inline ::google::protobuf::uint32 repeated_uint32(int index) const;
+  inline void set_repeated_uint32(int index, ::google::protobuf::uint32 value);
+  inline void add_repeated_uint32(::google::protobuf::uint32 value);
+  inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+      repeated_uint32() const;
+  inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+      mutable_repeated_uint32();
+  
+  // repeated uint64 repeated_uint64 = 34;
+  inline int repeated_uint64_size() const;
+  inline void clear_repeated_uint64();
+  static const int kRepeatedUint64FieldNumber = 34;
+  inline ::google::protobuf::uint64 repeated_uint64(int index) const;
+  inline void set_repeated_uint64(int index, ::google::protobuf::uint64 value);
+  inline void add_repeated_uint64(::google::protobuf::uint64 value);
+  inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
+      repeated_uint64() const;
+  inline ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
+      mutable_repeated_uint64();
+  
+  // repeated sint32 repeated_sint32 = 35;
+  inline int repeated_sint32_size() const;
+  inline void clear_repeated_sint32();
+  static const int kRepeatedSint32FieldNumber = 35;
+  inline ::google::protobuf::int32 repeated_sint32(int index) const;
+  inline void set_repeated_sint32(int index, ::google::protobuf::int32 value);
+  inline void add_repeated_sint32(::google::protobuf::int32 value);
+  inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+      repeated_sint32() const;
+  inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+      mutable_repeated_sint32();
+  
+  // repeated sint64 repeated_sint64 = 36;
+  inline int repeated_sint64_size() const;
+  inline void clear_repeated_sint64();
+  static const int kRepeatedSint64FieldNumber = 36;
+  inline ::google::protobuf::int64 repeated_sint64(int index) const;
+  inline void set_repeated_sint64(int index, ::google::protobuf::int64 value);
+  inline void add_repeated_sint64(::google::protobuf::int64 value);
+  inline const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
+      repeated_sint64() const;
+  inline ::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
+      mutable_repeated_sint64();
+  
+  // repeated fixed32 repeated_fixed32 = 37;
+  inline int repeated_fixed32_size() const;
+  inline void clear_repeated_fixed32();
+  static const int kRepeatedFixed32FieldNumber = 37;
+  inline ::google::protobuf::uint32 repeated_fixed32(int index) const;
+  inline void set_repeated_fixed32(int index, ::google::protobuf::uint32 value);
+  inline void add_repeated_fixed32(::google::protobuf::uint32 value);
+  inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+      repeated_fixed32() const;
+  inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+      mutable_repeated_fixed32();
+  
+  // repeated fixed64 repeated_fixed64 = 38;
+  inline int repeated_fixed64_size() const;
+  inline void clear_repeated_fixed64();
+  static const int kRepeatedFixed64FieldNumber = 38;
+  inline ::google::protobuf::uint64 repeated_fixed64(int index) const;
+  inline void set_repeated_fixed64(int index, ::google::protobuf::uint64 value);
+  inline void add_repeated_fixed64(::google::protobuf::uint64 value);
+  inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
+      repeated_fixed64() const;
+  inline ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
+      mutable_repeated_fixed64();
+  
+  // repeated sfixed32 repeated_sfixed32 = 39;
+  inline int repeated_sfixed32_size() const;
+  inline void clear_repeated_sfixed32();
+  static const int kRepeatedSfixed32FieldNumber = 39;
+  inline ::google::protobuf::int32 repeated_sfixed32(int index) const;
+  inline void set_repeated_sfixed32(int index, ::google::protobuf::int32 value);
+  inline void add_repeated_sfixed32(::google::protobuf::int32 value);
+  inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+      repeated_sfixed32() const;
+  inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+      mutable_repeated_sfixed32();
+  
+  // repeated sfixed64 repeated_sfixed64 = 40;
+  inline int repeated_sfixed64_size() const;
+  inline void clear_repeated_sfixed64();
+  static const int kRepeatedSfixed64FieldNumber = 40;
+  inline ::google::protobuf::int64 repeated_sfixed64(int index) const;
+  inline void set_repeated_sfixed64(int index, ::google::protobuf::int64 value);
+  inline void add_repeated_sfixed64(::google::protobuf::int64 value);
+  inline const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
+      repeated_sfixed64() const;
+  inline ::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
+      mutable_repeated_sfixed64();
+  
+  // repeated float repeated_float = 41;
+  inline int repeated_float_size() const;
+  inline void clear_repeated_float();
+  static const int kRepeatedFloatFieldNumber = 41;
+  inline float repeated_float(int index) const;
+  inline void set_repeated_float(int index, float value);
+  inline void add_repeated_float(float value);
+  inline const ::google::protobuf::RepeatedField< float >&
+      repeated_float() const;
+  inline ::google::protobuf::RepeatedField< float >*
+      mutable_repeated_float();
+  
+  // repeated double repeated_double = 42;
+  inline int repeated_double_size() const;
+  inline void clear_repeated_double();
+  static const int kRepeatedDoubleFieldNumber = 42;
+  inline double repeated_double(int index) const;
+  inline void set_repeated_double(int index, double value);
+  inline void add_repeated_double(double value);
+  inline const ::google::protobuf::RepeatedField< double >&
+      repeated_double() const;
+  inline ::google::protobuf::RepeatedField< double >*
+      mutable_repeated_double();
+  
+  // repeated bool repeated_bool = 43;
+  inline int repeated_bool_size() const;
+  inline void clear_repeated_bool();
+  static const int kRepeatedBoolFieldNumber = 43;
+  inline bool repeated_bool(int index) const;
+  inline void set_repeated_bool(int index, bool value);
+  inline void add_repeated_bool(bool value);
+  inline const ::google::protobuf::RepeatedField< bool >&
+      repeated_bool() const;
+  inline ::google::protobuf::RepeatedField< bool >*
+      mutable_repeated_bool();
+  
+  // repeated string repeated_string = 44;
+  inline int repeated_string_size() const;
+  inline void clear_repeated_string();
+  static const int kRepeatedStringFieldNumber = 44;
+  inline const ::std::string& repeated_string(int index) const;
+  inline ::std::string* mutable_repeated_string(int index);
+  inline void set_repeated_string(int index, const ::std::string& value);
+  inline void set_repeated_string(int index, const char* value);
+  inline void set_repeated_string(int index, const char* value, size_t size);
+  inline ::std::string* add_repeated_string();
+  inline void add_repeated_string(const ::std::string& value);
+  inline void add_repeated_string(const char* value);
+  inline void add_repeated_string(const char* value, size_t size);
+  inline const ::google::protobuf::RepeatedPtrField< ::std::string>& repeated_string() const;
+  inline ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_repeated_string();
+  
+  // repeated bytes repeated_bytes = 45;
+  inline int repeated_bytes_size() const;
+  inline void clear_repeated_bytes();
+  static const int kRepeatedBytesFieldNumber = 45;
+  inline const ::std::string& repeated_bytes(int index) const;
+  inline ::std::string* mutable_repeated_bytes(int index);
+  inline void set_repeated_bytes(int index, const ::std::string& value);
+  inline void set_repeated_bytes(int index, const char* value);
+  inline void set_repeated_bytes(int index, const void* value, size_t size);
+  inline ::std::string* add_repeated_bytes();
+  inline void add_repeated_bytes(const ::std::string& value);
+  inline void add_repeated_bytes(const char* value);
+  inline void add_repeated_bytes(const void* value, size_t size);
+  inline const ::google::protobuf::RepeatedPtrField< ::std::string>& repeated_bytes() const;
+  inline ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_repeated_bytes();
+  
+  // repeated group RepeatedGroup = 46 {
+  inline int repeatedgroup_size() const;
+  inline void clear_repeatedgroup();
+  static const int kRepeatedgroupFieldNumber = 46;
+  inline const ::protobuf_unittest::TestTableDrivenAllTypes_RepeatedGroup& repeatedgroup(int index) const;
+  inline ::protobuf_unittest::TestTableDrivenAllTypes_RepeatedGroup* mutable_repeatedgroup(int index);
+  inline ::protobuf_unittest::TestTableDrivenAllTypes_RepeatedGroup* add_repeatedgroup();
+  inline const ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestTableDrivenAllTypes_RepeatedGroup >&
+      repeatedgroup() const;
+  inline ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestTableDrivenAllTypes_RepeatedGroup >*
+      mutable_repeatedgroup();
+  
+  // repeated .protobuf_unittest.TestTableDrivenAllTypes.NestedMessage repeated_nested_message = 48;
+  inline int repeated_nested_message_size() const;
+  inline void clear_repeated_nested_message();
+  static const int kRepeatedNestedMessageFieldNumber = 48;
+  inline const ::protobuf_unittest::TestTableDrivenAllTypes_NestedMessage& repeated_nested_message(int index) const;
+  inline ::protobuf_unittest::TestTableDrivenAllTypes_NestedMessage* mutable_repeated_nested_message(int index);
+  inline ::protobuf_unittest::TestTableDrivenAllTypes_NestedMessage* add_repeated_nested_message();
+  inline const ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestTableDrivenAllTypes_NestedMessage >&
+      repeated_nested_message() const;
+  inline ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestTableDrivenAllTypes_NestedMessage >*
+      mutable_repeated_nested_message();
+  
+  // repeated .protobuf_unittest.ForeignMessage repeated_foreign_message = 49;
+  inline int repeated_foreign_message_size() const;
+  inline void clear_repeated_foreign_message();
+  static const int kRepeatedForeignMessageFieldNumber = 49;
+  inline const ::protobuf_unittest::ForeignMessage& repeated_foreign_message(int index) const;
+  inline ::protobuf_unittest::ForeignMessage* mutable_repeated_foreign_message(int index);
+  inline ::protobuf_unittest::ForeignMessage* add_repeated_foreign_message();
+  inline const ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::ForeignMessage >&
+      repeated_foreign_message() const;
+  inline ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::ForeignMessage >*
+      mutable_repeated_foreign_message();
+  
+  // repeated .protobuf_unittest_import.ImportMessage repeated_import_message = 50;
+  inline int repeated_import_message_size() const;
+  inline void clear_repeated_import_message();
+  static const int kRepeatedImportMessageFieldNumber = 50;
+  inline const ::protobuf_unittest_import::ImportMessage& repeated_import_message(int index) const;
+  inline ::protobuf_unittest_import::ImportMessage* mutable_repeated_import_message(int index);
+  inline ::protobuf_unittest_import::ImportMessage* add_repeated_import_message();
+  inline const ::google::protobuf::RepeatedPtrField< ::protobuf_unittest_import::ImportMessage >&
+      repeated_import_message() const;
+  inline ::google::protobuf::RepeatedPtrField< ::protobuf_unittest_import::ImportMessage >*
+      mutable_repeated_import_message();
+  
+  // repeated .protobuf_unittest.TestTableDrivenAllTypes.NestedEnum repeated_nested_enum = 51;
+  inline int repeated_nested_enum_size() const;
+  inline void clear_repeated_nested_enum();
+  static const int kRepeatedNestedEnumFieldNumber = 51;
+  inline ::protobuf_unittest::TestTableDrivenAllTypes_NestedEnum repeated_nested_enum(int index) const;
+  inline void set_repeated_nested_enum(int index, ::protobuf_unittest::TestTableDrivenAllTypes_NestedEnum value);
+  inline void add_repeated_nested_enum(::protobuf_unittest::TestTableDrivenAllTypes_NestedEnum value);
+  inline const ::google::protobuf::RepeatedField<int>& repeated_nested_enum() const;
+  inline ::google::protobuf::RepeatedField<int>* mutable_repeated_nested_enum();
+  
+  // repeated .protobuf_unittest.ForeignEnum repeated_foreign_enum = 52;
+  inline int repeated_foreign_enum_size() const;
+  inline void clear_repeated_foreign_enum();
+  static const int kRepeatedForeignEnumFieldNumber = 52;
+  inline protobuf_unittest::ForeignEnum repeated_foreign_enum(int index) const;
+  inline void set_repeated_foreign_enum(int index, protobuf_unittest::ForeignEnum value);
+  inline void add_repeated_foreign_enum(protobuf_unittest::ForeignEnum value);
+  inline const ::google::protobuf::RepeatedField<int>& repeated_foreign_enum() const;
+  inline ::google::protobuf::RepeatedField<int>* mutable_repeated_foreign_enum();
+  
+  // repeated .protobuf_unittest_import.ImportEnum repeated_import_enum = 53;
+  inline int repeated_import_enum_size() const;
+  inline void clear_repeated_import_enum();
+  static const int kRepeatedImportEnumFieldNumber = 53;
+  inline protobuf_unittest_import::ImportEnum repeated_import_enum(int index) const;
+  inline void set_repeated_import_enum(int index, protobuf_unittest_import::ImportEnum value);
+  inline void add_repeated_import_enum(protobuf_unittest_import::ImportEnum value);
+  inline const ::google::protobuf::RepeatedField<int>& repeated_import_enum() const;
+  inline ::google::protobuf::RepeatedField<int>* mutable_repeated_import_enum();
+  
+  // repeated string repeated_string_piece = 54 [ctype = STRING_PIECE];
+  inline int repeated_string_piece_size() const;
+  inline void clear_repeated_string_piece();
+  static const int kRepeatedStringPieceFieldNumber = 54;
+  inline const ::google::protobuf::internal::StringPieceField& repeated_string_piece(int index) const;
+  inline ::std::string* mutable_repeated_string_piece(int index);
+  inline void set_repeated_string_piece(int index, const ::std::string& value);
+  inline void set_repeated_string_piece(int index, const char* value);
+  inline void set_repeated_string_piece(int index, const char* value, size_t size);
+  inline ::std::string* add_repeated_string_piece();
+  inline void add_repeated_string_piece(const ::std::string& value);
+  inline void add_repeated_string_piece(const char* value);
+  inline void add_repeated_string_piece(const char* value, size_t size);
+  inline const ::google::protobuf::RepeatedPtrField< ::google::protobuf::internal::StringPieceField>& repeated_string_piece() const;
+  inline ::google::protobuf::RepeatedPtrField< ::google::protobuf::internal::StringPieceField>* mutable_repeated_string_piece();
+  
+  // repeated string repeated_cord = 55 [ctype = CORD];
+  inline int repeated_cord_size() const;
+  inline void clear_repeated_cord();
+  static const int kRepeatedCordFieldNumber = 55;
+ private:
+  // Hidden due to unknown ctype option.
+  inline const ::std::string& repeated_cord(int index) const;
+  inline ::std::string* mutable_repeated_cord(int index);
+  inline void set_repeated_cord(int index, const ::std::string& value);
+  inline void set_repeated_cord(int index, const char* value);
+  inline void set_repeated_cord(int index, const char* value, size_t size);
+  inline ::std::string* add_repeated_cord();
+  inline void add_repeated_cord(const ::std::string& value);
+  inline void add_repeated_cord(const char* value);
+  inline void add_repeated_cord(const char* value, size_t size);
+  inline const ::google::protobuf::RepeatedPtrField< ::std::string>& repeated_cord() const;
+  inline ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_repeated_cord();
+ public:
+  
+  // optional int32 default_int32 = 61 [default = 41];
+  inline bool has_default_int32() const;
+  inline void clear_default_int32();
+  static const int kDefaultInt32FieldNumber = 61;
+  inline ::google::protobuf::int32 default_int32() const;
+  inline void set_default_int32(::google::protobuf::int32 value);
+  
+  // optional int64 default_int64 = 62 [default = 42];
+  inline bool has_default_int64() const;
+  inline void clear_default_int64();
+  static const int kDefaultInt64FieldNumber = 62;
+  inline ::google::protobuf::int64 default_int64() const;
+  inline void set_default_int64(::google::protobuf::int64 value);
+  
+  // optional uint32 default_uint32 = 63 [default = 43];
+  inline bool has_default_uint32() const;
+  inline void clear_default_uint32();
+  static const int kDefaultUint32FieldNumber = 63;
+  inline ::google::protobuf::uint32 default_uint32() const;
+  inline void set_default_uint32(::google::protobuf::uint32 value);
+  
+  // optional uint64 default_uint64 = 64 [default = 44];
+  inline bool has_default_uint64() const;
+  inline void clear_default_uint64();
+  static const int kDefaultUint64FieldNumber = 64;
+  inline ::google::protobuf::uint64 default_uint64() const;
+  inline void set_default_uint64(::google::protobuf::uint64 value);
+  
+  // optional sint32 default_sint32 = 65 [default = -45];
+  inline bool has_default_sint32() const;
+  inline void clear_default_sint32();
+  static const int kDefaultSint32FieldNumber = 65;
+  inline ::google::protobuf::int32 default_sint32() const;
+  inline void set_default_sint32(::google::protobuf::int32 value);
+  
+  // optional sint64 default_sint64 = 66 [default = 46];
+  inline bool has_default_sint64() const;
+  inline void clear_default_sint64();
+  static const int kDefaultSint64FieldNumber = 66;
+  inline ::google::protobuf::int64 default_sint64() const;
+  inline void set_default_sint64(::google::protobuf::int64 value);
+  
+  // optional fixed32 default_fixed32 = 67 [default = 47];
+  inline bool has_default_fixed32() const;
+  inline void clear_default_fixed32();
+  static const int kDefaultFixed32FieldNumber = 67;
+  inline ::google::protobuf::uint32 default_fixed32() const;
+  inline void set_default_fixed32(::google::protobuf::uint32 value);
+  
+  // optional fixed64 default_fixed64 = 68 [default = 48];
+  inline bool has_default_fixed64() const;
+  inline void clear_default_fixed64();
+  static const int kDefaultFixed64FieldNumber = 68;
+  inline ::google::protobuf::uint64 default_fixed64() const;
+  inline void set_default_fixed64(::google::protobuf::uint64 value);
+  
+  // optional sfixed32 default_sfixed32 = 69 [default = 49];
+  inline bool has_default_sfixed32() const;
+  inline void clear_default_sfixed32();
+  static const int kDefaultSfixed32FieldNumber = 69;
+  inline ::google::protobuf::int32 default_sfixed32() const;
+  inline void set_default_sfixed32(::google::protobuf::int32 value);
+  
+  // optional sfixed64 default_sfixed64 = 70 [default = -50];
+  inline bool has_default_sfixed64() const;
+  inline void clear_default_sfixed64();
+  static const int kDefaultSfixed64FieldNumber = 70;
+  inline ::google::protobuf::int64 default_sfixed64() const;
+  inline void set_default_sfixed64(::google::protobuf::int64 value);
+  
+  // optional float default_float = 71 [default = 51.5];
+  inline bool has_default_float() const;
+  inline void clear_default_float();
+  static const int kDefaultFloatFieldNumber = 71;
+  inline float default_float() const;
+  inline void set_default_float(float value);
+  
+  // optional double default_double = 72 [default = 52000];
+  inline bool has_default_double() const;
+  inline void clear_default_double();
+  static const int kDefaultDoubleFieldNumber = 72;
+  inline double default_double() const;
+  inline void set_default_double(double value);
+  
+  // optional bool default_bool = 73 [default = true];
+  inline bool has_default_bool() const;
+  inline void clear_default_bool();
+  static const int kDefaultBoolFieldNumber = 73;
+  inline bool default_bool() const;
+  inline void set_default_bool(bool value);
+  
+  // optional string default_string = 74 [default = "hello"];
+  inline bool has_default_string() const;
+  inline void clear_default_string();
+  static const int kDefaultStringFieldNumber = 74;
+  inline const ::std::string& default_string() const;
+  inline void set_default_string(const ::std::string& value);
+  inline void set_default_string(const char* value);
+  inline void set_default_string(const char* value, size_t size);
+  inline ::std::string* mutable_default_string();
+  
+  // optional bytes default_bytes = 75 [default = "world"];
+  inline bool has_default_bytes() const;
+  inline void clear_default_bytes();
+  static const int kDefaultBytesFieldNumber = 75;
+  inline const ::std::string& default_bytes() const;
+  inline void set_default_bytes(const ::std::string& value);
+  inline void set_default_bytes(const char* value);
+  inline void set_default_bytes(const void* value, size_t size);
+  inline ::std::string* mutable_default_bytes();
+  
+  // optional .protobuf_unittest.TestTableDrivenAllTypes.NestedEnum default_nested_enum = 81 [default = BAR];
+  inline bool has_default_nested_enum() const;
+  inline void clear_default_nested_enum();
+  static const int kDefaultNestedEnumFieldNumber = 81;
+  inline ::protobuf_unittest::TestTableDrivenAllTypes_NestedEnum default_nested_enum() const;
+  inline void set_default_nested_enum(::protobuf_unittest::TestTableDrivenAllTypes_NestedEnum value);
+  
+  // optional .protobuf_unittest.ForeignEnum default_foreign_enum = 82 [default = FOREIGN_BAR];
+  inline bool has_default_foreign_enum() const;
+  inline void clear_default_foreign_enum();
+  static const int kDefaultForeignEnumFieldNumber = 82;
+  inline protobuf_unittest::ForeignEnum default_foreign_enum() const;
+  inline void set_default_foreign_enum(protobuf_unittest::ForeignEnum value);
+  
+  // optional .protobuf_unittest_import.ImportEnum default_import_enum = 83 [default = IMPORT_BAR];
+  inline bool has_default_import_enum() const;
+  inline void clear_default_import_enum();
+  static const int kDefaultImportEnumFieldNumber = 83;
+  inline protobuf_unittest_import::ImportEnum default_import_enum() const;
+  inline void set_default_import_enum(protobuf_unittest_import::ImportEnum value);
+  
+  // optional string default_string_piece = 84 [default = "abc", ctype = STRING_PIECE];
+  inline bool has_default_string_piece() const;
+  inline void clear_default_string_piece();
+  static const int kDefaultStringPieceFieldNumber = 84;
+  inline const ::google::protobuf::internal::StringPieceField& default_string_piece() const;
+  inline void set_default_string_piece(const ::std::string& value);
+  inline void set_default_string_piece(const char* value);
+  inline void set_default_string_piece(const char* value, size_t size);
+  inline ::std::string* mutable_default_string_piece();
+  
+  // optional string default_cord = 85 [default = "123", ctype = CORD];
+  inline bool has_default_cord() const;
+  inline void clear_default_cord();
+  static const int kDefaultCordFieldNumber = 85;
+ private:
+  // Hidden due to unknown ctype option.
+  inline const ::std::string& default_cord() const;
+  inline void set_default_cord(const ::std::string& value);
+  inline void set_default_cord(const char* value);
+  inline void set_default_cord(const char* value, size_t size);
+  inline ::std::string* mutable_default_cord();
+ public:
+  
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestTableDrivenAllTypes)
+ private:
+  ::google::protobuf::Arena* _arena_;
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
+  
+  ::google::protobuf::int32 optional_int32_;
+  ::google::protobuf::int64 optional_int64_;
+  ::google::protobuf::uint32 optional_uint32_;
+  ::google::protobuf::uint64 optional_uint64_;
+  ::google::protobuf::int32 optional_sint32_;
+  ::google::protobuf::int64 optional_sint64_;
+  ::google::protobuf::uint32 optional_fixed32_;
+  ::google::protobuf::uint64 optional_fixed64_;
+  ::google::protobuf::int32 optional_sfixed32_;
+  ::google::protobuf::int64 optional_sfixed64_;
+  float optional_float_;
+  double optional_double_;
+  bool optional_bool_;
+  ::std::string* optional_string_;
+  static const ::std::string _default_optional_string_;
+  ::std::string* optional_bytes_;
+  static const ::std::string _default_optional_bytes_;
+  ::protobuf_unittest::TestTableDrivenAllTypes_OptionalGroup* optionalgroup_;
+  ::protobuf_unittest::TestTableDrivenAllTypes_NestedMessage* optional_nested_message_;
+  ::protobuf_unittest::ForeignMessage* optional_foreign_message_;
+  ::protobuf_unittest_import::ImportMessage* optional_import_message_;
+  int optional_nested_enum_;
+  int optional_foreign_enum_;
+  int optional_import_enum_;
+  ::google::protobuf::internal::StringPieceField optional_string_piece_;
+  ::std::string* optional_cord_;
+  static const ::std::string _default_optional_cord_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int32 > repeated_int32_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int64 > repeated_int64_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 > repeated_uint32_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint64 > repeated_uint64_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int32 > repeated_sint32_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int64 > repeated_sint64_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 > repeated_fixed32_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint64 > repeated_fixed64_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int32 > repeated_sfixed32_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int64 > repeated_sfixed64_;
+  ::google::protobuf::RepeatedField< float > repeated_float_;
+  ::google::protobuf::RepeatedField< double > repeated_double_;
+  ::google::protobuf::RepeatedField< bool > repeated_bool_;
+  ::google::protobuf::RepeatedPtrField< ::std::string> repeated_string_;
+  ::google::protobuf::RepeatedPtrField< ::std::string> repeated_bytes_;
+  ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestTableDrivenAllTypes_RepeatedGroup > repeatedgroup_;
+  ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestTableDrivenAllTypes_NestedMessage > repeated_nested_message_;
+  ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::ForeignMessage > repeated_foreign_message_;
+  ::google::protobuf::RepeatedPtrField< ::protobuf_unittest_import::ImportMessage > repeated_import_message_;
+  ::google::protobuf::RepeatedField<int> repeated_nested_enum_;
+  ::google::protobuf::RepeatedField<int> repeated_foreign_enum_;
+  ::google::protobuf::RepeatedField<int> repeated_import_enum_;
+  ::google::protobuf::RepeatedPtrField< ::google::protobuf::internal::StringPieceField> repeated_string_piece_;
+  ::google::protobuf::RepeatedPtrField< ::std::string> repeated_cord_;
+  ::google::protobuf::int32 default_int32_;
+  ::google::protobuf::int64 default_int64_;
+  ::google::protobuf::uint32 default_uint32_;
+  ::google::protobuf::uint64 default_uint64_;
+  ::google::protobuf::int32 default_sint32_;
+  ::google::protobuf::int64 default_sint64_;
+  ::google::protobuf::uint32 default_fixed32_;
+  ::google::protobuf::uint64 default_fixed64_;
+  ::google::protobuf::int32 default_sfixed32_;
+  ::google::protobuf::int64 default_sfixed64_;
+  float default_float_;
+  double default_double_;
+  bool default_bool_;
+  ::std::string* default_string_;
+  static const ::std::string _default_default_string_;
+  ::std::string* default_bytes_;
+  static const ::std::string _default_default_bytes_;
+  int default_nested_enum_;
+  int default_foreign_enum_;
+  int default_import_enum_;
+  ::google::protobuf::internal::StringPieceField default_string_piece_;
+  ::std::string* default_cord_;
+  static const ::std::string _default_default_cord_;
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto_impl();
+  friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto();
+  friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto();
+  
+  ::google::protobuf::uint32 _has_bits_[(68 + 31) / 32];
+  
+  // WHY DOES & HAVE LOWER PRECEDENCE THAN != !?
+  inline bool _has_bit(int index) const {
+    return (_has_bits_[index / 32] & (1u << (index % 32))) != 0;
+  }
+  inline void _set_bit(int index) {
+    _has_bits_[index / 32] |= (1u << (index % 32));
+  }
+  inline void _clear_bit(int index) {
+    _has_bits_[index / 32] &= ~(1u << (index % 32));
+  }
+  
+  void InitAsDefaultInstance();
+  static TestTableDrivenAllTypes* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class TestTableDrivenPackedTypes : public ::google::protobuf::Message {
+ public:
+  TestTableDrivenPackedTypes();
+  virtual ~TestTableDrivenPackedTypes();
+  
+  TestTableDrivenPackedTypes(const TestTableDrivenPackedTypes& from);
+  
+  inline TestTableDrivenPackedTypes& operator=(const TestTableDrivenPackedTypes& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  
+  explicit TestTableDrivenPackedTypes(::google::protobuf::Arena* arena);
+  inline ::google::protobuf::Arena* GetArena() const { return _arena_; }
+  TestTableDrivenPackedTypes* NewOnArena(::google::protobuf::Arena* arena) const;
+  // Tells Arena::CreateMessage() to use the constructor above.
+  typedef void InternalArenaConstructable_;
+  
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+  
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+  
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const TestTableDrivenPackedTypes& default_instance();
+  
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestTableDrivenPackedTypes* internal_default_instance() {
+    return default_instance_;
+  }
+  
+  void Swap(TestTableDrivenPackedTypes* other);
+  
+  // implements Message ----------------------------------------------
+  
+  TestTableDrivenPackedTypes* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const TestTableDrivenPackedTypes& from);
+  void MergeFrom(const TestTableDrivenPackedTypes& from);
+  void Clear();
+  bool IsInitialized() const;
+  
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+  
+  ::google::protobuf::Metadata GetMetadata() const;
+  
+  // nested types ----------------------------------------------------
+  
+  // accessors -------------------------------------------------------
+  
+  // repeated int32 packed_int32 = 90 [packed = true];
+  inline int packed_int32_size() const;
+  inline void clear_packed_int32();
+  static const int kPackedInt32FieldNumber = 90;
+  inline ::google::protobuf::int32 packed_int32(int index) const;
+  inline void set_packed_int32(int index, ::google::protobuf::int32 value);
+  inline void add_packed_int32(::google::protobuf::int32 value);
+  inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+      packed_int32() const;
+  inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+      mutable_packed_int32();
+  
+  // repeated int64 packed_int64 = 91 [packed = true];
+  inline int packed_int64_size() const;
+  inline void clear_packed_int64();
+  static const int kPackedInt64FieldNumber = 91;
+  inline ::google::protobuf::int64 packed_int64(int index) const;
+  inline void set_packed_int64(int index, ::google::protobuf::int64 value);
+  inline void add_packed_int64(::google::protobuf::int64 value);
+  inline const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
+      packed_int64() const;
+  inline ::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
+      mutable_packed_int64();
+  
+  // repeated uint32 packed_uint32 = 92 [packed = true];
+  inline int packed_uint32_size() const;
+  inline void clear_packed_uint32();
+  static const int kPackedUint32FieldNumber = 92;
+  inline ::google::protobuf::uint32 packed_uint32(int index) const;
+  inline void set_packed_uint32(int index, ::google::protobuf::uint32 value);
+  inline void add_packed_uint32(::google::protobuf::uint32 value);
+  inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+      packed_uint32() const;
+  inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+      mutable_packed_uint32();
+  
+  // repeated uint64 packed_uint64 = 93 [packed = true];
+  inline int packed_uint64_size() const;
+  inline void clear_packed_uint64();
+  static const int kPackedUint64FieldNumber = 93;
+  inline ::google::protobuf::uint64 packed_uint64(int index) const;
+  inline void set_packed_uint64(int index, ::google::protobuf::uint64 value);
+  inline void add_packed_uint64(::google::protobuf::uint64 value);
+  inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
+      packed_uint64() const;
+  inline ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
+      mutable_packed_uint64();
+  
+  // repeated sint32 packed_sint32 = 94 [packed = true];
+  inline int packed_sint32_size() const;
+  inline void clear_packed_sint32();
+  static const int kPackedSint32FieldNumber = 94;
+  inline ::google::protobuf::int32 packed_sint32(int index) const;
+  inline void set_packed_sint32(int index, ::google::protobuf::int32 value);
+  inline void add_packed_sint32(::google::protobuf::int32 value);
+  inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+      packed_sint32() const;
+  inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+      mutable_packed_sint32();
+  
+  // repeated sint64 packed_sint64 = 95 [packed = true];
+  inline int packed_sint64_size() const;
+  inline void clear_packed_sint64();
+  static const int kPackedSint64FieldNumber = 95;
+  inline ::google::protobuf::int64 packed_sint64(int index) const;
+  inline void set_packed_sint64(int index, ::google::protobuf::int64 value);
+  inline void add_packed_sint64(::google::protobuf::int64 value);
+  inline const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
+      packed_sint64() const;
+  inline ::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
+      mutable_packed_sint64();
+  
+  // repeated fixed32 packed_fixed32 = 96 [packed = true];
+  inline int packed_fixed32_size() const;
+  inline void clear_packed_fixed32();
+  static const int kPackedFixed32FieldNumber = 96;
+  inline ::google::protobuf::uint32 packed_fixed32(int index) const;
+  inline void set_packed_fixed32(int index, ::google::protobuf::uint32 value);
+  inline void add_packed_fixed32(::google::protobuf::uint32 value);
+  inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+      packed_fixed32() const;
+  inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+      mutable_packed_fixed32();
+  
+  // repeated fixed64 packed_fixed64 = 97 [packed = true];
+  inline int packed_fixed64_size() const;
+  inline void clear_packed_fixed64();
+  static const int kPackedFixed64FieldNumber = 97;
+  inline ::google::protobuf::uint64 packed_fixed64(int index) const;
+  inline void set_packed_fixed64(int index, ::google::protobuf::uint64 value);
+  inline void add_packed_fixed64(::google::protobuf::uint64 value);
+  inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
+      packed_fixed64() const;
+  inline ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
+      mutable_packed_fixed64();
+  
+  // repeated sfixed32 packed_sfixed32 = 98 [packed = true];
+  inline int packed_sfixed32_size() const;
+  inline void clear_packed_sfixed32();
+  static const int kPackedSfixed32FieldNumber = 98;
+  inline ::google::protobuf::int32 packed_sfixed32(int index) const;
+  inline void set_packed_sfixed32(int index, ::google::protobuf::int32 value);
+  inline void add_packed_sfixed32(::google::protobuf::int32 value);
+  inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+      packed_sfixed32() const;
+  inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+      mutable_packed_sfixed32();
+  
+  // repeated sfixed64 packed_sfixed64 = 99 [packed = true];
+  inline int packed_sfixed64_size() const;
+  inline void clear_packed_sfixed64();
+  static const int kPackedSfixed64FieldNumber = 99;
+  inline ::google::protobuf::int64 packed_sfixed64(int index) const;
+  inline void set_packed_sfixed64(int index, ::google::protobuf::int64 value);
+  inline void add_packed_sfixed64(::google::protobuf::int64 value);
+  inline const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
+      packed_sfixed64() const;
+  inline ::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
+      mutable_packed_sfixed64();
+  
+  // repeated float packed_float = 100 [packed = true];
+  inline int packed_float_size() const;
+  inline void clear_packed_float();
+  static const int kPackedFloatFieldNumber = 100;
+  inline float packed_float(int index) const;
+  inline void set_packed_float(int index, float value);
+  inline void add_packed_float(float value);
+  inline const ::google::protobuf::RepeatedField< float >&
+      packed_float() const;
+  inline ::google::protobuf::RepeatedField< float >*
+      mutable_packed_float();
+  
+  // repeated double packed_double = 101 [packed = true];
+  inline int packed_double_size() const;
+  inline void clear_packed_double();
+  static const int kPackedDoubleFieldNumber = 101;
+  inline double packed_double(int index) const;
+  inline void set_packed_double(int index, double value);
+  inline void add_packed_double(double value);
+  inline const ::google::protobuf::RepeatedField< double >&
+      packed_double() const;
+  inline ::google::protobuf::RepeatedField< double >*
+      mutable_packed_double();
+  
+  // repeated bool packed_bool = 102 [packed = true];
+  inline int packed_bool_size() const;
+  inline void clear_packed_bool();
+  static const int kPackedBoolFieldNumber = 102;
+  inline bool packed_bool(int index) const;
+  inline void set_packed_bool(int index, bool value);
+  inline void add_packed_bool(bool value);
+  inline const ::google::protobuf::RepeatedField< bool >&
+      packed_bool() const;
+  inline ::google::protobuf::RepeatedField< bool >*
+      mutable_packed_bool();
+  
+  // repeated .protobuf_unittest.ForeignEnum packed_enum = 103 [packed = true];
+  inline int packed_enum_size() const;
+  inline void clear_packed_enum();
+  static const int kPackedEnumFieldNumber = 103;
+  inline protobuf_unittest::ForeignEnum packed_enum(int index) const;
+  inline void set_packed_enum(int index, protobuf_unittest::ForeignEnum value);
+  inline void add_packed_enum(protobuf_unittest::ForeignEnum value);
+  inline const ::google::protobuf::RepeatedField<int>& packed_enum() const;
+  inline ::google::protobuf::RepeatedField<int>* mutable_packed_enum();
+  
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestTableDrivenPackedTypes)
+ private:
+  ::google::protobuf::Arena* _arena_;
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
+  
+  ::google::protobuf::RepeatedField< ::google::protobuf::int32 > packed_int32_;
+  mutable ::google::protobuf::internal::Atomic32 _packed_int32_cached_byte_size_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int64 > packed_int64_;
+  mutable ::google::protobuf::internal::Atomic32 _packed_int64_cached_byte_size_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 > packed_uint32_;
+  mutable ::google::protobuf::internal::Atomic32 _packed_uint32_cached_byte_size_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint64 > packed_uint64_;
+  mutable ::google::protobuf::internal::Atomic32 _packed_uint64_cached_byte_size_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int32 > packed_sint32_;
+  mutable ::google::protobuf::internal::Atomic32 _packed_sint32_cached_byte_size_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int64 > packed_sint64_;
+  mutable ::google::protobuf::internal::Atomic32 _packed_sint64_cached_byte_size_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 > packed_fixed32_;
+  mutable ::google::protobuf::internal::Atomic32 _packed_fixed32_cached_byte_size_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint64 > packed_fixed64_;
+  mutable ::google::protobuf::internal::Atomic32 _packed_fixed64_cached_byte_size_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int32 > packed_sfixed32_;
+  mutable ::google::protobuf::internal::Atomic32 _packed_sfixed32_cached_byte_size_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int64 > packed_sfixed64_;
+  mutable ::google::protobuf::internal::Atomic32 _packed_sfixed64_cached_byte_size_;
+  ::google::protobuf::RepeatedField< float > packed_float_;
+  mutable ::google::protobuf::internal::Atomic32 _packed_float_cached_byte_size_;
+  ::google::protobuf::RepeatedField< double > packed_double_;
+  mutable ::google::protobuf::internal::Atomic32 _packed_double_cached_byte_size_;
+  ::google::protobuf::RepeatedField< bool > packed_bool_;
+  mutable ::google::protobuf::internal::Atomic32 _packed_bool_cached_byte_size_;
+  ::google::protobuf::RepeatedField<int> packed_enum_;
+  mutable ::google::protobuf::internal::Atomic32 _packed_enum_cached_byte_size_;
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto_impl();
+  friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto();
+  friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto();
+  
+  ::google::protobuf::uint32 _has_bits_[(14 + 31) / 32];
+  
+  // WHY DOES & HAVE LOWER PRECEDENCE THAN != !?
+  inline bool _has_bit(int index) const {
+    return (_has_bits_[index / 32] & (1u << (index % 32))) != 0;
+  }
+  inline void _set_bit(int index) {
+    _has_bits_[index / 32] |= (1u << (index % 32));
+  }
+  inline void _clear_bit(int index) {
+    _has_bits_[index / 32] &= ~(1u << (index % 32));
+  }
+  
+  void InitAsDefaultInstance();
+  static TestTableDrivenPackedTypes* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class TestTableDrivenUnpackedTypes : public ::google::protobuf::Message {
+ public:
+  TestTableDrivenUnpackedTypes();
+  virtual ~TestTableDrivenUnpackedTypes();
+  
+  TestTableDrivenUnpackedTypes(const TestTableDrivenUnpackedTypes& from);
+  
+  inline TestTableDrivenUnpackedTypes& operator=(const TestTableDrivenUnpackedTypes& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  
+  explicit TestTableDrivenUnpackedTypes(::google::protobuf::Arena* arena);
+  inline ::google::protobuf::Arena* GetArena() const { return _arena_; }
+  TestTableDrivenUnpackedTypes* NewOnArena(::google::protobuf::Arena* arena) const;
+  // Tells Arena::CreateMessage() to use the constructor above.
+  typedef void InternalArenaConstructable_;
+  
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+  
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+  
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const TestTableDrivenUnpackedTypes& default_instance();
+  
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestTableDrivenUnpackedTypes* internal_default_instance() {
+    return default_instance_;
+  }
+  
+  void Swap(TestTableDrivenUnpackedTypes* other);
+  
+  // implements Message ----------------------------------------------
+  
+  TestTableDrivenUnpackedTypes* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const TestTableDrivenUnpackedTypes& from);
+  void MergeFrom(const TestTableDrivenUnpackedTypes& from);
+  void Clear();
+  bool IsInitialized() const;
+  
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+  
+  ::google::protobuf::Metadata GetMetadata() const;
+  
+  // nested types ----------------------------------------------------
+  
+  // accessors -------------------------------------------------------
+  
+  // repeated int32 unpacked_int32 = 90 [packed = false];
+  inline int unpacked_int32_size() const;
+  inline void clear_unpacked_int32();
+  static const int kUnpackedInt32FieldNumber = 90;
+  inline ::google::protobuf::int32 unpacked_int32(int index) const;
+  inline void set_unpacked_int32(int index, ::google::protobuf::int32 value);
+  inline void add_unpacked_int32(::google::protobuf::int32 value);
+  inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+      unpacked_int32() const;
+  inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+      mutable_unpacked_int32();
+  
+  // repeated int64 unpacked_int64 = 91 [packed = false];
+  inline int unpacked_int64_size() const;
+  inline void clear_unpacked_int64();
+  static const int kUnpackedInt64FieldNumber = 91;
+  inline ::google::protobuf::int64 unpacked_int64(int index) const;
+  inline void set_unpacked_int64(int index, ::google::protobuf::int64 value);
+  inline void add_unpacked_int64(::google::protobuf::int64 value);
+  inline const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
+      unpacked_int64() const;
+  inline ::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
+      mutable_unpacked_int64();
+  
+  // repeated uint32 unpacked_uint32 = 92 [packed = false];
+  inline int unpacked_uint32_size() const;
+  inline void clear_unpacked_uint32();
+  static const int kUnpackedUint32FieldNumber = 92;
+  inline ::google::protobuf::uint32 unpacked_uint32(int index) const;
+  inline void set_unpacked_uint32(int index, ::google::protobuf::uint32 value);
+  inline void add_unpacked_uint32(::google::protobuf::uint32 value);
+  inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+      unpacked_uint32() const;
+  inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+      mutable_unpacked_uint32();
+  
+  // repeated uint64 unpacked_uint64 = 93 [packed = false];
+  inline int unpacked_uint64_size() const;
+  inline void clear_unpacked_uint64();
+  static const int kUnpackedUint64FieldNumber = 93;
+  inline ::google::protobuf::uint64 unpacked_uint64(int index) const;
+  inline void set_unpacked_uint64(int index, ::google::protobuf::uint64 value);
+  inline void add_unpacked_uint64(::google::protobuf::uint64 value);
+  inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
+      unpacked_uint64() const;
+  inline ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
+      mutable_unpacked_uint64();
+  
+  // repeated sint32 unpacked_sint32 = 94 [packed = false];
+  inline int unpacked_sint32_size() const;
+  inline void clear_unpacked_sint32();
+  static const int kUnpackedSint32FieldNumber = 94;
+  inline ::google::protobuf::int32 unpacked_sint32(int index) const;
+  inline void set_unpacked_sint32(int index, ::google::protobuf::int32 value);
+  inline void add_unpacked_sint32(::google::protobuf::int32 value);
+  inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+      unpacked_sint32() const;
+  inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+      mutable_unpacked_sint32();
+  
+  // repeated sint64 unpacked_sint64 = 95 [packed = false];
+  inline int unpacked_sint64_size() const;
+  inline void clear_unpacked_sint64();
+  static const int kUnpackedSint64FieldNumber = 95;
+  inline ::google::protobuf::int64 unpacked_sint64(int index) const;
+  inline void set_unpacked_sint64(int index, ::google::protobuf::int64 value);
+  inline void add_unpacked_sint64(::google::protobuf::int64 value);
+  inline const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
+      unpacked_sint64() const;
+  inline ::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
+      mutable_unpacked_sint64();
+  
+  // repeated fixed32 unpacked_fixed32 = 96 [packed = false];
+  inline int unpacked_fixed32_size() const;
+  inline void clear_unpacked_fixed32();
+  static const int kUnpackedFixed32FieldNumber = 96;
+  inline ::google::protobuf::uint32 unpacked_fixed32(int index) const;
+  inline void set_unpacked_fixed32(int index, ::google::protobuf::uint32 value);
+  inline void add_unpacked_fixed32(::google::protobuf::uint32 value);
+  inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+      unpacked_fixed32() const;
+  inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+      mutable_unpacked_fixed32();
+  
+  // repeated fixed64 unpacked_fixed64 = 97 [packed = false];
+  inline int unpacked_fixed64_size() const;
+  inline void clear_unpacked_fixed64();
+  static const int kUnpackedFixed64FieldNumber = 97;
+  inline ::google::protobuf::uint64 unpacked_fixed64(int index) const;
+  inline void set_unpacked_fixed64(int index, ::google::protobuf::uint64 value);
+  inline void add_unpacked_fixed64(::google::protobuf::uint64 value);
+  inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
+      unpacked_fixed64() const;
+  inline ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
+      mutable_unpacked_fixed64();
+  
+  // repeated sfixed32 unpacked_sfixed32 = 98 [packed = false];
+  inline int unpacked_sfixed32_size() const;
+  inline void clear_unpacked_sfixed32();
+  static const int kUnpackedSfixed32FieldNumber = 98;
+  inline ::google::protobuf::int32 unpacked_sfixed32(int index) const;
+  inline void set_unpacked_sfixed32(int index, ::google::protobuf::int32 value);
+  inline void add_unpacked_sfixed32(::google::protobuf::int32 value);
+  inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+      unpacked_sfixed32() const;
+  inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+      mutable_unpacked_sfixed32();
+  
+  // repeated sfixed64 unpacked_sfixed64 = 99 [packed = false];
+  inline int unpacked_sfixed64_size() const;
+  inline void clear_unpacked_sfixed64();
+  static const int kUnpackedSfixed64FieldNumber = 99;
+  inline ::google::protobuf::int64 unpacked_sfixed64(int index) const;
+  inline void set_unpacked_sfixed64(int index, ::google::protobuf::int64 value);
+  inline void add_unpacked_sfixed64(::google::protobuf::int64 value);
+  inline const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
+      unpacked_sfixed64() const;
+  inline ::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
+      mutable_unpacked_sfixed64();
+  
+  // repeated float unpacked_float = 100 [packed = false];
+  inline int unpacked_float_size() const;
+  inline void clear_unpacked_float();
+  static const int kUnpackedFloatFieldNumber = 100;
+  inline float unpacked_float(int index) const;
+  inline void set_unpacked_float(int index, float value);
+  inline void add_unpacked_float(float value);
+  inline const ::google::protobuf::RepeatedField< float >&
+      unpacked_float() const;
+  inline ::google::protobuf::RepeatedField< float >*
+      mutable_unpacked_float();
+  
+  // repeated double unpacked_double = 101 [packed = false];
+  inline int unpacked_double_size() const;
+  inline void clear_unpacked_double();
+  static const int kUnpackedDoubleFieldNumber = 101;
+  inline double unpacked_double(int index) const;
+  inline void set_unpacked_double(int index, double value);
+  inline void add_unpacked_double(double value);
+  inline const ::google::protobuf::RepeatedField< double >&
+      unpacked_double() const;
+  inline ::google::protobuf::RepeatedField< double >*
+      mutable_unpacked_double();
+  
+  // repeated bool unpacked_bool = 102 [packed = false];
+  inline int unpacked_bool_size() const;
+  inline void clear_unpacked_bool();
+  static const int kUnpackedBoolFieldNumber = 102;
+  inline bool unpacked_bool(int index) const;
+  inline void set_unpacked_bool(int index, bool value);
+  inline void add_unpacked_bool(bool value);
+  inline const ::google::protobuf::RepeatedField< bool >&
+      unpacked_bool() const;
+  inline ::google::protobuf::RepeatedField< bool >*
+      mutable_unpacked_bool();
+  
+  // repeated .protobuf_unittest.ForeignEnum unpacked_enum = 103 [packed = false];
+  inline int unpacked_enum_size() const;
+  inline void clear_unpacked_enum();
+  static const int kUnpackedEnumFieldNumber = 103;
+  inline protobuf_unittest::ForeignEnum unpacked_enum(int index) const;
+  inline void set_unpacked_enum(int index, protobuf_unittest::ForeignEnum value);
+  inline void add_unpacked_enum(protobuf_unittest::ForeignEnum value);
+  inline const ::google::protobuf::RepeatedField<int>& unpacked_enum() const;
+  inline ::google::protobuf::RepeatedField<int>* mutable_unpacked_enum();
+  
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestTableDrivenUnpackedTypes)
+ private:
+  ::google::protobuf::Arena* _arena_;
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
+  
+  ::google::protobuf::RepeatedField< ::google::protobuf::int32 > unpacked_int32_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int64 > unpacked_int64_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 > unpacked_uint32_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint64 > unpacked_uint64_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int32 > unpacked_sint32_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int64 > unpacked_sint64_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 > unpacked_fixed32_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint64 > unpacked_fixed64_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int32 > unpacked_sfixed32_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int64 > unpacked_sfixed64_;
+  ::google::protobuf::RepeatedField< float > unpacked_float_;
+  ::google::protobuf::RepeatedField< double > unpacked_double_;
+  ::google::protobuf::RepeatedField< bool > unpacked_bool_;
+  ::google::protobuf::RepeatedField<int> unpacked_enum_;
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto_impl();
+  friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto();
+  friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto();
+  
+  ::google::protobuf::uint32 _has_bits_[(14 + 31) / 32];
+  
+  // WHY DOES & HAVE LOWER PRECEDENCE THAN != !?
+  inline bool _has_bit(int index) const {
+    return (_has_bits_[index / 32] & (1u << (index % 32))) != 0;
+  }
+  inline void _set_bit(int index) {
+    _has_bits_[index / 32] |= (1u << (index % 32));
+  }
+  inline void _clear_bit(int index) {
+    _has_bits_[index / 32] &= ~(1u << (index % 32));
+  }
+  
+  void InitAsDefaultInstance();
+  static TestTableDrivenUnpackedTypes* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class TestTableDrivenLazyMessage : public ::google::protobuf::Message {
+ public:
+  TestTableDrivenLazyMessage();
+  virtual ~TestTableDrivenLazyMessage();
+  
+  TestTableDrivenLazyMessage(const TestTableDrivenLazyMessage& from);
+  
+  inline TestTableDrivenLazyMessage& operator=(const TestTableDrivenLazyMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  
+  explicit TestTableDrivenLazyMessage(::google::protobuf::Arena* arena);
+  inline ::google::protobuf::Arena* GetArena() const { return _arena_; }
+  TestTableDrivenLazyMessage* NewOnArena(::google::protobuf::Arena* arena) const;
+  // Tells Arena::CreateMessage() to use the constructor above.
+  typedef void InternalArenaConstructable_;
+  
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+  
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+  
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const TestTableDrivenLazyMessage& default_instance();
+  
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestTableDrivenLazyMessage* internal_default_instance() {
+    return default_instance_;
+  }
+  
+  void Swap(TestTableDrivenLazyMessage* other);
+  
+  // implements Message ----------------------------------------------
+  
+  TestTableDrivenLazyMessage* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const TestTableDrivenLazyMessage& from);
+  void MergeFrom(const TestTableDrivenLazyMessage& from);
+  void Clear();
+  bool IsInitialized() const;
+  
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+  
+  ::google::protobuf::Metadata GetMetadata() const;
+  
+  // nested types ----------------------------------------------------
+  
+  // accessors -------------------------------------------------------
+  
+  // optional int32 id = 1;
+  inline bool has_id() const;
+  inline void clear_id();
+  static const int kIdFieldNumber = 1;
+  inline ::google::protobuf::int32 id() const;
+  inline void set_id(::google::protobuf::int32 value);
+  
+  // optional .protobuf_unittest.TestAllTypes lazy_child = 2 [lazy = true];
+  inline bool has_lazy_child() const;
+  inline void clear_lazy_child();
+  static const int kLazyChildFieldNumber = 2;
+  inline const ::protobuf_unittest::TestAllTypes& lazy_child() const;
+  inline ::protobuf_unittest::TestAllTypes* mutable_lazy_child();
+  
+  // optional .protobuf_unittest.TestAllTypes eager_child = 3;
+  inline bool has_eager_child() const;
+  inline void clear_eager_child();
+  static const int kEagerChildFieldNumber = 3;
+  inline const ::protobuf_unittest::TestAllTypes& eager_child() const;
+  inline ::protobuf_unittest::TestAllTypes* mutable_eager_child();
+  
+  // optional .protobuf_unittest.TestRequired lazy_required = 4 [lazy = true];
+  inline bool has_lazy_required() const;
+  inline void clear_lazy_required();
+  static const int kLazyRequiredFieldNumber = 4;
+  inline const ::protobuf_unittest::TestRequired& lazy_required() const;
+  inline ::protobuf_unittest::TestRequired* mutable_lazy_required();
+  
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestTableDrivenLazyMessage)
+ private:
+  ::google::protobuf::Arena* _arena_;
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
+  
+  ::google::protobuf::int32 id_;
+  ::google::protobuf::internal::LazyField lazy_child_;
+  ::protobuf_unittest::TestAllTypes* eager_child_;
+  ::google::protobuf::internal::LazyField lazy_required_;
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto_impl();
+  friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto();
+  friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto();
+  
+  ::google::protobuf::uint32 _has_bits_[(4 + 31) / 32];
+  
+  // WHY DOES & HAVE LOWER PRECEDENCE THAN != !?
+  inline bool _has_bit(int index) const {
+    return (_has_bits_[index / 32] & (1u << (index % 32))) != 0;
+  }
+  inline void _set_bit(int index) {
+    _has_bits_[index / 32] |= (1u << (index % 32));
+  }
+  inline void _clear_bit(int index) {
+    _has_bits_[index / 32] &= ~(1u << (index % 32));
+  }
+  
+  void InitAsDefaultInstance();
+  static TestTableDrivenLazyMessage* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class TestTableDrivenSparse : public ::google::protobuf::Message {
+ public:
+  TestTableDrivenSparse();
+  virtual ~TestTableDrivenSparse();
+  
+  TestTableDrivenSparse(const TestTableDrivenSparse& from);
+  
+  inline TestTableDrivenSparse& operator=(const TestTableDrivenSparse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  
+  explicit TestTableDrivenSparse(::google::protobuf::Arena* arena);
+  inline ::google::protobuf::Arena* GetArena() const { return _arena_; }
+  TestTableDrivenSparse* NewOnArena(::google::protobuf::Arena* arena) const;
+  // Tells Arena::CreateMessage() to use the constructor above.
+  typedef void InternalArenaConstructable_;
+  
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+  
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+  
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const TestTableDrivenSparse& default_instance();
+  
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestTableDrivenSparse* internal_default_instance() {
+    return default_instance_;
+  }
+  
+  void Swap(TestTableDrivenSparse* other);
+  
+  // implements Message ----------------------------------------------
+  
+  TestTableDrivenSparse* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const TestTableDrivenSparse& from);
+  void MergeFrom(const TestTableDrivenSparse& from);
+  void Clear();
+  bool IsInitialized() const;
+  
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+  
+  ::google::protobuf::Metadata GetMetadata() const;
+  
+  // nested types ----------------------------------------------------
+  
+  // accessors -------------------------------------------------------
+  
+  // optional int32 optional_int32 = 1;
+  inline bool has_optional_int32() const;
+  inline void clear_optional_int32();
+  static const int kOptionalInt32FieldNumber = 1;
+  inline ::google::protobuf::int32 optional_int32() const;
+  inline void set_optional_int32(::google::protobuf::int32 value);
+  
+  // optional string optional_string = 14;
+  inline bool has_optional_string() const;
+  inline void clear_optional_string();
+  static const int kOptionalStringFieldNumber = 14;
+  inline const ::std::string& optional_string() const;
+  inline void set_optional_string(const ::std::string& value);
+  inline void set_optional_string(const char* value);
+  inline void set_optional_string(const char* value, size_t size);
+  inline ::std::string* mutable_optional_string();
+  
+  // repeated int32 repeated_int32 = 31;
+  inline int repeated_int32_size() const;
+  inline void clear_repeated_int32();
+  static const int kRepeatedInt32FieldNumber = 31;
+  inline ::google::protobuf::int32 repeated_int32(int index) const;
+  inline void set_repeated_int32(int index, ::google::protobuf::int32 value);
+  inline void add_repeated_int32(::google::protobuf::int32 value);
+  inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+      repeated_int32() const;
+  inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+      mutable_repeated_int32();
+  
+  GOOGLE_PROTOBUF_EXTENSION_ACCESSORS(TestTableDrivenSparse)
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestTableDrivenSparse)
+ private:
+  ::google::protobuf::Arena* _arena_;
+  ::google::protobuf::internal::ExtensionSet _extensions_;
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
+  
+  ::google::protobuf::int32 optional_int32_;
+  ::std::string* optional_string_;
+  static const ::std::string _default_optional_string_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int32 > repeated_int32_;
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto_impl();
+  friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto();
+  friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto();
+  
+  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
+  
+  // WHY DOES & HAVE LOWER PRECEDENCE THAN != !?
+  inline bool _has_bit(int index) const {
+    return (_has_bits_[index / 32] & (1u << (index % 32))) != 0;
+  }
+  inline void _set_bit(int index) {
+    _has_bits_[index / 32] |= (1u << (index % 32));
+  }
+  inline void _clear_bit(int index) {
+    _has_bits_[index / 32] &= ~(1u << (index % 32));
+  }
+  
+  void InitAsDefaultInstance();
+  static TestTableDrivenSparse* default_instance_;
+};
+// ===================================================================
+
+static const int kSparseInt32ExtensionFieldNumber = 1000;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestTableDrivenSparse,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::google::protobuf::int32 >, 5, false >
+  sparse_int32_extension;
+static const int kSparseStringExtensionFieldNumber = 1001;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestTableDrivenSparse,
+    ::google::protobuf::internal::RepeatedStringTypeTraits, 9, false >
+  sparse_string_extension;
+static const int kSparseMessageExtensionFieldNumber = 1002;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestTableDrivenSparse,
+    ::google::protobuf::internal::MessageTypeTraits< ::protobuf_unittest::TestTableDrivenSparse >, 11, false >
+  sparse_message_extension;
+
+// ===================================================================
+
+// TestTableDrivenAllTypes_NestedMessage
+
+// optional int32 bb = 1;
+inline bool TestTableDrivenAllTypes_NestedMessage::has_bb() const {
+  return _has_bit(0);
+}
+inline void TestTableDrivenAllTypes_NestedMessage::clear_bb() {
+  bb_ = 0;
+  _clear_bit(0);
+}
+inline ::google::protobuf::int32 TestTableDrivenAllTypes_NestedMessage::bb() const {
+  return bb_;
+}
+inline void TestTableDrivenAllTypes_NestedMessage::set_bb(::google::protobuf::int32 value) {
+  _set_bit(0);
+  bb_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// TestTableDrivenAllTypes_OptionalGroup
+
+// optional int32 a = 17;
+inline bool TestTableDrivenAllTypes_OptionalGroup::has_a() const {
+  return _has_bit(0);
+}
+inline void TestTableDrivenAllTypes_OptionalGroup::clear_a() {
+  a_ = 0;
+  _clear_bit(0);
+}
+inline ::google::protobuf::int32 TestTableDrivenAllTypes_OptionalGroup::a() const {
+  return a_;
+}
+inline void TestTableDrivenAllTypes_OptionalGroup::set_a(::google::protobuf::int32 value) {
+  _set_bit(0);
+  a_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// TestTableDrivenAllTypes_RepeatedGroup
+
+// optional int32 a = 47;
+inline bool TestTableDrivenAllTypes_RepeatedGroup::has_a() const {
+  return _has_bit(0);
+}
+inline void TestTableDrivenAllTypes_RepeatedGroup::clear_a() {
+  a_ = 0;
+  _clear_bit(0);
+}
+inline ::google::protobuf::int32 TestTableDrivenAllTypes_RepeatedGroup::a() const {
+  return a_;
+}
+inline void TestTableDrivenAllTypes_RepeatedGroup::set_a(::google::protobuf::int32 value) {
+  _set_bit(0);
+  a_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// TestTableDrivenAllTypes
+
+// optional int32 optional_int32 = 1;
+inline bool TestTableDrivenAllTypes::has_optional_int32() const {
+  return _has_bit(0);
+}
+inline void TestTableDrivenAllTypes::clear_optional_int32() {
+  optional_int32_ = 0;
+  _clear_bit(0);
+}
+inline ::google::protobuf::int32 TestTableDrivenAllTypes::optional_int32() const {
+  return optional_int32_;
+}
+inline void TestTableDrivenAllTypes::set_optional_int32(::google::protobuf::int32 value) {
+  _set_bit(0);
+  optional_int32_ = value;
+}
+
+// optional int64 optional_int64 = 2;
+inline bool TestTableDrivenAllTypes::has_optional_int64() const {
+  return _has_bit(1);
+}
+inline void TestTableDrivenAllTypes::clear_optional_int64() {
+  optional_int64_ = GOOGLE_LONGLONG(0);
+  _clear_bit(1);
+}
+inline ::google::protobuf::int64 TestTableDrivenAllTypes::optional_int64() const {
+  return optional_int64_;
+}
+inline void TestTableDrivenAllTypes::set_optional_int64(::google::protobuf::int64 value) {
+  _set_bit(1);
+  optional_int64_ = value;
+}
+
+// optional uint32 optional_uint32 = 3;
+inline bool TestTableDrivenAllTypes::has_optional_uint32() const {
+  return _has_bit(2);
+}
+inline void TestTableDrivenAllTypes::clear_optional_uint32() {
+  optional_uint32_ = 0u;
+  _clear_bit(2);
+}
+inline ::google::protobuf::uint32 TestTableDrivenAllTypes::optional_uint32() const {
+  return optional_uint32_;
+}
+inline void TestTableDrivenAllTypes::set_optional_uint32(::google::protobuf::uint32 value) {
+  _set_bit(2);
+  optional_uint32_ = value;
+}
+
+// optional uint64 optional_uint64 = 4;
+inline bool TestTableDrivenAllTypes::has_optional_uint64() const {
+  return _has_bit(3);
+}
+inline void TestTableDrivenAllTypes::clear_optional_uint64() {
+  optional_uint64_ = GOOGLE_ULONGLONG(0);
+  _clear_bit(3);
+}
+inline ::google::protobuf::uint64 TestTableDrivenAllTypes::optional_uint64() const {
+  return optional_uint64_;
+}
+inline void TestTableDrivenAllTypes::set_optional_uint64(::google::protobuf::uint64 value) {
+  _set_bit(3);
+  optional_uint64_ = value;
+}
+
+// optional sint32 optional_sint32 = 5;
+inline bool TestTableDrivenAllTypes::has_optional_sint32() const {
+  return _has_bit(4);
+}
+inline void TestTableDrivenAllTypes::clear_optional_sint32() {
+  optional_sint32_ = 0;
+  _clear_bit(4);
+}
+inline ::google::protobuf::int32 TestTableDrivenAllTypes::optional_sint32() const {
+  return optional_sint32_;
+}
+inline void TestTableDrivenAllTypes::set_optional_sint32(::google::protobuf::int32 value) {
+  _set_bit(4);
+  optional_sint32_ = value;
+}
+
+// optional sint64 optional_sint64 = 6;
+inline bool TestTableDrivenAllTypes::has_optional_sint64() const {
+  return _has_bit(5);
+}
+inline void TestTableDrivenAllTypes::clear_optional_sint64() {
+  optional_sint64_ = GOOGLE_LONGLONG(0);
+  _clear_bit(5);
+}
+inline ::google::protobuf::int64 TestTableDrivenAllTypes::optional_sint64() const {
+  return optional_sint64_;
+}
+inline void TestTableDrivenAllTypes::set_optional_sint64(::google::protobuf::int64 value) {
+  _set_bit(5);
+  optional_sint64_ = value;
+}
+
+// optional fixed32 optional_fixed32 = 7;
+inline bool TestTableDrivenAllTypes::has_optional_fixed32() const {
+  return _has_bit(6);
+}
+inline void TestTableDrivenAllTypes::clear_optional_fixed32() {
+  optional_fixed32_ = 0u;
+  _clear_bit(6);
+}
+inline ::google::protobuf::uint32 TestTableDrivenAllTypes::optional_fixed32() const {
+  return optional_fixed32_;
+}
+inline void TestTableDrivenAllTypes::set_optional_fixed32(::google::protobuf::uint32 value) {
+  _set_bit(6);
+  optional_fixed32_ = value;
+}
+
+// optional fixed64 optional_fixed64 = 8;
+inline bool TestTableDrivenAllTypes::has_optional_fixed64() const {
+  return _has_bit(7);
+}
+inline void TestTableDrivenAllTypes::clear_optional_fixed64() {
+  optional_fixed64_ = GOOGLE_ULONGLONG(0);
+  _clear_bit(7);
+}
+inline ::google::protobuf::uint64 TestTableDrivenAllTypes::optional_fixed64() const {
+  return optional_fixed64_;
+}
+inline void TestTableDrivenAllTypes::set_optional_fixed64(::google::protobuf::uint64 value) {
+  _set_bit(7);
+  optional_fixed64_ = value;
+}
+
+// optional sfixed32 optional_sfixed32 = 9;
+inline bool TestTableDrivenAllTypes::has_optional_sfixed32() const {
+  return _has_bit(8);
+}
+inline void TestTableDrivenAllTypes::clear_optional_sfixed32() {
+  optional_sfixed32_ = 0;
+  _clear_bit(8);
+}
+inline ::google::protobuf::int32 TestTableDrivenAllTypes::optional_sfixed32() const {
+  return optional_sfixed32_;
+}
+inline void TestTableDrivenAllTypes::set_optional_sfixed32(::google::protobuf::int32 value) {
+  _set_bit(8);
+  optional_sfixed32_ = value;
+}
+
+// optional sfixed64 optional_sfixed64 = 10;
+inline bool TestTableDrivenAllTypes::has_optional_sfixed64() const {
+  return _has_bit(9);
+}
+inline void TestTableDrivenAllTypes::clear_optional_sfixed64() {
+  optional_sfixed64_ = GOOGLE_LONGLONG(0);
+  _clear_bit(9);
+}
+inline ::google::protobuf::int64 TestTableDrivenAllTypes::optional_sfixed64() const {
+  return optional_sfixed64_;
+}
+inline void TestTableDrivenAllTypes::set_optional_sfixed64(::google::protobuf::int64 value) {
+  _set_bit(9);
+  optional_sfixed64_ = value;
+}
+
+// optional float optional_float = 11;
+inline bool TestTableDrivenAllTypes::has_optional_float() const {
+  return _has_bit(10);
+}
+inline void TestTableDrivenAllTypes::clear_optional_float() {
+  optional_float_ = 0;
+  _clear_bit(10);
+}
+inline float TestTableDrivenAllTypes::optional_float() const {
+  return optional_float_;
+}
+inline void TestTableDrivenAllTypes::set_optional_float(float value) {
+  _set_bit(10);
+  optional_float_ = value;
+}
+
+// optional double optional_double = 12;
+inline bool TestTableDrivenAllTypes::has_optional_double() const {
+  return _has_bit(11);
+}
+inline void TestTableDrivenAllTypes::clear_optional_double() {
+  optional_double_ = 0;
+  _clear_bit(11);
+}
+inline double TestTableDrivenAllTypes::optional_double() const {
+  return optional_double_;
+}
+inline void TestTableDrivenAllTypes::set_optional_double(double value) {
+  _set_bit(11);
+  optional_double_ = value;
+}
+
+// optional bool optional_bool = 13;
+inline bool TestTableDrivenAllTypes::has_optional_bool() const {
+  return _has_bit(12);
+}
+inline void TestTableDrivenAllTypes::clear_optional_bool() {
+  optional_bool_ = false;
+  _clear_bit(12);
+}
+inline bool TestTableDrivenAllTypes::optional_bool() const {
+  return optional_bool_;
+}
+inline void TestTableDrivenAllTypes::set_optional_bool(bool value) {
+  _set_bit(12);
+  optional_bool_ = value;
+}
+
+// optional string optional_string = 14;
+inline bool TestTableDrivenAllTypes::has_optional_string() const {
+  return _has_bit(13);
+}
+inline void TestTableDrivenAllTypes::clear_optional_string() {
+  if (optional_string_ != &_default_optional_string_) {
+    optional_string_->clear();
+  }
+  _clear_bit(13);
+}
+inline const ::std::string& TestTableDrivenAllTypes::optional_string() const {
+  return *optional_string_;
+}
+inline void TestTableDrivenAllTypes::set_optional_string(const ::std::string& value) {
+  _set_bit(13);
+  if (optional_string_ == &_default_optional_string_) {
+    optional_string_ = ::google::protobuf::Arena::Create< ::std::string>(_arena_);
+  }
+  optional_string_->assign(value);
+}
+inline void TestTableDrivenAllTypes::set_optional_string(const char* value) {
+  _set_bit(13);
+  if (optional_string_ == &_default_optional_string_) {
+    optional_string_ = ::google::protobuf::Arena::Create< ::std::string>(_arena_);
+  }
+  optional_string_->assign(value);
+}
+inline void TestTableDrivenAllTypes::set_optional_string(const char* value, size_t size) {
+  _set_bit(13);
+  if (optional_string_ == &_default_optional_string_) {
+    optional_string_ = ::google::protobuf::Arena::Create< ::std::string>(_arena_);
+  }
+  optional_string_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* TestTableDrivenAllTypes::mutable_optional_string() {
+  _set_bit(13);
+  if (optional_string_ == &_default_optional_string_) {
+    optional_string_ = ::google::protobuf::Arena::Create< ::std::string>(_arena_);
+  }
+  return optional_string_;
+}
+
+// optional bytes optional_bytes = 15;
+inline bool TestTableDrivenAllTypes::has_optional_bytes() const {
+  return _has_bit(14);
+}
+inline void TestTableDrivenAllTypes::clear_optional_bytes() {
+  if (optional_bytes_ != &_default_optional_bytes_) {
+    optional_bytes_->clear();
+  }
+  _clear_bit(14);
+}
+inline const ::std::string& TestTableDrivenAllTypes::optional_bytes() const {
+  return *optional_bytes_;
+}
+inline void TestTableDrivenAllTypes::set_optional_bytes(const ::std::string& value) {
+  _set_bit(14);
+  if (optional_bytes_ == &_default_optional_bytes_) {
+    optional_bytes_ = ::google::protobuf::Arena::Create< ::std::string>(_arena_);
+  }
+  optional_bytes_->assign(value);
+}
+inline void TestTableDrivenAllTypes::set_optional_bytes(const char* value) {
+  _set_bit(14);
+  if (optional_bytes_ == &_default_optional_bytes_) {
+    optional_bytes_ = ::google::protobuf::Arena::Create< ::std::string>(_arena_);
+  }
+  optional_bytes_->assign(value);
+}
+inline void TestTableDrivenAllTypes::set_optional_bytes(const void* value, size_t size) {
+  _set_bit(14);
+  if (optional_bytes_ == &_default_optional_bytes_) {
+    optional_bytes_ = ::google::protobuf::Arena::Create< ::std::string>(_arena_);
+  }
+  optional_bytes_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* TestTableDrivenAllTypes::mutable_optional_bytes() {
+  _set_bit(14);
+  if (optional_bytes_ == &_default_optional_bytes_) {
+    optional_bytes_ = ::google::protobuf::Arena::Create< ::std::string>(_arena_);
+  }
+  return optional_bytes_;
+}
+
+// optional group OptionalGroup = 16 {
+inline bool TestTableDrivenAllTypes::has_optionalgroup() const {
+  return _has_bit(15);
+}
+inline void TestTableDrivenAllTypes::clear_optionalgroup() {
+  if (optionalgroup_ != NULL) optionalgroup_->::protobuf_unittest::TestTableDrivenAllTypes_OptionalGroup::Clear();
+  _clear_bit(15);
+}
+inline const ::protobuf_unittest::TestTableDrivenAllTypes_OptionalGroup& TestTableDrivenAllTypes::optionalgroup() const {
+  return optionalgroup_ != NULL ? *optionalgroup_ : ::protobuf_unittest::TestTableDrivenAllTypes_OptionalGroup::default_instance();
+}
+inline ::protobuf_unittest::TestTableDrivenAllTypes_OptionalGroup* TestTableDrivenAllTypes::mutable_optionalgroup() {
+  _set_bit(15);
+  if (optionalgroup_ == NULL) optionalgroup_ = ::google::protobuf::Arena::CreateMessage< ::protobuf_unittest::TestTableDrivenAllTypes_OptionalGroup >(_arena_);
+  return optionalgroup_;
+}
+
+// optional .protobuf_unittest.TestTableDrivenAllTypes.NestedMessage optional_nested_message = 18;
+inline bool TestTableDrivenAllTypes::has_optional_nested_message() const {
+  return _has_bit(16);
+}
+inline void TestTableDrivenAllTypes::clear_optional_nested_message() {
+  if (optional_nested_message_ != NULL) optional_nested_message_->::protobuf_unittest::TestTableDrivenAllTypes_NestedMessage::Clear();
+  _clear_bit(16);
+}
+inline const ::protobuf_unittest::TestTableDrivenAllTypes_NestedMessage& TestTableDrivenAllTypes::optional_nested_message() const {
+  return optional_nested_message_ != NULL ? *optional_nested_message_ : ::protobuf_unittest::TestTableDrivenAllTypes_NestedMessage::default_instance();
+}
+inline ::protobuf_unittest::TestTableDrivenAllTypes_NestedMessage* TestTableDrivenAllTypes::mutable_optional_nested_message() {
+  _set_bit(16);
+  if (optional_nested_message_ == NULL) optional_nested_message_ = ::google::protobuf::Arena::CreateMessage< ::protobuf_unittest::TestTableDrivenAllTypes_NestedMessage >(_arena_);
+  return optional_nested_message_;
+}
+
+// optional .protobuf_unittest.ForeignMessage optional_foreign_message = 19;
+inline bool TestTableDrivenAllTypes::has_optional_foreign_message() const {
+  return _has_bit(17);
+}
+inline void TestTableDrivenAllTypes::clear_optional_foreign_message() {
+  if (optional_foreign_message_ != NULL) optional_foreign_message_->::protobuf_unittest::ForeignMessage::Clear();
+  _clear_bit(17);
+}
+inline const ::protobuf_unittest::ForeignMessage& TestTableDrivenAllTypes::optional_foreign_message() const {
+  return optional_foreign_message_ != NULL ? *optional_foreign_message_ : ::protobuf_unittest::ForeignMessage::default_instance();
+}
+inline ::protobuf_unittest::ForeignMessage* TestTableDrivenAllTypes::mutable_optional_foreign_message() {
+  _set_bit(17);
+  if (optional_foreign_message_ == NULL) optional_foreign_message_ = ::google::protobuf::Arena::CreateMessage< ::protobuf_unittest::ForeignMessage >(_arena_);
+  return optional_foreign_message_;
+}
+
+// optional .protobuf_unittest_import.ImportMessage optional_import_message = 20;
+inline bool TestTableDrivenAllTypes::has_optional_import_message() const {
+  return _has_bit(18);
+}
+inline void TestTableDrivenAllTypes::clear_optional_import_message() {
+  if (optional_import_message_ != NULL) optional_import_message_->::protobuf_unittest_import::ImportMessage::Clear();
+  _clear_bit(18);
+}
+inline const ::protobuf_unittest_import::ImportMessage& TestTableDrivenAllTypes::optional_import_message() const {
+  return optional_import_message_ != NULL ? *optional_import_message_ : ::protobuf_unittest_import::ImportMessage::default_instance();
+}
+inline ::protobuf_unittest_import::ImportMessage* TestTableDrivenAllTypes::mutable_optional_import_message() {
+  _set_bit(18);
+  if (optional_import_message_ == NULL) optional_import_message_ = ::google::protobuf::Arena::CreateMessage< ::protobuf_unittest_import::ImportMessage >(_arena_);
+  return optional_import_message_;
+}
+
+// optional .protobuf_unittest.TestTableDrivenAllTypes.NestedEnum optional_nested_enum = 21;
+inline bool TestTableDrivenAllTypes::has_optional_nested_enum() const {
+  return _has_bit(19);
+}
+inline void TestTableDrivenAllTypes::clear_optional_nested_enum() {
+  optional_nested_enum_ = 1;
+  _clear_bit(19);
+}
+inline ::protobuf_unittest::TestTableDrivenAllTypes_NestedEnum TestTableDrivenAllTypes::optional_nested_enum() const {
+  return static_cast< ::protobuf_unittest::TestTableDrivenAllTypes_NestedEnum >(optional_nested_enum_);
+}
+inline void TestTableDrivenAllTypes::set_optional_nested_enum(::protobuf_unittest::TestTableDrivenAllTypes_NestedEnum value) {
+  GOOGLE_DCHECK(::protobuf_unittest::TestTableDrivenAllTypes_NestedEnum_IsValid(value));
+  _set_bit(19);
+  optional_nested_enum_ = value;
+}
+
+// optional .protobuf_unittest.ForeignEnum optional_foreign_enum = 22;
+inline bool TestTableDrivenAllTypes::has_optional_foreign_enum() const {
+  return _has_bit(20);
+}
+inline void TestTableDrivenAllTypes::clear_optional_foreign_enum() {
+  optional_foreign_enum_ = 4;
+  _clear_bit(20);
+}
+inline protobuf_unittest::ForeignEnum TestTableDrivenAllTypes::optional_foreign_enum() const {
+  return static_cast< protobuf_unittest::ForeignEnum >(optional_foreign_enum_);
+}
+inline void TestTableDrivenAllTypes::set_optional_foreign_enum(protobuf_unittest::ForeignEnum value) {
+  GOOGLE_DCHECK(protobuf_unittest::ForeignEnum_IsValid(value));
+  _set_bit(20);
+  optional_foreign_enum_ = value;
+}
+
+// optional .protobuf_unittest_import.ImportEnum optional_import_enum = 23;
+inline bool TestTableDrivenAllTypes::has_optional_import_enum() const {
+  return _has_bit(21);
+}
+inline void TestTableDrivenAllTypes::clear_optional_import_enum() {
+  optional_import_enum_ = 7;
+  _clear_bit(21);
+}
+inline protobuf_unittest_import::ImportEnum TestTableDrivenAllTypes::optional_import_enum() const {
+  return static_cast< protobuf_unittest_import::ImportEnum >(optional_import_enum_);
+}
+inline void TestTableDrivenAllTypes::set_optional_import_enum(protobuf_unittest_import::ImportEnum value) {
+  GOOGLE_DCHECK(protobuf_unittest_import::ImportEnum_IsValid(value));
+  _set_bit(21);
+  optional_import_enum_ = value;
+}
+
+// optional string optional_string_piece = 24 [ctype = STRING_PIECE];
+inline bool TestTableDrivenAllTypes::has_optional_string_piece() const {
+  return _has_bit(22);
+}
+inline void TestTableDrivenAllTypes::clear_optional_string_piece() {
+  optional_string_piece_.Clear();
+  _clear_bit(22);
+}
+inline const ::google::protobuf::internal::StringPieceField& TestTableDrivenAllTypes::optional_string_piece() const {
+  return optional_string_piece_;
+}
+inline void TestTableDrivenAllTypes::set_optional_string_piece(const ::std::string& value) {
+  _set_bit(22);
+  optional_string_piece_.CopyFrom(value.data(), value.size());
+}
+inline void TestTableDrivenAllTypes::set_optional_string_piece(const char* value) {
+  _set_bit(22);
+  optional_string_piece_.CopyFrom(value, strlen(value));
+}
+inline void TestTableDrivenAllTypes::set_optional_string_piece(const char* value, size_t size) {
+  _set_bit(22);
+  optional_string_piece_.CopyFrom(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* TestTableDrivenAllTypes::mutable_optional_string_piece() {
+  _set_bit(22);
+  return optional_string_piece_.Mutable();
+}
+
+// optional string optional_cord = 25 [ctype = CORD];
+inline bool TestTableDrivenAllTypes::has_optional_cord() const {
+  return _has_bit(23);
+}
+inline void TestTableDrivenAllTypes::clear_optional_cord() {
+  if (optional_cord_ != &_default_optional_cord_) {
+    optional_cord_->clear();
+  }
+  _clear_bit(23);
+}
+inline const ::std::string& TestTableDrivenAllTypes::optional_cord() const {
+  return *optional_cord_;
+}
+inline void TestTableDrivenAllTypes::set_optional_cord(const ::std::string& value) {
+  _set_bit(23);
+  if (optional_cord_ == &_default_optional_cord_) {
+    optional_cord_ = ::google::protobuf::Arena::Create< ::std::string>(_arena_);
+  }
+  optional_cord_->assign(value);
+}
+inline void TestTableDrivenAllTypes::set_optional_cord(const char* value) {
+  _set_bit(23);
+  if (optional_cord_ == &_default_optional_cord_) {
+    optional_cord_ = ::google::protobuf::Arena::Create< ::std::string>(_arena_);
+  }
+  optional_cord_->assign(value);
+}
+inline void TestTableDrivenAllTypes::set_optional_cord(const char* value, size_t size) {
+  _set_bit(23);
+  if (optional_cord_ == &_default_optional_cord_) {
+    optional_cord_ = ::google::protobuf::Arena::Create< ::std::string>(_arena_);
+  }
+  optional_cord_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* TestTableDrivenAllTypes::mutable_optional_cord() {
+  _set_bit(23);
+  if (optional_cord_ == &_default_optional_cord_) {
+    optional_cord_ = ::google::protobuf::Arena::Create< ::std::string>(_arena_);
+  }
+  return optional_cord_;
+}
+
+// repeated int32 repeated_int32 = 31;
+inline int TestTableDrivenAllTypes::repeated_int32_size() const {
+  return repeated_int32_.size();
+}
+inline void TestTableDrivenAllTypes::clear_repeated_int32() {
+  repeated_int32_.Clear();
+}
+inline ::google::protobuf::int32 TestTableDrivenAllTypes::repeated_int32(int index) const {
+  return repeated_int32_.Get(index);
+}
+inline void TestTableDrivenAllTypes::set_repeated_int32(int index, ::google::protobuf::int32 value) {
+  repeated_int32_.Set(index, value);
+}
+inline void TestTableDrivenAllTypes::add_repeated_int32(::google::protobuf::int32 value) {
+  repeated_int32_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+TestTableDrivenAllTypes::repeated_int32() const {
+  return repeated_int32_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+TestTableDrivenAllTypes::mutable_repeated_int32() {
+  return &repeated_int32_;
+}
+
+// repeated int64 repeated_int64 = 32;
+inline int TestTableDrivenAllTypes::repeated_int64_size() const {
+  return repeated_int64_.size();
+}
+inline void TestTableDrivenAllTypes::clear_repeated_int64() {
+  repeated_int64_.Clear();
+}
+inline ::google::protobuf::int64 TestTableDrivenAllTypes::repeated_int64(int index) const {
+  return repeated_int64_.Get(index);
+}
+inline void TestTableDrivenAllTypes::set_repeated_int64(int index, ::google::protobuf::int64 value) {
+  repeated_int64_.Set(index, value);
+}
+inline void TestTableDrivenAllTypes::add_repeated_int64(::google::protobuf::int64 value) {
+  repeated_int64_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
+TestTableDrivenAllTypes::repeated_int64() const {
+  return repeated_int64_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
+TestTableDrivenAllTypes::mutable_repeated_int64() {
+  return &repeated_int64_;
+}
+
+// repeated uint32 repeated_uint32 = 33;
+inline int TestTableDrivenAllTypes::repeated_uint32_size() const {
+  return repeated_uint32_.size();
+}
+inline void TestTableDrivenAllTypes::clear_repeated_uint32() {
+  repeated_uint32_.Clear();
+}
+inline ::google::protobuf::uint32 TestTableDrivenAllTypes::repeated_uint32(int index) const {
+  return repeated_uint32_.Get(index);
+}
+inline void TestTableDrivenAllTypes::set_repeated_uint32(int index, ::google::protobuf::uint32 value) {
+  repeated_uint32_.Set(index, value);
+}
+inline void TestTableDrivenAllTypes::add_repeated_uint32(::google::protobuf::uint32 value) {
+  repeated_uint32_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+TestTableDrivenAllTypes::repeated_uint32() const {
+  return repeated_uint32_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+TestTableDrivenAllTypes::mutable_repeated_uint32() {
+  return &repeated_uint32_;
+}
+
+// repeated uint64 repeated_uint64 = 34;
+inline int TestTableDrivenAllTypes::repeated_uint64_size() const {
+  return repeated_uint64_.size();
+}
+inline void TestTableDrivenAllTypes::clear_repeated_uint64() {
+  repeated_uint64_.Clear();
+}
+inline ::google::protobuf::uint64 TestTableDrivenAllTypes::repeated_uint64(int index) const {
+  return repeated_uint64_.Get(index);
+}
+inline void TestTableDrivenAllTypes::set_repeated_uint64(int index, ::google::protobuf::uint64 value) {
+  repeated_uint64_.Set(index, value);
+}
+inline void TestTableDrivenAllTypes::add_repeated_uint64(::google::protobuf::uint64 value) {
+  repeated_uint64_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
+TestTableDrivenAllTypes::repeated_uint64() const {
+  return repeated_uint64_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
+TestTableDrivenAllTypes::mutable_repeated_uint64() {
+  return &repeated_uint64_;
+}
+
+// repeated sint32 repeated_sint32 = 35;
+inline int TestTableDrivenAllTypes::repeated_sint32_size() const {
+  return repeated_sint32_.size();
+}
+inline void TestTableDrivenAllTypes::clear_repeated_sint32() {
+  repeated_sint32_.Clear();
+}
+inline ::google::protobuf::int32 TestTableDrivenAllTypes::repeated_sint32(int index) const {
+  return repeated_sint32_.Get(index);
+}
+inline void TestTableDrivenAllTypes::set_repeated_sint32(int index, ::google::protobuf::int32 value) {
+  repeated_sint32_.Set(index, value);
+}
+inline void TestTableDrivenAllTypes::add_repeated_sint32(::google::protobuf::int32 value) {
+  repeated_sint32_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+TestTableDrivenAllTypes::repeated_sint32() const {
+  return repeated_sint32_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+TestTableDrivenAllTypes::mutable_repeated_sint32() {
+  return &repeated_sint32_;
+}
+
+// repeated sint64 repeated_sint64 = 36;
+inline int TestTableDrivenAllTypes::repeated_sint64_size() const {
+  return repeated_sint64_.size();
+}
+inline void TestTableDrivenAllTypes::clear_repeated_sint64() {
+  repeated_sint64_.Clear();
+}
+inline ::google::protobuf::int64 TestTableDrivenAllTypes::repeated_sint64(int index) const {
+  return repeated_sint64_.Get(index);
+}
+inline void TestTableDrivenAllTypes::set_repeated_sint64(int index, ::google::protobuf::int64 value) {
+  repeated_sint64_.Set(index, value);
+}
+inline void TestTableDrivenAllTypes::add_repeated_sint64(::google::protobuf::int64 value) {
+  repeated_sint64_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
+TestTableDrivenAllTypes::repeated_sint64() const {
+  return repeated_sint64_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
+TestTableDrivenAllTypes::mutable_repeated_sint64() {
+  return &repeated_sint64_;
+}
+
+// repeated fixed32 repeated_fixed32 = 37;
+inline int TestTableDrivenAllTypes::repeated_fixed32_size() const {
+  return repeated_fixed32_.size();
+}
+inline void TestTableDrivenAllTypes::clear_repeated_fixed32() {
+  repeated_fixed32_.Clear();
+}
+inline ::google::protobuf::uint32 TestTableDrivenAllTypes::repeated_fixed32(int index) const {
+  return repeated_fixed32_.Get(index);
+}
+inline void TestTableDrivenAllTypes::set_repeated_fixed32(int index, ::google::protobuf::uint32 value) {
+  repeated_fixed32_.Set(index, value);
+}
+inline void TestTableDrivenAllTypes::add_repeated_fixed32(::google::protobuf::uint32 value) {
+  repeated_fixed32_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+TestTableDrivenAllTypes::repeated_fixed32() const {
+  return repeated_fixed32_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+TestTableDrivenAllTypes::mutable_repeated_fixed32() {
+  return &repeated_fixed32_;
+}
+
+// repeated fixed64 repeated_fixed64 = 38;
+inline int TestTableDrivenAllTypes::repeated_fixed64_size() const {
+  return repeated_fixed64_.size();
+}
+inline void TestTableDrivenAllTypes::clear_repeated_fixed64() {
+  repeated_fixed64_.Clear();
+}
+inline ::google::protobuf::uint64 TestTableDrivenAllTypes::repeated_fixed64(int index) const {
+  return repeated_fixed64_.Get(index);
+}
+inline void TestTableDrivenAllTypes::set_repeated_fixed64(int index, ::google::protobuf::uint64 value) {
+  repeated_fixed64_.Set(index, value);
+}
+inline void TestTableDrivenAllTypes::add_repeated_fixed64(::google::protobuf::uint64 value) {
+  repeated_fixed64_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
+TestTableDrivenAllTypes::repeated_fixed64() const {
+  return repeated_fixed64_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
+TestTableDrivenAllTypes::mutable_repeated_fixed64() {
+  return &repeated_fixed64_;
+}
+
+// repeated sfixed32 repeated_sfixed32 = 39;
+inline int TestTableDrivenAllTypes::repeated_sfixed32_size() const {
+  return repeated_sfixed32_.size();
+}
+inline void TestTableDrivenAllTypes::clear_repeated_sfixed32() {
+  repeated_sfixed32_.Clear();
+}
+inline ::google::protobuf::int32 TestTableDrivenAllTypes::repeated_sfixed32(int index) const {
+  return repeated_sfixed32_.Get(index);
+}
+inline void TestTableDrivenAllTypes::set_repeated_sfixed32(int index, ::google::protobuf::int32 value) {
+  repeated_sfixed32_.Set(index, value);
+}
+inline void TestTableDrivenAllTypes::add_repeated_sfixed32(::google::protobuf::int32 value) {
+  repeated_sfixed32_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+TestTableDrivenAllTypes::repeated_sfixed32() const {
+  return repeated_sfixed32_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+TestTableDrivenAllTypes::mutable_repeated_sfixed32() {
+  return &repeated_sfixed32_;
+}
+
+// repeated sfixed64 repeated_sfixed64 = 40;
+inline int TestTableDrivenAllTypes::repeated_sfixed64_size() const {
+  return repeated_sfixed64_.size();
+}
+inline void TestTableDrivenAllTypes::clear_repeated_sfixed64() {
+  repeated_sfixed64_.Clear();
+}
+inline ::google::protobuf::int64 TestTableDrivenAllTypes::repeated_sfixed64(int index) const {
+  return repeated_sfixed64_.Get(index);
+}
+inline void TestTableDrivenAllTypes::set_repeated_sfixed64(int index, ::google::protobuf::int64 value) {
+  repeated_sfixed64_.Set(index, value);
+}
+inline void TestTableDrivenAllTypes::add_repeated_sfixed64(::google::protobuf::int64 value) {
+  repeated_sfixed64_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
+TestTableDrivenAllTypes::repeated_sfixed64() const {
+  return repeated_sfixed64_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
+TestTableDrivenAllTypes::mutable_repeated_sfixed64() {
+  return &repeated_sfixed64_;
+}
+
+// repeated float repeated_float = 41;
+inline int TestTableDrivenAllTypes::repeated_float_size() const {
+  return repeated_float_.size();
+}
+inline void TestTableDrivenAllTypes::clear_repeated_float() {
+  repeated_float_.Clear();
+}
+inline float TestTableDrivenAllTypes::repeated_float(int index) const {
+  return repeated_float_.Get(index);
+}
+inline void TestTableDrivenAllTypes::set_repeated_float(int index, float value) {
+  repeated_float_.Set(index, value);
+}
+inline void TestTableDrivenAllTypes::add_repeated_float(float value) {
+  repeated_float_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< float >&
+TestTableDrivenAllTypes::repeated_float() const {
+  return repeated_float_;
+}
+inline ::google::protobuf::RepeatedField< float >*
+TestTableDrivenAllTypes::mutable_repeated_float() {
+  return &repeated_float_;
+}
+
+// repeated double repeated_double = 42;
+inline int TestTableDrivenAllTypes::repeated_double_size() const {
+  return repeated_double_.size();
+}
+inline void TestTableDrivenAllTypes::clear_repeated_double() {
+  repeated_double_.Clear();
+}
+inline double TestTableDrivenAllTypes::repeated_double(int index) const {
+  return repeated_double_.Get(index);
+}
+inline void TestTableDrivenAllTypes::set_repeated_double(int index, double value) {
+  repeated_double_.Set(index, value);
+}
+inline void TestTableDrivenAllTypes::add_repeated_double(double value) {
+  repeated_double_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< double >&
+TestTableDrivenAllTypes::repeated_double() const {
+  return repeated_double_;
+}
+inline ::google::protobuf::RepeatedField< double >*
+TestTableDrivenAllTypes::mutable_repeated_double() {
+  return &repeated_double_;
+}
+
+// repeated bool repeated_bool = 43;
+inline int TestTableDrivenAllTypes::repeated_bool_size() const {
+  return repeated_bool_.size();
+}
+inline void TestTableDrivenAllTypes::clear_repeated_bool() {
+  repeated_bool_.Clear();
+}
+inline bool TestTableDrivenAllTypes::repeated_bool(int index) const {
+  return repeated_bool_.Get(index);
+}
+inline void TestTableDrivenAllTypes::set_repeated_bool(int index, bool value) {
+  repeated_bool_.Set(index, value);
+}
+inline void TestTableDrivenAllTypes::add_repeated_bool(bool value) {
+  repeated_bool_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< bool >&
+TestTableDrivenAllTypes::repeated_bool() const {
+  return repeated_bool_;
+}
+inline ::google::protobuf::RepeatedField< bool >*
+TestTableDrivenAllTypes::mutable_repeated_bool() {
+  return &repeated_bool_;
+}
+
+// repeated string repeated_string = 44;
+inline int TestTableDrivenAllTypes::repeated_string_size() const {
+  return repeated_string_.size();
+}
+inline void TestTableDrivenAllTypes::clear_repeated_string() {
+  repeated_string_.Clear();
+}
+inline const ::std::string& TestTableDrivenAllTypes::repeated_string(int index) const {
+  return repeated_string_.Get(index);
+}
+inline ::std::string* TestTableDrivenAllTypes::mutable_repeated_string(int index) {
+  return repeated_string_.Mutable(index);
+}
+inline void TestTableDrivenAllTypes::set_repeated_string(int index, const ::std::string& value) {
+  repeated_string_.Mutable(index)->assign(value);
+}
+inline void TestTableDrivenAllTypes::set_repeated_string(int index, const char* value) {
+  repeated_string_.Mutable(index)->assign(value);
+}
+inline void TestTableDrivenAllTypes::set_repeated_string(int index, const char* value, size_t size) {
+  repeated_string_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* TestTableDrivenAllTypes::add_repeated_string() {
+  return repeated_string_.Add();
+}
+inline void TestTableDrivenAllTypes::add_repeated_string(const ::std::string& value) {
+  repeated_string_.Add()->assign(value);
+}
+inline void TestTableDrivenAllTypes::add_repeated_string(const char* value) {
+  repeated_string_.Add()->assign(value);
+}
+inline void TestTableDrivenAllTypes::add_repeated_string(const char* value, size_t size) {
+  repeated_string_.Add()->assign(reinterpret_cast<const char*>(value), size);
+}
+inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+TestTableDrivenAllTypes::repeated_string() const {
+  return repeated_string_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+TestTableDrivenAllTypes::mutable_repeated_string() {
+  return &repeated_string_;
+}
+
+// repeated bytes repeated_bytes = 45;
+inline int TestTableDrivenAllTypes::repeated_bytes_size() const {
+  return repeated_bytes_.size();
+}
+inline void TestTableDrivenAllTypes::clear_repeated_bytes() {
+  repeated_bytes_.Clear();
+}
+inline const ::std::string& TestTableDrivenAllTypes::repeated_bytes(int index) const {
+  return repeated_bytes_.Get(index);
+}
+inline ::std::string* TestTableDrivenAllTypes::mutable_repeated_bytes(int index) {
+  return repeated_bytes_.Mutable(index);
+}
+inline void TestTableDrivenAllTypes::set_repeated_bytes(int index, const ::std::string& value) {
+  repeated_bytes_.Mutable(index)->assign(value);
+}
+inline void TestTableDrivenAllTypes::set_repeated_bytes(int index, const char* value) {
+  repeated_bytes_.Mutable(index)->assign(value);
+}
+inline void TestTableDrivenAllTypes::set_repeated_bytes(int index, const void* value, size_t size) {
+  repeated_bytes_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* TestTableDrivenAllTypes::add_repeated_bytes() {
+  return repeated_bytes_.Add();
+}
+inline void TestTableDrivenAllTypes::add_repeated_bytes(const ::std::string& value) {
+  repeated_bytes_.Add()->assign(value);
+}
+inline void TestTableDrivenAllTypes::add_repeated_bytes(const char* value) {
+  repeated_bytes_.Add()->assign(value);
+}
+inline void TestTableDrivenAllTypes::add_repeated_bytes(const void* value, size_t size) {
+  repeated_bytes_.Add()->assign(reinterpret_cast<const char*>(value), size);
+}
+inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+TestTableDrivenAllTypes::repeated_bytes() const {
+  return repeated_bytes_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+TestTableDrivenAllTypes::mutable_repeated_bytes() {
+  return &repeated_bytes_;
+}
+
+// repeated group RepeatedGroup = 46 {
+inline int TestTableDrivenAllTypes::repeatedgroup_size() const {
+  return repeatedgroup_.size();
+}
+inline void TestTableDrivenAllTypes::clear_repeatedgroup() {
+  repeatedgroup_.Clear();
+}
+inline const ::protobuf_unittest::TestTableDrivenAllTypes_RepeatedGroup& TestTableDrivenAllTypes::repeatedgroup(int index) const {
+  return repeatedgroup_.Get(index);
+}
+inline ::protobuf_unittest::TestTableDrivenAllTypes_RepeatedGroup* TestTableDrivenAllTypes::mutable_repeatedgroup(int index) {
+  return repeatedgroup_.Mutable(index);
+}
+inline ::protobuf_unittest::TestTableDrivenAllTypes_RepeatedGroup* TestTableDrivenAllTypes::add_repeatedgroup() {
+  return repeatedgroup_.Add();
+}
+inline const ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestTableDrivenAllTypes_RepeatedGroup >&
+TestTableDrivenAllTypes::repeatedgroup() const {
+  return repeatedgroup_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestTableDrivenAllTypes_RepeatedGroup >*
+TestTableDrivenAllTypes::mutable_repeatedgroup() {
+  return &repeatedgroup_;
+}
+
+// repeated .protobuf_unittest.TestTableDrivenAllTypes.NestedMessage repeated_nested_message = 48;
+inline int TestTableDrivenAllTypes::repeated_nested_message_size() const {
+  return repeated_nested_message_.size();
+}
+inline void TestTableDrivenAllTypes::clear_repeated_nested_message() {
+  repeated_nested_message_.Clear();
+}
+inline const ::protobuf_unittest::TestTableDrivenAllTypes_NestedMessage& TestTableDrivenAllTypes::repeated_nested_message(int index) const {
+  return repeated_nested_message_.Get(index);
+}
+inline ::protobuf_unittest::TestTableDrivenAllTypes_NestedMessage* TestTableDrivenAllTypes::mutable_repeated_nested_message(int index) {
+  return repeated_nested_message_.Mutable(index);
+}
+inline ::protobuf_unittest::TestTableDrivenAllTypes_NestedMessage* TestTableDrivenAllTypes::add_repeated_nested_message() {
+  return repeated_nested_message_.Add();
+}
+inline const ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestTableDrivenAllTypes_NestedMessage >&
+TestTableDrivenAllTypes::repeated_nested_message() const {
+  return repeated_nested_message_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestTableDrivenAllTypes_NestedMessage >*
+TestTableDrivenAllTypes::mutable_repeated_nested_message() {
+  return &repeated_nested_message_;
+}
+
+// repeated .protobuf_unittest.ForeignMessage repeated_foreign_message = 49;
+inline int TestTableDrivenAllTypes::repeated_foreign_message_size() const {
+  return repeated_foreign_message_.size();
+}
+inline void TestTableDrivenAllTypes::clear_repeated_foreign_message() {
+  repeated_foreign_message_.Clear();
+}
+inline const ::protobuf_unittest::ForeignMessage& TestTableDrivenAllTypes::repeated_foreign_message(int index) const {
+  return repeated_foreign_message_.Get(index);
+}
+inline ::protobuf_unittest::ForeignMessage* TestTableDrivenAllTypes::mutable_repeated_foreign_message(int index) {
+  return repeated_foreign_message_.Mutable(index);
+}
+inline ::protobuf_unittest::ForeignMessage* TestTableDrivenAllTypes::add_repeated_foreign_message() {
+  return repeated_foreign_message_.Add();
+}
+inline const ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::ForeignMessage >&
+TestTableDrivenAllTypes::repeated_foreign_message() const {
+  return repeated_foreign_message_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::ForeignMessage >*
+TestTableDrivenAllTypes::mutable_repeated_foreign_message() {
+  return &repeated_foreign_message_;
+}
+
+// repeated .protobuf_unittest_import.ImportMessage repeated_import_message = 50;
+inline int TestTableDrivenAllTypes::repeated_import_message_size() const {
+  return repeated_import_message_.size();
+}
+inline void TestTableDrivenAllTypes::clear_repeated_import_message() {
+  repeated_import_message_.Clear();
+}
+inline const ::protobuf_unittest_import::ImportMessage& TestTableDrivenAllTypes::repeated_import_message(int index) const {
+  return repeated_import_message_.Get(index);
+}
+inline ::protobuf_unittest_import::ImportMessage* TestTableDrivenAllTypes::mutable_repeated_import_message(int index) {
+  return repeated_import_message_.Mutable(index);
+}
+inline ::protobuf_unittest_import::ImportMessage* TestTableDrivenAllTypes::add_repeated_import_message() {
+  return repeated_import_message_.Add();
+}
+inline const ::google::protobuf::RepeatedPtrField< ::protobuf_unittest_import::ImportMessage >&
+TestTableDrivenAllTypes::repeated_import_message() const {
+  return repeated_import_message_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::protobuf_unittest_import::ImportMessage >*
+TestTableDrivenAllTypes::mutable_repeated_import_message() {
+  return &repeated_import_message_;
+}
+
+// repeated .protobuf_unittest.TestTableDrivenAllTypes.NestedEnum repeated_nested_enum = 51;
+inline int TestTableDrivenAllTypes::repeated_nested_enum_size() const {
+  return repeated_nested_enum_.size();
+}
+inline void TestTableDrivenAllTypes::clear_repeated_nested_enum() {
+  repeated_nested_enum_.Clear();
+}
+inline ::protobuf_unittest::TestTableDrivenAllTypes_NestedEnum TestTableDrivenAllTypes::repeated_nested_enum(int index) const {
+  return static_cast< ::protobuf_unittest::TestTableDrivenAllTypes_NestedEnum >(repeated_nested_enum_.Get(index));
+}
+inline void TestTableDrivenAllTypes::set_repeated_nested_enum(int index, ::protobuf_unittest::TestTableDrivenAllTypes_NestedEnum value) {
+  GOOGLE_DCHECK(::protobuf_unittest::TestTableDrivenAllTypes_NestedEnum_IsValid(value));
+  repeated_nested_enum_.Set(index, value);
+}
+inline void TestTableDrivenAllTypes::add_repeated_nested_enum(::protobuf_unittest::TestTableDrivenAllTypes_NestedEnum value) {
+  GOOGLE_DCHECK(::protobuf_unittest::TestTableDrivenAllTypes_NestedEnum_IsValid(value));
+  repeated_nested_enum_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField<int>&
+TestTableDrivenAllTypes::repeated_nested_enum() const {
+  return repeated_nested_enum_;
+}
+inline ::google::protobuf::RepeatedField<int>*
+TestTableDrivenAllTypes::mutable_repeated_nested_enum() {
+  return &repeated_nested_enum_;
+}
+
+// repeated .protobuf_unittest.ForeignEnum repeated_foreign_enum = 52;
+inline int TestTableDrivenAllTypes::repeated_foreign_enum_size() const {
+  return repeated_foreign_enum_.size();
+}
+inline void TestTableDrivenAllTypes::clear_repeated_foreign_enum() {
+  repeated_foreign_enum_.Clear();
+}
+inline protobuf_unittest::ForeignEnum TestTableDrivenAllTypes::repeated_foreign_enum(int index) const {
+  return static_cast< protobuf_unittest::ForeignEnum >(repeated_foreign_enum_.Get(index));
+}
+inline void TestTableDrivenAllTypes::set_repeated_foreign_enum(int index, protobuf_unittest::ForeignEnum value) {
+  GOOGLE_DCHECK(protobuf_unittest::ForeignEnum_IsValid(value));
+  repeated_foreign_enum_.Set(index, value);
+}
+inline void TestTableDrivenAllTypes::add_repeated_foreign_enum(protobuf_unittest::ForeignEnum value) {
+  GOOGLE_DCHECK(protobuf_unittest::ForeignEnum_IsValid(value));
+  repeated_foreign_enum_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField<int>&
+TestTableDrivenAllTypes::repeated_foreign_enum() const {
+  return repeated_foreign_enum_;
+}
+inline ::google::protobuf::RepeatedField<int>*
+TestTableDrivenAllTypes::mutable_repeated_foreign_enum() {
+  return &repeated_foreign_enum_;
+}
+
+// repeated .protobuf_unittest_import.ImportEnum repeated_import_enum = 53;
+inline int TestTableDrivenAllTypes::repeated_import_enum_size() const {
+  return repeated_import_enum_.size();
+}
+inline void TestTableDrivenAllTypes::clear_repeated_import_enum() {
+  repeated_import_enum_.Clear();
+}
+inline protobuf_unittest_import::ImportEnum TestTableDrivenAllTypes::repeated_import_enum(int index) const {
+  return static_cast< protobuf_unittest_import::ImportEnum >(repeated_import_enum_.Get(index));
+}
+inline void TestTableDrivenAllTypes::set_repeated_import_enum(int index, protobuf_unittest_import::ImportEnum value) {
+  GOOGLE_DCHECK(protobuf_unittest_import::ImportEnum_IsValid(value));
+  repeated_import_enum_.Set(index, value);
+}
+inline void TestTableDrivenAllTypes::add_repeated_import_enum(protobuf_unittest_import::ImportEnum value) {
+  GOOGLE_DCHECK(protobuf_unittest_import::ImportEnum_IsValid(value));
+  repeated_import_enum_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField<int>&
+TestTableDrivenAllTypes::repeated_import_enum() const {
+  return repeated_import_enum_;
+}
+inline ::google::protobuf::RepeatedField<int>*
+TestTableDrivenAllTypes::mutable_repeated_import_enum() {
+  return &repeated_import_enum_;
+}
+
+// repeated string repeated_string_piece = 54 [ctype = STRING_PIECE];
+inline int TestTableDrivenAllTypes::repeated_string_piece_size() const {
+  return repeated_string_piece_.size();
+}
+inline void TestTableDrivenAllTypes::clear_repeated_string_piece() {
+  repeated_string_piece_.Clear();
+}
+inline const ::google::protobuf::internal::StringPieceField& TestTableDrivenAllTypes::repeated_string_piece(int index) const {
+  return repeated_string_piece_.Get(index);
+}
+inline ::std::string* TestTableDrivenAllTypes::mutable_repeated_string_piece(int index) {
+  return repeated_string_piece_.Mutable(index)->Mutable();
+}
+inline void TestTableDrivenAllTypes::set_repeated_string_piece(int index, const ::std::string& value) {
+  repeated_string_piece_.Mutable(index)->CopyFrom(value.data(), value.size());
+}
+inline void TestTableDrivenAllTypes::set_repeated_string_piece(int index, const char* value) {
+  repeated_string_piece_.Mutable(index)->CopyFrom(value, strlen(value));
+}
+inline void TestTableDrivenAllTypes::set_repeated_string_piece(int index, const char* value, size_t size) {
+  repeated_string_piece_.Mutable(index)->CopyFrom(
+    reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* TestTableDrivenAllTypes::add_repeated_string_piece() {
+  return repeated_string_piece_.Add()->Mutable();
+}
+inline void TestTableDrivenAllTypes::add_repeated_string_piece(const ::std::string& value) {
+  repeated_string_piece_.Add()->CopyFrom(value.data(), value.size());
+}
+inline void TestTableDrivenAllTypes::add_repeated_string_piece(const char* value) {
+  repeated_string_piece_.Add()->CopyFrom(value, strlen(value));
+}
+inline void TestTableDrivenAllTypes::add_repeated_string_piece(const char* value, size_t size) {
+  repeated_string_piece_.Add()->CopyFrom(reinterpret_cast<const char*>(value), size);
+}
+inline const ::google::protobuf::RepeatedPtrField< ::google::protobuf::internal::StringPieceField>&
+TestTableDrivenAllTypes::repeated_string_piece() const {
+  return repeated_string_piece_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::google::protobuf::internal::StringPieceField>*
+TestTableDrivenAllTypes::mutable_repeated_string_piece() {
+  return &repeated_string_piece_;
+}
+
+// repeated string repeated_cord = 55 [ctype = CORD];
+inline int TestTableDrivenAllTypes::repeated_cord_size() const {
+  return repeated_cord_.size();
+}
+inline void TestTableDrivenAllTypes::clear_repeated_cord() {
+  repeated_cord_.Clear();
+}
+inline const ::std::string& TestTableDrivenAllTypes::repeated_cord(int index) const {
+  return repeated_cord_.Get(index);
+}
+inline ::std::string* TestTableDrivenAllTypes::mutable_repeated_cord(int index) {
+  return repeated_cord_.Mutable(index);
+}
+inline void TestTableDrivenAllTypes::set_repeated_cord(int index, const ::std::string& value) {
+  repeated_cord_.Mutable(index)->assign(value);
+}
+inline void TestTableDrivenAllTypes::set_repeated_cord(int index, const char* value) {
+  repeated_cord_.Mutable(index)->assign(value);
+}
+inline void TestTableDrivenAllTypes::set_repeated_cord(int index, const char* value, size_t size) {
+  repeated_cord_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* TestTableDrivenAllTypes::add_repeated_cord() {
+  return repeated_cord_.Add();
+}
+inline void TestTableDrivenAllTypes::add_repeated_cord(const ::std::string& value) {
+  repeated_cord_.Add()->assign(value);
+}
+inline void TestTableDrivenAllTypes::add_repeated_cord(const char* value) {
+  repeated_cord_.Add()->assign(value);
+}
+inline void TestTableDrivenAllTypes::add_repeated_cord(const char* value, size_t size) {
+  repeated_cord_.Add()->assign(reinterpret_cast<const char*>(value), size);
+}
+inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+TestTableDrivenAllTypes::repeated_cord() const {
+  return repeated_cord_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+TestTableDrivenAllTypes::mutable_repeated_cord() {
+  return &repeated_cord_;
+}
+
+// optional int32 default_int32 = 61 [default = 41];
+inline bool TestTableDrivenAllTypes::has_default_int32() const {
+  return _has_bit(48);
+}
+inline void TestTableDrivenAllTypes::clear_default_int32() {
+  default_int32_ = 41;
+  _clear_bit(48);
+}
+inline ::google::protobuf::int32 TestTableDrivenAllTypes::default_int32() const {
+  return default_int32_;
+}
+inline void TestTableDrivenAllTypes::set_default_int32(::google::protobuf::int32 value) {
+  _set_bit(48);
+  default_int32_ = value;
+}
+
+// optional int64 default_int64 = 62 [default = 42];
+inline bool TestTableDrivenAllTypes::has_default_int64() const {
+  return _has_bit(49);
+}
+inline void TestTableDrivenAllTypes::clear_default_int64() {
+  default_int64_ = GOOGLE_LONGLONG(42);
+  _clear_bit(49);
+}
+inline ::google::protobuf::int64 TestTableDrivenAllTypes::default_int64() const {
+  return default_int64_;
+}
+inline void TestTableDrivenAllTypes::set_default_int64(::google::protobuf::int64 value) {
+  _set_bit(49);
+  default_int64_ = value;
+}
+
+// optional uint32 default_uint32 = 63 [default = 43];
+inline bool TestTableDrivenAllTypes::has_default_uint32() const {
+  return _has_bit(50);
+}
+inline void TestTableDrivenAllTypes::clear_default_uint32() {
+  default_uint32_ = 43u;
+  _clear_bit(50);
+}
+inline ::google::protobuf::uint32 TestTableDrivenAllTypes::default_uint32() const {
+  return default_uint32_;
+}
+inline void TestTableDrivenAllTypes::set_default_uint32(::google::protobuf::uint32 value) {
+  _set_bit(50);
+  default_uint32_ = value;
+}
+
+// optional uint64 default_uint64 = 64 [default = 44];
+inline bool TestTableDrivenAllTypes::has_default_uint64() const {
+  return _has_bit(51);
+}
+inline void TestTableDrivenAllTypes::clear_default_uint64() {
+  default_uint64_ = GOOGLE_ULONGLONG(44);
+  _clear_bit(51);
+}
+inline ::google::protobuf::uint64 TestTableDrivenAllTypes::default_uint64() const {
+  return default_uint64_;
+}
+inline void TestTableDrivenAllTypes::set_default_uint64(::google::protobuf::uint64 value) {
+  _set_bit(51);
+  default_uint64_ = value;
+}
+
+// optional sint32 default_sint32 = 65 [default = -45];
+inline bool TestTableDrivenAllTypes::has_default_sint32() const {
+  return _has_bit(52);
+}
+inline void TestTableDrivenAllTypes::clear_default_sint32() {
+  default_sint32_ = -45;
+  _clear_bit(52);
+}
+inline ::google::protobuf::int32 TestTableDrivenAllTypes::default_sint32() const {
+  return default_sint32_;
+}
+inline void TestTableDrivenAllTypes::set_default_sint32(::google::protobuf::int32 value) {
+  _set_bit(52);
+  default_sint32_ = value;
+}
+
+// optional sint64 default_sint64 = 66 [default = 46];
+inline bool TestTableDrivenAllTypes::has_default_sint64() const {
+  return _has_bit(53);
+}
+inline void TestTableDrivenAllTypes::clear_default_sint64() {
+  default_sint64_ = GOOGLE_LONGLONG(46);
+  _clear_bit(53);
+}
+inline ::google::protobuf::int64 TestTableDrivenAllTypes::default_sint64() const {
+  return default_sint64_;
+}
+inline void TestTableDrivenAllTypes::set_default_sint64(::google::protobuf::int64 value) {
+  _set_bit(53);
+  default_sint64_ = value;
+}
+
+// optional fixed32 default_fixed32 = 67 [default = 47];
+inline bool TestTableDrivenAllTypes::has_default_fixed32() const {
+  return _has_bit(54);
+}
+inline void TestTableDrivenAllTypes::clear_default_fixed32() {
+  default_fixed32_ = 47u;
+  _clear_bit(54);
+}
+inline ::google::protobuf::uint32 TestTableDrivenAllTypes::default_fixed32() const {
+  return default_fixed32_;
+}
+inline void TestTableDrivenAllTypes::set_default_fixed32(::google::protobuf::uint32 value) {
+  _set_bit(54);
+  default_fixed32_ = value;
+}
+
+// optional fixed64 default_fixed64 = 68 [default = 48];
+inline bool TestTableDrivenAllTypes::has_default_fixed64() const {
+  return _has_bit(55);
+}
+inline void TestTableDrivenAllTypes::clear_default_fixed64() {
+  default_fixed64_ = GOOGLE_ULONGLONG(48);
+  _clear_bit(55);
+}
+inline ::google::protobuf::uint64 TestTableDrivenAllTypes::default_fixed64() const {
+  return default_fixed64_;
+}
+inline void TestTableDrivenAllTypes::set_default_fixed64(::google::protobuf::uint64 value) {
+  _set_bit(55);
+  default_fixed64_ = value;
+}
+
+// optional sfixed32 default_sfixed32 = 69 [default = 49];
+inline bool TestTableDrivenAllTypes::has_default_sfixed32() const {
+  return _has_bit(56);
+}
+inline void TestTableDrivenAllTypes::clear_default_sfixed32() {
+  default_sfixed32_ = 49;
+  _clear_bit(56);
+}
+inline ::google::protobuf::int32 TestTableDrivenAllTypes::default_sfixed32() const {
+  return default_sfixed32_;
+}
+inline void TestTableDrivenAllTypes::set_default_sfixed32(::google::protobuf::int32 value) {
+  _set_bit(56);
+  default_sfixed32_ = value;
+}
+
+// optional sfixed64 default_sfixed64 = 70 [default = -50];
+inline bool TestTableDrivenAllTypes::has_default_sfixed64() const {
+  return _has_bit(57);
+}
+inline void TestTableDrivenAllTypes::clear_default_sfixed64() {
+  default_sfixed64_ = GOOGLE_LONGLONG(-50);
+  _clear_bit(57);
+}
+inline ::google::protobuf::int64 TestTableDrivenAllTypes::default_sfixed64() const {
+  return default_sfixed64_;
+}
+inline void TestTableDrivenAllTypes::set_default_sfixed64(::google::protobuf::int64 value) {
+  _set_bit(57);
+  default_sfixed64_ = value;
+}
+
+// optional float default_float = 71 [default = 51.5];
+inline bool TestTableDrivenAllTypes::has_default_float() const {
+  return _has_bit(58);
+}
+inline void TestTableDrivenAllTypes::clear_default_float() {
+  default_float_ = 51.5f;
+  _clear_bit(58);
+}
+inline float TestTableDrivenAllTypes::default_float() const {
+  return default_float_;
+}
+inline void TestTableDrivenAllTypes::set_default_float(float value) {
+  _set_bit(58);
+  default_float_ = value;
+}
+
+// optional double default_double = 72 [default = 52000];
+inline bool TestTableDrivenAllTypes::has_default_double() const {
+  return _has_bit(59);
+}
+inline void TestTableDrivenAllTypes::clear_default_double() {
+  default_double_ = 52000;
+  _clear_bit(59);
+}
+inline double TestTableDrivenAllTypes::default_double() const {
+  return default_double_;
+}
+inline void TestTableDrivenAllTypes::set_default_double(double value) {
+  _set_bit(59);
+  default_double_ = value;
+}
+
+// optional bool default_bool = 73 [default = true];
+inline bool TestTableDrivenAllTypes::has_default_bool() const {
+  return _has_bit(60);
+}
+inline void TestTableDrivenAllTypes::clear_default_bool() {
+  default_bool_ = true;
+  _clear_bit(60);
+}
+inline bool TestTableDrivenAllTypes::default_bool() const {
+  return default_bool_;
+}
+inline void TestTableDrivenAllTypes::set_default_bool(bool value) {
+  _set_bit(60);
+  default_bool_ = value;
+}
+
+// optional string default_string = 74 [default = "hello"];
+inline bool TestTableDrivenAllTypes::has_default_string() const {
+  return _has_bit(61);
+}
+inline void TestTableDrivenAllTypes::clear_default_string() {
+  if (default_string_ != &_default_default_string_) {
+    default_string_->assign(_default_default_string_);
+  }
+  _clear_bit(61);
+}
+inline const ::std::string& TestTableDrivenAllTypes::default_string() const {
+  return *default_string_;
+}
+inline void TestTableDrivenAllTypes::set_default_string(const ::std::string& value) {
+  _set_bit(61);
+  if (default_string_ == &_default_default_string_) {
+    default_string_ = ::google::protobuf::Arena::Create< ::std::string>(_arena_);
+  }
+  default_string_->assign(value);
+}
+inline void TestTableDrivenAllTypes::set_default_string(const char* value) {
+  _set_bit(61);
+  if (default_string_ == &_default_default_string_) {
+    default_string_ = ::google::protobuf::Arena::Create< ::std::string>(_arena_);
+  }
+  default_string_->assign(value);
+}
+inline void TestTableDrivenAllTypes::set_default_string(const char* value, size_t size) {
+  _set_bit(61);
+  if (default_string_ == &_default_default_string_) {
+    default_string_ = ::google::protobuf::Arena::Create< ::std::string>(_arena_);
+  }
+  default_string_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* TestTableDrivenAllTypes::mutable_default_string() {
+  _set_bit(61);
+  if (default_string_ == &_default_default_string_) {
+    default_string_ = ::google::protobuf::Arena::Create< ::std::string>(_arena_);
+    default_string_->assign(_default_default_string_);
+  }
+  return default_string_;
+}
+
+// optional bytes default_bytes = 75 [default = "world"];
+inline bool TestTableDrivenAllTypes::has_default_bytes() const {
+  return _has_bit(62);
+}
+inline void TestTableDrivenAllTypes::clear_default_bytes() {
+  if (default_bytes_ != &_default_default_bytes_) {
+    default_bytes_->assign(_default_default_bytes_);
+  }
+  _clear_bit(62);
+}
+inline const ::std::string& TestTableDrivenAllTypes::default_bytes() const {
+  return *default_bytes_;
+}
+inline void TestTableDrivenAllTypes::set_default_bytes(const ::std::string& value) {
+  _set_bit(62);
+  if (default_bytes_ == &_default_default_bytes_) {
+    default_bytes_ = ::google::protobuf::Arena::Create< ::std::string>(_arena_);
+  }
+  default_bytes_->assign(value);
+}
+inline void TestTableDrivenAllTypes::set_default_bytes(const char* value) {
+  _set_bit(62);
+  if (default_bytes_ == &_default_default_bytes_) {
+    default_bytes_ = ::google::protobuf::Arena::Create< ::std::string>(_arena_);
+  }
+  default_bytes_->assign(value);
+}
+inline void TestTableDrivenAllTypes::set_default_bytes(const void* value, size_t size) {
+  _set_bit(62);
+  if (default_bytes_ == &_default_default_bytes_) {
+    default_bytes_ = ::google::protobuf::Arena::Create< ::std::string>(_arena_);
+  }
+  default_bytes_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* TestTableDrivenAllTypes::mutable_default_bytes() {
+  _set_bit(62);
+  if (default_bytes_ == &_default_default_bytes_) {
+    default_bytes_ = ::google::protobuf::Arena::Create< ::std::string>(_arena_);
+    default_bytes_->assign(_default_default_bytes_);
+  }
+  return default_bytes_;
+}
+
+// optional .protobuf_unittest.TestTableDrivenAllTypes.NestedEnum default_nested_enum = 81 [default = BAR];
+inline bool TestTableDrivenAllTypes::has_default_nested_enum() const {
+  return _has_bit(63);
+}
+inline void TestTableDrivenAllTypes::clear_default_nested_enum() {
+  default_nested_enum_ = 2;
+  _clear_bit(63);
+}
+inline ::protobuf_unittest::TestTableDrivenAllTypes_NestedEnum TestTableDrivenAllTypes::default_nested_enum() const {
+  return static_cast< ::protobuf_unittest::TestTableDrivenAllTypes_NestedEnum >(default_nested_enum_);
+}
+inline void TestTableDrivenAllTypes::set_default_nested_enum(::protobuf_unittest::TestTableDrivenAllTypes_NestedEnum value) {
+  GOOGLE_DCHECK(::protobuf_unittest::TestTableDrivenAllTypes_NestedEnum_IsValid(value));
+  _set_bit(63);
+  default_nested_enum_ = value;
+}
+
+// optional .protobuf_unittest.ForeignEnum default_foreign_enum = 82 [default = FOREIGN_BAR];
+inline bool TestTableDrivenAllTypes::has_default_foreign_enum() const {
+  return _has_bit(64);
+}
+inline void TestTableDrivenAllTypes::clear_default_foreign_enum() {
+  default_foreign_enum_ = 5;
+  _clear_bit(64);
+}
+inline protobuf_unittest::ForeignEnum TestTableDrivenAllTypes::default_foreign_enum() const {
+  return static_cast< protobuf_unittest::ForeignEnum >(default_foreign_enum_);
+}
+inline void TestTableDrivenAllTypes::set_default_foreign_enum(protobuf_unittest::ForeignEnum value) {
+  GOOGLE_DCHECK(protobuf_unittest::ForeignEnum_IsValid(value));
+  _set_bit(64);
+  default_foreign_enum_ = value;
+}
+
+// optional .protobuf_unittest_import.ImportEnum default_import_enum = 83 [default = IMPORT_BAR];
+inline bool TestTableDrivenAllTypes::has_default_import_enum() const {
+  return _has_bit(65);
+}
+inline void TestTableDrivenAllTypes::clear_default_import_enum() {
+  default_import_enum_ = 8;
+  _clear_bit(65);
+}
+inline protobuf_unittest_import::ImportEnum TestTableDrivenAllTypes::default_import_enum() const {
+  return static_cast< protobuf_unittest_import::ImportEnum >(default_import_enum_);
+}
+inline void TestTableDrivenAllTypes::set_default_import_enum(protobuf_unittest_import::ImportEnum value) {
+  GOOGLE_DCHECK(protobuf_unittest_import::ImportEnum_IsValid(value));
+  _set_bit(65);
+  default_import_enum_ = value;
+}
+
+// optional string default_string_piece = 84 [default = "abc", ctype = STRING_PIECE];
+inline bool TestTableDrivenAllTypes::has_default_string_piece() const {
+  return _has_bit(66);
+}
+inline void TestTableDrivenAllTypes::clear_default_string_piece() {
+  default_string_piece_.SetAliased("abc", 3);
+  _clear_bit(66);
+}
+inline const ::google::protobuf::internal::StringPieceField& TestTableDrivenAllTypes::default_string_piece() const {
+  return default_string_piece_;
+}
+inline void TestTableDrivenAllTypes::set_default_string_piece(const ::std::string& value) {
+  _set_bit(66);
+  default_string_piece_.CopyFrom(value.data(), value.size());
+}
+inline void TestTableDrivenAllTypes::set_default_string_piece(const char* value) {
+  _set_bit(66);
+  default_string_piece_.CopyFrom(value, strlen(value));
+}
+inline void TestTableDrivenAllTypes::set_default_string_piece(const char* value, size_t size) {
+  _set_bit(66);
+  default_string_piece_.CopyFrom(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* TestTableDrivenAllTypes::mutable_default_string_piece() {
+  _set_bit(66);
+  return default_string_piece_.Mutable();
+}
+
+// optional string default_cord = 85 [default = "123", ctype = CORD];
+inline bool TestTableDrivenAllTypes::has_default_cord() const {
+  return _has_bit(67);
+}
+inline void TestTableDrivenAllTypes::clear_default_cord() {
+  if (default_cord_ != &_default_default_cord_) {
+    default_cord_->assign(_default_default_cord_);
+  }
+  _clear_bit(67);
+}
+inline const ::std::string& TestTableDrivenAllTypes::default_cord() const {
+  return *default_cord_;
+}
+inline void TestTableDrivenAllTypes::set_default_cord(const ::std::string& value) {
+  _set_bit(67);
+  if (default_cord_ == &_default_default_cord_) {
+    default_cord_ = ::google::protobuf::Arena::Create< ::std::string>(_arena_);
+  }
+  default_cord_->assign(value);
+}
+inline void TestTableDrivenAllTypes::set_default_cord(const char* value) {
+  _set_bit(67);
+  if (default_cord_ == &_default_default_cord_) {
+    default_cord_ = ::google::protobuf::Arena::Create< ::std::string>(_arena_);
+  }
+  default_cord_->assign(value);
+}
+inline void TestTableDrivenAllTypes::set_default_cord(const char* value, size_t size) {
+  _set_bit(67);
+  if (default_cord_ == &_default_default_cord_) {
+    default_cord_ = ::google::protobuf::Arena::Create< ::std::string>(_arena_);
+  }
+  default_cord_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* TestTableDrivenAllTypes::mutable_default_cord() {
+  _set_bit(67);
+  if (default_cord_ == &_default_default_cord_) {
+    default_cord_ = ::google::protobuf::Arena::Create< ::std::string>(_arena_);
+    default_cord_->assign(_default_default_cord_);
+  }
+  return default_cord_;
+}
+
+// -------------------------------------------------------------------
+
+// TestTableDrivenPackedTypes
+
+// repeated int32 packed_int32 = 90 [packed = true];
+inline int TestTableDrivenPackedTypes::packed_int32_size() const {
+  return packed_int32_.size();
+}
+inline void TestTableDrivenPackedTypes::clear_packed_int32() {
+  packed_int32_.Clear();
+}
+inline ::google::protobuf::int32 TestTableDrivenPackedTypes::packed_int32(int index) const {
+  return packed_int32_.Get(index);
+}
+inline void TestTableDrivenPackedTypes::set_packed_int32(int index, ::google::protobuf::int32 value) {
+  packed_int32_.Set(index, value);
+}
+inline void TestTableDrivenPackedTypes::add_packed_int32(::google::protobuf::int32 value) {
+  packed_int32_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+TestTableDrivenPackedTypes::packed_int32() const {
+  return packed_int32_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+TestTableDrivenPackedTypes::mutable_packed_int32() {
+  return &packed_int32_;
+}
+
+// repeated int64 packed_int64 = 91 [packed = true];
+inline int TestTableDrivenPackedTypes::packed_int64_size() const {
+  return packed_int64_.size();
+}
+inline void TestTableDrivenPackedTypes::clear_packed_int64() {
+  packed_int64_.Clear();
+}
+inline ::google::protobuf::int64 TestTableDrivenPackedTypes::packed_int64(int index) const {
+  return packed_int64_.Get(index);
+}
+inline void TestTableDrivenPackedTypes::set_packed_int64(int index, ::google::protobuf::int64 value) {
+  packed_int64_.Set(index, value);
+}
+inline void TestTableDrivenPackedTypes::add_packed_int64(::google::protobuf::int64 value) {
+  packed_int64_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
+TestTableDrivenPackedTypes::packed_int64() const {
+  return packed_int64_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
+TestTableDrivenPackedTypes::mutable_packed_int64() {
+  return &packed_int64_;
+}
+
+// repeated uint32 packed_uint32 = 92 [packed = true];
+inline int TestTableDrivenPackedTypes::packed_uint32_size() const {
+  return packed_uint32_.size();
+}
+inline void TestTableDrivenPackedTypes::clear_packed_uint32() {
+  packed_uint32_.Clear();
+}
+inline ::google::protobuf::uint32 TestTableDrivenPackedTypes::packed_uint32(int index) const {
+  return packed_uint32_.Get(index);
+}
+inline void TestTableDrivenPackedTypes::set_packed_uint32(int index, ::google::protobuf::uint32 value) {
+  packed_uint32_.Set(index, value);
+}
+inline void TestTableDrivenPackedTypes::add_packed_uint32(::google::protobuf::uint32 value) {
+  packed_uint32_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+TestTableDrivenPackedTypes::packed_uint32() const {
+  return packed_uint32_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+TestTableDrivenPackedTypes::mutable_packed_uint32() {
+  return &packed_uint32_;
+}
+
+// repeated uint64 packed_uint64 = 93 [packed = true];
+inline int TestTableDrivenPackedTypes::packed_uint64_size() const {
+  return packed_uint64_.size();
+}
+inline void TestTableDrivenPackedTypes::clear_packed_uint64() {
+  packed_uint64_.Clear();
+}
+inline ::google::protobuf::uint64 TestTableDrivenPackedTypes::packed_uint64(int index) const {
+  return packed_uint64_.Get(index);
+}
+inline void TestTableDrivenPackedTypes::set_packed_uint64(int index, ::google::protobuf::uint64 value) {
+  packed_uint64_.Set(index, value);
+}
+inline void TestTableDrivenPackedTypes::add_packed_uint64(::google::protobuf::uint64 value) {
+  packed_uint64_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
+TestTableDrivenPackedTypes::packed_uint64() const {
+  return packed_uint64_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
+TestTableDrivenPackedTypes::mutable_packed_uint64() {
+  return &packed_uint64_;
+}
+
+// repeated sint32 packed_sint32 = 94 [packed = true];
+inline int TestTableDrivenPackedTypes::packed_sint32_size() const {
+  return packed_sint32_.size();
+}
+inline void TestTableDrivenPackedTypes::clear_packed_sint32() {
+  packed_sint32_.Clear();
+}
+inline ::google::protobuf::int32 TestTableDrivenPackedTypes::packed_sint32(int index) const {
+  return packed_sint32_.Get(index);
+}
+inline void TestTableDrivenPackedTypes::set_packed_sint32(int index, ::google::protobuf::int32 value) {
+  packed_sint32_.Set(index, value);
+}
+inline void TestTableDrivenPackedTypes::add_packed_sint32(::google::protobuf::int32 value) {
+  packed_sint32_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+TestTableDrivenPackedTypes::packed_sint32() const {
+  return packed_sint32_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+TestTableDrivenPackedTypes::mutable_packed_sint32() {
+  return &packed_sint32_;
+}
+
+// repeated sint64 packed_sint64 = 95 [packed = true];
+inline int TestTableDrivenPackedTypes::packed_sint64_size() const {
+  return packed_sint64_.size();
+}
+inline void TestTableDrivenPackedTypes::clear_packed_sint64() {
+  packed_sint64_.Clear();
+}
+inline ::google::protobuf::int64 TestTableDrivenPackedTypes::packed_sint64(int index) const {
+  return packed_sint64_.Get(index);
+}
+inline void TestTableDrivenPackedTypes::set_packed_sint64(int index, ::google::protobuf::int64 value) {
+  packed_sint64_.Set(index, value);
+}
+inline void TestTableDrivenPackedTypes::add_packed_sint64(::google::protobuf::int64 value) {
+  packed_sint64_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
+TestTableDrivenPackedTypes::packed_sint64() const {
+  return packed_sint64_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
+TestTableDrivenPackedTypes::mutable_packed_sint64() {
+  return &packed_sint64_;
+}
+
+// repeated fixed32 packed_fixed32 = 96 [packed = true];
+inline int TestTableDrivenPackedTypes::packed_fixed32_size() const {
+  return packed_fixed32_.size();
+}
+inline void TestTableDrivenPackedTypes::clear_packed_fixed32() {
+  packed_fixed32_.Clear();
+}
+inline ::google::protobuf::uint32 TestTableDrivenPackedTypes::packed_fixed32(int index) const {
+  return packed_fixed32_.Get(index);
+}
+inline void TestTableDrivenPackedTypes::set_packed_fixed32(int index, ::google::protobuf::uint32 value) {
+  packed_fixed32_.Set(index, value);
+}
+inline void TestTableDrivenPackedTypes::add_packed_fixed32(::google::protobuf::uint32 value) {
+  packed_fixed32_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+TestTableDrivenPackedTypes::packed_fixed32() const {
+  return packed_fixed32_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+TestTableDrivenPackedTypes::mutable_packed_fixed32() {
+  return &packed_fixed32_;
+}
+
+// repeated fixed64 packed_fixed64 = 97 [packed = true];
+inline int TestTableDrivenPackedTypes::packed_fixed64_size() const {
+  return packed_fixed64_.size();
+}
+inline void TestTableDrivenPackedTypes::clear_packed_fixed64() {
+  packed_fixed64_.Clear();
+}
+inline ::google::protobuf::uint64 TestTableDrivenPackedTypes::packed_fixed64(int index) const {
+  return packed_fixed64_.Get(index);
+}
+inline void TestTableDrivenPackedTypes::set_packed_fixed64(int index, ::google::protobuf::uint64 value) {
+  packed_fixed64_.Set(index, value);
+}
+inline void TestTableDrivenPackedTypes::add_packed_fixed64(::google::protobuf::uint64 value) {
+  packed_fixed64_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
+TestTableDrivenPackedTypes::packed_fixed64() const {
+  return packed_fixed64_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
+TestTableDrivenPackedTypes::mutable_packed_fixed64() {
+  return &packed_fixed64_;
+}
+
+// repeated sfixed32 packed_sfixed32 = 98 [packed = true];
+inline int TestTableDrivenPackedTypes::packed_sfixed32_size() const {
+  return packed_sfixed32_.size();
+}
+inline void TestTableDrivenPackedTypes::clear_packed_sfixed32() {
+  packed_sfixed32_.Clear();
+}
+inline ::google::protobuf::int32 TestTableDrivenPackedTypes::packed_sfixed32(int index) const {
+  return packed_sfixed32_.Get(index);
+}
+inline void TestTableDrivenPackedTypes::set_packed_sfixed32(int index, ::google::protobuf::int32 value) {
+  packed_sfixed32_.Set(index, value);
+}
+inline void TestTableDrivenPackedTypes::add_packed_sfixed32(::google::protobuf::int32 value) {
+  packed_sfixed32_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+TestTableDrivenPackedTypes::packed_sfixed32() const {
+  return packed_sfixed32_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+TestTableDrivenPackedTypes::mutable_packed_sfixed32() {
+  return &packed_sfixed32_;
+}
+
+// repeated sfixed64 packed_sfixed64 = 99 [packed = true];
+inline int TestTableDrivenPackedTypes::packed_sfixed64_size() const {
+  return packed_sfixed64_.size();
+}
+inline void TestTableDrivenPackedTypes::clear_packed_sfixed64() {
+  packed_sfixed64_.Clear();
+}
+inline ::google::protobuf::int64 TestTableDrivenPackedTypes::packed_sfixed64(int index) const {
+  return packed_sfixed64_.Get(index);
+}
+inline void TestTableDrivenPackedTypes::set_packed_sfixed64(int index, ::google::protobuf::int64 value) {
+  packed_sfixed64_.Set(index, value);
+}
+inline void TestTableDrivenPackedTypes::add_packed_sfixed64(::google::protobuf::int64 value) {
+  packed_sfixed64_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
+TestTableDrivenPackedTypes::packed_sfixed64() const {
+  return packed_sfixed64_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
+TestTableDrivenPackedTypes::mutable_packed_sfixed64() {
+  return &packed_sfixed64_;
+}
+
+// repeated float packed_float = 100 [packed = true];
+inline int TestTableDrivenPackedTypes::packed_float_size() const {
+  return packed_float_.size();
+}
+inline void TestTableDrivenPackedTypes::clear_packed_float() {
+  packed_float_.Clear();
+}
+inline float TestTableDrivenPackedTypes::packed_float(int index) const {
+  return packed_float_.Get(index);
+}
+inline void TestTableDrivenPackedTypes::set_packed_float(int index, float value) {
+  packed_float_.Set(index, value);
+}
+inline void TestTableDrivenPackedTypes::add_packed_float(float value) {
+  packed_float_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< float >&
+TestTableDrivenPackedTypes::packed_float() const {
+  return packed_float_;
+}
+inline ::google::protobuf::RepeatedField< float >*
+TestTableDrivenPackedTypes::mutable_packed_float() {
+  return &packed_float_;
+}
+
+// repeated double packed_double = 101 [packed = true];
+inline int TestTableDrivenPackedTypes::packed_double_size() const {
+  return packed_double_.size();
+}
+inline void TestTableDrivenPackedTypes::clear_packed_double() {
+  packed_double_.Clear();
+}
+inline double TestTableDrivenPackedTypes::packed_double(int index) const {
+  return packed_double_.Get(index);
+}
+inline void TestTableDrivenPackedTypes::set_packed_double(int index, double value) {
+  packed_double_.Set(index, value);
+}
+inline void TestTableDrivenPackedTypes::add_packed_double(double value) {
+  packed_double_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< double >&
+TestTableDrivenPackedTypes::packed_double() const {
+  return packed_double_;
+}
+inline ::google::protobuf::RepeatedField< double >*
+TestTableDrivenPackedTypes::mutable_packed_double() {
+  return &packed_double_;
+}
+
+// repeated bool packed_bool = 102 [packed = true];
+inline int TestTableDrivenPackedTypes::packed_bool_size() const {
+  return packed_bool_.size();
+}
+inline void TestTableDrivenPackedTypes::clear_packed_bool() {
+  packed_bool_.Clear();
+}
+inline bool TestTableDrivenPackedTypes::packed_bool(int index) const {
+  return packed_bool_.Get(index);
+}
+inline void TestTableDrivenPackedTypes::set_packed_bool(int index, bool value) {
+  packed_bool_.Set(index, value);
+}
+inline void TestTableDrivenPackedTypes::add_packed_bool(bool value) {
+  packed_bool_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< bool >&
+TestTableDrivenPackedTypes::packed_bool() const {
+  return packed_bool_;
+}
+inline ::google::protobuf::RepeatedField< bool >*
+TestTableDrivenPackedTypes::mutable_packed_bool() {
+  return &packed_bool_;
+}
+
+// repeated .protobuf_unittest.ForeignEnum packed_enum = 103 [packed = true];
+inline int TestTableDrivenPackedTypes::packed_enum_size() const {
+  return packed_enum_.size();
+}
+inline void TestTableDrivenPackedTypes::clear_packed_enum() {
+  packed_enum_.Clear();
+}
+inline protobuf_unittest::ForeignEnum TestTableDrivenPackedTypes::packed_enum(int index) const {
+  return static_cast< protobuf_unittest::ForeignEnum >(packed_enum_.Get(index));
+}
+inline void TestTableDrivenPackedTypes::set_packed_enum(int index, protobuf_unittest::ForeignEnum value) {
+  GOOGLE_DCHECK(protobuf_unittest::ForeignEnum_IsValid(value));
+  packed_enum_.Set(index, value);
+}
+inline void TestTableDrivenPackedTypes::add_packed_enum(protobuf_unittest::ForeignEnum value) {
+  GOOGLE_DCHECK(protobuf_unittest::ForeignEnum_IsValid(value));
+  packed_enum_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField<int>&
+TestTableDrivenPackedTypes::packed_enum() const {
+  return packed_enum_;
+}
+inline ::google::protobuf::RepeatedField<int>*
+TestTableDrivenPackedTypes::mutable_packed_enum() {
+  return &packed_enum_;
+}
+
+// -------------------------------------------------------------------
+
+// TestTableDrivenUnpackedTypes
+
+// repeated int32 unpacked_int32 = 90 [packed = false];
+inline int TestTableDrivenUnpackedTypes::unpacked_int32_size() const {
+  return unpacked_int32_.size();
+}
+inline void TestTableDrivenUnpackedTypes::clear_unpacked_int32() {
+  unpacked_int32_.Clear();
+}
+inline ::google::protobuf::int32 TestTableDrivenUnpackedTypes::unpacked_int32(int index) const {
+  return unpacked_int32_.Get(index);
+}
+inline void TestTableDrivenUnpackedTypes::set_unpacked_int32(int index, ::google::protobuf::int32 value) {
+  unpacked_int32_.Set(index, value);
+}
+inline void TestTableDrivenUnpackedTypes::add_unpacked_int32(::google::protobuf::int32 value) {
+  unpacked_int32_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+TestTableDrivenUnpackedTypes::unpacked_int32() const {
+  return unpacked_int32_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+TestTableDrivenUnpackedTypes::mutable_unpacked_int32() {
+  return &unpacked_int32_;
+}
+
+// repeated int64 unpacked_int64 = 91 [packed = false];
+inline int TestTableDrivenUnpackedTypes::unpacked_int64_size() const {
+  return unpacked_int64_.size();
+}
+inline void TestTableDrivenUnpackedTypes::clear_unpacked_int64() {
+  unpacked_int64_.Clear();
+}
+inline ::google::protobuf::int64 TestTableDrivenUnpackedTypes::unpacked_int64(int index) const {
+  return unpacked_int64_.Get(index);
+}
+inline void TestTableDrivenUnpackedTypes::set_unpacked_int64(int index, ::google::protobuf::int64 value) {
+  unpacked_int64_.Set(index, value);
+}
+inline void TestTableDrivenUnpackedTypes::add_unpacked_int64(::google::protobuf::int64 value) {
+  unpacked_int64_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
+TestTableDrivenUnpackedTypes::unpacked_int64() const {
+  return unpacked_int64_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
+TestTableDrivenUnpackedTypes::mutable_unpacked_int64() {
+  return &unpacked_int64_;
+}
+
+// repeated uint32 unpacked_uint32 = 92 [packed = false];
+inline int TestTableDrivenUnpackedTypes::unpacked_uint32_size() const {
+  return unpacked_uint32_.size();
+}
+inline void TestTableDrivenUnpackedTypes::clear_unpacked_uint32() {
+  unpacked_uint32_.Clear();
+}
+inline ::google::protobuf::uint32 TestTableDrivenUnpackedTypes::unpacked_uint32(int index) const {
+  return unpacked_uint32_.Get(index);
+}
+inline void TestTableDrivenUnpackedTypes::set_unpacked_uint32(int index, ::google::protobuf::uint32 value) {
+  unpacked_uint32_.Set(index, value);
+}
+inline void TestTableDrivenUnpackedTypes::add_unpacked_uint32(::google::protobuf::uint32 value) {
+  unpacked_uint32_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+TestTableDrivenUnpackedTypes::unpacked_uint32() const {
+  return unpacked_uint32_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+TestTableDrivenUnpackedTypes::mutable_unpacked_uint32() {
+  return &unpacked_uint32_;
+}
+
+// repeated uint64 unpacked_uint64 = 93 [packed = false];
+inline int TestTableDrivenUnpackedTypes::unpacked_uint64_size() const {
+  return unpacked_uint64_.size();
+}
+inline void TestTableDrivenUnpackedTypes::clear_unpacked_uint64() {
+  unpacked_uint64_.Clear();
+}
+inline ::google::protobuf::uint64 TestTableDrivenUnpackedTypes::unpacked_uint64(int index) const {
+  return unpacked_uint64_.Get(index);
+}
+inline void TestTableDrivenUnpackedTypes::set_unpacked_uint64(int index, ::google::protobuf::uint64 value) {
+  unpacked_uint64_.Set(index, value);
+}
+inline void TestTableDrivenUnpackedTypes::add_unpacked_uint64(::google::protobuf::uint64 value) {
+  unpacked_uint64_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
+TestTableDrivenUnpackedTypes::unpacked_uint64() const {
+  return unpacked_uint64_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
+TestTableDrivenUnpackedTypes::mutable_unpacked_uint64() {
+  return &unpacked_uint64_;
+}
+
+// repeated sint32 unpacked_sint32 = 94 [packed = false];
+inline int TestTableDrivenUnpackedTypes::unpacked_sint32_size() const {
+  return unpacked_sint32_.size();
+}
+inline void TestTableDrivenUnpackedTypes::clear_unpacked_sint32() {
+  unpacked_sint32_.Clear();
+}
+inline ::google::protobuf::int32 TestTableDrivenUnpackedTypes::unpacked_sint32(int index) const {
+  return unpacked_sint32_.Get(index);
+}
+inline void TestTableDrivenUnpackedTypes::set_unpacked_sint32(int index, ::google::protobuf::int32 value) {
+  unpacked_sint32_.Set(index, value);
+}
+inline void TestTableDrivenUnpackedTypes::add_unpacked_sint32(::google::protobuf::int32 value) {
+  unpacked_sint32_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+TestTableDrivenUnpackedTypes::unpacked_sint32() const {
+  return unpacked_sint32_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+TestTableDrivenUnpackedTypes::mutable_unpacked_sint32() {
+  return &unpacked_sint32_;
+}
+
+// repeated sint64 unpacked_sint64 = 95 [packed = false];
+inline int TestTableDrivenUnpackedTypes::unpacked_sint64_size() const {
+  return unpacked_sint64_.size();
+}
+inline void TestTableDrivenUnpackedTypes::clear_unpacked_sint64() {
+  unpacked_sint64_.Clear();
+}
+inline ::google::protobuf::int64 TestTableDrivenUnpackedTypes::unpacked_sint64(int index) const {
+  return unpacked_sint64_.Get(index);
+}
+inline void TestTableDrivenUnpackedTypes::set_unpacked_sint64(int index, ::google::protobuf::int64 value) {
+  unpacked_sint64_.Set(index, value);
+}
+inline void TestTableDrivenUnpackedTypes::add_unpacked_sint64(::google::protobuf::int64 value) {
+  unpacked_sint64_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
+TestTableDrivenUnpackedTypes::unpacked_sint64() const {
+  return unpacked_sint64_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
+TestTableDrivenUnpackedTypes::mutable_unpacked_sint64() {
+  return &unpacked_sint64_;
+}
+
+// repeated fixed32 unpacked_fixed32 = 96 [packed = false];
+inline int TestTableDrivenUnpackedTypes::unpacked_fixed32_size() const {
+  return unpacked_fixed32_.size();
+}
+inline void TestTableDrivenUnpackedTypes::clear_unpacked_fixed32() {
+  unpacked_fixed32_.Clear();
+}
+inline ::google::protobuf::uint32 TestTableDrivenUnpackedTypes::unpacked_fixed32(int index) const {
+  return unpacked_fixed32_.Get(index);
+}
+inline void TestTableDrivenUnpackedTypes::set_unpacked_fixed32(int index, ::google::protobuf::uint32 value) {
+  unpacked_fixed32_.Set(index, value);
+}
+inline void TestTableDrivenUnpackedTypes::add_unpacked_fixed32(::google::protobuf::uint32 value) {
+  unpacked_fixed32_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+TestTableDrivenUnpackedTypes::unpacked_fixed32() const {
+  return unpacked_fixed32_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+TestTableDrivenUnpackedTypes::mutable_unpacked_fixed32() {
+  return &unpacked_fixed32_;
+}
+
+// repeated fixed64 unpacked_fixed64 = 97 [packed = false];
+inline int TestTableDrivenUnpackedTypes::unpacked_fixed64_size() const {
+  return unpacked_fixed64_.size();
+}
+inline void TestTableDrivenUnpackedTypes::clear_unpacked_fixed64() {
+  unpacked_fixed64_.Clear();
+}
+inline ::google::protobuf::uint64 TestTableDrivenUnpackedTypes::unpacked_fixed64(int index) const {
+  return unpacked_fixed64_.Get(index);
+}
+inline void TestTableDrivenUnpackedTypes::set_unpacked_fixed64(int index, ::google::protobuf::uint64 value) {
+  unpacked_fixed64_.Set(index, value);
+}
+inline void TestTableDrivenUnpackedTypes::add_unpacked_fixed64(::google::protobuf::uint64 value) {
+  unpacked_fixed64_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
+TestTableDrivenUnpackedTypes::unpacked_fixed64() const {
+  return unpacked_fixed64_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
+TestTableDrivenUnpackedTypes::mutable_unpacked_fixed64() {
+  return &unpacked_fixed64_;
+}
+
+// repeated sfixed32 unpacked_sfixed32 = 98 [packed = false];
+inline int TestTableDrivenUnpackedTypes::unpacked_sfixed32_size() const {
+  return unpacked_sfixed32_.size();
+}
+inline void TestTableDrivenUnpackedTypes::clear_unpacked_sfixed32() {
+  unpacked_sfixed32_.Clear();
+}
+inline ::google::protobuf::int32 TestTableDrivenUnpackedTypes::unpacked_sfixed32(int index) const {
+  return unpacked_sfixed32_.Get(index);
+}
+inline void TestTableDrivenUnpackedTypes::set_unpacked_sfixed32(int index, ::google::protobuf::int32 value) {
+  unpacked_sfixed32_.Set(index, value);
+}
+inline void TestTableDrivenUnpackedTypes::add_unpacked_sfixed32(::google::protobuf::int32 value) {
+  unpacked_sfixed32_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+TestTableDrivenUnpackedTypes::unpacked_sfixed32() const {
+  return unpacked_sfixed32_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+TestTableDrivenUnpackedTypes::mutable_unpacked_sfixed32() {
+  return &unpacked_sfixed32_;
+}
+
+// repeated sfixed64 unpacked_sfixed64 = 99 [packed = false];
+inline int TestTableDrivenUnpackedTypes::unpacked_sfixed64_size() const {
+  return unpacked_sfixed64_.size();
+}
+inline void TestTableDrivenUnpackedTypes::clear_unpacked_sfixed64() {
+  unpacked_sfixed64_.Clear();
+}
+inline ::google::protobuf::int64 TestTableDrivenUnpackedTypes::unpacked_sfixed64(int index) const {
+  return unpacked_sfixed64_.Get(index);
+}
+inline void TestTableDrivenUnpackedTypes::set_unpacked_sfixed64(int index, ::google::protobuf::int64 value) {
+  unpacked_sfixed64_.Set(index, value);
+}
+inline void TestTableDrivenUnpackedTypes::add_unpacked_sfixed64(::google::protobuf::int64 value) {
+  unpacked_sfixed64_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
+TestTableDrivenUnpackedTypes::unpacked_sfixed64() const {
+  return unpacked_sfixed64_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
+TestTableDrivenUnpackedTypes::mutable_unpacked_sfixed64() {
+  return &unpacked_sfixed64_;
+}
+
+// repeated float unpacked_float = 100 [packed = false];
+inline int TestTableDrivenUnpackedTypes::unpacked_float_size() const {
+  return unpacked_float_.size();
+}
+inline void TestTableDrivenUnpackedTypes::clear_unpacked_float() {
+  unpacked_float_.Clear();
+}
+inline float TestTableDrivenUnpackedTypes::unpacked_float(int index) const {
+  return unpacked_float_.Get(index);
+}
+inline void TestTableDrivenUnpackedTypes::set_unpacked_float(int index, float value) {
+  unpacked_float_.Set(index, value);
+}
+inline void TestTableDrivenUnpackedTypes::add_unpacked_float(float value) {
+  unpacked_float_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< float >&
+TestTableDrivenUnpackedTypes::unpacked_float() const {
+  return unpacked_float_;
+}
+inline ::google::protobuf::RepeatedField< float >*
+TestTableDrivenUnpackedTypes::mutable_unpacked_float() {
+  return &unpacked_float_;
+}
+
+// repeated double unpacked_double = 101 [packed = false];
+inline int TestTableDrivenUnpackedTypes::unpacked_double_size() const {
+  return unpacked_double_.size();
+}
+inline void TestTableDrivenUnpackedTypes::clear_unpacked_double() {
+  unpacked_double_.Clear();
+}
+inline double TestTableDrivenUnpackedTypes::unpacked_double(int index) const {
+  return unpacked_double_.Get(index);
+}
+inline void TestTableDrivenUnpackedTypes::set_unpacked_double(int index, double value) {
+  unpacked_double_.Set(index, value);
+}
+inline void TestTableDrivenUnpackedTypes::add_unpacked_double(double value) {
+  unpacked_double_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< double >&
+TestTableDrivenUnpackedTypes::unpacked_double() const {
+  return unpacked_double_;
+}
+inline ::google::protobuf::RepeatedField< double >*
+TestTableDrivenUnpackedTypes::mutable_unpacked_double() {
+  return &unpacked_double_;
+}
+
+// repeated bool unpacked_bool = 102 [packed = false];
+inline int TestTableDrivenUnpackedTypes::unpacked_bool_size() const {
+  return unpacked_bool_.size();
+}
+inline void TestTableDrivenUnpackedTypes::clear_unpacked_bool() {
+  unpacked_bool_.Clear();
+}
+inline bool TestTableDrivenUnpackedTypes::unpacked_bool(int index) const {
+  return unpacked_bool_.Get(index);
+}
+inline void TestTableDrivenUnpackedTypes::set_unpacked_bool(int index, bool value) {
+  unpacked_bool_.Set(index, value);
+}
+inline void TestTableDrivenUnpackedTypes::add_unpacked_bool(bool value) {
+  unpacked_bool_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< bool >&
+TestTableDrivenUnpackedTypes::unpacked_bool() const {
+  return unpacked_bool_;
+}
+inline ::google::protobuf::RepeatedField< bool >*
+TestTableDrivenUnpackedTypes::mutable_unpacked_bool() {
+  return &unpacked_bool_;
+}
+
+// repeated .protobuf_unittest.ForeignEnum unpacked_enum = 103 [packed = false];
+inline int TestTableDrivenUnpackedTypes::unpacked_enum_size() const {
+  return unpacked_enum_.size();
+}
+inline void TestTableDrivenUnpackedTypes::clear_unpacked_enum() {
+  unpacked_enum_.Clear();
+}
+inline protobuf_unittest::ForeignEnum TestTableDrivenUnpackedTypes::unpacked_enum(int index) const {
+  return static_cast< protobuf_unittest::ForeignEnum >(unpacked_enum_.Get(index));
+}
+inline void TestTableDrivenUnpackedTypes::set_unpacked_enum(int index, protobuf_unittest::ForeignEnum value) {
+  GOOGLE_DCHECK(protobuf_unittest::ForeignEnum_IsValid(value));
+  unpacked_enum_.Set(index, value);
+}
+inline void TestTableDrivenUnpackedTypes::add_unpacked_enum(protobuf_unittest::ForeignEnum value) {
+  GOOGLE_DCHECK(protobuf_unittest::ForeignEnum_IsValid(value));
+  unpacked_enum_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField<int>&
+TestTableDrivenUnpackedTypes::unpacked_enum() const {
+  return unpacked_enum_;
+}
+inline ::google::protobuf::RepeatedField<int>*
+TestTableDrivenUnpackedTypes::mutable_unpacked_enum() {
+  return &unpacked_enum_;
+}
+
+// -------------------------------------------------------------------
+
+// TestTableDrivenLazyMessage
+
+// optional int32 id = 1;
+inline bool TestTableDrivenLazyMessage::has_id() const {
+  return _has_bit(0);
+}
+inline void TestTableDrivenLazyMessage::clear_id() {
+  id_ = 0;
+  _clear_bit(0);
+}
+inline ::google::protobuf::int32 TestTableDrivenLazyMessage::id() const {
+  return id_;
+}
+inline void TestTableDrivenLazyMessage::set_id(::google::protobuf::int32 value) {
+  _set_bit(0);
+  id_ = value;
+}
+
+// optional .protobuf_unittest.TestAllTypes lazy_child = 2 [lazy = true];
+inline bool TestTableDrivenLazyMessage::has_lazy_child() const {
+  return _has_bit(1);
+}
+inline void TestTableDrivenLazyMessage::clear_lazy_child() {
+  lazy_child_.Clear();
+  _clear_bit(1);
+}
+inline const ::protobuf_unittest::TestAllTypes& TestTableDrivenLazyMessage::lazy_child() const {
+  return static_cast<const ::protobuf_unittest::TestAllTypes&>(
+      lazy_child_.Get(::protobuf_unittest::TestAllTypes::default_instance()));
+}
+inline ::protobuf_unittest::TestAllTypes* TestTableDrivenLazyMessage::mutable_lazy_child() {
+  _set_bit(1);
+  return static_cast< ::protobuf_unittest::TestAllTypes*>(
+      lazy_child_.Mutable(::protobuf_unittest::TestAllTypes::default_instance()));
+}
+
+// optional .protobuf_unittest.TestAllTypes eager_child = 3;
+inline bool TestTableDrivenLazyMessage::has_eager_child() const {
+  return _has_bit(2);
+}
+inline void TestTableDrivenLazyMessage::clear_eager_child() {
+  if (eager_child_ != NULL) eager_child_->::protobuf_unittest::TestAllTypes::Clear();
+  _clear_bit(2);
+}
+inline const ::protobuf_unittest::TestAllTypes& TestTableDrivenLazyMessage::eager_child() const {
+  return eager_child_ != NULL ? *eager_child_ : ::protobuf_unittest::TestAllTypes::default_instance();
+}
+inline ::protobuf_unittest::TestAllTypes* TestTableDrivenLazyMessage::mutable_eager_child() {
+  _set_bit(2);
+  if (eager_child_ == NULL) eager_child_ = ::google::protobuf::Arena::CreateMessage< ::protobuf_unittest::TestAllTypes >(_arena_);
+  return eager_child_;
+}
+
+// optional .protobuf_unittest.TestRequired lazy_required = 4 [lazy = true];
+inline bool TestTableDrivenLazyMessage::has_lazy_required() const {
+  return _has_bit(3);
+}
+inline void TestTableDrivenLazyMessage::clear_lazy_required() {
+  lazy_required_.Clear();
+  _clear_bit(3);
+}
+inline const ::protobuf_unittest::TestRequired& TestTableDrivenLazyMessage::lazy_required() const {
+  return static_cast<const ::protobuf_unittest::TestRequired&>(
+      lazy_required_.Get(::protobuf_unittest::TestRequired::default_instance()));
+}
+inline ::protobuf_unittest::TestRequired* TestTableDrivenLazyMessage::mutable_lazy_required() {
+  _set_bit(3);
+  return static_cast< ::protobuf_unittest::TestRequired*>(
+      lazy_required_.Mutable(::protobuf_unittest::TestRequired::default_instance()));
+}
+
+// -------------------------------------------------------------------
+
+// TestTableDrivenSparse
+
+// optional int32 optional_int32 = 1;
+inline bool TestTableDrivenSparse::has_optional_int32() const {
+  return _has_bit(0);
+}
+inline void TestTableDrivenSparse::clear_optional_int32() {
+  optional_int32_ = 0;
+  _clear_bit(0);
+}
+inline ::google::protobuf::int32 TestTableDrivenSparse::optional_int32() const {
+  return optional_int32_;
+}
+inline void TestTableDrivenSparse::set_optional_int32(::google::protobuf::int32 value) {
+  _set_bit(0);
+  optional_int32_ = value;
+}
+
+// optional string optional_string = 14;
+inline bool TestTableDrivenSparse::has_optional_string() const {
+  return _has_bit(1);
+}
+inline void TestTableDrivenSparse::clear_optional_string() {
+  if (optional_string_ != &_default_optional_string_) {
+    optional_string_->clear();
+  }
+  _clear_bit(1);
+}
+inline const ::std::string& TestTableDrivenSparse::optional_string() const {
+  return *optional_string_;
+}
+inline void TestTableDrivenSparse::set_optional_string(const ::std::string& value) {
+  _set_bit(1);
+  if (optional_string_ == &_default_optional_string_) {
+    optional_string_ = ::google::protobuf::Arena::Create< ::std::string>(_arena_);
+  }
+  optional_string_->assign(value);
+}
+inline void TestTableDrivenSparse::set_optional_string(const char* value) {
+  _set_bit(1);
+  if (optional_string_ == &_default_optional_string_) {
+    optional_string_ = ::google::protobuf::Arena::Create< ::std::string>(_arena_);
+  }
+  optional_string_->assign(value);
+}
+inline void TestTableDrivenSparse::set_optional_string(const char* value, size_t size) {
+  _set_bit(1);
+  if (optional_string_ == &_default_optional_string_) {
+    optional_string_ = ::google::protobuf::Arena::Create< ::std::string>(_arena_);
+  }
+  optional_string_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* TestTableDrivenSparse::mutable_optional_string() {
+  _set_bit(1);
+  if (optional_string_ == &_default_optional_string_) {
+    optional_string_ = ::google::protobuf::Arena::Create< ::std::string>(_arena_);
+  }
+  return optional_string_;
+}
+
+// repeated int32 repeated_int32 = 31;
+inline int TestTableDrivenSparse::repeated_int32_size() const {
+  return repeated_int32_.size();
+}
+inline void TestTableDrivenSparse::clear_repeated_int32() {
+  repeated_int32_.Clear();
+}
+inline ::google::protobuf::int32 TestTableDrivenSparse::repeated_int32(int index) const {
+  return repeated_int32_.Get(index);
+}
+inline void TestTableDrivenSparse::set_repeated_int32(int index, ::google::protobuf::int32 value) {
+  repeated_int32_.Set(index, value);
+}
+inline void TestTableDrivenSparse::add_repeated_int32(::google::protobuf::int32 value) {
+  repeated_int32_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+TestTableDrivenSparse::repeated_int32() const {
+  return repeated_int32_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+TestTableDrivenSparse::mutable_repeated_int32() {
+  return &repeated_int32_;
+}
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace protobuf_unittest
+
+#ifndef SWIG
+namespace google {
+namespace protobuf {
+
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::protobuf_unittest::TestTableDrivenAllTypes_NestedEnum>() {
+  return ::protobuf_unittest::TestTableDrivenAllTypes_NestedEnum_descriptor();
+}
+
+}  // namespace google
+}  // namespace protobuf
+#endif  // SWIG
+
+// @@protoc_insertion_point(global_scope)
+
+#endif  // PROTOBUF_google_2fprotobuf_2funittest_5ftable_5fdriven_2eproto__INCLUDED
@@ -0,0 +1,2590 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+
+#define INTERNAL_SUPPRESS_PROTOBUF_FIELD_DEPRECATION
+#include "google/protobuf/unittest_table_driven_lite.pb.h"
+#include <google/protobuf/stubs/once.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/generated_message_table_driven.h>
+// @@protoc_insertion_point(includes)
+
+namespace protobuf_unittest {
+
+namespace {
+
+const ::google::protobuf::internal::ParseTable* TestTableDrivenAllTypesLite_parse_table_ = NULL;
+const ::google::protobuf::internal::ParseTable* TestTableDrivenAllTypesLite_NestedMessage_parse_table_ = NULL;
+const ::google::protobuf::internal::ParseTable* TestTableDrivenAllTypesLite_OptionalGroup_parse_table_ = NULL;
+const ::google::protobuf::internal::ParseTable* TestTableDrivenAllTypesLite_RepeatedGroup_parse_table_ = NULL;
+const ::google::protobuf::internal::ParseTable* TestTableDrivenSparseLite_parse_table_ = NULL;
+
+}  // namespace
+
+
+void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto() {
+  delete TestTableDrivenAllTypesLite::default_instance_;
+  delete TestTableDrivenAllTypesLite_NestedMessage::default_instance_;
+  delete TestTableDrivenAllTypesLite_OptionalGroup::default_instance_;
+  delete TestTableDrivenAllTypesLite_RepeatedGroup::default_instance_;
+  delete TestTableDrivenSparseLite::default_instance_;
+}
+
+void protobuf_InitDefaults_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto_impl() {
+  ::protobuf_unittest::protobuf_InitDefaults_google_2fprotobuf_2funittest_5flite_2eproto();
+  ::protobuf_unittest_import::protobuf_InitDefaults_google_2fprotobuf_2funittest_5fimport_5flite_2eproto();
+  TestTableDrivenAllTypesLite::default_instance_ = new TestTableDrivenAllTypesLite();
+  TestTableDrivenAllTypesLite_NestedMessage::default_instance_ = new TestTableDrivenAllTypesLite_NestedMessage();
+  TestTableDrivenAllTypesLite_OptionalGroup::default_instance_ = new TestTableDrivenAllTypesLite_OptionalGroup();
+  TestTableDrivenAllTypesLite_RepeatedGroup::default_instance_ = new TestTableDrivenAllTypesLite_RepeatedGroup();
+  TestTableDrivenSparseLite::default_instance_ = new TestTableDrivenSparseLite();
+  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
+    ::protobuf_unittest::TestTableDrivenSparseLite::internal_default_instance(),
+    1000, 5, false, false);
+  ::google::protobuf::internal::ExtensionSet::RegisterExtension(
+    ::protobuf_unittest::TestTableDrivenSparseLite::internal_default_instance(),
+    1001, 9, true, false);
+  TestTableDrivenAllTypesLite::default_instance_->InitAsDefaultInstance();
+  TestTableDrivenAllTypesLite_NestedMessage::default_instance_->InitAsDefaultInstance();
+  TestTableDrivenAllTypesLite_OptionalGroup::default_instance_->InitAsDefaultInstance();
+  TestTableDrivenAllTypesLite_RepeatedGroup::default_instance_->InitAsDefaultInstance();
+  TestTableDrivenSparseLite::default_instance_->InitAsDefaultInstance();
+  static const ::google::protobuf::internal::ParseTableField
+      TestTableDrivenAllTypesLite_parse_table_fields_[] = {
+    { 8u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, optional_int32_),
+      0, ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 16u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, optional_int64_),
+      1, ::google::protobuf::internal::WireFormatLite::TYPE_INT64,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 24u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, optional_uint32_),
+      2, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 32u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, optional_uint64_),
+      3, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 40u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, optional_sint32_),
+      4, ::google::protobuf::internal::WireFormatLite::TYPE_SINT32,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 48u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, optional_sint64_),
+      5, ::google::protobuf::internal::WireFormatLite::TYPE_SINT64,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 61u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, optional_fixed32_),
+      6, ::google::protobuf::internal::WireFormatLite::TYPE_FIXED32,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 65u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, optional_fixed64_),
+      7, ::google::protobuf::internal::WireFormatLite::TYPE_FIXED64,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 77u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, optional_sfixed32_),
+      8, ::google::protobuf::internal::WireFormatLite::TYPE_SFIXED32,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 81u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, optional_sfixed64_),
+      9, ::google::protobuf::internal::WireFormatLite::TYPE_SFIXED64,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 93u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, optional_float_),
+      10, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 97u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, optional_double_),
+      11, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 104u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, optional_bool_),
+      12, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 114u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, optional_string_),
+      13, ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+      false, false, false, false, false,
+      &TestTableDrivenAllTypesLite::_default_optional_string_, NULL, NULL,
+      NULL, NULL },
+    { 122u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, optional_bytes_),
+      14, ::google::protobuf::internal::WireFormatLite::TYPE_BYTES,
+      false, false, false, false, false,
+      &TestTableDrivenAllTypesLite::_default_optional_bytes_, NULL, NULL,
+      NULL, NULL },
+    { 131u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, optionalgroup_),
+      15, ::google::protobuf::internal::WireFormatLite::TYPE_GROUP,
+      false, false, false, false, false,
+      NULL, ::protobuf_unittest::TestTableDrivenAllTypesLite_OptionalGroup::internal_default_instance(), NULL,
+      NULL, NULL },
+    { 146u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, optional_nested_message_),
+      16, ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE,
+      false, false, false, false, false,
+      NULL, ::protobuf_unittest::TestTableDrivenAllTypesLite_NestedMessage::internal_default_instance(), NULL,
+      NULL, NULL },
+    { 154u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, optional_foreign_message_),
+      17, ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE,
+      false, false, false, false, false,
+      NULL, ::protobuf_unittest::ForeignMessageLite::internal_default_instance(), NULL,
+      NULL, NULL },
+    { 162u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, optional_import_message_),
+      18, ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE,
+      false, false, false, false, false,
+      NULL, ::protobuf_unittest_import::ImportMessageLite::internal_default_instance(), NULL,
+      NULL, NULL },
+    { 168u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, optional_nested_enum_),
+      19, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM,
+      false, false, false, false, false,
+      NULL, NULL, &::protobuf_unittest::TestTableDrivenAllTypesLite_NestedEnum_IsValid,
+      NULL, NULL },
+    { 176u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, optional_foreign_enum_),
+      20, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM,
+      false, false, false, false, false,
+      NULL, NULL, &protobuf_unittest::ForeignEnumLite_IsValid,
+      NULL, NULL },
+    { 184u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, optional_import_enum_),
+      21, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM,
+      false, false, false, false, false,
+      NULL, NULL, &protobuf_unittest_import::ImportEnumLite_IsValid,
+      NULL, NULL },
+    { 194u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, optional_string_piece_),
+      22, ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+      false, false, false, true, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 202u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, optional_cord_),
+      23, ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+      false, false, false, false, false,
+      &TestTableDrivenAllTypesLite::_default_optional_cord_, NULL, NULL,
+      NULL, NULL },
+    { 248u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, repeated_int32_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      true, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 256u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, repeated_int64_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_INT64,
+      true, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 264u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, repeated_uint32_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32,
+      true, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 272u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, repeated_uint64_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64,
+      true, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 280u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, repeated_sint32_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_SINT32,
+      true, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 288u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, repeated_sint64_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_SINT64,
+      true, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 301u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, repeated_fixed32_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_FIXED32,
+      true, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 305u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, repeated_fixed64_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_FIXED64,
+      true, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 317u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, repeated_sfixed32_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_SFIXED32,
+      true, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 321u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, repeated_sfixed64_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_SFIXED64,
+      true, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 333u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, repeated_float_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT,
+      true, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 337u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, repeated_double_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE,
+      true, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 344u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, repeated_bool_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL,
+      true, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 354u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, repeated_string_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+      true, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 362u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, repeated_bytes_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_BYTES,
+      true, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 371u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, repeatedgroup_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_GROUP,
+      true, false, false, false, false,
+      NULL, ::protobuf_unittest::TestTableDrivenAllTypesLite_RepeatedGroup::internal_default_instance(), NULL,
+      NULL, NULL },
+    { 386u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, repeated_nested_message_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE,
+      true, false, false, false, false,
+      NULL, ::protobuf_unittest::TestTableDrivenAllTypesLite_NestedMessage::internal_default_instance(), NULL,
+      NULL, NULL },
+    { 394u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, repeated_foreign_message_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE,
+      true, false, false, false, false,
+      NULL, ::protobuf_unittest::ForeignMessageLite::internal_default_instance(), NULL,
+      NULL, NULL },
+    { 402u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, repeated_import_message_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE,
+      true, false, false, false, false,
+      NULL, ::protobuf_unittest_import::ImportMessageLite::internal_default_instance(), NULL,
+      NULL, NULL },
+    { 408u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, repeated_nested_enum_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM,
+      true, false, false, false, false,
+      NULL, NULL, &::protobuf_unittest::TestTableDrivenAllTypesLite_NestedEnum_IsValid,
+      NULL, NULL },
+    { 416u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, repeated_foreign_enum_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM,
+      true, false, false, false, false,
+      NULL, NULL, &protobuf_unittest::ForeignEnumLite_IsValid,
+      NULL, NULL },
+    { 424u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, repeated_import_enum_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM,
+      true, false, false, false, false,
+      NULL, NULL, &protobuf_unittest_import::ImportEnumLite_IsValid,
+      NULL, NULL },
+    { 434u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, repeated_string_piece_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+      true, false, false, true, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 442u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, repeated_cord_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+      true, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 488u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, default_int32_),
+      48, ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 496u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, default_int64_),
+      49, ::google::protobuf::internal::WireFormatLite::TYPE_INT64,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 504u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, default_uint32_),
+      50, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 512u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, default_uint64_),
+      51, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 520u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, default_sint32_),
+      52, ::google::protobuf::internal::WireFormatLite::TYPE_SINT32,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 528u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, default_sint64_),
+      53, ::google::protobuf::internal::WireFormatLite::TYPE_SINT64,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 541u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, default_fixed32_),
+      54, ::google::protobuf::internal::WireFormatLite::TYPE_FIXED32,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 545u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, default_fixed64_),
+      55, ::google::protobuf::internal::WireFormatLite::TYPE_FIXED64,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 557u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, default_sfixed32_),
+      56, ::google::protobuf::internal::WireFormatLite::TYPE_SFIXED32,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 561u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, default_sfixed64_),
+      57, ::google::protobuf::internal::WireFormatLite::TYPE_SFIXED64,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 573u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, default_float_),
+      58, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 577u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, default_double_),
+      59, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 584u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, default_bool_),
+      60, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 594u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, default_string_),
+      61, ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+      false, false, false, false, false,
+      &TestTableDrivenAllTypesLite::_default_default_string_, NULL, NULL,
+      NULL, NULL },
+    { 602u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, default_bytes_),
+      62, ::google::protobuf::internal::WireFormatLite::TYPE_BYTES,
+      false, false, false, false, false,
+      &TestTableDrivenAllTypesLite::_default_default_bytes_, NULL, NULL,
+      NULL, NULL },
+    { 648u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, default_nested_enum_),
+      63, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM,
+      false, false, false, false, false,
+      NULL, NULL, &::protobuf_unittest::TestTableDrivenAllTypesLite_NestedEnum_IsValid,
+      NULL, NULL },
+    { 656u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, default_foreign_enum_),
+      64, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM,
+      false, false, false, false, false,
+      NULL, NULL, &protobuf_unittest::ForeignEnumLite_IsValid,
+      NULL, NULL },
+    { 664u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, default_import_enum_),
+      65, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM,
+      false, false, false, false, false,
+      NULL, NULL, &protobuf_unittest_import::ImportEnumLite_IsValid,
+      NULL, NULL },
+    { 674u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, default_string_piece_),
+      66, ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+      false, false, false, true, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 682u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, default_cord_),
+      67, ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
+      false, false, false, false, false,
+      &TestTableDrivenAllTypesLite::_default_default_cord_, NULL, NULL,
+      NULL, NULL },
+  };
+  static const ::google::protobuf::internal::ParseTable TestTableDrivenAllTypesLite_parse_table = {
+    TestTableDrivenAllTypesLite_parse_table_fields_, 68,
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite, _has_bits_[0]),
+    -1,
+    -1,
+    NULL, 0,
+    TestTableDrivenAllTypesLite::default_instance_,
+  };
+  TestTableDrivenAllTypesLite_parse_table_ = &TestTableDrivenAllTypesLite_parse_table;
+  static const ::google::protobuf::internal::ParseTableField
+      TestTableDrivenAllTypesLite_NestedMessage_parse_table_fields_[] = {
+    { 8u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite_NestedMessage, bb_),
+      0, ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+  };
+  static const ::google::protobuf::internal::ParseTable TestTableDrivenAllTypesLite_NestedMessage_parse_table = {
+    TestTableDrivenAllTypesLite_NestedMessage_parse_table_fields_, 1,
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite_NestedMessage, _has_bits_[0]),
+    -1,
+    -1,
+    NULL, 0,
+    TestTableDrivenAllTypesLite_NestedMessage::default_instance_,
+  };
+  TestTableDrivenAllTypesLite_NestedMessage_parse_table_ = &TestTableDrivenAllTypesLite_NestedMessage_parse_table;
+  static const ::google::protobuf::internal::ParseTableField
+      TestTableDrivenAllTypesLite_OptionalGroup_parse_table_fields_[] = {
+    { 136u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite_OptionalGroup, a_),
+      0, ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+  };
+  static const ::google::protobuf::internal::ParseTable TestTableDrivenAllTypesLite_OptionalGroup_parse_table = {
+    TestTableDrivenAllTypesLite_OptionalGroup_parse_table_fields_, 1,
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite_OptionalGroup, _has_bits_[0]),
+    -1,
+    -1,
+    NULL, 0,
+    TestTableDrivenAllTypesLite_OptionalGroup::default_instance_,
+  };
+  TestTableDrivenAllTypesLite_OptionalGroup_parse_table_ = &TestTableDrivenAllTypesLite_OptionalGroup_parse_table;
+  static const ::google::protobuf::internal::ParseTableField
+      TestTableDrivenAllTypesLite_RepeatedGroup_parse_table_fields_[] = {
+    { 376u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite_RepeatedGroup, a_),
+      0, ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+  };
+  static const ::google::protobuf::internal::ParseTable TestTableDrivenAllTypesLite_RepeatedGroup_parse_table = {
+    TestTableDrivenAllTypesLite_RepeatedGroup_parse_table_fields_, 1,
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenAllTypesLite_RepeatedGroup, _has_bits_[0]),
+    -1,
+    -1,
+    NULL, 0,
+    TestTableDrivenAllTypesLite_RepeatedGroup::default_instance_,
+  };
+  TestTableDrivenAllTypesLite_RepeatedGroup_parse_table_ = &TestTableDrivenAllTypesLite_RepeatedGroup_parse_table;
+  static const ::google::protobuf::internal::ParseTableField
+      TestTableDrivenSparseLite_parse_table_fields_[] = {
+    { 8u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenSparseLite, optional_int32_),
+      0, ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      false, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+    { 248u, GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenSparseLite, repeated_int32_),
+      -1, ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
+      true, false, false, false, false,
+      NULL, NULL, NULL,
+      NULL, NULL },
+  };
+  static const int TestTableDrivenSparseLite_parse_table_extension_ranges_[] = {
+    1000, 536870912,
+  };
+  static const ::google::protobuf::internal::ParseTable TestTableDrivenSparseLite_parse_table = {
+    TestTableDrivenSparseLite_parse_table_fields_, 2,
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenSparseLite, _has_bits_[0]),
+    -1,
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestTableDrivenSparseLite, _extensions_),
+    TestTableDrivenSparseLite_parse_table_extension_ranges_, 1,
+    TestTableDrivenSparseLite::default_instance_,
+  };
+  TestTableDrivenSparseLite_parse_table_ = &TestTableDrivenSparseLite_parse_table;
+  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto);
+}
+
+namespace {
+
+GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_InitDefaults_once_);
+// Set once the defaults are built, so that default_instance() and the
+// other callers on hot paths can skip the once.
+::google::protobuf::internal::Atomic32 protobuf_InitDefaults_done_ = 0;
+
+}  // namespace
+
+void protobuf_InitDefaults_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto() {
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) != 0) {
+    return;
+  }
+  ::google::protobuf::GoogleOnceInit(&protobuf_InitDefaults_once_,
+                 &protobuf_InitDefaults_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto_impl);
+  ::google::protobuf::internal::Release_Store(
+      &protobuf_InitDefaults_done_, 1);
+}
+
+void protobuf_AddDesc_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto() {
+  static bool already_here = false;
+  if (already_here) return;
+  already_here = true;
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  ::protobuf_unittest::protobuf_AddDesc_google_2fprotobuf_2funittest_5flite_2eproto();
+  ::protobuf_unittest_import::protobuf_AddDesc_google_2fprotobuf_2funittest_5fimport_5flite_2eproto();
+  ::google::protobuf::internal::ExtensionSet::RegisterDeferredExtensions(
+    &protobuf_InitDefaults_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto);
+}
+
+// Force AddDescriptors() to be called at static initialization time.
+struct StaticDescriptorInitializer_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto {
+  StaticDescriptorInitializer_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto() {
+    protobuf_AddDesc_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto();
+  }
+} static_descriptor_initializer_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto_;
+
+
+// ===================================================================
+
+bool TestTableDrivenAllTypesLite_NestedEnum_IsValid(int value) {
+  switch(value) {
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#ifndef _MSC_VER
+const TestTableDrivenAllTypesLite_NestedEnum TestTableDrivenAllTypesLite::FOO;
+const TestTableDrivenAllTypesLite_NestedEnum TestTableDrivenAllTypesLite::BAR;
+const TestTableDrivenAllTypesLite_NestedEnum TestTableDrivenAllTypesLite::BAZ;
+const TestTableDrivenAllTypesLite_NestedEnum TestTableDrivenAllTypesLite::NestedEnum_MIN;
+const TestTableDrivenAllTypesLite_NestedEnum TestTableDrivenAllTypesLite::NestedEnum_MAX;
+const int TestTableDrivenAllTypesLite::NestedEnum_ARRAYSIZE;
+#endif  // _MSC_VER
+#ifndef _MSC_VER
+const int TestTableDrivenAllTypesLite_NestedMessage::kBbFieldNumber;
+#endif  // !_MSC_VER
+
+TestTableDrivenAllTypesLite_NestedMessage::TestTableDrivenAllTypesLite_NestedMessage()
+  : ::google::protobuf::MessageLite() {
+  SharedCtor();
+}
+
+void TestTableDrivenAllTypesLite_NestedMessage::InitAsDefaultInstance() {
+}
+
+TestTableDrivenAllTypesLite_NestedMessage::TestTableDrivenAllTypesLite_NestedMessage(const TestTableDrivenAllTypesLite_NestedMessage& from)
+  : ::google::protobuf::MessageLite() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void TestTableDrivenAllTypesLite_NestedMessage::SharedCtor() {
+  _cached_size_ = 0;
+  bb_ = 0;
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+TestTableDrivenAllTypesLite_NestedMessage::~TestTableDrivenAllTypesLite_NestedMessage() {
+  SharedDtor();
+}
+
+void TestTableDrivenAllTypesLite_NestedMessage::SharedDtor() {
+  if (this != default_instance_) {
+  }
+}
+
+void TestTableDrivenAllTypesLite_NestedMessage::SetCachedSize(int size) const {
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
+}
+const TestTableDrivenAllTypesLite_NestedMessage& TestTableDrivenAllTypesLite_NestedMessage::default_instance() {
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto();
+  }
+  return *default_instance_;
+}
+
+TestTableDrivenAllTypesLite_NestedMessage* TestTableDrivenAllTypesLite_NestedMessage::default_instance_ = NULL;
+
+TestTableDrivenAllTypesLite_NestedMessage* TestTableDrivenAllTypesLite_NestedMessage::New() const {
+  return new TestTableDrivenAllTypesLite_NestedMessage;
+}
+
+void TestTableDrivenAllTypesLite_NestedMessage::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    bb_ = 0;
+  }
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+bool TestTableDrivenAllTypesLite_NestedMessage::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto();
+  }
+  return ::google::protobuf::internal::MergePartialFromCodedStreamLite(
+      this, *TestTableDrivenAllTypesLite_NestedMessage_parse_table_, input);
+}
+
+void TestTableDrivenAllTypesLite_NestedMessage::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // optional int32 bb = 1;
+  if (_has_bit(0)) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->bb(), output);
+  }
+  
+}
+
+int TestTableDrivenAllTypesLite_NestedMessage::ByteSize() const {
+  int total_size = 0;
+  
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // optional int32 bb = 1;
+    if (has_bb()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->bb());
+    }
+    
+  }
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
+  return total_size;
+}
+
+void TestTableDrivenAllTypesLite_NestedMessage::CheckTypeAndMergeFrom(
+    const ::google::protobuf::MessageLite& from) {
+  MergeFrom(*::google::protobuf::down_cast<const TestTableDrivenAllTypesLite_NestedMessage*>(&from));
+}
+
+void TestTableDrivenAllTypesLite_NestedMessage::MergeFrom(const TestTableDrivenAllTypesLite_NestedMessage& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from._has_bit(0)) {
+      set_bb(from.bb());
+    }
+  }
+}
+
+void TestTableDrivenAllTypesLite_NestedMessage::CopyFrom(const TestTableDrivenAllTypesLite_NestedMessage& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestTableDrivenAllTypesLite_NestedMessage::IsInitialized() const {
+  
+  return true;
+}
+
+void TestTableDrivenAllTypesLite_NestedMessage::Swap(TestTableDrivenAllTypesLite_NestedMessage* other) {
+  if (other != this) {
+    std::swap(bb_, other->bb_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::std::string TestTableDrivenAllTypesLite_NestedMessage::GetTypeName() const {
+  return "protobuf_unittest.TestTableDrivenAllTypesLite.NestedMessage";
+}
+
+
+// -------------------------------------------------------------------
+
+#ifndef _MSC_VER
+const int TestTableDrivenAllTypesLite_OptionalGroup::kAFieldNumber;
+#endif  // !_MSC_VER
+
+TestTableDrivenAllTypesLite_OptionalGroup::TestTableDrivenAllTypesLite_OptionalGroup()
+  : ::google::protobuf::MessageLite() {
+  SharedCtor();
+}
+
+void TestTableDrivenAllTypesLite_OptionalGroup::InitAsDefaultInstance() {
+}
+
+TestTableDrivenAllTypesLite_OptionalGroup::TestTableDrivenAllTypesLite_OptionalGroup(const TestTableDrivenAllTypesLite_OptionalGroup& from)
+  : ::google::protobuf::MessageLite() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void TestTableDrivenAllTypesLite_OptionalGroup::SharedCtor() {
+  _cached_size_ = 0;
+  a_ = 0;
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+TestTableDrivenAllTypesLite_OptionalGroup::~TestTableDrivenAllTypesLite_OptionalGroup() {
+  SharedDtor();
+}
+
+void TestTableDrivenAllTypesLite_OptionalGroup::SharedDtor() {
+  if (this != default_instance_) {
+  }
+}
+
+void TestTableDrivenAllTypesLite_OptionalGroup::SetCachedSize(int size) const {
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
+}
+const TestTableDrivenAllTypesLite_OptionalGroup& TestTableDrivenAllTypesLite_OptionalGroup::default_instance() {
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto();
+  }
+  return *default_instance_;
+}
+
+TestTableDrivenAllTypesLite_OptionalGroup* TestTableDrivenAllTypesLite_OptionalGroup::default_instance_ = NULL;
+
+TestTableDrivenAllTypesLite_OptionalGroup* TestTableDrivenAllTypesLite_OptionalGroup::New() const {
+  return new TestTableDrivenAllTypesLite_OptionalGroup;
+}
+
+void TestTableDrivenAllTypesLite_OptionalGroup::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    a_ = 0;
+  }
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+bool TestTableDrivenAllTypesLite_OptionalGroup::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto();
+  }
+  return ::google::protobuf::internal::MergePartialFromCodedStreamLite(
+      this, *TestTableDrivenAllTypesLite_OptionalGroup_parse_table_, input);
+}
+
+void TestTableDrivenAllTypesLite_OptionalGroup::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // optional int32 a = 17;
+  if (_has_bit(0)) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(17, this->a(), output);
+  }
+  
+}
+
+int TestTableDrivenAllTypesLite_OptionalGroup::ByteSize() const {
+  int total_size = 0;
+  
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // optional int32 a = 17;
+    if (has_a()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->a());
+    }
+    
+  }
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
+  return total_size;
+}
+
+void TestTableDrivenAllTypesLite_OptionalGroup::CheckTypeAndMergeFrom(
+    const ::google::protobuf::MessageLite& from) {
+  MergeFrom(*::google::protobuf::down_cast<const TestTableDrivenAllTypesLite_OptionalGroup*>(&from));
+}
+
+void TestTableDrivenAllTypesLite_OptionalGroup::MergeFrom(const TestTableDrivenAllTypesLite_OptionalGroup& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from._has_bit(0)) {
+      set_a(from.a());
+    }
+  }
+}
+
+void TestTableDrivenAllTypesLite_OptionalGroup::CopyFrom(const TestTableDrivenAllTypesLite_OptionalGroup& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestTableDrivenAllTypesLite_OptionalGroup::IsInitialized() const {
+  
+  return true;
+}
+
+void TestTableDrivenAllTypesLite_OptionalGroup::Swap(TestTableDrivenAllTypesLite_OptionalGroup* other) {
+  if (other != this) {
+    std::swap(a_, other->a_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::std::string TestTableDrivenAllTypesLite_OptionalGroup::GetTypeName() const {
+  return "protobuf_unittest.TestTableDrivenAllTypesLite.OptionalGroup";
+}
+
+
+// -------------------------------------------------------------------
+
+#ifndef _MSC_VER
+const int TestTableDrivenAllTypesLite_RepeatedGroup::kAFieldNumber;
+#endif  // !_MSC_VER
+
+TestTableDrivenAllTypesLite_RepeatedGroup::TestTableDrivenAllTypesLite_RepeatedGroup()
+  : ::google::protobuf::MessageLite() {
+  SharedCtor();
+}
+
+void TestTableDrivenAllTypesLite_RepeatedGroup::InitAsDefaultInstance() {
+}
+
+TestTableDrivenAllTypesLite_RepeatedGroup::TestTableDrivenAllTypesLite_RepeatedGroup(const TestTableDrivenAllTypesLite_RepeatedGroup& from)
+  : ::google::protobuf::MessageLite() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void TestTableDrivenAllTypesLite_RepeatedGroup::SharedCtor() {
+  _cached_size_ = 0;
+  a_ = 0;
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+TestTableDrivenAllTypesLite_RepeatedGroup::~TestTableDrivenAllTypesLite_RepeatedGroup() {
+  SharedDtor();
+}
+
+void TestTableDrivenAllTypesLite_RepeatedGroup::SharedDtor() {
+  if (this != default_instance_) {
+  }
+}
+
+void TestTableDrivenAllTypesLite_RepeatedGroup::SetCachedSize(int size) const {
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
+}
+const TestTableDrivenAllTypesLite_RepeatedGroup& TestTableDrivenAllTypesLite_RepeatedGroup::default_instance() {
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto();
+  }
+  return *default_instance_;
+}
+
+TestTableDrivenAllTypesLite_RepeatedGroup* TestTableDrivenAllTypesLite_RepeatedGroup::default_instance_ = NULL;
+
+TestTableDrivenAllTypesLite_RepeatedGroup* TestTableDrivenAllTypesLite_RepeatedGroup::New() const {
+  return new TestTableDrivenAllTypesLite_RepeatedGroup;
+}
+
+void TestTableDrivenAllTypesLite_RepeatedGroup::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    a_ = 0;
+  }
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+bool TestTableDrivenAllTypesLite_RepeatedGroup::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto();
+  }
+  return ::google::protobuf::internal::MergePartialFromCodedStreamLite(
+      this, *TestTableDrivenAllTypesLite_RepeatedGroup_parse_table_, input);
+}
+
+void TestTableDrivenAllTypesLite_RepeatedGroup::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // optional int32 a = 47;
+  if (_has_bit(0)) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(47, this->a(), output);
+  }
+  
+}
+
+int TestTableDrivenAllTypesLite_RepeatedGroup::ByteSize() const {
+  int total_size = 0;
+  
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // optional int32 a = 47;
+    if (has_a()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->a());
+    }
+    
+  }
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
+  return total_size;
+}
+
+void TestTableDrivenAllTypesLite_RepeatedGroup::CheckTypeAndMergeFrom(
+    const ::google::protobuf::MessageLite& from) {
+  MergeFrom(*::google::protobuf::down_cast<const TestTableDrivenAllTypesLite_RepeatedGroup*>(&from));
+}
+
+void TestTableDrivenAllTypesLite_RepeatedGroup::MergeFrom(const TestTableDrivenAllTypesLite_RepeatedGroup& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from._has_bit(0)) {
+      set_a(from.a());
+    }
+  }
+}
+
+void TestTableDrivenAllTypesLite_RepeatedGroup::CopyFrom(const TestTableDrivenAllTypesLite_RepeatedGroup& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestTableDrivenAllTypesLite_RepeatedGroup::IsInitialized() const {
+  
+  return true;
+}
+
+void TestTableDrivenAllTypesLite_RepeatedGroup::Swap(TestTableDrivenAllTypesLite_RepeatedGroup* other) {
+  if (other != this) {
+    std::swap(a_, other->a_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::std::string TestTableDrivenAllTypesLite_RepeatedGroup::GetTypeName() const {
+  return "protobuf_unittest.TestTableDrivenAllTypesLite.RepeatedGroup";
+}
+
+
+// -------------------------------------------------------------------
+
+const ::std::string TestTableDrivenAllTypesLite::_default_optional_string_;
+const ::std::string TestTableDrivenAllTypesLite::_default_optional_bytes_;
+const ::std::string TestTableDrivenAllTypesLite::_default_optional_cord_;
+const ::std::string TestTableDrivenAllTypesLite::_default_default_string_("hello");
+const ::std::string TestTableDrivenAllTypesLite::_default_default_bytes_("world");
+const ::std::string TestTableDrivenAllTypesLite::_default_default_cord_("123");
+#ifndef _MSC_VER
+const int TestTableDrivenAllTypesLite::kOptionalInt32FieldNumber;
+const int TestTableDrivenAllTypesLite::kOptionalInt64FieldNumber;
+const int TestTableDrivenAllTypesLite::kOptionalUint32FieldNumber;
+const int TestTableDrivenAllTypesLite::kOptionalUint64FieldNumber;
+const int TestTableDrivenAllTypesLite::kOptionalSint32FieldNumber;
+const int TestTableDrivenAllTypesLite::kOptionalSint64FieldNumber;
+const int TestTableDrivenAllTypesLite::kOptionalFixed32FieldNumber;
+const int TestTableDrivenAllTypesLite::kOptionalFixed64FieldNumber;
+const int TestTableDrivenAllTypesLite::kOptionalSfixed32FieldNumber;
+const int TestTableDrivenAllTypesLite::kOptionalSfixed64FieldNumber;
+const int TestTableDrivenAllTypesLite::kOptionalFloatFieldNumber;
+const int TestTableDrivenAllTypesLite::kOptionalDoubleFieldNumber;
+const int TestTableDrivenAllTypesLite::kOptionalBoolFieldNumber;
+const int TestTableDrivenAllTypesLite::kOptionalStringFieldNumber;
+const int TestTableDrivenAllTypesLite::kOptionalBytesFieldNumber;
+const int TestTableDrivenAllTypesLite::kOptionalgroupFieldNumber;
+const int TestTableDrivenAllTypesLite::kOptionalNestedMessageFieldNumber;
+const int TestTableDrivenAllTypesLite::kOptionalForeignMessageFieldNumber;
+const int TestTableDrivenAllTypesLite::kOptionalImportMessageFieldNumber;
+const int TestTableDrivenAllTypesLite::kOptionalNestedEnumFieldNumber;
+const int TestTableDrivenAllTypesLite::kOptionalForeignEnumFieldNumber;
+const int TestTableDrivenAllTypesLite::kOptionalImportEnumFieldNumber;
+const int TestTableDrivenAllTypesLite::kOptionalStringPieceFieldNumber;
+const int TestTableDrivenAllTypesLite::kOptionalCordFieldNumber;
+const int TestTableDrivenAllTypesLite::kRepeatedInt32FieldNumber;
+const int TestTableDrivenAllTypesLite::kRepeatedInt64FieldNumber;
+const int TestTableDrivenAllTypesLite::kRepeatedUint32FieldNumber;
+const int TestTableDrivenAllTypesLite::kRepeatedUint64FieldNumber;
+const int TestTableDrivenAllTypesLite::kRepeatedSint32FieldNumber;
+const int TestTableDrivenAllTypesLite::kRepeatedSint64FieldNumber;
+const int TestTableDrivenAllTypesLite::kRepeatedFixed32FieldNumber;
+const int TestTableDrivenAllTypesLite::kRepeatedFixed64FieldNumber;
+const int TestTableDrivenAllTypesLite::kRepeatedSfixed32FieldNumber;
+const int TestTableDrivenAllTypesLite::kRepeatedSfixed64FieldNumber;
+const int TestTableDrivenAllTypesLite::kRepeatedFloatFieldNumber;
+const int TestTableDrivenAllTypesLite::kRepeatedDoubleFieldNumber;
+const int TestTableDrivenAllTypesLite::kRepeatedBoolFieldNumber;
+const int TestTableDrivenAllTypesLite::kRepeatedStringFieldNumber;
+const int TestTableDrivenAllTypesLite::kRepeatedBytesFieldNumber;
+const int TestTableDrivenAllTypesLite::kRepeatedgroupFieldNumber;
+const int TestTableDrivenAllTypesLite::kRepeatedNestedMessageFieldNumber;
+const int TestTableDrivenAllTypesLite::kRepeatedForeignMessageFieldNumber;
+const int TestTableDrivenAllTypesLite::kRepeatedImportMessageFieldNumber;
+const int TestTableDrivenAllTypesLite::kRepeatedNestedEnumFieldNumber;
+const int TestTableDrivenAllTypesLite::kRepeatedForeignEnumFieldNumber;
+const int TestTableDrivenAllTypesLite::kRepeatedImportEnumFieldNumber;
+const int TestTableDrivenAllTypesLite::kRepeatedStringPieceFieldNumber;
+const int TestTableDrivenAllTypesLite::kRepeatedCordFieldNumber;
+const int TestTableDrivenAllTypesLite::kDefaultInt32FieldNumber;
+const int TestTableDrivenAllTypesLite::kDefaultInt64FieldNumber;
+const int TestTableDrivenAllTypesLite::kDefaultUint32FieldNumber;
+const int TestTableDrivenAllTypesLite::kDefaultUint64FieldNumber;
+const int TestTableDrivenAllTypesLite::kDefaultSint32FieldNumber;
+const int TestTableDrivenAllTypesLite::kDefaultSint64FieldNumber;
+const int TestTableDrivenAllTypesLite::kDefaultFixed32FieldNumber;
+const int TestTableDrivenAllTypesLite::kDefaultFixed64FieldNumber;
+const int TestTableDrivenAllTypesLite::kDefaultSfixed32FieldNumber;
+const int TestTableDrivenAllTypesLite::kDefaultSfixed64FieldNumber;
+const int TestTableDrivenAllTypesLite::kDefaultFloatFieldNumber;
+const int TestTableDrivenAllTypesLite::kDefaultDoubleFieldNumber;
+const int TestTableDrivenAllTypesLite::kDefaultBoolFieldNumber;
+const int TestTableDrivenAllTypesLite::kDefaultStringFieldNumber;
+const int TestTableDrivenAllTypesLite::kDefaultBytesFieldNumber;
+const int TestTableDrivenAllTypesLite::kDefaultNestedEnumFieldNumber;
+const int TestTableDrivenAllTypesLite::kDefaultForeignEnumFieldNumber;
+const int TestTableDrivenAllTypesLite::kDefaultImportEnumFieldNumber;
+const int TestTableDrivenAllTypesLite::kDefaultStringPieceFieldNumber;
+const int TestTableDrivenAllTypesLite::kDefaultCordFieldNumber;
+#endif  // !_MSC_VER
+
+TestTableDrivenAllTypesLite::TestTableDrivenAllTypesLite()
+  : ::google::protobuf::MessageLite() {
+  SharedCtor();
+}
+
+void TestTableDrivenAllTypesLite::InitAsDefaultInstance() {
+  optionalgroup_ = const_cast< ::protobuf_unittest::TestTableDrivenAllTypesLite_OptionalGroup*>(
+      ::protobuf_unittest::TestTableDrivenAllTypesLite_OptionalGroup::internal_default_instance());
+  optional_nested_message_ = const_cast< ::protobuf_unittest::TestTableDrivenAllTypesLite_NestedMessage*>(
+      ::protobuf_unittest::TestTableDrivenAllTypesLite_NestedMessage::internal_default_instance());
+  optional_foreign_message_ = const_cast< ::protobuf_unittest::ForeignMessageLite*>(
+      ::protobuf_unittest::ForeignMessageLite::internal_default_instance());
+  optional_import_message_ = const_cast< ::protobuf_unittest_import::ImportMessageLite*>(
+      ::protobuf_unittest_import::ImportMessageLite::internal_default_instance());
+}
+
+TestTableDrivenAllTypesLite::TestTableDrivenAllTypesLite(const TestTableDrivenAllTypesLite& from)
+  : ::google::protobuf::MessageLite() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void TestTableDrivenAllTypesLite::SharedCtor() {
+  _cached_size_ = 0;
+  optional_int32_ = 0;
+  optional_int64_ = GOOGLE_LONGLONG(0);
+  optional_uint32_ = 0u;
+  optional_uint64_ = GOOGLE_ULONGLONG(0);
+  optional_sint32_ = 0;
+  optional_sint64_ = GOOGLE_LONGLONG(0);
+  optional_fixed32_ = 0u;
+  optional_fixed64_ = GOOGLE_ULONGLONG(0);
+  optional_sfixed32_ = 0;
+  optional_sfixed64_ = GOOGLE_LONGLONG(0);
+  optional_float_ = 0;
+  optional_double_ = 0;
+  optional_bool_ = false;
+  optional_string_ = const_cast< ::std::string*>(&_default_optional_string_);
+  optional_bytes_ = const_cast< ::std::string*>(&_default_optional_bytes_);
+  optionalgroup_ = NULL;
+  optional_nested_message_ = NULL;
+  optional_foreign_message_ = NULL;
+  optional_import_message_ = NULL;
+  optional_nested_enum_ = 1;
+  optional_foreign_enum_ = 4;
+  optional_import_enum_ = 7;
+  optional_cord_ = const_cast< ::std::string*>(&_default_optional_cord_);
+  default_int32_ = 41;
+  default_int64_ = GOOGLE_LONGLONG(42);
+  default_uint32_ = 43u;
+  default_uint64_ = GOOGLE_ULONGLONG(44);
+  default_sint32_ = -45;
+  default_sint64_ = GOOGLE_LONGLONG(46);
+  default_fixed32_ = 47u;
+  default_fixed64_ = GOOGLE_ULONGLONG(48);
+  default_sfixed32_ = 49;
+  default_sfixed64_ = GOOGLE_LONGLONG(-50);
+  default_float_ = 51.5f;
+  default_double_ = 52000;
+  default_bool_ = true;
+  default_string_ = const_cast< ::std::string*>(&_default_default_string_);
+  default_bytes_ = const_cast< ::std::string*>(&_default_default_bytes_);
+  default_nested_enum_ = 2;
+  default_foreign_enum_ = 5;
+  default_import_enum_ = 8;
+  default_string_piece_.SetAliased("abc", 3);
+  default_cord_ = const_cast< ::std::string*>(&_default_default_cord_);
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+TestTableDrivenAllTypesLite::~TestTableDrivenAllTypesLite() {
+  SharedDtor();
+}
+
+void TestTableDrivenAllTypesLite::SharedDtor() {
+  if (optional_string_ != &_default_optional_string_) {
+    delete optional_string_;
+  }
+  if (optional_bytes_ != &_default_optional_bytes_) {
+    delete optional_bytes_;
+  }
+  if (optional_cord_ != &_default_optional_cord_) {
+    delete optional_cord_;
+  }
+  if (default_string_ != &_default_default_string_) {
+    delete default_string_;
+  }
+  if (default_bytes_ != &_default_default_bytes_) {
+    delete default_bytes_;
+  }
+  if (default_cord_ != &_default_default_cord_) {
+    delete default_cord_;
+  }
+  if (this != default_instance_) {
+    delete optionalgroup_;
+    delete optional_nested_message_;
+    delete optional_foreign_message_;
+    delete optional_import_message_;
+  }
+}
+
+void TestTableDrivenAllTypesLite::SetCachedSize(int size) const {
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
+}
+const TestTableDrivenAllTypesLite& TestTableDrivenAllTypesLite::default_instance() {
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto();
+  }
+  return *default_instance_;
+}
+
+TestTableDrivenAllTypesLite* TestTableDrivenAllTypesLite::default_instance_ = NULL;
+
+TestTableDrivenAllTypesLite* TestTableDrivenAllTypesLite::New() const {
+  return new TestTableDrivenAllTypesLite;
+}
+
+void TestTableDrivenAllTypesLite::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    optional_int32_ = 0;
+    optional_int64_ = GOOGLE_LONGLONG(0);
+    optional_uint32_ = 0u;
+    optional_uint64_ = GOOGLE_ULONGLONG(0);
+    optional_sint32_ = 0;
+    optional_sint64_ = GOOGLE_LONGLONG(0);
+    optional_fixed32_ = 0u;
+    optional_fixed64_ = GOOGLE_ULONGLONG(0);
+  }
+  if (_has_bits_[8 / 32] & (0xffu << (8 % 32))) {
+    optional_sfixed32_ = 0;
+    optional_sfixed64_ = GOOGLE_LONGLONG(0);
+    optional_float_ = 0;
+    optional_double_ = 0;
+    optional_bool_ = false;
+    if (_has_bit(13)) {
+      if (optional_string_ != &_default_optional_string_) {
+        optional_string_->clear();
+      }
+    }
+    if (_has_bit(14)) {
+      if (optional_bytes_ != &_default_optional_bytes_) {
+        optional_bytes_->clear();
+      }
+    }
+    if (_has_bit(15)) {
+      if (optionalgroup_ != NULL) optionalgroup_->::protobuf_unittest::TestTableDrivenAllTypesLite_OptionalGroup::Clear();
+    }
+  }
+  if (_has_bits_[16 / 32] & (0xffu << (16 % 32))) {
+    if (_has_bit(16)) {
+      if (optional_nested_message_ != NULL) optional_nested_message_->::protobuf_unittest::TestTableDrivenAllTypesLite_NestedMessage::Clear();
+    }
+    if (_has_bit(17)) {
+      if (optional_foreign_message_ != NULL) optional_foreign_message_->::protobuf_unittest::ForeignMessageLite::Clear();
+    }
+    if (_has_bit(18)) {
+      if (optional_import_message_ != NULL) optional_import_message_->::protobuf_unittest_import::ImportMessageLite::Clear();
+    }
+    optional_nested_enum_ = 1;
+    optional_foreign_enum_ = 4;
+    optional_import_enum_ = 7;
+    if (_has_bit(22)) {
+      optional_string_piece_.Clear();
+    }
+    if (_has_bit(23)) {
+      if (optional_cord_ != &_default_optional_cord_) {
+        optional_cord_->clear();
+      }
+    }
+  }
+  if (_has_bits_[48 / 32] & (0xffu << (48 % 32))) {
+    default_int32_ = 41;
+    default_int64_ = GOOGLE_LONGLONG(42);
+    default_uint32_ = 43u;
+    default_uint64_ = GOOGLE_ULONGLONG(44);
+    default_sint32_ = -45;
+    default_sint64_ = GOOGLE_LONGLONG(46);
+    default_fixed32_ = 47u;
+    default_fixed64_ = GOOGLE_ULONGLONG(48);
+  }
+  if (_has_bits_[56 / 32] & (0xffu << (56 % 32))) {
+    default_sfixed32_ = 49;
+    default_sfixed64_ = GOOGLE_LONGLONG(-50);
+    default_float_ = 51.5f;
+    default_double_ = 52000;
+    default_bool_ = true;
+    if (_has_bit(61)) {
+      if (default_string_ != &_default_default_string_) {
+        default_string_->assign(_default_default_string_);
+      }
+    }
+    if (_has_bit(62)) {
+      if (default_bytes_ != &_default_default_bytes_) {
+        default_bytes_->assign(_default_default_bytes_);
+      }
+    }
+    default_nested_enum_ = 2;
+  }
+  if (_has_bits_[64 / 32] & (0xffu << (64 % 32))) {
+    default_foreign_enum_ = 5;
+    default_import_enum_ = 8;
+    if (_has_bit(66)) {
+      default_string_piece_.SetAliased("abc", 3);
+    }
+    if (_has_bit(67)) {
+      if (default_cord_ != &_default_default_cord_) {
+        default_cord_->assign(_default_default_cord_);
+      }
+    }
+  }
+  repeated_int32_.Clear();
+  repeated_int64_.Clear();
+  repeated_uint32_.Clear();
+  repeated_uint64_.Clear();
+  repeated_sint32_.Clear();
+  repeated_sint64_.Clear();
+  repeated_fixed32_.Clear();
+  repeated_fixed64_.Clear();
+  repeated_sfixed32_.Clear();
+  repeated_sfixed64_.Clear();
+  repeated_float_.Clear();
+  repeated_double_.Clear();
+  repeated_bool_.Clear();
+  repeated_string_.Clear();
+  repeated_bytes_.Clear();
+  repeatedgroup_.Clear();
+  repeated_nested_message_.Clear();
+  repeated_foreign_message_.Clear();
+  repeated_import_message_.Clear();
+  repeated_nested_enum_.Clear();
+  repeated_foreign_enum_.Clear();
+  repeated_import_enum_.Clear();
+  repeated_string_piece_.Clear();
+  repeated_cord_.Clear();
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+bool TestTableDrivenAllTypesLite::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto();
+  }
+  return ::google::protobuf::internal::MergePartialFromCodedStreamLite(
+      this, *TestTableDrivenAllTypesLite_parse_table_, input);
+}
+
+void TestTableDrivenAllTypesLite::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // optional int32 optional_int32 = 1;
+  if (_has_bit(0)) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->optional_int32(), output);
+  }
+  
+  // optional int64 optional_int64 = 2;
+  if (_has_bit(1)) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt64(2, this->optional_int64(), output);
+  }
+  
+  // optional uint32 optional_uint32 = 3;
+  if (_has_bit(2)) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(3, this->optional_uint32(), output);
+  }
+  
+  // optional uint64 optional_uint64 = 4;
+  if (_has_bit(3)) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(4, this->optional_uint64(), output);
+  }
+  
+  // optional sint32 optional_sint32 = 5;
+  if (_has_bit(4)) {
+    ::google::protobuf::internal::WireFormatLite::WriteSInt32(5, this->optional_sint32(), output);
+  }
+  
+  // optional sint64 optional_sint64 = 6;
+  if (_has_bit(5)) {
+    ::google::protobuf::internal::WireFormatLite::WriteSInt64(6, this->optional_sint64(), output);
+  }
+  
+  // optional fixed32 optional_fixed32 = 7;
+  if (_has_bit(6)) {
+    ::google::protobuf::internal::WireFormatLite::WriteFixed32(7, this->optional_fixed32(), output);
+  }
+  
+  // optional fixed64 optional_fixed64 = 8;
+  if (_has_bit(7)) {
+    ::google::protobuf::internal::WireFormatLite::WriteFixed64(8, this->optional_fixed64(), output);
+  }
+  
+  // optional sfixed32 optional_sfixed32 = 9;
+  if (_has_bit(8)) {
+    ::google::protobuf::internal::WireFormatLite::WriteSFixed32(9, this->optional_sfixed32(), output);
+  }
+  
+  // optional sfixed64 optional_sfixed64 = 10;
+  if (_has_bit(9)) {
+    ::google::protobuf::internal::WireFormatLite::WriteSFixed64(10, this->optional_sfixed64(), output);
+  }
+  
+  // optional float optional_float = 11;
+  if (_has_bit(10)) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(11, this->optional_float(), output);
+  }
+  
+  // optional double optional_double = 12;
+  if (_has_bit(11)) {
+    ::google::protobuf::internal::WireFormatLite::WriteDouble(12, this->optional_double(), output);
+  }
+  
+  // optional bool optional_bool = 13;
+  if (_has_bit(12)) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(13, this->optional_bool(), output);
+  }
+  
+  // optional string optional_string = 14;
+  if (_has_bit(13)) {
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      14, this->optional_string(), output);
+  }
+  
+  // optional bytes optional_bytes = 15;
+  if (_has_bit(14)) {
+    ::google::protobuf::internal::WireFormatLite::WriteBytes(
+      15, this->optional_bytes(), output);
+  }
+  
+  // optional group OptionalGroup = 16 {
+  if (_has_bit(15)) {
+    ::google::protobuf::internal::WireFormatLite::WriteGroup(
+      16, this->optionalgroup(), output);
+  }
+  
+  // optional .protobuf_unittest.TestTableDrivenAllTypesLite.NestedMessage optional_nested_message = 18;
+  if (_has_bit(16)) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessage(
+      18, this->optional_nested_message(), output);
+  }
+  
+  // optional .protobuf_unittest.ForeignMessageLite optional_foreign_message = 19;
+  if (_has_bit(17)) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessage(
+      19, this->optional_foreign_message(), output);
+  }
+  
+  // optional .protobuf_unittest_import.ImportMessageLite optional_import_message = 20;
+  if (_has_bit(18)) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessage(
+      20, this->optional_import_message(), output);
+  }
+  
+  // optional .protobuf_unittest.TestTableDrivenAllTypesLite.NestedEnum optional_nested_enum = 21;
+  if (_has_bit(19)) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      21, this->optional_nested_enum(), output);
+  }
+  
+  // optional .protobuf_unittest.ForeignEnumLite optional_foreign_enum = 22;
+  if (_has_bit(20)) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      22, this->optional_foreign_enum(), output);
+  }
+  
+  // optional .protobuf_unittest_import.ImportEnumLite optional_import_enum = 23;
+  if (_has_bit(21)) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      23, this->optional_import_enum(), output);
+  }
+  
+  // optional string optional_string_piece = 24 [ctype = STRING_PIECE];
+  if (_has_bit(22)) {
+    ::google::protobuf::internal::WireFormatLite::WriteStringPiece(
+      24, this->optional_string_piece(), output);
+  }
+  
+  // optional string optional_cord = 25 [ctype = CORD];
+  if (_has_bit(23)) {
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      25, this->optional_cord(), output);
+  }
+  
+  // repeated int32 repeated_int32 = 31;
+  for (int i = 0; i < this->repeated_int32_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(
+      31, this->repeated_int32(i), output);
+  }
+  
+  // repeated int64 repeated_int64 = 32;
+  for (int i = 0; i < this->repeated_int64_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt64(
+      32, this->repeated_int64(i), output);
+  }
+  
+  // repeated uint32 repeated_uint32 = 33;
+  for (int i = 0; i < this->repeated_uint32_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(
+      33, this->repeated_uint32(i), output);
+  }
+  
+  // repeated uint64 repeated_uint64 = 34;
+  for (int i = 0; i < this->repeated_uint64_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(
+      34, this->repeated_uint64(i), output);
+  }
+  
+  // repeated sint32 repeated_sint32 = 35;
+  for (int i = 0; i < this->repeated_sint32_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteSInt32(
+      35, this->repeated_sint32(i), output);
+  }
+  
+  // repeated sint64 repeated_sint64 = 36;
+  for (int i = 0; i < this->repeated_sint64_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteSInt64(
+      36, this->repeated_sint64(i), output);
+  }
+  
+  // repeated fixed32 repeated_fixed32 = 37;
+  for (int i = 0; i < this->repeated_fixed32_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteFixed32(
+      37, this->repeated_fixed32(i), output);
+  }
+  
+  // repeated fixed64 repeated_fixed64 = 38;
+  for (int i = 0; i < this->repeated_fixed64_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteFixed64(
+      38, this->repeated_fixed64(i), output);
+  }
+  
+  // repeated sfixed32 repeated_sfixed32 = 39;
+  for (int i = 0; i < this->repeated_sfixed32_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteSFixed32(
+      39, this->repeated_sfixed32(i), output);
+  }
+  
+  // repeated sfixed64 repeated_sfixed64 = 40;
+  for (int i = 0; i < this->repeated_sfixed64_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteSFixed64(
+      40, this->repeated_sfixed64(i), output);
+  }
+  
+  // repeated float repeated_float = 41;
+  for (int i = 0; i < this->repeated_float_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(
+      41, this->repeated_float(i), output);
+  }
+  
+  // repeated double repeated_double = 42;
+  for (int i = 0; i < this->repeated_double_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteDouble(
+      42, this->repeated_double(i), output);
+  }
+  
+  // repeated bool repeated_bool = 43;
+  for (int i = 0; i < this->repeated_bool_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(
+      43, this->repeated_bool(i), output);
+  }
+  
+  // repeated string repeated_string = 44;
+  for (int i = 0; i < this->repeated_string_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      44, this->repeated_string(i), output);
+  }
+  
+  // repeated bytes repeated_bytes = 45;
+  for (int i = 0; i < this->repeated_bytes_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteBytes(
+      45, this->repeated_bytes(i), output);
+  }
+  
+  // repeated group RepeatedGroup = 46 {
+  for (int i = 0; i < this->repeatedgroup_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteGroup(
+      46, this->repeatedgroup(i), output);
+  }
+  
+  // repeated .protobuf_unittest.TestTableDrivenAllTypesLite.NestedMessage repeated_nested_message = 48;
+  for (int i = 0; i < this->repeated_nested_message_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessage(
+      48, this->repeated_nested_message(i), output);
+  }
+  
+  // repeated .protobuf_unittest.ForeignMessageLite repeated_foreign_message = 49;
+  for (int i = 0; i < this->repeated_foreign_message_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessage(
+      49, this->repeated_foreign_message(i), output);
+  }
+  
+  // repeated .protobuf_unittest_import.ImportMessageLite repeated_import_message = 50;
+  for (int i = 0; i < this->repeated_import_message_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessage(
+      50, this->repeated_import_message(i), output);
+  }
+  
+  // repeated .protobuf_unittest.TestTableDrivenAllTypesLite.NestedEnum repeated_nested_enum = 51;
+  for (int i = 0; i < this->repeated_nested_enum_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      51, this->repeated_nested_enum(i), output);
+  }
+  
+  // repeated .protobuf_unittest.ForeignEnumLite repeated_foreign_enum = 52;
+  for (int i = 0; i < this->repeated_foreign_enum_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      52, this->repeated_foreign_enum(i), output);
+  }
+  
+  // repeated .protobuf_unittest_import.ImportEnumLite repeated_import_enum = 53;
+  for (int i = 0; i < this->repeated_import_enum_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      53, this->repeated_import_enum(i), output);
+  }
+  
+  // repeated string repeated_string_piece = 54 [ctype = STRING_PIECE];
+  for (int i = 0; i < this->repeated_string_piece_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteStringPiece(
+      54, this->repeated_string_piece(i), output);
+  }
+  
+  // repeated string repeated_cord = 55 [ctype = CORD];
+  for (int i = 0; i < this->repeated_cord_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      55, this->repeated_cord(i), output);
+  }
+  
+  // optional int32 default_int32 = 61 [default = 41];
+  if (_has_bit(48)) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(61, this->default_int32(), output);
+  }
+  
+  // optional int64 default_int64 = 62 [default = 42];
+  if (_has_bit(49)) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt64(62, this->default_int64(), output);
+  }
+  
+  // optional uint32 default_uint32 = 63 [default = 43];
+  if (_has_bit(50)) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(63, this->default_uint32(), output);
+  }
+  
+  // optional uint64 default_uint64 = 64 [default = 44];
+  if (_has_bit(51)) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(64, this->default_uint64(), output);
+  }
+  
+  // optional sint32 default_sint32 = 65 [default = -45];
+  if (_has_bit(52)) {
+    ::google::protobuf::internal::WireFormatLite::WriteSInt32(65, this->default_sint32(), output);
+  }
+  
+  // optional sint64 default_sint64 = 66 [default = 46];
+  if (_has_bit(53)) {
+    ::google::protobuf::internal::WireFormatLite::WriteSInt64(66, this->default_sint64(), output);
+  }
+  
+  // optional fixed32 default_fixed32 = 67 [default = 47];
+  if (_has_bit(54)) {
+    ::google::protobuf::internal::WireFormatLite::WriteFixed32(67, this->default_fixed32(), output);
+  }
+  
+  // optional fixed64 default_fixed64 = 68 [default = 48];
+  if (_has_bit(55)) {
+    ::google::protobuf::internal::WireFormatLite::WriteFixed64(68, this->default_fixed64(), output);
+  }
+  
+  // optional sfixed32 default_sfixed32 = 69 [default = 49];
+  if (_has_bit(56)) {
+    ::google::protobuf::internal::WireFormatLite::WriteSFixed32(69, this->default_sfixed32(), output);
+  }
+  
+  // optional sfixed64 default_sfixed64 = 70 [default = -50];
+  if (_has_bit(57)) {
+    ::google::protobuf::internal::WireFormatLite::WriteSFixed64(70, this->default_sfixed64(), output);
+  }
+  
+  // optional float default_float = 71 [default = 51.5];
+  if (_has_bit(58)) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(71, this->default_float(), output);
+  }
+  
+  // optional double default_double = 72 [default = 52000];
+  if (_has_bit(59)) {
+    ::google::protobuf::internal::WireFormatLite::WriteDouble(72, this->default_double(), output);
+  }
+  
+  // optional bool default_bool = 73 [default = true];
+  if (_has_bit(60)) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(73, this->default_bool(), output);
+  }
+  
+  // optional string default_string = 74 [default = "hello"];
+  if (_has_bit(61)) {
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      74, this->default_string(), output);
+  }
+  
+  // optional bytes default_bytes = 75 [default = "world"];
+  if (_has_bit(62)) {
+    ::google::protobuf::internal::WireFormatLite::WriteBytes(
+      75, this->default_bytes(), output);
+  }
+  
+  // optional .protobuf_unittest.TestTableDrivenAllTypesLite.NestedEnum default_nested_enum = 81 [default = BAR];
+  if (_has_bit(63)) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      81, this->default_nested_enum(), output);
+  }
+  
+  // optional .protobuf_unittest.ForeignEnumLite default_foreign_enum = 82 [default = FOREIGN_LITE_BAR];
+  if (_has_bit(64)) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      82, this->default_foreign_enum(), output);
+  }
+  
+  // optional .protobuf_unittest_import.ImportEnumLite default_import_enum = 83 [default = IMPORT_LITE_BAR];
+  if (_has_bit(65)) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      83, this->default_import_enum(), output);
+  }
+  
+  // optional string default_string_piece = 84 [default = "abc", ctype = STRING_PIECE];
+  if (_has_bit(66)) {
+    ::google::protobuf::internal::WireFormatLite::WriteStringPiece(
+      84, this->default_string_piece(), output);
+  }
+  
+  // optional string default_cord = 85 [default = "123", ctype = CORD];
+  if (_has_bit(67)) {
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      85, this->default_cord(), output);
+  }
+  
+}
+
+int TestTableDrivenAllTypesLite::ByteSize() const {
+  int total_size = 0;
+  
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // optional int32 optional_int32 = 1;
+    if (has_optional_int32()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->optional_int32());
+    }
+    
+    // optional int64 optional_int64 = 2;
+    if (has_optional_int64()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int64Size(
+          this->optional_int64());
+    }
+    
+    // optional uint32 optional_uint32 = 3;
+    if (has_optional_uint32()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->optional_uint32());
+    }
+    
+    // optional uint64 optional_uint64 = 4;
+    if (has_optional_uint64()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->optional_uint64());
+    }
+    
+    // optional sint32 optional_sint32 = 5;
+    if (has_optional_sint32()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::SInt32Size(
+          this->optional_sint32());
+    }
+    
+    // optional sint64 optional_sint64 = 6;
+    if (has_optional_sint64()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::SInt64Size(
+          this->optional_sint64());
+    }
+    
+    // optional fixed32 optional_fixed32 = 7;
+    if (has_optional_fixed32()) {
+      total_size += 1 + 4;
+    }
+    
+    // optional fixed64 optional_fixed64 = 8;
+    if (has_optional_fixed64()) {
+      total_size += 1 + 8;
+    }
+    
+  }
+  if (_has_bits_[8 / 32] & (0xffu << (8 % 32))) {
+    // optional sfixed32 optional_sfixed32 = 9;
+    if (has_optional_sfixed32()) {
+      total_size += 1 + 4;
+    }
+    
+    // optional sfixed64 optional_sfixed64 = 10;
+    if (has_optional_sfixed64()) {
+      total_size += 1 + 8;
+    }
+    
+    // optional float optional_float = 11;
+    if (has_optional_float()) {
+      total_size += 1 + 4;
+    }
+    
+    // optional double optional_double = 12;
+    if (has_optional_double()) {
+      total_size += 1 + 8;
+    }
+    
+    // optional bool optional_bool = 13;
+    if (has_optional_bool()) {
+      total_size += 1 + 1;
+    }
+    
+    // optional string optional_string = 14;
+    if (has_optional_string()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->optional_string());
+    }
+    
+    // optional bytes optional_bytes = 15;
+    if (has_optional_bytes()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::BytesSize(
+          this->optional_bytes());
+    }
+    
+    // optional group OptionalGroup = 16 {
+    if (has_optionalgroup()) {
+      total_size += 4 +
+        ::google::protobuf::internal::WireFormatLite::GroupSizeNoVirtual(
+          this->optionalgroup());
+    }
+    
+  }
+  if (_has_bits_[16 / 32] & (0xffu << (16 % 32))) {
+    // optional .protobuf_unittest.TestTableDrivenAllTypesLite.NestedMessage optional_nested_message = 18;
+    if (has_optional_nested_message()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->optional_nested_message());
+    }
+    
+    // optional .protobuf_unittest.ForeignMessageLite optional_foreign_message = 19;
+    if (has_optional_foreign_message()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->optional_foreign_message());
+    }
+    
+    // optional .protobuf_unittest_import.ImportMessageLite optional_import_message = 20;
+    if (has_optional_import_message()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->optional_import_message());
+    }
+    
+    // optional .protobuf_unittest.TestTableDrivenAllTypesLite.NestedEnum optional_nested_enum = 21;
+    if (has_optional_nested_enum()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::EnumSize(this->optional_nested_enum());
+    }
+    
+    // optional .protobuf_unittest.ForeignEnumLite optional_foreign_enum = 22;
+    if (has_optional_foreign_enum()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::EnumSize(this->optional_foreign_enum());
+    }
+    
+    // optional .protobuf_unittest_import.ImportEnumLite optional_import_enum = 23;
+    if (has_optional_import_enum()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::EnumSize(this->optional_import_enum());
+    }
+    
+    // optional string optional_string_piece = 24 [ctype = STRING_PIECE];
+    if (has_optional_string_piece()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::StringPieceSize(
+          this->optional_string_piece());
+    }
+    
+    // optional string optional_cord = 25 [ctype = CORD];
+    if (has_optional_cord()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->optional_cord());
+    }
+    
+  }
+  if (_has_bits_[48 / 32] & (0xffu << (48 % 32))) {
+    // optional int32 default_int32 = 61 [default = 41];
+    if (has_default_int32()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->default_int32());
+    }
+    
+    // optional int64 default_int64 = 62 [default = 42];
+    if (has_default_int64()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::Int64Size(
+          this->default_int64());
+    }
+    
+    // optional uint32 default_uint32 = 63 [default = 43];
+    if (has_default_uint32()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->default_uint32());
+    }
+    
+    // optional uint64 default_uint64 = 64 [default = 44];
+    if (has_default_uint64()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->default_uint64());
+    }
+    
+    // optional sint32 default_sint32 = 65 [default = -45];
+    if (has_default_sint32()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::SInt32Size(
+          this->default_sint32());
+    }
+    
+    // optional sint64 default_sint64 = 66 [default = 46];
+    if (has_default_sint64()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::SInt64Size(
+          this->default_sint64());
+    }
+    
+    // optional fixed32 default_fixed32 = 67 [default = 47];
+    if (has_default_fixed32()) {
+      total_size += 2 + 4;
+    }
+    
+    // optional fixed64 default_fixed64 = 68 [default = 48];
+    if (has_default_fixed64()) {
+      total_size += 2 + 8;
+    }
+    
+  }
+  if (_has_bits_[56 / 32] & (0xffu << (56 % 32))) {
+    // optional sfixed32 default_sfixed32 = 69 [default = 49];
+    if (has_default_sfixed32()) {
+      total_size += 2 + 4;
+    }
+    
+    // optional sfixed64 default_sfixed64 = 70 [default = -50];
+    if (has_default_sfixed64()) {
+      total_size += 2 + 8;
+    }
+    
+    // optional float default_float = 71 [default = 51.5];
+    if (has_default_float()) {
+      total_size += 2 + 4;
+    }
+    
+    // optional double default_double = 72 [default = 52000];
+    if (has_default_double()) {
+      total_size += 2 + 8;
+    }
+    
+    // optional bool default_bool = 73 [default = true];
+    if (has_default_bool()) {
+      total_size += 2 + 1;
+    }
+    
+    // optional string default_string = 74 [default = "hello"];
+    if (has_default_string()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->default_string());
+    }
+    
+    // optional bytes default_bytes = 75 [default = "world"];
+    if (has_default_bytes()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::BytesSize(
+          this->default_bytes());
+    }
+    
+    // optional .protobuf_unittest.TestTableDrivenAllTypesLite.NestedEnum default_nested_enum = 81 [default = BAR];
+    if (has_default_nested_enum()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::EnumSize(this->default_nested_enum());
+    }
+    
+  }
+  if (_has_bits_[64 / 32] & (0xffu << (64 % 32))) {
+    // optional .protobuf_unittest.ForeignEnumLite default_foreign_enum = 82 [default = FOREIGN_LITE_BAR];
+    if (has_default_foreign_enum()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::EnumSize(this->default_foreign_enum());
+    }
+    
+    // optional .protobuf_unittest_import.ImportEnumLite default_import_enum = 83 [default = IMPORT_LITE_BAR];
+    if (has_default_import_enum()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::EnumSize(this->default_import_enum());
+    }
+    
+    // optional string default_string_piece = 84 [default = "abc", ctype = STRING_PIECE];
+    if (has_default_string_piece()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::StringPieceSize(
+          this->default_string_piece());
+    }
+    
+    // optional string default_cord = 85 [default = "123", ctype = CORD];
+    if (has_default_cord()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->default_cord());
+    }
+    
+  }
+  // repeated int32 repeated_int32 = 31;
+  {
+    int data_size = 0;
+    for (int i = 0; i < this->repeated_int32_size(); i++) {
+      data_size += ::google::protobuf::internal::WireFormatLite::
+        Int32Size(this->repeated_int32(i));
+    }
+    total_size += 2 * this->repeated_int32_size() + data_size;
+  }
+  
+  // repeated int64 repeated_int64 = 32;
+  {
+    int data_size = 0;
+    for (int i = 0; i < this->repeated_int64_size(); i++) {
+      data_size += ::google::protobuf::internal::WireFormatLite::
+        Int64Size(this->repeated_int64(i));
+    }
+    total_size += 2 * this->repeated_int64_size() + data_size;
+  }
+  
+  // repeated uint32 repeated_uint32 = 33;
+  {
+    int data_size = 0;
+    for (int i = 0; i < this->repeated_uint32_size(); i++) {
+      data_size += ::google::protobuf::internal::WireFormatLite::
+        UInt32Size(this->repeated_uint32(i));
+    }
+    total_size += 2 * this->repeated_uint32_size() + data_size;
+  }
+  
+  // repeated uint64 repeated_uint64 = 34;
+  {
+    int data_size = 0;
+    for (int i = 0; i < this->repeated_uint64_size(); i++) {
+      data_size += ::google::protobuf::internal::WireFormatLite::
+        UInt64Size(this->repeated_uint64(i));
+    }
+    total_size += 2 * this->repeated_uint64_size() + data_size;
+  }
+  
+  // repeated sint32 repeated_sint32 = 35;
+  {
+    int data_size = 0;
+    for (int i = 0; i < this->repeated_sint32_size(); i++) {
+      data_size += ::google::protobuf::internal::WireFormatLite::
+        SInt32Size(this->repeated_sint32(i));
+    }
+    total_size += 2 * this->repeated_sint32_size() + data_size;
+  }
+  
+  // repeated sint64 repeated_sint64 = 36;
+  {
+    int data_size = 0;
+    for (int i = 0; i < this->repeated_sint64_size(); i++) {
+      data_size += ::google::protobuf::internal::WireFormatLite::
+        SInt64Size(this->repeated_sint64(i));
+    }
+    total_size += 2 * this->repeated_sint64_size() + data_size;
+  }
+  
+  // repeated fixed32 repeated_fixed32 = 37;
+  {
+    int data_size = 0;
+    data_size = 4 * this->repeated_fixed32_size();
+    total_size += 2 * this->repeated_fixed32_size() + data_size;
+  }
+  
+  // repeated fixed64 repeated_fixed64 = 38;
+  {
+    int data_size = 0;
+    data_size = 8 * this->repeated_fixed64_size();
+    total_size += 2 * this->repeated_fixed64_size() + data_size;
+  }
+  
+  // repeated sfixed32 repeated_sfixed32 = 39;
+  {
+    int data_size = 0;
+    data_size = 4 * this->repeated_sfixed32_size();
+    total_size += 2 * this->repeated_sfixed32_size() + data_size;
+  }
+  
+  // repeated sfixed64 repeated_sfixed64 = 40;
+  {
+    int data_size = 0;
+    data_size = 8 * this->repeated_sfixed64_size();
+    total_size += 2 * this->repeated_sfixed64_size() + data_size;
+  }
+  
+  // repeated float repeated_float = 41;
+  {
+    int data_size = 0;
+    data_size = 4 * this->repeated_float_size();
+    total_size += 2 * this->repeated_float_size() + data_size;
+  }
+  
+  // repeated double repeated_double = 42;
+  {
+    int data_size = 0;
+    data_size = 8 * this->repeated_double_size();
+    total_size += 2 * this->repeated_double_size() + data_size;
+  }
+  
+  // repeated bool repeated_bool = 43;
+  {
+    int data_size = 0;
+    data_size = 1 * this->repeated_bool_size();
+    total_size += 2 * this->repeated_bool_size() + data_size;
+  }
+  
+  // repeated string repeated_string = 44;
+  total_size += 2 * this->repeated_string_size();
+  for (int i = 0; i < this->repeated_string_size(); i++) {
+    total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
+      this->repeated_string(i));
+  }
+  
+  // repeated bytes repeated_bytes = 45;
+  total_size += 2 * this->repeated_bytes_size();
+  for (int i = 0; i < this->repeated_bytes_size(); i++) {
+    total_size += ::google::protobuf::internal::WireFormatLite::BytesSize(
+      this->repeated_bytes(i));
+  }
+  
+  // repeated group RepeatedGroup = 46 {
+  total_size += 4 * this->repeatedgroup_size();
+  for (int i = 0; i < this->repeatedgroup_size(); i++) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::GroupSizeNoVirtual(
+        this->repeatedgroup(i));
+  }
+  
+  // repeated .protobuf_unittest.TestTableDrivenAllTypesLite.NestedMessage repeated_nested_message = 48;
+  total_size += 2 * this->repeated_nested_message_size();
+  for (int i = 0; i < this->repeated_nested_message_size(); i++) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        this->repeated_nested_message(i));
+  }
+  
+  // repeated .protobuf_unittest.ForeignMessageLite repeated_foreign_message = 49;
+  total_size += 2 * this->repeated_foreign_message_size();
+  for (int i = 0; i < this->repeated_foreign_message_size(); i++) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        this->repeated_foreign_message(i));
+  }
+  
+  // repeated .protobuf_unittest_import.ImportMessageLite repeated_import_message = 50;
+  total_size += 2 * this->repeated_import_message_size();
+  for (int i = 0; i < this->repeated_import_message_size(); i++) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        this->repeated_import_message(i));
+  }
+  
+  // repeated .protobuf_unittest.TestTableDrivenAllTypesLite.NestedEnum repeated_nested_enum = 51;
+  {
+    int data_size = 0;
+    for (int i = 0; i < this->repeated_nested_enum_size(); i++) {
+      data_size += ::google::protobuf::internal::WireFormatLite::EnumSize(
+        this->repeated_nested_enum(i));
+    }
+    total_size += 2 * this->repeated_nested_enum_size() + data_size;
+  }
+  
+  // repeated .protobuf_unittest.ForeignEnumLite repeated_foreign_enum = 52;
+  {
+    int data_size = 0;
+    for (int i = 0; i < this->repeated_foreign_enum_size(); i++) {
+      data_size += ::google::protobuf::internal::WireFormatLite::EnumSize(
+        this->repeated_foreign_enum(i));
+    }
+    total_size += 2 * this->repeated_foreign_enum_size() + data_size;
+  }
+  
+  // repeated .protobuf_unittest_import.ImportEnumLite repeated_import_enum = 53;
+  {
+    int data_size = 0;
+    for (int i = 0; i < this->repeated_import_enum_size(); i++) {
+      data_size += ::google::protobuf::internal::WireFormatLite::EnumSize(
+        this->repeated_import_enum(i));
+    }
+    total_size += 2 * this->repeated_import_enum_size() + data_size;
+  }
+  
+  // repeated string repeated_string_piece = 54 [ctype = STRING_PIECE];
+  total_size += 2 * this->repeated_string_piece_size();
+  for (int i = 0; i < this->repeated_string_piece_size(); i++) {
+    total_size += ::google::protobuf::internal::WireFormatLite::StringPieceSize(
+      this->repeated_string_piece(i));
+  }
+  
+  // repeated string repeated_cord = 55 [ctype = CORD];
+  total_size += 2 * this->repeated_cord_size();
+  for (int i = 0; i < this->repeated_cord_size(); i++) {
+    total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
+      this->repeated_cord(i));
+  }
+  
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
+  return total_size;
+}
+
+void TestTableDrivenAllTypesLite::CheckTypeAndMergeFrom(
+    const ::google::protobuf::MessageLite& from) {
+  MergeFrom(*::google::protobuf::down_cast<const TestTableDrivenAllTypesLite*>(&from));
+}
+
+void TestTableDrivenAllTypesLite::MergeFrom(const TestTableDrivenAllTypesLite& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  repeated_int32_.MergeFrom(from.repeated_int32_);
+  repeated_int64_.MergeFrom(from.repeated_int64_);
+  repeated_uint32_.MergeFrom(from.repeated_uint32_);
+  repeated_uint64_.MergeFrom(from.repeated_uint64_);
+  repeated_sint32_.MergeFrom(from.repeated_sint32_);
+  repeated_sint64_.MergeFrom(from.repeated_sint64_);
+  repeated_fixed32_.MergeFrom(from.repeated_fixed32_);
+  repeated_fixed64_.MergeFrom(from.repeated_fixed64_);
+  repeated_sfixed32_.MergeFrom(from.repeated_sfixed32_);
+  repeated_sfixed64_.MergeFrom(from.repeated_sfixed64_);
+  repeated_float_.MergeFrom(from.repeated_float_);
+  repeated_double_.MergeFrom(from.repeated_double_);
+  repeated_bool_.MergeFrom(from.repeated_bool_);
+  repeated_string_.MergeFrom(from.repeated_string_);
+  repeated_bytes_.MergeFrom(from.repeated_bytes_);
+  repeatedgroup_.MergeFrom(from.repeatedgroup_);
+  repeated_nested_message_.MergeFrom(from.repeated_nested_message_);
+  repeated_foreign_message_.MergeFrom(from.repeated_foreign_message_);
+  repeated_import_message_.MergeFrom(from.repeated_import_message_);
+  repeated_nested_enum_.MergeFrom(from.repeated_nested_enum_);
+  repeated_foreign_enum_.MergeFrom(from.repeated_foreign_enum_);
+  repeated_import_enum_.MergeFrom(from.repeated_import_enum_);
+  repeated_string_piece_.MergeFrom(from.repeated_string_piece_);
+  repeated_cord_.MergeFrom(from.repeated_cord_);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from._has_bit(0)) {
+      set_optional_int32(from.optional_int32());
+    }
+    if (from._has_bit(1)) {
+      set_optional_int64(from.optional_int64());
+    }
+    if (from._has_bit(2)) {
+      set_optional_uint32(from.optional_uint32());
+    }
+    if (from._has_bit(3)) {
+      set_optional_uint64(from.optional_uint64());
+    }
+    if (from._has_bit(4)) {
+      set_optional_sint32(from.optional_sint32());
+    }
+    if (from._has_bit(5)) {
+      set_optional_sint64(from.optional_sint64());
+    }
+    if (from._has_bit(6)) {
+      set_optional_fixed32(from.optional_fixed32());
+    }
+    if (from._has_bit(7)) {
+      set_optional_fixed64(from.optional_fixed64());
+    }
+  }
+  if (from._has_bits_[8 / 32] & (0xffu << (8 % 32))) {
+    if (from._has_bit(8)) {
+      set_optional_sfixed32(from.optional_sfixed32());
+    }
+    if (from._has_bit(9)) {
+      set_optional_sfixed64(from.optional_sfixed64());
+    }
+    if (from._has_bit(10)) {
+      set_optional_float(from.optional_float());
+    }
+    if (from._has_bit(11)) {
+      set_optional_double(from.optional_double());
+    }
+    if (from._has_bit(12)) {
+      set_optional_bool(from.optional_bool());
+    }
+    if (from._has_bit(13)) {
+      set_optional_string(from.optional_string());
+    }
+    if (from._has_bit(14)) {
+      set_optional_bytes(from.optional_bytes());
+    }
+    if (from._has_bit(15)) {
+      mutable_optionalgroup()->::protobuf_unittest::TestTableDrivenAllTypesLite_OptionalGroup::MergeFrom(from.optionalgroup());
+    }
+  }
+  if (from._has_bits_[16 / 32] & (0xffu << (16 % 32))) {
+    if (from._has_bit(16)) {
+      mutable_optional_nested_message()->::protobuf_unittest::TestTableDrivenAllTypesLite_NestedMessage::MergeFrom(from.optional_nested_message());
+    }
+    if (from._has_bit(17)) {
+      mutable_optional_foreign_message()->::protobuf_unittest::ForeignMessageLite::MergeFrom(from.optional_foreign_message());
+    }
+    if (from._has_bit(18)) {
+      mutable_optional_import_message()->::protobuf_unittest_import::ImportMessageLite::MergeFrom(from.optional_import_message());
+    }
+    if (from._has_bit(19)) {
+      set_optional_nested_enum(from.optional_nested_enum());
+    }
+    if (from._has_bit(20)) {
+      set_optional_foreign_enum(from.optional_foreign_enum());
+    }
+    if (from._has_bit(21)) {
+      set_optional_import_enum(from.optional_import_enum());
+    }
+    if (from._has_bit(22)) {
+      set_optional_string_piece(from.optional_string_piece().data(), from.optional_string_piece().size());
+    }
+    if (from._has_bit(23)) {
+      set_optional_cord(from.optional_cord());
+    }
+  }
+  if (from._has_bits_[48 / 32] & (0xffu << (48 % 32))) {
+    if (from._has_bit(48)) {
+      set_default_int32(from.default_int32());
+    }
+    if (from._has_bit(49)) {
+      set_default_int64(from.default_int64());
+    }
+    if (from._has_bit(50)) {
+      set_default_uint32(from.default_uint32());
+    }
+    if (from._has_bit(51)) {
+      set_default_uint64(from.default_uint64());
+    }
+    if (from._has_bit(52)) {
+      set_default_sint32(from.default_sint32());
+    }
+    if (from._has_bit(53)) {
+      set_default_sint64(from.default_sint64());
+    }
+    if (from._has_bit(54)) {
+      set_default_fixed32(from.default_fixed32());
+    }
+    if (from._has_bit(55)) {
+      set_default_fixed64(from.default_fixed64());
+    }
+  }
+  if (from._has_bits_[56 / 32] & (0xffu << (56 % 32))) {
+    if (from._has_bit(56)) {
+      set_default_sfixed32(from.default_sfixed32());
+    }
+    if (from._has_bit(57)) {
+      set_default_sfixed64(from.default_sfixed64());
+    }
+    if (from._has_bit(58)) {
+      set_default_float(from.default_float());
+    }
+    if (from._has_bit(59)) {
+      set_default_double(from.default_double());
+    }
+    if (from._has_bit(60)) {
+      set_default_bool(from.default_bool());
+    }
+    if (from._has_bit(61)) {
+      set_default_string(from.default_string());
+    }
+    if (from._has_bit(62)) {
+      set_default_bytes(from.default_bytes());
+    }
+    if (from._has_bit(63)) {
+      set_default_nested_enum(from.default_nested_enum());
+    }
+  }
+  if (from._has_bits_[64 / 32] & (0xffu << (64 % 32))) {
+    if (from._has_bit(64)) {
+      set_default_foreign_enum(from.default_foreign_enum());
+    }
+    if (from._has_bit(65)) {
+      set_default_import_enum(from.default_import_enum());
+    }
+    if (from._has_bit(66)) {
+      set_default_string_piece(from.default_string_piece().data(), from.default_string_piece().size());
+    }
+    if (from._has_bit(67)) {
+      set_default_cord(from.default_cord());
+    }
+  }
+}
+
+void TestTableDrivenAllTypesLite::CopyFrom(const TestTableDrivenAllTypesLite& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestTableDrivenAllTypesLite::IsInitialized() const {
+  
+  return true;
+}
+
+void TestTableDrivenAllTypesLite::Swap(TestTableDrivenAllTypesLite* other) {
+  if (other != this) {
+    std::swap(optional_int32_, other->optional_int32_);
+    std::swap(optional_int64_, other->optional_int64_);
+    std::swap(optional_uint32_, other->optional_uint32_);
+    std::swap(optional_uint64_, other->optional_uint64_);
+    std::swap(optional_sint32_, other->optional_sint32_);
+    std::swap(optional_sint64_, other->optional_sint64_);
+    std::swap(optional_fixed32_, other->optional_fixed32_);
+    std::swap(optional_fixed64_, other->optional_fixed64_);
+    std::swap(optional_sfixed32_, other->optional_sfixed32_);
+    std::swap(optional_sfixed64_, other->optional_sfixed64_);
+    std::swap(optional_float_, other->optional_float_);
+    std::swap(optional_double_, other->optional_double_);
+    std::swap(optional_bool_, other->optional_bool_);
+    std::swap(optional_string_, other->optional_string_);
+    std::swap(optional_bytes_, other->optional_bytes_);
+    std::swap(optionalgroup_, other->optionalgroup_);
+    std::swap(optional_nested_message_, other->optional_nested_message_);
+    std::swap(optional_foreign_message_, other->optional_foreign_message_);
+    std::swap(optional_import_message_, other->optional_import_message_);
+    std::swap(optional_nested_enum_, other->optional_nested_enum_);
+    std::swap(optional_foreign_enum_, other->optional_foreign_enum_);
+    std::swap(optional_import_enum_, other->optional_import_enum_);
+    optional_string_piece_.Swap(&other->optional_string_piece_);
+    std::swap(optional_cord_, other->optional_cord_);
+    repeated_int32_.Swap(&other->repeated_int32_);
+    repeated_int64_.Swap(&other->repeated_int64_);
+    repeated_uint32_.Swap(&other->repeated_uint32_);
+    repeated_uint64_.Swap(&other->repeated_uint64_);
+    repeated_sint32_.Swap(&other->repeated_sint32_);
+    repeated_sint64_.Swap(&other->repeated_sint64_);
+    repeated_fixed32_.Swap(&other->repeated_fixed32_);
+    repeated_fixed64_.Swap(&other->repeated_fixed64_);
+    repeated_sfixed32_.Swap(&other->repeated_sfixed32_);
+    repeated_sfixed64_.Swap(&other->repeated_sfixed64_);
+    repeated_float_.Swap(&other->repeated_float_);
+    repeated_double_.Swap(&other->repeated_double_);
+    repeated_bool_.Swap(&other->repeated_bool_);
+    repeated_string_.Swap(&other->repeated_string_);
+    repeated_bytes_.Swap(&other->repeated_bytes_);
+    repeatedgroup_.Swap(&other->repeatedgroup_);
+    repeated_nested_message_.Swap(&other->repeated_nested_message_);
+    repeated_foreign_message_.Swap(&other->repeated_foreign_message_);
+    repeated_import_message_.Swap(&other->repeated_import_message_);
+    repeated_nested_enum_.Swap(&other->repeated_nested_enum_);
+    repeated_foreign_enum_.Swap(&other->repeated_foreign_enum_);
+    repeated_import_enum_.Swap(&other->repeated_import_enum_);
+    repeated_string_piece_.Swap(&other->repeated_string_piece_);
+    repeated_cord_.Swap(&other->repeated_cord_);
+    std::swap(default_int32_, other->default_int32_);
+    std::swap(default_int64_, other->default_int64_);
+    std::swap(default_uint32_, other->default_uint32_);
+    std::swap(default_uint64_, other->default_uint64_);
+    std::swap(default_sint32_, other->default_sint32_);
+    std::swap(default_sint64_, other->default_sint64_);
+    std::swap(default_fixed32_, other->default_fixed32_);
+    std::swap(default_fixed64_, other->default_fixed64_);
+    std::swap(default_sfixed32_, other->default_sfixed32_);
+    std::swap(default_sfixed64_, other->default_sfixed64_);
+    std::swap(default_float_, other->default_float_);
+    std::swap(default_double_, other->default_double_);
+    std::swap(default_bool_, other->default_bool_);
+    std::swap(default_string_, other->default_string_);
+    std::swap(default_bytes_, other->default_bytes_);
+    std::swap(default_nested_enum_, other->default_nested_enum_);
+    std::swap(default_foreign_enum_, other->default_foreign_enum_);
+    std::swap(default_import_enum_, other->default_import_enum_);
+    default_string_piece_.Swap(&other->default_string_piece_);
+    std::swap(default_cord_, other->default_cord_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    std::swap(_has_bits_[1], other->_has_bits_[1]);
+    std::swap(_has_bits_[2], other->_has_bits_[2]);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::std::string TestTableDrivenAllTypesLite::GetTypeName() const {
+  return "protobuf_unittest.TestTableDrivenAllTypesLite";
+}
+
+
+// ===================================================================
+
+#ifndef _MSC_VER
+const int TestTableDrivenSparseLite::kOptionalInt32FieldNumber;
+const int TestTableDrivenSparseLite::kRepeatedInt32FieldNumber;
+#endif  // !_MSC_VER
+
+TestTableDrivenSparseLite::TestTableDrivenSparseLite()
+  : ::google::protobuf::MessageLite() {
+  SharedCtor();
+}
+
+void TestTableDrivenSparseLite::InitAsDefaultInstance() {
+}
+
+TestTableDrivenSparseLite::TestTableDrivenSparseLite(const TestTableDrivenSparseLite& from)
+  : ::google::protobuf::MessageLite() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void TestTableDrivenSparseLite::SharedCtor() {
+  _cached_size_ = 0;
+  optional_int32_ = 0;
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+TestTableDrivenSparseLite::~TestTableDrivenSparseLite() {
+  SharedDtor();
+}
+
+void TestTableDrivenSparseLite::SharedDtor() {
+  if (this != default_instance_) {
+  }
+}
+
+void TestTableDrivenSparseLite::SetCachedSize(int size) const {
+  ::google::protobuf::internal::NoBarrier_Store(&_cached_size_, size);
+}
+const TestTableDrivenSparseLite& TestTableDrivenSparseLite::default_instance() {
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto();
+  }
+  return *default_instance_;
+}
+
+TestTableDrivenSparseLite* TestTableDrivenSparseLite::default_instance_ = NULL;
+
+TestTableDrivenSparseLite* TestTableDrivenSparseLite::New() const {
+  return new TestTableDrivenSparseLite;
+}
+
+void TestTableDrivenSparseLite::Clear() {
+  _extensions_.Clear();
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    optional_int32_ = 0;
+  }
+  repeated_int32_.Clear();
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+bool TestTableDrivenSparseLite::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+  if (::google::protobuf::internal::Acquire_Load(
+          &protobuf_InitDefaults_done_) == 0) {
+    protobuf_InitDefaults_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto();
+  }
+  return ::google::protobuf::internal::MergePartialFromCodedStreamLite(
+      this, *TestTableDrivenSparseLite_parse_table_, input);
+}
+
+void TestTableDrivenSparseLite::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // optional int32 optional_int32 = 1;
+  if (_has_bit(0)) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->optional_int32(), output);
+  }
+  
+  // repeated int32 repeated_int32 = 31;
+  for (int i = 0; i < this->repeated_int32_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(
+      31, this->repeated_int32(i), output);
+  }
+  
+  // Extension range [1000, 536870912)
+  _extensions_.SerializeWithCachedSizes(
+      1000, 536870912, output);
+  
+}
+
+int TestTableDrivenSparseLite::ByteSize() const {
+  int total_size = 0;
+  
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // optional int32 optional_int32 = 1;
+    if (has_optional_int32()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->optional_int32());
+    }
+    
+  }
+  // repeated int32 repeated_int32 = 31;
+  {
+    int data_size = 0;
+    for (int i = 0; i < this->repeated_int32_size(); i++) {
+      data_size += ::google::protobuf::internal::WireFormatLite::
+        Int32Size(this->repeated_int32(i));
+    }
+    total_size += 2 * this->repeated_int32_size() + data_size;
+  }
+  
+  total_size += _extensions_.ByteSize();
+  
+  ::google::protobuf::internal::NoBarrier_Store(
+      &_cached_size_, total_size);
+  return total_size;
+}
+
+void TestTableDrivenSparseLite::CheckTypeAndMergeFrom(
+    const ::google::protobuf::MessageLite& from) {
+  MergeFrom(*::google::protobuf::down_cast<const TestTableDrivenSparseLite*>(&from));
+}
+
+void TestTableDrivenSparseLite::MergeFrom(const TestTableDrivenSparseLite& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  repeated_int32_.MergeFrom(from.repeated_int32_);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from._has_bit(0)) {
+      set_optional_int32(from.optional_int32());
+    }
+  }
+  _extensions_.MergeFrom(from._extensions_);
+}
+
+void TestTableDrivenSparseLite::CopyFrom(const TestTableDrivenSparseLite& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestTableDrivenSparseLite::IsInitialized() const {
+  
+  
+  if (!_extensions_.IsInitialized()) return false;  return true;
+}
+
+void TestTableDrivenSparseLite::Swap(TestTableDrivenSparseLite* other) {
+  if (other != this) {
+    std::swap(optional_int32_, other->optional_int32_);
+    repeated_int32_.Swap(&other->repeated_int32_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    std::swap(_cached_size_, other->_cached_size_);
+    _extensions_.Swap(&other->_extensions_);
+  }
+}
+
+::std::string TestTableDrivenSparseLite::GetTypeName() const {
+  return "protobuf_unittest.TestTableDrivenSparseLite";
+}
+
+::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestTableDrivenSparseLite,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::google::protobuf::int32 >, 5, false >
+  sparse_int32_extension_lite(kSparseInt32ExtensionLiteFieldNumber, 0);
+const ::std::string sparse_string_extension_lite_default("");
+::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestTableDrivenSparseLite,
+    ::google::protobuf::internal::RepeatedStringTypeTraits, 9, false >
+  sparse_string_extension_lite(kSparseStringExtensionLiteFieldNumber, sparse_string_extension_lite_default);
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace protobuf_unittest
+
+// @@protoc_insertion_point(global_scope)
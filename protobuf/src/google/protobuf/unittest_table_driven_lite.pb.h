@@ -0,0 +1,2921 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/unittest_table_driven_lite.proto
+
+#ifndef PROTOBUF_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto__INCLUDED
+#define PROTOBUF_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto__INCLUDED
+
+#include <string>
+
+#include <google/protobuf/stubs/common.h>
+
+#if GOOGLE_PROTOBUF_VERSION < 2003000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers.  Please update
+#error your headers.
+#endif
+#if 2003000 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers.  Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/repeated_field.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/string_piece_field.h>
+#include "google/protobuf/unittest_lite.pb.h"
+#include "google/protobuf/unittest_import_lite.pb.h"
+// @@protoc_insertion_point(includes)
+
+namespace protobuf_unittest {
+
+// Internal implementation detail -- do not call these.
+void  protobuf_AddDesc_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto();
+void  protobuf_InitDefaults_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto();
+void protobuf_InitDefaults_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto_impl();
+void protobuf_AssignDesc_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto();
+void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto();
+
+class TestTableDrivenAllTypesLite;
+class TestTableDrivenAllTypesLite_NestedMessage;
+class TestTableDrivenAllTypesLite_OptionalGroup;
+class TestTableDrivenAllTypesLite_RepeatedGroup;
+class TestTableDrivenSparseLite;
+
+enum TestTableDrivenAllTypesLite_NestedEnum {
+  TestTableDrivenAllTypesLite_NestedEnum_FOO = 1,
+  TestTableDrivenAllTypesLite_NestedEnum_BAR = 2,
+  TestTableDrivenAllTypesLite_NestedEnum_BAZ = 3
+};
+bool TestTableDrivenAllTypesLite_NestedEnum_IsValid(int value);
+const TestTableDrivenAllTypesLite_NestedEnum TestTableDrivenAllTypesLite_NestedEnum_NestedEnum_MIN = TestTableDrivenAllTypesLite_NestedEnum_FOO;
+const TestTableDrivenAllTypesLite_NestedEnum TestTableDrivenAllTypesLite_NestedEnum_NestedEnum_MAX = TestTableDrivenAllTypesLite_NestedEnum_BAZ;
+const int TestTableDrivenAllTypesLite_NestedEnum_NestedEnum_ARRAYSIZE = TestTableDrivenAllTypesLite_NestedEnum_NestedEnum_MAX + 1;
+
+// ===================================================================
+
+class TestTableDrivenAllTypesLite_NestedMessage : public ::google::protobuf::MessageLite {
+ public:
+  TestTableDrivenAllTypesLite_NestedMessage();
+  virtual ~TestTableDrivenAllTypesLite_NestedMessage();
+  
+  TestTableDrivenAllTypesLite_NestedMessage(const TestTableDrivenAllTypesLite_NestedMessage& from);
+  
+  inline TestTableDrivenAllTypesLite_NestedMessage& operator=(const TestTableDrivenAllTypesLite_NestedMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  
+  static const TestTableDrivenAllTypesLite_NestedMessage& default_instance();
+  
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestTableDrivenAllTypesLite_NestedMessage* internal_default_instance() {
+    return default_instance_;
+  }
+  
+  void Swap(TestTableDrivenAllTypesLite_NestedMessage* other);
+  
+  // implements Message ----------------------------------------------
+  
+  TestTableDrivenAllTypesLite_NestedMessage* New() const;
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from);
+  void CopyFrom(const TestTableDrivenAllTypesLite_NestedMessage& from);
+  void MergeFrom(const TestTableDrivenAllTypesLite_NestedMessage& from);
+  void Clear();
+  bool IsInitialized() const;
+  
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+  
+  ::std::string GetTypeName() const;
+  
+  // nested types ----------------------------------------------------
+  
+  // accessors -------------------------------------------------------
+  
+  // optional int32 bb = 1;
+  inline bool has_bb() const;
+  inline void clear_bb();
+  static const int kBbFieldNumber = 1;
+  inline ::google::protobuf::int32 bb() const;
+  inline void set_bb(::google::protobuf::int32 value);
+  
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestTableDrivenAllTypesLite.NestedMessage)
+ private:
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
+  
+  ::google::protobuf::int32 bb_;
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto_impl();
+  friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto();
+  friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto();
+  
+  ::google::protobuf::uint32 _has_bits_[(1 + 31) / 32];
+  
+  // WHY DOES & HAVE LOWER PRECEDENCE THAN != !?
+  inline bool _has_bit(int index) const {
+    return (_has_bits_[index / 32] & (1u << (index % 32))) != 0;
+  }
+  inline void _set_bit(int index) {
+    _has_bits_[index / 32] |= (1u << (index % 32));
+  }
+  inline void _clear_bit(int index) {
+    _has_bits_[index / 32] &= ~(1u << (index % 32));
+  }
+  
+  void InitAsDefaultInstance();
+  static TestTableDrivenAllTypesLite_NestedMessage* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class TestTableDrivenAllTypesLite_OptionalGroup : public ::google::protobuf::MessageLite {
+ public:
+  TestTableDrivenAllTypesLite_OptionalGroup();
+  virtual ~TestTableDrivenAllTypesLite_OptionalGroup();
+  
+  TestTableDrivenAllTypesLite_OptionalGroup(const TestTableDrivenAllTypesLite_OptionalGroup& from);
+  
+  inline TestTableDrivenAllTypesLite_OptionalGroup& operator=(const TestTableDrivenAllTypesLite_OptionalGroup& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  
+  static const TestTableDrivenAllTypesLite_OptionalGroup& default_instance();
+  
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestTableDrivenAllTypesLite_OptionalGroup* internal_default_instance() {
+    return default_instance_;
+  }
+  
+  void Swap(TestTableDrivenAllTypesLite_OptionalGroup* other);
+  
+  // implements Message ----------------------------------------------
+  
+  TestTableDrivenAllTypesLite_OptionalGroup* New() const;
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from);
+  void CopyFrom(const TestTableDrivenAllTypesLite_OptionalGroup& from);
+  void MergeFrom(const TestTableDrivenAllTypesLite_OptionalGroup& from);
+  void Clear();
+  bool IsInitialized() const;
+  
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+  
+  ::std::string GetTypeName() const;
+  
+  // nested types ----------------------------------------------------
+  
+  // accessors -------------------------------------------------------
+  
+  // optional int32 a = 17;
+  inline bool has_a() const;
+  inline void clear_a();
+  static const int kAFieldNumber = 17;
+  inline ::google::protobuf::int32 a() const;
+  inline void set_a(::google::protobuf::int32 value);
+  
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestTableDrivenAllTypesLite.OptionalGroup)
+ private:
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
+  
+  ::google::protobuf::int32 a_;
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto_impl();
+  friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto();
+  friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto();
+  
+  ::google::protobuf::uint32 _has_bits_[(1 + 31) / 32];
+  
+  // WHY DOES & HAVE LOWER PRECEDENCE THAN != !?
+  inline bool _has_bit(int index) const {
+    return (_has_bits_[index / 32] & (1u << (index % 32))) != 0;
+  }
+  inline void _set_bit(int index) {
+    _has_bits_[index / 32] |= (1u << (index % 32));
+  }
+  inline void _clear_bit(int index) {
+    _has_bits_[index / 32] &= ~(1u << (index % 32));
+  }
+  
+  void InitAsDefaultInstance();
+  static TestTableDrivenAllTypesLite_OptionalGroup* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class TestTableDrivenAllTypesLite_RepeatedGroup : public ::google::protobuf::MessageLite {
+ public:
+  TestTableDrivenAllTypesLite_RepeatedGroup();
+  virtual ~TestTableDrivenAllTypesLite_RepeatedGroup();
+  
+  TestTableDrivenAllTypesLite_RepeatedGroup(const TestTableDrivenAllTypesLite_RepeatedGroup& from);
+  
+  inline TestTableDrivenAllTypesLite_RepeatedGroup& operator=(const TestTableDrivenAllTypesLite_RepeatedGroup& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  
+  static const TestTableDrivenAllTypesLite_RepeatedGroup& default_instance();
+  
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestTableDrivenAllTypesLite_RepeatedGroup* internal_default_instance() {
+    return default_instance_;
+  }
+  
+  void Swap(TestTableDrivenAllTypesLite_RepeatedGroup* other);
+  
+  // implements Message ----------------------------------------------
+  
+  TestTableDrivenAllTypesLite_RepeatedGroup* New() const;
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from);
+  void CopyFrom(const TestTableDrivenAllTypesLite_RepeatedGroup& from);
+  void MergeFrom(const TestTableDrivenAllTypesLite_RepeatedGroup& from);
+  void Clear();
+  bool IsInitialized() const;
+  
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+  
+  ::std::string GetTypeName() const;
+  
+  // nested types ----------------------------------------------------
+  
+  // accessors -------------------------------------------------------
+  
+  // optional int32 a = 47;
+  inline bool has_a() const;
+  inline void clear_a();
+  static const int kAFieldNumber = 47;
+  inline ::google::protobuf::int32 a() const;
+  inline void set_a(::google::protobuf::int32 value);
+  
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestTableDrivenAllTypesLite.RepeatedGroup)
+ private:
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
+  
+  ::google::protobuf::int32 a_;
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto_impl();
+  friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto();
+  friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto();
+  
+  ::google::protobuf::uint32 _has_bits_[(1 + 31) / 32];
+  
+  // WHY DOES & HAVE LOWER PRECEDENCE THAN != !?
+  inline bool _has_bit(int index) const {
+    return (_has_bits_[index / 32] & (1u << (index % 32))) != 0;
+  }
+  inline void _set_bit(int index) {
+    _has_bits_[index / 32] |= (1u << (index % 32));
+  }
+  inline void _clear_bit(int index) {
+    _has_bits_[index / 32] &= ~(1u << (index % 32));
+  }
+  
+  void InitAsDefaultInstance();
+  static TestTableDrivenAllTypesLite_RepeatedGroup* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class TestTableDrivenAllTypesLite : public ::google::protobuf::MessageLite {
+ public:
+  TestTableDrivenAllTypesLite();
+  virtual ~TestTableDrivenAllTypesLite();
+  
+  TestTableDrivenAllTypesLite(const TestTableDrivenAllTypesLite& from);
+  
+  inline TestTableDrivenAllTypesLite& operator=(const TestTableDrivenAllTypesLite& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  
+  static const TestTableDrivenAllTypesLite& default_instance();
+  
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestTableDrivenAllTypesLite* internal_default_instance() {
+    return default_instance_;
+  }
+  
+  void Swap(TestTableDrivenAllTypesLite* other);
+  
+  // implements Message ----------------------------------------------
+  
+  TestTableDrivenAllTypesLite* New() const;
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from);
+  void CopyFrom(const TestTableDrivenAllTypesLite& from);
+  void MergeFrom(const TestTableDrivenAllTypesLite& from);
+  void Clear();
+  bool IsInitialized() const;
+  
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+  
+  ::std::string GetTypeName() const;
+  
+  // nested types ----------------------------------------------------
+  
+  typedef TestTableDrivenAllTypesLite_NestedMessage NestedMessage;
+  typedef TestTableDrivenAllTypesLite_OptionalGroup OptionalGroup;
+  typedef TestTableDrivenAllTypesLite_RepeatedGroup RepeatedGroup;
+  
+  typedef TestTableDrivenAllTypesLite_NestedEnum NestedEnum;
+  static const NestedEnum FOO = TestTableDrivenAllTypesLite_NestedEnum_FOO;
+  static const NestedEnum BAR = TestTableDrivenAllTypesLite_NestedEnum_BAR;
+  static const NestedEnum BAZ = TestTableDrivenAllTypesLite_NestedEnum_BAZ;
+  static inline bool NestedEnum_IsValid(int value) {
+    return TestTableDrivenAllTypesLite_NestedEnum_IsValid(value);
+  }
+  static const NestedEnum NestedEnum_MIN =
+    TestTableDrivenAllTypesLite_NestedEnum_NestedEnum_MIN;
+  static const NestedEnum NestedEnum_MAX =
+    TestTableDrivenAllTypesLite_NestedEnum_NestedEnum_MAX;
+  static const int NestedEnum_ARRAYSIZE =
+    TestTableDrivenAllTypesLite_NestedEnum_NestedEnum_ARRAYSIZE;
+  
+  // accessors -------------------------------------------------------
+  
+  // optional int32 optional_int32 = 1;
+  inline bool has_optional_int32() const;
+  inline void clear_optional_int32();
+  static const int kOptionalInt32FieldNumber = 1;
+  inline ::google::protobuf::int32 optional_int32() const;
+  inline void set_optional_int32(::google::protobuf::int32 value);
+  
+  // optional int64 optional_int64 = 2;
+  inline bool has_optional_int64() const;
+  inline void clear_optional_int64();
+  static const int kOptionalInt64FieldNumber = 2;
+  inline ::google::protobuf::int64 optional_int64() const;
+  inline void set_optional_int64(::google::protobuf::int64 value);
+  
+  // optional uint32 optional_uint32 = 3;
+  inline bool has_optional_uint32() const;
+  inline void clear_optional_uint32();
+  static const int kOptionalUint32FieldNumber = 3;
+  inline ::google::protobuf::uint32 optional_uint32() const;
+  inline void set_optional_uint32(::google::protobuf::uint32 value);
+  
+  // optional uint64 optional_uint64 = 4;
+  inline bool has_optional_uint64() const;
+  inline void clear_optional_uint64();
+  static const int kOptionalUint64FieldNumber = 4;
+  inline ::google::protobuf::uint64 optional_uint64() const;
+  inline void set_optional_uint64(::google::protobuf::uint64 value);
+  
+  // optional sint32 optional_sint32 = 5;
+  inline bool has_optional_sint32() const;
+  inline void clear_optional_sint32();
+  static const int kOptionalSint32FieldNumber = 5;
+  inline ::google::protobuf::int32 optional_sint32() const;
+  inline void set_optional_sint32(::google::protobuf::int32 value);
+  
+  // optional sint64 optional_sint64 = 6;
+  inline bool has_optional_sint64() const;
+  inline void clear_optional_sint64();
+  static const int kOptionalSint64FieldNumber = 6;
+  inline ::google::protobuf::int64 optional_sint64() const;
+  inline void set_optional_sint64(::google::protobuf::int64 value);
+  
+  // optional fixed32 optional_fixed32 = 7;
+  inline bool has_optional_fixed32() const;
+  inline void clear_optional_fixed32();
+  static const int kOptionalFixed32FieldNumber = 7;
+  inline ::google::protobuf::uint32 optional_fixed32() const;
+  inline void set_optional_fixed32(::google::protobuf::uint32 value);
+  
+  // optional fixed64 optional_fixed64 = 8;
+  inline bool has_optional_fixed64() const;
+  inline void clear_optional_fixed64();
+  static const int kOptionalFixed64FieldNumber = 8;
+  inline ::google::protobuf::uint64 optional_fixed64() const;
+  inline void set_optional_fixed64(::google::protobuf::uint64 value);
+  
+  // optional sfixed32 optional_sfixed32 = 9;
+  inline bool has_optional_sfixed32() const;
+  inline void clear_optional_sfixed32();
+  static const int kOptionalSfixed32FieldNumber = 9;
+  inline ::google::protobuf::int32 optional_sfixed32() const;
+  inline void set_optional_sfixed32(::google::protobuf::int32 value);
+  
+  // optional sfixed64 optional_sfixed64 = 10;
+  inline bool has_optional_sfixed64() const;
+  inline void clear_optional_sfixed64();
+  static const int kOptionalSfixed64FieldNumber = 10;
+  inline ::google::protobuf::int64 optional_sfixed64() const;
+  inline void set_optional_sfixed64(::google::protobuf::int64 value);
+  
+  // optional float optional_float = 11;
+  inline bool has_optional_float() const;
+  inline void clear_optional_float();
+  static const int kOptionalFloatFieldNumber = 11;
+  inline float optional_float() const;
+  inline void set_optional_float(float value);
+  
+  // optional double optional_double = 12;
+  inline bool has_optional_double() const;
+  inline void clear_optional_double();
+  static const int kOptionalDoubleFieldNumber = 12;
+  inline double optional_double() const;
+  inline void set_optional_double(double value);
+  
+  // optional bool optional_bool = 13;
+  inline bool has_optional_bool() const;
+  inline void clear_optional_bool();
+  static const int kOptionalBoolFieldNumber = 13;
+  inline bool optional_bool() const;
+  inline void set_optional_bool(bool value);
+  
+  // optional string optional_string = 14;
+  inline bool has_optional_string() const;
+  inline void clear_optional_string();
+  static const int kOptionalStringFieldNumber = 14;
+  inline const ::std::string& optional_string() const;
+  inline void set_optional_string(const ::std::string& value);
+  inline void set_optional_string(const char* value);
+  inline void set_optional_string(const char* value, size_t size);
+  inline ::std::string* mutable_optional_string();
+  
+  // optional bytes optional_bytes = 15;
+  inline bool has_optional_bytes() const;
+  inline void clear_optional_bytes();
+  static const int kOptionalBytesFieldNumber = 15;
+  inline const ::std::string& optional_bytes() const;
+  inline void set_optional_bytes(const ::std::string& value);
+  inline void set_optional_bytes(const char* value);
+  inline void set_optional_bytes(const void* value, size_t size);
+  inline ::std::string* mutable_optional_bytes();
+  
+  // optional group OptionalGroup = 16 {
+  inline bool has_optionalgroup() const;
+  inline void clear_optionalgroup();
+  static const int kOptionalgroupFieldNumber = 16;
+  inline const ::protobuf_unittest::TestTableDrivenAllTypesLite_OptionalGroup& optionalgroup() const;
+  inline ::protobuf_unittest::TestTableDrivenAllTypesLite_OptionalGroup* mutable_optionalgroup();
+  
+  // optional .protobuf_unittest.TestTableDrivenAllTypesLite.NestedMessage optional_nested_message = 18;
+  inline bool has_optional_nested_message() const;
+  inline void clear_optional_nested_message();
+  static const int kOptionalNestedMessageFieldNumber = 18;
+  inline const ::protobuf_unittest::TestTableDrivenAllTypesLite_NestedMessage& optional_nested_message() const;
+  inline ::protobuf_unittest::TestTableDrivenAllTypesLite_NestedMessage* mutable_optional_nested_message();
+  
+  // optional .protobuf_unittest.ForeignMessageLite optional_foreign_message = 19;
+  inline bool has_optional_foreign_message() const;
+  inline void clear_optional_foreign_message();
+  static const int kOptionalForeignMessageFieldNumber = 19;
+  inline const ::protobuf_unittest::ForeignMessageLite& optional_foreign_message() const;
+  inline ::protobuf_unittest::ForeignMessageLite* mutable_optional_foreign_message();
+  
+  // optional .protobuf_unittest_import.ImportMessageLite optional_import_message = 20;
+  inline bool has_optional_import_message() const;
+  inline void clear_optional_import_message();
+  static const int kOptionalImportMessageFieldNumber = 20;
+  inline const ::protobuf_unittest_import::ImportMessageLite& optional_import_message() const;
+  inline ::protobuf_unittest_import::ImportMessageLite* mutable_optional_import_message();
+  
+  // optional .protobuf_unittest.TestTableDrivenAllTypesLite.NestedEnum optional_nested_enum = 21;
+  inline bool has_optional_nested_enum() const;
+  inline void clear_optional_nested_enum();
+  static const int kOptionalNestedEnumFieldNumber = 21;
+  inline ::protobuf_unittest::TestTableDrivenAllTypesLite_NestedEnum optional_nested_enum() const;
+  inline void set_optional_nested_enum(::protobuf_unittest::TestTableDrivenAllTypesLite_NestedEnum value);
+  
+  // optional .protobuf_unittest.ForeignEnumLite optional_foreign_enum = 22;
+  inline bool has_optional_foreign_enum() const;
+  inline void clear_optional_foreign_enum();
+  static const int kOptionalForeignEnumFieldNumber = 22;
+  inline protobuf_unittest::ForeignEnumLite optional_foreign_enum() const;
+  inline void set_optional_foreign_enum(protobuf_unittest::ForeignEnumLite value);
+  
+  // optional .protobuf_unittest_import.ImportEnumLite optional_import_enum = 23;
+  inline bool has_optional_import_enum() const;
+  inline void clear_optional_import_enum();
+  static const int kOptionalImportEnumFieldNumber = 23;
+  inline protobuf_unittest_import::ImportEnumLite optional_import_enum() const;
+  inline void set_optional_import_enum(protobuf_unittest_import::ImportEnumLite value);
+  
+  // optional string optional_string_piece = 24 [ctype = STRING_PIECE];
+  inline bool has_optional_string_piece() const;
+  inline void clear_optional_string_piece();
+  static const int kOptionalStringPieceFieldNumber = 24;
+  inline const ::google::protobuf::internal::StringPieceField& optional_string_piece() const;
+  inline void set_optional_string_piece(const ::std::string& value);
+  inline void set_optional_string_piece(const char* value);
+  inline void set_optional_string_piece(const char* value, size_t size);
+  inline ::std::string* mutable_optional_string_piece();
+  
+  // optional string optional_cord = 25 [ctype = CORD];
+  inline bool has_optional_cord() const;
+  inline void clear_optional_cord();
+  static const int kOptionalCordFieldNumber = 25;
+ private:
+  // Hidden due to unknown ctype option.
+  inline const ::std::string& optional_cord() const;
+  inline void set_optional_cord(const ::std::string& value);
+  inline void set_optional_cord(const char* value);
+  inline void set_optional_cord(const char* value, size_t size);
+  inline ::std::string* mutable_optional_cord();
+ public:
+  
+  // repeated int32 repeated_int32 = 31;
+  inline int repeated_int32_size() const;
+  inline void clear_repeated_int32();
+  static const int kRepeatedInt32FieldNumber = 31;
+  inline ::google::protobuf::int32 repeated_int32(int index) const;
+  inline void set_repeated_int32(int index, ::google::protobuf::int32 value);
+  inline void add_repeated_int32(::google::protobuf::int32 value);
+  inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+      repeated_int32() const;
+  inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+      mutable_repeated_int32();
+  
+  // repeated int64 repeated_int64 = 32;
+  inline int repeated_int64_size() const;
+  inline void clear_repeated_int64();
+  static const int kRepeatedInt64FieldNumber = 32;
+  inline ::google::protobuf::int64 repeated_int64(int index) const;
+  inline void set_repeated_int64(int index, ::google::protobuf::int64 value);
+  inline void add_repeated_int64(::google::protobuf::int64 value);
+  inline const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
+      repeated_int64() const;
+  inline ::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
+      mutable_repeated_int64();
+  
+  // repeated uint32 repeated_uint32 = 33;
+  inline int repeated_uint32_size() const;
+  inline void clear_repeated_uint32();
+  static const int kRepeatedUint32FieldNumber = 33;
+  inline ::google::protobuf::uint32 repeated_uint32(int index) const;
+  inline void set_repeated_uint32(int index, ::google::protobuf::uint32 value);
+  inline void add_repeated_uint32(::google::protobuf::uint32 value);
+  inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+      repeated_uint32() const;
+  inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+      mutable_repeated_uint32();
+  
+  // repeated uint64 repeated_uint64 = 34;
+  inline int repeated_uint64_size() const;
+  inline void clear_repeated_uint64();
+  static const int kRepeatedUint64FieldNumber = 34;
+  inline ::google::protobuf::uint64 repeated_uint64(int index) const;
+  inline void set_repeated_uint64(int index, ::google::protobuf::uint64 value);
+  inline void add_repeated_uint64(::google::protobuf::uint64 value);
+  inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
+      repeated_uint64() const;
+  inline ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
+      mutable_repeated_uint64();
+  
+  // repeated sint32 repeated_sint32 = 35;
+  inline int repeated_sint32_size() const;
+  inline void clear_repeated_sint32();
+  static const int kRepeatedSint32FieldNumber = 35;
+  inline ::google::protobuf::int32 repeated_sint32(int index) const;
+  inline void set_repeated_sint32(int index, ::google::protobuf::int32 value);
+  inline void add_repeated_sint32(::google::protobuf::int32 value);
+  inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+      repeated_sint32() const;
+  inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+      mutable_repeated_sint32();
+  
+  // repeated sint64 repeated_sint64 = 36;
+  inline int repeated_sint64_size() const;
+  inline void clear_repeated_sint64();
+  static const int kRepeatedSint64FieldNumber = 36;
+  inline ::google::protobuf::int64 repeated_sint64(int index) const;
+  inline void set_repeated_sint64(int index, ::google::protobuf::int64 value);
+  inline void add_repeated_sint64(::google::protobuf::int64 value);
+  inline const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
+      repeated_sint64() const;
+  inline ::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
+      mutable_repeated_sint64();
+  
+  // repeated fixed32 repeated_fixed32 = 37;
+  inline int repeated_fixed32_size() const;
+  inline void clear_repeated_fixed32();
+  static const int kRepeatedFixed32FieldNumber = 37;
+  inline ::google::protobuf::uint32 repeated_fixed32(int index) const;
+  inline void set_repeated_fixed32(int index, ::google::protobuf::uint32 value);
+  inline void add_repeated_fixed32(::google::protobuf::uint32 value);
+  inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+      repeated_fixed32() const;
+  inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+      mutable_repeated_fixed32();
+  
+  // repeated fixed64 repeated_fixed64 = 38;
+  inline int repeated_fixed64_size() const;
+  inline void clear_repeated_fixed64();
+  static const int kRepeatedFixed64FieldNumber = 38;
+  inline ::google::protobuf::uint64 repeated_fixed64(int index) const;
+  inline void set_repeated_fixed64(int index, ::google::protobuf::uint64 value);
+  inline void add_repeated_fixed64(::google::protobuf::uint64 value);
+  inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
+      repeated_fixed64() const;
+  inline ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
+      mutable_repeated_fixed64();
+  
+  // repeated sfixed32 repeated_sfixed32 = 39;
+  inline int repeated_sfixed32_size() const;
+  inline void clear_repeated_sfixed32();
+  static const int kRepeatedSfixed32FieldNumber = 39;
+  inline ::google::protobuf::int32 repeated_sfixed32(int index) const;
+  inline void set_repeated_sfixed32(int index, ::google::protobuf::int32 value);
+  inline void add_repeated_sfixed32(::google::protobuf::int32 value);
+  inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+      repeated_sfixed32() const;
+  inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+      mutable_repeated_sfixed32();
+  
+  // repeated sfixed64 repeated_sfixed64 = 40;
+  inline int repeated_sfixed64_size() const;
+  inline void clear_repeated_sfixed64();
+  static const int kRepeatedSfixed64FieldNumber = 40;
+  inline ::google::protobuf::int64 repeated_sfixed64(int index) const;
+  inline void set_repeated_sfixed64(int index, ::google::protobuf::int64 value);
+  inline void add_repeated_sfixed64(::google::protobuf::int64 value);
+  inline const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
+      repeated_sfixed64() const;
+  inline ::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
+      mutable_repeated_sfixed64();
+  
+  // repeated float repeated_float = 41;
+  inline int repeated_float_size() const;
+  inline void clear_repeated_float();
+  static const int kRepeatedFloatFieldNumber = 41;
+  inline float repeated_float(int index) const;
+  inline void set_repeated_float(int index, float value);
+  inline void add_repeated_float(float value);
+  inline const ::google::protobuf::RepeatedField< float >&
+      repeated_float() const;
+  inline ::google::protobuf::RepeatedField< float >*
+      mutable_repeated_float();
+  
+  // repeated double repeated_double = 42;
+  inline int repeated_double_size() const;
+  inline void clear_repeated_double();
+  static const int kRepeatedDoubleFieldNumber = 42;
+  inline double repeated_double(int index) const;
+  inline void set_repeated_double(int index, double value);
+  inline void add_repeated_double(double value);
+  inline const ::google::protobuf::RepeatedField< double >&
+      repeated_double() const;
+  inline ::google::protobuf::RepeatedField< double >*
+      mutable_repeated_double();
+  
+  // repeated bool repeated_bool = 43;
+  inline int repeated_bool_size() const;
+  inline void clear_repeated_bool();
+  static const int kRepeatedBoolFieldNumber = 43;
+  inline bool repeated_bool(int index) const;
+  inline void set_repeated_bool(int index, bool value);
+  inline void add_repeated_bool(bool value);
+  inline const ::google::protobuf::RepeatedField< bool >&
+      repeated_bool() const;
+  inline ::google::protobuf::RepeatedField< bool >*
+      mutable_repeated_bool();
+  
+  // repeated string repeated_string = 44;
+  inline int repeated_string_size() const;
+  inline void clear_repeated_string();
+  static const int kRepeatedStringFieldNumber = 44;
+  inline const ::std::string& repeated_string(int index) const;
+  inline ::std::string* mutable_repeated_string(int index);
+  inline void set_repeated_string(int index, const ::std::string& value);
+  inline void set_repeated_string(int index, const char* value);
+  inline void set_repeated_string(int index, const char* value, size_t size);
+  inline ::std::string* add_repeated_string();
+  inline void add_repeated_string(const ::std::string& value);
+  inline void add_repeated_string(const char* value);
+  inline void add_repeated_string(const char* value, size_t size);
+  inline const ::google::protobuf::RepeatedPtrField< ::std::string>& repeated_string() const;
+  inline ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_repeated_string();
+  
+  // repeated bytes repeated_bytes = 45;
+  inline int repeated_bytes_size() const;
+  inline void clear_repeated_bytes();
+  static const int kRepeatedBytesFieldNumber = 45;
+  inline const ::std::string& repeated_bytes(int index) const;
+  inline ::std::string* mutable_repeated_bytes(int index);
+  inline void set_repeated_bytes(int index, const ::std::string& value);
+  inline void set_repeated_bytes(int index, const char* value);
+  inline void set_repeated_bytes(int index, const void* value, size_t size);
+  inline ::std::string* add_repeated_bytes();
+  inline void add_repeated_bytes(const ::std::string& value);
+  inline void add_repeated_bytes(const char* value);
+  inline void add_repeated_bytes(const void* value, size_t size);
+  inline const ::google::protobuf::RepeatedPtrField< ::std::string>& repeated_bytes() const;
+  inline ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_repeated_bytes();
+  
+  // repeated group RepeatedGroup = 46 {
+  inline int repeatedgroup_size() const;
+  inline void clear_repeatedgroup();
+  static const int kRepeatedgroupFieldNumber = 46;
+  inline const ::protobuf_unittest::TestTableDrivenAllTypesLite_RepeatedGroup& repeatedgroup(int index) const;
+  inline ::protobuf_unittest::TestTableDrivenAllTypesLite_RepeatedGroup* mutable_repeatedgroup(int index);
+  inline ::protobuf_unittest::TestTableDrivenAllTypesLite_RepeatedGroup* add_repeatedgroup();
+  inline const ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestTableDrivenAllTypesLite_RepeatedGroup >&
+      repeatedgroup() const;
+  inline ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestTableDrivenAllTypesLite_RepeatedGroup >*
+      mutable_repeatedgroup();
+  
+  // repeated .protobuf_unittest.TestTableDrivenAllTypesLite.NestedMessage repeated_nested_message = 48;
+  inline int repeated_nested_message_size() const;
+  inline void clear_repeated_nested_message();
+  static const int kRepeatedNestedMessageFieldNumber = 48;
+  inline const ::protobuf_unittest::TestTableDrivenAllTypesLite_NestedMessage& repeated_nested_message(int index) const;
+  inline ::protobuf_unittest::TestTableDrivenAllTypesLite_NestedMessage* mutable_repeated_nested_message(int index);
+  inline ::protobuf_unittest::TestTableDrivenAllTypesLite_NestedMessage* add_repeated_nested_message();
+  inline const ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestTableDrivenAllTypesLite_NestedMessage >&
+      repeated_nested_message() const;
+  inline ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestTableDrivenAllTypesLite_NestedMessage >*
+      mutable_repeated_nested_message();
+  
+  // repeated .protobuf_unittest.ForeignMessageLite repeated_foreign_message = 49;
+  inline int repeated_foreign_message_size() const;
+  inline void clear_repeated_foreign_message();
+  static const int kRepeatedForeignMessageFieldNumber = 49;
+  inline const ::protobuf_unittest::ForeignMessageLite& repeated_foreign_message(int index) const;
+  inline ::protobuf_unittest::ForeignMessageLite* mutable_repeated_foreign_message(int index);
+  inline ::protobuf_unittest::ForeignMessageLite* add_repeated_foreign_message();
+  inline const ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::ForeignMessageLite >&
+      repeated_foreign_message() const;
+  inline ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::ForeignMessageLite >*
+      mutable_repeated_foreign_message();
+  
+  // repeated .protobuf_unittest_import.ImportMessageLite repeated_import_message = 50;
+  inline int repeated_import_message_size() const;
+  inline void clear_repeated_import_message();
+  static const int kRepeatedImportMessageFieldNumber = 50;
+  inline const ::protobuf_unittest_import::ImportMessageLite& repeated_import_message(int index) const;
+  inline ::protobuf_unittest_import::ImportMessageLite* mutable_repeated_import_message(int index);
+  inline ::protobuf_unittest_import::ImportMessageLite* add_repeated_import_message();
+  inline const ::google::protobuf::RepeatedPtrField< ::protobuf_unittest_import::ImportMessageLite >&
+      repeated_import_message() const;
+  inline ::google::protobuf::RepeatedPtrField< ::protobuf_unittest_import::ImportMessageLite >*
+      mutable_repeated_import_message();
+  
+  // repeated .protobuf_unittest.TestTableDrivenAllTypesLite.NestedEnum repeated_nested_enum = 51;
+  inline int repeated_nested_enum_size() const;
+  inline void clear_repeated_nested_enum();
+  static const int kRepeatedNestedEnumFieldNumber = 51;
+  inline ::protobuf_unittest::TestTableDrivenAllTypesLite_NestedEnum repeated_nested_enum(int index) const;
+  inline void set_repeated_nested_enum(int index, ::protobuf_unittest::TestTableDrivenAllTypesLite_NestedEnum value);
+  inline void add_repeated_nested_enum(::protobuf_unittest::TestTableDrivenAllTypesLite_NestedEnum value);
+  inline const ::google::protobuf::RepeatedField<int>& repeated_nested_enum() const;
+  inline ::google::protobuf::RepeatedField<int>* mutable_repeated_nested_enum();
+  
+  // repeated .protobuf_unittest.ForeignEnumLite repeated_foreign_enum = 52;
+  inline int repeated_foreign_enum_size() const;
+  inline void clear_repeated_foreign_enum();
+  static const int kRepeatedForeignEnumFieldNumber = 52;
+  inline protobuf_unittest::ForeignEnumLite repeated_foreign_enum(int index) const;
+  inline void set_repeated_foreign_enum(int index, protobuf_unittest::ForeignEnumLite value);
+  inline void add_repeated_foreign_enum(protobuf_unittest::ForeignEnumLite value);
+  inline const ::google::protobuf::RepeatedField<int>& repeated_foreign_enum() const;
+  inline ::google::protobuf::RepeatedField<int>* mutable_repeated_foreign_enum();
+  
+  // repeated .protobuf_unittest_import.ImportEnumLite repeated_import_enum = 53;
+  inline int repeated_import_enum_size() const;
+  inline void clear_repeated_import_enum();
+  static const int kRepeatedImportEnumFieldNumber = 53;
+  inline protobuf_unittest_import::ImportEnumLite repeated_import_enum(int index) const;
+  inline void set_repeated_import_enum(int index, protobuf_unittest_import::ImportEnumLite value);
+  inline void add_repeated_import_enum(protobuf_unittest_import::ImportEnumLite value);
+  inline const ::google::protobuf::RepeatedField<int>& repeated_import_enum() const;
+  inline ::google::protobuf::RepeatedField<int>* mutable_repeated_import_enum();
+  
+  // repeated string repeated_string_piece = 54 [ctype = STRING_PIECE];
+  inline int repeated_string_piece_size() const;
+  inline void clear_repeated_string_piece();
+  static const int kRepeatedStringPieceFieldNumber = 54;
+  inline const ::google::protobuf::internal::StringPieceField& repeated_string_piece(int index) const;
+  inline ::std::string* mutable_repeated_string_piece(int index);
+  inline void set_repeated_string_piece(int index, const ::std::string& value);
+  inline void set_repeated_string_piece(int index, const char* value);
+  inline void set_repeated_string_piece(int index, const char* value, size_t size);
+  inline ::std::string* add_repeated_string_piece();
+  inline void add_repeated_string_piece(const ::std::string& value);
+  inline void add_repeated_string_piece(const char* value);
+  inline void add_repeated_string_piece(const char* value, size_t size);
+  inline const ::google::protobuf::RepeatedPtrField< ::google::protobuf::internal::StringPieceField>& repeated_string_piece() const;
+  inline ::google::protobuf::RepeatedPtrField< ::google::protobuf::internal::StringPieceField>* mutable_repeated_string_piece();
+  
+  // repeated string repeated_cord = 55 [ctype = CORD];
+  inline int repeated_cord_size() const;
+  inline void clear_repeated_cord();
+  static const int kRepeatedCordFieldNumber = 55;
+ private:
+  // Hidden due to unknown ctype option.
+  inline const ::std::string& repeated_cord(int index) const;
+  inline ::std::string* mutable_repeated_cord(int index);
+  inline void set_repeated_cord(int index, const ::std::string& value);
+  inline void set_repeated_cord(int index, const char* value);
+  inline void set_repeated_cord(int index, const char* value, size_t size);
+  inline ::std::string* add_repeated_cord();
+  inline void add_repeated_cord(const ::std::string& value);
+  inline void add_repeated_cord(const char* value);
+  inline void add_repeated_cord(const char* value, size_t size);
+  inline const ::google::protobuf::RepeatedPtrField< ::std::string>& repeated_cord() const;
+  inline ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_repeated_cord();
+ public:
+  
+  // optional int32 default_int32 = 61 [default = 41];
+  inline bool has_default_int32() const;
+  inline void clear_default_int32();
+  static const int kDefaultInt32FieldNumber = 61;
+  inline ::google::protobuf::int32 default_int32() const;
+  inline void set_default_int32(::google::protobuf::int32 value);
+  
+  // optional int64 default_int64 = 62 [default = 42];
+  inline bool has_default_int64() const;
+  inline void clear_default_int64();
+  static const int kDefaultInt64FieldNumber = 62;
+  inline ::google::protobuf::int64 default_int64() const;
+  inline void set_default_int64(::google::protobuf::int64 value);
+  
+  // optional uint32 default_uint32 = 63 [default = 43];
+  inline bool has_default_uint32() const;
+  inline void clear_default_uint32();
+  static const int kDefaultUint32FieldNumber = 63;
+  inline ::google::protobuf::uint32 default_uint32() const;
+  inline void set_default_uint32(::google::protobuf::uint32 value);
+  
+  // optional uint64 default_uint64 = 64 [default = 44];
+  inline bool has_default_uint64() const;
+  inline void clear_default_uint64();
+  static const int kDefaultUint64FieldNumber = 64;
+  inline ::google::protobuf::uint64 default_uint64() const;
+  inline void set_default_uint64(::google::protobuf::uint64 value);
+  
+  // optional sint32 default_sint32 = 65 [default = -45];
+  inline bool has_default_sint32() const;
+  inline void clear_default_sint32();
+  static const int kDefaultSint32FieldNumber = 65;
+  inline ::google::protobuf::int32 default_sint32() const;
+  inline void set_default_sint32(::google::protobuf::int32 value);
+  
+  // optional sint64 default_sint64 = 66 [default = 46];
+  inline bool has_default_sint64() const;
+  inline void clear_default_sint64();
+  static const int kDefaultSint64FieldNumber = 66;
+  inline ::google::protobuf::int64 default_sint64() const;
+  inline void set_default_sint64(::google::protobuf::int64 value);
+  
+  // optional fixed32 default_fixed32 = 67 [default = 47];
+  inline bool has_default_fixed32() const;
+  inline void clear_default_fixed32();
+  static const int kDefaultFixed32FieldNumber = 67;
+  inline ::google::protobuf::uint32 default_fixed32() const;
+  inline void set_default_fixed32(::google::protobuf::uint32 value);
+  
+  // optional fixed64 default_fixed64 = 68 [default = 48];
+  inline bool has_default_fixed64() const;
+  inline void clear_default_fixed64();
+  static const int kDefaultFixed64FieldNumber = 68;
+  inline ::google::protobuf::uint64 default_fixed64() const;
+  inline void set_default_fixed64(::google::protobuf::uint64 value);
+  
+  // optional sfixed32 default_sfixed32 = 69 [default = 49];
+  inline bool has_default_sfixed32() const;
+  inline void clear_default_sfixed32();
+  static const int kDefaultSfixed32FieldNumber = 69;
+  inline ::google::protobuf::int32 default_sfixed32() const;
+  inline void set_default_sfixed32(::google::protobuf::int32 value);
+  
+  // optional sfixed64 default_sfixed64 = 70 [default = -50];
+  inline bool has_default_sfixed64() const;
+  inline void clear_default_sfixed64();
+  static const int kDefaultSfixed64FieldNumber = 70;
+  inline ::google::protobuf::int64 default_sfixed64() const;
+  inline void set_default_sfixed64(::google::protobuf::int64 value);
+  
+  // optional float default_float = 71 [default = 51.5];
+  inline bool has_default_float() const;
+  inline void clear_default_float();
+  static const int kDefaultFloatFieldNumber = 71;
+  inline float default_float() const;
+  inline void set_default_float(float value);
+  
+  // optional double default_double = 72 [default = 52000];
+  inline bool has_default_double() const;
+  inline void clear_default_double();
+  static const int kDefaultDoubleFieldNumber = 72;
+  inline double default_double() const;
+  inline void set_default_double(double value);
+  
+  // optional bool default_bool = 73 [default = true];
+  inline bool has_default_bool() const;
+  inline void clear_default_bool();
+  static const int kDefaultBoolFieldNumber = 73;
+  inline bool default_bool() const;
+  inline void set_default_bool(bool value);
+  
+  // optional string default_string = 74 [default = "hello"];
+  inline bool has_default_string() const;
+  inline void clear_default_string();
+  static const int kDefaultStringFieldNumber = 74;
+  inline const ::std::string& default_string() const;
+  inline void set_default_string(const ::std::string& value);
+  inline void set_default_string(const char* value);
+  inline void set_default_string(const char* value, size_t size);
+  inline ::std::string* mutable_default_string();
+  
+  // optional bytes default_bytes = 75 [default = "world"];
+  inline bool has_default_bytes() const;
+  inline void clear_default_bytes();
+  static const int kDefaultBytesFieldNumber = 75;
+  inline const ::std::string& default_bytes() const;
+  inline void set_default_bytes(const ::std::string& value);
+  inline void set_default_bytes(const char* value);
+  inline void set_default_bytes(const void* value, size_t size);
+  inline ::std::string* mutable_default_bytes();
+  
+  // optional .protobuf_unittest.TestTableDrivenAllTypesLite.NestedEnum default_nested_enum = 81 [default = BAR];
+  inline bool has_default_nested_enum() const;
+  inline void clear_default_nested_enum();
+  static const int kDefaultNestedEnumFieldNumber = 81;
+  inline ::protobuf_unittest::TestTableDrivenAllTypesLite_NestedEnum default_nested_enum() const;
+  inline void set_default_nested_enum(::protobuf_unittest::TestTableDrivenAllTypesLite_NestedEnum value);
+  
+  // optional .protobuf_unittest.ForeignEnumLite default_foreign_enum = 82 [default = FOREIGN_LITE_BAR];
+  inline bool has_default_foreign_enum() const;
+  inline void clear_default_foreign_enum();
+  static const int kDefaultForeignEnumFieldNumber = 82;
+  inline protobuf_unittest::ForeignEnumLite default_foreign_enum() const;
+  inline void set_default_foreign_enum(protobuf_unittest::ForeignEnumLite value);
+  
+  // optional .protobuf_unittest_import.ImportEnumLite default_import_enum = 83 [default = IMPORT_LITE_BAR];
+  inline bool has_default_import_enum() const;
+  inline void clear_default_import_enum();
+  static const int kDefaultImportEnumFieldNumber = 83;
+  inline protobuf_unittest_import::ImportEnumLite default_import_enum() const;
+  inline void set_default_import_enum(protobuf_unittest_import::ImportEnumLite value);
+  
+  // optional string default_string_piece = 84 [default = "abc", ctype = STRING_PIECE];
+  inline bool has_default_string_piece() const;
+  inline void clear_default_string_piece();
+  static const int kDefaultStringPieceFieldNumber = 84;
+  inline const ::google::protobuf::internal::StringPieceField& default_string_piece() const;
+  inline void set_default_string_piece(const ::std::string& value);
+  inline void set_default_string_piece(const char* value);
+  inline void set_default_string_piece(const char* value, size_t size);
+  inline ::std::string* mutable_default_string_piece();
+  
+  // optional string default_cord = 85 [default = "123", ctype = CORD];
+  inline bool has_default_cord() const;
+  inline void clear_default_cord();
+  static const int kDefaultCordFieldNumber = 85;
+ private:
+  // Hidden due to unknown ctype option.
+  inline const ::std::string& default_cord() const;
+  inline void set_default_cord(const ::std::string& value);
+  inline void set_default_cord(const char* value);
+  inline void set_default_cord(const char* value, size_t size);
+  inline ::std::string* mutable_default_cord();
+ public:
+  
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestTableDrivenAllTypesLite)
+ private:
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
+  
+  ::google::protobuf::int32 optional_int32_;
+  ::google::protobuf::int64 optional_int64_;
+  ::google::protobuf::uint32 optional_uint32_;
+  ::google::protobuf::uint64 optional_uint64_;
+  ::google::protobuf::int32 optional_sint32_;
+  ::google::protobuf::int64 optional_sint64_;
+  ::google::protobuf::uint32 optional_fixed32_;
+  ::google::protobuf::uint64 optional_fixed64_;
+  ::google::protobuf::int32 optional_sfixed32_;
+  ::google::protobuf::int64 optional_sfixed64_;
+  float optional_float_;
+  double optional_double_;
+  bool optional_bool_;
+  ::std::string* optional_string_;
+  static const ::std::string _default_optional_string_;
+  ::std::string* optional_bytes_;
+  static const ::std::string _default_optional_bytes_;
+  ::protobuf_unittest::TestTableDrivenAllTypesLite_OptionalGroup* optionalgroup_;
+  ::protobuf_unittest::TestTableDrivenAllTypesLite_NestedMessage* optional_nested_message_;
+  ::protobuf_unittest::ForeignMessageLite* optional_foreign_message_;
+  ::protobuf_unittest_import::ImportMessageLite* optional_import_message_;
+  int optional_nested_enum_;
+  int optional_foreign_enum_;
+  int optional_import_enum_;
+  ::google::protobuf::internal::StringPieceField optional_string_piece_;
+  ::std::string* optional_cord_;
+  static const ::std::string _default_optional_cord_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int32 > repeated_int32_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int64 > repeated_int64_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 > repeated_uint32_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint64 > repeated_uint64_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int32 > repeated_sint32_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int64 > repeated_sint64_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 > repeated_fixed32_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint64 > repeated_fixed64_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int32 > repeated_sfixed32_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int64 > repeated_sfixed64_;
+  ::google::protobuf::RepeatedField< float > repeated_float_;
+  ::google::protobuf::RepeatedField< double > repeated_double_;
+  ::google::protobuf::RepeatedField< bool > repeated_bool_;
+  ::google::protobuf::RepeatedPtrField< ::std::string> repeated_string_;
+  ::google::protobuf::RepeatedPtrField< ::std::string> repeated_bytes_;
+  ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestTableDrivenAllTypesLite_RepeatedGroup > repeatedgroup_;
+  ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestTableDrivenAllTypesLite_NestedMessage > repeated_nested_message_;
+  ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::ForeignMessageLite > repeated_foreign_message_;
+  ::google::protobuf::RepeatedPtrField< ::protobuf_unittest_import::ImportMessageLite > repeated_import_message_;
+  ::google::protobuf::RepeatedField<int> repeated_nested_enum_;
+  ::google::protobuf::RepeatedField<int> repeated_foreign_enum_;
+  ::google::protobuf::RepeatedField<int> repeated_import_enum_;
+  ::google::protobuf::RepeatedPtrField< ::google::protobuf::internal::StringPieceField> repeated_string_piece_;
+  ::google::protobuf::RepeatedPtrField< ::std::string> repeated_cord_;
+  ::google::protobuf::int32 default_int32_;
+  ::google::protobuf::int64 default_int64_;
+  ::google::protobuf::uint32 default_uint32_;
+  ::google::protobuf::uint64 default_uint64_;
+  ::google::protobuf::int32 default_sint32_;
+  ::google::protobuf::int64 default_sint64_;
+  ::google::protobuf::uint32 default_fixed32_;
+  ::google::protobuf::uint64 default_fixed64_;
+  ::google::protobuf::int32 default_sfixed32_;
+  ::google::protobuf::int64 default_sfixed64_;
+  float default_float_;
+  double default_double_;
+  bool default_bool_;
+  ::std::string* default_string_;
+  static const ::std::string _default_default_string_;
+  ::std::string* default_bytes_;
+  static const ::std::string _default_default_bytes_;
+  int default_nested_enum_;
+  int default_foreign_enum_;
+  int default_import_enum_;
+  ::google::protobuf::internal::StringPieceField default_string_piece_;
+  ::std::string* default_cord_;
+  static const ::std::string _default_default_cord_;
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto_impl();
+  friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto();
+  friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto();
+  
+  ::google::protobuf::uint32 _has_bits_[(68 + 31) / 32];
+  
+  // WHY DOES & HAVE LOWER PRECEDENCE THAN != !?
+  inline bool _has_bit(int index) const {
+    return (_has_bits_[index / 32] & (1u << (index % 32))) != 0;
+  }
+  inline void _set_bit(int index) {
+    _has_bits_[index / 32] |= (1u << (index % 32));
+  }
+  inline void _clear_bit(int index) {
+    _has_bits_[index / 32] &= ~(1u << (index % 32));
+  }
+  
+  void InitAsDefaultInstance();
+  static TestTableDrivenAllTypesLite* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class TestTableDrivenSparseLite : public ::google::protobuf::MessageLite {
+ public:
+  TestTableDrivenSparseLite();
+  virtual ~TestTableDrivenSparseLite();
+  
+  TestTableDrivenSparseLite(const TestTableDrivenSparseLite& from);
+  
+  inline TestTableDrivenSparseLite& operator=(const TestTableDrivenSparseLite& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  
+  static const TestTableDrivenSparseLite& default_instance();
+  
+  // Like default_instance(), but does not make sure that the default
+  // instance has been constructed.  Only for generated code which has.
+  static inline const TestTableDrivenSparseLite* internal_default_instance() {
+    return default_instance_;
+  }
+  
+  void Swap(TestTableDrivenSparseLite* other);
+  
+  // implements Message ----------------------------------------------
+  
+  TestTableDrivenSparseLite* New() const;
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from);
+  void CopyFrom(const TestTableDrivenSparseLite& from);
+  void MergeFrom(const TestTableDrivenSparseLite& from);
+  void Clear();
+  bool IsInitialized() const;
+  
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  int GetCachedSize() const {
+    return ::google::protobuf::internal::NoBarrier_Load(&_cached_size_);
+  }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+  
+  ::std::string GetTypeName() const;
+  
+  // nested types ----------------------------------------------------
+  
+  // accessors -------------------------------------------------------
+  
+  // optional int32 optional_int32 = 1;
+  inline bool has_optional_int32() const;
+  inline void clear_optional_int32();
+  static const int kOptionalInt32FieldNumber = 1;
+  inline ::google::protobuf::int32 optional_int32() const;
+  inline void set_optional_int32(::google::protobuf::int32 value);
+  
+  // repeated int32 repeated_int32 = 31;
+  inline int repeated_int32_size() const;
+  inline void clear_repeated_int32();
+  static const int kRepeatedInt32FieldNumber = 31;
+  inline ::google::protobuf::int32 repeated_int32(int index) const;
+  inline void set_repeated_int32(int index, ::google::protobuf::int32 value);
+  inline void add_repeated_int32(::google::protobuf::int32 value);
+  inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+      repeated_int32() const;
+  inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+      mutable_repeated_int32();
+  
+  GOOGLE_PROTOBUF_EXTENSION_ACCESSORS(TestTableDrivenSparseLite)
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestTableDrivenSparseLite)
+ private:
+  ::google::protobuf::internal::ExtensionSet _extensions_;
+  mutable ::google::protobuf::internal::Atomic32 _cached_size_;
+  
+  ::google::protobuf::int32 optional_int32_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int32 > repeated_int32_;
+  friend void protobuf_InitDefaults_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto_impl();
+  friend void protobuf_AssignDesc_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto();
+  friend void protobuf_ShutdownFile_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto();
+  
+  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
+  
+  // WHY DOES & HAVE LOWER PRECEDENCE THAN != !?
+  inline bool _has_bit(int index) const {
+    return (_has_bits_[index / 32] & (1u << (index % 32))) != 0;
+  }
+  inline void _set_bit(int index) {
+    _has_bits_[index / 32] |= (1u << (index % 32));
+  }
+  inline void _clear_bit(int index) {
+    _has_bits_[index / 32] &= ~(1u << (index % 32));
+  }
+  
+  void InitAsDefaultInstance();
+  static TestTableDrivenSparseLite* default_instance_;
+};
+// ===================================================================
+
+static const int kSparseInt32ExtensionLiteFieldNumber = 1000;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestTableDrivenSparseLite,
+    ::google::protobuf::internal::PrimitiveTypeTraits< ::google::protobuf::int32 >, 5, false >
+  sparse_int32_extension_lite;
+static const int kSparseStringExtensionLiteFieldNumber = 1001;
+extern ::google::protobuf::internal::ExtensionIdentifier< ::protobuf_unittest::TestTableDrivenSparseLite,
+    ::google::protobuf::internal::RepeatedStringTypeTraits, 9, false >
+  sparse_string_extension_lite;
+
+// ===================================================================
+
+// TestTableDrivenAllTypesLite_NestedMessage
+
+// optional int32 bb = 1;
+inline bool TestTableDrivenAllTypesLite_NestedMessage::has_bb() const {
+  return _has_bit(0);
+}
+inline void TestTableDrivenAllTypesLite_NestedMessage::clear_bb() {
+  bb_ = 0;
+  _clear_bit(0);
+}
+inline ::google::protobuf::int32 TestTableDrivenAllTypesLite_NestedMessage::bb() const {
+  return bb_;
+}
+inline void TestTableDrivenAllTypesLite_NestedMessage::set_bb(::google::protobuf::int32 value) {
+  _set_bit(0);
+  bb_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// TestTableDrivenAllTypesLite_OptionalGroup
+
+// optional int32 a = 17;
+inline bool TestTableDrivenAllTypesLite_OptionalGroup::has_a() const {
+  return _has_bit(0);
+}
+inline void TestTableDrivenAllTypesLite_OptionalGroup::clear_a() {
+  a_ = 0;
+  _clear_bit(0);
+}
+inline ::google::protobuf::int32 TestTableDrivenAllTypesLite_OptionalGroup::a() const {
+  return a_;
+}
+inline void TestTableDrivenAllTypesLite_OptionalGroup::set_a(::google::protobuf::int32 value) {
+  _set_bit(0);
+  a_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// TestTableDrivenAllTypesLite_RepeatedGroup
+
+// optional int32 a = 47;
+inline bool TestTableDrivenAllTypesLite_RepeatedGroup::has_a() const {
+  return _has_bit(0);
+}
+inline void TestTableDrivenAllTypesLite_RepeatedGroup::clear_a() {
+  a_ = 0;
+  _clear_bit(0);
+}
+inline ::google::protobuf::int32 TestTableDrivenAllTypesLite_RepeatedGroup::a() const {
+  return a_;
+}
+inline void TestTableDrivenAllTypesLite_RepeatedGroup::set_a(::google::protobuf::int32 value) {
+  _set_bit(0);
+  a_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// TestTableDrivenAllTypesLite
+
+// optional int32 optional_int32 = 1;
+inline bool TestTableDrivenAllTypesLite::has_optional_int32() const {
+  return _has_bit(0);
+}
+inline void TestTableDrivenAllTypesLite::clear_optional_int32() {
+  optional_int32_ = 0;
+  _clear_bit(0);
+}
+inline ::google::protobuf::int32 TestTableDrivenAllTypesLite::optional_int32() const {
+  return optional_int32_;
+}
+inline void TestTableDrivenAllTypesLite::set_optional_int32(::google::protobuf::int32 value) {
+  _set_bit(0);
+  optional_int32_ = value;
+}
+
+// optional int64 optional_int64 = 2;
+inline bool TestTableDrivenAllTypesLite::has_optional_int64() const {
+  return _has_bit(1);
+}
+inline void TestTableDrivenAllTypesLite::clear_optional_int64() {
+  optional_int64_ = GOOGLE_LONGLONG(0);
+  _clear_bit(1);
+}
+inline ::google::protobuf::int64 TestTableDrivenAllTypesLite::optional_int64() const {
+  return optional_int64_;
+}
+inline void TestTableDrivenAllTypesLite::set_optional_int64(::google::protobuf::int64 value) {
+  _set_bit(1);
+  optional_int64_ = value;
+}
+
+// optional uint32 optional_uint32 = 3;
+inline bool TestTableDrivenAllTypesLite::has_optional_uint32() const {
+  return _has_bit(2);
+}
+inline void TestTableDrivenAllTypesLite::clear_optional_uint32() {
+  optional_uint32_ = 0u;
+  _clear_bit(2);
+}
+inline ::google::protobuf::uint32 TestTableDrivenAllTypesLite::optional_uint32() const {
+  return optional_uint32_;
+}
+inline void TestTableDrivenAllTypesLite::set_optional_uint32(::google::protobuf::uint32 value) {
+  _set_bit(2);
+  optional_uint32_ = value;
+}
+
+// optional uint64 optional_uint64 = 4;
+inline bool TestTableDrivenAllTypesLite::has_optional_uint64() const {
+  return _has_bit(3);
+}
+inline void TestTableDrivenAllTypesLite::clear_optional_uint64() {
+  optional_uint64_ = GOOGLE_ULONGLONG(0);
+  _clear_bit(3);
+}
+inline ::google::protobuf::uint64 TestTableDrivenAllTypesLite::optional_uint64() const {
+  return optional_uint64_;
+}
+inline void TestTableDrivenAllTypesLite::set_optional_uint64(::google::protobuf::uint64 value) {
+  _set_bit(3);
+  optional_uint64_ = value;
+}
+
+// optional sint32 optional_sint32 = 5;
+inline bool TestTableDrivenAllTypesLite::has_optional_sint32() const {
+  return _has_bit(4);
+}
+inline void TestTableDrivenAllTypesLite::clear_optional_sint32() {
+  optional_sint32_ = 0;
+  _clear_bit(4);
+}
+inline ::google::protobuf::int32 TestTableDrivenAllTypesLite::optional_sint32() const {
+  return optional_sint32_;
+}
+inline void TestTableDrivenAllTypesLite::set_optional_sint32(::google::protobuf::int32 value) {
+  _set_bit(4);
+  optional_sint32_ = value;
+}
+
+// optional sint64 optional_sint64 = 6;
+inline bool TestTableDrivenAllTypesLite::has_optional_sint64() const {
+  return _has_bit(5);
+}
+inline void TestTableDrivenAllTypesLite::clear_optional_sint64() {
+  optional_sint64_ = GOOGLE_LONGLONG(0);
+  _clear_bit(5);
+}
+inline ::google::protobuf::int64 TestTableDrivenAllTypesLite::optional_sint64() const {
+  return optional_sint64_;
+}
+inline void TestTableDrivenAllTypesLite::set_optional_sint64(::google::protobuf::int64 value) {
+  _set_bit(5);
+  optional_sint64_ = value;
+}
+
+// optional fixed32 optional_fixed32 = 7;
+inline bool TestTableDrivenAllTypesLite::has_optional_fixed32() const {
+  return _has_bit(6);
+}
+inline void TestTableDrivenAllTypesLite::clear_optional_fixed32() {
+  optional_fixed32_ = 0u;
+  _clear_bit(6);
+}
+inline ::google::protobuf::uint32 TestTableDrivenAllTypesLite::optional_fixed32() const {
+  return optional_fixed32_;
+}
+inline void TestTableDrivenAllTypesLite::set_optional_fixed32(::google::protobuf::uint32 value) {
+  _set_bit(6);
+  optional_fixed32_ = value;
+}
+
+// optional fixed64 optional_fixed64 = 8;
+inline bool TestTableDrivenAllTypesLite::has_optional_fixed64() const {
+  return _has_bit(7);
+}
+inline void TestTableDrivenAllTypesLite::clear_optional_fixed64() {
+  optional_fixed64_ = GOOGLE_ULONGLONG(0);
+  _clear_bit(7);
+}
+inline ::google::protobuf::uint64 TestTableDrivenAllTypesLite::optional_fixed64() const {
+  return optional_fixed64_;
+}
+inline void TestTableDrivenAllTypesLite::set_optional_fixed64(::google::protobuf::uint64 value) {
+  _set_bit(7);
+  optional_fixed64_ = value;
+}
+
+// optional sfixed32 optional_sfixed32 = 9;
+inline bool TestTableDrivenAllTypesLite::has_optional_sfixed32() const {
+  return _has_bit(8);
+}
+inline void TestTableDrivenAllTypesLite::clear_optional_sfixed32() {
+  optional_sfixed32_ = 0;
+  _clear_bit(8);
+}
+inline ::google::protobuf::int32 TestTableDrivenAllTypesLite::optional_sfixed32() const {
+  return optional_sfixed32_;
+}
+inline void TestTableDrivenAllTypesLite::set_optional_sfixed32(::google::protobuf::int32 value) {
+  _set_bit(8);
+  optional_sfixed32_ = value;
+}
+
+// optional sfixed64 optional_sfixed64 = 10;
+inline bool TestTableDrivenAllTypesLite::has_optional_sfixed64() const {
+  return _has_bit(9);
+}
+inline void TestTableDrivenAllTypesLite::clear_optional_sfixed64() {
+  optional_sfixed64_ = GOOGLE_LONGLONG(0);
+  _clear_bit(9);
+}
+inline ::google::protobuf::int64 TestTableDrivenAllTypesLite::optional_sfixed64() const {
+  return optional_sfixed64_;
+}
+inline void TestTableDrivenAllTypesLite::set_optional_sfixed64(::google::protobuf::int64 value) {
+  _set_bit(9);
+  optional_sfixed64_ = value;
+}
+
+// optional float optional_float = 11;
+inline bool TestTableDrivenAllTypesLite::has_optional_float() const {
+  return _has_bit(10);
+}
+inline void TestTableDrivenAllTypesLite::clear_optional_float() {
+  optional_float_ = 0;
+  _clear_bit(10);
+}
+inline float TestTableDrivenAllTypesLite::optional_float() const {
+  return optional_float_;
+}
+inline void TestTableDrivenAllTypesLite::set_optional_float(float value) {
+  _set_bit(10);
+  optional_float_ = value;
+}
+
+// optional double optional_double = 12;
+inline bool TestTableDrivenAllTypesLite::has_optional_double() const {
+  return _has_bit(11);
+}
+inline void TestTableDrivenAllTypesLite::clear_optional_double() {
+  optional_double_ = 0;
+  _clear_bit(11);
+}
+inline double TestTableDrivenAllTypesLite::optional_double() const {
+  return optional_double_;
+}
+inline void TestTableDrivenAllTypesLite::set_optional_double(double value) {
+  _set_bit(11);
+  optional_double_ = value;
+}
+
+// optional bool optional_bool = 13;
+inline bool TestTableDrivenAllTypesLite::has_optional_bool() const {
+  return _has_bit(12);
+}
+inline void TestTableDrivenAllTypesLite::clear_optional_bool() {
+  optional_bool_ = false;
+  _clear_bit(12);
+}
+inline bool TestTableDrivenAllTypesLite::optional_bool() const {
+  return optional_bool_;
+}
+inline void TestTableDrivenAllTypesLite::set_optional_bool(bool value) {
+  _set_bit(12);
+  optional_bool_ = value;
+}
+
+// optional string optional_string = 14;
+inline bool TestTableDrivenAllTypesLite::has_optional_string() const {
+  return _has_bit(13);
+}
+inline void TestTableDrivenAllTypesLite::clear_optional_string() {
+  if (optional_string_ != &_default_optional_string_) {
+    optional_string_->clear();
+  }
+  _clear_bit(13);
+}
+inline const ::std::string& TestTableDrivenAllTypesLite::optional_string() const {
+  return *optional_string_;
+}
+inline void TestTableDrivenAllTypesLite::set_optional_string(const ::std::string& value) {
+  _set_bit(13);
+  if (optional_string_ == &_default_optional_string_) {
+    optional_string_ = new ::std::string;
+  }
+  optional_string_->assign(value);
+}
+inline void TestTableDrivenAllTypesLite::set_optional_string(const char* value) {
+  _set_bit(13);
+  if (optional_string_ == &_default_optional_string_) {
+    optional_string_ = new ::std::string;
+  }
+  optional_string_->assign(value);
+}
+inline void TestTableDrivenAllTypesLite::set_optional_string(const char* value, size_t size) {
+  _set_bit(13);
+  if (optional_string_ == &_default_optional_string_) {
+    optional_string_ = new ::std::string;
+  }
+  optional_string_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* TestTableDrivenAllTypesLite::mutable_optional_string() {
+  _set_bit(13);
+  if (optional_string_ == &_default_optional_string_) {
+    optional_string_ = new ::std::string;
+  }
+  return optional_string_;
+}
+
+// optional bytes optional_bytes = 15;
+inline bool TestTableDrivenAllTypesLite::has_optional_bytes() const {
+  return _has_bit(14);
+}
+inline void TestTableDrivenAllTypesLite::clear_optional_bytes() {
+  if (optional_bytes_ != &_default_optional_bytes_) {
+    optional_bytes_->clear();
+  }
+  _clear_bit(14);
+}
+inline const ::std::string& TestTableDrivenAllTypesLite::optional_bytes() const {
+  return *optional_bytes_;
+}
+inline void TestTableDrivenAllTypesLite::set_optional_bytes(const ::std::string& value) {
+  _set_bit(14);
+  if (optional_bytes_ == &_default_optional_bytes_) {
+    optional_bytes_ = new ::std::string;
+  }
+  optional_bytes_->assign(value);
+}
+inline void TestTableDrivenAllTypesLite::set_optional_bytes(const char* value) {
+  _set_bit(14);
+  if (optional_bytes_ == &_default_optional_bytes_) {
+    optional_bytes_ = new ::std::string;
+  }
+  optional_bytes_->assign(value);
+}
+inline void TestTableDrivenAllTypesLite::set_optional_bytes(const void* value, size_t size) {
+  _set_bit(14);
+  if (optional_bytes_ == &_default_optional_bytes_) {
+    optional_bytes_ = new ::std::string;
+  }
+  optional_bytes_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* TestTableDrivenAllTypesLite::mutable_optional_bytes() {
+  _set_bit(14);
+  if (optional_bytes_ == &_default_optional_bytes_) {
+    optional_bytes_ = new ::std::string;
+  }
+  return optional_bytes_;
+}
+
+// optional group OptionalGroup = 16 {
+inline bool TestTableDrivenAllTypesLite::has_optionalgroup() const {
+  return _has_bit(15);
+}
+inline void TestTableDrivenAllTypesLite::clear_optionalgroup() {
+  if (optionalgroup_ != NULL) optionalgroup_->::protobuf_unittest::TestTableDrivenAllTypesLite_OptionalGroup::Clear();
+  _clear_bit(15);
+}
+inline const ::protobuf_unittest::TestTableDrivenAllTypesLite_OptionalGroup& TestTableDrivenAllTypesLite::optionalgroup() const {
+  return optionalgroup_ != NULL ? *optionalgroup_ : ::protobuf_unittest::TestTableDrivenAllTypesLite_OptionalGroup::default_instance();
+}
+inline ::protobuf_unittest::TestTableDrivenAllTypesLite_OptionalGroup* TestTableDrivenAllTypesLite::mutable_optionalgroup() {
+  _set_bit(15);
+  if (optionalgroup_ == NULL) optionalgroup_ = new ::protobuf_unittest::TestTableDrivenAllTypesLite_OptionalGroup;
+  return optionalgroup_;
+}
+
+// optional .protobuf_unittest.TestTableDrivenAllTypesLite.NestedMessage optional_nested_message = 18;
+inline bool TestTableDrivenAllTypesLite::has_optional_nested_message() const {
+  return _has_bit(16);
+}
+inline void TestTableDrivenAllTypesLite::clear_optional_nested_message() {
+  if (optional_nested_message_ != NULL) optional_nested_message_->::protobuf_unittest::TestTableDrivenAllTypesLite_NestedMessage::Clear();
+  _clear_bit(16);
+}
+inline const ::protobuf_unittest::TestTableDrivenAllTypesLite_NestedMessage& TestTableDrivenAllTypesLite::optional_nested_message() const {
+  return optional_nested_message_ != NULL ? *optional_nested_message_ : ::protobuf_unittest::TestTableDrivenAllTypesLite_NestedMessage::default_instance();
+}
+inline ::protobuf_unittest::TestTableDrivenAllTypesLite_NestedMessage* TestTableDrivenAllTypesLite::mutable_optional_nested_message() {
+  _set_bit(16);
+  if (optional_nested_message_ == NULL) optional_nested_message_ = new ::protobuf_unittest::TestTableDrivenAllTypesLite_NestedMessage;
+  return optional_nested_message_;
+}
+
+// optional .protobuf_unittest.ForeignMessageLite optional_foreign_message = 19;
+inline bool TestTableDrivenAllTypesLite::has_optional_foreign_message() const {
+  return _has_bit(17);
+}
+inline void TestTableDrivenAllTypesLite::clear_optional_foreign_message() {
+  if (optional_foreign_message_ != NULL) optional_foreign_message_->::protobuf_unittest::ForeignMessageLite::Clear();
+  _clear_bit(17);
+}
+inline const ::protobuf_unittest::ForeignMessageLite& TestTableDrivenAllTypesLite::optional_foreign_message() const {
+  return optional_foreign_message_ != NULL ? *optional_foreign_message_ : ::protobuf_unittest::ForeignMessageLite::default_instance();
+}
+inline ::protobuf_unittest::ForeignMessageLite* TestTableDrivenAllTypesLite::mutable_optional_foreign_message() {
+  _set_bit(17);
+  if (optional_foreign_message_ == NULL) optional_foreign_message_ = new ::protobuf_unittest::ForeignMessageLite;
+  return optional_foreign_message_;
+}
+
+// optional .protobuf_unittest_import.ImportMessageLite optional_import_message = 20;
+inline bool TestTableDrivenAllTypesLite::has_optional_import_message() const {
+  return _has_bit(18);
+}
+inline void TestTableDrivenAllTypesLite::clear_optional_import_message() {
+  if (optional_import_message_ != NULL) optional_import_message_->::protobuf_unittest_import::ImportMessageLite::Clear();
+  _clear_bit(18);
+}
+inline const ::protobuf_unittest_import::ImportMessageLite& TestTableDrivenAllTypesLite::optional_import_message() const {
+  return optional_import_message_ != NULL ? *optional_import_message_ : ::protobuf_unittest_import::ImportMessageLite::default_instance();
+}
+inline ::protobuf_unittest_import::ImportMessageLite* TestTableDrivenAllTypesLite::mutable_optional_import_message() {
+  _set_bit(18);
+  if (optional_import_message_ == NULL) optional_import_message_ = new ::protobuf_unittest_import::ImportMessageLite;
+  return optional_import_message_;
+}
+
+// optional .protobuf_unittest.TestTableDrivenAllTypesLite.NestedEnum optional_nested_enum = 21;
+inline bool TestTableDrivenAllTypesLite::has_optional_nested_enum() const {
+  return _has_bit(19);
+}
+inline void TestTableDrivenAllTypesLite::clear_optional_nested_enum() {
+  optional_nested_enum_ = 1;
+  _clear_bit(19);
+}
+inline ::protobuf_unittest::TestTableDrivenAllTypesLite_NestedEnum TestTableDrivenAllTypesLite::optional_nested_enum() const {
+  return static_cast< ::protobuf_unittest::TestTableDrivenAllTypesLite_NestedEnum >(optional_nested_enum_);
+}
+inline void TestTableDrivenAllTypesLite::set_optional_nested_enum(::protobuf_unittest::TestTableDrivenAllTypesLite_NestedEnum value) {
+  GOOGLE_DCHECK(::protobuf_unittest::TestTableDrivenAllTypesLite_NestedEnum_IsValid(value));
+  _set_bit(19);
+  optional_nested_enum_ = value;
+}
+
+// optional .protobuf_unittest.ForeignEnumLite optional_foreign_enum = 22;
+inline bool TestTableDrivenAllTypesLite::has_optional_foreign_enum() const {
+  return _has_bit(20);
+}
+inline void TestTableDrivenAllTypesLite::clear_optional_foreign_enum() {
+  optional_foreign_enum_ = 4;
+  _clear_bit(20);
+}
+inline protobuf_unittest::ForeignEnumLite TestTableDrivenAllTypesLite::optional_foreign_enum() const {
+  return static_cast< protobuf_unittest::ForeignEnumLite >(optional_foreign_enum_);
+}
+inline void TestTableDrivenAllTypesLite::set_optional_foreign_enum(protobuf_unittest::ForeignEnumLite value) {
+  GOOGLE_DCHECK(protobuf_unittest::ForeignEnumLite_IsValid(value));
+  _set_bit(20);
+  optional_foreign_enum_ = value;
+}
+
+// optional .protobuf_unittest_import.ImportEnumLite optional_import_enum = 23;
+inline bool TestTableDrivenAllTypesLite::has_optional_import_enum() const {
+  return _has_bit(21);
+}
+inline void TestTableDrivenAllTypesLite::clear_optional_import_enum() {
+  optional_import_enum_ = 7;
+  _clear_bit(21);
+}
+inline protobuf_unittest_import::ImportEnumLite TestTableDrivenAllTypesLite::optional_import_enum() const {
+  return static_cast< protobuf_unittest_import::ImportEnumLite >(optional_import_enum_);
+}
+inline void TestTableDrivenAllTypesLite::set_optional_import_enum(protobuf_unittest_import::ImportEnumLite value) {
+  GOOGLE_DCHECK(protobuf_unittest_import::ImportEnumLite_IsValid(value));
+  _set_bit(21);
+  optional_import_enum_ = value;
+}
+
+// optional string optional_string_piece = 24 [ctype = STRING_PIECE];
+inline bool TestTableDrivenAllTypesLite::has_optional_string_piece() const {
+  return _has_bit(22);
+}
+inline void TestTableDrivenAllTypesLite::clear_optional_string_piece() {
+  optional_string_piece_.Clear();
+  _clear_bit(22);
+}
+inline const ::google::protobuf::internal::StringPieceField& TestTableDrivenAllTypesLite::optional_string_piece() const {
+  return optional_string_piece_;
+}
+inline void TestTableDrivenAllTypesLite::set_optional_string_piece(const ::std::string& value) {
+  _set_bit(22);
+  optional_string_piece_.CopyFrom(value.data(), value.size());
+}
+inline void TestTableDrivenAllTypesLite::set_optional_string_piece(const char* value) {
+  _set_bit(22);
+  optional_string_piece_.CopyFrom(value, strlen(value));
+}
+inline void TestTableDrivenAllTypesLite::set_optional_string_piece(const char* value, size_t size) {
+  _set_bit(22);
+  optional_string_piece_.CopyFrom(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* TestTableDrivenAllTypesLite::mutable_optional_string_piece() {
+  _set_bit(22);
+  return optional_string_piece_.Mutable();
+}
+
+// optional string optional_cord = 25 [ctype = CORD];
+inline bool TestTableDrivenAllTypesLite::has_optional_cord() const {
+  return _has_bit(23);
+}
+inline void TestTableDrivenAllTypesLite::clear_optional_cord() {
+  if (optional_cord_ != &_default_optional_cord_) {
+    optional_cord_->clear();
+  }
+  _clear_bit(23);
+}
+inline const ::std::string& TestTableDrivenAllTypesLite::optional_cord() const {
+  return *optional_cord_;
+}
+inline void TestTableDrivenAllTypesLite::set_optional_cord(const ::std::string& value) {
+  _set_bit(23);
+  if (optional_cord_ == &_default_optional_cord_) {
+    optional_cord_ = new ::std::string;
+  }
+  optional_cord_->assign(value);
+}
+inline void TestTableDrivenAllTypesLite::set_optional_cord(const char* value) {
+  _set_bit(23);
+  if (optional_cord_ == &_default_optional_cord_) {
+    optional_cord_ = new ::std::string;
+  }
+  optional_cord_->assign(value);
+}
+inline void TestTableDrivenAllTypesLite::set_optional_cord(const char* value, size_t size) {
+  _set_bit(23);
+  if (optional_cord_ == &_default_optional_cord_) {
+    optional_cord_ = new ::std::string;
+  }
+  optional_cord_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* TestTableDrivenAllTypesLite::mutable_optional_cord() {
+  _set_bit(23);
+  if (optional_cord_ == &_default_optional_cord_) {
+    optional_cord_ = new ::std::string;
+  }
+  return optional_cord_;
+}
+
+// repeated int32 repeated_int32 = 31;
+inline int TestTableDrivenAllTypesLite::repeated_int32_size() const {
+  return repeated_int32_.size();
+}
+inline void TestTableDrivenAllTypesLite::clear_repeated_int32() {
+  repeated_int32_.Clear();
+}
+inline ::google::protobuf::int32 TestTableDrivenAllTypesLite::repeated_int32(int index) const {
+  return repeated_int32_.Get(index);
+}
+inline void TestTableDrivenAllTypesLite::set_repeated_int32(int index, ::google::protobuf::int32 value) {
+  repeated_int32_.Set(index, value);
+}
+inline void TestTableDrivenAllTypesLite::add_repeated_int32(::google::protobuf::int32 value) {
+  repeated_int32_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+TestTableDrivenAllTypesLite::repeated_int32() const {
+  return repeated_int32_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+TestTableDrivenAllTypesLite::mutable_repeated_int32() {
+  return &repeated_int32_;
+}
+
+// repeated int64 repeated_int64 = 32;
+inline int TestTableDrivenAllTypesLite::repeated_int64_size() const {
+  return repeated_int64_.size();
+}
+inline void TestTableDrivenAllTypesLite::clear_repeated_int64() {
+  repeated_int64_.Clear();
+}
+inline ::google::protobuf::int64 TestTableDrivenAllTypesLite::repeated_int64(int index) const {
+  return repeated_int64_.Get(index);
+}
+inline void TestTableDrivenAllTypesLite::set_repeated_int64(int index, ::google::protobuf::int64 value) {
+  repeated_int64_.Set(index, value);
+}
+inline void TestTableDrivenAllTypesLite::add_repeated_int64(::google::protobuf::int64 value) {
+  repeated_int64_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
+TestTableDrivenAllTypesLite::repeated_int64() const {
+  return repeated_int64_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
+TestTableDrivenAllTypesLite::mutable_repeated_int64() {
+  return &repeated_int64_;
+}
+
+// repeated uint32 repeated_uint32 = 33;
+inline int TestTableDrivenAllTypesLite::repeated_uint32_size() const {
+  return repeated_uint32_.size();
+}
+inline void TestTableDrivenAllTypesLite::clear_repeated_uint32() {
+  repeated_uint32_.Clear();
+}
+inline ::google::protobuf::uint32 TestTableDrivenAllTypesLite::repeated_uint32(int index) const {
+  return repeated_uint32_.Get(index);
+}
+inline void TestTableDrivenAllTypesLite::set_repeated_uint32(int index, ::google::protobuf::uint32 value) {
+  repeated_uint32_.Set(index, value);
+}
+inline void TestTableDrivenAllTypesLite::add_repeated_uint32(::google::protobuf::uint32 value) {
+  repeated_uint32_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+TestTableDrivenAllTypesLite::repeated_uint32() const {
+  return repeated_uint32_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+TestTableDrivenAllTypesLite::mutable_repeated_uint32() {
+  return &repeated_uint32_;
+}
+
+// repeated uint64 repeated_uint64 = 34;
+inline int TestTableDrivenAllTypesLite::repeated_uint64_size() const {
+  return repeated_uint64_.size();
+}
+inline void TestTableDrivenAllTypesLite::clear_repeated_uint64() {
+  repeated_uint64_.Clear();
+}
+inline ::google::protobuf::uint64 TestTableDrivenAllTypesLite::repeated_uint64(int index) const {
+  return repeated_uint64_.Get(index);
+}
+inline void TestTableDrivenAllTypesLite::set_repeated_uint64(int index, ::google::protobuf::uint64 value) {
+  repeated_uint64_.Set(index, value);
+}
+inline void TestTableDrivenAllTypesLite::add_repeated_uint64(::google::protobuf::uint64 value) {
+  repeated_uint64_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
+TestTableDrivenAllTypesLite::repeated_uint64() const {
+  return repeated_uint64_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
+TestTableDrivenAllTypesLite::mutable_repeated_uint64() {
+  return &repeated_uint64_;
+}
+
+// repeated sint32 repeated_sint32 = 35;
+inline int TestTableDrivenAllTypesLite::repeated_sint32_size() const {
+  return repeated_sint32_.size();
+}
+inline void TestTableDrivenAllTypesLite::clear_repeated_sint32() {
+  repeated_sint32_.Clear();
+}
+inline ::google::protobuf::int32 TestTableDrivenAllTypesLite::repeated_sint32(int index) const {
+  return repeated_sint32_.Get(index);
+}
+inline void TestTableDrivenAllTypesLite::set_repeated_sint32(int index, ::google::protobuf::int32 value) {
+  repeated_sint32_.Set(index, value);
+}
+inline void TestTableDrivenAllTypesLite::add_repeated_sint32(::google::protobuf::int32 value) {
+  repeated_sint32_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+TestTableDrivenAllTypesLite::repeated_sint32() const {
+  return repeated_sint32_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+TestTableDrivenAllTypesLite::mutable_repeated_sint32() {
+  return &repeated_sint32_;
+}
+
+// repeated sint64 repeated_sint64 = 36;
+inline int TestTableDrivenAllTypesLite::repeated_sint64_size() const {
+  return repeated_sint64_.size();
+}
+inline void TestTableDrivenAllTypesLite::clear_repeated_sint64() {
+  repeated_sint64_.Clear();
+}
+inline ::google::protobuf::int64 TestTableDrivenAllTypesLite::repeated_sint64(int index) const {
+  return repeated_sint64_.Get(index);
+}
+inline void TestTableDrivenAllTypesLite::set_repeated_sint64(int index, ::google::protobuf::int64 value) {
+  repeated_sint64_.Set(index, value);
+}
+inline void TestTableDrivenAllTypesLite::add_repeated_sint64(::google::protobuf::int64 value) {
+  repeated_sint64_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
+TestTableDrivenAllTypesLite::repeated_sint64() const {
+  return repeated_sint64_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
+TestTableDrivenAllTypesLite::mutable_repeated_sint64() {
+  return &repeated_sint64_;
+}
+
+// repeated fixed32 repeated_fixed32 = 37;
+inline int TestTableDrivenAllTypesLite::repeated_fixed32_size() const {
+  return repeated_fixed32_.size();
+}
+inline void TestTableDrivenAllTypesLite::clear_repeated_fixed32() {
+  repeated_fixed32_.Clear();
+}
+inline ::google::protobuf::uint32 TestTableDrivenAllTypesLite::repeated_fixed32(int index) const {
+  return repeated_fixed32_.Get(index);
+}
+inline void TestTableDrivenAllTypesLite::set_repeated_fixed32(int index, ::google::protobuf::uint32 value) {
+  repeated_fixed32_.Set(index, value);
+}
+inline void TestTableDrivenAllTypesLite::add_repeated_fixed32(::google::protobuf::uint32 value) {
+  repeated_fixed32_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+TestTableDrivenAllTypesLite::repeated_fixed32() const {
+  return repeated_fixed32_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+TestTableDrivenAllTypesLite::mutable_repeated_fixed32() {
+  return &repeated_fixed32_;
+}
+
+// repeated fixed64 repeated_fixed64 = 38;
+inline int TestTableDrivenAllTypesLite::repeated_fixed64_size() const {
+  return repeated_fixed64_.size();
+}
+inline void TestTableDrivenAllTypesLite::clear_repeated_fixed64() {
+  repeated_fixed64_.Clear();
+}
+inline ::google::protobuf::uint64 TestTableDrivenAllTypesLite::repeated_fixed64(int index) const {
+  return repeated_fixed64_.Get(index);
+}
+inline void TestTableDrivenAllTypesLite::set_repeated_fixed64(int index, ::google::protobuf::uint64 value) {
+  repeated_fixed64_.Set(index, value);
+}
+inline void TestTableDrivenAllTypesLite::add_repeated_fixed64(::google::protobuf::uint64 value) {
+  repeated_fixed64_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
+TestTableDrivenAllTypesLite::repeated_fixed64() const {
+  return repeated_fixed64_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
+TestTableDrivenAllTypesLite::mutable_repeated_fixed64() {
+  return &repeated_fixed64_;
+}
+
+// repeated sfixed32 repeated_sfixed32 = 39;
+inline int TestTableDrivenAllTypesLite::repeated_sfixed32_size() const {
+  return repeated_sfixed32_.size();
+}
+inline void TestTableDrivenAllTypesLite::clear_repeated_sfixed32() {
+  repeated_sfixed32_.Clear();
+}
+inline ::google::protobuf::int32 TestTableDrivenAllTypesLite::repeated_sfixed32(int index) const {
+  return repeated_sfixed32_.Get(index);
+}
+inline void TestTableDrivenAllTypesLite::set_repeated_sfixed32(int index, ::google::protobuf::int32 value) {
+  repeated_sfixed32_.Set(index, value);
+}
+inline void TestTableDrivenAllTypesLite::add_repeated_sfixed32(::google::protobuf::int32 value) {
+  repeated_sfixed32_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+TestTableDrivenAllTypesLite::repeated_sfixed32() const {
+  return repeated_sfixed32_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+TestTableDrivenAllTypesLite::mutable_repeated_sfixed32() {
+  return &repeated_sfixed32_;
+}
+
+// repeated sfixed64 repeated_sfixed64 = 40;
+inline int TestTableDrivenAllTypesLite::repeated_sfixed64_size() const {
+  return repeated_sfixed64_.size();
+}
+inline void TestTableDrivenAllTypesLite::clear_repeated_sfixed64() {
+  repeated_sfixed64_.Clear();
+}
+inline ::google::protobuf::int64 TestTableDrivenAllTypesLite::repeated_sfixed64(int index) const {
+  return repeated_sfixed64_.Get(index);
+}
+inline void TestTableDrivenAllTypesLite::set_repeated_sfixed64(int index, ::google::protobuf::int64 value) {
+  repeated_sfixed64_.Set(index, value);
+}
+inline void TestTableDrivenAllTypesLite::add_repeated_sfixed64(::google::protobuf::int64 value) {
+  repeated_sfixed64_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
+TestTableDrivenAllTypesLite::repeated_sfixed64() const {
+  return repeated_sfixed64_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
+TestTableDrivenAllTypesLite::mutable_repeated_sfixed64() {
+  return &repeated_sfixed64_;
+}
+
+// repeated float repeated_float = 41;
+inline int TestTableDrivenAllTypesLite::repeated_float_size() const {
+  return repeated_float_.size();
+}
+inline void TestTableDrivenAllTypesLite::clear_repeated_float() {
+  repeated_float_.Clear();
+}
+inline float TestTableDrivenAllTypesLite::repeated_float(int index) const {
+  return repeated_float_.Get(index);
+}
+inline void TestTableDrivenAllTypesLite::set_repeated_float(int index, float value) {
+  repeated_float_.Set(index, value);
+}
+inline void TestTableDrivenAllTypesLite::add_repeated_float(float value) {
+  repeated_float_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< float >&
+TestTableDrivenAllTypesLite::repeated_float() const {
+  return repeated_float_;
+}
+inline ::google::protobuf::RepeatedField< float >*
+TestTableDrivenAllTypesLite::mutable_repeated_float() {
+  return &repeated_float_;
+}
+
+// repeated double repeated_double = 42;
+inline int TestTableDrivenAllTypesLite::repeated_double_size() const {
+  return repeated_double_.size();
+}
+inline void TestTableDrivenAllTypesLite::clear_repeated_double() {
+  repeated_double_.Clear();
+}
+inline double TestTableDrivenAllTypesLite::repeated_double(int index) const {
+  return repeated_double_.Get(index);
+}
+inline void TestTableDrivenAllTypesLite::set_repeated_double(int index, double value) {
+  repeated_double_.Set(index, value);
+}
+inline void TestTableDrivenAllTypesLite::add_repeated_double(double value) {
+  repeated_double_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< double >&
+TestTableDrivenAllTypesLite::repeated_double() const {
+  return repeated_double_;
+}
+inline ::google::protobuf::RepeatedField< double >*
+TestTableDrivenAllTypesLite::mutable_repeated_double() {
+  return &repeated_double_;
+}
+
+// repeated bool repeated_bool = 43;
+inline int TestTableDrivenAllTypesLite::repeated_bool_size() const {
+  return repeated_bool_.size();
+}
+inline void TestTableDrivenAllTypesLite::clear_repeated_bool() {
+  repeated_bool_.Clear();
+}
+inline bool TestTableDrivenAllTypesLite::repeated_bool(int index) const {
+  return repeated_bool_.Get(index);
+}
+inline void TestTableDrivenAllTypesLite::set_repeated_bool(int index, bool value) {
+  repeated_bool_.Set(index, value);
+}
+inline void TestTableDrivenAllTypesLite::add_repeated_bool(bool value) {
+  repeated_bool_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< bool >&
+TestTableDrivenAllTypesLite::repeated_bool() const {
+  return repeated_bool_;
+}
+inline ::google::protobuf::RepeatedField< bool >*
+TestTableDrivenAllTypesLite::mutable_repeated_bool() {
+  return &repeated_bool_;
+}
+
+// repeated string repeated_string = 44;
+inline int TestTableDrivenAllTypesLite::repeated_string_size() const {
+  return repeated_string_.size();
+}
+inline void TestTableDrivenAllTypesLite::clear_repeated_string() {
+  repeated_string_.Clear();
+}
+inline const ::std::string& TestTableDrivenAllTypesLite::repeated_string(int index) const {
+  return repeated_string_.Get(index);
+}
+inline ::std::string* TestTableDrivenAllTypesLite::mutable_repeated_string(int index) {
+  return repeated_string_.Mutable(index);
+}
+inline void TestTableDrivenAllTypesLite::set_repeated_string(int index, const ::std::string& value) {
+  repeated_string_.Mutable(index)->assign(value);
+}
+inline void TestTableDrivenAllTypesLite::set_repeated_string(int index, const char* value) {
+  repeated_string_.Mutable(index)->assign(value);
+}
+inline void TestTableDrivenAllTypesLite::set_repeated_string(int index, const char* value, size_t size) {
+  repeated_string_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* TestTableDrivenAllTypesLite::add_repeated_string() {
+  return repeated_string_.Add();
+}
+inline void TestTableDrivenAllTypesLite::add_repeated_string(const ::std::string& value) {
+  repeated_string_.Add()->assign(value);
+}
+inline void TestTableDrivenAllTypesLite::add_repeated_string(const char* value) {
+  repeated_string_.Add()->assign(value);
+}
+inline void TestTableDrivenAllTypesLite::add_repeated_string(const char* value, size_t size) {
+  repeated_string_.Add()->assign(reinterpret_cast<const char*>(value), size);
+}
+inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+TestTableDrivenAllTypesLite::repeated_string() const {
+  return repeated_string_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+TestTableDrivenAllTypesLite::mutable_repeated_string() {
+  return &repeated_string_;
+}
+
+// repeated bytes repeated_bytes = 45;
+inline int TestTableDrivenAllTypesLite::repeated_bytes_size() const {
+  return repeated_bytes_.size();
+}
+inline void TestTableDrivenAllTypesLite::clear_repeated_bytes() {
+  repeated_bytes_.Clear();
+}
+inline const ::std::string& TestTableDrivenAllTypesLite::repeated_bytes(int index) const {
+  return repeated_bytes_.Get(index);
+}
+inline ::std::string* TestTableDrivenAllTypesLite::mutable_repeated_bytes(int index) {
+  return repeated_bytes_.Mutable(index);
+}
+inline void TestTableDrivenAllTypesLite::set_repeated_bytes(int index, const ::std::string& value) {
+  repeated_bytes_.Mutable(index)->assign(value);
+}
+inline void TestTableDrivenAllTypesLite::set_repeated_bytes(int index, const char* value) {
+  repeated_bytes_.Mutable(index)->assign(value);
+}
+inline void TestTableDrivenAllTypesLite::set_repeated_bytes(int index, const void* value, size_t size) {
+  repeated_bytes_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* TestTableDrivenAllTypesLite::add_repeated_bytes() {
+  return repeated_bytes_.Add();
+}
+inline void TestTableDrivenAllTypesLite::add_repeated_bytes(const ::std::string& value) {
+  repeated_bytes_.Add()->assign(value);
+}
+inline void TestTableDrivenAllTypesLite::add_repeated_bytes(const char* value) {
+  repeated_bytes_.Add()->assign(value);
+}
+inline void TestTableDrivenAllTypesLite::add_repeated_bytes(const void* value, size_t size) {
+  repeated_bytes_.Add()->assign(reinterpret_cast<const char*>(value), size);
+}
+inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+TestTableDrivenAllTypesLite::repeated_bytes() const {
+  return repeated_bytes_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+TestTableDrivenAllTypesLite::mutable_repeated_bytes() {
+  return &repeated_bytes_;
+}
+
+// repeated group RepeatedGroup = 46 {
+inline int TestTableDrivenAllTypesLite::repeatedgroup_size() const {
+  return repeatedgroup_.size();
+}
+inline void TestTableDrivenAllTypesLite::clear_repeatedgroup() {
+  repeatedgroup_.Clear();
+}
+inline const ::protobuf_unittest::TestTableDrivenAllTypesLite_RepeatedGroup& TestTableDrivenAllTypesLite::repeatedgroup(int index) const {
+  return repeatedgroup_.Get(index);
+}
+inline ::protobuf_unittest::TestTableDrivenAllTypesLite_RepeatedGroup* TestTableDrivenAllTypesLite::mutable_repeatedgroup(int index) {
+  return repeatedgroup_.Mutable(index);
+}
+inline ::protobuf_unittest::TestTableDrivenAllTypesLite_RepeatedGroup* TestTableDrivenAllTypesLite::add_repeatedgroup() {
+  return repeatedgroup_.Add();
+}
+inline const ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestTableDrivenAllTypesLite_RepeatedGroup >&
+TestTableDrivenAllTypesLite::repeatedgroup() const {
+  return repeatedgroup_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestTableDrivenAllTypesLite_RepeatedGroup >*
+TestTableDrivenAllTypesLite::mutable_repeatedgroup() {
+  return &repeatedgroup_;
+}
+
+// repeated .protobuf_unittest.TestTableDrivenAllTypesLite.NestedMessage repeated_nested_message = 48;
+inline int TestTableDrivenAllTypesLite::repeated_nested_message_size() const {
+  return repeated_nested_message_.size();
+}
+inline void TestTableDrivenAllTypesLite::clear_repeated_nested_message() {
+  repeated_nested_message_.Clear();
+}
+inline const ::protobuf_unittest::TestTableDrivenAllTypesLite_NestedMessage& TestTableDrivenAllTypesLite::repeated_nested_message(int index) const {
+  return repeated_nested_message_.Get(index);
+}
+inline ::protobuf_unittest::TestTableDrivenAllTypesLite_NestedMessage* TestTableDrivenAllTypesLite::mutable_repeated_nested_message(int index) {
+  return repeated_nested_message_.Mutable(index);
+}
+inline ::protobuf_unittest::TestTableDrivenAllTypesLite_NestedMessage* TestTableDrivenAllTypesLite::add_repeated_nested_message() {
+  return repeated_nested_message_.Add();
+}
+inline const ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestTableDrivenAllTypesLite_NestedMessage >&
+TestTableDrivenAllTypesLite::repeated_nested_message() const {
+  return repeated_nested_message_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestTableDrivenAllTypesLite_NestedMessage >*
+TestTableDrivenAllTypesLite::mutable_repeated_nested_message() {
+  return &repeated_nested_message_;
+}
+
+// repeated .protobuf_unittest.ForeignMessageLite repeated_foreign_message = 49;
+inline int TestTableDrivenAllTypesLite::repeated_foreign_message_size() const {
+  return repeated_foreign_message_.size();
+}
+inline void TestTableDrivenAllTypesLite::clear_repeated_foreign_message() {
+  repeated_foreign_message_.Clear();
+}
+inline const ::protobuf_unittest::ForeignMessageLite& TestTableDrivenAllTypesLite::repeated_foreign_message(int index) const {
+  return repeated_foreign_message_.Get(index);
+}
+inline ::protobuf_unittest::ForeignMessageLite* TestTableDrivenAllTypesLite::mutable_repeated_foreign_message(int index) {
+  return repeated_foreign_message_.Mutable(index);
+}
+inline ::protobuf_unittest::ForeignMessageLite* TestTableDrivenAllTypesLite::add_repeated_foreign_message() {
+  return repeated_foreign_message_.Add();
+}
+inline const ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::ForeignMessageLite >&
+TestTableDrivenAllTypesLite::repeated_foreign_message() const {
+  return repeated_foreign_message_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::ForeignMessageLite >*
+TestTableDrivenAllTypesLite::mutable_repeated_foreign_message() {
+  return &repeated_foreign_message_;
+}
+
+// repeated .protobuf_unittest_import.ImportMessageLite repeated_import_message = 50;
+inline int TestTableDrivenAllTypesLite::repeated_import_message_size() const {
+  return repeated_import_message_.size();
+}
+inline void TestTableDrivenAllTypesLite::clear_repeated_import_message() {
+  repeated_import_message_.Clear();
+}
+inline const ::protobuf_unittest_import::ImportMessageLite& TestTableDrivenAllTypesLite::repeated_import_message(int index) const {
+  return repeated_import_message_.Get(index);
+}
+inline ::protobuf_unittest_import::ImportMessageLite* TestTableDrivenAllTypesLite::mutable_repeated_import_message(int index) {
+  return repeated_import_message_.Mutable(index);
+}
+inline ::protobuf_unittest_import::ImportMessageLite* TestTableDrivenAllTypesLite::add_repeated_import_message() {
+  return repeated_import_message_.Add();
+}
+inline const ::google::protobuf::RepeatedPtrField< ::protobuf_unittest_import::ImportMessageLite >&
+TestTableDrivenAllTypesLite::repeated_import_message() const {
+  return repeated_import_message_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::protobuf_unittest_import::ImportMessageLite >*
+TestTableDrivenAllTypesLite::mutable_repeated_import_message() {
+  return &repeated_import_message_;
+}
+
+// repeated .protobuf_unittest.TestTableDrivenAllTypesLite.NestedEnum repeated_nested_enum = 51;
+inline int TestTableDrivenAllTypesLite::repeated_nested_enum_size() const {
+  return repeated_nested_enum_.size();
+}
+inline void TestTableDrivenAllTypesLite::clear_repeated_nested_enum() {
+  repeated_nested_enum_.Clear();
+}
+inline ::protobuf_unittest::TestTableDrivenAllTypesLite_NestedEnum TestTableDrivenAllTypesLite::repeated_nested_enum(int index) const {
+  return static_cast< ::protobuf_unittest::TestTableDrivenAllTypesLite_NestedEnum >(repeated_nested_enum_.Get(index));
+}
+inline void TestTableDrivenAllTypesLite::set_repeated_nested_enum(int index, ::protobuf_unittest::TestTableDrivenAllTypesLite_NestedEnum value) {
+  GOOGLE_DCHECK(::protobuf_unittest::TestTableDrivenAllTypesLite_NestedEnum_IsValid(value));
+  repeated_nested_enum_.Set(index, value);
+}
+inline void TestTableDrivenAllTypesLite::add_repeated_nested_enum(::protobuf_unittest::TestTableDrivenAllTypesLite_NestedEnum value) {
+  GOOGLE_DCHECK(::protobuf_unittest::TestTableDrivenAllTypesLite_NestedEnum_IsValid(value));
+  repeated_nested_enum_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField<int>&
+TestTableDrivenAllTypesLite::repeated_nested_enum() const {
+  return repeated_nested_enum_;
+}
+inline ::google::protobuf::RepeatedField<int>*
+TestTableDrivenAllTypesLite::mutable_repeated_nested_enum() {
+  return &repeated_nested_enum_;
+}
+
+// repeated .protobuf_unittest.ForeignEnumLite repeated_foreign_enum = 52;
+inline int TestTableDrivenAllTypesLite::repeated_foreign_enum_size() const {
+  return repeated_foreign_enum_.size();
+}
+inline void TestTableDrivenAllTypesLite::clear_repeated_foreign_enum() {
+  repeated_foreign_enum_.Clear();
+}
+inline protobuf_unittest::ForeignEnumLite TestTableDrivenAllTypesLite::repeated_foreign_enum(int index) const {
+  return static_cast< protobuf_unittest::ForeignEnumLite >(repeated_foreign_enum_.Get(index));
+}
+inline void TestTableDrivenAllTypesLite::set_repeated_foreign_enum(int index, protobuf_unittest::ForeignEnumLite value) {
+  GOOGLE_DCHECK(protobuf_unittest::ForeignEnumLite_IsValid(value));
+  repeated_foreign_enum_.Set(index, value);
+}
+inline void TestTableDrivenAllTypesLite::add_repeated_foreign_enum(protobuf_unittest::ForeignEnumLite value) {
+  GOOGLE_DCHECK(protobuf_unittest::ForeignEnumLite_IsValid(value));
+  repeated_foreign_enum_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField<int>&
+TestTableDrivenAllTypesLite::repeated_foreign_enum() const {
+  return repeated_foreign_enum_;
+}
+inline ::google::protobuf::RepeatedField<int>*
+TestTableDrivenAllTypesLite::mutable_repeated_foreign_enum() {
+  return &repeated_foreign_enum_;
+}
+
+// repeated .protobuf_unittest_import.ImportEnumLite repeated_import_enum = 53;
+inline int TestTableDrivenAllTypesLite::repeated_import_enum_size() const {
+  return repeated_import_enum_.size();
+}
+inline void TestTableDrivenAllTypesLite::clear_repeated_import_enum() {
+  repeated_import_enum_.Clear();
+}
+inline protobuf_unittest_import::ImportEnumLite TestTableDrivenAllTypesLite::repeated_import_enum(int index) const {
+  return static_cast< protobuf_unittest_import::ImportEnumLite >(repeated_import_enum_.Get(index));
+}
+inline void TestTableDrivenAllTypesLite::set_repeated_import_enum(int index, protobuf_unittest_import::ImportEnumLite value) {
+  GOOGLE_DCHECK(protobuf_unittest_import::ImportEnumLite_IsValid(value));
+  repeated_import_enum_.Set(index, value);
+}
+inline void TestTableDrivenAllTypesLite::add_repeated_import_enum(protobuf_unittest_import::ImportEnumLite value) {
+  GOOGLE_DCHECK(protobuf_unittest_import::ImportEnumLite_IsValid(value));
+  repeated_import_enum_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField<int>&
+TestTableDrivenAllTypesLite::repeated_import_enum() const {
+  return repeated_import_enum_;
+}
+inline ::google::protobuf::RepeatedField<int>*
+TestTableDrivenAllTypesLite::mutable_repeated_import_enum() {
+  return &repeated_import_enum_;
+}
+
+// repeated string repeated_string_piece = 54 [ctype = STRING_PIECE];
+inline int TestTableDrivenAllTypesLite::repeated_string_piece_size() const {
+  return repeated_string_piece_.size();
+}
+inline void TestTableDrivenAllTypesLite::clear_repeated_string_piece() {
+  repeated_string_piece_.Clear();
+}
+inline const ::google::protobuf::internal::StringPieceField& TestTableDrivenAllTypesLite::repeated_string_piece(int index) const {
+  return repeated_string_piece_.Get(index);
+}
+inline ::std::string* TestTableDrivenAllTypesLite::mutable_repeated_string_piece(int index) {
+  return repeated_string_piece_.Mutable(index)->Mutable();
+}
+inline void TestTableDrivenAllTypesLite::set_repeated_string_piece(int index, const ::std::string& value) {
+  repeated_string_piece_.Mutable(index)->CopyFrom(value.data(), value.size());
+}
+inline void TestTableDrivenAllTypesLite::set_repeated_string_piece(int index, const char* value) {
+  repeated_string_piece_.Mutable(index)->CopyFrom(value, strlen(value));
+}
+inline void TestTableDrivenAllTypesLite::set_repeated_string_piece(int index, const char* value, size_t size) {
+  repeated_string_piece_.Mutable(index)->CopyFrom(
+    reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* TestTableDrivenAllTypesLite::add_repeated_string_piece() {
+  return repeated_string_piece_.Add()->Mutable();
+}
+inline void TestTableDrivenAllTypesLite::add_repeated_string_piece(const ::std::string& value) {
+  repeated_string_piece_.Add()->CopyFrom(value.data(), value.size());
+}
+inline void TestTableDrivenAllTypesLite::add_repeated_string_piece(const char* value) {
+  repeated_string_piece_.Add()->CopyFrom(value, strlen(value));
+}
+inline void TestTableDrivenAllTypesLite::add_repeated_string_piece(const char* value, size_t size) {
+  repeated_string_piece_.Add()->CopyFrom(reinterpret_cast<const char*>(value), size);
+}
+inline const ::google::protobuf::RepeatedPtrField< ::google::protobuf::internal::StringPieceField>&
+TestTableDrivenAllTypesLite::repeated_string_piece() const {
+  return repeated_string_piece_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::google::protobuf::internal::StringPieceField>*
+TestTableDrivenAllTypesLite::mutable_repeated_string_piece() {
+  return &repeated_string_piece_;
+}
+
+// repeated string repeated_cord = 55 [ctype = CORD];
+inline int TestTableDrivenAllTypesLite::repeated_cord_size() const {
+  return repeated_cord_.size();
+}
+inline void TestTableDrivenAllTypesLite::clear_repeated_cord() {
+  repeated_cord_.Clear();
+}
+inline const ::std::string& TestTableDrivenAllTypesLite::repeated_cord(int index) const {
+  return repeated_cord_.Get(index);
+}
+inline ::std::string* TestTableDrivenAllTypesLite::mutable_repeated_cord(int index) {
+  return repeated_cord_.Mutable(index);
+}
+inline void TestTableDrivenAllTypesLite::set_repeated_cord(int index, const ::std::string& value) {
+  repeated_cord_.Mutable(index)->assign(value);
+}
+inline void TestTableDrivenAllTypesLite::set_repeated_cord(int index, const char* value) {
+  repeated_cord_.Mutable(index)->assign(value);
+}
+inline void TestTableDrivenAllTypesLite::set_repeated_cord(int index, const char* value, size_t size) {
+  repeated_cord_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* TestTableDrivenAllTypesLite::add_repeated_cord() {
+  return repeated_cord_.Add();
+}
+inline void TestTableDrivenAllTypesLite::add_repeated_cord(const ::std::string& value) {
+  repeated_cord_.Add()->assign(value);
+}
+inline void TestTableDrivenAllTypesLite::add_repeated_cord(const char* value) {
+  repeated_cord_.Add()->assign(value);
+}
+inline void TestTableDrivenAllTypesLite::add_repeated_cord(const char* value, size_t size) {
+  repeated_cord_.Add()->assign(reinterpret_cast<const char*>(value), size);
+}
+inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+TestTableDrivenAllTypesLite::repeated_cord() const {
+  return repeated_cord_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+TestTableDrivenAllTypesLite::mutable_repeated_cord() {
+  return &repeated_cord_;
+}
+
+// optional int32 default_int32 = 61 [default = 41];
+inline bool TestTableDrivenAllTypesLite::has_default_int32() const {
+  return _has_bit(48);
+}
+inline void TestTableDrivenAllTypesLite::clear_default_int32() {
+  default_int32_ = 41;
+  _clear_bit(48);
+}
+inline ::google::protobuf::int32 TestTableDrivenAllTypesLite::default_int32() const {
+  return default_int32_;
+}
+inline void TestTableDrivenAllTypesLite::set_default_int32(::google::protobuf::int32 value) {
+  _set_bit(48);
+  default_int32_ = value;
+}
+
+// optional int64 default_int64 = 62 [default = 42];
+inline bool TestTableDrivenAllTypesLite::has_default_int64() const {
+  return _has_bit(49);
+}
+inline void TestTableDrivenAllTypesLite::clear_default_int64() {
+  default_int64_ = GOOGLE_LONGLONG(42);
+  _clear_bit(49);
+}
+inline ::google::protobuf::int64 TestTableDrivenAllTypesLite::default_int64() const {
+  return default_int64_;
+}
+inline void TestTableDrivenAllTypesLite::set_default_int64(::google::protobuf::int64 value) {
+  _set_bit(49);
+  default_int64_ = value;
+}
+
+// optional uint32 default_uint32 = 63 [default = 43];
+inline bool TestTableDrivenAllTypesLite::has_default_uint32() const {
+  return _has_bit(50);
+}
+inline void TestTableDrivenAllTypesLite::clear_default_uint32() {
+  default_uint32_ = 43u;
+  _clear_bit(50);
+}
+inline ::google::protobuf::uint32 TestTableDrivenAllTypesLite::default_uint32() const {
+  return default_uint32_;
+}
+inline void TestTableDrivenAllTypesLite::set_default_uint32(::google::protobuf::uint32 value) {
+  _set_bit(50);
+  default_uint32_ = value;
+}
+
+// optional uint64 default_uint64 = 64 [default = 44];
+inline bool TestTableDrivenAllTypesLite::has_default_uint64() const {
+  return _has_bit(51);
+}
+inline void TestTableDrivenAllTypesLite::clear_default_uint64() {
+  default_uint64_ = GOOGLE_ULONGLONG(44);
+  _clear_bit(51);
+}
+inline ::google::protobuf::uint64 TestTableDrivenAllTypesLite::default_uint64() const {
+  return default_uint64_;
+}
+inline void TestTableDrivenAllTypesLite::set_default_uint64(::google::protobuf::uint64 value) {
+  _set_bit(51);
+  default_uint64_ = value;
+}
+
+// optional sint32 default_sint32 = 65 [default = -45];
+inline bool TestTableDrivenAllTypesLite::has_default_sint32() const {
+  return _has_bit(52);
+}
+inline void TestTableDrivenAllTypesLite::clear_default_sint32() {
+  default_sint32_ = -45;
+  _clear_bit(52);
+}
+inline ::google::protobuf::int32 TestTableDrivenAllTypesLite::default_sint32() const {
+  return default_sint32_;
+}
+inline void TestTableDrivenAllTypesLite::set_default_sint32(::google::protobuf::int32 value) {
+  _set_bit(52);
+  default_sint32_ = value;
+}
+
+// optional sint64 default_sint64 = 66 [default = 46];
+inline bool TestTableDrivenAllTypesLite::has_default_sint64() const {
+  return _has_bit(53);
+}
+inline void TestTableDrivenAllTypesLite::clear_default_sint64() {
+  default_sint64_ = GOOGLE_LONGLONG(46);
+  _clear_bit(53);
+}
+inline ::google::protobuf::int64 TestTableDrivenAllTypesLite::default_sint64() const {
+  return default_sint64_;
+}
+inline void TestTableDrivenAllTypesLite::set_default_sint64(::google::protobuf::int64 value) {
+  _set_bit(53);
+  default_sint64_ = value;
+}
+
+// optional fixed32 default_fixed32 = 67 [default = 47];
+inline bool TestTableDrivenAllTypesLite::has_default_fixed32() const {
+  return _has_bit(54);
+}
+inline void TestTableDrivenAllTypesLite::clear_default_fixed32() {
+  default_fixed32_ = 47u;
+  _clear_bit(54);
+}
+inline ::google::protobuf::uint32 TestTableDrivenAllTypesLite::default_fixed32() const {
+  return default_fixed32_;
+}
+inline void TestTableDrivenAllTypesLite::set_default_fixed32(::google::protobuf::uint32 value) {
+  _set_bit(54);
+  default_fixed32_ = value;
+}
+
+// optional fixed64 default_fixed64 = 68 [default = 48];
+inline bool TestTableDrivenAllTypesLite::has_default_fixed64() const {
+  return _has_bit(55);
+}
+inline void TestTableDrivenAllTypesLite::clear_default_fixed64() {
+  default_fixed64_ = GOOGLE_ULONGLONG(48);
+  _clear_bit(55);
+}
+inline ::google::protobuf::uint64 TestTableDrivenAllTypesLite::default_fixed64() const {
+  return default_fixed64_;
+}
+inline void TestTableDrivenAllTypesLite::set_default_fixed64(::google::protobuf::uint64 value) {
+  _set_bit(55);
+  default_fixed64_ = value;
+}
+
+// optional sfixed32 default_sfixed32 = 69 [default = 49];
+inline bool TestTableDrivenAllTypesLite::has_default_sfixed32() const {
+  return _has_bit(56);
+}
+inline void TestTableDrivenAllTypesLite::clear_default_sfixed32() {
+  default_sfixed32_ = 49;
+  _clear_bit(56);
+}
+inline ::google::protobuf::int32 TestTableDrivenAllTypesLite::default_sfixed32() const {
+  return default_sfixed32_;
+}
+inline void TestTableDrivenAllTypesLite::set_default_sfixed32(::google::protobuf::int32 value) {
+  _set_bit(56);
+  default_sfixed32_ = value;
+}
+
+// optional sfixed64 default_sfixed64 = 70 [default = -50];
+inline bool TestTableDrivenAllTypesLite::has_default_sfixed64() const {
+  return _has_bit(57);
+}
+inline void TestTableDrivenAllTypesLite::clear_default_sfixed64() {
+  default_sfixed64_ = GOOGLE_LONGLONG(-50);
+  _clear_bit(57);
+}
+inline ::google::protobuf::int64 TestTableDrivenAllTypesLite::default_sfixed64() const {
+  return default_sfixed64_;
+}
+inline void TestTableDrivenAllTypesLite::set_default_sfixed64(::google::protobuf::int64 value) {
+  _set_bit(57);
+  default_sfixed64_ = value;
+}
+
+// optional float default_float = 71 [default = 51.5];
+inline bool TestTableDrivenAllTypesLite::has_default_float() const {
+  return _has_bit(58);
+}
+inline void TestTableDrivenAllTypesLite::clear_default_float() {
+  default_float_ = 51.5f;
+  _clear_bit(58);
+}
+inline float TestTableDrivenAllTypesLite::default_float() const {
+  return default_float_;
+}
+inline void TestTableDrivenAllTypesLite::set_default_float(float value) {
+  _set_bit(58);
+  default_float_ = value;
+}
+
+// optional double default_double = 72 [default = 52000];
+inline bool TestTableDrivenAllTypesLite::has_default_double() const {
+  return _has_bit(59);
+}
+inline void TestTableDrivenAllTypesLite::clear_default_double() {
+  default_double_ = 52000;
+  _clear_bit(59);
+}
+inline double TestTableDrivenAllTypesLite::default_double() const {
+  return default_double_;
+}
+inline void TestTableDrivenAllTypesLite::set_default_double(double value) {
+  _set_bit(59);
+  default_double_ = value;
+}
+
+// optional bool default_bool = 73 [default = true];
+inline bool TestTableDrivenAllTypesLite::has_default_bool() const {
+  return _has_bit(60);
+}
+inline void TestTableDrivenAllTypesLite::clear_default_bool() {
+  default_bool_ = true;
+  _clear_bit(60);
+}
+inline bool TestTableDrivenAllTypesLite::default_bool() const {
+  return default_bool_;
+}
+inline void TestTableDrivenAllTypesLite::set_default_bool(bool value) {
+  _set_bit(60);
+  default_bool_ = value;
+}
+
+// optional string default_string = 74 [default = "hello"];
+inline bool TestTableDrivenAllTypesLite::has_default_string() const {
+  return _has_bit(61);
+}
+inline void TestTableDrivenAllTypesLite::clear_default_string() {
+  if (default_string_ != &_default_default_string_) {
+    default_string_->assign(_default_default_string_);
+  }
+  _clear_bit(61);
+}
+inline const ::std::string& TestTableDrivenAllTypesLite::default_string() const {
+  return *default_string_;
+}
+inline void TestTableDrivenAllTypesLite::set_default_string(const ::std::string& value) {
+  _set_bit(61);
+  if (default_string_ == &_default_default_string_) {
+    default_string_ = new ::std::string;
+  }
+  default_string_->assign(value);
+}
+inline void TestTableDrivenAllTypesLite::set_default_string(const char* value) {
+  _set_bit(61);
+  if (default_string_ == &_default_default_string_) {
+    default_string_ = new ::std::string;
+  }
+  default_string_->assign(value);
+}
+inline void TestTableDrivenAllTypesLite::set_default_string(const char* value, size_t size) {
+  _set_bit(61);
+  if (default_string_ == &_default_default_string_) {
+    default_string_ = new ::std::string;
+  }
+  default_string_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* TestTableDrivenAllTypesLite::mutable_default_string() {
+  _set_bit(61);
+  if (default_string_ == &_default_default_string_) {
+    default_string_ = new ::std::string(_default_default_string_);
+  }
+  return default_string_;
+}
+
+// optional bytes default_bytes = 75 [default = "world"];
+inline bool TestTableDrivenAllTypesLite::has_default_bytes() const {
+  return _has_bit(62);
+}
+inline void TestTableDrivenAllTypesLite::clear_default_bytes() {
+  if (default_bytes_ != &_default_default_bytes_) {
+    default_bytes_->assign(_default_default_bytes_);
+  }
+  _clear_bit(62);
+}
+inline const ::std::string& TestTableDrivenAllTypesLite::default_bytes() const {
+  return *default_bytes_;
+}
+inline void TestTableDrivenAllTypesLite::set_default_bytes(const ::std::string& value) {
+  _set_bit(62);
+  if (default_bytes_ == &_default_default_bytes_) {
+    default_bytes_ = new ::std::string;
+  }
+  default_bytes_->assign(value);
+}
+inline void TestTableDrivenAllTypesLite::set_default_bytes(const char* value) {
+  _set_bit(62);
+  if (default_bytes_ == &_default_default_bytes_) {
+    default_bytes_ = new ::std::string;
+  }
+  default_bytes_->assign(value);
+}
+inline void TestTableDrivenAllTypesLite::set_default_bytes(const void* value, size_t size) {
+  _set_bit(62);
+  if (default_bytes_ == &_default_default_bytes_) {
+    default_bytes_ = new ::std::string;
+  }
+  default_bytes_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* TestTableDrivenAllTypesLite::mutable_default_bytes() {
+  _set_bit(62);
+  if (default_bytes_ == &_default_default_bytes_) {
+    default_bytes_ = new ::std::string(_default_default_bytes_);
+  }
+  return default_bytes_;
+}
+
+// optional .protobuf_unittest.TestTableDrivenAllTypesLite.NestedEnum default_nested_enum = 81 [default = BAR];
+inline bool TestTableDrivenAllTypesLite::has_default_nested_enum() const {
+  return _has_bit(63);
+}
+inline void TestTableDrivenAllTypesLite::clear_default_nested_enum() {
+  default_nested_enum_ = 2;
+  _clear_bit(63);
+}
+inline ::protobuf_unittest::TestTableDrivenAllTypesLite_NestedEnum TestTableDrivenAllTypesLite::default_nested_enum() const {
+  return static_cast< ::protobuf_unittest::TestTableDrivenAllTypesLite_NestedEnum >(default_nested_enum_);
+}
+inline void TestTableDrivenAllTypesLite::set_default_nested_enum(::protobuf_unittest::TestTableDrivenAllTypesLite_NestedEnum value) {
+  GOOGLE_DCHECK(::protobuf_unittest::TestTableDrivenAllTypesLite_NestedEnum_IsValid(value));
+  _set_bit(63);
+  default_nested_enum_ = value;
+}
+
+// optional .protobuf_unittest.ForeignEnumLite default_foreign_enum = 82 [default = FOREIGN_LITE_BAR];
+inline bool TestTableDrivenAllTypesLite::has_default_foreign_enum() const {
+  return _has_bit(64);
+}
+inline void TestTableDrivenAllTypesLite::clear_default_foreign_enum() {
+  default_foreign_enum_ = 5;
+  _clear_bit(64);
+}
+inline protobuf_unittest::ForeignEnumLite TestTableDrivenAllTypesLite::default_foreign_enum() const {
+  return static_cast< protobuf_unittest::ForeignEnumLite >(default_foreign_enum_);
+}
+inline void TestTableDrivenAllTypesLite::set_default_foreign_enum(protobuf_unittest::ForeignEnumLite value) {
+  GOOGLE_DCHECK(protobuf_unittest::ForeignEnumLite_IsValid(value));
+  _set_bit(64);
+  default_foreign_enum_ = value;
+}
+
+// optional .protobuf_unittest_import.ImportEnumLite default_import_enum = 83 [default = IMPORT_LITE_BAR];
+inline bool TestTableDrivenAllTypesLite::has_default_import_enum() const {
+  return _has_bit(65);
+}
+inline void TestTableDrivenAllTypesLite::clear_default_import_enum() {
+  default_import_enum_ = 8;
+  _clear_bit(65);
+}
+inline protobuf_unittest_import::ImportEnumLite TestTableDrivenAllTypesLite::default_import_enum() const {
+  return static_cast< protobuf_unittest_import::ImportEnumLite >(default_import_enum_);
+}
+inline void TestTableDrivenAllTypesLite::set_default_import_enum(protobuf_unittest_import::ImportEnumLite value) {
+  GOOGLE_DCHECK(protobuf_unittest_import::ImportEnumLite_IsValid(value));
+  _set_bit(65);
+  default_import_enum_ = value;
+}
+
+// optional string default_string_piece = 84 [default = "abc", ctype = STRING_PIECE];
+inline bool TestTableDrivenAllTypesLite::has_default_string_piece() const {
+  return _has_bit(66);
+}
+inline void TestTableDrivenAllTypesLite::clear_default_string_piece() {
+  default_string_piece_.SetAliased("abc", 3);
+  _clear_bit(66);
+}
+inline const ::google::protobuf::internal::StringPieceField& TestTableDrivenAllTypesLite::default_string_piece() const {
+  return default_string_piece_;
+}
+inline void TestTableDrivenAllTypesLite::set_default_string_piece(const ::std::string& value) {
+  _set_bit(66);
+  default_string_piece_.CopyFrom(value.data(), value.size());
+}
+inline void TestTableDrivenAllTypesLite::set_default_string_piece(const char* value) {
+  _set_bit(66);
+  default_string_piece_.CopyFrom(value, strlen(value));
+}
+inline void TestTableDrivenAllTypesLite::set_default_string_piece(const char* value, size_t size) {
+  _set_bit(66);
+  default_string_piece_.CopyFrom(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* TestTableDrivenAllTypesLite::mutable_default_string_piece() {
+  _set_bit(66);
+  return default_string_piece_.Mutable();
+}
+
+// optional string default_cord = 85 [default = "123", ctype = CORD];
+inline bool TestTableDrivenAllTypesLite::has_default_cord() const {
+  return _has_bit(67);
+}
+inline void TestTableDrivenAllTypesLite::clear_default_cord() {
+  if (default_cord_ != &_default_default_cord_) {
+    default_cord_->assign(_default_default_cord_);
+  }
+  _clear_bit(67);
+}
+inline const ::std::string& TestTableDrivenAllTypesLite::default_cord() const {
+  return *default_cord_;
+}
+inline void TestTableDrivenAllTypesLite::set_default_cord(const ::std::string& value) {
+  _set_bit(67);
+  if (default_cord_ == &_default_default_cord_) {
+    default_cord_ = new ::std::string;
+  }
+  default_cord_->assign(value);
+}
+inline void TestTableDrivenAllTypesLite::set_default_cord(const char* value) {
+  _set_bit(67);
+  if (default_cord_ == &_default_default_cord_) {
+    default_cord_ = new ::std::string;
+  }
+  default_cord_->assign(value);
+}
+inline void TestTableDrivenAllTypesLite::set_default_cord(const char* value, size_t size) {
+  _set_bit(67);
+  if (default_cord_ == &_default_default_cord_) {
+    default_cord_ = new ::std::string;
+  }
+  default_cord_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* TestTableDrivenAllTypesLite::mutable_default_cord() {
+  _set_bit(67);
+  if (default_cord_ == &_default_default_cord_) {
+    default_cord_ = new ::std::string(_default_default_cord_);
+  }
+  return default_cord_;
+}
+
+// -------------------------------------------------------------------
+
+// TestTableDrivenSparseLite
+
+// optional int32 optional_int32 = 1;
+inline bool TestTableDrivenSparseLite::has_optional_int32() const {
+  return _has_bit(0);
+}
+inline void TestTableDrivenSparseLite::clear_optional_int32() {
+  optional_int32_ = 0;
+  _clear_bit(0);
+}
+inline ::google::protobuf::int32 TestTableDrivenSparseLite::optional_int32() const {
+  return optional_int32_;
+}
+inline void TestTableDrivenSparseLite::set_optional_int32(::google::protobuf::int32 value) {
+  _set_bit(0);
+  optional_int32_ = value;
+}
+
+// repeated int32 repeated_int32 = 31;
+inline int TestTableDrivenSparseLite::repeated_int32_size() const {
+  return repeated_int32_.size();
+}
+inline void TestTableDrivenSparseLite::clear_repeated_int32() {
+  repeated_int32_.Clear();
+}
+inline ::google::protobuf::int32 TestTableDrivenSparseLite::repeated_int32(int index) const {
+  return repeated_int32_.Get(index);
+}
+inline void TestTableDrivenSparseLite::set_repeated_int32(int index, ::google::protobuf::int32 value) {
+  repeated_int32_.Set(index, value);
+}
+inline void TestTableDrivenSparseLite::add_repeated_int32(::google::protobuf::int32 value) {
+  repeated_int32_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+TestTableDrivenSparseLite::repeated_int32() const {
+  return repeated_int32_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+TestTableDrivenSparseLite::mutable_repeated_int32() {
+  return &repeated_int32_;
+}
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace protobuf_unittest
+
+// @@protoc_insertion_point(global_scope)
+
+#endif  // PROTOBUF_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto__INCLUDED
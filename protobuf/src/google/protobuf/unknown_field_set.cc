@@ -34,6 +34,8 @@
 
 #include <google/protobuf/stubs/common.h>
 #include <google/protobuf/unknown_field_set.h>
+#include <google/protobuf/stubs/atomicops.h>
+#include <google/protobuf/stubs/once.h>
 #include <google/protobuf/stubs/stl_util-inl.h>
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/io/zero_copy_stream.h>
@@ -43,34 +45,147 @@
 namespace google {
 namespace protobuf {
 
+namespace {
+
+// parsed_raw_fields() parses at most once per set, so all sets share one
+// mutex for it.
+Mutex* parse_raw_fields_mutex_ = NULL;
+GOOGLE_PROTOBUF_DECLARE_ONCE(parse_raw_fields_mutex_once_);
+
+void DeleteParseRawFieldsMutex() {
+  delete parse_raw_fields_mutex_;
+  parse_raw_fields_mutex_ = NULL;
+}
+
+void InitParseRawFieldsMutex() {
+  parse_raw_fields_mutex_ = new Mutex;
+  internal::OnShutdown(&DeleteParseRawFieldsMutex);
+}
+
+}  // namespace
+
 UnknownFieldSet::UnknownFieldSet()
-  : fields_(NULL) {}
+  : fields_(NULL), raw_fields_(NULL), raw_storage_(false),
+    parsed_raw_fields_(NULL) {}
 
 UnknownFieldSet::~UnknownFieldSet() {
   Clear();
   delete fields_;
+  delete raw_fields_;
 }
 
 void UnknownFieldSet::ClearFallback() {
-  GOOGLE_DCHECK(fields_ != NULL);
-  for (int i = 0; i < fields_->size(); i++) {
-    (*fields_)[i].Delete();
+  if (fields_ != NULL) {
+    for (int i = 0; i < fields_->size(); i++) {
+      (*fields_)[i].Delete();
+    }
+    fields_->clear();
+  }
+  if (raw_fields_ != NULL) {
+    raw_fields_->clear();
+  }
+  if (parsed_raw_fields_ != NULL) {
+    DeleteParsedRawFields();
+  }
+}
+
+void UnknownFieldSet::MaterializeRawFields() {
+  GOOGLE_DCHECK(has_raw_fields());
+
+  if (fields_ == NULL) fields_ = new vector<UnknownField>;
+  if (parsed_raw_fields_ != NULL) {
+    // A const reader has already parsed them; take over its fields.
+    fields_->insert(fields_->end(),
+                    parsed_raw_fields_->begin(), parsed_raw_fields_->end());
+    delete parsed_raw_fields_;
+    parsed_raw_fields_ = NULL;
+  } else {
+    ParseRawFields(fields_);
+  }
+  raw_fields_->clear();
+}
+
+void UnknownFieldSet::ParseRawFields(vector<UnknownField>* output) const {
+  // The raw fields were produced by WireFormat::SkipField(), so they are
+  // known to be valid and to have been within the limits of the stream they
+  // were read from.
+  UnknownFieldSet parsed;
+  io::CodedInputStream input(
+      reinterpret_cast<const uint8*>(raw_fields_->data()),
+      raw_fields_->size());
+  input.SetRecursionLimit(kint32max);
+  input.SetTotalBytesLimit(kint32max, -1);
+  if (!internal::WireFormat::SkipMessage(&input, &parsed) ||
+      !input.ConsumedEntireMessage()) {
+    GOOGLE_LOG(DFATAL) << "Raw unknown fields could not be parsed.";
+  }
+
+  // Move the parsed fields over without copying what they point to.
+  if (parsed.fields_ != NULL) {
+    output->insert(output->end(),
+                   parsed.fields_->begin(), parsed.fields_->end());
+    parsed.fields_->clear();
   }
-  fields_->clear();
+}
+
+const vector<UnknownField>& UnknownFieldSet::parsed_raw_fields() const {
+  const vector<UnknownField>* parsed = internal::Acquire_Load(
+      &parsed_raw_fields_);
+  if (parsed != NULL) return *parsed;
+
+  ::google::protobuf::GoogleOnceInit(&parse_raw_fields_mutex_once_,
+                                     &InitParseRawFieldsMutex);
+  MutexLock lock(parse_raw_fields_mutex_);
+  if (parsed_raw_fields_ == NULL) {
+    vector<UnknownField>* fields = new vector<UnknownField>;
+    ParseRawFields(fields);
+    // The fields must be fully built before other readers can see them.
+    internal::Release_Store(&parsed_raw_fields_, fields);
+  }
+  return *parsed_raw_fields_;
+}
+
+void UnknownFieldSet::DeleteParsedRawFields() {
+  for (int i = 0; i < parsed_raw_fields_->size(); i++) {
+    (*parsed_raw_fields_)[i].Delete();
+  }
+  delete parsed_raw_fields_;
+  parsed_raw_fields_ = NULL;
 }
 
 void UnknownFieldSet::MergeFrom(const UnknownFieldSet& other) {
-  for (int i = 0; i < other.field_count(); i++) {
-    AddField(other.field(i));
+  // Copy other's fields in the same form they are stored in.  Since all of
+  // other's materialized fields come before its raw fields, and raw fields
+  // are appended after this set's materialized fields, the order is kept.
+  for (int i = 0; i < other.materialized_field_count(); i++) {
+    AddField(other.materialized_field(i));
+  }
+  if (other.has_raw_fields()) {
+    mutable_raw_fields()->append(*other.raw_fields_);
   }
 }
 
 int UnknownFieldSet::SpaceUsedExcludingSelf() const {
-  if (fields_ == NULL) return 0;
+  int total_size = 0;
+  if (raw_fields_ != NULL) {
+    total_size += sizeof(*raw_fields_) +
+      internal::StringSpaceUsedExcludingSelf(*raw_fields_);
+  }
+  if (fields_ != NULL) {
+    total_size += FieldsSpaceUsed(*fields_);
+  }
+  const vector<UnknownField>* parsed = internal::Acquire_Load(
+      &parsed_raw_fields_);
+  if (parsed != NULL) {
+    total_size += FieldsSpaceUsed(*parsed);
+  }
+  return total_size;
+}
 
-  int total_size = sizeof(*fields_) + sizeof(UnknownField) * fields_->size();
-  for (int i = 0; i < fields_->size(); i++) {
-    const UnknownField& field = (*fields_)[i];
+int UnknownFieldSet::FieldsSpaceUsed(const vector<UnknownField>& fields) {
+  int total_size = sizeof(fields) + sizeof(UnknownField) * fields.size();
+  for (int i = 0; i < fields.size(); i++) {
+    const UnknownField& field = fields[i];
     switch (field.type()) {
       case UnknownField::TYPE_LENGTH_DELIMITED:
         total_size += sizeof(*field.length_delimited_) +
@@ -91,6 +206,7 @@ int UnknownFieldSet::SpaceUsed() const {
 }
 
 void UnknownFieldSet::AddVarint(int number, uint64 value) {
+  if (has_raw_fields()) MaterializeRawFields();
   if (fields_ == NULL) fields_ = new vector<UnknownField>;
   UnknownField field;
   field.number_ = number;
@@ -100,6 +216,7 @@ void UnknownFieldSet::AddVarint(int number, uint64 value) {
 }
 
 void UnknownFieldSet::AddFixed32(int number, uint32 value) {
+  if (has_raw_fields()) MaterializeRawFields();
   if (fields_ == NULL) fields_ = new vector<UnknownField>;
   UnknownField field;
   field.number_ = number;
@@ -109,6 +226,7 @@ void UnknownFieldSet::AddFixed32(int number, uint32 value) {
 }
 
 void UnknownFieldSet::AddFixed64(int number, uint64 value) {
+  if (has_raw_fields()) MaterializeRawFields();
   if (fields_ == NULL) fields_ = new vector<UnknownField>;
   UnknownField field;
   field.number_ = number;
@@ -118,6 +236,7 @@ void UnknownFieldSet::AddFixed64(int number, uint64 value) {
 }
 
 string* UnknownFieldSet::AddLengthDelimited(int number) {
+  if (has_raw_fields()) MaterializeRawFields();
   if (fields_ == NULL) fields_ = new vector<UnknownField>;
   UnknownField field;
   field.number_ = number;
@@ -128,6 +247,7 @@ string* UnknownFieldSet::AddLengthDelimited(int number) {
 }
 
 UnknownFieldSet* UnknownFieldSet::AddGroup(int number) {
+  if (has_raw_fields()) MaterializeRawFields();
   if (fields_ == NULL) fields_ = new vector<UnknownField>;
   UnknownField field;
   field.number_ = number;
@@ -138,6 +258,7 @@ UnknownFieldSet* UnknownFieldSet::AddGroup(int number) {
 }
 
 void UnknownFieldSet::AddField(const UnknownField& field) {
+  if (has_raw_fields()) MaterializeRawFields();
   if (fields_ == NULL) fields_ = new vector<UnknownField>;
   fields_->push_back(field);
   fields_->back().DeepCopy();
@@ -146,6 +267,7 @@ void UnknownFieldSet::AddField(const UnknownField& field) {
 bool UnknownFieldSet::MergeFromCodedStream(io::CodedInputStream* input) {
 
   UnknownFieldSet other;
+  other.set_raw_storage(raw_storage_);
   if (internal::WireFormat::SkipMessage(input, &other) &&
                                   input->ConsumedEntireMessage()) {
     MergeFrom(other);
@@ -47,6 +47,9 @@ namespace protobuf {
 
 class Message;                      // message.h
 class UnknownField;                 // below
+namespace internal {
+  class WireFormat;                 // wire_format.h
+}
 
 // An UnknownFieldSet contains fields that were encountered while parsing a
 // message but were not defined by its type.  Keeping track of these can be
@@ -60,6 +63,26 @@ class UnknownField;                 // below
 //
 // This class is necessarily tied to the protocol buffer wire format, unlike
 // the Reflection interface which is independent of any serialization scheme.
+//
+// Raw storage
+//
+// A program which parses messages only to forward them, such as a proxy
+// built against an older version of the schema, can spend much of its time
+// building UnknownField objects which it then serializes again unchanged.
+// To avoid that, call set_raw_storage(true), or set the file option
+// cc_raw_unknown_fields for generated message classes.  The set then keeps
+// fields it parses as the bytes they were encoded in, all appended to one
+// buffer, and serializing writes that buffer back out with a single copy.
+// The fields are converted to UnknownField objects ("materialized") the
+// first time anything adds or modifies an individual field, and the set
+// behaves exactly as usual from then on.
+//
+// field_count() and field() do not modify the set, so like other const
+// methods they may be called from several threads at once.  The first of
+// them to see raw fields parses them into a separate list, under a lock,
+// and publishes it for later calls.  Serializing, computing sizes and
+// MergeFrom() never parse raw fields, except when writing unknown fields of
+// a MessageSet.
 class LIBPROTOBUF_EXPORT UnknownFieldSet {
  public:
   UnknownFieldSet();
@@ -85,6 +108,12 @@ class LIBPROTOBUF_EXPORT UnknownFieldSet {
   // Version of SpaceUsed() including sizeof(*this).
   int SpaceUsed() const;
 
+  // Should fields parsed into this set be kept in their serialized form?
+  // See "Raw storage", above.  Defaults to false.  Does not affect fields
+  // the set already contains, and is not changed by Clear() or Swap().
+  inline bool raw_storage() const;
+  inline void set_raw_storage(bool value);
+
   // Returns the number of fields present in the UnknownFieldSet.
   inline int field_count() const;
   // Get a field in the set, where 0 <= index < field_count().  The fields
@@ -119,9 +148,41 @@ class LIBPROTOBUF_EXPORT UnknownFieldSet {
   }
 
  private:
+  friend class internal::WireFormat;
+
   void ClearFallback();
 
+  // True if there are raw fields which have not been materialized yet.
+  inline bool has_raw_fields() const;
+  // Converts the raw fields to UnknownFields, appending them to fields_.
+  void MaterializeRawFields();
+  // Parses the raw fields, appending them to output.
+  void ParseRawFields(vector<UnknownField>* output) const;
+  // Returns the raw fields parsed into UnknownFields, parsing them on the
+  // first call.  Safe to call from several threads at once.
+  const vector<UnknownField>& parsed_raw_fields() const;
+  // Deletes parsed_raw_fields_, which no longer matches raw_fields_.
+  void DeleteParsedRawFields();
+  // Memory used by a list of fields, for SpaceUsedExcludingSelf().
+  static int FieldsSpaceUsed(const vector<UnknownField>& fields);
+
+  // Access for WireFormat, which serializes the materialized fields followed
+  // by the raw bytes without materializing anything.
+  inline int materialized_field_count() const;
+  inline const UnknownField& materialized_field(int index) const;
+  inline string* mutable_raw_fields();
+
+  // The fields added since construction or the last Clear(), in order:  all
+  // materialized fields come before all raw fields.  Each is NULL until
+  // first needed.
   vector<UnknownField>* fields_;
+  string* raw_fields_;
+  bool raw_storage_;
+
+  // The contents of raw_fields_ parsed for field() and field_count(), or
+  // NULL.  Written once by parsed_raw_fields(), with a release store, and
+  // discarded or moved into fields_ by anything which changes raw_fields_.
+  mutable vector<UnknownField>* parsed_raw_fields_;
 
   GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(UnknownFieldSet);
 };
@@ -183,29 +244,59 @@ class LIBPROTOBUF_EXPORT UnknownField {
 // inline implementations
 
 inline void UnknownFieldSet::Clear() {
-  if (fields_ != NULL) {
+  if (fields_ != NULL || raw_fields_ != NULL) {
     ClearFallback();
   }
 }
 
 inline bool UnknownFieldSet::empty() const {
-  return fields_ == NULL || fields_->empty();
+  return (fields_ == NULL || fields_->empty()) && !has_raw_fields();
 }
 
 inline void UnknownFieldSet::Swap(UnknownFieldSet* x) {
   std::swap(fields_, x->fields_);
+  std::swap(raw_fields_, x->raw_fields_);
+  std::swap(parsed_raw_fields_, x->parsed_raw_fields_);
+}
+
+inline bool UnknownFieldSet::raw_storage() const {
+  return raw_storage_;
+}
+inline void UnknownFieldSet::set_raw_storage(bool value) {
+  raw_storage_ = value;
 }
 
 inline int UnknownFieldSet::field_count() const {
-  return (fields_ == NULL) ? 0 : fields_->size();
+  int count = materialized_field_count();
+  if (has_raw_fields()) count += parsed_raw_fields().size();
+  return count;
 }
 inline const UnknownField& UnknownFieldSet::field(int index) const {
-  return (*fields_)[index];
+  int count = materialized_field_count();
+  if (index < count) return (*fields_)[index];
+  return parsed_raw_fields()[index - count];
 }
 inline UnknownField* UnknownFieldSet::mutable_field(int index) {
+  if (has_raw_fields()) MaterializeRawFields();
   return &(*fields_)[index];
 }
 
+inline bool UnknownFieldSet::has_raw_fields() const {
+  return raw_fields_ != NULL && !raw_fields_->empty();
+}
+inline int UnknownFieldSet::materialized_field_count() const {
+  return (fields_ == NULL) ? 0 : fields_->size();
+}
+inline const UnknownField& UnknownFieldSet::materialized_field(
+    int index) const {
+  return (*fields_)[index];
+}
+inline string* UnknownFieldSet::mutable_raw_fields() {
+  if (parsed_raw_fields_ != NULL) DeleteParsedRawFields();
+  if (raw_fields_ == NULL) raw_fields_ = new string;
+  return raw_fields_;
+}
+
 inline void UnknownFieldSet::AddLengthDelimited(
     int number, const string& value) {
   AddLengthDelimited(number)->assign(value);
@@ -41,6 +41,7 @@
 #include <google/protobuf/io/zero_copy_stream_impl.h>
 #include <google/protobuf/wire_format.h>
 #include <google/protobuf/unittest.pb.h>
+#include <google/protobuf/unittest_raw_unknown_fields.pb.h>
 #include <google/protobuf/test_util.h>
 
 #include <google/protobuf/stubs/common.h>
@@ -48,6 +49,12 @@
 #include <gtest/gtest.h>
 #include <google/protobuf/stubs/stl_util-inl.h>
 
+#include "config.h"
+
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#endif
+
 namespace google {
 namespace protobuf {
 
@@ -507,6 +514,260 @@ TEST_F(UnknownFieldSetTest, Empty) {
   EXPECT_TRUE(unknown_fields.empty());
 }
 
+// -------------------------------------------------------------------
+// Raw storage
+
+TEST_F(UnknownFieldSetTest, RawStorageRoundTrip) {
+  unittest::TestEmptyMessage raw_message;
+  raw_message.mutable_unknown_fields()->set_raw_storage(true);
+  ASSERT_TRUE(raw_message.ParseFromString(all_fields_data_));
+
+  EXPECT_TRUE(raw_message.unknown_fields().raw_storage());
+  EXPECT_FALSE(raw_message.unknown_fields().empty());
+  EXPECT_EQ(all_fields_data_.size(), raw_message.ByteSize());
+  EXPECT_EQ(all_fields_data_, raw_message.SerializeAsString());
+
+  // The array and stream serializers must agree.
+  string stream_data;
+  {
+    io::StringOutputStream raw_output(&stream_data);
+    io::CodedOutputStream output(&raw_output);
+    raw_message.SerializeWithCachedSizes(&output);
+  }
+  EXPECT_EQ(all_fields_data_, stream_data);
+}
+
+TEST_F(UnknownFieldSetTest, RawStorageMaterializes) {
+  // Enumerating a raw set must produce exactly what a non-raw parse does,
+  // groups included.
+  unittest::TestEmptyMessage raw_message;
+  raw_message.mutable_unknown_fields()->set_raw_storage(true);
+  ASSERT_TRUE(raw_message.ParseFromString(all_fields_data_));
+
+  const UnknownFieldSet& raw_fields = raw_message.unknown_fields();
+  ASSERT_EQ(unknown_fields_->field_count(), raw_fields.field_count());
+  for (int i = 0; i < raw_fields.field_count(); i++) {
+    const UnknownField& expected = unknown_fields_->field(i);
+    const UnknownField& actual = raw_fields.field(i);
+    EXPECT_EQ(expected.number(), actual.number());
+    ASSERT_EQ(expected.type(), actual.type());
+    switch (actual.type()) {
+      case UnknownField::TYPE_VARINT:
+        EXPECT_EQ(expected.varint(), actual.varint());
+        break;
+      case UnknownField::TYPE_FIXED32:
+        EXPECT_EQ(expected.fixed32(), actual.fixed32());
+        break;
+      case UnknownField::TYPE_FIXED64:
+        EXPECT_EQ(expected.fixed64(), actual.fixed64());
+        break;
+      case UnknownField::TYPE_LENGTH_DELIMITED:
+        EXPECT_EQ(expected.length_delimited(), actual.length_delimited());
+        break;
+      case UnknownField::TYPE_GROUP:
+        ASSERT_EQ(1, actual.group().field_count());
+        EXPECT_EQ(expected.group().field(0).varint(),
+                  actual.group().field(0).varint());
+        break;
+    }
+  }
+
+  // Once materialized, it still serializes the same way.
+  EXPECT_EQ(all_fields_data_, raw_message.SerializeAsString());
+}
+
+TEST_F(UnknownFieldSetTest, RawStorageAddKeepsOrder) {
+  UnknownFieldSet raw_fields;
+  raw_fields.set_raw_storage(true);
+  ASSERT_TRUE(raw_fields.ParseFromArray(all_fields_data_.data(),
+                                        all_fields_data_.size()));
+  int count = unknown_fields_->field_count();
+  raw_fields.AddVarint(123456, 654321);
+
+  ASSERT_EQ(count + 1, raw_fields.field_count());
+  EXPECT_EQ(unknown_fields_->field(0).number(), raw_fields.field(0).number());
+  EXPECT_EQ(123456, raw_fields.field(count).number());
+  EXPECT_EQ(654321, raw_fields.field(count).varint());
+}
+
+TEST_F(UnknownFieldSetTest, RawStorageReadThenModify) {
+  UnknownFieldSet raw_fields;
+  raw_fields.set_raw_storage(true);
+  ASSERT_TRUE(raw_fields.ParseFromArray(all_fields_data_.data(),
+                                        all_fields_data_.size()));
+  int count = unknown_fields_->field_count();
+
+  // Reading parses the raw fields without materializing them; adding a
+  // field then materializes them from that parse.
+  ASSERT_EQ(count, raw_fields.field_count());
+  raw_fields.AddVarint(123456, 654321);
+  ASSERT_EQ(count + 1, raw_fields.field_count());
+  EXPECT_EQ(unknown_fields_->field(0).number(), raw_fields.field(0).number());
+  EXPECT_EQ(654321, raw_fields.field(count).varint());
+
+  // Raw fields parsed after a read are seen by the next one.
+  UnknownFieldSet more_raw_fields;
+  more_raw_fields.set_raw_storage(true);
+  ASSERT_TRUE(more_raw_fields.ParseFromArray(all_fields_data_.data(),
+                                             all_fields_data_.size()));
+  ASSERT_EQ(count, more_raw_fields.field_count());
+  io::CodedInputStream input(
+      reinterpret_cast<const uint8*>(all_fields_data_.data()),
+      all_fields_data_.size());
+  ASSERT_TRUE(more_raw_fields.MergeFromCodedStream(&input));
+  ASSERT_EQ(count * 2, more_raw_fields.field_count());
+  EXPECT_EQ(unknown_fields_->field(0).number(),
+            more_raw_fields.field(count).number());
+  more_raw_fields.Clear();
+  EXPECT_EQ(0, more_raw_fields.field_count());
+}
+
+#ifdef HAVE_PTHREAD
+
+struct ConcurrentReadState {
+  const UnknownFieldSet* fields;
+  int number_sum;
+};
+
+void* SumFieldNumbers(void* arg) {
+  ConcurrentReadState* state = reinterpret_cast<ConcurrentReadState*>(arg);
+  state->number_sum = 0;
+  for (int i = 0; i < state->fields->field_count(); i++) {
+    state->number_sum += state->fields->field(i).number();
+  }
+  return NULL;
+}
+
+TEST_F(UnknownFieldSetTest, RawStorageConcurrentReads) {
+  // Several threads reading a raw set at once must each see every field.
+  int expected_sum = 0;
+  for (int i = 0; i < unknown_fields_->field_count(); i++) {
+    expected_sum += unknown_fields_->field(i).number();
+  }
+
+  const int kThreadCount = 4;
+  for (int attempt = 0; attempt < 50; attempt++) {
+    UnknownFieldSet raw_fields;
+    raw_fields.set_raw_storage(true);
+    ASSERT_TRUE(raw_fields.ParseFromArray(all_fields_data_.data(),
+                                          all_fields_data_.size()));
+
+    pthread_t threads[kThreadCount];
+    ConcurrentReadState states[kThreadCount];
+    for (int i = 0; i < kThreadCount; i++) {
+      states[i].fields = &raw_fields;
+      ASSERT_EQ(0, pthread_create(&threads[i], NULL, &SumFieldNumbers,
+                                  &states[i]));
+    }
+    for (int i = 0; i < kThreadCount; i++) {
+      pthread_join(threads[i], NULL);
+      EXPECT_EQ(expected_sum, states[i].number_sum);
+    }
+  }
+}
+
+#endif  // HAVE_PTHREAD
+
+TEST_F(UnknownFieldSetTest, RawStorageMergeFrom) {
+  unittest::TestEmptyMessage raw_message;
+  raw_message.mutable_unknown_fields()->set_raw_storage(true);
+  raw_message.mutable_unknown_fields()->AddVarint(1, 2);
+  io::CodedInputStream input(
+      reinterpret_cast<const uint8*>(all_fields_data_.data()),
+      all_fields_data_.size());
+  ASSERT_TRUE(raw_message.MergeFromCodedStream(&input));
+
+  // Raw into materialized.
+  unittest::TestEmptyMessage destination;
+  destination.mutable_unknown_fields()->AddVarint(3, 4);
+  destination.MergeFrom(raw_message);
+
+  unittest::TestEmptyMessage expected;
+  expected.mutable_unknown_fields()->AddVarint(3, 4);
+  expected.mutable_unknown_fields()->AddVarint(1, 2);
+  expected.mutable_unknown_fields()->MergeFrom(*unknown_fields_);
+  EXPECT_EQ(expected.SerializeAsString(), destination.SerializeAsString());
+
+  // Raw into raw.
+  unittest::TestEmptyMessage raw_destination;
+  raw_destination.mutable_unknown_fields()->set_raw_storage(true);
+  raw_destination.MergeFrom(raw_message);
+  raw_destination.MergeFrom(raw_message);
+  EXPECT_EQ(raw_message.SerializeAsString() + raw_message.SerializeAsString(),
+            raw_destination.SerializeAsString());
+}
+
+TEST_F(UnknownFieldSetTest, RawStorageSwapAndClear) {
+  UnknownFieldSet raw_fields;
+  raw_fields.set_raw_storage(true);
+  ASSERT_TRUE(raw_fields.ParseFromArray(all_fields_data_.data(),
+                                        all_fields_data_.size()));
+
+  UnknownFieldSet other;
+  other.AddVarint(1, 2);
+  raw_fields.Swap(&other);
+
+  // The storage mode stays with the set; only the contents move.
+  EXPECT_TRUE(raw_fields.raw_storage());
+  EXPECT_FALSE(other.raw_storage());
+  ASSERT_EQ(1, raw_fields.field_count());
+  EXPECT_EQ(2, raw_fields.field(0).varint());
+  EXPECT_EQ(unknown_fields_->field_count(), other.field_count());
+
+  other.Swap(&raw_fields);
+  EXPECT_EQ(1, other.field_count());
+  EXPECT_FALSE(raw_fields.empty());
+  raw_fields.Clear();
+  EXPECT_TRUE(raw_fields.empty());
+  EXPECT_EQ(0, raw_fields.field_count());
+  EXPECT_TRUE(raw_fields.raw_storage());
+}
+
+TEST_F(UnknownFieldSetTest, RawStorageSpaceUsed) {
+  unittest::TestEmptyMessage raw_message;
+  raw_message.mutable_unknown_fields()->set_raw_storage(true);
+  int base_size = raw_message.SpaceUsed();
+  ASSERT_TRUE(raw_message.ParseFromString(all_fields_data_));
+  EXPECT_LT(base_size + static_cast<int>(all_fields_data_.size()),
+            raw_message.SpaceUsed());
+
+  // Keeping the bytes is cheaper than one allocation per field.
+  EXPECT_LT(raw_message.SpaceUsed(), empty_message_.SpaceUsed());
+}
+
+TEST_F(UnknownFieldSetTest, RawStorageTruncated) {
+  unittest::TestEmptyMessage raw_message;
+  raw_message.mutable_unknown_fields()->set_raw_storage(true);
+  for (int i = 1; i < all_fields_data_.size(); i++) {
+    // Not every prefix is invalid, but any that parses must round-trip.
+    string prefix = all_fields_data_.substr(0, i);
+    if (raw_message.ParseFromString(prefix)) {
+      EXPECT_EQ(prefix, raw_message.SerializeAsString());
+    }
+  }
+  EXPECT_FALSE(raw_message.ParseFromString(
+      all_fields_data_.substr(0, all_fields_data_.size() - 1)));
+}
+
+TEST_F(UnknownFieldSetTest, RawStorageFileOption) {
+  unittest::TestRawUnknownFields message;
+  EXPECT_TRUE(message.unknown_fields().raw_storage());
+  ASSERT_TRUE(message.ParseFromString(all_fields_data_));
+  EXPECT_EQ(all_fields_.optional_int32(), message.optional_int32());
+  EXPECT_EQ(all_fields_.optional_string(), message.optional_string());
+  EXPECT_EQ(all_fields_.repeated_int32_size(), message.repeated_int32_size());
+
+  unittest::TestAllTypes all_types;
+  ASSERT_TRUE(all_types.ParseFromString(message.SerializeAsString()));
+  TestUtil::ExpectAllFieldsSet(all_types);
+
+  // Copies keep the fields too.
+  unittest::TestRawUnknownFields copy;
+  copy.CopyFrom(message);
+  ASSERT_TRUE(all_types.ParseFromString(copy.SerializeAsString()));
+  TestUtil::ExpectAllFieldsSet(all_types);
+}
+
 }  // namespace
 }  // namespace protobuf
 }  // namespace google
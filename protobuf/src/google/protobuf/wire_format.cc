@@ -32,6 +32,7 @@
 //  Based on original Protocol Buffers design by
 //  Sanjay Ghemawat, Jeff Dean, and others.
 
+#include <algorithm>
 #include <stack>
 #include <string>
 #include <vector>
@@ -39,9 +40,12 @@
 #include <google/protobuf/wire_format.h>
 
 #include <google/protobuf/stubs/common.h>
+#include <google/protobuf/stubs/atomicops.h>
+#include <google/protobuf/stubs/once.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/wire_format_lite_inl.h>
 #include <google/protobuf/descriptor.pb.h>
+#include <google/protobuf/extension_set.h>
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/io/zero_copy_stream.h>
 #include <google/protobuf/io/zero_copy_stream_impl.h>
@@ -61,6 +65,81 @@ inline int GetEnumNumber(const EnumValueDescriptor* descriptor) {
   return descriptor->number();
 }
 
+// Reads the value of a field whose tag has just been read from input, and
+// appends the field to *output as it is encoded on the wire.  Used instead
+// of WireFormat::SkipField() for UnknownFieldSets with raw storage.
+bool CopyField(io::CodedInputStream* input, uint32 tag, string* output) {
+  // Enough for a tag followed by a varint or fixed64 value.
+  uint8 buffer[16];
+  uint8* end = io::CodedOutputStream::WriteTagToArray(tag, buffer);
+
+  switch (WireFormatLite::GetTagWireType(tag)) {
+    case WireFormatLite::WIRETYPE_VARINT: {
+      uint64 value;
+      if (!input->ReadVarint64(&value)) return false;
+      end = io::CodedOutputStream::WriteVarint64ToArray(value, end);
+      output->append(reinterpret_cast<char*>(buffer), end - buffer);
+      return true;
+    }
+    case WireFormatLite::WIRETYPE_FIXED64: {
+      uint64 value;
+      if (!input->ReadLittleEndian64(&value)) return false;
+      end = io::CodedOutputStream::WriteLittleEndian64ToArray(value, end);
+      output->append(reinterpret_cast<char*>(buffer), end - buffer);
+      return true;
+    }
+    case WireFormatLite::WIRETYPE_LENGTH_DELIMITED: {
+      uint32 length;
+      if (!input->ReadVarint32(&length)) return false;
+      end = io::CodedOutputStream::WriteVarint32ToArray(length, end);
+      output->append(reinterpret_cast<char*>(buffer), end - buffer);
+
+      // Copy straight out of the stream's buffer.  Appending in pieces,
+      // rather than resizing output to the declared length up front, means
+      // a corrupt length cannot make us allocate more than the input holds.
+      while (length > 0) {
+        const void* data;
+        int size;
+        if (!input->GetDirectBufferPointer(&data, &size)) return false;
+        int chunk = min<uint32>(size, length);
+        output->append(reinterpret_cast<const char*>(data), chunk);
+        input->Skip(chunk);
+        length -= chunk;
+      }
+      return true;
+    }
+    case WireFormatLite::WIRETYPE_START_GROUP: {
+      output->append(reinterpret_cast<char*>(buffer), end - buffer);
+      if (!input->IncrementRecursionDepth()) return false;
+      uint32 end_tag = WireFormatLite::MakeTag(
+          WireFormatLite::GetTagFieldNumber(tag),
+          WireFormatLite::WIRETYPE_END_GROUP);
+      while (true) {
+        uint32 field_tag = input->ReadTag();
+        if (field_tag == end_tag) break;
+        // Like SkipField(), fail on end of input or a mismatched end tag.
+        if (field_tag == 0) return false;
+        if (!CopyField(input, field_tag, output)) return false;
+      }
+      input->DecrementRecursionDepth();
+      end = io::CodedOutputStream::WriteTagToArray(end_tag, buffer);
+      output->append(reinterpret_cast<char*>(buffer), end - buffer);
+      return true;
+    }
+    case WireFormatLite::WIRETYPE_FIXED32: {
+      uint32 value;
+      if (!input->ReadLittleEndian32(&value)) return false;
+      end = io::CodedOutputStream::WriteLittleEndian32ToArray(value, end);
+      output->append(reinterpret_cast<char*>(buffer), end - buffer);
+      return true;
+    }
+    default: {
+      // WIRETYPE_END_GROUP or invalid.
+      return false;
+    }
+  }
+}
+
 }  // anonymous namespace
 
 // ===================================================================
@@ -81,6 +160,10 @@ void UnknownFieldSetFieldSkipper::SkipUnknownEnum(
 
 bool WireFormat::SkipField(io::CodedInputStream* input, uint32 tag,
                            UnknownFieldSet* unknown_fields) {
+  if (unknown_fields != NULL && unknown_fields->raw_storage()) {
+    return CopyField(input, tag, unknown_fields->mutable_raw_fields());
+  }
+
   int number = WireFormatLite::GetTagFieldNumber(tag);
 
   switch (WireFormatLite::GetTagWireType(tag)) {
@@ -161,8 +244,8 @@ bool WireFormat::SkipMessage(io::CodedInputStream* input,
 
 void WireFormat::SerializeUnknownFields(const UnknownFieldSet& unknown_fields,
                                         io::CodedOutputStream* output) {
-  for (int i = 0; i < unknown_fields.field_count(); i++) {
-    const UnknownField& field = unknown_fields.field(i);
+  for (int i = 0; i < unknown_fields.materialized_field_count(); i++) {
+    const UnknownField& field = unknown_fields.materialized_field(i);
     switch (field.type()) {
       case UnknownField::TYPE_VARINT:
         output->WriteVarint32(WireFormatLite::MakeTag(field.number(),
@@ -194,13 +277,16 @@ void WireFormat::SerializeUnknownFields(const UnknownFieldSet& unknown_fields,
         break;
     }
   }
+  if (unknown_fields.has_raw_fields()) {
+    output->WriteString(*unknown_fields.raw_fields_);
+  }
 }
 
 uint8* WireFormat::SerializeUnknownFieldsToArray(
     const UnknownFieldSet& unknown_fields,
     uint8* target) {
-  for (int i = 0; i < unknown_fields.field_count(); i++) {
-    const UnknownField& field = unknown_fields.field(i);
+  for (int i = 0; i < unknown_fields.materialized_field_count(); i++) {
+    const UnknownField& field = unknown_fields.materialized_field(i);
 
     switch (field.type()) {
       case UnknownField::TYPE_VARINT:
@@ -228,6 +314,10 @@ uint8* WireFormat::SerializeUnknownFieldsToArray(
         break;
     }
   }
+  if (unknown_fields.has_raw_fields()) {
+    target = io::CodedOutputStream::WriteStringToArray(
+        *unknown_fields.raw_fields_, target);
+  }
   return target;
 }
 
@@ -298,8 +388,11 @@ uint8* WireFormat::SerializeUnknownMessageSetItemsToArray(
 int WireFormat::ComputeUnknownFieldsSize(
     const UnknownFieldSet& unknown_fields) {
   int size = 0;
-  for (int i = 0; i < unknown_fields.field_count(); i++) {
-    const UnknownField& field = unknown_fields.field(i);
+  if (unknown_fields.has_raw_fields()) {
+    size += unknown_fields.raw_fields_->size();
+  }
+  for (int i = 0; i < unknown_fields.materialized_field_count(); i++) {
+    const UnknownField& field = unknown_fields.materialized_field(i);
 
     switch (field.type()) {
       case UnknownField::TYPE_VARINT:
@@ -707,6 +800,425 @@ bool WireFormat::ParseAndMergeMessageSetItem(
 
 // ===================================================================
 
+// What WireFormat::ByteSize() and WireFormat::SerializeWithCachedSizes() do
+// for messages of one type:  a step for each field, in field number order,
+// with a step for each extension range in its place among them.  Each step
+// has its tags worked out and points at functions for its field's type, so
+// following the plan needs no ListFields() and no switching on types.
+class WireFormatPlan {
+ public:
+  explicit WireFormatPlan(const Descriptor* descriptor);
+
+  struct Step;
+
+  // Computes the size of the count values of a field, excluding tags.  For
+  // messages and strings, the lengths are included.
+  typedef int (*DataSizeFunction)(const Reflection* reflection,
+                                  const Message& message,
+                                  const FieldDescriptor* field, int count);
+  // Writes the count values of step.field, with their tags.
+  typedef void (*WriteFunction)(const Step& step,
+                                const Reflection* reflection,
+                                const Message& message, int count,
+                                io::CodedOutputStream* output);
+
+  struct Step {
+    const FieldDescriptor* field;  // NULL for a range of extensions.
+    int start_number;              // The range of extension numbers,
+    int end_number;                //   exclusive of end_number.
+
+    uint32 tag;     // Written before each value, or before a packed field.
+    int tag_size;   // The size of the tag(s) around each value, or of the
+                    // tag before a packed field.
+    bool packed;
+    DataSizeFunction data_size;
+    WriteFunction write;
+  };
+
+  // Computes the size of the message's fields and extensions.  extensions
+  // must be non-NULL if the type has extension ranges.
+  int ByteSize(const Reflection* reflection, const Message& message,
+               const ExtensionSet* extensions) const;
+  // Writes the message's fields and extensions, using cached sizes.
+  void SerializeWithCachedSizes(const Reflection* reflection,
+                                const Message& message,
+                                const ExtensionSet* extensions,
+                                io::CodedOutputStream* output) const;
+
+  bool has_extension_ranges() const { return has_extension_ranges_; }
+
+ private:
+  vector<Step> steps_;
+  bool has_extension_ranges_;
+
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(WireFormatPlan);
+};
+
+namespace {
+
+// Step functions for each field type.  These read the field through
+// Reflection, as SerializeFieldWithCachedSizes() and FieldDataOnlyByteSize()
+// do.
+
+#define HANDLE_WRITE(TYPE_METHOD, CPPTYPE_METHOD)                            \
+  void Write##TYPE_METHOD##Values(const WireFormatPlan::Step& step,          \
+                                  const Reflection* reflection,              \
+                                  const Message& message, int count,         \
+                                  io::CodedOutputStream* output) {           \
+    const FieldDescriptor* field = step.field;                               \
+    if (!field->is_repeated()) {                                             \
+      output->WriteTag(step.tag);                                            \
+      WireFormatLite::Write##TYPE_METHOD##NoTag(                             \
+          reflection->Get##CPPTYPE_METHOD(message, field), output);          \
+      return;                                                                \
+    }                                                                        \
+    if (step.packed) {                                                       \
+      output->WriteTag(step.tag);                                            \
+      output->WriteVarint32(                                                 \
+          TYPE_METHOD##DataSize(reflection, message, field, count));         \
+    }                                                                        \
+    for (int i = 0; i < count; i++) {                                        \
+      if (!step.packed) output->WriteTag(step.tag);                          \
+      WireFormatLite::Write##TYPE_METHOD##NoTag(                             \
+          reflection->GetRepeated##CPPTYPE_METHOD(message, field, i),        \
+          output);                                                           \
+    }                                                                        \
+  }
+
+#define HANDLE_VARINT_TYPE(TYPE_METHOD, CPPTYPE_METHOD)                      \
+  int TYPE_METHOD##DataSize(const Reflection* reflection,                    \
+                            const Message& message,                          \
+                            const FieldDescriptor* field, int count) {       \
+    if (!field->is_repeated()) {                                             \
+      return WireFormatLite::TYPE_METHOD##Size(                              \
+          reflection->Get##CPPTYPE_METHOD(message, field));                  \
+    }                                                                        \
+    int size = 0;                                                            \
+    for (int i = 0; i < count; i++) {                                        \
+      size += WireFormatLite::TYPE_METHOD##Size(                             \
+          reflection->GetRepeated##CPPTYPE_METHOD(message, field, i));       \
+    }                                                                        \
+    return size;                                                             \
+  }                                                                          \
+  HANDLE_WRITE(TYPE_METHOD, CPPTYPE_METHOD)
+
+#define HANDLE_FIXED_TYPE(TYPE_METHOD, CPPTYPE_METHOD)                       \
+  int TYPE_METHOD##DataSize(const Reflection* reflection,                    \
+                            const Message& message,                          \
+                            const FieldDescriptor* field, int count) {       \
+    return count * WireFormatLite::k##TYPE_METHOD##Size;                     \
+  }                                                                          \
+  HANDLE_WRITE(TYPE_METHOD, CPPTYPE_METHOD)
+
+HANDLE_VARINT_TYPE( Int32,  Int32)
+HANDLE_VARINT_TYPE( Int64,  Int64)
+HANDLE_VARINT_TYPE(SInt32,  Int32)
+HANDLE_VARINT_TYPE(SInt64,  Int64)
+HANDLE_VARINT_TYPE(UInt32, UInt32)
+HANDLE_VARINT_TYPE(UInt64, UInt64)
+
+HANDLE_FIXED_TYPE( Fixed32, UInt32)
+HANDLE_FIXED_TYPE( Fixed64, UInt64)
+HANDLE_FIXED_TYPE(SFixed32,  Int32)
+HANDLE_FIXED_TYPE(SFixed64,  Int64)
+
+HANDLE_FIXED_TYPE(Float , Float )
+HANDLE_FIXED_TYPE(Double, Double)
+
+HANDLE_FIXED_TYPE(Bool, Bool)
+
+#undef HANDLE_FIXED_TYPE
+#undef HANDLE_VARINT_TYPE
+#undef HANDLE_WRITE
+
+int EnumDataSize(const Reflection* reflection, const Message& message,
+                 const FieldDescriptor* field, int count) {
+  if (!field->is_repeated()) {
+    return WireFormatLite::EnumSize(
+        reflection->GetEnum(message, field)->number());
+  }
+  int size = 0;
+  for (int i = 0; i < count; i++) {
+    size += WireFormatLite::EnumSize(
+        reflection->GetRepeatedEnum(message, field, i)->number());
+  }
+  return size;
+}
+
+void WriteEnumValues(const WireFormatPlan::Step& step,
+                     const Reflection* reflection, const Message& message,
+                     int count, io::CodedOutputStream* output) {
+  const FieldDescriptor* field = step.field;
+  if (!field->is_repeated()) {
+    output->WriteTag(step.tag);
+    WireFormatLite::WriteEnumNoTag(
+        reflection->GetEnum(message, field)->number(), output);
+    return;
+  }
+  if (step.packed) {
+    output->WriteTag(step.tag);
+    output->WriteVarint32(EnumDataSize(reflection, message, field, count));
+  }
+  for (int i = 0; i < count; i++) {
+    if (!step.packed) output->WriteTag(step.tag);
+    WireFormatLite::WriteEnumNoTag(
+        reflection->GetRepeatedEnum(message, field, i)->number(), output);
+  }
+}
+
+// Strings and bytes are read by reference, so that they aren't copied.
+int StringDataSize(const Reflection* reflection, const Message& message,
+                   const FieldDescriptor* field, int count) {
+  string scratch;
+  if (!field->is_repeated()) {
+    return WireFormatLite::StringSize(
+        reflection->GetStringReference(message, field, &scratch));
+  }
+  int size = 0;
+  for (int i = 0; i < count; i++) {
+    size += WireFormatLite::StringSize(
+        reflection->GetRepeatedStringReference(message, field, i, &scratch));
+  }
+  return size;
+}
+
+void WriteStringValues(const WireFormatPlan::Step& step,
+                       const Reflection* reflection, const Message& message,
+                       int count, io::CodedOutputStream* output) {
+  const FieldDescriptor* field = step.field;
+  const bool verify_utf8 = field->type() == FieldDescriptor::TYPE_STRING;
+  string scratch;
+  for (int i = 0; i < count; i++) {
+    const string& value = field->is_repeated() ?
+      reflection->GetRepeatedStringReference(message, field, i, &scratch) :
+      reflection->GetStringReference(message, field, &scratch);
+    if (verify_utf8) {
+      WireFormat::VerifyUTF8String(value.data(), value.length(),
+                                   WireFormat::SERIALIZE);
+    }
+    output->WriteTag(step.tag);
+    output->WriteVarint32(value.size());
+    output->WriteString(value);
+  }
+}
+
+// Sub-messages call ByteSize() here, which caches the sizes that
+// WriteGroupMaybeToArray() and WriteMessageMaybeToArray() use.
+#define HANDLE_MESSAGE_TYPE(TYPE_METHOD)                                     \
+  int TYPE_METHOD##DataSize(const Reflection* reflection,                    \
+                            const Message& message,                          \
+                            const FieldDescriptor* field, int count) {       \
+    if (!field->is_repeated()) {                                             \
+      return WireFormatLite::TYPE_METHOD##Size(                              \
+          reflection->GetMessage(message, field));                           \
+    }                                                                        \
+    int size = 0;                                                            \
+    for (int i = 0; i < count; i++) {                                        \
+      size += WireFormatLite::TYPE_METHOD##Size(                             \
+          reflection->GetRepeatedMessage(message, field, i));                \
+    }                                                                        \
+    return size;                                                             \
+  }                                                                          \
+                                                                             \
+  void Write##TYPE_METHOD##Values(const WireFormatPlan::Step& step,          \
+                                  const Reflection* reflection,              \
+                                  const Message& message, int count,         \
+                                  io::CodedOutputStream* output) {           \
+    const FieldDescriptor* field = step.field;                               \
+    for (int i = 0; i < count; i++) {                                        \
+      WireFormatLite::Write##TYPE_METHOD##MaybeToArray(                      \
+          field->number(),                                                   \
+          field->is_repeated() ?                                             \
+            reflection->GetRepeatedMessage(message, field, i) :              \
+            reflection->GetMessage(message, field),                          \
+          output);                                                           \
+    }                                                                        \
+  }
+
+HANDLE_MESSAGE_TYPE(Group  )
+HANDLE_MESSAGE_TYPE(Message)
+
+#undef HANDLE_MESSAGE_TYPE
+
+bool CompareFieldNumbers(const FieldDescriptor* a, const FieldDescriptor* b) {
+  return a->number() < b->number();
+}
+
+bool CompareExtensionRanges(const Descriptor::ExtensionRange* a,
+                            const Descriptor::ExtensionRange* b) {
+  return a->start < b->start;
+}
+
+// The mutex under which plans are built.
+Mutex* plan_mutex_ = NULL;
+GOOGLE_PROTOBUF_DECLARE_ONCE(plan_mutex_init_);
+
+void DeletePlanMutex() {
+  delete plan_mutex_;
+  plan_mutex_ = NULL;
+}
+
+void InitPlanMutex() {
+  plan_mutex_ = new Mutex;
+  internal::OnShutdown(&DeletePlanMutex);
+}
+
+}  // namespace
+
+WireFormatPlan::WireFormatPlan(const Descriptor* descriptor)
+  : has_extension_ranges_(descriptor->extension_range_count() > 0) {
+  vector<const FieldDescriptor*> fields;
+  for (int i = 0; i < descriptor->field_count(); i++) {
+    fields.push_back(descriptor->field(i));
+  }
+  sort(fields.begin(), fields.end(), CompareFieldNumbers);
+
+  vector<const Descriptor::ExtensionRange*> ranges;
+  for (int i = 0; i < descriptor->extension_range_count(); i++) {
+    ranges.push_back(descriptor->extension_range(i));
+  }
+  sort(ranges.begin(), ranges.end(), CompareExtensionRanges);
+
+  int next_range = 0;
+  for (int i = 0; i <= fields.size(); i++) {
+    // Extension ranges go before the first field which follows them.
+    while (next_range < ranges.size() &&
+           (i == fields.size() ||
+            ranges[next_range]->start < fields[i]->number())) {
+      Step step;
+      memset(&step, 0, sizeof(step));
+      step.start_number = ranges[next_range]->start;
+      step.end_number = ranges[next_range]->end;
+      steps_.push_back(step);
+      ++next_range;
+    }
+    if (i == fields.size()) break;
+
+    const FieldDescriptor* field = fields[i];
+    Step step;
+    memset(&step, 0, sizeof(step));
+    step.field = field;
+    step.packed = field->options().packed();
+    step.tag = WireFormat::MakeTag(field);
+    if (step.packed) {
+      step.tag_size =
+          WireFormat::TagSize(field->number(), FieldDescriptor::TYPE_STRING);
+    } else {
+      step.tag_size = WireFormat::TagSize(field->number(), field->type());
+    }
+
+    switch (field->type()) {
+#define HANDLE_TYPE(TYPE, TYPE_METHOD)                                       \
+      case FieldDescriptor::TYPE_##TYPE:                                     \
+        step.data_size = &TYPE_METHOD##DataSize;                             \
+        step.write = &Write##TYPE_METHOD##Values;                            \
+        break;
+
+      HANDLE_TYPE( INT32,  Int32)
+      HANDLE_TYPE( INT64,  Int64)
+      HANDLE_TYPE(SINT32, SInt32)
+      HANDLE_TYPE(SINT64, SInt64)
+      HANDLE_TYPE(UINT32, UInt32)
+      HANDLE_TYPE(UINT64, UInt64)
+
+      HANDLE_TYPE( FIXED32,  Fixed32)
+      HANDLE_TYPE( FIXED64,  Fixed64)
+      HANDLE_TYPE(SFIXED32, SFixed32)
+      HANDLE_TYPE(SFIXED64, SFixed64)
+
+      HANDLE_TYPE(FLOAT , Float )
+      HANDLE_TYPE(DOUBLE, Double)
+
+      HANDLE_TYPE(BOOL, Bool)
+      HANDLE_TYPE(ENUM, Enum)
+
+      HANDLE_TYPE(STRING, String)
+      HANDLE_TYPE(BYTES , String)
+
+      HANDLE_TYPE(GROUP  , Group  )
+      HANDLE_TYPE(MESSAGE, Message)
+#undef HANDLE_TYPE
+    }
+    steps_.push_back(step);
+  }
+}
+
+int WireFormatPlan::ByteSize(const Reflection* reflection,
+                             const Message& message,
+                             const ExtensionSet* extensions) const {
+  int size = 0;
+  for (int i = 0; i < steps_.size(); i++) {
+    const Step& step = steps_[i];
+    const FieldDescriptor* field = step.field;
+    if (field == NULL) continue;
+
+    int count;
+    if (field->is_repeated()) {
+      count = reflection->FieldSize(message, field);
+    } else {
+      count = reflection->HasField(message, field) ? 1 : 0;
+    }
+    if (count == 0) continue;
+
+    const int data_size = step.data_size(reflection, message, field, count);
+    if (step.packed) {
+      size += step.tag_size + io::CodedOutputStream::VarintSize32(data_size);
+    } else {
+      size += count * step.tag_size;
+    }
+    size += data_size;
+  }
+  if (extensions != NULL) size += extensions->ByteSize();
+  return size;
+}
+
+void WireFormatPlan::SerializeWithCachedSizes(
+    const Reflection* reflection, const Message& message,
+    const ExtensionSet* extensions, io::CodedOutputStream* output) const {
+  for (int i = 0; i < steps_.size(); i++) {
+    const Step& step = steps_[i];
+    const FieldDescriptor* field = step.field;
+    if (field == NULL) {
+      if (extensions != NULL) {
+        extensions->SerializeWithCachedSizes(
+            step.start_number, step.end_number, output);
+      }
+      continue;
+    }
+
+    int count;
+    if (field->is_repeated()) {
+      count = reflection->FieldSize(message, field);
+    } else {
+      count = reflection->HasField(message, field) ? 1 : 0;
+    }
+    if (count == 0) continue;
+
+    step.write(step, reflection, message, count, output);
+  }
+}
+
+const WireFormatPlan* WireFormat::GetPlan(
+    const Descriptor* descriptor, const WireFormatPlan* volatile* cache) {
+  const WireFormatPlan* plan = Acquire_Load(cache);
+  if (plan != NULL) return plan;
+
+  ::google::protobuf::GoogleOnceInit(&plan_mutex_init_, &InitPlanMutex);
+  MutexLock lock(plan_mutex_);
+  plan = *cache;
+  if (plan == NULL) {
+    plan = new WireFormatPlan(descriptor);
+    Release_Store(cache, plan);
+  }
+  return plan;
+}
+
+void WireFormat::DeletePlan(const WireFormatPlan* plan) {
+  delete plan;
+}
+
+// ===================================================================
+
 void WireFormat::SerializeWithCachedSizes(
     const Message& message,
     int size, io::CodedOutputStream* output) {
@@ -714,10 +1226,21 @@ void WireFormat::SerializeWithCachedSizes(
   const Reflection* message_reflection = message.GetReflection();
   int expected_endpoint = output->ByteCount() + size;
 
-  vector<const FieldDescriptor*> fields;
-  message_reflection->ListFields(message, &fields);
-  for (int i = 0; i < fields.size(); i++) {
-    SerializeFieldWithCachedSizes(fields[i], message, output);
+  const WireFormatPlan* plan = NULL;
+  const ExtensionSet* extensions = NULL;
+  if (!descriptor->options().message_set_wire_format()) {
+    plan = message_reflection->GetWireFormatPlan();
+    extensions = message_reflection->GetExtensionSetForWireFormat(message);
+  }
+  if (plan != NULL && (extensions != NULL || !plan->has_extension_ranges())) {
+    plan->SerializeWithCachedSizes(message_reflection, message, extensions,
+                                   output);
+  } else {
+    vector<const FieldDescriptor*> fields;
+    message_reflection->ListFields(message, &fields);
+    for (int i = 0; i < fields.size(); i++) {
+      SerializeFieldWithCachedSizes(fields[i], message, output);
+    }
   }
 
   if (descriptor->options().message_set_wire_format()) {
@@ -884,10 +1407,20 @@ int WireFormat::ByteSize(const Message& message) {
 
   int our_size = 0;
 
-  vector<const FieldDescriptor*> fields;
-  message_reflection->ListFields(message, &fields);
-  for (int i = 0; i < fields.size(); i++) {
-    our_size += FieldByteSize(fields[i], message);
+  const WireFormatPlan* plan = NULL;
+  const ExtensionSet* extensions = NULL;
+  if (!descriptor->options().message_set_wire_format()) {
+    plan = message_reflection->GetWireFormatPlan();
+    extensions = message_reflection->GetExtensionSetForWireFormat(message);
+  }
+  if (plan != NULL && (extensions != NULL || !plan->has_extension_ranges())) {
+    our_size += plan->ByteSize(message_reflection, message, extensions);
+  } else {
+    vector<const FieldDescriptor*> fields;
+    message_reflection->ListFields(message, &fields);
+    for (int i = 0; i < fields.size(); i++) {
+      our_size += FieldByteSize(fields[i], message);
+    }
   }
 
   if (descriptor->options().message_set_wire_format()) {
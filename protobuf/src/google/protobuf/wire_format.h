@@ -62,6 +62,8 @@ namespace protobuf {
 namespace protobuf {
 namespace internal {
 
+class WireFormatPlan;            // wire_format.cc
+
 // This class is for internal use by the protocol buffer library and by
 // protocol-complier-generated message classes.  It must not be called
 // directly by clients.
@@ -123,6 +125,17 @@ class LIBPROTOBUF_EXPORT WireFormat {
   // WireFormat::SerializeWithCachedSizes() on the same object.
   static int ByteSize(const Message& message);
 
+  // SerializeWithCachedSizes() and ByteSize() follow a plan, worked out once
+  // per message type, rather than calling ListFields() (which allocates and
+  // sorts) on every message.  A Reflection which supports this keeps the
+  // plan in *cache, which must start out NULL, and returns GetPlan()'s result
+  // from Reflection::GetWireFormatPlan().  The plan is built on first use;
+  // this is thread-safe.
+  static const WireFormatPlan* GetPlan(const Descriptor* descriptor,
+                                       const WireFormatPlan* volatile* cache);
+  // Deletes a plan built by GetPlan().  NULL is allowed.
+  static void DeletePlan(const WireFormatPlan* plan);
+
   // -----------------------------------------------------------------
   // Helpers for dealing with unknown fields
 
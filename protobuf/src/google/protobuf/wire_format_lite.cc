@@ -290,6 +290,13 @@ void WireFormatLite::WriteBytes(int field_number, const string& value,
   output->WriteVarint32(value.size());
   output->WriteString(value);
 }
+void WireFormatLite::WriteStringPiece(int field_number,
+                                      const StringPieceField& value,
+                                      io::CodedOutputStream* output) {
+  WriteTag(field_number, WIRETYPE_LENGTH_DELIMITED, output);
+  output->WriteVarint32(value.size());
+  output->WriteRaw(value.data(), value.size());
+}
 
 
 void WireFormatLite::WriteGroup(int field_number,
@@ -353,6 +360,24 @@ bool WireFormatLite::ReadBytes(io::CodedInputStream* input,
   if (!input->ReadVarint32(&length)) return false;
   return input->InternalReadStringInline(value, length);
 }
+bool WireFormatLite::ReadStringPiece(io::CodedInputStream* input,
+                                     StringPieceField* value) {
+  uint32 length;
+  if (!input->ReadVarint32(&length)) return false;
+  if (input->AliasingEnabled()) {
+    // A flat array's buffer holds all of the input up to the current limit,
+    // so if the data isn't all there, the input is truncated and Skip()
+    // fails.
+    const void* data;
+    int size;
+    input->GetDirectBufferPointerInline(&data, &size);
+    if (length > static_cast<uint32>(size)) return false;
+    value->SetAliased(reinterpret_cast<const char*>(data), length);
+    return input->Skip(length);
+  }
+  value->Clear();
+  return input->InternalReadStringInline(value->Mutable(), length);
+}
 
 }  // namespace internal
 }  // namespace protobuf
@@ -291,6 +291,12 @@ class LIBPROTOBUF_EXPORT WireFormatLite {
   static bool ReadString(input, string* value);
   static bool ReadBytes (input, string* value);
 
+  // Reads a string or bytes field declared with [ctype=STRING_PIECE].  If
+  // the input has aliasing enabled (see CodedInputStream::EnableAliasing())
+  // the field is pointed at the data in the input's buffer, otherwise the
+  // data is copied.
+  static bool ReadStringPiece(input, StringPieceField* value);
+
   static inline bool ReadGroup  (field_number, input, MessageLite* value);
   static inline bool ReadMessage(input, MessageLite* value);
 
@@ -342,6 +348,8 @@ class LIBPROTOBUF_EXPORT WireFormatLite {
 
   static void WriteString(field_number, const string& value, output);
   static void WriteBytes (field_number, const string& value, output);
+  static void WriteStringPiece(
+    field_number, const StringPieceField& value, output);
 
   static void WriteGroup(
     field_number, const MessageLite& value, output);
@@ -420,6 +428,8 @@ class LIBPROTOBUF_EXPORT WireFormatLite {
     field_number, const string& value, output) INL;
   static inline uint8* WriteBytesToArray(
     field_number, const string& value, output) INL;
+  static inline uint8* WriteStringPieceToArray(
+    field_number, const StringPieceField& value, output) INL;
 
   static inline uint8* WriteGroupToArray(
       field_number, const MessageLite& value, output) INL;
@@ -465,6 +475,7 @@ class LIBPROTOBUF_EXPORT WireFormatLite {
 
   static inline int StringSize(const string& value);
   static inline int BytesSize (const string& value);
+  static inline int StringPieceSize(const StringPieceField& value);
 
   static inline int GroupSize  (const MessageLite& value);
   static inline int MessageSize(const MessageLite& value);
@@ -488,6 +499,30 @@ class LIBPROTOBUF_EXPORT WireFormatLite {
       google::protobuf::io::CodedInputStream* input,
       RepeatedField<CType>* value) GOOGLE_ATTRIBUTE_ALWAYS_INLINE;
 
+  // A helper method for the packed primitive reader, used for the types
+  // with fixed size on the wire.  The elements are reserved up front from the
+  // length prefix, and on little-endian machines the data is then copied
+  // straight into the RepeatedField's storage.
+  template <typename CType, enum FieldType DeclaredType>
+  static inline bool ReadPackedFixedSizePrimitive(
+      google::protobuf::io::CodedInputStream* input,
+      RepeatedField<CType>* value) GOOGLE_ATTRIBUTE_ALWAYS_INLINE;
+
+  // A helper method for the packed primitive reader, used for the types
+  // encoded as varints.  Values lying entirely within the input's current
+  // buffer are decoded in batches with CodedInputStream::ReadVarint64Batch()
+  // and appended to the RepeatedField without per-element bounds checks.
+  template <typename CType, enum FieldType DeclaredType>
+  static inline bool ReadPackedVarintPrimitive(
+      google::protobuf::io::CodedInputStream* input,
+      RepeatedField<CType>* value) GOOGLE_ATTRIBUTE_ALWAYS_INLINE;
+
+  // Converts a raw varint to the given type the same way the corresponding
+  // ReadPrimitive() specialization does.
+  template <typename CType, enum FieldType DeclaredType>
+  static inline CType DecodeVarintPrimitive(uint64 value)
+      GOOGLE_ATTRIBUTE_ALWAYS_INLINE;
+
   static const CppType kFieldTypeToCppTypeMap[];
   static const WireFormatLite::WireType kWireTypeForFieldType[];
 
@@ -40,6 +40,7 @@
 #include <google/protobuf/stubs/common.h>
 #include <google/protobuf/message_lite.h>
 #include <google/protobuf/repeated_field.h>
+#include <google/protobuf/string_piece_field.h>
 #include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/generated_message_util.h>
 #include <google/protobuf/io/coded_stream.h>
@@ -334,6 +335,178 @@ inline bool WireFormatLite::ReadPackedPrimitive(io::CodedInputStream* input,
   return true;
 }
 
+template <typename CType, enum WireFormatLite::FieldType DeclaredType>
+inline bool WireFormatLite::ReadPackedFixedSizePrimitive(
+    io::CodedInputStream* input,
+    RepeatedField<CType>* values) {
+  uint32 length;
+  if (!input->ReadVarint32(&length)) return false;
+  if (length % sizeof(CType) != 0) return false;
+  const int new_entries = length / sizeof(CType);
+
+  // The length is untrusted, so only reserve space for all of the elements
+  // if that many bytes could actually be read without hitting a limit.
+  // Otherwise a bogus length would let a tiny message trigger a huge
+  // allocation; in that case read one element at a time so that we fail at
+  // the end of the input instead.
+  int bytes_limit = input->BytesUntilTotalBytesLimit();
+  int current_limit = input->BytesUntilLimit();
+  if (current_limit != -1) bytes_limit = min(bytes_limit, current_limit);
+
+  if (bytes_limit >= 0 && length <= static_cast<uint32>(bytes_limit)) {
+    const int old_entries = values->size();
+    values->Reserve(old_entries + new_entries);
+#if !defined(PROTOBUF_DISABLE_LITTLE_ENDIAN_OPT_FOR_TEST) && \
+    defined(__BYTE_ORDER) && __BYTE_ORDER == __LITTLE_ENDIAN
+    // The wire format matches the in-memory representation, so let
+    // ReadRaw() copy the data across however many buffers it spans.
+    CType* dest = values->AddNAlreadyReserved(new_entries);
+    if (!input->ReadRaw(dest, length)) {
+      values->Truncate(old_entries);
+      return false;
+    }
+#else
+    CType value;
+    for (int i = 0; i < new_entries; i++) {
+      if (!ReadPrimitive<CType, DeclaredType>(input, &value)) return false;
+      values->AddAlreadyReserved(value);
+    }
+#endif
+  } else {
+    CType value;
+    for (int i = 0; i < new_entries; i++) {
+      if (!ReadPrimitive<CType, DeclaredType>(input, &value)) return false;
+      values->Add(value);
+    }
+  }
+  return true;
+}
+
+// Specializations of ReadPackedPrimitive for the fixed size types, which use
+// the bulk code path.
+#define READ_PACKED_FIXED_SIZE_PRIMITIVE(CPPTYPE, DECLARED_TYPE)               \
+template <>                                                                    \
+inline bool WireFormatLite::ReadPackedPrimitive<                               \
+  CPPTYPE, WireFormatLite::DECLARED_TYPE>(                                     \
+    io::CodedInputStream* input,                                               \
+    RepeatedField<CPPTYPE>* values) {                                          \
+  return ReadPackedFixedSizePrimitive<                                         \
+    CPPTYPE, WireFormatLite::DECLARED_TYPE>(input, values);                    \
+}
+
+READ_PACKED_FIXED_SIZE_PRIMITIVE(uint32, TYPE_FIXED32);
+READ_PACKED_FIXED_SIZE_PRIMITIVE(uint64, TYPE_FIXED64);
+READ_PACKED_FIXED_SIZE_PRIMITIVE(int32, TYPE_SFIXED32);
+READ_PACKED_FIXED_SIZE_PRIMITIVE(int64, TYPE_SFIXED64);
+READ_PACKED_FIXED_SIZE_PRIMITIVE(float, TYPE_FLOAT);
+READ_PACKED_FIXED_SIZE_PRIMITIVE(double, TYPE_DOUBLE);
+
+#undef READ_PACKED_FIXED_SIZE_PRIMITIVE
+
+template <>
+inline int32 WireFormatLite::DecodeVarintPrimitive<
+  int32, WireFormatLite::TYPE_INT32>(uint64 value) {
+  return static_cast<int32>(static_cast<uint32>(value));
+}
+template <>
+inline int64 WireFormatLite::DecodeVarintPrimitive<
+  int64, WireFormatLite::TYPE_INT64>(uint64 value) {
+  return static_cast<int64>(value);
+}
+template <>
+inline uint32 WireFormatLite::DecodeVarintPrimitive<
+  uint32, WireFormatLite::TYPE_UINT32>(uint64 value) {
+  return static_cast<uint32>(value);
+}
+template <>
+inline uint64 WireFormatLite::DecodeVarintPrimitive<
+  uint64, WireFormatLite::TYPE_UINT64>(uint64 value) {
+  return value;
+}
+template <>
+inline int32 WireFormatLite::DecodeVarintPrimitive<
+  int32, WireFormatLite::TYPE_SINT32>(uint64 value) {
+  return ZigZagDecode32(static_cast<uint32>(value));
+}
+template <>
+inline int64 WireFormatLite::DecodeVarintPrimitive<
+  int64, WireFormatLite::TYPE_SINT64>(uint64 value) {
+  return ZigZagDecode64(value);
+}
+template <>
+inline bool WireFormatLite::DecodeVarintPrimitive<
+  bool, WireFormatLite::TYPE_BOOL>(uint64 value) {
+  return static_cast<uint32>(value) != 0;
+}
+
+template <typename CType, enum WireFormatLite::FieldType DeclaredType>
+inline bool WireFormatLite::ReadPackedVarintPrimitive(
+    io::CodedInputStream* input,
+    RepeatedField<CType>* values) {
+  uint32 length;
+  if (!input->ReadVarint32(&length)) return false;
+  io::CodedInputStream::Limit limit = input->PushLimit(length);
+
+  // If the whole field is already in the buffer, count the values first so
+  // that the array only has to be grown once.  Every varint contains exactly
+  // one byte with the continuation bit clear.
+  const void* void_pointer;
+  int size;
+  input->GetDirectBufferPointerInline(&void_pointer, &size);
+  if (size > 0 && static_cast<uint32>(size) >= length) {
+    const uint8* buffer = reinterpret_cast<const uint8*>(void_pointer);
+    int count = 0;
+    for (uint32 i = 0; i < length; i++) {
+      count += buffer[i] < 0x80;
+    }
+    values->Reserve(values->size() + count);
+  }
+
+  // Decode in batches straight from the buffer.  Whenever the batch reader
+  // can't make progress (the next value crosses the end of the buffer, or is
+  // malformed) fall back to reading a single value the normal way.
+  static const int kBatchSize = 32;
+  uint64 batch[kBatchSize];
+  while (input->BytesUntilLimit() > 0) {
+    int count = input->ReadVarint64Batch(batch, kBatchSize);
+    if (count == 0) {
+      CType value;
+      if (!ReadPrimitive<CType, DeclaredType>(input, &value)) return false;
+      values->Add(value);
+    } else {
+      values->Reserve(values->size() + count);
+      for (int i = 0; i < count; i++) {
+        values->AddAlreadyReserved(
+            DecodeVarintPrimitive<CType, DeclaredType>(batch[i]));
+      }
+    }
+  }
+  input->PopLimit(limit);
+  return true;
+}
+
+// Specializations of ReadPackedPrimitive for the varint types, which use the
+// batched code path.
+#define READ_PACKED_VARINT_PRIMITIVE(CPPTYPE, DECLARED_TYPE)                   \
+template <>                                                                    \
+inline bool WireFormatLite::ReadPackedPrimitive<                               \
+  CPPTYPE, WireFormatLite::DECLARED_TYPE>(                                     \
+    io::CodedInputStream* input,                                               \
+    RepeatedField<CPPTYPE>* values) {                                          \
+  return ReadPackedVarintPrimitive<                                            \
+    CPPTYPE, WireFormatLite::DECLARED_TYPE>(input, values);                    \
+}
+
+READ_PACKED_VARINT_PRIMITIVE(int32, TYPE_INT32);
+READ_PACKED_VARINT_PRIMITIVE(int64, TYPE_INT64);
+READ_PACKED_VARINT_PRIMITIVE(uint32, TYPE_UINT32);
+READ_PACKED_VARINT_PRIMITIVE(uint64, TYPE_UINT64);
+READ_PACKED_VARINT_PRIMITIVE(int32, TYPE_SINT32);
+READ_PACKED_VARINT_PRIMITIVE(int64, TYPE_SINT64);
+READ_PACKED_VARINT_PRIMITIVE(bool, TYPE_BOOL);
+
+#undef READ_PACKED_VARINT_PRIMITIVE
+
 template <typename CType, enum WireFormatLite::FieldType DeclaredType>
 bool WireFormatLite::ReadPackedPrimitiveNoInline(io::CodedInputStream* input,
                                                  RepeatedField<CType>* values) {
@@ -654,6 +827,13 @@ inline uint8* WireFormatLite::WriteBytesToArray(int field_number,
   target = io::CodedOutputStream::WriteVarint32ToArray(value.size(), target);
   return io::CodedOutputStream::WriteStringToArray(value, target);
 }
+inline uint8* WireFormatLite::WriteStringPieceToArray(
+    int field_number, const StringPieceField& value, uint8* target) {
+  target = WriteTagToArray(field_number, WIRETYPE_LENGTH_DELIMITED, target);
+  target = io::CodedOutputStream::WriteVarint32ToArray(value.size(), target);
+  return io::CodedOutputStream::WriteRawToArray(value.data(), value.size(),
+                                                target);
+}
 
 
 inline uint8* WireFormatLite::WriteGroupToArray(int field_number,
@@ -720,6 +900,10 @@ inline int WireFormatLite::BytesSize(const string& value) {
   return io::CodedOutputStream::VarintSize32(value.size()) +
          value.size();
 }
+inline int WireFormatLite::StringPieceSize(const StringPieceField& value) {
+  return io::CodedOutputStream::VarintSize32(value.size()) +
+         value.size();
+}
 
 
 inline int WireFormatLite::GroupSize(const MessageLite& value) {
@@ -158,6 +158,67 @@ TEST(WireFormatTest, ParseUnpackedFromPacked) {
   TestUtil::ExpectUnpackedFieldsSet(dest);
 }
 
+TEST(WireFormatTest, ParseLargePackedAcrossBuffers) {
+  // Packed arrays big enough to span many buffers of the underlying stream
+  // exercise the bulk readers' handling of buffer boundaries.
+  unittest::TestPackedTypes source;
+  for (int i = 0; i < 1000; i++) {
+    source.add_packed_int32(i * (i % 2 ? -1 : 1));
+    source.add_packed_uint64(GOOGLE_ULONGLONG(1) << (i % 64));
+    source.add_packed_sint64(-i * GOOGLE_LONGLONG(1000000007));
+    source.add_packed_fixed32(i * 3);
+    source.add_packed_sfixed64(-i);
+    source.add_packed_float(i / 4.0);
+    source.add_packed_double(i / 8.0);
+    source.add_packed_bool(i % 3 == 0);
+  }
+  string data = source.SerializeAsString();
+
+  const int kBlockSizes[] = {1, 3, 7, 64, 1024, 1 << 20};
+  for (int i = 0; i < GOOGLE_ARRAYSIZE(kBlockSizes); i++) {
+    SCOPED_TRACE(kBlockSizes[i]);
+    unittest::TestPackedTypes dest;
+    io::ArrayInputStream raw_input(data.data(), data.size(), kBlockSizes[i]);
+    io::CodedInputStream input(&raw_input);
+    ASSERT_TRUE(dest.MergePartialFromCodedStream(&input));
+    EXPECT_EQ(source.SerializeAsString(), dest.SerializeAsString());
+  }
+}
+
+TEST(WireFormatTest, ParsePackedBogusLength) {
+  // A packed fixed64 field claiming to be far longer than the input must
+  // fail cleanly rather than reserving space for the claimed elements.
+  string data;
+  {
+    io::StringOutputStream raw_output(&data);
+    io::CodedOutputStream output(&raw_output);
+    output.WriteTag(WireFormatLite::MakeTag(
+        unittest::TestPackedTypes::kPackedFixed64FieldNumber,
+        WireFormatLite::WIRETYPE_LENGTH_DELIMITED));
+    output.WriteVarint32(0x7FFFFFF8);
+    output.WriteLittleEndian64(1);
+    output.WriteLittleEndian64(2);
+  }
+
+  unittest::TestPackedTypes dest;
+  EXPECT_FALSE(dest.ParseFromString(data));
+  EXPECT_LE(dest.packed_fixed64_size(), 2);
+
+  // A length which isn't a multiple of the element size is also rejected.
+  data.clear();
+  {
+    io::StringOutputStream raw_output(&data);
+    io::CodedOutputStream output(&raw_output);
+    output.WriteTag(WireFormatLite::MakeTag(
+        unittest::TestPackedTypes::kPackedFixed32FieldNumber,
+        WireFormatLite::WIRETYPE_LENGTH_DELIMITED));
+    output.WriteVarint32(6);
+    output.WriteLittleEndian32(1);
+    output.WriteLittleEndian32(2);
+  }
+  EXPECT_FALSE(dest.ParseFromString(data));
+}
+
 TEST(WireFormatTest, ParsePackedExtensions) {
   unittest::TestPackedExtensions source, dest;
   string data;
@@ -311,6 +372,71 @@ TEST(WireFormatTest, SerializeFieldsAndExtensions) {
   TestUtil::ExpectAllFieldsAndExtensionsInOrder(generated_data);
 }
 
+// Serializes the message one field at a time, the way WireFormat did before
+// it used plans.
+string SerializeFieldByField(const Message& message) {
+  vector<const FieldDescriptor*> fields;
+  message.GetReflection()->ListFields(message, &fields);
+  string data;
+  {
+    io::StringOutputStream raw_output(&data);
+    io::CodedOutputStream output(&raw_output);
+    for (int i = 0; i < fields.size(); i++) {
+      WireFormat::SerializeFieldWithCachedSizes(fields[i], message, &output);
+    }
+    WireFormat::SerializeUnknownFields(
+        message.GetReflection()->GetUnknownFields(message), &output);
+  }
+  return data;
+}
+
+void ExpectPlanMatchesFieldByField(const Message& message) {
+  vector<const FieldDescriptor*> fields;
+  message.GetReflection()->ListFields(message, &fields);
+  int field_by_field_size = WireFormat::ComputeUnknownFieldsSize(
+      message.GetReflection()->GetUnknownFields(message));
+  for (int i = 0; i < fields.size(); i++) {
+    field_by_field_size += WireFormat::FieldByteSize(fields[i], message);
+  }
+
+  int size = WireFormat::ByteSize(message);
+  EXPECT_EQ(field_by_field_size, size);
+
+  string data;
+  {
+    io::StringOutputStream raw_output(&data);
+    io::CodedOutputStream output(&raw_output);
+    WireFormat::SerializeWithCachedSizes(message, size, &output);
+  }
+  EXPECT_TRUE(data == SerializeFieldByField(message));
+}
+
+TEST(WireFormatTest, PlanMatchesFieldByField) {
+  unittest::TestAllTypes message;
+  ExpectPlanMatchesFieldByField(message);
+  TestUtil::SetAllFields(&message);
+  message.mutable_unknown_fields()->AddVarint(123456, 654321);
+  ExpectPlanMatchesFieldByField(message);
+
+  unittest::TestPackedTypes packed;
+  TestUtil::SetPackedFields(&packed);
+  ExpectPlanMatchesFieldByField(packed);
+
+  unittest::TestAllExtensions extensions;
+  ExpectPlanMatchesFieldByField(extensions);
+  TestUtil::SetAllExtensions(&extensions);
+  ExpectPlanMatchesFieldByField(extensions);
+
+  unittest::TestPackedExtensions packed_extensions;
+  TestUtil::SetPackedExtensions(&packed_extensions);
+  ExpectPlanMatchesFieldByField(packed_extensions);
+
+  // Extension ranges interleaved with fields.
+  unittest::TestFieldOrderings orderings;
+  TestUtil::SetAllFieldsAndExtensions(&orderings);
+  ExpectPlanMatchesFieldByField(orderings);
+}
+
 TEST(WireFormatTest, ParseMultipleExtensionRanges) {
   // Make sure we can parse a message that contains multiple extensions ranges.
   unittest::TestFieldOrderings source;